@@ -410,6 +410,11 @@ CHECK_FUNCTION_EXISTS (getrusage         ${HDF_PREFIX}_HAVE_GETRUSAGE)
 
 CHECK_FUNCTION_EXISTS (pread             ${HDF_PREFIX}_HAVE_PREAD)
 CHECK_FUNCTION_EXISTS (pwrite            ${HDF_PREFIX}_HAVE_PWRITE)
+CHECK_FUNCTION_EXISTS (preadv            ${HDF_PREFIX}_HAVE_PREADV)
+CHECK_FUNCTION_EXISTS (pwritev           ${HDF_PREFIX}_HAVE_PWRITEV)
+
+CHECK_FUNCTION_EXISTS (mremap            ${HDF_PREFIX}_HAVE_MREMAP)
+CHECK_SYMBOL_EXISTS (MADV_HUGEPAGE "sys/mman.h" ${HDF_PREFIX}_HAVE_MADV_HUGEPAGE)
 
 CHECK_FUNCTION_EXISTS (strcasestr        ${HDF_PREFIX}_HAVE_STRCASESTR)
 CHECK_FUNCTION_EXISTS (strdup            ${HDF_PREFIX}_HAVE_STRDUP)
@@ -599,6 +604,46 @@ if (HDF5_ENABLE_DIRECT_VFD)
   endif ()
 endif ()
 
+#-----------------------------------------------------------------------------
+# Check whether we can build the io_uring VFD
+#-----------------------------------------------------------------------------
+option (HDF5_ENABLE_IOURING_VFD "Build the Linux io_uring Virtual File Driver" OFF)
+if (HDF5_ENABLE_IOURING_VFD)
+  # The io_uring VFD uses the raw io_uring system calls, so only the kernel
+  # headers are needed (liburing is not required). IORING_OP_READ and
+  # IORING_OP_WRITE appeared in Linux 5.6, along with the
+  # IORING_FEAT_RW_CUR_POS feature flag checked for here (the opcodes
+  # themselves are enumerators, which CHECK_SYMBOL_EXISTS cannot see).
+  CHECK_SYMBOL_EXISTS (IORING_FEAT_RW_CUR_POS "linux/io_uring.h" HAVE_IORING_FEAT_RW_CUR_POS)
+  CHECK_SYMBOL_EXISTS (__NR_io_uring_setup "sys/syscall.h" HAVE_NR_IO_URING_SETUP)
+  CHECK_SYMBOL_EXISTS (posix_memalign "stdlib.h" HAVE_POSIX_MEMALIGN)
+
+  if (HAVE_IORING_FEAT_RW_CUR_POS AND HAVE_NR_IO_URING_SETUP AND HAVE_POSIX_MEMALIGN)
+    set (${HDF_PREFIX}_HAVE_IOURING_VFD 1)
+  else ()
+    set (HDF5_ENABLE_IOURING_VFD OFF CACHE BOOL "Build the Linux io_uring Virtual File Driver" FORCE)
+    message (FATAL_ERROR "The io_uring VFD was requested but cannot be built.\nIt requires the Linux io_uring system call headers and posix_memalign()")
+  endif ()
+endif ()
+
+#-----------------------------------------------------------------------------
+# Check whether we can build the memory-mapped (mmap) VFD
+#-----------------------------------------------------------------------------
+option (HDF5_ENABLE_MMAP_VFD "Build the read-only memory-mapped Virtual File Driver" OFF)
+if (HDF5_ENABLE_MMAP_VFD)
+  # The mmap VFD maps files read-only with mmap() and passes access pattern
+  # hints to the kernel with madvise().
+  CHECK_SYMBOL_EXISTS (mmap "sys/mman.h" HAVE_MMAP)
+  CHECK_SYMBOL_EXISTS (madvise "sys/mman.h" HAVE_MADVISE)
+
+  if (HAVE_MMAP AND HAVE_MADVISE)
+    set (${HDF_PREFIX}_HAVE_MMAP_VFD 1)
+  else ()
+    set (HDF5_ENABLE_MMAP_VFD OFF CACHE BOOL "Build the read-only memory-mapped Virtual File Driver" FORCE)
+    message (FATAL_ERROR "The mmap VFD was requested but cannot be built.\nIt requires mmap() and madvise()")
+  endif ()
+endif ()
+
 #-----------------------------------------------------------------------------
 #  Check if ROS3 driver can be built
 #-----------------------------------------------------------------------------
@@ -87,6 +87,9 @@ macro (H5_SET_VFD_LIST)
   if (H5_HAVE_DIRECT)
     list (APPEND VFD_LIST direct)
   endif ()
+  if (H5_HAVE_IOURING_VFD)
+    list (APPEND VFD_LIST io_uring)
+  endif ()
   if (H5_HAVE_PARALLEL)
     # MPI I/O VFD is currently incompatible with too many tests in the VFD test set
     # list (APPEND VFD_LIST mpio)
@@ -633,6 +633,41 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5get_free_list_sizes() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5get_free_list_cache_stats
+ *
+ * Purpose:    Gets statistics for the per-thread caches that threadsafe
+ *    builds keep in front of the free lists.  The hit, miss and spill
+ *    counts are totals for all threads since the library was loaded, and
+ *    the cached size is only for the calling thread.
+ *
+ * Parameters:
+ *  uint64_t *hits;      OUT: # of allocations taken from a thread's cache
+ *  uint64_t *misses;    OUT: # of allocations that went to the shared free lists
+ *  uint64_t *spills;    OUT: # of times a full cache returned objects to the shared free lists
+ *  size_t *thread_size; OUT: The size of the free objects in the calling thread's cache
+ *
+ * Return:    Success:    non-negative
+ *        Failure:    negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5get_free_list_cache_stats(uint64_t *hits /*out*/, uint64_t *misses /*out*/, uint64_t *spills /*out*/,
+                            size_t *thread_size /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Call the free list function to actually get the statistics */
+    if (H5FL_get_free_list_cache_stats(hits, misses, spills, thread_size) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGET, FAIL, "can't get free list cache statistics");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5get_free_list_cache_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5__debug_mask
  *
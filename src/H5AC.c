@@ -363,13 +363,19 @@ H5AC_create(const H5F_t *f, H5AC_cache_config_t *config_ptr, H5AC_cache_image_co
 #endif /* H5_HAVE_PARALLEL */
 
     /* Turn on metadata cache logging, if being used
-     * This will be JSON until we create a special API call. Trace output
-     * is generated when logging is controlled by the struct.
+     * This will be JSON or binary, as set with H5Pset_mdc_log_format().
+     * Trace output is generated when logging is controlled by the struct.
      */
-    if (H5F_USE_MDC_LOGGING(f))
-        if (H5C_log_set_up(f->shared->cache, H5F_MDC_LOG_LOCATION(f), H5C_LOG_STYLE_JSON,
+    if (H5F_USE_MDC_LOGGING(f)) {
+        H5C_log_style_t log_style = H5C_LOG_STYLE_JSON; /* Style of the log */
+
+        if (H5AC_LOG_FORMAT_BINARY == H5F_MDC_LOG_FORMAT(f))
+            log_style = H5C_LOG_STYLE_BINARY;
+
+        if (H5C_log_set_up(f->shared->cache, H5F_MDC_LOG_LOCATION(f), log_style,
                            H5F_START_MDC_LOG_ON_ACCESS(f)) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "mdc logging setup failed");
+    } /* end if */
 
     /* Set the cache parameters */
     if (H5AC_set_cache_auto_resize_config(f->shared->cache, config_ptr) < 0)
@@ -385,9 +391,14 @@ H5AC_create(const H5F_t *f, H5AC_cache_config_t *config_ptr, H5AC_cache_image_co
     int_ci_config.generate_image     = image_config_ptr->generate_image;
     int_ci_config.save_resize_status = image_config_ptr->save_resize_status;
     int_ci_config.entry_ageout       = image_config_ptr->entry_ageout;
+    int_ci_config.compression_level  = H5F_MDC_IMAGE_COMPRESSION(f);
     if (H5C_set_cache_image_config(f, f->shared->cache, &int_ci_config) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTSET, FAIL, "auto resize configuration failed");
 
+    /* Set the target used when the cache is sized from its working set */
+    if (H5C_set_cache_miss_latency_target(f->shared->cache, H5F_MDC_MISS_LATENCY_TARGET(f)) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTSET, FAIL, "can't set miss latency target");
+
 done:
     /* If currently logging, generate a message */
     if (f->shared->cache->log_info->logging)
@@ -1319,6 +1330,66 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_protect() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_read_ahead
+ *
+ * Purpose:     Read the images of several entries of the same class with
+ *              a single vector read, ahead of their loads by
+ *              H5AC_protect().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_read_ahead(H5F_t *f, const H5AC_class_t *type, size_t count, const haddr_t addrs[], const size_t sizes[])
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    assert(f);
+    assert(f->shared);
+    assert(f->shared->cache);
+    assert(type);
+
+    if (H5C_read_ahead(f, type, count, addrs, sizes) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "can't read entry images ahead");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_read_ahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_discard_read_ahead
+ *
+ * Purpose:     Discard the entry images read ahead with H5AC_read_ahead()
+ *              and not used.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_discard_read_ahead(H5F_t *f)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    assert(f);
+    assert(f->shared);
+    assert(f->shared->cache);
+
+    if (H5C_discard_read_ahead(f->shared->cache) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't discard read-ahead images");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_discard_read_ahead() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5AC_resize_entry
  *
@@ -1756,6 +1827,30 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_get_cache_hit_rate() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_get_cache_type_stats
+ *
+ * Purpose:     Wrapper function for H5C_get_cache_type_stats().
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_get_cache_type_stats(const H5AC_t *cache_ptr, size_t ntypes, H5F_mdc_type_stats_t *stats,
+                          size_t *total_ntypes)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if (H5C_get_cache_type_stats((const H5C_t *)cache_ptr, ntypes, stats, total_ntypes) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_get_cache_type_stats() failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_get_cache_type_stats() */
+
 /*-------------------------------------------------------------------------
  *
  * Function:    H5AC_reset_cache_hit_rate_stats()
@@ -167,6 +167,7 @@ typedef H5C_notify_action_t H5AC_notify_action_t;
 
 #define H5AC__CLASS_NO_FLAGS_SET          H5C__CLASS_NO_FLAGS_SET
 #define H5AC__CLASS_SPECULATIVE_LOAD_FLAG H5C__CLASS_SPECULATIVE_LOAD_FLAG
+#define H5AC__CLASS_TRAILING_CHKSUM_FLAG  H5C__CLASS_TRAILING_CHKSUM_FLAG
 
 /* The following flags should only appear in test code */
 #define H5AC__CLASS_SKIP_READS  H5C__CLASS_SKIP_READS
@@ -384,6 +385,9 @@ H5_DLL herr_t H5AC_prep_for_file_flush(H5F_t *f);
 H5_DLL herr_t H5AC_secure_from_file_flush(H5F_t *f);
 H5_DLL herr_t H5AC_create_flush_dependency(void *parent_thing, void *child_thing);
 H5_DLL void  *H5AC_protect(H5F_t *f, const H5AC_class_t *type, haddr_t addr, void *udata, unsigned flags);
+H5_DLL herr_t H5AC_read_ahead(H5F_t *f, const H5AC_class_t *type, size_t count, const haddr_t addrs[],
+                              const size_t sizes[]);
+H5_DLL herr_t H5AC_discard_read_ahead(H5F_t *f);
 H5_DLL herr_t H5AC_resize_entry(void *thing, size_t new_size);
 H5_DLL herr_t H5AC_unpin_entry(void *thing);
 H5_DLL herr_t H5AC_destroy_flush_dependency(void *parent_thing, void *child_thing);
@@ -403,6 +407,8 @@ H5_DLL herr_t H5AC_get_cache_size(const H5AC_t *cache_ptr, size_t *max_size_ptr,
                                   size_t *cur_size_ptr, uint32_t *cur_num_entries_ptr);
 H5_DLL herr_t H5AC_get_cache_flush_in_progress(H5AC_t *cache_ptr, bool *flush_in_progress_ptr);
 H5_DLL herr_t H5AC_get_cache_hit_rate(const H5AC_t *cache_ptr, double *hit_rate_ptr);
+H5_DLL herr_t H5AC_get_cache_type_stats(const H5AC_t *cache_ptr, size_t ntypes, H5F_mdc_type_stats_t *stats,
+                                        size_t *total_ntypes);
 H5_DLL herr_t H5AC_reset_cache_hit_rate_stats(H5AC_t *cache_ptr);
 H5_DLL herr_t H5AC_set_cache_auto_resize_config(H5AC_t *cache_ptr, const H5AC_cache_config_t *config_ptr);
 H5_DLL herr_t H5AC_validate_config(const H5AC_cache_config_t *config_ptr);
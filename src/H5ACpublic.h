@@ -154,7 +154,7 @@
  *
  * incr_mode: Instance of the H5C_cache_incr_mode enumerated type whose
  *      value indicates how we determine whether the cache size should be
- *      increased.  At present there are two possible values:
+ *      increased.  At present there are three possible values:
  *
  *      H5C_incr__off:  Don't attempt to increase the size of the cache
  *              automatically.
@@ -171,6 +171,24 @@
  *              at its maximum size, or if the cache is not already using
  *              all available space.
  *
+ *      H5C_incr__working_set: Estimate the working set of the file's
+ *              metadata at the end of each epoch from the entries used,
+ *              and from the entries that were evicted and then loaded
+ *              again, and resize the cache to match.  The cache is grown
+ *              until the average time per cache access spent loading
+ *              entries from the file meets the target set with
+ *              H5Pset_mdc_miss_latency_target(), or until the cache would
+ *              have held all the reloaded entries if no target is set.
+ *              When no evicted entry was loaded again and the target is
+ *              met, the cache is shrunk to the size of the entries used in
+ *              the epoch, plus the empty reserve if apply_empty_reserve is
+ *              set.
+ *
+ *              As this mode sizes the cache in both directions, decr_mode
+ *              must be H5C_decr__off.  The increment, threshold and
+ *              epochs_before_eviction fields are ignored, but max_increment
+ *              and max_decrement are applied when enabled.
+ *
  *      Note that you must set decr_mode to H5C_incr__off if you
  *      disable metadata cache entry evictions.
  *
@@ -579,7 +597,7 @@ typedef struct H5AC_cache_config_t {
     //! <!-- [H5AC_cache_config_t_incr_snip] -->
     enum H5C_cache_incr_mode incr_mode;
     /**< Enumerated value indicating the operational mode of the automatic
-     * cache size increase code. At present, only two values listed in
+     * cache size increase code. At present, the values listed in
      * #H5C_cache_incr_mode are legal. */
 
     double lower_hr_threshold;
@@ -785,4 +803,14 @@ typedef struct H5AC_cache_image_config_t {
 
 //! <!-- [H5AC_cache_image_config_t_snip] -->
 
+//! <!-- [H5AC_log_format_t_snip] -->
+/**
+ * Formats of the metadata cache log, see H5Pset_mdc_log_format()
+ */
+typedef enum H5AC_log_format_t {
+    H5AC_LOG_FORMAT_JSON   = 0, /**< One JSON message per cache operation (default) */
+    H5AC_LOG_FORMAT_BINARY = 1  /**< Buffered binary records, converted by h5mdclog */
+} H5AC_log_format_t;
+//! <!-- [H5AC_log_format_t_snip] -->
+
 #endif
@@ -194,8 +194,11 @@ H5C_create(size_t max_cache_size, size_t min_clean_size, int max_type_id,
         cache_ptr->slist_ring_size[i] = (size_t)0;
     } /* end for */
 
-    for (i = 0; i < H5C__HASH_TABLE_LEN; i++)
-        (cache_ptr->index)[i] = NULL;
+    cache_ptr->index         = NULL;
+    cache_ptr->index_buckets = 0;
+    cache_ptr->index_bits    = 0;
+    if (H5C__resize_index(cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "can't allocate cache index");
 
     cache_ptr->il_len  = 0;
     cache_ptr->il_size = (size_t)0;
@@ -323,6 +326,7 @@ H5C_create(size_t max_cache_size, size_t min_clean_size, int max_type_id,
     cache_ptr->image_ctl.save_resize_status = false;
     cache_ptr->image_ctl.entry_ageout       = -1;
     cache_ptr->image_ctl.flags              = H5C_CI__ALL_FLAGS;
+    cache_ptr->image_ctl.compression_level  = 0;
 
     cache_ptr->serialization_in_progress = false;
     cache_ptr->load_image                = false;
@@ -341,6 +345,33 @@ H5C_create(size_t max_cache_size, size_t min_clean_size, int max_type_id,
     cache_ptr->image_entries        = NULL;
     cache_ptr->image_buffer         = NULL;
 
+    cache_ptr->lazy_image_buffer       = NULL;
+    cache_ptr->lazy_image_entries      = NULL;
+    cache_ptr->num_lazy_image_entries  = 0;
+    cache_ptr->lazy_image_entries_left = 0;
+
+    cache_ptr->write_batch_depth   = 0;
+    cache_ptr->write_batch_enabled = false;
+    cache_ptr->batch_writes        = NULL;
+    cache_ptr->num_batch_writes    = 0;
+    cache_ptr->batch_writes_alloc  = 0;
+    cache_ptr->batch_buf           = NULL;
+    cache_ptr->batch_buf_len       = 0;
+    cache_ptr->batch_buf_alloc     = 0;
+
+    cache_ptr->read_ahead          = NULL;
+    cache_ptr->num_read_ahead      = 0;
+    cache_ptr->num_read_ahead_left = 0;
+
+    /* initialize fields supporting the working set size increase mode */
+    cache_ptr->ws_ghost_slist    = NULL;
+    cache_ptr->ws_ghost_head     = NULL;
+    cache_ptr->ws_ghost_tail     = NULL;
+    cache_ptr->ws_ghost_size     = 0;
+    cache_ptr->ws_evicted_bytes  = 0;
+    cache_ptr->ws_epoch          = 0;
+    cache_ptr->ws_target_latency = 0.0;
+
     /* initialize free space manager related fields: */
     cache_ptr->rdfsm_settled = false;
     cache_ptr->mdfsm_settled = false;
@@ -372,6 +403,8 @@ done:
             if (cache_ptr->log_info != NULL)
                 H5MM_xfree(cache_ptr->log_info);
 
+            H5MM_xfree(cache_ptr->index);
+
             cache_ptr = H5FL_FREE(H5C_t, cache_ptr);
         }
     }
@@ -526,6 +559,25 @@ H5C_dest(H5F_t *f)
         item = H5FL_FREE(H5C_tag_info_t, item);
     }
 
+    /* Discard any cache image entries that were never reconstructed */
+    if (H5C__free_lazy_image_entries(cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't free lazy image entries");
+
+    /* Write batches are released when they end */
+    assert(0 == cache_ptr->write_batch_depth);
+    assert(NULL == cache_ptr->batch_writes);
+    assert(NULL == cache_ptr->batch_buf);
+
+    /* Discard any images read ahead and never used */
+    if (H5C_discard_read_ahead(cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't discard read-ahead images");
+
+    /* Discard the ghost entries of the working set size increase mode */
+    if (H5C__ws_discard_ghosts(cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't discard ghost entries");
+
+    cache_ptr->index = (H5C_cache_entry_t **)H5MM_xfree(cache_ptr->index);
+
     if (cache_ptr->log_info != NULL)
         H5MM_xfree(cache_ptr->log_info);
 
@@ -793,6 +845,12 @@ H5C_reset_cache_hit_rate_stats(H5C_t *cache_ptr)
     cache_ptr->cache_hits     = 0;
     cache_ptr->cache_accesses = 0;
 
+    /* Start a new epoch for the working set size increase mode */
+    memset(cache_ptr->ws_ghost_hits, 0, sizeof(cache_ptr->ws_ghost_hits));
+    cache_ptr->ws_epoch++;
+    cache_ptr->ws_epoch_size      = 0;
+    cache_ptr->ws_epoch_load_time = 0;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_reset_cache_hit_rate_stats() */
@@ -861,6 +919,11 @@ H5C_set_cache_auto_resize_config(H5C_t *cache_ptr, H5C_auto_size_ctl_t *config_p
                 cache_ptr->size_increase_possible = false;
             break;
 
+        case H5C_incr__working_set:
+            if ((config_ptr->apply_max_increment) && (config_ptr->max_increment <= 0))
+                cache_ptr->size_increase_possible = false;
+            break;
+
         default: /* should be unreachable */
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Unknown incr_mode?!?!?");
     } /* end switch */
@@ -872,7 +935,11 @@ H5C_set_cache_auto_resize_config(H5C_t *cache_ptr, H5C_auto_size_ctl_t *config_p
 
     switch (config_ptr->decr_mode) {
         case H5C_decr__off:
-            cache_ptr->size_decrease_possible = false;
+            /* The working set mode decreases the cache size itself */
+            if ((config_ptr->incr_mode != H5C_incr__working_set) ||
+                (config_ptr->apply_empty_reserve && config_ptr->empty_reserve >= 1.0) ||
+                (config_ptr->apply_max_decrement && config_ptr->max_decrement <= 0))
+                cache_ptr->size_decrease_possible = false;
             break;
 
         case H5C_decr__threshold:
@@ -961,6 +1028,11 @@ H5C_set_cache_auto_resize_config(H5C_t *cache_ptr, H5C_auto_size_ctl_t *config_p
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "error removing all epoch markers");
     }
 
+    /* discard the ghost entries if the working set mode is no longer in use */
+    if (config_ptr->incr_mode != H5C_incr__working_set)
+        if (H5C__ws_discard_ghosts(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't discard ghost entries");
+
     /* configure flash size increase facility.  We wait until the
      * end of the function, as we need the max_cache_size set before
      * we start to keep things simple.
@@ -990,6 +1062,36 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_set_cache_auto_resize_config() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5C_set_cache_miss_latency_target()
+ *
+ * Purpose:     Set the target average time, in seconds, that an access of
+ *              the cache may spend loading entries from the file.  The
+ *              target is used when the cache is sized by the working set
+ *              size increase mode.  Zero means there is no target.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_set_cache_miss_latency_target(H5C_t *cache_ptr, double target)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if (cache_ptr == NULL)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "bad cache_ptr on entry");
+    if (!(target >= 0.0))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "miss latency target must be non-negative");
+
+    cache_ptr->ws_target_latency = target;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_set_cache_miss_latency_target() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5C_set_evictions_enabled()
  *
@@ -1236,7 +1338,8 @@ H5C_validate_resize_config(H5C_auto_size_ctl_t *config_ptr, unsigned int tests)
     } /* H5C_RESIZE_CFG__VALIDATE_GENERAL */
 
     if ((tests & H5C_RESIZE_CFG__VALIDATE_INCREMENT) != 0) {
-        if ((config_ptr->incr_mode != H5C_incr__off) && (config_ptr->incr_mode != H5C_incr__threshold))
+        if ((config_ptr->incr_mode != H5C_incr__off) && (config_ptr->incr_mode != H5C_incr__threshold) &&
+            (config_ptr->incr_mode != H5C_incr__working_set))
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid incr_mode");
 
         if (config_ptr->incr_mode == H5C_incr__threshold) {
@@ -1251,6 +1354,11 @@ H5C_validate_resize_config(H5C_auto_size_ctl_t *config_ptr, unsigned int tests)
              */
         } /* H5C_incr__threshold */
 
+        if (config_ptr->incr_mode == H5C_incr__working_set)
+            if (config_ptr->apply_empty_reserve &&
+                (config_ptr->empty_reserve >= 1.0 || config_ptr->empty_reserve < 0.0))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "empty_reserve must be in the interval [0.0, 1.0)");
+
         switch (config_ptr->flash_incr_mode) {
             case H5C_flash_incr__off:
                 /* nothing to do here */
@@ -1315,6 +1423,10 @@ H5C_validate_resize_config(H5C_auto_size_ctl_t *config_ptr, unsigned int tests)
              (config_ptr->decr_mode == H5C_decr__age_out_with_threshold)) &&
             (config_ptr->lower_hr_threshold >= config_ptr->upper_hr_threshold))
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "conflicting threshold fields in config");
+
+        /* The working set mode sizes the cache in both directions */
+        if ((config_ptr->incr_mode == H5C_incr__working_set) && (config_ptr->decr_mode != H5C_decr__off))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "working set incr_mode requires decr_mode to be off");
     } /* H5C_RESIZE_CFG__VALIDATE_INTERACTIONS */
 
 done:
@@ -42,19 +42,31 @@
 
 #ifdef H5_HAVE_THREADSAFE_API
 /*
- * The per-thread API context.
- *
- * In order for this macro to work, H5CX_get_my_context() must be preceded
- * by "H5CX_node_t **ctx =".
+ * The per-thread API context stack.
  */
-#define H5CX_get_my_context() H5TS_get_api_ctx_ptr()
+#define H5CX_get_my_stack() H5TS_get_api_ctx_ptr()
 #else /* H5_HAVE_THREADSAFE_API */
 /*
- * The current API context.
+ * The API context stack.
  */
-#define H5CX_get_my_context() (&H5CX_head_g)
+#define H5CX_get_my_stack() (&H5CX_stack_g)
 #endif /* H5_HAVE_THREADSAFE_API */
 
+/*
+ * The current API context.
+ *
+ * In order for this macro to work, H5CX_get_my_context() must be preceded
+ * by "H5CX_node_t **ctx =".  (The head of the stack is its first field.)
+ */
+#define H5CX_get_my_context() ((H5CX_node_t **)H5CX_get_my_stack())
+
+/* Size of the part of an API context that is reset when it's pushed: the
+ * property list IDs, the internal fields and the flags for the cached
+ * properties.  The cached values themselves are only read after their flag is
+ * set, so they don't need to be cleared for each API call.
+ */
+#define H5CX_RESET_SIZE offsetof(H5CX_t, max_temp_buf)
+
 /* Common macro for the retrieving the pointer to a property list */
 #define H5CX_RETRIEVE_PLIST(PL, FAILVAL)                                                                     \
     /* Check if the property list is already available */                                                    \
@@ -137,6 +149,14 @@
 /* Local Typedefs */
 /******************/
 
+/* Typedef for API context nodes allocated when a thread's pool of nodes is
+ * empty, which are kept on a list so H5CX_pop() can recognize them.
+ */
+typedef struct H5CX_extra_node_t {
+    H5CX_node_t               cnode; /* Context node */
+    struct H5CX_extra_node_t *prev;  /* Node allocated before this one */
+} H5CX_extra_node_t;
+
 /* Typedef for cached default dataset transfer property list information */
 /* This is initialized to the values in the default DXPL during package
  * initialization and then remains constant for the rest of the library's
@@ -174,7 +194,8 @@ typedef struct H5CX_dxpl_cache_t {
                                                             (H5D_XFER_NO_SELECTION_IO_CAUSE_NAME) */
     uint32_t actual_selection_io_mode;             /* Actual selection I/O mode
                                                          (H5D_XFER_ACTUAL_SELECTION_IO_MODE_NAME) */
-    bool modify_write_buf;                         /* Whether the library can modify write buffers */
+    bool     modify_write_buf;                     /* Whether the library can modify write buffers */
+    unsigned dset_io_threads; /* Threads for dataset I/O (H5D_XFER_DSET_IO_THREADS_NAME) */
 } H5CX_dxpl_cache_t;
 
 /* Typedef for cached default link creation property list information */
@@ -227,8 +248,8 @@ bool H5_PKG_INIT_VAR = false;
 /*******************/
 
 #ifndef H5_HAVE_THREADSAFE_API
-static H5CX_node_t *H5CX_head_g = NULL; /* Pointer to head of context stack */
-#endif                                  /* H5_HAVE_THREADSAFE_API */
+static H5CX_stack_t H5CX_stack_g; /* Context stack and its pool of nodes */
+#endif                            /* H5_HAVE_THREADSAFE_API */
 
 /* Define a "default" dataset transfer property list cache structure to use for default DXPLs */
 static H5CX_dxpl_cache_t H5CX_def_dxpl_cache;
@@ -377,6 +398,10 @@ H5CX__init_package(void)
     if (H5P_get(dx_plist, H5D_XFER_MODIFY_WRITE_BUF_NAME, &H5CX_def_dxpl_cache.modify_write_buf) < 0)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve modify write buffer property");
 
+    /* Get the number of threads for dataset I/O */
+    if (H5P_get(dx_plist, H5D_XFER_DSET_IO_THREADS_NAME, &H5CX_def_dxpl_cache.dset_io_threads) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve dataset I/O threads property");
+
     /* Reset the "default LCPL cache" information */
     memset(&H5CX_def_lcpl_cache, 0, sizeof(H5CX_lcpl_cache_t));
 
@@ -478,14 +503,16 @@ H5CX_term_package(void)
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
     if (H5_PKG_INIT_VAR) {
-        H5CX_node_t **head = NULL; /* Pointer to head of API context list */
+        H5CX_stack_t *stack = NULL; /* Pointer to API context stack */
 
-        /* Get the pointer to the head of the API context, for this thread */
-        head = H5CX_get_my_context();
-        assert(head);
+        /* Get the pointer to the API context stack, for this thread */
+        stack = H5CX_get_my_stack();
+        assert(stack);
 
         /* Reset head of context list */
-        *head = NULL;
+        stack->head    = NULL;
+        stack->npooled = 0;
+        stack->extra   = NULL;
 
         H5_PKG_INIT_VAR = false;
     } /* end if */
@@ -520,26 +547,21 @@ H5CX_pushed(void)
 }
 
 /*-------------------------------------------------------------------------
- * Function:    H5CX_push
+ * Function:    H5CX__push_common
  *
- * Purpose:     Pushes a context for an API call.
+ * Purpose:     Initializes a context node and pushes it on a stack.
  *
- * Return:      Non-negative on success / Negative on failure
+ * Return:      None
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5CX_push(H5CX_node_t *cnode)
+static inline void
+H5CX__push_common(H5CX_node_t **head, H5CX_node_t *cnode)
 {
-    H5CX_node_t **head      = NULL;    /* Pointer to head of API context list */
-    herr_t        ret_value = SUCCEED; /* Return value */
+    FUNC_ENTER_PACKAGE_NOERR
 
-    FUNC_ENTER_NOAPI(FAIL)
-
-    /* Sanity check */
-    assert(cnode);
-    head = H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
-    assert(head);
+    /* Reset the context, up to the cached property values */
+    memset(&cnode->ctx, 0, H5CX_RESET_SIZE);
 
     /* Set non-zero context info */
     cnode->ctx.dxpl_id = H5P_DATASET_XFER_DEFAULT;
@@ -560,10 +582,84 @@ H5CX_push(H5CX_node_t *cnode)
     cnode->next = *head;
     *head       = cnode;
 
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5CX__push_common() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_push
+ *
+ * Purpose:     Pushes a context for an API call, in a node provided by
+ *              the caller.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_push(H5CX_node_t *cnode)
+{
+    H5CX_node_t **head      = NULL;    /* Pointer to head of API context list */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    assert(cnode);
+    head = H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
+    assert(head);
+
+    /* Push the node */
+    H5CX__push_common(head, cnode);
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX_push() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_push_api
+ *
+ * Purpose:     Pushes a context for a public API call, in the next node
+ *              from the thread's pool.  When API calls are nested deeper
+ *              than the pool, the node is allocated and freed when it is
+ *              popped.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_push_api(void)
+{
+    H5CX_stack_t *stack     = NULL;    /* Pointer to API context stack */
+    H5CX_node_t  *cnode     = NULL;    /* Context node to push */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Get the API context stack for this thread */
+    if (H5_UNLIKELY(NULL == (stack = H5CX_get_my_stack())))
+        HGOTO_ERROR(H5E_CONTEXT, H5E_UNINITIALIZED, FAIL, "the API context isn't available");
+
+    /* Get a node from the pool, or allocate one if they're all in use */
+    if (H5_LIKELY(stack->npooled < H5CX_NODE_POOL_SIZE))
+        cnode = &stack->pool[stack->npooled++];
+    else {
+        H5CX_extra_node_t *extra; /* Node allocated for the call */
+
+        if (NULL == (extra = (H5CX_extra_node_t *)H5MM_malloc(sizeof(H5CX_extra_node_t))))
+            HGOTO_ERROR(H5E_CONTEXT, H5E_CANTALLOC, FAIL, "can't allocate API context node");
+        extra->prev  = stack->extra;
+        stack->extra = extra;
+        cnode        = &extra->cnode;
+    } /* end else */
+
+    /* Push the node */
+    H5CX__push_common(&stack->head, cnode);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_push_api() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5CX_retrieve_state
  *
@@ -644,9 +740,8 @@ H5CX_retrieve_state(H5CX_state_t **api_state)
         (*api_state)->lcpl_id = H5P_LINK_CREATE_DEFAULT;
 
     /* Keep a reference to the current VOL wrapping context */
-    (*api_state)->vol_wrap_ctx = (*head)->ctx.vol_wrap_ctx;
+    (*api_state)->vol_wrap_ctx = (*head)->ctx.vol_wrap_ctx_valid ? (*head)->ctx.vol_wrap_ctx : NULL;
     if (NULL != (*api_state)->vol_wrap_ctx) {
-        assert((*head)->ctx.vol_wrap_ctx_valid);
         if (H5VL_inc_vol_wrapper((*api_state)->vol_wrap_ctx) < 0)
             HGOTO_ERROR(H5E_CONTEXT, H5E_CANTINC, FAIL, "can't increment refcount on VOL wrapping context");
     } /* end if */
@@ -1021,8 +1116,11 @@ H5CX_set_apl(hid_t *acspl_id, const H5P_libclass_t *libclass,
     head = H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
     assert(head && *head);
 
-    /* Set access plist to the default property list of the appropriate class if it's the generic default */
-    if (H5P_DEFAULT == *acspl_id)
+    /* Set access plist to the default property list of the appropriate class if it's the generic default.
+     * The class's own default list is treated the same way, since the context already uses the default
+     * access property lists.
+     */
+    if (H5P_DEFAULT == *acspl_id || *libclass->def_plist_id == *acspl_id)
         *acspl_id = *libclass->def_plist_id;
     else {
         htri_t is_lapl; /* Whether the access property list is (or is derived from) a link access property
@@ -2307,6 +2405,39 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX_get_selection_io_mode() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_dset_io_threads
+ *
+ * Purpose:     Retrieves the number of threads for dataset I/O for the
+ *              current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_dset_io_threads(unsigned *dset_io_threads)
+{
+    H5CX_node_t **head      = NULL;    /* Pointer to head of API context list */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    assert(dset_io_threads);
+    head = H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
+    assert(head && *head);
+    assert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_DSET_IO_THREADS_NAME, dset_io_threads)
+
+    /* Get the value */
+    *dset_io_threads = (*head)->ctx.dset_io_threads;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_dset_io_threads() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5CX_get_encoding
  *
@@ -3315,14 +3446,17 @@ done:
 herr_t
 H5CX_pop(bool update_dxpl_props)
 {
+    H5CX_stack_t *stack     = NULL;    /* Pointer to API context stack */
     H5CX_node_t **head      = NULL;    /* Pointer to head of API context list */
+    H5CX_node_t  *cnode     = NULL;    /* Context node popped */
     herr_t        ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
     /* Sanity check */
-    head = H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
-    assert(head && *head);
+    stack = H5CX_get_my_stack(); /* Get the pointer to the API context stack, for this thread */
+    assert(stack && stack->head);
+    head = &stack->head;
 
     /* Check for cached DXPL properties to return to application */
     if (update_dxpl_props) {
@@ -3355,7 +3489,20 @@ H5CX_pop(bool update_dxpl_props)
     }  /* end if */
 
     /* Pop the top context node from the stack */
-    (*head) = (*head)->next;
+    cnode   = *head;
+    (*head) = cnode->next;
+
+    /* Return the node to the pool, or free it if it was allocated for an API
+     * call.  (Nodes from H5CX_push() belong to its caller.)
+     */
+    if (H5_LIKELY(stack->npooled > 0 && cnode == &stack->pool[stack->npooled - 1]))
+        stack->npooled--;
+    else if (H5_UNLIKELY(stack->extra && cnode == &stack->extra->cnode)) {
+        H5CX_extra_node_t *extra = stack->extra; /* Node allocated for the call */
+
+        stack->extra = extra->prev;
+        H5MM_xfree(extra);
+    } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
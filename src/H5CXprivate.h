@@ -134,151 +134,194 @@ typedef struct H5CX_t {
     bool         rank0_bcast;        /* Whether a dataset meets read-with-rank0-and-bcast requirements */
 #endif                               /* H5_HAVE_PARALLEL */
 
-    /* Cached DXPL properties */
-    size_t    max_temp_buf;            /* Maximum temporary buffer size (H5D_XFER_MAX_TEMP_BUF_NAME) .*/
-    bool      max_temp_buf_valid;      /* Whether maximum temporary buffer size is valid */
-    void     *tconv_buf;               /* Temporary conversion buffer (H5D_XFER_TCONV_BUF_NAME) */
-    bool      tconv_buf_valid;         /* Whether temporary conversion buffer is valid */
-    void     *bkgr_buf;                /* Background conversion buffer (H5D_XFER_BKGR_BUF_NAME) */
-    bool      bkgr_buf_valid;          /* Whether background conversion buffer is valid */
-    H5T_bkg_t bkgr_buf_type;           /* Background buffer type (H5D_XFER_BKGR_BUF_TYPE_NAME) */
-    bool      bkgr_buf_type_valid;     /* Whether background buffer type is valid */
-    double    btree_split_ratio[3];    /* B-tree split ratios (H5D_XFER_BTREE_SPLIT_RATIO_NAME) */
-    bool      btree_split_ratio_valid; /* Whether B-tree split ratios are valid */
-    size_t    vec_size;                /* Size of hyperslab vector (H5D_XFER_HYPER_VECTOR_SIZE_NAME) */
-    bool      vec_size_valid;          /* Whether hyperslab vector is valid */
+    /* Flags for the cached and return-only properties below */
+    /* (H5CX_push() resets the fields above and these flags, but not the property values
+     *  after them, which are only read once their flag is set.  'max_temp_buf' must be the
+     *  first field after the flags.)
+     */
+
+    /* Flags for cached DXPL properties */
+    bool max_temp_buf_valid;      /* Whether maximum temporary buffer size is valid */
+    bool tconv_buf_valid;         /* Whether temporary conversion buffer is valid */
+    bool bkgr_buf_valid;          /* Whether background conversion buffer is valid */
+    bool bkgr_buf_type_valid;     /* Whether background buffer type is valid */
+    bool btree_split_ratio_valid; /* Whether B-tree split ratios are valid */
+    bool vec_size_valid;          /* Whether hyperslab vector is valid */
 #ifdef H5_HAVE_PARALLEL
-    H5FD_mpio_xfer_t io_xfer_mode; /* Parallel transfer mode for this request (H5D_XFER_IO_XFER_MODE_NAME) */
-    bool             io_xfer_mode_valid;      /* Whether parallel transfer mode is valid */
-    H5FD_mpio_collective_opt_t mpio_coll_opt; /* Parallel transfer with independent IO or collective IO with
-                                                 this mode (H5D_XFER_MPIO_COLLECTIVE_OPT_NAME) */
-    bool mpio_coll_opt_valid;                 /* Whether parallel transfer option is valid */
-    H5FD_mpio_chunk_opt_t
-             mpio_chunk_opt_mode;        /* Collective chunk option (H5D_XFER_MPIO_CHUNK_OPT_HARD_NAME) */
-    bool     mpio_chunk_opt_mode_valid;  /* Whether collective chunk option is valid */
-    unsigned mpio_chunk_opt_num;         /* Collective chunk threshold (H5D_XFER_MPIO_CHUNK_OPT_NUM_NAME) */
-    bool     mpio_chunk_opt_num_valid;   /* Whether collective chunk threshold is valid */
-    unsigned mpio_chunk_opt_ratio;       /* Collective chunk ratio (H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME) */
-    bool     mpio_chunk_opt_ratio_valid; /* Whether collective chunk ratio is valid */
-#endif                                   /* H5_HAVE_PARALLEL */
-    H5Z_EDC_t               err_detect;  /* Error detection info (H5D_XFER_EDC_NAME) */
-    bool                    err_detect_valid;     /* Whether error detection info is valid */
-    H5Z_cb_t                filter_cb;            /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
-    bool                    filter_cb_valid;      /* Whether filter callback function is valid */
-    H5Z_data_xform_t       *data_transform;       /* Data transform info (H5D_XFER_XFORM_NAME) */
-    bool                    data_transform_valid; /* Whether data transform info is valid */
-    H5T_vlen_alloc_info_t   vl_alloc_info;        /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
-    bool                    vl_alloc_info_valid;  /* Whether VL datatype alloc info is valid */
-    H5T_conv_cb_t           dt_conv_cb;           /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
-    bool                    dt_conv_cb_valid;     /* Whether datatype conversion struct is valid */
-    H5D_selection_io_mode_t selection_io_mode;    /* Selection I/O mode (H5D_XFER_SELECTION_IO_MODE_NAME) */
-    bool                    selection_io_mode_valid; /* Whether selection I/O mode is valid */
-    bool modify_write_buf; /* Whether the library can modify write buffers (H5D_XFER_MODIFY_WRITE_BUF_NAME)*/
-    bool modify_write_buf_valid; /* Whether the modify_write_buf field is valid */
-
-    /* Return-only DXPL properties to return to application */
+    bool io_xfer_mode_valid;         /* Whether parallel transfer mode is valid */
+    bool mpio_coll_opt_valid;        /* Whether parallel transfer option is valid */
+    bool mpio_chunk_opt_mode_valid;  /* Whether collective chunk option is valid */
+    bool mpio_chunk_opt_num_valid;   /* Whether collective chunk threshold is valid */
+    bool mpio_chunk_opt_ratio_valid; /* Whether collective chunk ratio is valid */
+#endif                               /* H5_HAVE_PARALLEL */
+    bool err_detect_valid;           /* Whether error detection info is valid */
+    bool filter_cb_valid;            /* Whether filter callback function is valid */
+    bool data_transform_valid;       /* Whether data transform info is valid */
+    bool vl_alloc_info_valid;        /* Whether VL datatype alloc info is valid */
+    bool dt_conv_cb_valid;           /* Whether datatype conversion struct is valid */
+    bool selection_io_mode_valid;    /* Whether selection I/O mode is valid */
+    bool modify_write_buf_valid;     /* Whether the modify_write_buf field is valid */
+    bool dset_io_threads_valid;      /* Whether the dset_io_threads field is valid */
+
+    /* Flags for return-only DXPL properties */
 #ifdef H5_HAVE_PARALLEL
-    H5D_mpio_actual_chunk_opt_mode_t mpio_actual_chunk_opt; /* Chunk optimization mode used for parallel I/O
-                                                               (H5D_MPIO_ACTUAL_CHUNK_OPT_MODE_NAME) */
-    bool mpio_actual_chunk_opt_set; /* Whether chunk optimization mode used for parallel I/O is set */
-    H5D_mpio_actual_io_mode_t
-             mpio_actual_io_mode; /* Actual I/O mode used for parallel I/O (H5D_MPIO_ACTUAL_IO_MODE_NAME) */
-    bool     mpio_actual_io_mode_set;        /* Whether actual I/O mode used for parallel I/O is set */
-    uint32_t mpio_local_no_coll_cause;       /* Local reason for breaking collective I/O
-                                                (H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME) */
-    bool     mpio_local_no_coll_cause_set;   /* Whether local reason for breaking collective I/O is set */
-    bool     mpio_local_no_coll_cause_valid; /* Whether local reason for breaking collective I/O is valid */
-    uint32_t mpio_global_no_coll_cause;      /* Global reason for breaking collective I/O
-                                                (H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME) */
-    bool mpio_global_no_coll_cause_set;      /* Whether global reason for breaking collective I/O is set */
-    bool mpio_global_no_coll_cause_valid;    /* Whether global reason for breaking collective I/O is valid */
+    bool mpio_actual_chunk_opt_set;       /* Whether chunk optimization mode used for parallel I/O is set */
+    bool mpio_actual_io_mode_set;         /* Whether actual I/O mode used for parallel I/O is set */
+    bool mpio_local_no_coll_cause_set;    /* Whether local reason for breaking collective I/O is set */
+    bool mpio_local_no_coll_cause_valid;  /* Whether local reason for breaking collective I/O is valid */
+    bool mpio_global_no_coll_cause_set;   /* Whether global reason for breaking collective I/O is set */
+    bool mpio_global_no_coll_cause_valid; /* Whether global reason for breaking collective I/O is valid */
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
-    int mpio_coll_chunk_link_hard;       /* Instrumented "collective chunk link hard" value
-                                            (H5D_XFER_COLL_CHUNK_LINK_HARD_NAME) */
     bool mpio_coll_chunk_link_hard_set;  /* Whether instrumented "collective chunk link hard" value is set */
-    int  mpio_coll_chunk_multi_hard;     /* Instrumented "collective chunk multi hard" value
-                                            (H5D_XFER_COLL_CHUNK_MULTI_HARD_NAME) */
     bool mpio_coll_chunk_multi_hard_set; /* Whether instrumented "collective chunk multi hard" value is set */
-    int  mpio_coll_chunk_link_num_true;  /* Instrumented "collective chunk link num true" value
-                                            (H5D_XFER_COLL_CHUNK_LINK_NUM_TRUE_NAME) */
     bool mpio_coll_chunk_link_num_true_set;    /* Whether instrumented "collective chunk link num true" value
                                                      is set */
-    int mpio_coll_chunk_link_num_false;        /* Instrumented "collective chunk link num false" value
-                                                  (H5D_XFER_COLL_CHUNK_LINK_NUM_FALSE_NAME) */
     bool mpio_coll_chunk_link_num_false_set;   /* Whether instrumented "collective chunk link num false"
                                                      value is set */
-    int mpio_coll_chunk_multi_ratio_coll;      /* Instrumented "collective chunk multi ratio coll" value
-                                                  (H5D_XFER_COLL_CHUNK_MULTI_RATIO_COLL_NAME) */
     bool mpio_coll_chunk_multi_ratio_coll_set; /* Whether instrumented "collective chunk multi ratio coll"
                                                      value is set */
-    int mpio_coll_chunk_multi_ratio_ind;       /* Instrumented "collective chunk multi ratio ind" value
-                                                  (H5D_XFER_COLL_CHUNK_MULTI_RATIO_IND_NAME) */
     bool mpio_coll_chunk_multi_ratio_ind_set;  /* Whether instrumented "collective chunk multi ratio ind"
                                                      value is set */
-    bool mpio_coll_rank0_bcast;                /* Instrumented "collective rank 0 broadcast" value
-                                                     (H5D_XFER_COLL_RANK0_BCAST_NAME) */
-    bool mpio_coll_rank0_bcast_set;   /* Whether instrumented "collective rank 0 broadcast" value is set */
-#endif                                /* H5_HAVE_INSTRUMENTED_LIBRARY */
-#endif                                /* H5_HAVE_PARALLEL */
-    uint32_t no_selection_io_cause;   /* Reason for not performing selection I/O
-                                            (H5D_XFER_NO_SELECTION_IO_CAUSE_NAME) */
-    bool no_selection_io_cause_set;   /* Whether reason for not performing selection I/O is set */
-    bool no_selection_io_cause_valid; /* Whether reason for not performing selection I/O is valid */
-
-    uint32_t actual_selection_io_mode;   /* Actual selection I/O mode used
-                                            (H5D_XFER_ACTUAL_SELECTION_IO_MODE_NAME) */
+    bool mpio_coll_rank0_bcast_set;      /* Whether instrumented "collective rank 0 broadcast" value is set */
+#endif                                   /* H5_HAVE_INSTRUMENTED_LIBRARY */
+#endif                                   /* H5_HAVE_PARALLEL */
+    bool no_selection_io_cause_set;      /* Whether reason for not performing selection I/O is set */
+    bool no_selection_io_cause_valid;    /* Whether reason for not performing selection I/O is valid */
     bool actual_selection_io_mode_set;   /* Whether actual selection I/O mode is set */
     bool actual_selection_io_mode_valid; /* Whether actual selection I/O mode is valid */
 
+    /* Flags for cached LCPL properties */
+    bool encoding_valid;           /* Whether link name character encoding is valid */
+    bool intermediate_group_valid; /* Whether create intermediate group flag is valid */
+
+    /* Flags for cached LAPL properties */
+    bool nlinks_valid; /* Whether number of soft / UD links to traverse is valid */
+
+    /* Flags for cached DCPL properties */
+    bool do_min_dset_ohdr_valid; /* Whether minimize dataset object header flag is valid */
+    bool ohdr_flags_valid;       /* Whether the object headers flags are valid */
+
+    /* Flags for cached DAPL properties */
+    bool extfile_prefix_valid; /* Whether the prefix for external file is valid */
+    bool vds_prefix_valid;     /* Whether the prefix for VDS is valid           */
+
+    /* Flags for cached FAPL properties */
+    bool low_bound_valid;  /* Whether low_bound property is valid */
+    bool high_bound_valid; /* Whether high_bound property is valid */
+
+    /* Flags for cached VOL settings */
+    bool vol_connector_prop_valid; /* Whether property for VOL connector ID & info is valid */
+    bool vol_wrap_ctx_valid;       /* Whether VOL connector's "wrap context" for creating IDs is valid */
+
+    /* Cached DXPL properties */
+    size_t    max_temp_buf;         /* Maximum temporary buffer size (H5D_XFER_MAX_TEMP_BUF_NAME) .*/
+    void     *tconv_buf;            /* Temporary conversion buffer (H5D_XFER_TCONV_BUF_NAME) */
+    void     *bkgr_buf;             /* Background conversion buffer (H5D_XFER_BKGR_BUF_NAME) */
+    H5T_bkg_t bkgr_buf_type;        /* Background buffer type (H5D_XFER_BKGR_BUF_TYPE_NAME) */
+    double    btree_split_ratio[3]; /* B-tree split ratios (H5D_XFER_BTREE_SPLIT_RATIO_NAME) */
+    size_t    vec_size;             /* Size of hyperslab vector (H5D_XFER_HYPER_VECTOR_SIZE_NAME) */
+#ifdef H5_HAVE_PARALLEL
+    H5FD_mpio_xfer_t io_xfer_mode; /* Parallel transfer mode for this request (H5D_XFER_IO_XFER_MODE_NAME) */
+    H5FD_mpio_collective_opt_t mpio_coll_opt; /* Parallel transfer with independent IO or collective IO with
+                                                 this mode (H5D_XFER_MPIO_COLLECTIVE_OPT_NAME) */
+    H5FD_mpio_chunk_opt_t
+             mpio_chunk_opt_mode;  /* Collective chunk option (H5D_XFER_MPIO_CHUNK_OPT_HARD_NAME) */
+    unsigned mpio_chunk_opt_num;   /* Collective chunk threshold (H5D_XFER_MPIO_CHUNK_OPT_NUM_NAME) */
+    unsigned mpio_chunk_opt_ratio; /* Collective chunk ratio (H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME) */
+#endif                             /* H5_HAVE_PARALLEL */
+    H5Z_EDC_t               err_detect;        /* Error detection info (H5D_XFER_EDC_NAME) */
+    H5Z_cb_t                filter_cb;         /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
+    H5Z_data_xform_t       *data_transform;    /* Data transform info (H5D_XFER_XFORM_NAME) */
+    H5T_vlen_alloc_info_t   vl_alloc_info;     /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
+    H5T_conv_cb_t           dt_conv_cb;        /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
+    H5D_selection_io_mode_t selection_io_mode; /* Selection I/O mode (H5D_XFER_SELECTION_IO_MODE_NAME) */
+    bool modify_write_buf; /* Whether the library can modify write buffers (H5D_XFER_MODIFY_WRITE_BUF_NAME)*/
+    unsigned dset_io_threads; /* Threads for dataset I/O (H5D_XFER_DSET_IO_THREADS_NAME) */
+
+    /* Return-only DXPL properties to return to application */
+#ifdef H5_HAVE_PARALLEL
+    H5D_mpio_actual_chunk_opt_mode_t mpio_actual_chunk_opt; /* Chunk optimization mode used for parallel I/O
+                                                               (H5D_MPIO_ACTUAL_CHUNK_OPT_MODE_NAME) */
+    H5D_mpio_actual_io_mode_t
+             mpio_actual_io_mode;       /* Actual I/O mode used for parallel I/O
+                                           (H5D_MPIO_ACTUAL_IO_MODE_NAME) */
+    uint32_t mpio_local_no_coll_cause;  /* Local reason for breaking collective I/O
+                                           (H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME) */
+    uint32_t mpio_global_no_coll_cause; /* Global reason for breaking collective I/O
+                                           (H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME) */
+#ifdef H5_HAVE_INSTRUMENTED_LIBRARY
+    int  mpio_coll_chunk_link_hard;        /* Instrumented "collective chunk link hard" value
+                                              (H5D_XFER_COLL_CHUNK_LINK_HARD_NAME) */
+    int  mpio_coll_chunk_multi_hard;       /* Instrumented "collective chunk multi hard" value
+                                              (H5D_XFER_COLL_CHUNK_MULTI_HARD_NAME) */
+    int  mpio_coll_chunk_link_num_true;    /* Instrumented "collective chunk link num true" value
+                                              (H5D_XFER_COLL_CHUNK_LINK_NUM_TRUE_NAME) */
+    int  mpio_coll_chunk_link_num_false;   /* Instrumented "collective chunk link num false" value
+                                              (H5D_XFER_COLL_CHUNK_LINK_NUM_FALSE_NAME) */
+    int  mpio_coll_chunk_multi_ratio_coll; /* Instrumented "collective chunk multi ratio coll" value
+                                              (H5D_XFER_COLL_CHUNK_MULTI_RATIO_COLL_NAME) */
+    int  mpio_coll_chunk_multi_ratio_ind;  /* Instrumented "collective chunk multi ratio ind" value
+                                              (H5D_XFER_COLL_CHUNK_MULTI_RATIO_IND_NAME) */
+    bool mpio_coll_rank0_bcast;            /* Instrumented "collective rank 0 broadcast" value
+                                              (H5D_XFER_COLL_RANK0_BCAST_NAME) */
+#endif                                     /* H5_HAVE_INSTRUMENTED_LIBRARY */
+#endif                                     /* H5_HAVE_PARALLEL */
+    uint32_t no_selection_io_cause;        /* Reason for not performing selection I/O
+                                              (H5D_XFER_NO_SELECTION_IO_CAUSE_NAME) */
+    uint32_t actual_selection_io_mode;     /* Actual selection I/O mode used
+                                              (H5D_XFER_ACTUAL_SELECTION_IO_MODE_NAME) */
+
     /* Cached LCPL properties */
     H5T_cset_t encoding;         /* Link name character encoding (H5P_STRCRT_CHAR_ENCODING_NAME) */
-    bool       encoding_valid;   /* Whether link name character encoding is valid */
     unsigned intermediate_group; /* Whether to create intermediate groups (H5L_CRT_INTERMEDIATE_GROUP_NAME) */
-    bool     intermediate_group_valid; /* Whether create intermediate group flag is valid */
 
     /* Cached LAPL properties */
-    size_t nlinks;       /* Number of soft / UD links to traverse (H5L_ACS_NLINKS_NAME) */
-    bool   nlinks_valid; /* Whether number of soft / UD links to traverse is valid */
+    size_t nlinks; /* Number of soft / UD links to traverse (H5L_ACS_NLINKS_NAME) */
 
     /* Cached DCPL properties */
     bool    do_min_dset_ohdr; /* Whether to minimize dataset object header (H5D_CRT_MIN_DSET_HDR_SIZE_NAME) */
-    bool    do_min_dset_ohdr_valid; /* Whether minimize dataset object header flag is valid */
-    uint8_t ohdr_flags;             /* Object header flags (H5O_CRT_OHDR_FLAGS_NAME) */
-    bool    ohdr_flags_valid;       /* Whether the object headers flags are valid */
+    uint8_t ohdr_flags;       /* Object header flags (H5O_CRT_OHDR_FLAGS_NAME) */
 
     /* Cached DAPL properties */
-    const char *extfile_prefix;       /* Prefix for external file (H5D_ACS_EFILE_PREFIX_NAME) */
-    bool        extfile_prefix_valid; /* Whether the prefix for external file is valid */
-    const char *vds_prefix;           /* Prefix for VDS (H5D_ACS_VDS_PREFIX_NAME) */
-    bool        vds_prefix_valid;     /* Whether the prefix for VDS is valid           */
+    const char *extfile_prefix; /* Prefix for external file (H5D_ACS_EFILE_PREFIX_NAME) */
+    const char *vds_prefix;     /* Prefix for VDS (H5D_ACS_VDS_PREFIX_NAME) */
 
     /* Cached FAPL properties */
-    H5F_libver_t low_bound;       /* low_bound property for H5Pset_libver_bounds()
-                                     (H5F_ACS_LIBVER_LOW_BOUND_NAME) */
-    bool         low_bound_valid; /* Whether low_bound property is valid */
-    H5F_libver_t high_bound;      /* high_bound property for H5Pset_libver_bounds
-                                     (H5F_ACS_LIBVER_HIGH_BOUND_NAME) */
-    bool high_bound_valid;        /* Whether high_bound property is valid */
+    H5F_libver_t low_bound;  /* low_bound property for H5Pset_libver_bounds()
+                                (H5F_ACS_LIBVER_LOW_BOUND_NAME) */
+    H5F_libver_t high_bound; /* high_bound property for H5Pset_libver_bounds
+                                (H5F_ACS_LIBVER_HIGH_BOUND_NAME) */
 
     /* Cached VOL settings */
     H5VL_connector_prop_t vol_connector_prop; /* Property for VOL connector ID & info
                                This is treated as an independent field with
                                no relation to the property H5F_ACS_VOL_CONN_NAME stored on the FAPL */
-    bool  vol_connector_prop_valid;           /* Whether property for VOL connector ID & info is valid */
     void *vol_wrap_ctx;                       /* VOL connector's "wrap context" for creating IDs */
-    bool  vol_wrap_ctx_valid; /* Whether VOL connector's "wrap context" for creating IDs is valid */
 } H5CX_t;
 
 /* Typedef for nodes on the API context stack */
-/* Each entry into the library through an API routine invokes H5CX_push()
- * in a FUNC_ENTER_API* macro, which pushes an H5CX_node_t on the API
- * context [thread-local] stack, after initializing it with default values.
+/* Each entry into the library through an API routine invokes H5CX_push_api()
+ * in a FUNC_ENTER_API* macro, which pushes an H5CX_node_t from the thread's
+ * pool on the API context [thread-local] stack, after initializing it with
+ * default values.
  */
 typedef struct H5CX_node_t {
     H5CX_t              ctx;  /* Context for current API call */
     struct H5CX_node_t *next; /* Pointer to previous context, on stack */
 } H5CX_node_t;
 
+/* Number of nodes in each thread's pool, enough for API calls made from callbacks a few levels deep */
+#define H5CX_NODE_POOL_SIZE 4
+
+/* Typedef for a thread's API context stack */
+/* (The nodes in the pool are used in order, from the first, as API calls nest) */
+typedef struct H5CX_stack_t {
+    H5CX_node_t              *head;    /* Top of the stack (must be the first field) */
+    unsigned                  npooled; /* # of nodes from the pool on the stack */
+    struct H5CX_extra_node_t *extra;   /* Last node allocated when the pool was empty */
+    H5CX_node_t               pool[H5CX_NODE_POOL_SIZE]; /* Pool of nodes for API calls */
+} H5CX_stack_t;
+
 /*****************************/
 /* Library-private Variables */
 /*****************************/
@@ -289,6 +332,7 @@ typedef struct H5CX_node_t {
 
 /* Library private routines */
 H5_DLL herr_t H5CX_push(H5CX_node_t *cnode);
+H5_DLL herr_t H5CX_push_api(void);
 H5_DLL herr_t H5CX_pop(bool update_dxpl_props);
 H5_DLL bool   H5CX_pushed(void);
 H5_DLL bool   H5CX_is_def_dxpl(void);
@@ -348,6 +392,7 @@ H5_DLL herr_t H5CX_get_selection_io_mode(H5D_selection_io_mode_t *selection_io_m
 H5_DLL herr_t H5CX_get_no_selection_io_cause(uint32_t *no_selection_io_cause);
 H5_DLL herr_t H5CX_get_actual_selection_io_mode(uint32_t *actual_selection_io_mode);
 H5_DLL herr_t H5CX_get_modify_write_buf(bool *modify_write_buf);
+H5_DLL herr_t H5CX_get_dset_io_threads(unsigned *dset_io_threads);
 
 /* "Getter" routines for LCPL properties cached in API context */
 H5_DLL herr_t H5CX_get_encoding(H5T_cset_t *encoding);
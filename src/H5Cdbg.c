@@ -75,6 +75,7 @@ H5C_dump_cache(H5C_t *cache_ptr, const char *cache_name)
 {
     H5C_cache_entry_t *entry_ptr;
     H5SL_t            *slist_ptr = NULL;
+    size_t             u;                   /* Local index variable */
     int                i;                   /* Local index variable */
     herr_t             ret_value = SUCCEED; /* Return value */
 
@@ -92,8 +93,8 @@ H5C_dump_cache(H5C_t *cache_ptr, const char *cache_name)
      * Do this, as we want to display cache entries in increasing address
      * order.
      */
-    for (i = 0; i < H5C__HASH_TABLE_LEN; i++) {
-        entry_ptr = cache_ptr->index[i];
+    for (u = 0; u < cache_ptr->index_buckets; u++) {
+        entry_ptr = cache_ptr->index[u];
 
         while (entry_ptr != NULL) {
             if (H5SL_insert(slist_ptr, entry_ptr, &(entry_ptr->addr)) < 0)
@@ -64,6 +64,9 @@ static herr_t H5C__unpin_entry_real(H5C_t *cache_ptr, H5C_cache_entry_t *entry_p
 static herr_t H5C__unpin_entry_from_client(H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr, bool update_rp);
 static herr_t H5C__generate_image(H5F_t *f, H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr);
 static herr_t H5C__verify_len_eoa(H5F_t *f, const H5C_class_t *type, haddr_t addr, size_t *len, bool actual);
+static herr_t H5C__check_read_ahead_chksums(H5C_t *cache_ptr);
+static bool   H5C__use_read_ahead(H5C_t *cache_ptr, const H5C_class_t *type, haddr_t addr, size_t len,
+                                  uint8_t *image, bool *chksum_ok);
 static void  *H5C__load_entry(H5F_t *f,
 #ifdef H5_HAVE_PARALLEL
                              bool coll_access,
@@ -594,7 +597,9 @@ H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr, unsigned flags)
                 else
                     mem_type = entry_ptr->type->mem_type;
 
-                if (H5F_block_write(f, mem_type, entry_ptr->addr, entry_ptr->size, entry_ptr->image_ptr) < 0)
+                /* Write the image, or add it to the current write batch */
+                if (H5C__add_to_write_batch(f, cache_ptr, mem_type, entry_ptr->addr, entry_ptr->size,
+                                            entry_ptr->image_ptr) < 0)
                     HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't write image to file");
 #ifdef H5_HAVE_PARALLEL
             }
@@ -978,11 +983,12 @@ H5C__load_entry(H5F_t *f,
     H5C_cache_entry_t *entry = NULL;  /* Alias for thing loaded, as cache entry   */
     size_t             len;           /* Size of image in file                    */
 #ifdef H5_HAVE_PARALLEL
-    int      mpi_rank = 0;             /* MPI process rank                         */
-    MPI_Comm comm     = MPI_COMM_NULL; /* File MPI Communicator                    */
-    int      mpi_code;                 /* MPI error code                           */
-#endif                                 /* H5_HAVE_PARALLEL */
-    void *ret_value = NULL;            /* Return value                             */
+    int      mpi_rank     = 0;             /* MPI process rank                         */
+    MPI_Comm comm         = MPI_COMM_NULL; /* File MPI Communicator                    */
+    int      mpi_code;                     /* MPI error code                           */
+    bool     pb_coll_read = false;         /* Whether the page buffer broadcasts image */
+#endif                                     /* H5_HAVE_PARALLEL */
+    void *ret_value = NULL;                /* Return value                             */
 
     FUNC_ENTER_PACKAGE
 
@@ -1030,6 +1036,11 @@ H5C__load_entry(H5F_t *f,
     }  /* end if */
 #endif /* H5_HAVE_PARALLEL */
 
+    /* Write out any batched entry writes, so the image read is current */
+    if (f->shared->cache->num_batch_writes > 0)
+        if (H5C__write_batch(f, f->shared->cache) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, NULL, "can't write batched entries");
+
     /* Get the on-disk entry image */
     if (0 == (type->flags & H5C__CLASS_SKIP_READS)) {
         unsigned tries, max_tries;   /* The # of read attempts               */
@@ -1039,6 +1050,7 @@ H5C__load_entry(H5F_t *f,
         uint64_t nanosec    = 1;     /* # of nanoseconds to sleep between retries */
         void    *new_image;          /* Pointer to image                     */
         bool     len_changed = true; /* Whether to re-check speculative entries */
+        bool     chksum_ok   = false; /* Whether the checksum of an image read ahead matched */
 
         /* Get the # of read attempts */
         max_tries = tries = H5F_GET_READ_ATTEMPTS(f);
@@ -1061,9 +1073,23 @@ H5C__load_entry(H5F_t *f,
             } /* end if */
 
 #ifdef H5_HAVE_PARALLEL
-            if (!coll_access || 0 == mpi_rank) {
+            /* With a page buffer, process 0 loads and broadcasts the whole
+             * page, which all processes keep for later reads
+             */
+            pb_coll_read = coll_access && H5PB_coll_read_enabled(f->shared, type->mem_type, addr, len);
+            if (pb_coll_read) {
+                if (H5PB_coll_read(f->shared, type->mem_type, addr, len, image) < 0) {
+                    memset(image, 0, len);
+                    HDONE_ERROR(H5E_CACHE, H5E_READERROR, NULL, "Can't read image*");
+                }
+            }
+            else if (!coll_access || 0 == mpi_rank) {
 #endif /* H5_HAVE_PARALLEL */
-                if (H5F_block_read(f, type->mem_type, addr, len, image) < 0) {
+                /* Use the image if it was read ahead, on the first attempt only */
+                bool read_ahead = tries == max_tries && f->shared->cache->num_read_ahead_left > 0 &&
+                                  H5C__use_read_ahead(f->shared->cache, type, addr, len, image, &chksum_ok);
+
+                if (!read_ahead && H5F_block_read(f, type->mem_type, addr, len, image) < 0) {
 #ifdef H5_HAVE_PARALLEL
                     if (coll_access) {
                         /* Push an error, but still participate in following MPI_Bcast */
@@ -1081,7 +1107,7 @@ H5C__load_entry(H5F_t *f,
              * bcast the metadata read from process 0 to all ranks in the file
              * communicator
              */
-            if (coll_access) {
+            if (coll_access && !pb_coll_read) {
                 int buf_size;
 
                 H5_CHECKED_ASSIGN(buf_size, int, len, size_t);
@@ -1115,7 +1141,16 @@ H5C__load_entry(H5F_t *f,
 
                     if (actual_len > len) {
 #ifdef H5_HAVE_PARALLEL
-                        if (!coll_access || 0 == mpi_rank) {
+                        pb_coll_read = coll_access && H5PB_coll_read_enabled(f->shared, type->mem_type,
+                                                                             addr + len, actual_len - len);
+                        if (pb_coll_read) {
+                            if (H5PB_coll_read(f->shared, type->mem_type, addr + len, actual_len - len,
+                                               image + len) < 0) {
+                                memset(image + len, 0, actual_len - len);
+                                HDONE_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "can't read image");
+                            }
+                        }
+                        else if (!coll_access || 0 == mpi_rank) {
 #endif /* H5_HAVE_PARALLEL */
                             /* If the thing's image needs to be bigger for a speculatively
                              * loaded thing, go get the on-disk image again (the extra portion).
@@ -1138,7 +1173,7 @@ H5C__load_entry(H5F_t *f,
                         /* If the collective metadata read optimization is turned on,
                          * Bcast the metadata read from process 0 to all ranks in the file
                          * communicator */
-                        if (coll_access) {
+                        if (coll_access && !pb_coll_read) {
                             int buf_size;
 
                             H5_CHECKED_ASSIGN(buf_size, int, actual_len - len, size_t);
@@ -1164,6 +1199,10 @@ H5C__load_entry(H5F_t *f,
             if (type->verify_chksum == NULL)
                 break;
 
+            /* The checksum of an image read ahead may be known to match */
+            if (chksum_ok)
+                break;
+
             /* Verify the checksum for the metadata image */
             if ((chk_ret = type->verify_chksum(image, actual_len, udata)) < 0)
                 HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, NULL, "failure from verify_chksum callback");
@@ -1287,6 +1326,8 @@ H5C__load_entry(H5F_t *f,
     entry->tl_prev  = NULL;
     entry->tag_info = NULL;
 
+    entry->ws_epoch = 0;
+
     H5C__RESET_CACHE_ENTRY_STATS(entry);
 
     ret_value = thing;
@@ -1939,6 +1980,8 @@ H5C__deserialize_prefetched_entry(H5F_t *f, H5C_t *cache_ptr, H5C_cache_entry_t
     ds_entry_ptr->serialization_count = 0;
 #endif
 
+    ds_entry_ptr->ws_epoch = pf_entry_ptr->ws_epoch;
+
     H5C__RESET_CACHE_ENTRY_STATS(ds_entry_ptr);
 
     /* Apply to to the newly deserialized entry */
@@ -2220,6 +2263,8 @@ H5C_insert_entry(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *thing, u
     entry_ptr->tl_prev  = NULL;
     entry_ptr->tag_info = NULL;
 
+    entry_ptr->ws_epoch = 0;
+
     /* Apply tag to newly inserted entry */
     if (H5C__tag_entry(cache_ptr, entry_ptr) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTTAG, FAIL, "Cannot tag metadata entry");
@@ -2924,6 +2969,273 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_pin_protected_entry() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5C_read_ahead
+ *
+ * Purpose:     Read the images of COUNT entries of class TYPE, at the
+ *              addresses and of the sizes given, with a single vector
+ *              read.  Each image is held until the entry is loaded with
+ *              H5C_protect(), which uses it instead of reading the entry
+ *              from the file.
+ *
+ *              Entries already in the cache, and entries past the end of
+ *              the allocated space, are skipped.  Nothing is read unless
+ *              the file is opened read-only, since the vector read
+ *              bypasses the metadata accumulator and the page buffer,
+ *              and nothing is read in the parallel case.  Any images
+ *              read ahead earlier and not yet used are discarded.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_read_ahead(H5F_t *f, const H5C_class_t *type, size_t count, const haddr_t addrs[], const size_t lens[])
+{
+    H5C_t       *cache_ptr;
+    H5FD_mem_t  *types    = NULL;     /* Memory types of the vector read */
+    haddr_t     *io_addrs = NULL;     /* Addresses of the vector read */
+    size_t      *io_sizes = NULL;     /* Sizes of the vector read */
+    void       **io_bufs  = NULL;     /* Buffers of the vector read */
+    haddr_t      eoa;                 /* End of the allocated space */
+    size_t       nreads = 0;          /* # of images to read */
+    size_t       u;                   /* Local index variable */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    assert(f);
+    assert(f->shared);
+    cache_ptr = f->shared->cache;
+    assert(cache_ptr);
+    assert(type);
+    assert(0 == (type->flags & (H5C__CLASS_SPECULATIVE_LOAD_FLAG | H5C__CLASS_SKIP_READS)));
+    assert(addrs || 0 == count);
+    assert(lens || 0 == count);
+
+    /* Discard images from an earlier read-ahead */
+    if (H5C_discard_read_ahead(cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't discard read-ahead images");
+
+    /* Check whether images can be read ahead for this file */
+    if (count < 2 || 0 != (H5F_INTENT(f) & H5F_ACC_RDWR))
+        HGOTO_DONE(SUCCEED);
+#ifdef H5_HAVE_PARALLEL
+    if (NULL != cache_ptr->aux_ptr)
+        HGOTO_DONE(SUCCEED);
+#endif /* H5_HAVE_PARALLEL */
+
+    if (HADDR_UNDEF == (eoa = H5F_get_eoa(f, type->mem_type)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't get EOA");
+
+    /* Set up the images to read */
+    if (NULL == (cache_ptr->read_ahead = (H5C_read_ahead_t *)H5MM_calloc(count * sizeof(H5C_read_ahead_t))))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for read-ahead images");
+    for (u = 0; u < count; u++) {
+        H5C_cache_entry_t *entry_ptr;
+
+        assert(H5_addr_defined(addrs[u]));
+        assert(lens[u] > 0);
+
+        H5C__SEARCH_INDEX(cache_ptr, addrs[u], entry_ptr, FAIL);
+        if (entry_ptr != NULL || H5_addr_gt(addrs[u] + lens[u], eoa))
+            continue;
+
+        if (NULL == (cache_ptr->read_ahead[nreads].image = (uint8_t *)H5MM_malloc(lens[u])))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for read-ahead image");
+        cache_ptr->read_ahead[nreads].addr = addrs[u];
+        cache_ptr->read_ahead[nreads].len  = lens[u];
+        cache_ptr->read_ahead[nreads].type = type;
+        nreads++;
+        cache_ptr->num_read_ahead      = nreads;
+        cache_ptr->num_read_ahead_left = nreads;
+    } /* end for */
+
+    /* Nothing to gain from a vector read of fewer than two images */
+    if (nreads < 2) {
+        if (H5C_discard_read_ahead(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't discard read-ahead images");
+        HGOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Set up the vector read */
+    if (NULL == (types = (H5FD_mem_t *)H5MM_malloc(nreads * sizeof(H5FD_mem_t))) ||
+        NULL == (io_addrs = (haddr_t *)H5MM_malloc(nreads * sizeof(haddr_t))) ||
+        NULL == (io_sizes = (size_t *)H5MM_malloc(nreads * sizeof(size_t))) ||
+        NULL == (io_bufs = (void **)H5MM_malloc(nreads * sizeof(void *))))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for vector read");
+    for (u = 0; u < nreads; u++) {
+        types[u]    = type->mem_type;
+        io_addrs[u] = cache_ptr->read_ahead[u].addr;
+        io_sizes[u] = cache_ptr->read_ahead[u].len;
+        io_bufs[u]  = cache_ptr->read_ahead[u].image;
+    } /* end for */
+
+    /* Write out any batched entry writes, so the images read are current */
+    if (cache_ptr->num_batch_writes > 0)
+        if (H5C__write_batch(f, cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write batched entries");
+
+    /* Read the images */
+    if (H5F_shared_vector_read(f->shared, (uint32_t)nreads, types, io_addrs, io_sizes, io_bufs) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "can't read entry images");
+
+    /* Check the images' checksums together, when the class allows it */
+    if (type->flags & H5C__CLASS_TRAILING_CHKSUM_FLAG)
+        if (H5C__check_read_ahead_chksums(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't check checksums of entry images");
+
+done:
+    if (ret_value < 0)
+        if (H5C_discard_read_ahead(cache_ptr) < 0)
+            HDONE_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't discard read-ahead images");
+
+    H5MM_xfree(types);
+    H5MM_xfree(io_addrs);
+    H5MM_xfree(io_sizes);
+    H5MM_xfree(io_bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_read_ahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_discard_read_ahead
+ *
+ * Purpose:     Free the images read ahead with H5C_read_ahead() that
+ *              have not been used.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_discard_read_ahead(H5C_t *cache_ptr)
+{
+    size_t u; /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOERR
+
+    /* Sanity check */
+    assert(cache_ptr);
+
+    if (cache_ptr->read_ahead) {
+        for (u = 0; u < cache_ptr->num_read_ahead; u++)
+            H5MM_xfree(cache_ptr->read_ahead[u].image);
+        cache_ptr->read_ahead = (H5C_read_ahead_t *)H5MM_xfree(cache_ptr->read_ahead);
+    } /* end if */
+    cache_ptr->num_read_ahead      = 0;
+    cache_ptr->num_read_ahead_left = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C_discard_read_ahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__check_read_ahead_chksums
+ *
+ * Purpose:     Compute the metadata checksums of the images read ahead,
+ *              all at once, and flag the images that end with the
+ *              checksum of the rest of the image.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__check_read_ahead_chksums(H5C_t *cache_ptr)
+{
+    const void **bufs      = NULL;    /* Images to checksum */
+    size_t      *lens      = NULL;    /* Lengths of the images, without their checksums */
+    uint32_t    *chksums   = NULL;    /* Computed checksums */
+    size_t       u;                   /* Local index variable */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(cache_ptr);
+    assert(cache_ptr->read_ahead);
+
+    if (NULL == (bufs = (const void **)H5MM_malloc(cache_ptr->num_read_ahead * sizeof(void *))) ||
+        NULL == (lens = (size_t *)H5MM_malloc(cache_ptr->num_read_ahead * sizeof(size_t))) ||
+        NULL == (chksums = (uint32_t *)H5MM_malloc(cache_ptr->num_read_ahead * sizeof(uint32_t))))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for checksums");
+
+    /* Images too small to hold a checksum are left to the class's callback */
+    for (u = 0; u < cache_ptr->num_read_ahead; u++) {
+        assert(cache_ptr->read_ahead[u].image);
+
+        bufs[u] = cache_ptr->read_ahead[u].image;
+        lens[u] = MAX(cache_ptr->read_ahead[u].len, H5F_SIZEOF_CHKSUM + 1) - H5F_SIZEOF_CHKSUM;
+    } /* end for */
+
+    H5_checksum_metadata_multi(cache_ptr->num_read_ahead, bufs, lens, 0, chksums);
+
+    for (u = 0; u < cache_ptr->num_read_ahead; u++) {
+        H5C_read_ahead_t *read_ahead = &cache_ptr->read_ahead[u];
+
+        if (read_ahead->len > H5F_SIZEOF_CHKSUM) {
+            const uint8_t *p = read_ahead->image + lens[u]; /* Pointer to stored checksum */
+            uint32_t       stored_chksum;                   /* Stored checksum */
+
+            UINT32DECODE(p, stored_chksum);
+            read_ahead->chksum_ok = (stored_chksum == chksums[u]);
+        } /* end if */
+    }     /* end for */
+
+done:
+    H5MM_xfree(bufs);
+    H5MM_xfree(lens);
+    H5MM_xfree(chksums);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__check_read_ahead_chksums() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__use_read_ahead
+ *
+ * Purpose:     Look for an image of the entry of class TYPE at ADDR, of
+ *              size LEN, that was read ahead.  If there is one, copy it
+ *              to IMAGE, free it, and return true.  *CHKSUM_OK is set
+ *              when the image's trailing checksum is known to match.
+ *
+ * Return:      true if IMAGE was filled in, false otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static bool
+H5C__use_read_ahead(H5C_t *cache_ptr, const H5C_class_t *type, haddr_t addr, size_t len, uint8_t *image,
+                    bool *chksum_ok)
+{
+    size_t u;                 /* Local index variable */
+    bool   ret_value = false; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    assert(cache_ptr);
+    assert(image);
+    assert(chksum_ok);
+
+    for (u = 0; u < cache_ptr->num_read_ahead; u++) {
+        H5C_read_ahead_t *read_ahead = &cache_ptr->read_ahead[u];
+
+        if (read_ahead->image && H5_addr_eq(read_ahead->addr, addr)) {
+            if (read_ahead->type == type && read_ahead->len == len) {
+                H5MM_memcpy(image, read_ahead->image, len);
+                *chksum_ok = read_ahead->chksum_ok;
+                ret_value  = true;
+            } /* end if */
+
+            read_ahead->image = (uint8_t *)H5MM_xfree(read_ahead->image);
+            cache_ptr->num_read_ahead_left--;
+            break;
+        } /* end if */
+    }     /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__use_read_ahead() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5C_protect
  *
@@ -2959,6 +3271,8 @@ H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsign
     bool               write_permitted = false;
     bool               was_loaded      = false; /* Whether the entry was loaded as a result of the protect */
     size_t             empty_space;
+    uint64_t           load_start;
+    uint64_t           load_time;
     void              *thing;
     H5C_cache_entry_t *entry_ptr;
     void              *ret_value = NULL; /* Return value */
@@ -3001,6 +3315,11 @@ H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsign
     /* first check to see if the target is in cache */
     H5C__SEARCH_INDEX(cache_ptr, addr, entry_ptr, NULL);
 
+    /* If not, it may still be in the cache image */
+    if (entry_ptr == NULL && cache_ptr->lazy_image_entries_left > 0)
+        if (H5C__load_lazy_image_entry(f, cache_ptr, addr, &entry_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "can't load entry from cache image");
+
     if (entry_ptr != NULL) {
         if (entry_ptr->ring != ring)
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, NULL, "ring type mismatch occurred for cache entry");
@@ -3098,17 +3417,30 @@ H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsign
     }
     else {
         /* must try to load the entry from disk. */
-        hit = false;
+        hit        = false;
+        load_start = H5_now_usec();
         if (NULL == (thing = H5C__load_entry(f,
 #ifdef H5_HAVE_PARALLEL
                                              coll_access,
 #endif /* H5_HAVE_PARALLEL */
                                              type, addr, udata)))
             HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "can't load entry");
+        load_time = H5_now_usec() - load_start;
 
         entry_ptr = (H5C_cache_entry_t *)thing;
         cache_ptr->entries_loaded_counter++;
 
+        /* Update the miss statistics for the entry's type */
+        cache_ptr->type_misses[type->id]++;
+        cache_ptr->type_load_time[type->id] += load_time;
+
+        /* Check whether a larger cache would have kept the entry */
+        if (cache_ptr->resize_ctl.incr_mode == H5C_incr__working_set) {
+            cache_ptr->ws_epoch_load_time += load_time;
+            if (H5C__ws_record_load(cache_ptr, addr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "can't record entry load");
+        } /* end if */
+
         entry_ptr->ring = ring;
 #ifdef H5_HAVE_PARALLEL
         if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI) && entry_ptr->coll_access)
@@ -3246,6 +3578,13 @@ H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsign
     H5C__UPDATE_CACHE_HIT_RATE_STATS(cache_ptr, hit);
     H5C__UPDATE_STATS_FOR_PROTECT(cache_ptr, entry_ptr, hit);
 
+    /* Count the entry in the size of the entries used in this epoch */
+    if ((cache_ptr->resize_ctl.incr_mode == H5C_incr__working_set) &&
+        (entry_ptr->ws_epoch != cache_ptr->ws_epoch)) {
+        entry_ptr->ws_epoch = cache_ptr->ws_epoch;
+        cache_ptr->ws_epoch_size += entry_ptr->size;
+    } /* end if */
+
     ret_value = thing;
 
     if (cache_ptr->evictions_enabled &&
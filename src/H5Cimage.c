@@ -41,6 +41,8 @@
 #include "H5FDprivate.h" /* File drivers				*/
 #include "H5FLprivate.h" /* Free Lists                           */
 #include "H5MMprivate.h" /* Memory management			*/
+#include "H5Oprivate.h"  /* Object headers			*/
+#include "H5Zprivate.h"  /* Data filters				*/
 
 /****************/
 /* Local Macros */
@@ -56,6 +58,7 @@
 #define H5C__MDCI_BLOCK_SIGNATURE     "MDCI"
 #define H5C__MDCI_BLOCK_SIGNATURE_LEN 4
 #define H5C__MDCI_BLOCK_VERSION_0     0
+#define H5C__MDCI_BLOCK_VERSION_1     1 /* Entries section compressed with the deflate filter */
 
 /* Metadata cache image header flags -- max 8 bits */
 #define H5C__MDCI_HEADER_HAVE_RESIZE_STATUS 0x01
@@ -117,7 +120,7 @@
 static size_t H5C__cache_image_block_entry_header_size(const H5F_t *f);
 static size_t H5C__cache_image_block_header_size(const H5F_t *f);
 static herr_t H5C__decode_cache_image_header(const H5F_t *f, H5C_t *cache_ptr, const uint8_t **buf,
-                                             size_t buf_size);
+                                             size_t buf_size, size_t *entries_len);
 #ifndef NDEBUG /* only used in assertions */
 static herr_t H5C__decode_cache_image_entry(const H5F_t *f, const H5C_t *cache_ptr, const uint8_t **buf,
                                             unsigned entry_num);
@@ -130,6 +133,10 @@ static void   H5C__prep_for_file_close__compute_fd_heights_real(H5C_cache_entry_
 static herr_t H5C__prep_for_file_close__setup_image_entries_array(H5C_t *cache_ptr);
 static herr_t H5C__prep_for_file_close__scan_entries(const H5F_t *f, H5C_t *cache_ptr);
 static herr_t H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr);
+static herr_t H5C__compress_cache_image(const H5F_t *f, H5C_t *cache_ptr);
+static herr_t H5C__decompress_cache_image(const uint8_t *buf, size_t buf_len, size_t entries_len,
+                                          void **entries_buf);
+static int    H5C__lazy_image_entry_cmp(const void *_entry1, const void *_entry2);
 static H5C_cache_entry_t *H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr, const uint8_t **buf);
 static herr_t             H5C__write_cache_image_superblock_msg(H5F_t *f, bool create);
 static herr_t             H5C__read_cache_image(H5F_t *f, H5C_t *cache_ptr);
@@ -228,7 +235,9 @@ H5C_cache_image_status(H5F_t *f, bool *load_ci_ptr, bool *write_ci_ptr)
  *		load it with an image of the metadata cache image block.
  *
  *		Note that by the time this function is called, the cache
- *		should have removed all entries from its data structures.
+ *		should have removed all entries from its data structures,
+ *		unless the image is to be compressed, in which case it is
+ *		called when the file is prepared for close.
  *
  * Return:      SUCCEED on success, and FAIL on failure.
  *
@@ -252,7 +261,7 @@ H5C__construct_cache_image_buffer(H5F_t *f, H5C_t *cache_ptr)
     assert(cache_ptr->close_warning_received);
     assert(cache_ptr->image_ctl.generate_image);
     assert(cache_ptr->num_entries_in_image > 0);
-    assert(cache_ptr->index_len == 0);
+    assert(cache_ptr->index_len == 0 || cache_ptr->image_ctl.compression_level > 0);
     assert(cache_ptr->image_data_len > 0);
     assert(cache_ptr->image_data_len <= cache_ptr->image_len);
 
@@ -298,7 +307,7 @@ H5C__construct_cache_image_buffer(H5F_t *f, H5C_t *cache_ptr)
         /* needed for sanity checks */
         fake_cache_ptr->image_len = cache_ptr->image_len;
         q                         = (const uint8_t *)cache_ptr->image_buffer;
-        status = H5C__decode_cache_image_header(f, fake_cache_ptr, &q, cache_ptr->image_len + 1);
+        status = H5C__decode_cache_image_header(f, fake_cache_ptr, &q, cache_ptr->image_len + 1, NULL);
         assert(status >= 0);
 
         assert(NULL != p);
@@ -376,6 +385,188 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__construct_cache_image_buffer() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5C__compress_cache_image()
+ *
+ * Purpose:     Compress the entries section of the version 0 cache image
+ *		block in cache_ptr->image_buffer with the deflate filter,
+ *		and replace the image with the resulting version 1 block.
+ *
+ *		A version 1 block has the same header as a version 0 block,
+ *		followed by the length of the uncompressed entries section,
+ *		the compressed entries section, and the checksum.
+ *
+ *		The version 0 image is kept if the deflate filter fails, or
+ *		if it doesn't make the image smaller.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__compress_cache_image(const H5F_t *f, H5C_t *cache_ptr)
+{
+    H5O_pline_t pline;                       /* Deflate filter pipeline */
+    bool        pline_init  = false;         /* Whether the pipeline needs to be reset */
+    H5Z_cb_t    filter_cb   = {NULL, NULL};  /* Filter failure callback struct */
+    unsigned    filter_mask = 0;             /* Filters skipped */
+    unsigned    cd_values[1];                /* Deflate level */
+    size_t      header_len;                  /* Length of the version 0 header */
+    size_t      entries_len;                 /* Length of the uncompressed entries section */
+    size_t      nbytes;                      /* Length of the compressed entries section */
+    size_t      buf_size;                    /* Size of the filter buffer */
+    size_t      image_len;                   /* Length of the version 1 image */
+    void       *zbuf      = NULL;            /* Filter buffer */
+    uint8_t    *image     = NULL;            /* Version 1 image */
+    uint8_t    *p;                           /* Pointer into version 1 image */
+    uint32_t    chksum;                      /* Checksum of version 1 image */
+    herr_t      ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(f);
+    assert(cache_ptr);
+    assert(cache_ptr->image_buffer);
+    assert(cache_ptr->image_ctl.compression_level > 0);
+    assert(cache_ptr->image_len == cache_ptr->image_data_len);
+
+    header_len = H5C__cache_image_block_header_size(f);
+    assert(cache_ptr->image_data_len > header_len + H5F_SIZEOF_CHKSUM);
+    entries_len = (size_t)cache_ptr->image_data_len - header_len - H5F_SIZEOF_CHKSUM;
+
+    /* Copy the entries section into a buffer for the filter to replace */
+    if (NULL == (zbuf = H5MM_malloc(entries_len)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for compression buffer");
+    H5MM_memcpy(zbuf, (uint8_t *)cache_ptr->image_buffer + header_len, entries_len);
+    nbytes   = entries_len;
+    buf_size = entries_len;
+
+    /* Set up and run the pipeline */
+    memset(&pline, 0, sizeof(pline));
+    pline_init   = true;
+    cd_values[0] = cache_ptr->image_ctl.compression_level;
+    if (H5Z_append(&pline, H5Z_FILTER_DEFLATE, H5Z_FLAG_OPTIONAL, (size_t)1, cd_values) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTINIT, FAIL, "unable to add deflate filter to pipeline");
+    if (H5Z_pipeline(&pline, 0, &filter_mask, H5Z_NO_EDC, filter_cb, &nbytes, &buf_size, &zbuf) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFILTER, FAIL, "output pipeline failed");
+
+    /* Keep the version 0 image if it can't be made smaller */
+    image_len = header_len + H5F_SIZEOF_SIZE(f) + nbytes + H5F_SIZEOF_CHKSUM;
+    if (filter_mask != 0 || image_len >= cache_ptr->image_data_len)
+        HGOTO_DONE(SUCCEED);
+
+    if (NULL == (image = (uint8_t *)H5MM_malloc(image_len + 1)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image buffer");
+
+    /* Encode the header: signature, version, and the flags of the version 0 header... */
+    p = image;
+    H5MM_memcpy(p, cache_ptr->image_buffer, (size_t)H5C__MDCI_BLOCK_SIGNATURE_LEN + 2);
+    p[H5C__MDCI_BLOCK_SIGNATURE_LEN] = (uint8_t)H5C__MDCI_BLOCK_VERSION_1;
+    p += H5C__MDCI_BLOCK_SIGNATURE_LEN + 2;
+
+    /* ...the new image data length, the number of entries... */
+    H5F_ENCODE_LENGTH(f, p, image_len);
+    UINT32ENCODE(p, cache_ptr->num_entries_in_image);
+    assert((size_t)(p - image) == header_len);
+
+    /* ...and the length of the uncompressed entries section */
+    H5F_ENCODE_LENGTH(f, p, entries_len);
+
+    /* Copy the compressed entries section */
+    H5MM_memcpy(p, zbuf, nbytes);
+    p += nbytes;
+
+    /* Compute the checksum and encode */
+    chksum = H5_checksum_metadata(image, image_len - H5F_SIZEOF_CHKSUM, 0);
+    UINT32ENCODE(p, chksum);
+    assert((size_t)(p - image) == image_len);
+
+    /* Replace the version 0 image */
+    H5MM_xfree(cache_ptr->image_buffer);
+    cache_ptr->image_buffer   = image;
+    cache_ptr->image_data_len = image_len;
+    cache_ptr->image_len      = image_len;
+    image                     = NULL;
+
+done:
+    if (pline_init)
+        H5O_msg_reset(H5O_PLINE_ID, &pline);
+    H5MM_xfree(zbuf);
+    H5MM_xfree(image);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__compress_cache_image() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__decompress_cache_image()
+ *
+ * Purpose:     Decompress the buf_len byte entries section of a version 1
+ *		cache image block at buf, which must expand to entries_len
+ *		bytes.  Return the uncompressed entries section in a newly
+ *		allocated buffer in *entries_buf.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__decompress_cache_image(const uint8_t *buf, size_t buf_len, size_t entries_len, void **entries_buf)
+{
+    H5O_pline_t pline;                       /* Deflate filter pipeline */
+    bool        pline_init  = false;         /* Whether the pipeline needs to be reset */
+    H5Z_cb_t    filter_cb   = {NULL, NULL};  /* Filter failure callback struct */
+    unsigned    filter_mask = 0;             /* Filters skipped */
+    unsigned    cd_values[1];                /* Deflate level (unused when decompressing) */
+    size_t      nbytes;                      /* Length of data in the filter buffer */
+    size_t      buf_size;                    /* Size of the filter buffer */
+    void       *zbuf      = NULL;            /* Filter buffer */
+    herr_t      ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(buf);
+    assert(entries_buf);
+
+    if (buf_len == 0 || entries_len == 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad compressed metadata cache image length");
+
+    /* The image can't be decompressed without the deflate filter */
+    if (H5Z_filter_avail(H5Z_FILTER_DEFLATE) <= 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_NOTFOUND, FAIL,
+                    "deflate filter needed to decompress metadata cache image not available");
+
+    /* Copy the compressed entries section into a buffer for the filter to replace */
+    if (NULL == (zbuf = H5MM_malloc(buf_len)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for decompression buffer");
+    H5MM_memcpy(zbuf, buf, buf_len);
+    nbytes   = buf_len;
+    buf_size = buf_len;
+
+    /* Set up and run the pipeline in reverse */
+    memset(&pline, 0, sizeof(pline));
+    pline_init   = true;
+    cd_values[0] = 0;
+    if (H5Z_append(&pline, H5Z_FILTER_DEFLATE, H5Z_FLAG_MANDATORY, (size_t)1, cd_values) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTINIT, FAIL, "unable to add deflate filter to pipeline");
+    if (H5Z_pipeline(&pline, H5Z_FLAG_REVERSE, &filter_mask, H5Z_NO_EDC, filter_cb, &nbytes, &buf_size,
+                     &zbuf) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFILTER, FAIL, "input pipeline failed");
+    if (nbytes != entries_len)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADSIZE, FAIL, "Bad uncompressed metadata cache image length");
+
+    *entries_buf = zbuf;
+    zbuf         = NULL;
+
+done:
+    if (pline_init)
+        H5O_msg_reset(H5O_PLINE_ID, &pline);
+    H5MM_xfree(zbuf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__decompress_cache_image() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5C__generate_cache_image()
  *
@@ -399,9 +590,12 @@ H5C__generate_cache_image(H5F_t *f, H5C_t *cache_ptr)
     assert(cache_ptr == f->shared->cache);
     assert(cache_ptr);
 
-    /* Construct cache image */
-    if (H5C__construct_cache_image_buffer(f, cache_ptr) < 0)
-        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't create metadata cache image");
+    /* Construct cache image, unless it was constructed (and compressed)
+     * when the file was prepared for close
+     */
+    if (NULL == cache_ptr->image_buffer)
+        if (H5C__construct_cache_image_buffer(f, cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't create metadata cache image");
 
     /* Free image entries array */
     if (H5C__free_image_entries_array(cache_ptr) < 0)
@@ -759,6 +953,159 @@ H5C__image_entry_cmp(const void *_entry1, const void *_entry2)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__image_entry_cmp() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5C__lazy_image_entry_cmp
+ *
+ * Purpose:     Comparison callback for qsort(3) and bsearch(3) on lazily
+ *		reconstructed image entries, which are sorted by address.
+ *
+ * Return:      An integer less than, equal to, or greater than zero if the
+ *		first entry is considered to be respectively less than,
+ *		equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5C__lazy_image_entry_cmp(const void *_entry1, const void *_entry2)
+{
+    const H5C_lazy_image_entry_t *entry1 =
+        (const H5C_lazy_image_entry_t *)_entry1; /* Pointer to first entry to compare */
+    const H5C_lazy_image_entry_t *entry2 =
+        (const H5C_lazy_image_entry_t *)_entry2; /* Pointer to second entry to compare */
+    int ret_value = 0;                           /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    assert(entry1);
+    assert(entry2);
+
+    if (H5_addr_lt(entry1->addr, entry2->addr))
+        ret_value = -1;
+    else if (H5_addr_gt(entry1->addr, entry2->addr))
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__lazy_image_entry_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__load_lazy_image_entry
+ *
+ * Purpose:     If the cache image holds a not yet reconstructed entry at
+ *		the supplied address, reconstruct it as a prefetched entry,
+ *		and insert it in the cache.  Return a pointer to the entry
+ *		in *entry_ptr_ptr, or NULL if there is no such entry.
+ *
+ *		When the last such entry has been reconstructed, the image
+ *		buffer holding the entries is freed.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__load_lazy_image_entry(H5F_t *f, H5C_t *cache_ptr, haddr_t addr, H5C_cache_entry_t **entry_ptr_ptr)
+{
+    H5C_lazy_image_entry_t  key;                 /* Search key */
+    H5C_lazy_image_entry_t *lazy_entry;          /* Entry found */
+    H5C_cache_entry_t      *pf_entry_ptr = NULL; /* Reconstructed entry */
+    const uint8_t          *p;                   /* Pointer into image buffer */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(f);
+    assert(cache_ptr);
+    assert(cache_ptr->lazy_image_entries);
+    assert(cache_ptr->lazy_image_entries_left > 0);
+    assert(entry_ptr_ptr);
+
+    *entry_ptr_ptr = NULL;
+
+    /* Look up the address */
+    key.addr  = addr;
+    key.image = NULL;
+    lazy_entry =
+        (H5C_lazy_image_entry_t *)bsearch(&key, cache_ptr->lazy_image_entries,
+                                          (size_t)cache_ptr->num_lazy_image_entries,
+                                          sizeof(H5C_lazy_image_entry_t), H5C__lazy_image_entry_cmp);
+    if (NULL == lazy_entry || NULL == lazy_entry->image)
+        HGOTO_DONE(SUCCEED);
+
+    /* Reconstruct the prefetched entry, and mark its image as used */
+    p = lazy_entry->image;
+    if (NULL == (pf_entry_ptr = H5C__reconstruct_cache_entry(f, cache_ptr, &p)))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "reconstruction of cache entry failed");
+    assert(pf_entry_ptr->addr == addr);
+    assert(!pf_entry_ptr->is_dirty);
+    assert(pf_entry_ptr->fd_parent_count == 0 && pf_entry_ptr->fd_child_count == 0);
+    lazy_entry->image = NULL;
+    cache_ptr->lazy_image_entries_left--;
+
+    /* Make room for the entry, as when loading it from the file */
+    if (cache_ptr->evictions_enabled &&
+        (cache_ptr->index_size + pf_entry_ptr->size) > cache_ptr->max_cache_size) {
+        bool write_permitted = false;
+
+        if (cache_ptr->check_write_permitted && (cache_ptr->check_write_permitted)(f, &write_permitted) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTPROTECT, FAIL, "Can't get write_permitted");
+        else
+            write_permitted = cache_ptr->write_permitted;
+
+        if (H5C__make_space_in_cache(f, pf_entry_ptr->size, write_permitted) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTPROTECT, FAIL, "H5C__make_space_in_cache failed");
+    } /* end if */
+
+    /* Insert the prefetched entry in the index and the LRU */
+    H5C__INSERT_IN_INDEX(cache_ptr, pf_entry_ptr, FAIL);
+    H5C__UPDATE_RP_FOR_INSERTION(cache_ptr, pf_entry_ptr, FAIL);
+    H5C__UPDATE_STATS_FOR_PREFETCH(cache_ptr, false);
+
+    *entry_ptr_ptr = pf_entry_ptr;
+    pf_entry_ptr   = NULL;
+
+    /* Free the image once all of its entries have been reconstructed */
+    if (0 == cache_ptr->lazy_image_entries_left)
+        if (H5C__free_lazy_image_entries(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't free lazy image entries");
+
+done:
+    if (pf_entry_ptr) {
+        pf_entry_ptr->image_ptr       = H5MM_xfree(pf_entry_ptr->image_ptr);
+        pf_entry_ptr->fd_parent_addrs = (haddr_t *)H5MM_xfree(pf_entry_ptr->fd_parent_addrs);
+        pf_entry_ptr                  = H5FL_FREE(H5C_cache_entry_t, pf_entry_ptr);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__load_lazy_image_entry() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__free_lazy_image_entries
+ *
+ * Purpose:     Discard the cache image entries that haven't been
+ *		reconstructed yet, along with the buffer holding them.
+ *
+ * Return:      SUCCEED
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__free_lazy_image_entries(H5C_t *cache_ptr)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    assert(cache_ptr);
+
+    cache_ptr->lazy_image_entries      = (H5C_lazy_image_entry_t *)H5MM_xfree(cache_ptr->lazy_image_entries);
+    cache_ptr->lazy_image_buffer       = H5MM_xfree(cache_ptr->lazy_image_buffer);
+    cache_ptr->num_lazy_image_entries  = 0;
+    cache_ptr->lazy_image_entries_left = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__free_lazy_image_entries() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5C__prep_image_for_file_close
  *
@@ -897,6 +1244,33 @@ H5C__prep_image_for_file_close(H5F_t *f, bool *image_generated)
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C__prep_for_file_close__scan_entries failed");
         assert(HADDR_UNDEF == cache_ptr->image_addr);
 
+        /* If the image is to be compressed, construct and compress it now,
+         * so that only the space for the compressed image is allocated
+         * below.  Otherwise, the image is constructed when the cache is
+         * destroyed.
+         */
+        if (cache_ptr->image_ctl.compression_level > 0 && NULL == cache_ptr->aux_ptr &&
+            cache_ptr->num_entries_in_image > 0) {
+            htri_t deflate_avail;
+
+            if ((deflate_avail = H5Z_filter_avail(H5Z_FILTER_DEFLATE)) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't check deflate filter availability");
+            if (deflate_avail) {
+                if (H5C__prep_for_file_close__setup_image_entries_array(cache_ptr) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTINIT, FAIL, "can't setup image entries array.");
+
+                /* Sort the entries */
+                qsort(cache_ptr->image_entries, (size_t)cache_ptr->num_entries_in_image,
+                      sizeof(H5C_image_entry_t), H5C__image_entry_cmp);
+
+                cache_ptr->image_len = cache_ptr->image_data_len;
+                if (H5C__construct_cache_image_buffer(f, cache_ptr) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, FAIL, "Can't create metadata cache image");
+                if (H5C__compress_cache_image(f, cache_ptr) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTFILTER, FAIL, "Can't compress metadata cache image");
+            } /* end if */
+        }     /* end if */
+
 #ifdef H5_HAVE_PARALLEL
         /* In the parallel case, overwrite the image_len with the
          * value computed by process 0.
@@ -1029,13 +1403,16 @@ H5C__prep_image_for_file_close(H5F_t *f, bool *image_generated)
          * unnecessary generation of the metadata cache image.
          */
         if (cache_ptr->num_entries_in_image > 0) {
-            if (H5C__prep_for_file_close__setup_image_entries_array(cache_ptr) < 0)
-                HGOTO_ERROR(H5E_CACHE, H5E_CANTINIT, FAIL, "can't setup image entries array.");
-
-            /* Sort the entries */
-            qsort(cache_ptr->image_entries, (size_t)cache_ptr->num_entries_in_image,
-                  sizeof(H5C_image_entry_t), H5C__image_entry_cmp);
-        }      /* end if */
+            /* (Unless this was done above, to compress the image) */
+            if (NULL == cache_ptr->image_entries) {
+                if (H5C__prep_for_file_close__setup_image_entries_array(cache_ptr) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTINIT, FAIL, "can't setup image entries array.");
+
+                /* Sort the entries */
+                qsort(cache_ptr->image_entries, (size_t)cache_ptr->num_entries_in_image,
+                      sizeof(H5C_image_entry_t), H5C__image_entry_cmp);
+            } /* end if */
+        }     /* end if */
         else { /* cancel creation of metadata cache image */
             assert(cache_ptr->image_entries == NULL);
 
@@ -1186,6 +1563,9 @@ H5C_validate_cache_image_config(H5C_cache_image_ctl_t *ctl_ptr)
     if ((ctl_ptr->flags & ~H5C_CI__ALL_FLAGS) != 0)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "unknown flag set");
 
+    if (ctl_ptr->compression_level > 9)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "invalid compression level");
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_validate_cache_image_config() */
@@ -1263,12 +1643,17 @@ H5C__cache_image_block_header_size(const H5F_t *f)
  *		of H5C_t.  Advances the buffer pointer to the first byte
  *		after the header image, or unchanged on failure.
  *
+ *		If entries_len is not NULL, *entries_len is set to the
+ *		uncompressed length of the entries section if the image is
+ *		compressed, and to zero if it isn't.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5C__decode_cache_image_header(const H5F_t *f, H5C_t *cache_ptr, const uint8_t **buf, size_t buf_size)
+H5C__decode_cache_image_header(const H5F_t *f, H5C_t *cache_ptr, const uint8_t **buf, size_t buf_size,
+                               size_t *entries_len)
 {
     uint8_t        version;
     uint8_t        flags;
@@ -1299,7 +1684,7 @@ H5C__decode_cache_image_header(const H5F_t *f, H5C_t *cache_ptr, const uint8_t *
 
     /* Check version */
     version = *p++;
-    if (version != (uint8_t)H5C__MDCI_BLOCK_VERSION_0)
+    if (version != (uint8_t)H5C__MDCI_BLOCK_VERSION_0 && version != (uint8_t)H5C__MDCI_BLOCK_VERSION_1)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache image version");
 
     /* Decode flags */
@@ -1327,6 +1712,21 @@ H5C__decode_cache_image_header(const H5F_t *f, H5C_t *cache_ptr, const uint8_t *
     if (actual_header_len != expected_header_len)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad header image len");
 
+    /* Read the uncompressed length of the entries section of a compressed image */
+    if (version == (uint8_t)H5C__MDCI_BLOCK_VERSION_1) {
+        size_t uncompressed_len = 0;
+
+        if (H5_IS_BUFFER_OVERFLOW(p, H5F_SIZEOF_SIZE(f), *buf + buf_size - 1))
+            HGOTO_ERROR(H5E_CACHE, H5E_OVERFLOW, FAIL, "Insufficient buffer size for entries length");
+        H5F_DECODE_LENGTH(f, p, uncompressed_len);
+        if (uncompressed_len == 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache image entries length");
+        if (entries_len)
+            *entries_len = uncompressed_len;
+    } /* end if */
+    else if (entries_len)
+        *entries_len = 0;
+
     /* Update buffer pointer */
     *buf = p;
 
@@ -1521,7 +1921,7 @@ H5C__encode_cache_image_header(const H5F_t *f, const H5C_t *cache_ptr, uint8_t *
     assert(cache_ptr);
     assert(cache_ptr->close_warning_received);
     assert(cache_ptr->image_ctl.generate_image);
-    assert(cache_ptr->index_len == 0);
+    assert(cache_ptr->index_len == 0 || cache_ptr->image_ctl.compression_level > 0);
     assert(cache_ptr->image_data_len > 0);
     assert(cache_ptr->image_data_len <= cache_ptr->image_len);
     assert(buf);
@@ -1596,7 +1996,7 @@ H5C__encode_cache_image_entry(H5F_t *f, H5C_t *cache_ptr, uint8_t **buf, unsigne
     assert(cache_ptr);
     assert(cache_ptr->close_warning_received);
     assert(cache_ptr->image_ctl.generate_image);
-    assert(cache_ptr->index_len == 0);
+    assert(cache_ptr->index_len == 0 || cache_ptr->image_ctl.compression_level > 0);
     assert(buf);
     assert(*buf);
     assert(entry_num < cache_ptr->num_entries_in_image);
@@ -2376,6 +2776,10 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
     H5C_cache_entry_t *pf_entry_ptr;        /* Pointer to prefetched entry */
     H5C_cache_entry_t *parent_ptr;          /* Pointer to parent of prefetched entry */
     const uint8_t     *p;                   /* Pointer into image buffer */
+    const uint8_t     *p_end;               /* Pointer to end of entries section */
+    void              *entries_buf = NULL;  /* Uncompressed entries section */
+    size_t             entries_len = 0;     /* Length of uncompressed entries section */
+    bool               lazy;                /* Whether to reconstruct entries lazily */
     unsigned           u, v;                /* Local index variable */
     herr_t             ret_value = SUCCEED; /* Return value */
 
@@ -2388,10 +2792,11 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
     assert(cache_ptr);
     assert(cache_ptr->image_buffer);
     assert(cache_ptr->image_len > 0);
+    assert(NULL == cache_ptr->lazy_image_entries);
 
     /* Decode metadata cache image header */
     p = (uint8_t *)cache_ptr->image_buffer;
-    if (H5C__decode_cache_image_header(f, cache_ptr, &p, cache_ptr->image_len + 1) < 0)
+    if (H5C__decode_cache_image_header(f, cache_ptr, &p, cache_ptr->image_len + 1, &entries_len) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "cache image header decode failed");
     assert((size_t)(p - (uint8_t *)cache_ptr->image_buffer) < cache_ptr->image_len);
 
@@ -2400,8 +2805,89 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
     assert(cache_ptr->image_data_len <= cache_ptr->image_len);
     assert(cache_ptr->num_entries_in_image > 0);
 
+    /* The end of the entries section is followed by the checksum */
+    p_end = (uint8_t *)cache_ptr->image_buffer + cache_ptr->image_data_len - H5F_SIZEOF_CHKSUM;
+    if (p >= p_end)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADSIZE, FAIL, "Bad metadata cache image data length");
+
+    /* Verify the image's checksum, which covers all the entries in it, before
+     * decoding any of them
+     */
+    {
+        uint32_t stored_chksum;   /* Stored metadata checksum value */
+        uint32_t computed_chksum; /* Computed metadata checksum value */
+
+        if (H5F_get_checksums((const uint8_t *)cache_ptr->image_buffer, (size_t)cache_ptr->image_data_len,
+                              &stored_chksum, &computed_chksum) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't get metadata cache image checksums");
+        if (stored_chksum != computed_chksum)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "incorrect metadata cache image checksum");
+    } /* end block */
+
+    /* If the entries section is compressed, decompress it */
+    if (entries_len > 0) {
+        if (H5C__decompress_cache_image(p, (size_t)(p_end - p), entries_len, &entries_buf) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFILTER, FAIL, "can't decompress metadata cache image");
+        p     = (const uint8_t *)entries_buf;
+        p_end = p + entries_len;
+    } /* end if */
+
+    /* When the image will not be deleted, its entries don't have to be
+     * reconstructed until they are protected, and can be left in the image
+     * buffer until then.  Entries that take part in flush dependencies are
+     * always reconstructed now, so that the dependencies can be restored.
+     *
+     * This isn't done when the file is opened R/W (since the space for the
+     * image is freed, and its addresses may be reallocated), under SWMR
+     * read, or in the parallel case.
+     */
+    lazy = !cache_ptr->delete_image && NULL == cache_ptr->aux_ptr && !(H5F_INTENT(f) & H5F_ACC_SWMR_READ);
+    if (lazy) {
+        if (NULL == (cache_ptr->lazy_image_entries = (H5C_lazy_image_entry_t *)H5MM_malloc(
+                         sizeof(H5C_lazy_image_entry_t) * (size_t)cache_ptr->num_entries_in_image)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for lazy image entries");
+        cache_ptr->num_lazy_image_entries = 0;
+    } /* end if */
+
     /* Reconstruct entries in image */
     for (u = 0; u < cache_ptr->num_entries_in_image; u++) {
+        if (lazy) {
+            const uint8_t *q;            /* Pointer into entry image header */
+            size_t         header_len;   /* Length of entry image header */
+            size_t         entry_len;    /* Length of entry image */
+            uint16_t       parent_count; /* # of flush dependency parents */
+            haddr_t        addr;         /* Entry address */
+            hsize_t        size = 0;     /* Entry size */
+            uint8_t        flags;        /* Entry flags */
+
+            /* Peek at the entry's flags, parent count, address and size */
+            header_len = H5C__cache_image_block_entry_header_size(f);
+            if (H5_IS_BUFFER_OVERFLOW(p, header_len, p_end - 1))
+                HGOTO_ERROR(H5E_CACHE, H5E_OVERFLOW, FAIL, "Insufficient buffer size for entry header");
+            flags = p[1];
+            q     = p + 8;
+            UINT16DECODE(q, parent_count);
+            q += 4;
+            H5F_addr_decode(f, &q, &addr);
+            H5F_DECODE_LENGTH(f, q, size);
+            if (!H5_addr_defined(addr))
+                HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "invalid entry offset");
+            if (size == 0 || size >= H5C_MAX_ENTRY_SIZE)
+                HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "invalid entry size");
+            entry_len = header_len + (size_t)parent_count * H5F_SIZEOF_ADDR(f) + (size_t)size;
+            if (H5_IS_BUFFER_OVERFLOW(p, entry_len, p_end - 1))
+                HGOTO_ERROR(H5E_CACHE, H5E_OVERFLOW, FAIL, "Insufficient buffer size for entry image");
+
+            /* Leave the entry in the image buffer for now */
+            if (!(flags & (H5C__MDCI_ENTRY_IS_FD_PARENT_FLAG | H5C__MDCI_ENTRY_IS_FD_CHILD_FLAG))) {
+                cache_ptr->lazy_image_entries[cache_ptr->num_lazy_image_entries].addr  = addr;
+                cache_ptr->lazy_image_entries[cache_ptr->num_lazy_image_entries].image = p;
+                cache_ptr->num_lazy_image_entries++;
+                p += entry_len;
+                continue;
+            } /* end if */
+        }     /* end if */
+
         /* Create the prefetched entry described by the ith
          * entry in cache_ptr->image_entrise.
          */
@@ -2462,6 +2948,26 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
         } /* end for */
     }     /* end for */
 
+    /* Set up the lazily reconstructed entries for lookup by address, and
+     * take ownership of the buffer holding their images
+     */
+    if (cache_ptr->num_lazy_image_entries > 0) {
+        qsort(cache_ptr->lazy_image_entries, (size_t)cache_ptr->num_lazy_image_entries,
+              sizeof(H5C_lazy_image_entry_t), H5C__lazy_image_entry_cmp);
+        cache_ptr->lazy_image_entries_left = cache_ptr->num_lazy_image_entries;
+
+        if (entries_buf) {
+            cache_ptr->lazy_image_buffer = entries_buf;
+            entries_buf                  = NULL;
+        } /* end if */
+        else {
+            cache_ptr->lazy_image_buffer = cache_ptr->image_buffer;
+            cache_ptr->image_buffer      = NULL;
+        } /* end else */
+    }     /* end if */
+    else
+        cache_ptr->lazy_image_entries = (H5C_lazy_image_entry_t *)H5MM_xfree(cache_ptr->lazy_image_entries);
+
 #ifndef NDEBUG
     /* Scan the cache entries, and verify that each entry has
      * the expected flush dependency status.
@@ -2520,7 +3026,7 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
          * the following sanity check will have to be revised when
          * we add code to store and restore adaptive resize status.
          */
-        assert(lru_rank_holes <= H5C__MAX_EPOCH_MARKERS);
+        assert(cache_ptr->num_lazy_image_entries > 0 || lru_rank_holes <= H5C__MAX_EPOCH_MARKERS);
     } /* end block */
 #endif
 
@@ -2543,6 +3049,10 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
     } /* end if */
 
 done:
+    H5MM_xfree(entries_buf);
+    if (ret_value < 0)
+        H5C__free_lazy_image_entries(cache_ptr);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__reconstruct_cache_contents() */
 
@@ -33,6 +33,7 @@
 #include "H5Cpkg.h"      /* Cache                        */
 #include "H5Eprivate.h"  /* Error handling               */
 #include "H5Fpkg.h"      /* Files                        */
+#include "H5FLprivate.h" /* Free Lists                   */
 #include "H5MFprivate.h" /* File memory management       */
 #include "H5SLprivate.h" /* Skip Lists                               */
 
@@ -52,8 +53,12 @@ static herr_t H5C__autoadjust__ageout(H5F_t *f, double hit_rate, enum H5C_resize
 static herr_t H5C__autoadjust__ageout__cycle_epoch_marker(H5C_t *cache_ptr);
 static herr_t H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t *f, bool write_permitted);
 static herr_t H5C__autoadjust__ageout__insert_new_marker(H5C_t *cache_ptr);
+static herr_t H5C__autoadjust__working_set(H5C_t *cache_ptr, enum H5C_resize_status *status_ptr,
+                                           size_t *new_max_cache_size_ptr);
+static void   H5C__ws_unlink_ghost(H5C_t *cache_ptr, H5C_ws_ghost_t *ghost);
 static herr_t H5C__flush_invalidate_ring(H5F_t *f, H5C_ring_t ring, unsigned flags);
 static herr_t H5C__serialize_ring(H5F_t *f, H5C_ring_t ring);
+static int    H5C__batch_write_cmp(const void *_write1, const void *_write2);
 
 /*********************/
 /* Package Variables */
@@ -67,6 +72,9 @@ static herr_t H5C__serialize_ring(H5F_t *f, H5C_ring_t ring);
 /* Local Variables */
 /*******************/
 
+/* Declare a free list to manage the H5C_ws_ghost_t struct */
+H5FL_DEFINE_STATIC(H5C_ws_ghost_t);
+
 /*-------------------------------------------------------------------------
  * Function:    H5C__auto_adjust_cache_size
  *
@@ -163,6 +171,11 @@ H5C__auto_adjust_cache_size(H5F_t *f, bool write_permitted)
             }
             break;
 
+        case H5C_incr__working_set:
+            if (H5C__autoadjust__working_set(cache_ptr, &status, &new_max_cache_size) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "working set code failed");
+            break;
+
         default:
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "unknown incr_mode");
     }
@@ -841,6 +854,134 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__autoadjust__ageout__remove_excess_markers() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5C__autoadjust__working_set
+ *
+ * Purpose:     Implement the working set automatic cache size adjustment
+ *              algorithm.  Like the ageout code, this function doesn't
+ *              change the maximum cache size.  It computes the new value
+ *              (if any change is indicated) and reports it in
+ *              *new_max_cache_size_ptr.
+ *
+ *              The hits on ghost entries in the epoch tell how many of the
+ *              epoch's misses a larger cache would have avoided.  If the
+ *              average time per access spent loading entries is above the
+ *              target, the cache grows by the smallest number of histogram
+ *              bins that would have brought it to the target, or by enough
+ *              to cover all the ghost entry hits if the target can't be
+ *              met or there is no target.  If there were no ghost entry
+ *              hits, the cache shrinks to the size of the entries used in
+ *              the epoch, plus the empty reserve if one is applied.
+ *
+ * Return:      Non-negative on success/Negative on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__autoadjust__working_set(H5C_t *cache_ptr, enum H5C_resize_status *status_ptr,
+                             size_t *new_max_cache_size_ptr)
+{
+    int64_t misses;
+    int64_t ghost_hits = 0;
+    int64_t misses_left;
+    double  usec_per_miss = 0.0;
+    double  target_usec;
+    size_t  bin_size;
+    size_t  new_max_cache_size;
+    int     last_bin = -1;
+    int     bins;
+    int     i;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(cache_ptr);
+    assert(cache_ptr->resize_ctl.incr_mode == H5C_incr__working_set);
+    assert(status_ptr);
+    assert(*status_ptr == in_spec);
+    assert(new_max_cache_size_ptr);
+
+    misses = cache_ptr->cache_accesses - cache_ptr->cache_hits;
+    if (misses > 0)
+        usec_per_miss = (double)cache_ptr->ws_epoch_load_time / (double)misses;
+    target_usec = cache_ptr->ws_target_latency * 1.0E6;
+
+    for (i = 0; i < H5C__WS_NUM_BINS; i++)
+        if (cache_ptr->ws_ghost_hits[i] > 0) {
+            ghost_hits += cache_ptr->ws_ghost_hits[i];
+            last_bin = i;
+        } /* end if */
+
+    bin_size = MAX(cache_ptr->resize_ctl.max_size / H5C__WS_NUM_BINS, 1);
+
+    if (ghost_hits > 0 && (target_usec <= 0.0 || ((double)misses * usec_per_miss) >
+                                                     (target_usec * (double)cache_ptr->cache_accesses))) {
+        /* Find the smallest increase that meets the target */
+        bins        = last_bin + 1;
+        misses_left = misses;
+        if (target_usec > 0.0)
+            for (i = 0; i < last_bin; i++) {
+                misses_left -= cache_ptr->ws_ghost_hits[i];
+                if (((double)misses_left * usec_per_miss) <=
+                    (target_usec * (double)cache_ptr->cache_accesses)) {
+                    bins = i + 1;
+                    break;
+                } /* end if */
+            }     /* end for */
+
+        if (!cache_ptr->size_increase_possible)
+            *status_ptr = increase_disabled;
+        else if (cache_ptr->max_cache_size >= cache_ptr->resize_ctl.max_size) {
+            assert(cache_ptr->max_cache_size == cache_ptr->resize_ctl.max_size);
+            *status_ptr = at_max_size;
+        }
+        else {
+            new_max_cache_size = cache_ptr->max_cache_size + ((size_t)bins * bin_size);
+
+            /* clip to max size if necessary */
+            if (new_max_cache_size > cache_ptr->resize_ctl.max_size)
+                new_max_cache_size = cache_ptr->resize_ctl.max_size;
+
+            /* clip to max increment if necessary */
+            if (cache_ptr->resize_ctl.apply_max_increment &&
+                ((cache_ptr->max_cache_size + cache_ptr->resize_ctl.max_increment) < new_max_cache_size))
+                new_max_cache_size = cache_ptr->max_cache_size + cache_ptr->resize_ctl.max_increment;
+
+            *new_max_cache_size_ptr = new_max_cache_size;
+            *status_ptr             = increase;
+        } /* end else */
+    }     /* end if */
+    else if (ghost_hits == 0) {
+        new_max_cache_size = cache_ptr->ws_epoch_size;
+        if (cache_ptr->resize_ctl.apply_empty_reserve)
+            new_max_cache_size =
+                (size_t)((double)new_max_cache_size / (1.0 - cache_ptr->resize_ctl.empty_reserve));
+
+        if (new_max_cache_size < cache_ptr->max_cache_size) {
+            if (!cache_ptr->size_decrease_possible)
+                *status_ptr = decrease_disabled;
+            else if (cache_ptr->max_cache_size <= cache_ptr->resize_ctl.min_size) {
+                assert(cache_ptr->max_cache_size == cache_ptr->resize_ctl.min_size);
+                *status_ptr = at_min_size;
+            }
+            else {
+                /* clip to min size if necessary */
+                if (new_max_cache_size < cache_ptr->resize_ctl.min_size)
+                    new_max_cache_size = cache_ptr->resize_ctl.min_size;
+
+                /* clip to max decrement if necessary */
+                if (cache_ptr->resize_ctl.apply_max_decrement &&
+                    ((cache_ptr->resize_ctl.max_decrement + new_max_cache_size) < cache_ptr->max_cache_size))
+                    new_max_cache_size = cache_ptr->max_cache_size - cache_ptr->resize_ctl.max_decrement;
+
+                *new_max_cache_size_ptr = new_max_cache_size;
+                *status_ptr             = decrease;
+            } /* end else */
+        }     /* end if */
+    }         /* end else-if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__autoadjust__working_set() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5C__flash_increase_cache_size
  *
@@ -1139,6 +1280,7 @@ H5C__flush_invalidate_ring(H5F_t *f, H5C_ring_t ring, unsigned flags)
     int32_t            i;
     uint32_t           cur_ring_pel_len;
     uint32_t           old_ring_pel_len;
+    bool               write_batch = false;
     unsigned           cooked_flags;
     unsigned           evict_flags;
     H5SL_node_t       *node_ptr       = NULL;
@@ -1163,6 +1305,11 @@ H5C__flush_invalidate_ring(H5F_t *f, H5C_ring_t ring, unsigned flags)
 
     assert(cache_ptr->epoch_markers_active == 0);
 
+    /* Collect the writes of the ring's entries into a batch */
+    if (H5C__begin_write_batch(f, cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't begin write batch");
+    write_batch = true;
+
     /* Filter out the flags that are not relevant to the flush/invalidate.
      */
     cooked_flags = flags & H5C__FLUSH_CLEAR_ONLY_FLAG;
@@ -1545,6 +1692,9 @@ H5C__flush_invalidate_ring(H5F_t *f, H5C_ring_t ring, unsigned flags)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't unpin all pinned entries in ring");
 
 done:
+    if (write_batch && H5C__end_write_batch(f, cache_ptr, ret_value >= 0) < 0)
+        HDONE_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't write batched entries");
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__flush_invalidate_ring() */
 
@@ -1577,6 +1727,7 @@ H5C__flush_ring(H5F_t *f, H5C_ring_t ring, unsigned flags)
     bool               ignore_protected;
     bool               tried_to_flush_protected_entry = false;
     bool               restart_slist_scan;
+    bool               write_batch       = false;
     uint32_t           protected_entries = 0;
     H5SL_node_t       *node_ptr          = NULL;
     H5C_cache_entry_t *entry_ptr         = NULL;
@@ -1610,6 +1761,11 @@ H5C__flush_ring(H5F_t *f, H5C_ring_t ring, unsigned flags)
 
     assert(cache_ptr->flush_in_progress);
 
+    /* Collect the writes of the ring's entries into a batch */
+    if (H5C__begin_write_batch(f, cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't begin write batch");
+    write_batch = true;
+
     /* When we are only flushing marked entries, the slist will usually
      * still contain entries when we have flushed everything we should.
      * Thus we track whether we have flushed any entries in the last
@@ -1786,6 +1942,9 @@ H5C__flush_ring(H5F_t *f, H5C_ring_t ring, unsigned flags)
 #endif /* H5C_DO_SANITY_CHECKS */
 
 done:
+    if (write_batch && H5C__end_write_batch(f, cache_ptr, ret_value >= 0) < 0)
+        HDONE_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't write batched entries");
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__flush_ring() */
 
@@ -1829,6 +1988,7 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, bool write_permitted)
     bool               reentrant_call    = false;
     bool               prev_is_dirty     = false;
     bool               didnt_flush_entry = false;
+    bool               write_batch       = false;
     bool               restart_scan;
     H5C_cache_entry_t *entry_ptr;
     H5C_cache_entry_t *prev_ptr;
@@ -1857,6 +2017,11 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, bool write_permitted)
 
     cache_ptr->msic_in_progress = true;
 
+    /* Collect the writes of the entries flushed into a batch */
+    if (H5C__begin_write_batch(f, cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't begin write batch");
+    write_batch = true;
+
     if (write_permitted) {
         restart_scan     = false;
         initial_list_len = cache_ptr->LRU_list_len;
@@ -1924,6 +2089,10 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, bool write_permitted)
                     cache_ptr->entries_scanned_to_make_space++;
 #endif /* H5C_COLLECT_CACHE_STATS */
 
+                    if (cache_ptr->resize_ctl.incr_mode == H5C_incr__working_set)
+                        if (H5C__ws_record_eviction(cache_ptr, entry_ptr) < 0)
+                            HGOTO_ERROR(H5E_CACHE, H5E_CANTINSERT, FAIL, "can't record evicted entry");
+
                     if (H5C__flush_single_entry(f, entry_ptr,
                                                 H5C__FLUSH_INVALIDATE_FLAG |
                                                     H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
@@ -2042,6 +2211,10 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, bool write_permitted)
                 && !entry_ptr->coll_access
 #endif /* H5_HAVE_PARALLEL */
             ) {
+                if (cache_ptr->resize_ctl.incr_mode == H5C_incr__working_set)
+                    if (H5C__ws_record_eviction(cache_ptr, entry_ptr) < 0)
+                        HGOTO_ERROR(H5E_CACHE, H5E_CANTINSERT, FAIL, "can't record evicted entry");
+
                 if (H5C__flush_single_entry(
                         f, entry_ptr, H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
                     HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush entry");
@@ -2060,6 +2233,9 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, bool write_permitted)
     }
 
 done:
+    if (write_batch && H5C__end_write_batch(f, cache_ptr, ret_value >= 0) < 0)
+        HDONE_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't write batched entries");
+
     /* Sanity checks */
     assert(cache_ptr->msic_in_progress);
     if (!reentrant_call)
@@ -2495,3 +2671,603 @@ done:
     assert(cache_ptr->serialization_in_progress);
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__serialize_ring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__begin_write_batch
+ *
+ * Purpose:     Begin collecting the writes of entries in a write batch,
+ *              if writes can be batched for this file.  Calls may be
+ *              nested, and each must be matched by a call to
+ *              H5C__end_write_batch().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__begin_write_batch(H5F_t *f, H5C_t *cache_ptr)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    assert(f);
+    assert(f->shared);
+    assert(cache_ptr);
+
+    /* Writes aren't batched in the parallel case, which collects them
+     * on its own, when they must go through the page buffer, or when
+     * the order in which entries reach the file matters.
+     */
+    if (0 == cache_ptr->write_batch_depth++) {
+        assert(0 == cache_ptr->num_batch_writes);
+        cache_ptr->write_batch_enabled = NULL == cache_ptr->aux_ptr && NULL == f->shared->page_buf &&
+                                         (H5F_INTENT(f) & H5F_ACC_RDWR) &&
+                                         !(H5F_INTENT(f) & H5F_ACC_SWMR_WRITE);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__begin_write_batch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__add_to_write_batch
+ *
+ * Purpose:     Write an entry's image to the file, or, if a write batch
+ *              is being collected, add a copy of it to the batch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__add_to_write_batch(H5F_t *f, H5C_t *cache_ptr, H5FD_mem_t type, haddr_t addr, size_t size,
+                        const void *buf)
+{
+    H5C_batch_write_t *write;               /* New write in the batch */
+    herr_t             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(f);
+    assert(cache_ptr);
+    assert(H5_addr_defined(addr));
+    assert(size > 0);
+    assert(buf);
+
+    /* Write the image now if writes aren't being batched, or if it is
+     * too large to be batched
+     */
+    if (!cache_ptr->write_batch_enabled || size > H5C__WRITE_BATCH_MAX_SIZE) {
+        if (H5F_block_write(f, type, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write image to file");
+        HGOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Check for attempting I/O on 'temporary' file address */
+    if (H5_addr_le(f->shared->tmp_addr, (addr + size)))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space");
+
+    /* Write out the batch if the image doesn't fit */
+    if (cache_ptr->batch_buf_len + size > H5C__WRITE_BATCH_MAX_SIZE)
+        if (H5C__write_batch(f, cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write batched entries");
+
+    /* Make room for the write */
+    if (cache_ptr->num_batch_writes == cache_ptr->batch_writes_alloc) {
+        size_t             new_alloc = MAX(64, 2 * cache_ptr->batch_writes_alloc);
+        H5C_batch_write_t *new_writes;
+
+        if (NULL == (new_writes = (H5C_batch_write_t *)H5MM_realloc(
+                         cache_ptr->batch_writes, new_alloc * sizeof(H5C_batch_write_t))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "can't extend write batch");
+        cache_ptr->batch_writes       = new_writes;
+        cache_ptr->batch_writes_alloc = new_alloc;
+    } /* end if */
+    if (cache_ptr->batch_buf_len + size > cache_ptr->batch_buf_alloc) {
+        size_t   new_alloc = MAX(cache_ptr->batch_buf_len + size, 2 * cache_ptr->batch_buf_alloc);
+        uint8_t *new_buf;
+
+        new_alloc = MIN(new_alloc, H5C__WRITE_BATCH_MAX_SIZE);
+        if (NULL == (new_buf = (uint8_t *)H5MM_realloc(cache_ptr->batch_buf, new_alloc)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "can't extend write batch buffer");
+        cache_ptr->batch_buf       = new_buf;
+        cache_ptr->batch_buf_alloc = new_alloc;
+    } /* end if */
+
+    /* Record the write, and copy the image, since the entry may be
+     * changed or evicted before the batch is written
+     */
+    write         = &cache_ptr->batch_writes[cache_ptr->num_batch_writes++];
+    write->addr   = addr;
+    write->size   = size;
+    write->type   = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
+    write->offset = cache_ptr->batch_buf_len;
+    H5MM_memcpy(cache_ptr->batch_buf + cache_ptr->batch_buf_len, buf, size);
+    cache_ptr->batch_buf_len += size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__add_to_write_batch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__batch_write_cmp
+ *
+ * Purpose:     Comparison callback for qsort(3) on batched writes, which
+ *              sorts them by address, and then in the order in which they
+ *              were made.
+ *
+ * Return:      An integer less than, equal to, or greater than zero if the
+ *              first write is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5C__batch_write_cmp(const void *_write1, const void *_write2)
+{
+    const H5C_batch_write_t *write1 = (const H5C_batch_write_t *)_write1;
+    const H5C_batch_write_t *write2 = (const H5C_batch_write_t *)_write2;
+    int                      ret_value = 0;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (H5_addr_lt(write1->addr, write2->addr))
+        ret_value = -1;
+    else if (H5_addr_gt(write1->addr, write2->addr))
+        ret_value = 1;
+    else if (write1->offset < write2->offset)
+        ret_value = -1;
+    else if (write1->offset > write2->offset)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__batch_write_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__write_batch
+ *
+ * Purpose:     Write out the writes collected in the write batch, sorted
+ *              by address, with a single vector write, and empty the
+ *              batch.  Writes of adjacent entries are combined.
+ *
+ *              When the same entry was written more than once, only its
+ *              last image is written.  Writes past the end of the
+ *              allocated space (to space freed and released after the
+ *              write was made) are dropped.  In the unlikely event that
+ *              the remaining writes overlap (because space was freed and
+ *              reallocated to another entry while the batch was being
+ *              collected), they are written one at a time, in the order
+ *              in which they were made.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__write_batch(H5F_t *f, H5C_t *cache_ptr)
+{
+    H5FD_mem_t  *types      = NULL;    /* Memory types of the vector write */
+    haddr_t     *addrs      = NULL;    /* Addresses of the vector write */
+    size_t      *sizes      = NULL;    /* Sizes of the vector write */
+    const void **bufs       = NULL;    /* Buffers of the vector write */
+    uint8_t     *sorted_buf = NULL;    /* Images in address order */
+    size_t       count      = 0;       /* # of writes remaining */
+    bool         overlap    = false;   /* Whether any writes overlap */
+    size_t       u;                    /* Local index variable */
+    herr_t       ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(f);
+    assert(cache_ptr);
+
+    if (0 == cache_ptr->num_batch_writes)
+        HGOTO_DONE(SUCCEED);
+
+    /* Sort the writes by address, and then in the order they were made */
+    qsort(cache_ptr->batch_writes, cache_ptr->num_batch_writes, sizeof(H5C_batch_write_t),
+          H5C__batch_write_cmp);
+
+    /* Drop superseded writes and writes past the EOA, and check for overlaps */
+    for (u = 0; u < cache_ptr->num_batch_writes; u++) {
+        H5C_batch_write_t *write = &cache_ptr->batch_writes[u];
+        haddr_t            eoa;
+
+        /* Superseded by a later write of the same entry */
+        if (u + 1 < cache_ptr->num_batch_writes && H5_addr_eq(write->addr, write[1].addr) &&
+            write->size == write[1].size)
+            continue;
+
+        if (HADDR_UNDEF == (eoa = H5F_get_eoa(f, write->type)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't get EOA");
+        if (H5_addr_gt(write->addr + write->size, eoa))
+            continue;
+
+        if (count > 0 && H5_addr_gt(cache_ptr->batch_writes[count - 1].addr +
+                                        cache_ptr->batch_writes[count - 1].size,
+                                    write->addr))
+            overlap = true;
+        cache_ptr->batch_writes[count++] = *write;
+    } /* end for */
+
+    if (overlap) {
+        /* Write one at a time, in the order the writes were made */
+        for (u = 0; u < count; u++) {
+            size_t first = u;
+            size_t v;
+
+            for (v = u + 1; v < count; v++)
+                if (cache_ptr->batch_writes[v].offset < cache_ptr->batch_writes[first].offset)
+                    first = v;
+            if (first != u) {
+                H5C_batch_write_t tmp = cache_ptr->batch_writes[u];
+
+                cache_ptr->batch_writes[u]     = cache_ptr->batch_writes[first];
+                cache_ptr->batch_writes[first] = tmp;
+            } /* end if */
+
+            if (H5F_block_write(f, cache_ptr->batch_writes[u].type, cache_ptr->batch_writes[u].addr,
+                                cache_ptr->batch_writes[u].size,
+                                cache_ptr->batch_buf + cache_ptr->batch_writes[u].offset) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write image to file");
+        } /* end for */
+    }     /* end if */
+    else if (count > 0) {
+        bool   merge_types;   /* Whether metadata of different types can share a write */
+        size_t total_len = 0; /* Size of all writes */
+        size_t nelmts    = 0; /* # of vector elements */
+
+        merge_types = H5F_HAS_FEATURE(f, H5FD_FEAT_ACCUMULATE_METADATA);
+
+        for (u = 0; u < count; u++)
+            total_len += cache_ptr->batch_writes[u].size;
+
+        if (NULL == (types = (H5FD_mem_t *)H5MM_malloc(count * sizeof(H5FD_mem_t))) ||
+            NULL == (addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))) ||
+            NULL == (sizes = (size_t *)H5MM_malloc(count * sizeof(size_t))) ||
+            NULL == (bufs = (const void **)H5MM_malloc(count * sizeof(void *))) ||
+            NULL == (sorted_buf = (uint8_t *)H5MM_malloc(total_len)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "can't allocate vector write arrays");
+
+        /* Copy the images into a buffer in address order, and combine
+         * writes of adjacent entries into single vector elements.  Like
+         * the metadata accumulator, metadata of different types is only
+         * combined when the file driver allows it.
+         */
+        for (u = 0, total_len = 0; u < count; u++) {
+            H5C_batch_write_t *write = &cache_ptr->batch_writes[u];
+
+            H5MM_memcpy(sorted_buf + total_len, cache_ptr->batch_buf + write->offset, write->size);
+
+            if (nelmts > 0 && H5_addr_eq(addrs[nelmts - 1] + sizes[nelmts - 1], write->addr) &&
+                (types[nelmts - 1] == write->type ||
+                 (merge_types && H5FD_MEM_DRAW != types[nelmts - 1] && H5FD_MEM_DRAW != write->type))) {
+                if (types[nelmts - 1] != write->type)
+                    types[nelmts - 1] = H5FD_MEM_DEFAULT;
+                sizes[nelmts - 1] += write->size;
+            } /* end if */
+            else {
+                types[nelmts] = write->type;
+                addrs[nelmts] = write->addr;
+                sizes[nelmts] = write->size;
+                bufs[nelmts]  = sorted_buf + total_len;
+                nelmts++;
+            } /* end else */
+
+            total_len += write->size;
+        } /* end for */
+
+        H5_CHECK_OVERFLOW(nelmts, size_t, uint32_t);
+        if (H5F_shared_vector_write(f->shared, (uint32_t)nelmts, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "vector write of batched entries failed");
+    } /* end else-if */
+
+done:
+    /* Empty the batch */
+    cache_ptr->num_batch_writes = 0;
+    cache_ptr->batch_buf_len    = 0;
+
+    H5MM_xfree(types);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(bufs);
+    H5MM_xfree(sorted_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__write_batch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__end_write_batch
+ *
+ * Purpose:     End an operation begun with H5C__begin_write_batch().  When
+ *              the outermost operation ends, write out the batch if
+ *              requested (or discard it, on failure), and release its
+ *              buffers.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__end_write_batch(H5F_t *f, H5C_t *cache_ptr, bool write)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(f);
+    assert(cache_ptr);
+    assert(cache_ptr->write_batch_depth > 0);
+
+    if (0 == --cache_ptr->write_batch_depth) {
+        if (write && H5C__write_batch(f, cache_ptr) < 0)
+            HDONE_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write batched entries");
+
+        cache_ptr->write_batch_enabled = false;
+        cache_ptr->num_batch_writes    = 0;
+        cache_ptr->batch_buf_len       = 0;
+        cache_ptr->batch_writes        = (H5C_batch_write_t *)H5MM_xfree(cache_ptr->batch_writes);
+        cache_ptr->batch_writes_alloc  = 0;
+        cache_ptr->batch_buf           = (uint8_t *)H5MM_xfree(cache_ptr->batch_buf);
+        cache_ptr->batch_buf_alloc     = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__end_write_batch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__resize_index
+ *
+ * Purpose:     Resize the cache's index to the smallest power of two
+ *              number of buckets that is at least twice the number of
+ *              entries in the cache (within the limits on its size), and
+ *              rehash the entries into it.
+ *
+ *              The entries are found on the index list, whose order is
+ *              not changed.  This is also used to allocate the index of
+ *              a new cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__resize_index(H5C_t *cache_ptr)
+{
+    H5C_cache_entry_t **new_index = NULL;    /* New array of buckets */
+    H5C_cache_entry_t  *entry_ptr;           /* Entry being rehashed */
+    size_t              new_buckets;         /* New number of buckets */
+    unsigned            new_bits;            /* log2 of new_buckets */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(cache_ptr);
+    assert(cache_ptr->index_len == cache_ptr->il_len);
+
+    /* Compute the new size */
+    new_buckets = 1;
+    new_bits    = 0;
+    while (new_buckets < H5C__HASH_TABLE_MIN_LEN ||
+           (new_buckets < H5C__HASH_TABLE_MAX_LEN && new_buckets < 2 * (size_t)cache_ptr->index_len)) {
+        new_buckets *= 2;
+        new_bits++;
+    } /* end while */
+
+    if (new_buckets != cache_ptr->index_buckets) {
+        if (NULL ==
+            (new_index = (H5C_cache_entry_t **)H5MM_calloc(new_buckets * sizeof(H5C_cache_entry_t *))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "can't allocate cache index");
+
+        H5MM_xfree(cache_ptr->index);
+        cache_ptr->index         = new_index;
+        cache_ptr->index_buckets = new_buckets;
+        cache_ptr->index_bits    = new_bits;
+
+        /* Rehash the entries */
+        for (entry_ptr = cache_ptr->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next) {
+            size_t k = H5C__HASH_FCN(cache_ptr, entry_ptr->addr);
+
+            entry_ptr->ht_prev = NULL;
+            entry_ptr->ht_next = cache_ptr->index[k];
+            if (entry_ptr->ht_next)
+                entry_ptr->ht_next->ht_prev = entry_ptr;
+            cache_ptr->index[k] = entry_ptr;
+        } /* end for */
+    }     /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__resize_index() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__ws_unlink_ghost
+ *
+ * Purpose:     Remove a ghost entry from the list of ghost entries of the
+ *              working set cache size increase mode.  The entry is not
+ *              removed from the skip list indexing the ghost entries.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5C__ws_unlink_ghost(H5C_t *cache_ptr, H5C_ws_ghost_t *ghost)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(cache_ptr);
+    assert(ghost);
+    assert(cache_ptr->ws_ghost_size >= ghost->size);
+
+    if (ghost->next)
+        ghost->next->prev = ghost->prev;
+    else
+        cache_ptr->ws_ghost_head = ghost->prev;
+    if (ghost->prev)
+        ghost->prev->next = ghost->next;
+    else
+        cache_ptr->ws_ghost_tail = ghost->next;
+    ghost->next = NULL;
+    ghost->prev = NULL;
+
+    cache_ptr->ws_ghost_size -= ghost->size;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5C__ws_unlink_ghost() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__ws_record_eviction
+ *
+ * Purpose:     Record an entry that is about to be evicted to make space
+ *              in the cache as a ghost entry, for the working set cache
+ *              size increase mode.  The oldest ghost entries are discarded
+ *              to keep the total size of the list within the largest size
+ *              the cache may grow to.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__ws_record_eviction(H5C_t *cache_ptr, const H5C_cache_entry_t *entry_ptr)
+{
+    H5C_ws_ghost_t *ghost;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(cache_ptr);
+    assert(cache_ptr->resize_ctl.incr_mode == H5C_incr__working_set);
+    assert(entry_ptr);
+
+    /* Create the index of ghost entries the first time it is needed */
+    if (NULL == cache_ptr->ws_ghost_slist)
+        if (NULL == (cache_ptr->ws_ghost_slist = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, FAIL, "can't create skip list for ghost entries");
+
+    /* Reuse the record of an earlier entry at the same address */
+    if (NULL != (ghost = (H5C_ws_ghost_t *)H5SL_search(cache_ptr->ws_ghost_slist, &entry_ptr->addr)))
+        H5C__ws_unlink_ghost(cache_ptr, ghost);
+    else {
+        if (NULL == (ghost = H5FL_MALLOC(H5C_ws_ghost_t)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "can't allocate ghost entry");
+
+        ghost->addr = entry_ptr->addr;
+        if (H5SL_insert(cache_ptr->ws_ghost_slist, ghost, &ghost->addr) < 0) {
+            ghost = H5FL_FREE(H5C_ws_ghost_t, ghost);
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTINSERT, FAIL, "can't insert ghost entry in skip list");
+        } /* end if */
+    }     /* end else */
+
+    /* Link the record in as the most recent ghost entry */
+    cache_ptr->ws_evicted_bytes += entry_ptr->size;
+    ghost->size      = entry_ptr->size;
+    ghost->evict_pos = cache_ptr->ws_evicted_bytes;
+    ghost->next      = NULL;
+    ghost->prev      = cache_ptr->ws_ghost_head;
+    if (cache_ptr->ws_ghost_head)
+        cache_ptr->ws_ghost_head->next = ghost;
+    else
+        cache_ptr->ws_ghost_tail = ghost;
+    cache_ptr->ws_ghost_head = ghost;
+    cache_ptr->ws_ghost_size += ghost->size;
+
+    /* Discard the oldest ghost entries that are out of reach */
+    while (cache_ptr->ws_ghost_size > cache_ptr->resize_ctl.max_size) {
+        ghost = cache_ptr->ws_ghost_tail;
+        assert(ghost);
+
+        if (NULL == H5SL_remove(cache_ptr->ws_ghost_slist, &ghost->addr))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTDELETE, FAIL, "can't remove ghost entry from skip list");
+        H5C__ws_unlink_ghost(cache_ptr, ghost);
+        ghost = H5FL_FREE(H5C_ws_ghost_t, ghost);
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__ws_record_eviction() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__ws_record_load
+ *
+ * Purpose:     Note the load of an entry from the file for the working set
+ *              cache size increase mode.  If the entry is on the list of
+ *              ghost entries, count the hit in the bin of the histogram
+ *              of ghost entry hits matching the amount of space the cache
+ *              would have needed to keep it, and discard the ghost entry.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__ws_record_load(H5C_t *cache_ptr, haddr_t addr)
+{
+    H5C_ws_ghost_t *ghost;
+    uint64_t        distance;
+    uint64_t        bin;
+    size_t          bin_size;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(cache_ptr);
+    assert(cache_ptr->resize_ctl.incr_mode == H5C_incr__working_set);
+
+    if (cache_ptr->ws_ghost_slist &&
+        NULL != (ghost = (H5C_ws_ghost_t *)H5SL_remove(cache_ptr->ws_ghost_slist, &addr))) {
+        /* The entry would have been a hit if the cache had been large
+         * enough to hold it and all the entries evicted after it.
+         */
+        assert(cache_ptr->ws_evicted_bytes >= ghost->evict_pos);
+        distance = (cache_ptr->ws_evicted_bytes - ghost->evict_pos) + ghost->size;
+        bin_size = MAX(cache_ptr->resize_ctl.max_size / H5C__WS_NUM_BINS, 1);
+        bin      = (distance - 1) / bin_size;
+        if (bin >= H5C__WS_NUM_BINS)
+            bin = H5C__WS_NUM_BINS - 1;
+        cache_ptr->ws_ghost_hits[bin]++;
+
+        H5C__ws_unlink_ghost(cache_ptr, ghost);
+        ghost = H5FL_FREE(H5C_ws_ghost_t, ghost);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__ws_record_load() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__ws_discard_ghosts
+ *
+ * Purpose:     Discard the ghost entries of the working set cache size
+ *              increase mode, when the mode is turned off or the cache is
+ *              destroyed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__ws_discard_ghosts(H5C_t *cache_ptr)
+{
+    H5C_ws_ghost_t *ghost;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(cache_ptr);
+
+    while (NULL != (ghost = cache_ptr->ws_ghost_head)) {
+        cache_ptr->ws_ghost_head = ghost->prev;
+        ghost                    = H5FL_FREE(H5C_ws_ghost_t, ghost);
+    } /* end while */
+    cache_ptr->ws_ghost_tail = NULL;
+    cache_ptr->ws_ghost_size = 0;
+
+    if (cache_ptr->ws_ghost_slist) {
+        H5SL_close(cache_ptr->ws_ghost_slist);
+        cache_ptr->ws_ghost_slist = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__ws_discard_ghosts() */
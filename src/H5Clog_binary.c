@@ -0,0 +1,954 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the LICENSE file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Clog_binary.c
+ *
+ * Purpose:     Cache log implementation that emits fixed-size binary
+ *              records.  Records are encoded into a memory buffer and
+ *              written to the log file only when the buffer fills or
+ *              logging stops, so logging costs little more than a
+ *              timestamp per cache operation.  The h5mdclog tool converts
+ *              these logs to the JSON and trace formats.
+ *
+ *              See H5Cprivate.h for the layout of the log.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+#include "H5Cmodule.h" /* This source code file is part of the H5C module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5Cpkg.h"      /* Cache                                    */
+#include "H5Clog.h"      /* Cache logging                            */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5MMprivate.h" /* Memory management                        */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Number of records buffered before they're written to the log file */
+#define H5C_BINARY_LOG_BUF_NRECORDS 4096
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+typedef struct H5C_log_binary_udata_t {
+    FILE    *outfile;    /* Log file */
+    uint8_t *buf;        /* Buffer of encoded records */
+    size_t   nrecords;   /* Number of records in the buffer */
+    uint64_t start_usec; /* H5_now_usec() when the log was set up */
+} H5C_log_binary_udata_t;
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/* Internal message handling calls */
+static herr_t H5C__binary_write_log_record(H5C_log_binary_udata_t *binary_udata, H5C_log_action_t action,
+                                           haddr_t address, haddr_t address2, size_t size, unsigned flags,
+                                           int type_id, herr_t fxn_ret_value);
+static herr_t H5C__binary_flush_log_records(H5C_log_binary_udata_t *binary_udata);
+
+/* Log message callbacks */
+static herr_t H5C__binary_tear_down_logging(H5C_log_info_t *log_info);
+static herr_t H5C__binary_write_start_log_msg(void *udata);
+static herr_t H5C__binary_write_stop_log_msg(void *udata);
+static herr_t H5C__binary_write_create_cache_log_msg(void *udata, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_destroy_cache_log_msg(void *udata);
+static herr_t H5C__binary_write_evict_cache_log_msg(void *udata, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_expunge_entry_log_msg(void *udata, haddr_t address, int type_id,
+                                                      herr_t fxn_ret_value);
+static herr_t H5C__binary_write_flush_cache_log_msg(void *udata, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_insert_entry_log_msg(void *udata, haddr_t address, int type_id,
+                                                     unsigned flags, size_t size, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_entry_dirty_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                         herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_entry_clean_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                         herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_unserialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                                herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_serialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                              herr_t fxn_ret_value);
+static herr_t H5C__binary_write_move_entry_log_msg(void *udata, haddr_t old_addr, haddr_t new_addr,
+                                                   int type_id, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_pin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                  herr_t fxn_ret_value);
+static herr_t H5C__binary_write_create_fd_log_msg(void *udata, const H5C_cache_entry_t *parent,
+                                                  const H5C_cache_entry_t *child, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_protect_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                      int type_id, unsigned flags, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_resize_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                     size_t new_size, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_unpin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                    herr_t fxn_ret_value);
+static herr_t H5C__binary_write_destroy_fd_log_msg(void *udata, const H5C_cache_entry_t *parent,
+                                                   const H5C_cache_entry_t *child, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_unprotect_entry_log_msg(void *udata, haddr_t address, int type_id,
+                                                        unsigned flags, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_set_cache_config_log_msg(void *udata, const H5AC_cache_config_t *config,
+                                                         herr_t fxn_ret_value);
+static herr_t H5C__binary_write_remove_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                     herr_t fxn_ret_value);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Note that there's no cache set up call since that's the
+ * place where this struct is wired into the cache.
+ */
+static const H5C_log_class_t H5C_binary_log_class_g = {"binary",
+                                                       H5C__binary_tear_down_logging,
+                                                       NULL, /* start logging */
+                                                       NULL, /* stop logging */
+                                                       H5C__binary_write_start_log_msg,
+                                                       H5C__binary_write_stop_log_msg,
+                                                       H5C__binary_write_create_cache_log_msg,
+                                                       H5C__binary_write_destroy_cache_log_msg,
+                                                       H5C__binary_write_evict_cache_log_msg,
+                                                       H5C__binary_write_expunge_entry_log_msg,
+                                                       H5C__binary_write_flush_cache_log_msg,
+                                                       H5C__binary_write_insert_entry_log_msg,
+                                                       H5C__binary_write_mark_entry_dirty_log_msg,
+                                                       H5C__binary_write_mark_entry_clean_log_msg,
+                                                       H5C__binary_write_mark_unserialized_entry_log_msg,
+                                                       H5C__binary_write_mark_serialized_entry_log_msg,
+                                                       H5C__binary_write_move_entry_log_msg,
+                                                       H5C__binary_write_pin_entry_log_msg,
+                                                       H5C__binary_write_create_fd_log_msg,
+                                                       H5C__binary_write_protect_entry_log_msg,
+                                                       H5C__binary_write_resize_entry_log_msg,
+                                                       H5C__binary_write_unpin_entry_log_msg,
+                                                       H5C__binary_write_destroy_fd_log_msg,
+                                                       H5C__binary_write_unprotect_entry_log_msg,
+                                                       H5C__binary_write_set_cache_config_log_msg,
+                                                       H5C__binary_write_remove_entry_log_msg};
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_log_record
+ *
+ * Purpose:     Encode a record in the record buffer, writing out the
+ *              buffer first if it is full.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_log_record(H5C_log_binary_udata_t *binary_udata, H5C_log_action_t action, haddr_t address,
+                             haddr_t address2, size_t size, unsigned flags, int type_id, herr_t fxn_ret_value)
+{
+    uint8_t *p;                   /* Pointer into the record buffer */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(binary_udata);
+    assert(binary_udata->buf);
+
+    /* Make room for the record */
+    if (binary_udata->nrecords == H5C_BINARY_LOG_BUF_NRECORDS)
+        if (H5C__binary_flush_log_records(binary_udata) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to write log records");
+
+    /* Encode the record */
+    p = binary_udata->buf + (binary_udata->nrecords * H5C_LOG_BINARY_RECORD_SIZE);
+    UINT64ENCODE(p, H5_now_usec() - binary_udata->start_usec);
+    UINT64ENCODE(p, address);
+    UINT64ENCODE(p, address2);
+    UINT64ENCODE(p, size);
+    UINT32ENCODE(p, flags);
+    INT16ENCODE(p, type_id);
+    *p++ = (uint8_t)action;
+    *p++ = (uint8_t)(int8_t)fxn_ret_value;
+    assert(p == binary_udata->buf + ((binary_udata->nrecords + 1) * H5C_LOG_BINARY_RECORD_SIZE));
+
+    binary_udata->nrecords++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_log_record() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_flush_log_records
+ *
+ * Purpose:     Write the buffered records to the log file and empty the
+ *              record buffer.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_flush_log_records(H5C_log_binary_udata_t *binary_udata)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(binary_udata);
+    assert(binary_udata->outfile);
+
+    if (binary_udata->nrecords > 0) {
+        if (binary_udata->nrecords != fwrite(binary_udata->buf, H5C_LOG_BINARY_RECORD_SIZE,
+                                             binary_udata->nrecords, binary_udata->outfile))
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "error writing log records");
+        if (EOF == fflush(binary_udata->outfile))
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "error flushing log file");
+
+        binary_udata->nrecords = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_flush_log_records() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__log_binary_set_up
+ *
+ * Purpose:     Setup for binary metadata cache logging.
+ *
+ *              Opens the log file and writes its header.  See
+ *              H5C__log_json_set_up for how the log set up, tear down,
+ *              start and stop calls interact.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__log_binary_set_up(H5C_log_info_t *log_info, const char log_location[], int mpi_rank)
+{
+    H5C_log_binary_udata_t *binary_udata = NULL;
+    char                   *file_name    = NULL;
+    uint8_t                 header[H5C_LOG_BINARY_HEADER_SIZE];
+    uint8_t                *p;
+    size_t                  n_chars;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(log_info);
+    assert(log_location);
+
+    /* Set up the class struct */
+    log_info->cls = &H5C_binary_log_class_g;
+
+    /* Allocate memory for the binary-specific data */
+    if (NULL == (log_info->udata = H5MM_calloc(sizeof(H5C_log_binary_udata_t))))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed");
+    binary_udata = (H5C_log_binary_udata_t *)(log_info->udata);
+
+    /* Allocate memory for the record buffer */
+    if (NULL == (binary_udata->buf =
+                     (uint8_t *)H5MM_malloc(H5C_BINARY_LOG_BUF_NRECORDS * H5C_LOG_BINARY_RECORD_SIZE)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed");
+
+    /* Possibly fix up the log file name, as for JSON logs */
+    n_chars = 5 + 39 + 1 + strlen(log_location) + 1;
+    if (NULL == (file_name = (char *)H5MM_calloc(n_chars * sizeof(char))))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL,
+                    "can't allocate memory for mdc log file name manipulation");
+
+    /* Add the rank to the log file name when MPI is in use */
+    if (-1 == mpi_rank)
+        snprintf(file_name, n_chars, "%s", log_location);
+    else
+        snprintf(file_name, n_chars, "RANK_%d.%s", mpi_rank, log_location);
+
+    /* Open log file */
+    if (NULL == (binary_udata->outfile = fopen(file_name, "wb")))
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "can't create mdc log file");
+
+    /* Write the header.  Records are timestamped relative to now with the
+     * monotonic clock, and the header holds the wall clock time to add.
+     */
+    binary_udata->start_usec = H5_now_usec();
+    p                        = header;
+    H5MM_memcpy(p, H5C_LOG_BINARY_SIGNATURE, (size_t)H5C_LOG_BINARY_SIGNATURE_LEN);
+    p += H5C_LOG_BINARY_SIGNATURE_LEN;
+    UINT32ENCODE(p, H5C_LOG_BINARY_VERSION);
+    UINT32ENCODE(p, H5C_LOG_BINARY_RECORD_SIZE);
+    INT32ENCODE(p, mpi_rank);
+    UINT32ENCODE(p, 0); /* reserved */
+    UINT64ENCODE(p, (uint64_t)time(NULL) * 1000000);
+    assert((size_t)(p - header) == H5C_LOG_BINARY_HEADER_SIZE);
+
+    if (1 != fwrite(header, (size_t)H5C_LOG_BINARY_HEADER_SIZE, 1, binary_udata->outfile))
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "can't write mdc log file header");
+
+done:
+    if (file_name)
+        H5MM_xfree(file_name);
+
+    /* Free and reset the log info struct on errors */
+    if (FAIL == ret_value) {
+        /* Free */
+        if (binary_udata && binary_udata->outfile)
+            fclose(binary_udata->outfile);
+        if (binary_udata && binary_udata->buf)
+            H5MM_xfree(binary_udata->buf);
+        if (binary_udata)
+            H5MM_xfree(binary_udata);
+
+        /* Reset */
+        log_info->udata = NULL;
+        log_info->cls   = NULL;
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__log_binary_set_up() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_tear_down_logging
+ *
+ * Purpose:     Tear-down for binary metadata cache logging.  Writes any
+ *              buffered records before closing the log file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_tear_down_logging(H5C_log_info_t *log_info)
+{
+    H5C_log_binary_udata_t *binary_udata = NULL;
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(log_info);
+
+    /* Alias */
+    binary_udata = (H5C_log_binary_udata_t *)(log_info->udata);
+
+    /* Write out any records still in the buffer */
+    if (H5C__binary_flush_log_records(binary_udata) < 0)
+        HDONE_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to write log records");
+
+    /* Free the record buffer */
+    H5MM_xfree(binary_udata->buf);
+
+    /* Close log file */
+    if (EOF == fclose(binary_udata->outfile))
+        HDONE_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "problem closing mdc log file");
+    binary_udata->outfile = NULL;
+
+    /* Free the udata */
+    H5MM_xfree(binary_udata);
+
+    /* Reset the log class info and udata */
+    log_info->cls   = NULL;
+    log_info->udata = NULL;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_tear_down_logging() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_start_log_msg
+ *
+ * Purpose:     Write a log record when logging starts.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_start_log_msg(void *udata)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_START, HADDR_UNDEF,
+                                     HADDR_UNDEF, 0, 0, -1, SUCCEED) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_start_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_stop_log_msg
+ *
+ * Purpose:     Write a log record when logging ends, and write all
+ *              buffered records to the log file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_stop_log_msg(void *udata)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_write_log_record(binary_udata, H5C_LOG_ACTION_STOP, HADDR_UNDEF, HADDR_UNDEF, 0, 0, -1,
+                                     SUCCEED) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+    if (H5C__binary_flush_log_records(binary_udata) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to write log records");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_stop_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_create_cache_log_msg
+ *
+ * Purpose:     Write a log record for cache creation.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_create_cache_log_msg(void *udata, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_CREATE, HADDR_UNDEF,
+                                     HADDR_UNDEF, 0, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_create_cache_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_destroy_cache_log_msg
+ *
+ * Purpose:     Write a log record for cache destruction.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_destroy_cache_log_msg(void *udata)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_DESTROY, HADDR_UNDEF,
+                                     HADDR_UNDEF, 0, 0, -1, SUCCEED) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_destroy_cache_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_evict_cache_log_msg
+ *
+ * Purpose:     Write a log record for eviction of cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_evict_cache_log_msg(void *udata, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_EVICT, HADDR_UNDEF,
+                                     HADDR_UNDEF, 0, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_evict_cache_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_expunge_entry_log_msg
+ *
+ * Purpose:     Write a log record for expunge of cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_expunge_entry_log_msg(void *udata, haddr_t address, int type_id, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_EXPUNGE, address,
+                                     HADDR_UNDEF, 0, 0, type_id, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_expunge_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_flush_cache_log_msg
+ *
+ * Purpose:     Write a log record for cache flushes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_flush_cache_log_msg(void *udata, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_FLUSH, HADDR_UNDEF,
+                                     HADDR_UNDEF, 0, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_flush_cache_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_insert_entry_log_msg
+ *
+ * Purpose:     Write a log record for insertion of cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_insert_entry_log_msg(void *udata, haddr_t address, int type_id, unsigned flags, size_t size,
+                                       herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_INSERT, address,
+                                     HADDR_UNDEF, size, flags, type_id, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_insert_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_entry_dirty_log_msg
+ *
+ * Purpose:     Write a log record for marking cache entries as dirty.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_entry_dirty_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(entry);
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_DIRTY, entry->addr,
+                                     HADDR_UNDEF, 0, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_entry_dirty_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_entry_clean_log_msg
+ *
+ * Purpose:     Write a log record for marking cache entries as clean.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_entry_clean_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(entry);
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_CLEAN, entry->addr,
+                                     HADDR_UNDEF, 0, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_entry_clean_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_unserialized_entry_log_msg
+ *
+ * Purpose:     Write a log record for marking cache entries as
+ *              unserialized.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_unserialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                  herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(entry);
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_UNSERIALIZED,
+                                     entry->addr, HADDR_UNDEF, 0, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_unserialized_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_serialized_entry_log_msg
+ *
+ * Purpose:     Write a log record for marking cache entries as
+ *              serialized.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_serialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(entry);
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_SERIALIZED,
+                                     entry->addr, HADDR_UNDEF, 0, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_serialized_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_move_entry_log_msg
+ *
+ * Purpose:     Write a log record for moving a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_move_entry_log_msg(void *udata, haddr_t old_addr, haddr_t new_addr, int type_id,
+                                     herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_MOVE, old_addr,
+                                     new_addr, 0, 0, type_id, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_move_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_pin_entry_log_msg
+ *
+ * Purpose:     Write a log record for pinning a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_pin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(entry);
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_PIN, entry->addr,
+                                     HADDR_UNDEF, 0, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_pin_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_create_fd_log_msg
+ *
+ * Purpose:     Write a log record for creating a flush dependency between
+ *              two cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_create_fd_log_msg(void *udata, const H5C_cache_entry_t *parent,
+                                    const H5C_cache_entry_t *child, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(parent);
+    assert(child);
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_CREATE_FD, parent->addr,
+                                     child->addr, 0, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_create_fd_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_protect_entry_log_msg
+ *
+ * Purpose:     Write a log record for protecting a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_protect_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, int type_id,
+                                        unsigned flags, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(entry);
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_PROTECT, entry->addr,
+                                     HADDR_UNDEF, entry->size, flags, type_id, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_protect_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_resize_entry_log_msg
+ *
+ * Purpose:     Write a log record for resizing a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_resize_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, size_t new_size,
+                                       herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(entry);
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_RESIZE, entry->addr,
+                                     HADDR_UNDEF, new_size, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_resize_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_unpin_entry_log_msg
+ *
+ * Purpose:     Write a log record for unpinning a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_unpin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(entry);
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_UNPIN, entry->addr,
+                                     HADDR_UNDEF, 0, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_unpin_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_destroy_fd_log_msg
+ *
+ * Purpose:     Write a log record for destroying a flush dependency
+ *              between two cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_destroy_fd_log_msg(void *udata, const H5C_cache_entry_t *parent,
+                                     const H5C_cache_entry_t *child, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(parent);
+    assert(child);
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_DESTROY_FD,
+                                     parent->addr, child->addr, 0, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_destroy_fd_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_unprotect_entry_log_msg
+ *
+ * Purpose:     Write a log record for unprotecting a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_unprotect_entry_log_msg(void *udata, haddr_t address, int type_id, unsigned flags,
+                                          herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_UNPROTECT, address,
+                                     HADDR_UNDEF, 0, flags, type_id, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_unprotect_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_set_cache_config_log_msg
+ *
+ * Purpose:     Write a log record for setting the cache configuration.
+ *              The configuration itself isn't recorded.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_set_cache_config_log_msg(void                                            *udata,
+                                           const H5AC_cache_config_t H5_ATTR_NDEBUG_UNUSED *config,
+                                           herr_t                                           fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(config);
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_SET_CONFIG,
+                                     HADDR_UNDEF, HADDR_UNDEF, 0, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_set_cache_config_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_remove_entry_log_msg
+ *
+ * Purpose:     Write a log record for removing a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_remove_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(entry);
+
+    if (H5C__binary_write_log_record((H5C_log_binary_udata_t *)udata, H5C_LOG_ACTION_REMOVE, entry->addr,
+                                     HADDR_UNDEF, 0, 0, -1, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_remove_entry_log_msg() */
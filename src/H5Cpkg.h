@@ -37,12 +37,21 @@
 /* Number of epoch markers active */
 #define H5C__MAX_EPOCH_MARKERS 10
 
-/* Cache configuration settings */
-#define H5C__HASH_TABLE_LEN (64 * 1024) /* must be a power of 2 */
+/* Limits on the number of buckets in the cache's index (powers of 2) */
+#define H5C__HASH_TABLE_MIN_LEN (1024)
+#define H5C__HASH_TABLE_MAX_LEN (16 * 1024 * 1024)
 
 /* Initial allocated size of the "flush_dep_parent" array */
 #define H5C_FLUSH_DEP_PARENT_INIT 8
 
+/* Largest total size of the entry images held in a write batch */
+#define H5C__WRITE_BATCH_MAX_SIZE (4 * 1024 * 1024)
+
+/* Number of bins in the histogram of ghost entry hits kept by the working
+ * set cache size increase mode
+ */
+#define H5C__WS_NUM_BINS 32
+
 /****************************************************************************
  *
  * We maintain doubly linked lists of instances of H5C_cache_entry_t for a
@@ -592,16 +601,31 @@
  *
  ***********************************************************************/
 
-#define H5C__HASH_MASK   ((size_t)(H5C__HASH_TABLE_LEN - 1) << 3)
-#define H5C__HASH_FCN(x) (int)((unsigned)((x) & H5C__HASH_MASK) >> 3)
+/* Hash function for the index.  The address is multiplied by 2^64 divided
+ * by the golden ratio, and the top index_bits bits of the product select the
+ * bucket.  Unlike masking off low address bits, this spreads entries whose
+ * addresses share their low bits (e.g. entries of one size allocated in
+ * sequence) over all the buckets.
+ */
+#define H5C__HASH_FCN(cache_ptr, x)                                                                          \
+    ((size_t)(((uint64_t)(x) * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - (cache_ptr)->index_bits)))
+
+/* Whether the index should be resized: it is grown when it holds more
+ * entries than it has buckets, and shrunk when it holds fewer than one entry
+ * for every eight buckets.
+ */
+#define H5C__INDEX_NEEDS_RESIZE(cache_ptr)                                                                   \
+    (((cache_ptr)->index_len > (cache_ptr)->index_buckets &&                                                 \
+      (cache_ptr)->index_buckets < H5C__HASH_TABLE_MAX_LEN) ||                                               \
+     ((cache_ptr)->index_len < (cache_ptr)->index_buckets / 8 &&                                             \
+      (cache_ptr)->index_buckets > H5C__HASH_TABLE_MIN_LEN))
 
 #define H5C__POST_HT_SHIFT_TO_FRONT_SC_CMP(cache_ptr, entry_ptr, k)                                          \
     ((cache_ptr) == NULL || (cache_ptr)->index[k] != (entry_ptr) || (entry_ptr)->ht_prev != NULL)
 #define H5C__PRE_HT_SEARCH_SC_CMP(cache_ptr, entry_addr)                                                     \
     ((cache_ptr) == NULL ||                                                                                  \
      (cache_ptr)->index_size != ((cache_ptr)->clean_index_size + (cache_ptr)->dirty_index_size) ||           \
-     !H5_addr_defined(entry_addr) || H5C__HASH_FCN(entry_addr) < 0 ||                                        \
-     H5C__HASH_FCN(entry_addr) >= H5C__HASH_TABLE_LEN)
+     !H5_addr_defined(entry_addr) || H5C__HASH_FCN(cache_ptr, entry_addr) >= (cache_ptr)->index_buckets)
 #define H5C__POST_SUC_HT_SEARCH_SC_CMP(cache_ptr, entry_ptr, k)                                              \
     ((cache_ptr) == NULL || (cache_ptr)->index_len < 1 || (entry_ptr) == NULL ||                             \
      (cache_ptr)->index_size < (entry_ptr)->size ||                                                          \
@@ -617,7 +641,7 @@
 #define H5C__PRE_HT_INSERT_SC(cache_ptr, entry_ptr, fail_val)                                                \
     if ((cache_ptr) == NULL || (entry_ptr) == NULL || !H5_addr_defined((entry_ptr)->addr) ||                 \
         (entry_ptr)->ht_next != NULL || (entry_ptr)->ht_prev != NULL || (entry_ptr)->size <= 0 ||            \
-        H5C__HASH_FCN((entry_ptr)->addr) < 0 || H5C__HASH_FCN((entry_ptr)->addr) >= H5C__HASH_TABLE_LEN ||   \
+        H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) >= (cache_ptr)->index_buckets ||                         \
         (cache_ptr)->index_size != ((cache_ptr)->clean_index_size + (cache_ptr)->dirty_index_size) ||        \
         (cache_ptr)->index_size < (cache_ptr)->clean_index_size ||                                           \
         (cache_ptr)->index_size < (cache_ptr)->dirty_index_size ||                                           \
@@ -649,12 +673,12 @@
 #define H5C__PRE_HT_REMOVE_SC(cache_ptr, entry_ptr, fail_val)                                                \
     if ((cache_ptr) == NULL || (cache_ptr)->index_len < 1 || (entry_ptr) == NULL ||                          \
         (cache_ptr)->index_size < (entry_ptr)->size || !H5_addr_defined((entry_ptr)->addr) ||                \
-        (entry_ptr)->size <= 0 || H5C__HASH_FCN((entry_ptr)->addr) < 0 ||                                    \
-        H5C__HASH_FCN((entry_ptr)->addr) >= H5C__HASH_TABLE_LEN ||                                           \
-        (cache_ptr)->index[H5C__HASH_FCN((entry_ptr)->addr)] == NULL ||                                      \
-        ((cache_ptr)->index[H5C__HASH_FCN((entry_ptr)->addr)] != (entry_ptr) &&                              \
+        (entry_ptr)->size <= 0 ||                                                                            \
+        H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) >= (cache_ptr)->index_buckets ||                         \
+        (cache_ptr)->index[H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr)] == NULL ||                           \
+        ((cache_ptr)->index[H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr)] != (entry_ptr) &&                   \
          (entry_ptr)->ht_prev == NULL) ||                                                                    \
-        ((cache_ptr)->index[H5C__HASH_FCN((entry_ptr)->addr)] == (entry_ptr) &&                              \
+        ((cache_ptr)->index[H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr)] == (entry_ptr) &&                   \
          (entry_ptr)->ht_prev != NULL) ||                                                                    \
         (cache_ptr)->index_size != ((cache_ptr)->clean_index_size + (cache_ptr)->dirty_index_size) ||        \
         (cache_ptr)->index_size < (cache_ptr)->clean_index_size ||                                           \
@@ -817,9 +841,9 @@
 
 #define H5C__INSERT_IN_INDEX(cache_ptr, entry_ptr, fail_val)                                                 \
     do {                                                                                                     \
-        int k;                                                                                               \
+        size_t k;                                                                                            \
         H5C__PRE_HT_INSERT_SC(cache_ptr, entry_ptr, fail_val)                                                \
-        k = H5C__HASH_FCN((entry_ptr)->addr);                                                                \
+        k = H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr);                                                     \
         if ((cache_ptr)->index[k] != NULL) {                                                                 \
             (entry_ptr)->ht_next          = (cache_ptr)->index[k];                                           \
             (entry_ptr)->ht_next->ht_prev = (entry_ptr);                                                     \
@@ -845,13 +869,16 @@
                            (cache_ptr)->il_size, fail_val);                                                  \
         H5C__UPDATE_STATS_FOR_HT_INSERTION(cache_ptr);                                                       \
         H5C__POST_HT_INSERT_SC(cache_ptr, entry_ptr, fail_val);                                              \
+        if (H5C__INDEX_NEEDS_RESIZE(cache_ptr))                                                              \
+            if (H5C__resize_index(cache_ptr) < 0)                                                            \
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTRESIZE, (fail_val), "can't resize cache index");              \
     } while (0)
 
 #define H5C__DELETE_FROM_INDEX(cache_ptr, entry_ptr, fail_val)                                               \
     do {                                                                                                     \
-        int k;                                                                                               \
+        size_t k;                                                                                            \
         H5C__PRE_HT_REMOVE_SC(cache_ptr, entry_ptr, fail_val)                                                \
-        k = H5C__HASH_FCN((entry_ptr)->addr);                                                                \
+        k = H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr);                                                     \
         if ((entry_ptr)->ht_next)                                                                            \
             (entry_ptr)->ht_next->ht_prev = (entry_ptr)->ht_prev;                                            \
         if ((entry_ptr)->ht_prev)                                                                            \
@@ -884,10 +911,10 @@
 
 #define H5C__SEARCH_INDEX(cache_ptr, entry_addr, entry_ptr, fail_val)                                        \
     do {                                                                                                     \
-        int k;                                                                                               \
-        int depth = 0;                                                                                       \
+        size_t k;                                                                                            \
+        int    depth = 0;                                                                                    \
         H5C__PRE_HT_SEARCH_SC(cache_ptr, entry_addr, fail_val);                                              \
-        k           = H5C__HASH_FCN(entry_addr);                                                             \
+        k           = H5C__HASH_FCN(cache_ptr, entry_addr);                                                  \
         (entry_ptr) = (cache_ptr)->index[k];                                                                 \
         while (entry_ptr) {                                                                                  \
             if (H5_addr_eq(entry_addr, (entry_ptr)->addr)) {                                                 \
@@ -1783,6 +1810,124 @@ typedef struct H5C_tag_info_t {
     UT_hash_handle hh; /* Hash table handle (must be LAST) */
 } H5C_tag_info_t;
 
+/****************************************************************************
+ *
+ * structure H5C_lazy_image_entry_t
+ *
+ * Structure recording an entry of a loaded metadata cache image that
+ * hasn't been reconstructed into a prefetched entry yet.
+ *
+ * The fields of this structure are discussed individually below:
+ *
+ * addr:        Base address of the entry in the file.
+ *
+ * image:       Pointer to the start of the entry's record in the cache
+ *              image (i.e. its header, followed by its on disk image),
+ *              or NULL once the entry has been reconstructed.
+ *
+ ****************************************************************************/
+typedef struct H5C_lazy_image_entry_t {
+    haddr_t        addr;  /* Address of the entry */
+    const uint8_t *image; /* Entry's record in the cache image */
+} H5C_lazy_image_entry_t;
+
+/****************************************************************************
+ *
+ * structure H5C_batch_write_t
+ *
+ * Structure recording a write of an entry's image that has been deferred
+ * to the end of a write batch.
+ *
+ * The fields of this structure are discussed individually below:
+ *
+ * addr:        Address in the file to write the image to.
+ *
+ * size:        Size of the image.
+ *
+ * type:        Memory type of the write.
+ *
+ * offset:      Offset of the copy of the image in the cache's write batch
+ *              buffer.  Since images are appended to the buffer, this also
+ *              gives the order in which the writes were made.
+ *
+ ****************************************************************************/
+typedef struct H5C_batch_write_t {
+    haddr_t    addr;   /* Address to write to */
+    size_t     size;   /* Size of the image */
+    H5FD_mem_t type;   /* Memory type of the write */
+    size_t     offset; /* Offset of the image in the batch buffer */
+} H5C_batch_write_t;
+
+/****************************************************************************
+ *
+ * structure H5C_read_ahead_t
+ *
+ * Structure holding the image of an entry that has been read from the
+ * file ahead of the entry's load.
+ *
+ * The fields of this structure are discussed individually below:
+ *
+ * addr:        Address of the entry in the file.
+ *
+ * len:         Size of the image.
+ *
+ * type:        Pointer to the class of the entry.  The image is only used
+ *              to load an entry of this class.
+ *
+ * image:       Pointer to a dynamically allocated buffer holding the image,
+ *              or NULL once the image has been used.
+ *
+ * chksum_ok:   Boolean flag indicating that the image ends with the
+ *              metadata checksum of the rest of the image.  Only set for
+ *              classes with the H5C__CLASS_TRAILING_CHKSUM_FLAG, whose
+ *              verify_chksum callback is then skipped when the image is
+ *              used.
+ *
+ ****************************************************************************/
+typedef struct H5C_read_ahead_t {
+    haddr_t            addr;      /* Address of the entry */
+    size_t             len;       /* Size of the image */
+    const H5C_class_t *type;      /* Class of the entry */
+    uint8_t           *image;     /* Image of the entry, NULL once used */
+    bool               chksum_ok; /* Whether the image's trailing checksum matches */
+} H5C_read_ahead_t;
+
+/****************************************************************************
+ *
+ * structure H5C_ws_ghost_t
+ *
+ * Structure recording an entry evicted to make space in the cache while the
+ * cache is sized by the working set size increase mode.  Ghost entries are
+ * kept on a list in order of eviction, and are indexed by address so that
+ * the load of an entry evicted earlier can be spotted.
+ *
+ * The fields of this structure are discussed individually below:
+ *
+ * addr:        Base address of the evicted entry in the file.
+ *
+ * size:        Size of the evicted entry.
+ *
+ * evict_pos:   Value of the cache's ws_evicted_bytes field once the entry
+ *              had been evicted.  The difference between the current value
+ *              of that field and evict_pos is the number of bytes evicted
+ *              after the entry, and thus the amount of space the cache
+ *              would have needed to keep the entry.
+ *
+ * next:        Pointer to the next (more recently evicted) ghost entry, or
+ *              NULL if this is the most recent one.
+ *
+ * prev:        Pointer to the previous (less recently evicted) ghost entry,
+ *              or NULL if this is the oldest one.
+ *
+ ****************************************************************************/
+typedef struct H5C_ws_ghost_t {
+    haddr_t                addr;      /* Address of the evicted entry */
+    size_t                 size;      /* Size of the evicted entry */
+    uint64_t               evict_pos; /* Bytes evicted when the entry was */
+    struct H5C_ws_ghost_t *next;      /* Next (newer) ghost entry */
+    struct H5C_ws_ghost_t *prev;      /* Previous (older) ghost entry */
+} H5C_ws_ghost_t;
+
 /****************************************************************************
  *
  * structure H5C_t
@@ -1936,20 +2081,21 @@ typedef struct H5C_tag_info_t {
  *        index by ring.  Note that the sum of all cells in this array
  *        must equal the value stored in dirty_index_size above.
  *
- * index: Array of pointers to H5C_cache_entry_t of size
- *        H5C__HASH_TABLE_LEN.  At present, this value is a power
- *        of two, not the usual prime number.
+ * index: Pointer to a dynamically allocated array of index_buckets
+ *        pointers to H5C_cache_entry_t, the heads of the hash buckets.
  *
- *        Hopefully the variable size of cache elements, the large
- *        hash table size, and the way in which HDF5 allocates space
- *        will combine to avoid problems with periodicity.  If so, we
- *        can use a trivial hash function (a bit-and and a 3 bit left
- *        shift) with some small savings.
+ *        The array is resized as entries are inserted, so that it has
+ *        at least as many buckets as there are entries in the cache, and
+ *        no more than about eight times as many, within the limits of
+ *        H5C__HASH_TABLE_MIN_LEN and H5C__HASH_TABLE_MAX_LEN.  Resizing
+ *        is only done on insertion, so that entries may be removed from
+ *        the index while scanning its buckets.
  *
- *        If not, it will become evident in the statistics. Changing
- *        to the usual prime number length hash table will require
- *        changing the H5C__HASH_FCN macro and the deletion of the
- *        H5C__HASH_MASK #define.  No other changes should be required.
+ * index_buckets: Number of buckets in the index.  This is always a power
+ *        of two.
+ *
+ * index_bits: Base 2 logarithm of index_buckets, i.e. the number of bits
+ *        of the hash used by H5C__HASH_FCN to select a bucket.
  *
  * il_len: Number of entries on the index list.
  *
@@ -2533,6 +2679,35 @@ typedef struct H5C_tag_info_t {
  *        image_len in which the metadata cache image is assembled,
  *        or NULL if that buffer does not exist.
  *
+ *        If the image is to be compressed, the image is assembled and
+ *        compressed when the file is prepared for close, so that only
+ *        the space for the compressed image need be allocated in the file.
+ *        In this case, image_buffer is set up before the cache is
+ *        flushed and destroyed.
+ *
+ * When a cache image is loaded for a file opened read only, the entries
+ * in the image that aren't involved in flush dependencies are not turned
+ * into prefetched entries right away.  Instead, they are recorded in an
+ * array sorted by address, and each is reconstructed from the image the
+ * first time it is protected.  As the file can't be modified, an entry's
+ * address can't be reused while it is waiting in the array.  The
+ * following fields support this:
+ *
+ * lazy_image_buffer: Pointer to the dynamically allocated buffer holding
+ *        the (uncompressed) entries section of the loaded cache image,
+ *        or NULL if no entries are waiting to be reconstructed.
+ *
+ * lazy_image_entries: Pointer to a dynamically allocated array of
+ *        num_lazy_image_entries instances of H5C_lazy_image_entry_t,
+ *        sorted by address, or NULL if that array does not exist.
+ *
+ * num_lazy_image_entries: Number of entries in the lazy_image_entries
+ *        array.
+ *
+ * lazy_image_entries_left: Number of entries in the lazy_image_entries
+ *        array that haven't been reconstructed yet.  When this drops to
+ *        zero, the array and lazy_image_buffer are freed.
+ *
  *
  * Free Space Manager Related fields:
  *
@@ -2571,6 +2746,133 @@ typedef struct H5C_tag_info_t {
  *        space managers.
  *
  *
+ * Fields supporting batched writes of entries:
+ *
+ * In the serial case, the entries written while a ring of the cache is
+ * flushed, or while space is made in the cache, are not written one at
+ * a time.  Instead, copies of their images are collected in a write batch,
+ * which is written with a single vector write, in order of address, at
+ * the end of the operation.  The batch is also written before any entry
+ * is loaded from the file, and when it grows past
+ * H5C__WRITE_BATCH_MAX_SIZE bytes.
+ *
+ * Writes aren't batched in the parallel case (which collects the writes
+ * of entries with coll_write_list instead), with the page buffer, or
+ * under SWMR write, where the order in which entries reach the file
+ * matters.
+ *
+ * write_batch_depth: Number of nested operations that have begun a write
+ *        batch.  The batch is written when the outermost one ends.
+ *
+ * write_batch_enabled: Boolean flag indicating whether writes are being
+ *        batched.
+ *
+ * batch_writes: Pointer to a dynamically allocated array of
+ *        batch_writes_alloc instances of H5C_batch_write_t, the first
+ *        num_batch_writes of which record the writes in the batch.
+ *
+ * num_batch_writes: Number of writes in the batch.
+ *
+ * batch_writes_alloc: Number of elements allocated in batch_writes.
+ *
+ * batch_buf: Pointer to a dynamically allocated buffer of
+ *        batch_buf_alloc bytes holding copies of the images in the batch.
+ *
+ * batch_buf_len: Number of bytes of batch_buf in use.
+ *
+ * batch_buf_alloc: Size of batch_buf.
+ *
+ *
+ * Fields supporting entry read-ahead:
+ *
+ * A client that knows the addresses and sizes of several entries it is
+ * about to load (for example, the continuation chunks of an object
+ * header) can have their images read with a single vector read, through
+ * H5C_read_ahead().  Each image is used, and freed, when its entry is
+ * loaded.  The client discards any images left over with
+ * H5C_discard_read_ahead().
+ *
+ * Since the vector read bypasses the metadata accumulator and the page
+ * buffer, images are only read ahead for files opened read-only, and
+ * never in the parallel case.
+ *
+ * read_ahead: Pointer to a dynamically allocated array of
+ *        num_read_ahead instances of H5C_read_ahead_t.
+ *
+ * num_read_ahead: Number of elements of read_ahead.
+ *
+ * num_read_ahead_left: Number of images in read_ahead not yet used.
+ *
+ *
+ * Fields supporting the working set cache size increase mode:
+ *
+ * When incr_mode is H5C_incr__working_set, the cache estimates the size
+ * of the working set of the file's metadata at the end of each epoch, and
+ * sets its maximum size from the estimate.
+ *
+ * Entries evicted to make space in the cache are recorded on a list of
+ * "ghost" entries, whose total size is kept below the largest size the
+ * cache may grow to.  When an entry on the list is loaded again, the
+ * number of bytes evicted since it was evicted tells how much larger the
+ * cache would have had to be for the load to be a hit.  These hits are
+ * collected in a histogram over each epoch, with bins of 1/H5C__WS_NUM_BINS
+ * of the largest cache size.
+ *
+ * To decide whether the cache can be made smaller, the total size of the
+ * distinct entries protected over the epoch is kept as well.  Each entry
+ * records the last epoch it was protected in, so it is only counted once.
+ *
+ * Together with the time spent loading entries in the epoch, this lets
+ * the cache predict the average time per access spent on misses for a
+ * range of cache sizes.  The cache is grown to the smallest size that
+ * meets ws_target_latency, or just large enough to have turned all the
+ * ghost entry hits in the epoch into hits, if no target is set.  When there
+ * were no ghost entry hits and the target is met, the cache is shrunk to
+ * the size of the entries used in the epoch.
+ *
+ * ws_ghost_slist: Pointer to a skip list of the ghost entries, indexed by
+ *        address, or NULL if the working set mode has not been used.
+ *
+ * ws_ghost_head: Pointer to the most recently evicted ghost entry.
+ *
+ * ws_ghost_tail: Pointer to the least recently evicted ghost entry.  This
+ *        is the first discarded when the list grows too large.
+ *
+ * ws_ghost_size: Total size of the entries on the ghost list.
+ *
+ * ws_evicted_bytes: Total size of the entries recorded on the ghost list
+ *        since the cache was created.
+ *
+ * ws_ghost_hits: Histogram of the ghost entry hits in the current epoch.
+ *        Element i counts the loads of ghost entries that would have been
+ *        hits had the cache been between i and i + 1 bins larger.
+ *
+ * ws_epoch: Number of the current epoch, starting at one.
+ *
+ * ws_epoch_size: Total size of the distinct entries protected in the
+ *        current epoch.
+ *
+ * ws_epoch_load_time: Time, in microseconds, spent loading entries in the
+ *        current epoch.
+ *
+ * ws_target_latency: Target average time, in seconds, that an access of
+ *        the cache spends loading entries from the file, or zero if there
+ *        is no target.
+ *
+ *
+ * Fields collecting miss statistics by entry type:
+ *
+ * These fields are maintained whether or not H5C_COLLECT_CACHE_STATS is
+ * true, and cover the life of the cache.  They are reported to the
+ * application by H5Fget_mdc_type_stats().
+ *
+ * type_misses: Array recording the number of times an entry with type id
+ *        equal to the array index was loaded from the file.
+ *
+ * type_load_time: Array recording the time, in microseconds, spent
+ *        loading entries with type id equal to the array index.
+ *
+ *
  * Statistics collection fields:
  *
  * When enabled, these fields are used to collect statistics as described
@@ -2876,19 +3178,21 @@ struct H5C_t {
     bool                       close_warning_received;
 
     /* Fields for maintaining the [hash table] index of entries */
-    uint32_t           index_len;
-    size_t             index_size;
-    uint32_t           index_ring_len[H5C_RING_NTYPES];
-    size_t             index_ring_size[H5C_RING_NTYPES];
-    size_t             clean_index_size;
-    size_t             clean_index_ring_size[H5C_RING_NTYPES];
-    size_t             dirty_index_size;
-    size_t             dirty_index_ring_size[H5C_RING_NTYPES];
-    H5C_cache_entry_t *index[H5C__HASH_TABLE_LEN];
-    uint32_t           il_len;
-    size_t             il_size;
-    H5C_cache_entry_t *il_head;
-    H5C_cache_entry_t *il_tail;
+    uint32_t            index_len;
+    size_t              index_size;
+    uint32_t            index_ring_len[H5C_RING_NTYPES];
+    size_t              index_ring_size[H5C_RING_NTYPES];
+    size_t              clean_index_size;
+    size_t              clean_index_ring_size[H5C_RING_NTYPES];
+    size_t              dirty_index_size;
+    size_t              dirty_index_ring_size[H5C_RING_NTYPES];
+    H5C_cache_entry_t **index;
+    size_t              index_buckets;
+    unsigned            index_bits;
+    uint32_t            il_len;
+    size_t              il_size;
+    H5C_cache_entry_t  *il_head;
+    H5C_cache_entry_t  *il_tail;
 
     /* Fields to detect entries removed during scans */
     int64_t            entries_removed_counter;
@@ -2999,10 +3303,47 @@ struct H5C_t {
     H5C_image_entry_t    *image_entries;
     void                 *image_buffer;
 
+    /* Fields supporting lazy reconstruction of cache image entries */
+    void                   *lazy_image_buffer;
+    H5C_lazy_image_entry_t *lazy_image_entries;
+    uint32_t                num_lazy_image_entries;
+    uint32_t                lazy_image_entries_left;
+
     /* Free Space Manager Related fields */
     bool rdfsm_settled;
     bool mdfsm_settled;
 
+    /* Fields supporting batched writes of entries */
+    unsigned           write_batch_depth;
+    bool               write_batch_enabled;
+    H5C_batch_write_t *batch_writes;
+    size_t             num_batch_writes;
+    size_t             batch_writes_alloc;
+    uint8_t           *batch_buf;
+    size_t             batch_buf_len;
+    size_t             batch_buf_alloc;
+
+    /* Fields supporting entry read-ahead */
+    H5C_read_ahead_t *read_ahead;
+    size_t            num_read_ahead;
+    size_t            num_read_ahead_left;
+
+    /* Fields supporting the working set cache size increase mode */
+    H5SL_t         *ws_ghost_slist;
+    H5C_ws_ghost_t *ws_ghost_head;
+    H5C_ws_ghost_t *ws_ghost_tail;
+    size_t          ws_ghost_size;
+    uint64_t        ws_evicted_bytes;
+    int64_t         ws_ghost_hits[H5C__WS_NUM_BINS];
+    uint64_t        ws_epoch;
+    size_t          ws_epoch_size;
+    uint64_t        ws_epoch_load_time;
+    double          ws_target_latency;
+
+    /* Fields collecting miss statistics by entry type */
+    int64_t  type_misses[H5C__MAX_NUM_TYPE_IDS + 1];
+    uint64_t type_load_time[H5C__MAX_NUM_TYPE_IDS + 1];
+
 #if H5C_COLLECT_CACHE_STATS
     /* stats fields */
     int64_t hits[H5C__MAX_NUM_TYPE_IDS + 1];
@@ -3120,11 +3461,24 @@ H5_DLL herr_t H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr, un
 H5_DLL herr_t H5C__generate_cache_image(H5F_t *f, H5C_t *cache_ptr);
 H5_DLL herr_t H5C__load_cache_image(H5F_t *f);
 H5_DLL herr_t H5C__make_space_in_cache(H5F_t *f, size_t space_needed, bool write_permitted);
+H5_DLL herr_t H5C__resize_index(H5C_t *cache_ptr);
 H5_DLL herr_t H5C__serialize_cache(H5F_t *f);
 H5_DLL herr_t H5C__serialize_single_entry(H5F_t *f, H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr);
 H5_DLL herr_t H5C__iter_tagged_entries(H5C_t *cache, haddr_t tag, bool match_global, H5C_tag_iter_cb_t cb,
                                        void *cb_ctx);
 
+/* Routines for batching entry writes */
+H5_DLL herr_t H5C__begin_write_batch(H5F_t *f, H5C_t *cache_ptr);
+H5_DLL herr_t H5C__add_to_write_batch(H5F_t *f, H5C_t *cache_ptr, H5FD_mem_t type, haddr_t addr, size_t size,
+                                      const void *buf);
+H5_DLL herr_t H5C__write_batch(H5F_t *f, H5C_t *cache_ptr);
+H5_DLL herr_t H5C__end_write_batch(H5F_t *f, H5C_t *cache_ptr, bool write);
+
+/* Routines supporting the working set cache size increase mode */
+H5_DLL herr_t H5C__ws_record_eviction(H5C_t *cache_ptr, const H5C_cache_entry_t *entry_ptr);
+H5_DLL herr_t H5C__ws_record_load(H5C_t *cache_ptr, haddr_t addr);
+H5_DLL herr_t H5C__ws_discard_ghosts(H5C_t *cache_ptr);
+
 /* Routines for operating on entry tags */
 H5_DLL herr_t H5C__tag_entry(H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr);
 H5_DLL herr_t H5C__untag_entry(H5C_t *cache, H5C_cache_entry_t *entry);
@@ -3132,6 +3486,9 @@ H5_DLL herr_t H5C__untag_entry(H5C_t *cache, H5C_cache_entry_t *entry);
 /* Routines for operating on cache images */
 H5_DLL herr_t H5C__get_cache_image_config(const H5C_t *cache_ptr, H5C_cache_image_ctl_t *config_ptr);
 H5_DLL herr_t H5C__image_stats(H5C_t *cache_ptr, bool print_header);
+H5_DLL herr_t H5C__load_lazy_image_entry(H5F_t *f, H5C_t *cache_ptr, haddr_t addr,
+                                         H5C_cache_entry_t **entry_ptr_ptr);
+H5_DLL herr_t H5C__free_lazy_image_entries(H5C_t *cache_ptr);
 
 /* Debugging routines */
 #ifdef H5C_DO_SLIST_SANITY_CHECKS
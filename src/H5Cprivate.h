@@ -59,6 +59,7 @@
 /* Flags for cache client class behavior */
 #define H5C__CLASS_NO_FLAGS_SET          ((unsigned)0x0)
 #define H5C__CLASS_SPECULATIVE_LOAD_FLAG ((unsigned)0x1)
+#define H5C__CLASS_TRAILING_CHKSUM_FLAG  ((unsigned)0x8)
 /* The following flags may only appear in test code */
 #define H5C__CLASS_SKIP_READS  ((unsigned)0x2)
 #define H5C__CLASS_SKIP_WRITES ((unsigned)0x4)
@@ -71,10 +72,9 @@
 /* Upper and lower limits on cache size.  These limits are picked
  * out of a hat -- you should be able to change them as necessary.
  *
- * However, if you need a very big cache, you should also increase the
- * size of the hash table (H5C__HASH_TABLE_LEN in H5Cpkg.h).  The current
- * upper bound on cache size is rather large for the current hash table
- * size.
+ * The cache's hash table grows with the number of entries it holds, up to
+ * H5C__HASH_TABLE_MAX_LEN buckets (in H5Cpkg.h), which is ample for any
+ * cache within these limits.
  */
 #define H5C__MAX_MAX_CACHE_SIZE ((size_t)(128 * 1024 * 1024))
 #define H5C__MIN_MAX_CACHE_SIZE ((size_t)(1024))
@@ -303,6 +303,13 @@ typedef struct H5C_t H5C_t;
  *        read past the end of file, the size is truncated to
  *        avoid this, and processing proceeds as normal.
  *
+ *    H5C__CLASS_TRAILING_CHKSUM_FLAG: When this flag is set, an
+ *        image that ends with the metadata checksum of the rest of
+ *        the image is known to pass the verify_chksum callback.  The
+ *        checksums of images read ahead with H5C_read_ahead() are
+ *        then computed together, and the callback is only made for
+ *        the images whose checksums don't match.
+ *
  *      The following flags may only appear in test code.
  *
  *    H5C__CLASS_SKIP_READS: This flags is intended only for use in test
@@ -1513,6 +1520,16 @@ typedef int H5C_ring_t;
  *              an object.  NULL for untagged entries.
  *
  *
+ * Field supporting the working set cache size increase mode:
+ *
+ * ws_epoch:    Number of the last epoch in which the entry was protected,
+ *              or zero if it hasn't been protected since the entry was
+ *              loaded or inserted.  This lets the cache count each entry
+ *              only once when totaling the size of the entries used in an
+ *              epoch.  See the discussion of the working set fields in
+ *              H5Cpkg.h for details.
+ *
+ *
  * Cache entry stats collection fields:
  *
  * These fields should only be compiled in when both H5C_COLLECT_CACHE_STATS
@@ -1609,6 +1626,9 @@ typedef struct H5C_cache_entry_t {
     struct H5C_cache_entry_t *tl_prev;
     struct H5C_tag_info_t    *tag_info;
 
+    /* field supporting the working set cache size increase mode */
+    uint64_t ws_epoch;
+
 #if H5C_COLLECT_CACHE_ENTRY_STATS
     /* cache entry stats fields */
     int32_t accesses;
@@ -1826,7 +1846,7 @@ typedef struct H5C_image_entry_t {
  *
  * incr_mode: Instance of the H5C_cache_incr_mode enumerated type whose
  *    value indicates how we determine whether the cache size should be
- *    increased.  At present there are two possible values:
+ *    increased.  At present there are three possible values:
  *
  *    H5C_incr__off:    Don't attempt to increase the size of the cache
  *        automatically.
@@ -1843,6 +1863,12 @@ typedef struct H5C_image_entry_t {
  *        at its maximum size, or if the cache is not already using
  *        all available space.
  *
+ *    H5C_incr__working_set: Set the size of the cache from an estimate
+ *        of the working set made at the end of each epoch, growing or
+ *        shrinking the cache as needed.  See the discussion of the
+ *        working set fields of H5C_t in H5Cpkg.h.  decr_mode must be
+ *        H5C_decr__off when this mode is selected.
+ *
  * lower_hr_threshold: Lower hit rate threshold.  If the increment mode
  *       (incr_mode) is H5C_incr__threshold and the hit rate drops below the
  *       value supplied in this field in an epoch, increment the cache size by
@@ -2110,6 +2136,11 @@ typedef struct H5C_auto_size_ctl_t {
  *    with the full implementation.  In normal operation, all flags should
  *    be set.
  *
+ * compression_level: Deflate level used to compress the entries section
+ *    of the cache image, or zero if the image is written uncompressed.
+ *    The image is also written uncompressed if the deflate filter is
+ *    not available, or if compression doesn't make the image smaller.
+ *
  ****************************************************************************/
 
 #define H5C_CI__GEN_MDCI_SBE_MESG    ((unsigned)0x0001)
@@ -2129,7 +2160,8 @@ typedef struct H5C_auto_size_ctl_t {
             false,                                 /* = generate_image */                                    \
             false,                                 /* = save_resize_status */                                \
             H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE, /* = entry_ageout */                                      \
-            H5C_CI__ALL_FLAGS                      /* = flags */                                             \
+            H5C_CI__ALL_FLAGS,                     /* = flags */                                             \
+            0                                      /* = compression_level */                                 \
     }
 
 typedef struct H5C_cache_image_ctl_t {
@@ -2138,10 +2170,77 @@ typedef struct H5C_cache_image_ctl_t {
     bool     save_resize_status;
     int32_t  entry_ageout;
     unsigned flags;
+    unsigned compression_level;
 } H5C_cache_image_ctl_t;
 
 /* The cache logging output style */
-typedef enum H5C_log_style_t { H5C_LOG_STYLE_JSON, H5C_LOG_STYLE_TRACE } H5C_log_style_t;
+typedef enum H5C_log_style_t {
+    H5C_LOG_STYLE_JSON,  /* Human-readable JSON log, one message per line      */
+    H5C_LOG_STYLE_TRACE, /* Trace file for the cache replay tests              */
+    H5C_LOG_STYLE_BINARY /* Buffered fixed-size records, converted by h5mdclog */
+} H5C_log_style_t;
+
+/* The actions recorded in a binary cache log.
+ *
+ * These values are stored in the log file, so new actions must only be
+ * added immediately before H5C_LOG_ACTION_NTYPES.
+ */
+typedef enum H5C_log_action_t {
+    H5C_LOG_ACTION_START,        /* Logging started                  */
+    H5C_LOG_ACTION_STOP,         /* Logging stopped                  */
+    H5C_LOG_ACTION_CREATE,       /* Cache created                    */
+    H5C_LOG_ACTION_DESTROY,      /* Cache destroyed                  */
+    H5C_LOG_ACTION_EVICT,        /* Cache evicted                    */
+    H5C_LOG_ACTION_EXPUNGE,      /* Entry expunged                   */
+    H5C_LOG_ACTION_FLUSH,        /* Entry flushed                    */
+    H5C_LOG_ACTION_INSERT,       /* Entry inserted                   */
+    H5C_LOG_ACTION_DIRTY,        /* Entry marked dirty               */
+    H5C_LOG_ACTION_CLEAN,        /* Entry marked clean               */
+    H5C_LOG_ACTION_UNSERIALIZED, /* Entry marked unserialized        */
+    H5C_LOG_ACTION_SERIALIZED,   /* Entry marked serialized          */
+    H5C_LOG_ACTION_MOVE,         /* Entry moved                      */
+    H5C_LOG_ACTION_PIN,          /* Entry pinned                     */
+    H5C_LOG_ACTION_CREATE_FD,    /* Flush dependency created         */
+    H5C_LOG_ACTION_PROTECT,      /* Entry protected                  */
+    H5C_LOG_ACTION_RESIZE,       /* Entry resized                    */
+    H5C_LOG_ACTION_UNPIN,        /* Entry unpinned                   */
+    H5C_LOG_ACTION_DESTROY_FD,   /* Flush dependency destroyed       */
+    H5C_LOG_ACTION_UNPROTECT,    /* Entry unprotected                */
+    H5C_LOG_ACTION_SET_CONFIG,   /* Cache configuration set          */
+    H5C_LOG_ACTION_REMOVE,       /* Entry removed                    */
+    H5C_LOG_ACTION_NTYPES        /* Number of actions (must be last) */
+} H5C_log_action_t;
+
+/* Binary cache log file format
+ *
+ * The file starts with a header of H5C_LOG_BINARY_HEADER_SIZE bytes:
+ *
+ *      signature       8 bytes     H5C_LOG_BINARY_SIGNATURE
+ *      version         uint32      H5C_LOG_BINARY_VERSION
+ *      record size     uint32      H5C_LOG_BINARY_RECORD_SIZE
+ *      MPI rank        int32       -1 for serial logs
+ *      reserved        uint32      0
+ *      start time      uint64      microseconds since the epoch
+ *
+ * and is followed by records of H5C_LOG_BINARY_RECORD_SIZE bytes:
+ *
+ *      timestamp       uint64      microseconds since the start time
+ *      address         uint64      entry or parent address
+ *      address 2       uint64      new or child address
+ *      size            uint64      entry size
+ *      flags           uint32      action-specific flags
+ *      type id         int16       entry type, -1 if not applicable
+ *      action          uint8       H5C_log_action_t
+ *      returned        int8        return value of the logged operation
+ *
+ * All values are little-endian.  Fields that do not apply to an action
+ * are HADDR_UNDEF (addresses) or 0.
+ */
+#define H5C_LOG_BINARY_SIGNATURE     "HDF5CLOG"
+#define H5C_LOG_BINARY_SIGNATURE_LEN 8
+#define H5C_LOG_BINARY_VERSION       1
+#define H5C_LOG_BINARY_HEADER_SIZE   32
+#define H5C_LOG_BINARY_RECORD_SIZE   40
 
 /***************************************/
 /* Library-private Function Prototypes */
@@ -2172,6 +2271,8 @@ H5_DLL herr_t H5C_get_cache_size(const H5C_t *cache_ptr, size_t *max_size_ptr, s
                                  size_t *cur_size_ptr, uint32_t *cur_num_entries_ptr);
 H5_DLL herr_t H5C_get_cache_flush_in_progress(const H5C_t *cache_ptr, bool *flush_in_progress_ptr);
 H5_DLL herr_t H5C_get_cache_hit_rate(const H5C_t *cache_ptr, double *hit_rate_ptr);
+H5_DLL herr_t H5C_get_cache_type_stats(const H5C_t *cache_ptr, size_t ntypes, H5F_mdc_type_stats_t *stats,
+                                       size_t *total_ntypes);
 H5_DLL herr_t H5C_get_entry_status(const H5F_t *f, haddr_t addr, size_t *size_ptr, bool *in_cache_ptr,
                                    bool *is_dirty_ptr, bool *is_protected_ptr, bool *is_pinned_ptr,
                                    bool *is_corked_ptr, bool *is_flush_dep_parent_ptr,
@@ -2190,9 +2291,13 @@ H5_DLL herr_t H5C_pin_protected_entry(void *thing);
 H5_DLL herr_t H5C_prep_for_file_close(H5F_t *f);
 H5_DLL herr_t H5C_create_flush_dependency(void *parent_thing, void *child_thing);
 H5_DLL void  *H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsigned flags);
+H5_DLL herr_t H5C_read_ahead(H5F_t *f, const H5C_class_t *type, size_t count, const haddr_t addrs[],
+                             const size_t lens[]);
+H5_DLL herr_t H5C_discard_read_ahead(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_reset_cache_hit_rate_stats(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_resize_entry(void *thing, size_t new_size);
 H5_DLL herr_t H5C_set_cache_auto_resize_config(H5C_t *cache_ptr, H5C_auto_size_ctl_t *config_ptr);
+H5_DLL herr_t H5C_set_cache_miss_latency_target(H5C_t *cache_ptr, double target);
 H5_DLL herr_t H5C_set_cache_image_config(const H5F_t *f, H5C_t *cache_ptr, H5C_cache_image_ctl_t *config_ptr);
 H5_DLL herr_t H5C_set_evictions_enabled(H5C_t *cache_ptr, bool evictions_enabled);
 H5_DLL herr_t H5C_set_slist_enabled(H5C_t *cache_ptr, bool slist_enabled, bool populate_slist);
@@ -27,8 +27,12 @@ enum H5C_cache_incr_mode {
     H5C_incr__off,
     /**<Automatic cache size increase is disabled, and the remaining increment fields are ignored.*/
 
-    H5C_incr__threshold
+    H5C_incr__threshold,
     /**<Automatic cache size increase is enabled using the hit rate threshold algorithm.*/
+
+    H5C_incr__working_set
+    /**<Automatic cache size increase and decrease are enabled using the working set algorithm.
+     * \since 2.0.0 */
 };
 
 enum H5C_cache_flash_incr_mode {
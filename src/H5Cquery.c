@@ -195,6 +195,46 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_get_cache_hit_rate() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5C_get_cache_type_stats
+ *
+ * Purpose:     Report the number of misses and the time spent loading
+ *              entries for each type of entry in the cache, since the
+ *              cache was created.  Statistics for up to ntypes types are
+ *              copied into stats, and the number of types is returned in
+ *              *total_ntypes.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_get_cache_type_stats(const H5C_t *cache_ptr, size_t ntypes, H5F_mdc_type_stats_t *stats,
+                         size_t *total_ntypes)
+{
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if (cache_ptr == NULL)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr on entry.");
+    if (total_ntypes == NULL)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad total_ntypes on entry.");
+
+    *total_ntypes = (size_t)cache_ptr->max_type_id + 1;
+
+    if (stats)
+        for (u = 0; u < ntypes && u < *total_ntypes; u++) {
+            stats[u].name      = cache_ptr->class_table_ptr[u]->name;
+            stats[u].misses    = (uint64_t)cache_ptr->type_misses[u];
+            stats[u].load_time = (double)cache_ptr->type_load_time[u] / 1.0E6;
+        } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_get_cache_type_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5C_get_entry_status
  *
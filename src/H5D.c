@@ -915,6 +915,52 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dget_offset() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_view
+ *
+ * Purpose:     Returns a read-only pointer to the raw data of a dataset
+ *              where the file driver holds it in memory, so that it can
+ *              be used without being copied.  *BUF is set to NULL if the
+ *              data can't be accessed that way.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_view(hid_t dset_id, hid_t mem_type_id, const void **buf /*out*/)
+{
+    H5VL_object_t                      *vol_obj;             /* Dataset for this operation   */
+    H5VL_optional_args_t                vol_cb_args;         /* Arguments to VOL callback */
+    H5VL_native_dataset_optional_args_t dset_opt_args;       /* Arguments for optional operation */
+    herr_t                              ret_value = SUCCEED; /* Return value                 */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Check args */
+    if (NULL == (vol_obj = H5VL_vol_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset identifier");
+    if (H5I_DATATYPE != H5I_get_type(mem_type_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "mem_type_id is not a datatype ID");
+    if (NULL == buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf parameter can't be NULL");
+
+    *buf = NULL;
+
+    /* Set up VOL callback arguments */
+    dset_opt_args.read_view.type_id = mem_type_id;
+    dset_opt_args.read_view.buf     = buf;
+    vol_cb_args.op_type             = H5VL_NATIVE_DATASET_READ_VIEW;
+    vol_cb_args.args                = &dset_opt_args;
+
+    /* Get the view */
+    if (H5VL_dataset_optional(vol_obj, &vol_cb_args, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get view of dataset's data");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_view() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__read_api_common
  *
@@ -57,6 +57,7 @@
 #include "H5MFprivate.h" /* File memory management                   */
 #include "H5PBprivate.h" /* Page Buffer	                             */
 #include "H5SLprivate.h" /* Skip Lists                               */
+#include "H5TSprivate.h" /* Threadsafety                             */
 #include "H5VMprivate.h" /* Vector and array functions               */
 
 /****************/
@@ -304,8 +305,19 @@ static herr_t   H5D__piece_mem_cb(void *elem, const H5T_t *type, unsigned ndims,
                                   void *_opdata);
 static herr_t   H5D__chunk_may_use_select_io(H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset_info);
 static unsigned H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled);
+static htri_t   H5D__chunk_is_fill(const H5D_t *dset, const void *chunk);
+static htri_t   H5D__chunk_write_skip_fill(const H5D_dset_io_info_t *dset_info,
+                                           const H5D_piece_info_t *chunk_info, haddr_t chunk_addr);
+static herr_t   H5D__chunk_remove(const H5D_t *dset, const hsize_t *scaled);
 static herr_t   H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, bool reset);
 static herr_t   H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, bool flush);
+static herr_t   H5D__chunk_read_image(const H5D_t *dset, haddr_t chunk_addr, const H5O_pline_t *pline,
+                                      const H5Z_func_t *filters, H5Z_EDC_t err_detect, H5Z_cb_t filter_cb,
+                                      unsigned *filter_mask, size_t *chunk_alloc, size_t *buf_alloc,
+                                      void **chunk);
+#ifdef H5_HAVE_THREADSAFE_API
+static bool H5D__chunk_concurrent_read(const H5D_t *dset, const H5O_pline_t *pline);
+#endif /* H5_HAVE_THREADSAFE_API */
 static void    *H5D__chunk_lock(const H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset_info,
                                 H5D_chunk_ud_t *udata, bool relax, bool prev_unfilt_chunk);
 static herr_t   H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset_info,
@@ -356,9 +368,6 @@ H5FL_SEQ_DEFINE_STATIC(H5D_rdcc_ent_ptr_t);
 /* Declare a free list to manage H5D_rdcc_ent_t objects */
 H5FL_DEFINE_STATIC(H5D_rdcc_ent_t);
 
-/* Declare a free list to manage the H5D_chunk_info_t struct */
-H5FL_DEFINE_STATIC(H5D_chunk_map_t);
-
 /* Declare a free list to manage the H5D_piece_info_t struct */
 H5FL_DEFINE(H5D_piece_info_t);
 
@@ -919,6 +928,13 @@ H5D__chunk_init(H5F_t *f, const H5D_t *const dset, hid_t dapl_id)
     if (rdcc->w0 < 0)
         rdcc->w0 = H5F_RDCC_W0(f);
 
+    /* Check whether to leave chunks of fill values unallocated.  Allocating
+     * and removing chunks must be collective with parallel file drivers. */
+    if (H5P_get(dapl, H5D_ACS_SKIP_FILL_CHUNKS_NAME, &rdcc->skip_fill) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get skip fill chunks setting");
+    if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        rdcc->skip_fill = false;
+
     /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
     if (!rdcc->nbytes_max || !rdcc->nslots)
         rdcc->nbytes_max = rdcc->nslots = 0;
@@ -1054,7 +1070,8 @@ H5D__chunk_io_init(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo)
     FUNC_ENTER_PACKAGE
 
     /* Allocate chunk map */
-    if (NULL == (dinfo->layout_io_info.chunk_map = H5FL_MALLOC(H5D_chunk_map_t)))
+    if (NULL == (dinfo->layout_io_info.chunk_map =
+                     (H5D_chunk_map_t *)H5D__io_arena_malloc(io_info, sizeof(H5D_chunk_map_t))))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk map");
     fm = dinfo->layout_io_info.chunk_map;
 
@@ -1071,6 +1088,15 @@ H5D__chunk_io_init(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo)
     fm->single_space      = NULL;
     fm->single_piece_info = NULL;
 
+    /* The selection structures cached in the dataset can't be shared when
+     * other threads may read the dataset while this I/O is in progress
+     * (see H5D__chunk_lock), so build private ones in that case */
+#ifdef H5_HAVE_THREADSAFE_API
+    fm->private_sel = H5F_concurrent_raw_read(dataset->oloc.file);
+#else
+    fm->private_sel = false;
+#endif /* H5_HAVE_THREADSAFE_API */
+
     /* Initialize selection type in memory and file */
     fm->msel_type = H5S_SEL_ERROR;
     fm->fsel_type = H5S_SEL_ERROR;
@@ -1215,32 +1241,52 @@ H5D__chunk_io_init_selections(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo)
         && !(io_info->using_mpi_vfd)
 #endif /* H5_HAVE_PARALLEL */
         && H5S_SEL_ALL != H5S_GET_SELECT_TYPE(dinfo->file_space)) {
+        H5S_t            **single_space;      /* Location of single chunk dataspace */
+        H5D_piece_info_t **single_piece_info; /* Location of single chunk's info */
+
         /* Initialize skip list for chunk selections */
         fm->use_single = true;
 
+        /* Use the single chunk information cached in the dataset, unless
+         * this I/O needs its own */
+        if (fm->private_sel) {
+            single_space      = &fm->single_space;
+            single_piece_info = &fm->single_piece_info;
+        } /* end if */
+        else {
+            single_space      = &dataset->shared->cache.chunk.single_space;
+            single_piece_info = &dataset->shared->cache.chunk.single_piece_info;
+        } /* end else */
+
         /* Initialize single chunk dataspace */
-        if (NULL == dataset->shared->cache.chunk.single_space) {
+        if (NULL == *single_space) {
             /* Make a copy of the dataspace for the dataset */
-            if ((dataset->shared->cache.chunk.single_space = H5S_copy(dinfo->file_space, true, false)) ==
-                NULL)
+            if ((*single_space = H5S_copy(dinfo->file_space, true, false)) == NULL)
                 HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file space");
 
             /* Resize chunk's dataspace dimensions to size of chunk */
-            if (H5S_set_extent_real(dataset->shared->cache.chunk.single_space, fm->chunk_dim) < 0)
+            if (H5S_set_extent_real(*single_space, fm->chunk_dim) < 0)
                 HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't adjust chunk dimensions");
 
             /* Set the single chunk dataspace to 'all' selection */
-            if (H5S_select_all(dataset->shared->cache.chunk.single_space, true) < 0)
+            if (H5S_select_all(*single_space, true) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to set all selection");
         } /* end if */
-        fm->single_space = dataset->shared->cache.chunk.single_space;
+        fm->single_space = *single_space;
         assert(fm->single_space);
 
-        /* Allocate the single chunk information */
-        if (NULL == dataset->shared->cache.chunk.single_piece_info)
-            if (NULL == (dataset->shared->cache.chunk.single_piece_info = H5FL_MALLOC(H5D_piece_info_t)))
+        /* Allocate the single chunk information.  Private information only
+         * lives as long as this I/O, so it comes from the operation's arena. */
+        if (NULL == *single_piece_info) {
+            if (fm->private_sel)
+                *single_piece_info =
+                    (H5D_piece_info_t *)H5D__io_arena_malloc(io_info, sizeof(H5D_piece_info_t));
+            else
+                *single_piece_info = H5FL_MALLOC(H5D_piece_info_t);
+            if (NULL == *single_piece_info)
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info");
-        fm->single_piece_info = dataset->shared->cache.chunk.single_piece_info;
+        } /* end if */
+        fm->single_piece_info = *single_piece_info;
         assert(fm->single_piece_info);
 
         /* Reset chunk template information */
@@ -1255,10 +1301,17 @@ H5D__chunk_io_init_selections(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo)
         bool sel_hyper_flag; /* Whether file selection is a hyperslab */
 
         /* Initialize skip list for chunk selections */
-        if (NULL == dataset->shared->cache.chunk.sel_chunks)
-            if (NULL == (dataset->shared->cache.chunk.sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
+        if (fm->private_sel) {
+            if (NULL == (fm->dset_sel_pieces = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for chunk selections");
-        fm->dset_sel_pieces = dataset->shared->cache.chunk.sel_chunks;
+        } /* end if */
+        else {
+            if (NULL == dataset->shared->cache.chunk.sel_chunks)
+                if (NULL == (dataset->shared->cache.chunk.sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL,
+                                "can't create skip list for chunk selections");
+            fm->dset_sel_pieces = dataset->shared->cache.chunk.sel_chunks;
+        } /* end else */
         assert(fm->dset_sel_pieces);
 
         /* We are not using single element mode */
@@ -1495,7 +1548,9 @@ H5D__chunk_mem_realloc(void *chk, size_t size, const H5O_pline_t *pline)
  RETURNS
     Non-negative on success, negative on failure
  DESCRIPTION
-    Releases all the memory for a chunk info node.  Called by H5SL_free
+    Releases the dataspaces of a chunk info node.  The node itself is
+    allocated from the I/O operation's arena and released with it.
+    Called by H5SL_free
  GLOBAL VARIABLES
  COMMENTS, BUGS, ASSUMPTIONS
  EXAMPLES
@@ -1516,13 +1571,12 @@ H5D__free_piece_info(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *
     else
         H5S_select_all(piece_info->fspace, true);
 
-    /* Close the piece's memory dataspace, if it's not shared */
+    /* Close the piece's memory dataspace, if it's not shared.  The piece
+     * info itself belongs to the I/O operation's arena and is released
+     * with it. */
     if (!piece_info->mspace_shared && piece_info->mspace)
         (void)H5S_close((H5S_t *)piece_info->mspace);
 
-    /* Free the actual piece info */
-    piece_info = H5FL_FREE(H5D_piece_info_t, piece_info);
-
     FUNC_LEAVE_NOAPI(0)
 } /* H5D__free_piece_info() */
 
@@ -1707,7 +1761,8 @@ H5D__create_piece_file_map_all(H5D_dset_io_info_t *di, H5D_io_info_t *io_info)
         /* Add temporary chunk to the list of pieces */
 
         /* Allocate the file & memory chunk information */
-        if (NULL == (new_piece_info = H5FL_MALLOC(H5D_piece_info_t)))
+        if (NULL == (new_piece_info =
+                         (H5D_piece_info_t *)H5D__io_arena_malloc(io_info, sizeof(H5D_piece_info_t))))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate piece info");
 
         /* Initialize the chunk information */
@@ -1918,7 +1973,8 @@ H5D__create_piece_file_map_hyper(H5D_dset_io_info_t *dinfo, H5D_io_info_t *io_in
             /* Add temporary chunk to the list of chunks */
 
             /* Allocate the file & memory chunk information */
-            if (NULL == (new_piece_info = H5FL_MALLOC(H5D_piece_info_t)))
+            if (NULL == (new_piece_info =
+                             (H5D_piece_info_t *)H5D__io_arena_malloc(io_info, sizeof(H5D_piece_info_t))))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk info");
 
             /* Initialize the chunk information */
@@ -2279,7 +2335,8 @@ H5D__piece_file_cb(void H5_ATTR_UNUSED *elem, const H5T_t H5_ATTR_UNUSED *type,
             H5S_t *fspace; /* Memory chunk's dataspace */
 
             /* Allocate the file & memory chunk information */
-            if (NULL == (piece_info = H5FL_MALLOC(H5D_piece_info_t)))
+            if (NULL == (piece_info =
+                             (H5D_piece_info_t *)H5D__io_arena_malloc(io_info, sizeof(H5D_piece_info_t))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info");
 
             /* Initialize the chunk information */
@@ -2288,15 +2345,12 @@ H5D__piece_file_cb(void H5_ATTR_UNUSED *elem, const H5T_t H5_ATTR_UNUSED *type,
             piece_info->index = chunk_index;
 
             /* Create a dataspace for the chunk */
-            if ((fspace = H5S_create_simple(fm->f_ndims, fm->chunk_dim, NULL)) == NULL) {
-                piece_info = H5FL_FREE(H5D_piece_info_t, piece_info);
+            if ((fspace = H5S_create_simple(fm->f_ndims, fm->chunk_dim, NULL)) == NULL)
                 HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "unable to create dataspace for chunk");
-            } /* end if */
 
             /* De-select the chunk space */
             if (H5S_select_none(fspace) < 0) {
                 (void)H5S_close(fspace);
-                piece_info = H5FL_FREE(H5D_piece_info_t, piece_info);
                 HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to de-select dataspace");
             } /* end if */
 
@@ -2620,7 +2674,7 @@ H5D__chunk_may_use_select_io(H5D_io_info_t *io_info, const H5D_dset_io_info_t *d
         if (H5PB_enabled(io_info->f_sh, H5FD_MEM_DRAW, &page_buf_enabled) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check if page buffer is enabled");
         if (page_buf_enabled) {
-            /* Note that page buffer is disabled in parallel */
+            /* Note that in parallel, raw data is only page buffered for read-only files */
             io_info->use_select_io = H5D_SELECTION_IO_MODE_OFF;
             io_info->no_selection_io_cause |= H5D_SEL_IO_PAGE_BUFFER;
         }
@@ -3109,6 +3163,22 @@ H5D__chunk_write(H5D_io_info_t *io_info, H5D_dset_io_info_t *dset_info)
             /* Determine if we should use the chunk cache */
             if ((cacheable = H5D__chunk_cacheable(io_info, dset_info, udata.chunk_block.offset, true)) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable");
+
+            /* Skip writing (or allocating) a chunk of nothing but fill
+             * values directly from the buffer, removing it from the file
+             * if it's there */
+            if (!cacheable) {
+                htri_t skipped; /* Whether the chunk write was skipped */
+
+                if ((skipped = H5D__chunk_write_skip_fill(dset_info, chunk_info,
+                                                          udata.chunk_block.offset)) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTDELETE, FAIL, "unable to skip chunk of fill values");
+                if (skipped) {
+                    /* Advance to next chunk in list */
+                    chunk_node = H5D_CHUNK_GET_NEXT_NODE(dset_info, chunk_node);
+                    continue;
+                } /* end if */
+            }     /* end if */
             if (cacheable) {
                 /* Load the chunk into cache.  But if the whole chunk is written,
                  * simply allocate space instead of load the chunk. */
@@ -3279,6 +3349,22 @@ H5D__chunk_write(H5D_io_info_t *io_info, H5D_dset_io_info_t *dset_info)
             /* Determine if we should use the chunk cache */
             if ((cacheable = H5D__chunk_cacheable(io_info, dset_info, udata.chunk_block.offset, true)) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable");
+
+            /* Skip writing (or allocating) a chunk of nothing but fill
+             * values directly from the buffer, removing it from the file
+             * if it's there */
+            if (!cacheable) {
+                htri_t skipped; /* Whether the chunk write was skipped */
+
+                if ((skipped = H5D__chunk_write_skip_fill(dset_info, chunk_info,
+                                                          udata.chunk_block.offset)) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTDELETE, FAIL, "unable to skip chunk of fill values");
+                if (skipped) {
+                    /* Advance to next chunk in list */
+                    chunk_node = H5D_CHUNK_GET_NEXT_NODE(dset_info, chunk_node);
+                    continue;
+                } /* end if */
+            }     /* end if */
             if (cacheable) {
                 /* Load the chunk into cache.  But if the whole chunk is written,
                  * simply allocate space instead of load the chunk. */
@@ -3452,12 +3538,21 @@ H5D__chunk_io_term(H5D_io_info_t H5_ATTR_UNUSED *io_info, H5D_dset_io_info_t *di
         /* Sanity checks */
         assert(fm->dset_sel_pieces == NULL);
         assert(fm->last_piece_info == NULL);
-        assert(fm->single_piece_info);
-        assert(fm->single_piece_info->fspace_shared);
-        assert(fm->single_piece_info->mspace_shared);
 
-        /* Reset the selection for the single element I/O */
-        H5S_select_all(fm->single_space, true);
+        /* Release the single chunk information if it belongs to this I/O,
+         * otherwise reset the selection for the next single element I/O */
+        if (fm->private_sel) {
+            if (fm->single_space && H5S_close(fm->single_space) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release single chunk dataspace");
+            fm->single_piece_info = NULL;
+        } /* end if */
+        else {
+            assert(fm->single_piece_info);
+            assert(fm->single_piece_info->fspace_shared);
+            assert(fm->single_piece_info->mspace_shared);
+
+            H5S_select_all(fm->single_space, true);
+        } /* end else */
     } /* end if */
     else {
         /* Release the nodes on the list of selected pieces, or the last (only)
@@ -3465,6 +3560,8 @@ H5D__chunk_io_term(H5D_io_info_t H5_ATTR_UNUSED *io_info, H5D_dset_io_info_t *di
         if (fm->dset_sel_pieces) {
             if (H5SL_free(fm->dset_sel_pieces, H5D__free_piece_info, NULL) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTNEXT, FAIL, "can't free dataset skip list");
+            if (fm->private_sel && H5SL_close(fm->dset_sel_pieces) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "can't close dataset skip list");
         } /* end if */
         else if (fm->last_piece_info) {
             if (H5D__free_piece_info(fm->last_piece_info, NULL, NULL) < 0)
@@ -3479,8 +3576,8 @@ H5D__chunk_io_term(H5D_io_info_t H5_ATTR_UNUSED *io_info, H5D_dset_io_info_t *di
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL,
                         "can't release memory chunk dataspace template");
 
-    /* Free chunk map */
-    di->layout_io_info.chunk_map = H5FL_FREE(H5D_chunk_map_t, di->layout_io_info.chunk_map);
+    /* The chunk map is released with the I/O operation's arena */
+    di->layout_io_info.chunk_map = NULL;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -3924,6 +4021,195 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_lookup() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_is_fill
+ *
+ * Purpose:     Check whether the data of a whole chunk is nothing but the
+ *              fill value, and can be left out of the file, when the
+ *              dataset leaves chunks of fill values unallocated.
+ *
+ *              Chunks can only be left out when reading them returns the
+ *              fill value, and they aren't all allocated up front.  The
+ *              comparison checks the first element against the fill
+ *              value, then the chunk against itself shifted by one
+ *              element, with one memcmp() over the whole chunk, which
+ *              stops at the first difference.
+ *
+ * Return:      true/false/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__chunk_is_fill(const H5D_t *dset, const void *chunk)
+{
+    const H5O_fill_t *fill = &dset->shared->dcpl_cache.fill; /* Fill value info */
+    const uint8_t    *buf  = (const uint8_t *)chunk;         /* Chunk data */
+    H5D_fill_value_t  fill_status;                           /* Fill value status */
+    size_t            chunk_size;                            /* Size of the chunk */
+    size_t            elmt_size;                             /* Size of an element */
+    htri_t            vlen;                                  /* Whether the datatype is variable-length */
+    htri_t            ret_value = false;                     /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(buf);
+
+    if (!dset->shared->cache.chunk.skip_fill)
+        HGOTO_DONE(false);
+
+    /* Check whether missing chunks read as the fill value */
+    if (fill->alloc_time != H5D_ALLOC_TIME_INCR || fill->fill_time == H5D_FILL_TIME_NEVER)
+        HGOTO_DONE(false);
+    if (H5P_is_fill_value_defined(fill, &fill_status) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined");
+    if (fill->fill_time == H5D_FILL_TIME_IFSET && fill_status != H5D_FILL_VALUE_USER_DEFINED &&
+        fill_status != H5D_FILL_VALUE_DEFAULT)
+        HGOTO_DONE(false);
+
+    /* Variable-length fill values are different objects in each element */
+    if ((vlen = H5T_detect_class(dset->shared->type, H5T_VLEN, false)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to detect variable-length datatype");
+    if (vlen)
+        HGOTO_DONE(false);
+
+    elmt_size  = H5T_GET_SIZE(dset->shared->type);
+    chunk_size = (size_t)dset->shared->layout.u.chunk.size;
+    assert(elmt_size > 0 && (chunk_size % elmt_size) == 0);
+
+    /* Compare the first element with the fill value */
+    if (fill->buf) {
+        if (fill->size != (ssize_t)elmt_size || memcmp(buf, fill->buf, elmt_size) != 0)
+            HGOTO_DONE(false);
+    } /* end if */
+    else {
+        size_t u; /* Local index variable */
+
+        for (u = 0; u < elmt_size; u++)
+            if (buf[u])
+                HGOTO_DONE(false);
+    } /* end else */
+
+    /* The other elements are all the same as the first when the chunk equals
+     * itself shifted by one element */
+    ret_value = (0 == memcmp(buf + elmt_size, buf, chunk_size - elmt_size));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_is_fill() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_write_skip_fill
+ *
+ * Purpose:     Check whether a write of a chunk at CHUNK_ADDR in the file,
+ *              directly from the application's buffer, writes nothing but
+ *              the fill value to the whole chunk, and if so remove the
+ *              chunk, if it is allocated, so that the write (and the
+ *              allocation of a chunk that isn't) can be skipped.  Only
+ *              chunks written whole from one contiguous block of the
+ *              buffer, without datatype conversion or a data transform,
+ *              are checked.
+ *
+ * Return:      true if the write can be skipped/false/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__chunk_write_skip_fill(const H5D_dset_io_info_t *dset_info, const H5D_piece_info_t *chunk_info,
+                           haddr_t chunk_addr)
+{
+    const H5D_t    *dset      = dset_info->dset; /* Dataset written */
+    H5S_sel_iter_t *mem_iter  = NULL;            /* Memory selection iteration info */
+    bool            iter_init = false;           /* Whether the iterator was initialized */
+    size_t          nseq;                        /* # of sequences in the memory selection */
+    size_t          nelem;                       /* # of elements in the sequence */
+    hsize_t         off;                         /* Offset of the sequence in the buffer */
+    size_t          len;                         /* Length of the sequence */
+    htri_t          ret_value = false;           /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (!dset->shared->cache.chunk.skip_fill)
+        HGOTO_DONE(false);
+
+    /* Check that the whole chunk is written as it is in the buffer */
+    if (!dset_info->type_info.is_conv_noop || !dset_info->type_info.is_xform_noop ||
+        dset_info->layout_io_info.chunk_map->fsel_type == H5S_SEL_POINTS ||
+        (chunk_info->piece_points * dset_info->type_info.dst_type_size) != dset->shared->layout.u.chunk.size)
+        HGOTO_DONE(false);
+
+    /* Find the chunk's data in the buffer */
+    if (NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory selection iterator");
+    if (H5S_select_iter_init(mem_iter, chunk_info->mspace, dset_info->type_info.dst_type_size, 0) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize memory selection information");
+    iter_init = true;
+    if (H5S_SELECT_ITER_GET_SEQ_LIST(mem_iter, (size_t)1, chunk_info->piece_points, &nseq, &nelem, &off,
+                                     &len) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "sequence length generation failed");
+
+    if (nseq == 1 && len == dset->shared->layout.u.chunk.size)
+        if ((ret_value = H5D__chunk_is_fill(dset, (const uint8_t *)dset_info->buf.cvp + off)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "unable to compare chunk with fill value");
+
+    /* Chunks that aren't in the file yet are simply left unallocated */
+    if (ret_value && H5_addr_defined(chunk_addr) && H5D__chunk_remove(dset, chunk_info->scaled) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTDELETE, FAIL, "unable to remove chunk of fill values");
+
+done:
+    if (iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release selection iterator");
+    if (mem_iter)
+        mem_iter = H5FL_FREE(H5S_sel_iter_t, mem_iter);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_write_skip_fill() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_remove
+ *
+ * Purpose:     Remove a chunk from the chunk index and free its space in
+ *              the file, leaving it unallocated.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_remove(const H5D_t *dset, const hsize_t *scaled)
+{
+    H5D_chk_idx_info_t    idx_info;                                        /* Chunked index info */
+    H5D_chunk_common_ud_t idx_udata;                                       /* User data for index */
+    H5O_storage_chunk_t  *sc        = &(dset->shared->layout.storage.u.chunk); /* Chunk storage */
+    herr_t                ret_value = SUCCEED;                             /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Compose chunked index info struct */
+    idx_info.f       = dset->oloc.file;
+    idx_info.pline   = &dset->shared->dcpl_cache.pline;
+    idx_info.layout  = &dset->shared->layout.u.chunk;
+    idx_info.storage = sc;
+
+    /* Set up user data for the index callback */
+    idx_udata.layout  = &dset->shared->layout.u.chunk;
+    idx_udata.storage = sc;
+    idx_udata.scaled  = scaled;
+
+    /* Remove the chunk from the index, and from the file */
+    if ((sc->ops->remove)(&idx_info, &idx_udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTDELETE, FAIL, "unable to remove chunk entry from index");
+
+    /* The cached info about the last chunk looked up may be for this chunk */
+    H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk.last);
+
+    /* The address of a single chunk is kept in the layout message */
+    if (sc->idx_type == H5D_CHUNK_IDX_SINGLE && H5D__mark(dset, H5D_MARK_LAYOUT) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to mark layout as dirty");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_remove() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_flush_entry
  *
@@ -3941,6 +4227,7 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, bool reset)
 {
     void                *buf                = NULL; /* Temporary buffer        */
     bool                 point_of_no_return = false;
+    htri_t               is_fill            = false; /* Whether the chunk is all fill values */
     H5O_storage_chunk_t *sc                 = &(dset->shared->layout.storage.u.chunk);
     herr_t               ret_value          = SUCCEED; /* Return value            */
 
@@ -3953,7 +4240,25 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, bool reset)
     assert(!ent->locked);
 
     buf = ent->chunk;
-    if (ent->dirty) {
+
+    /* Check for a chunk of nothing but fill values, to leave unallocated */
+    if (ent->dirty && dset->shared->cache.chunk.skip_fill)
+        if ((is_fill = H5D__chunk_is_fill(dset, ent->chunk)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "unable to compare chunk with fill value");
+
+    if (is_fill) {
+        /* Remove the chunk from the file, if it's there */
+        if (H5_addr_defined(ent->chunk_block.offset))
+            if (H5D__chunk_remove(dset, ent->scaled) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTDELETE, FAIL, "unable to remove chunk of fill values");
+        ent->chunk_block.offset = HADDR_UNDEF;
+        ent->chunk_block.length = 0;
+        ent->edge_chunk_state &= ~H5D_RDCC_NEWLY_DISABLED_FILTERS;
+
+        /* Mark cache entry as clean */
+        ent->dirty = false;
+    } /* end if */
+    else if (ent->dirty) {
         H5D_chk_idx_info_t idx_info;            /* Chunked index info */
         H5D_chunk_ud_t     udata;               /* pass through B-tree        */
         bool               must_alloc  = false; /* Whether the chunk must be allocated */
@@ -4296,6 +4601,105 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_cache_prune() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_read_image
+ *
+ * Purpose:     Reads a chunk's image from the file into the buffer pointed
+ *              to by CHUNK and passes it back through the I/O pipeline,
+ *              if there is one.  CHUNK_ALLOC and BUF_ALLOC are the number
+ *              of bytes to read and the size of the buffer, and are
+ *              updated (along with CHUNK) by the pipeline.  FILTERS, if
+ *              not NULL, holds the pipeline's filter functions, found by
+ *              H5Z_pipeline_resolve.
+ *
+ * Note:        This may be called without holding the API lock (see
+ *              H5D__chunk_lock), so it must only touch the dataset's
+ *              read-only information and this thread's API context.  The
+ *              table of registered filters may change while the lock is
+ *              released, so FILTERS must then be given.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_read_image(const H5D_t *dset, haddr_t chunk_addr, const H5O_pline_t *pline,
+                      const H5Z_func_t *filters, H5Z_EDC_t err_detect, H5Z_cb_t filter_cb,
+                      unsigned *filter_mask, size_t *chunk_alloc, size_t *buf_alloc, void **chunk)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(dset);
+    assert(H5_addr_defined(chunk_addr));
+    assert(chunk_alloc);
+    assert(chunk && *chunk);
+
+    if (H5F_shared_block_read(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, chunk_addr, *chunk_alloc, *chunk) <
+        0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk");
+
+    if (pline && pline->nused) {
+        herr_t status; /* Status of the pipeline */
+
+        if (filters)
+            status = H5Z_pipeline_resolved(pline, filters, H5Z_FLAG_REVERSE, filter_mask, err_detect,
+                                           filter_cb, chunk_alloc, buf_alloc, chunk);
+        else
+            status = H5Z_pipeline(pline, H5Z_FLAG_REVERSE, filter_mask, err_detect, filter_cb, chunk_alloc,
+                                  buf_alloc, chunk);
+        if (status < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "data pipeline read failed");
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_read_image() */
+
+#ifdef H5_HAVE_THREADSAFE_API
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_concurrent_read
+ *
+ * Purpose:     Checks if the dataset's chunks can be read and unfiltered
+ *              without holding the API lock.  The file must allow other
+ *              threads to read it at the same time, and the pipeline may
+ *              only use the library's own filters, already registered so
+ *              that running them doesn't change the filter table.
+ *
+ * Return:      true/false
+ *
+ *-------------------------------------------------------------------------
+ */
+static bool
+H5D__chunk_concurrent_read(const H5D_t *dset, const H5O_pline_t *pline)
+{
+    bool ret_value = false; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(dset);
+
+#ifndef H5_MEMORY_ALLOC_SANITY_CHECK
+    if (H5F_concurrent_raw_read(dset->oloc.file)) {
+        ret_value = true;
+
+        if (pline && pline->nused) {
+            size_t u; /* Local index variable */
+
+            for (u = 0; u < pline->nused; u++)
+                if (pline->filter[u].id >= H5Z_FILTER_RESERVED)
+                    ret_value = false;
+            if (ret_value && H5Z_all_filters_avail(pline) <= 0)
+                ret_value = false;
+        } /* end if */
+    }     /* end if */
+#endif /* H5_MEMORY_ALLOC_SANITY_CHECK */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_concurrent_read() */
+#endif /* H5_HAVE_THREADSAFE_API */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_lock
  *
@@ -4527,8 +4931,17 @@ H5D__chunk_lock(const H5D_io_info_t H5_ATTR_NDEBUG_UNUSED *io_info, const H5D_ds
 
             /* Check if the chunk exists on disk */
             if (H5_addr_defined(chunk_addr)) {
-                size_t my_chunk_alloc = chunk_alloc; /* Allocated buffer size */
-                size_t buf_alloc      = chunk_alloc; /* [Re-]allocated buffer size */
+                size_t            my_chunk_alloc = chunk_alloc;    /* Allocated buffer size */
+                size_t            buf_alloc      = chunk_alloc;    /* [Re-]allocated buffer size */
+                H5Z_EDC_t         err_detect     = H5Z_ENABLE_EDC; /* Error detection info */
+                H5Z_cb_t          filter_cb      = {NULL, NULL};   /* I/O filter callback function */
+                const H5Z_func_t *filters        = NULL; /* Filter functions, found while locked */
+                herr_t            read_status;           /* Status of reading the chunk */
+#ifdef H5_HAVE_THREADSAFE_API
+                H5Z_func_t filter_funcs[H5Z_MAX_NFILTERS]; /* Filter functions of the pipeline */
+                unsigned   api_lock_count    = 0;          /* # of times this thread held the API lock */
+                bool       api_lock_released = false;      /* Whether the API lock was released */
+#endif /* H5_HAVE_THREADSAFE_API */
 
                 /* Chunk size on disk isn't [likely] the same size as the final chunk
                  * size in memory, so allocate memory big enough. */
@@ -4536,24 +4949,60 @@ H5D__chunk_lock(const H5D_io_info_t H5_ATTR_NDEBUG_UNUSED *io_info, const H5D_ds
                                                           (udata->new_unfilt_chunk ? old_pline : pline))))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL,
                                 "memory allocation failed for raw data chunk");
-                if (H5F_shared_block_read(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, chunk_addr,
-                                          my_chunk_alloc, chunk) < 0)
-                    HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk");
 
+                /* Retrieve filter settings from API context */
                 if (old_pline && old_pline->nused) {
-                    H5Z_EDC_t err_detect; /* Error detection info */
-                    H5Z_cb_t  filter_cb;  /* I/O filter callback function */
-
-                    /* Retrieve filter settings from API context */
                     if (H5CX_get_err_detect(&err_detect) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't get error detection info");
                     if (H5CX_get_filter_cb(&filter_cb) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't get I/O filter callback function");
+                } /* end if */
 
-                    if (H5Z_pipeline(old_pline, H5Z_FLAG_REVERSE, &(udata->filter_mask), err_detect,
-                                     filter_cb, &my_chunk_alloc, &buf_alloc, &chunk) < 0)
-                        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, NULL, "data pipeline read failed");
+                /* Read and unfilter the chunk.  When other threads can safely
+                 * read the file at the same time, do this without holding the
+                 * library's API lock so they can look up and decode other
+                 * chunks in parallel.  Everything used while unlocked was set
+                 * up above, and the chunk is only added to the cache once the
+                 * lock is held again.
+                 */
+#ifdef H5_HAVE_THREADSAFE_API
+                if (!udata->new_unfilt_chunk && H5D__chunk_concurrent_read(dset, old_pline)) {
+                    uint32_t actual_selection_io_mode; /* Actual selection I/O mode */
+
+                    /* Cache the actual selection I/O mode in the API context
+                     * now, so the file driver layer doesn't look it up in the
+                     * DXPL while the lock is released */
+                    if (H5CX_get_actual_selection_io_mode(&actual_selection_io_mode) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't get actual selection I/O mode");
+
+                    /* Look up the filter functions now, as other threads may
+                     * register or unregister filters, moving the table of
+                     * registered filters, while the lock is released */
+                    if (old_pline && old_pline->nused) {
+                        if (H5Z_pipeline_resolve(old_pline, filter_funcs) < 0)
+                            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't look up filters");
+                        filters = filter_funcs;
+                    } /* end if */
 
+                    if (H5TS_api_lock_suspend(&api_lock_count) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTUNLOCK, NULL, "can't release API lock");
+                    api_lock_released = true;
+                } /* end if */
+#endif /* H5_HAVE_THREADSAFE_API */
+                read_status = H5D__chunk_read_image(dset, chunk_addr, old_pline, filters, err_detect,
+                                                    filter_cb, &(udata->filter_mask), &my_chunk_alloc,
+                                                    &buf_alloc, &chunk);
+#ifdef H5_HAVE_THREADSAFE_API
+                if (api_lock_released) {
+                    api_lock_released = false;
+                    if (H5TS_api_lock_resume(api_lock_count) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTLOCK, NULL, "can't reacquire API lock");
+                } /* end if */
+#endif /* H5_HAVE_THREADSAFE_API */
+                if (read_status < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, NULL, "unable to read raw data chunk");
+
+                if (old_pline && old_pline->nused) {
                     /* Reallocate chunk if necessary */
                     if (udata->new_unfilt_chunk) {
                         void *tmp_chunk = chunk;
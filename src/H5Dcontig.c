@@ -44,6 +44,14 @@
 /* Local Macros */
 /****************/
 
+/* Largest data sieve window for a stream read ahead, in sieve buffer sizes */
+#define H5D_SIEVE_READ_AHEAD_MAX 4
+
+/* # of consecutive accesses far from every stream after which accesses
+ * that aren't near a stream go directly to the file
+ */
+#define H5D_SIEVE_FAR_LIMIT 2
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -103,6 +111,18 @@ static herr_t H5D__contig_write_one(H5D_io_info_t *io_info, H5D_dset_io_info_t *
                                     size_t size);
 static herr_t H5D__contig_may_use_select_io(H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset_info,
                                             H5D_io_op_type_t op_type);
+static herr_t H5D__contig_sieve_evict(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, haddr_t addr, hsize_t len,
+                                      const H5D_sieve_win_t *keep, bool drop);
+static H5D_sieve_win_t *H5D__contig_sieve_lookup(H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len);
+static H5D_sieve_win_t *H5D__contig_sieve_stream(H5D_rdcdc_t *dset_contig, haddr_t addr);
+static H5D_sieve_win_t *H5D__contig_sieve_victim(H5D_rdcdc_t *dset_contig);
+static herr_t H5D__contig_sieve_choose(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len,
+                                       bool write, H5D_sieve_win_t **win_out, size_t *size);
+static herr_t H5D__contig_sieve_load(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, H5D_sieve_win_t *win,
+                                     const H5D_contig_storage_t *store_contig, hsize_t dst_off, size_t size,
+                                     size_t len, bool write);
+static void   H5D__contig_sieve_track(H5D_rdcdc_t *dset_contig, H5D_sieve_win_t *win, haddr_t addr, bool hit);
+static bool   H5D__contig_sieve_has_data(const H5D_rdcdc_t *dset_contig, bool dirty);
 
 /*********************/
 /* Package Variables */
@@ -135,9 +155,6 @@ H5FL_BLK_DEFINE(sieve_buf);
 /* Declare extern the free list to manage blocks of type conversion data */
 H5FL_BLK_EXTERN(type_conv);
 
-/* Declare extern the free list to manage the H5D_piece_info_t struct */
-H5FL_EXTERN(H5D_piece_info_t);
-
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_alloc
  *
@@ -591,7 +608,7 @@ H5D__contig_is_data_cached(const H5D_shared_t *shared_dset)
     /* Sanity checks */
     assert(shared_dset);
 
-    FUNC_LEAVE_NOAPI(shared_dset->cache.contig.sieve_size > 0)
+    FUNC_LEAVE_NOAPI(H5D__contig_sieve_has_data(&shared_dset->cache.contig, false))
 } /* end H5D__contig_is_data_cached() */
 
 /*-------------------------------------------------------------------------
@@ -656,7 +673,8 @@ H5D__contig_io_init(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo)
         /* Add temporary chunk to the list of pieces */
         /* collect piece_info into Skip List */
         /* Allocate the file & memory chunk information */
-        if (NULL == (new_piece_info = H5FL_MALLOC(H5D_piece_info_t))) {
+        if (NULL == (new_piece_info =
+                         (H5D_piece_info_t *)H5D__io_arena_malloc(io_info, sizeof(H5D_piece_info_t)))) {
             (void)H5S_close(tmp_fspace);
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info");
         } /* end if */
@@ -800,8 +818,7 @@ H5D__contig_may_use_select_io(H5D_io_info_t *io_info, const H5D_dset_io_info_t *
         io_info->use_select_io = H5D_SELECTION_IO_MODE_OFF;
         io_info->no_selection_io_cause |= H5D_SEL_IO_NOT_CONTIGUOUS_OR_CHUNKED_DATASET;
     }
-    else if ((op_type == H5D_IO_OP_READ && dataset->shared->cache.contig.sieve_dirty) ||
-             (op_type == H5D_IO_OP_WRITE && dataset->shared->cache.contig.sieve_buf)) {
+    else if (H5D__contig_sieve_has_data(&dataset->shared->cache.contig, op_type == H5D_IO_OP_READ)) {
         io_info->use_select_io = H5D_SELECTION_IO_MODE_OFF;
         io_info->no_selection_io_cause |= H5D_SEL_IO_CONTIGUOUS_SIEVE_BUFFER;
     }
@@ -1005,6 +1022,419 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_write_one() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_flush_win
+ *
+ * Purpose:	Write a sieve window's data to the file, if it's dirty.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_sieve_flush_win(H5F_shared_t *f_sh, H5D_sieve_win_t *win)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (win->sieve_dirty) {
+        assert(win->sieve_buf);
+        assert(win->sieve_size > 0);
+
+        /* Write to file */
+        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, win->sieve_loc, win->sieve_size, win->sieve_buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed");
+
+        /* Reset sieve buffer dirty flag */
+        win->sieve_dirty = false;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_flush_win() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_evict
+ *
+ * Purpose:	Flush the sieve windows, other than KEEP, whose data
+ *              overlaps the LEN bytes at ADDR in the file.  When DROP is
+ *              set, the windows' data is also discarded, so the windows
+ *              never hold stale or duplicate copies of the file's data.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_evict(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, haddr_t addr, hsize_t len,
+                        const H5D_sieve_win_t *keep, bool drop)
+{
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_sieve_win_t *win = &dset_contig->win[u];
+
+        if (win != keep && win->sieve_size > 0 && win->sieve_loc < (addr + len) &&
+            addr < (win->sieve_loc + win->sieve_size)) {
+            if (H5D__contig_sieve_flush_win(f_sh, win) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve window");
+
+            /* Force the window to be re-read the next time */
+            if (drop) {
+                win->sieve_loc  = HADDR_UNDEF;
+                win->sieve_size = 0;
+            } /* end if */
+        }     /* end if */
+    }         /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_evict() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_lookup
+ *
+ * Purpose:	Look for the sieve window holding all LEN bytes at ADDR
+ *              in the file.
+ *
+ * Return:	Pointer to the window, or NULL if there is none
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_sieve_win_t *
+H5D__contig_sieve_lookup(H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len)
+{
+    unsigned         u;                /* Local index variable */
+    H5D_sieve_win_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_sieve_win_t *win = &dset_contig->win[u];
+
+        if (win->sieve_size > 0 && addr >= win->sieve_loc &&
+            (addr + len) <= (win->sieve_loc + win->sieve_size)) {
+            ret_value = win;
+            break;
+        } /* end if */
+    }     /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_lookup() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_stream
+ *
+ * Purpose:	Find the stream of accesses continued by an access at ADDR
+ *              in the file: the sieve window whose stream's last access
+ *              is the nearest one at or before ADDR.
+ *
+ * Return:	Pointer to the window, or NULL if there is none
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_sieve_win_t *
+H5D__contig_sieve_stream(H5D_rdcdc_t *dset_contig, haddr_t addr)
+{
+    unsigned         u;                /* Local index variable */
+    H5D_sieve_win_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_sieve_win_t *win = &dset_contig->win[u];
+
+        if (win->active && win->last_addr <= addr &&
+            (NULL == ret_value || win->last_addr > ret_value->last_addr))
+            ret_value = win;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_stream() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_victim
+ *
+ * Purpose:	Choose the sieve window to follow a new stream of accesses:
+ *              a window not following any stream, or else the least
+ *              recently used one.
+ *
+ * Return:	Pointer to the window
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_sieve_win_t *
+H5D__contig_sieve_victim(H5D_rdcdc_t *dset_contig)
+{
+    unsigned         u;                                /* Local index variable */
+    H5D_sieve_win_t *ret_value = &dset_contig->win[0]; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_sieve_win_t *win = &dset_contig->win[u];
+
+        if (!win->active) {
+            ret_value = win;
+            break;
+        } /* end if */
+        if (win->last_use < ret_value->last_use)
+            ret_value = win;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_victim() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_choose
+ *
+ * Purpose:	Choose the sieve window for an access of LEN bytes at ADDR
+ *              in the file that no window holds, and the size of the data
+ *              to load into it.  *SIZE is set to 0 when the access should
+ *              go directly to the file; the window returned, if any, then
+ *              only follows the access's stream.
+ *
+ *              An access within a window's size of its stream's last
+ *              access loads a window for the stream.  For reads, when
+ *              the stream used its last window and ran past its end, the
+ *              next window is twice as large, up to
+ *              H5D_SIEVE_READ_AHEAD_MAX times the sieve buffer size,
+ *              reading ahead of sequential and densely strided streams.
+ *              For writes, the window of a sequential stream starts out
+ *              with only the data written.  After a few consecutive
+ *              accesses far from every stream, which a window can't
+ *              help, accesses go directly to the file until one is near
+ *              a stream again.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_choose(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len, bool write,
+                         H5D_sieve_win_t **win_out, size_t *size)
+{
+    size_t           max_size = dset_contig->sieve_buf_size; /* Size of a window */
+    H5D_sieve_win_t *win;                                    /* Window of the access's stream */
+    herr_t           ret_value = SUCCEED;                    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    win   = H5D__contig_sieve_stream(dset_contig, addr);
+    *size = 0;
+
+    /* Accesses too large for a window always go to the file */
+    if (len > max_size)
+        win = NULL;
+    /* Access near its stream's last access */
+    else if (win && (addr - win->last_addr) < max_size) {
+        dset_contig->nfar = 0;
+        *size             = max_size;
+
+        /* Read further ahead when the stream used its window and ran past it */
+        if (!write && win->sieve_size > 0 && win->nhits > 0 && addr >= (win->sieve_loc + win->sieve_size))
+            *size = MIN(MAX(2 * win->sieve_size, max_size), H5D_SIEVE_READ_AHEAD_MAX * max_size);
+
+        /* Start the next window of a stream writing sequentially with just
+         * the data written, rather than read data about to be overwritten
+         */
+        if (write && win->sieve_size > 0 && addr == (win->sieve_loc + win->sieve_size))
+            *size = len;
+    } /* end if */
+    /* Start a new stream, unless the accesses are too sparse to sieve */
+    else if (++dset_contig->nfar < H5D_SIEVE_FAR_LIMIT) {
+        win   = H5D__contig_sieve_victim(dset_contig);
+        *size = max_size;
+    } /* end if */
+    /* Follow the sparse stream with a window without data */
+    else if (NULL == win || win->sieve_size > 0) {
+        win = H5D__contig_sieve_victim(dset_contig);
+        if (H5D__contig_sieve_flush_win(f_sh, win) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve window");
+        win->sieve_loc  = HADDR_UNDEF;
+        win->sieve_size = 0;
+    } /* end else-if */
+
+    *win_out = win;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_choose() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_load
+ *
+ * Purpose:	Load up to SIZE bytes at DST_OFF in the dataset into sieve
+ *              window WIN, for an access of LEN bytes at the start of
+ *              the window.  The data is read from the file, unless a
+ *              write (WRITE set) is about to replace all of it.  The
+ *              window's current data is flushed, and the data of any
+ *              other window the new data overlaps is flushed and
+ *              discarded.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_load(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, H5D_sieve_win_t *win,
+                       const H5D_contig_storage_t *store_contig, hsize_t dst_off, size_t size, size_t len,
+                       bool write)
+{
+    haddr_t addr;                /* Address of the data */
+    haddr_t rel_eoa;             /* Relative end of file address	*/
+    hsize_t max_data;            /* Actual maximum size of data to cache */
+    hsize_t min;                 /* temporary minimum value (avoids some ugly macro nesting) */
+    size_t  buf_size;            /* Size of buffer needed */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(win);
+    assert(size >= len);
+
+    addr = store_contig->dset_addr + dst_off;
+
+    /* Flush the window's current data */
+    if (H5D__contig_sieve_flush_win(f_sh, win) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve window");
+    win->sieve_loc  = HADDR_UNDEF;
+    win->sieve_size = 0;
+
+    /* Make certain we don't read off the end of the file */
+    if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size");
+
+    /* Only need this when resizing sieve buffer */
+    max_data = store_contig->dset_size - dst_off;
+
+    /* Compute the size of the sieve buffer.
+     * Don't read off the end of the file, don't read past
+     * the end of the data element, and don't read more than
+     * the buffer size.
+     */
+    min = MIN3(rel_eoa - addr, max_data, size);
+    H5_CHECKED_ASSIGN(size, size_t, min, hsize_t);
+
+    /* Other windows must not hold copies of the same data */
+    if (H5D__contig_sieve_evict(f_sh, dset_contig, addr, (hsize_t)size, win, true) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to evict sieve windows");
+
+    /* Allocate room for the data, with room to add to it up to the sieve buffer size */
+    buf_size = MAX(size, dset_contig->sieve_buf_size);
+    if (win->sieve_buf_size < buf_size) {
+        if (win->sieve_buf)
+            win->sieve_buf = H5FL_BLK_FREE(sieve_buf, win->sieve_buf);
+        win->sieve_buf_size = 0;
+        if (NULL == (win->sieve_buf = H5FL_BLK_MALLOC(sieve_buf, buf_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed");
+        win->sieve_buf_size = buf_size;
+    } /* end if */
+
+    /* Read the new sieve buffer, if there is any point in reading the data from the file */
+    if ((!write || size > len) && H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, size, win->sieve_buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed");
+
+    win->sieve_loc  = addr;
+    win->sieve_size = size;
+    win->nhits      = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_load() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_track
+ *
+ * Purpose:	Record an access at ADDR in the file as the last access
+ *              of the stream sieve window WIN follows.  HIT is set when
+ *              the window's data served the access.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__contig_sieve_track(H5D_rdcdc_t *dset_contig, H5D_sieve_win_t *win, haddr_t addr, bool hit)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    win->active    = true;
+    win->last_addr = addr;
+    win->last_use  = ++dset_contig->use_count;
+    if (hit) {
+        win->nhits++;
+        dset_contig->nfar = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__contig_sieve_track() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_has_data
+ *
+ * Purpose:	Check whether any sieve window holds data, or dirty data
+ *              when DIRTY is set.
+ *
+ * Return:	true/false
+ *
+ *-------------------------------------------------------------------------
+ */
+static bool
+H5D__contig_sieve_has_data(const H5D_rdcdc_t *dset_contig, bool dirty)
+{
+    unsigned u;                 /* Local index variable */
+    bool     ret_value = false; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++)
+        if (dset_contig->win[u].sieve_size > 0 && (!dirty || dset_contig->win[u].sieve_dirty)) {
+            ret_value = true;
+            break;
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_has_data() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_free_sieve
+ *
+ * Purpose:	Free the buffers of a dataset's sieve windows, and forget
+ *              the streams the windows follow.  Dirty data isn't written.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5D__contig_free_sieve(H5D_rdcdc_t *dset_contig)
+{
+    unsigned u; /* Local index variable */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    assert(dset_contig);
+
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_sieve_win_t *win = &dset_contig->win[u];
+
+        if (win->sieve_buf)
+            win->sieve_buf = H5FL_BLK_FREE(sieve_buf, win->sieve_buf);
+        memset(win, 0, sizeof(*win));
+        win->sieve_loc = HADDR_UNDEF;
+    } /* end for */
+    dset_contig->nfar = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__contig_free_sieve() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv_sieve_cb
  *
@@ -1022,148 +1452,55 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
     H5F_shared_t *f_sh        = udata->f_sh;        /* Shared file for dataset */
     H5D_rdcdc_t  *dset_contig = udata->dset_contig; /* Cached information about contiguous data */
     const H5D_contig_storage_t *store_contig =
-        udata->store_contig; /* Contiguous storage info for this I/O operation */
-    unsigned char *buf;      /* Pointer to buffer to fill */
-    haddr_t        addr;     /* Actual address to read */
-    haddr_t sieve_start = HADDR_UNDEF, sieve_end = HADDR_UNDEF; /* Start & end locations of sieve buffer */
-    haddr_t contig_end;                                         /* End locations of block to write */
-    size_t  sieve_size = (size_t)-1;                            /* Size of sieve buffer */
-    haddr_t rel_eoa;                                            /* Relative end of file address	*/
-    hsize_t max_data;                                           /* Actual maximum size of data to cache */
-    hsize_t min;                 /* temporary minimum value (avoids some ugly macro nesting) */
-    herr_t  ret_value = SUCCEED; /* Return value */
+        udata->store_contig;         /* Contiguous storage info for this I/O operation */
+    unsigned char   *buf;            /* Pointer to buffer to fill */
+    haddr_t          addr;           /* Actual address to read */
+    H5D_sieve_win_t *win;            /* Sieve window for the read */
+    size_t           win_size;       /* Size of the data to load into the window */
+    herr_t           ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
-    /* Stash local copies of these value */
-    if (dset_contig->sieve_buf != NULL) {
-        sieve_start = dset_contig->sieve_loc;
-        sieve_size  = dset_contig->sieve_size;
-        sieve_end   = sieve_start + sieve_size;
-    } /* end if */
-
     /* Compute offset on disk */
     addr = store_contig->dset_addr + dst_off;
 
     /* Compute offset in memory */
     buf = udata->rbuf + src_off;
 
-    /* Check if the sieve buffer is allocated yet */
-    if (NULL == dset_contig->sieve_buf) {
-        /* Check if we can actually hold the I/O request in the sieve buffer */
-        if (len > dset_contig->sieve_buf_size) {
-            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed");
-        } /* end if */
-        else {
-            /* Allocate room for the data sieve buffer */
-            if (NULL == (dset_contig->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed");
-
-            /* Determine the new sieve buffer size & location */
-            dset_contig->sieve_loc = addr;
-
-            /* Make certain we don't read off the end of the file */
-            if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size");
+    /* If entire read is within a sieve window, read it from the window */
+    if (NULL != (win = H5D__contig_sieve_lookup(dset_contig, addr, len))) {
+        /* Grab the data out of the buffer */
+        H5MM_memcpy(buf, win->sieve_buf + (addr - win->sieve_loc), len);
 
-            /* Set up the buffer parameters */
-            max_data = store_contig->dset_size - dst_off;
-
-            /* Compute the size of the sieve buffer */
-            min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-            H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
+        H5D__contig_sieve_track(dset_contig, win, addr, true);
+        HGOTO_DONE(SUCCEED);
+    } /* end if */
 
-            /* Read the new sieve buffer */
-            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size,
-                                      dset_contig->sieve_buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed");
+    /* Choose a window for the read */
+    if (H5D__contig_sieve_choose(f_sh, dset_contig, addr, len, false, &win, &win_size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to choose sieve window");
 
-            /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-            H5MM_memcpy(buf, dset_contig->sieve_buf, len);
+    if (win_size > 0) {
+        /* Read the new sieve buffer */
+        if (H5D__contig_sieve_load(f_sh, dset_contig, win, store_contig, dst_off, win_size, len, false) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to load sieve window");
+        assert(win->sieve_size >= len);
 
-            /* Reset sieve buffer dirty flag */
-            dset_contig->sieve_dirty = false;
-        } /* end else */
-    }     /* end if */
+        /* Grab the data out of the buffer (must be first piece of data in buffer ) */
+        H5MM_memcpy(buf, win->sieve_buf, len);
+    } /* end if */
     else {
-        /* Compute end of sequence to retrieve */
-        contig_end = addr + len - 1;
+        /* Flush any sieve window overlapping the read, if it's dirty */
+        if (H5D__contig_sieve_evict(f_sh, dset_contig, addr, (hsize_t)len, NULL, false) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve windows");
 
-        /* If entire read is within the sieve buffer, read it from the buffer */
-        if (addr >= sieve_start && contig_end < sieve_end) {
-            unsigned char *base_sieve_buf = dset_contig->sieve_buf + (addr - sieve_start);
+        /* Read directly into the user's buffer */
+        if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed");
+    } /* end else */
 
-            /* Grab the data out of the buffer */
-            H5MM_memcpy(buf, base_sieve_buf, len);
-        } /* end if */
-        /* Entire request is not within this data sieve buffer */
-        else {
-            /* Check if we can actually hold the I/O request in the sieve buffer */
-            if (len > dset_contig->sieve_buf_size) {
-                /* Check for any overlap with the current sieve buffer */
-                if ((sieve_start >= addr && sieve_start < (contig_end + 1)) ||
-                    ((sieve_end - 1) >= addr && (sieve_end - 1) < (contig_end + 1))) {
-                    /* Flush the sieve buffer, if it's dirty */
-                    if (dset_contig->sieve_dirty) {
-                        /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed");
-
-                        /* Reset sieve buffer dirty flag */
-                        dset_contig->sieve_dirty = false;
-                    } /* end if */
-                }     /* end if */
-
-                /* Read directly into the user's buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed");
-            } /* end if */
-            /* Element size fits within the buffer size */
-            else {
-                /* Flush the sieve buffer if it's dirty */
-                if (dset_contig->sieve_dirty) {
-                    /* Write to file */
-                    if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                               dset_contig->sieve_buf) < 0)
-                        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed");
-
-                    /* Reset sieve buffer dirty flag */
-                    dset_contig->sieve_dirty = false;
-                } /* end if */
-
-                /* Determine the new sieve buffer size & location */
-                dset_contig->sieve_loc = addr;
-
-                /* Make certain we don't read off the end of the file */
-                if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size");
-
-                /* Only need this when resizing sieve buffer */
-                max_data = store_contig->dset_size - dst_off;
-
-                /* Compute the size of the sieve buffer.
-                 * Don't read off the end of the file, don't read past
-                 * the end of the data element, and don't read more than
-                 * the buffer size.
-                 */
-                min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-                H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
-                /* Read the new sieve buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                          dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed");
-
-                /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-                H5MM_memcpy(buf, dset_contig->sieve_buf, len);
-
-                /* Reset sieve buffer dirty flag */
-                dset_contig->sieve_dirty = false;
-            } /* end else */
-        }     /* end else */
-    }         /* end else */
+    if (win)
+        H5D__contig_sieve_track(dset_contig, win, addr, false);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1281,198 +1618,100 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
     H5F_shared_t *f_sh        = udata->f_sh;        /* Shared file for dataset */
     H5D_rdcdc_t  *dset_contig = udata->dset_contig; /* Cached information about contiguous data */
     const H5D_contig_storage_t *store_contig =
-        udata->store_contig;   /* Contiguous storage info for this I/O operation */
-    const unsigned char *buf;  /* Pointer to buffer to fill */
-    haddr_t              addr; /* Actual address to read */
-    haddr_t sieve_start = HADDR_UNDEF, sieve_end = HADDR_UNDEF; /* Start & end locations of sieve buffer */
-    haddr_t contig_end;                                         /* End locations of block to write */
-    size_t  sieve_size = (size_t)-1;                            /* size of sieve buffer */
-    haddr_t rel_eoa;                                            /* Relative end of file address	*/
-    hsize_t max_data;                                           /* Actual maximum size of data to cache */
-    hsize_t min;                 /* temporary minimum value (avoids some ugly macro nesting) */
-    herr_t  ret_value = SUCCEED; /* Return value */
+        udata->store_contig;             /* Contiguous storage info for this I/O operation */
+    const unsigned char *buf;            /* Pointer to buffer to fill */
+    haddr_t              addr;           /* Actual address to read */
+    H5D_sieve_win_t     *win;            /* Sieve window for the write */
+    size_t               win_size;       /* Size of the data to load into the window */
+    unsigned             u;              /* Local index variable */
+    herr_t               ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
-    /* Stash local copies of these values */
-    if (dset_contig->sieve_buf != NULL) {
-        sieve_start = dset_contig->sieve_loc;
-        sieve_size  = dset_contig->sieve_size;
-        sieve_end   = sieve_start + sieve_size;
-    } /* end if */
-
     /* Compute offset on disk */
     addr = store_contig->dset_addr + dst_off;
 
     /* Compute offset in memory */
     buf = udata->wbuf + src_off;
 
-    /* No data sieve buffer yet, go allocate one */
-    if (NULL == dset_contig->sieve_buf) {
-        /* Check if we can actually hold the I/O request in the sieve buffer */
-        if (len > dset_contig->sieve_buf_size) {
-            if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed");
+    /* If entire write is within a sieve window, write it to the window */
+    if (NULL != (win = H5D__contig_sieve_lookup(dset_contig, addr, len))) {
+        /* Put the data into the sieve buffer */
+        H5MM_memcpy(win->sieve_buf + (addr - win->sieve_loc), buf, len);
+
+        /* Set sieve buffer dirty flag */
+        win->sieve_dirty = true;
+
+        H5D__contig_sieve_track(dset_contig, win, addr, true);
+        HGOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Check if it is possible to (exactly) prepend or append to an existing (dirty) sieve window */
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        win = &dset_contig->win[u];
+
+        if (win->sieve_size > 0 && win->sieve_dirty &&
+            ((addr + len) == win->sieve_loc || addr == (win->sieve_loc + win->sieve_size)) &&
+            (len + win->sieve_size) <= dset_contig->sieve_buf_size &&
+            (len + win->sieve_size) <= win->sieve_buf_size)
+            break;
+    } /* end for */
+    if (u < H5D_SIEVE_NWINDOWS) {
+        /* Other windows must not hold copies of the data written */
+        if (H5D__contig_sieve_evict(f_sh, dset_contig, addr, (hsize_t)len, win, true) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to evict sieve windows");
+
+        /* Prepend to existing sieve buffer */
+        if ((addr + len) == win->sieve_loc) {
+            /* Move existing sieve information to correct location */
+            memmove(win->sieve_buf + len, win->sieve_buf, win->sieve_size);
+
+            /* Copy in new information (must be first in sieve buffer) */
+            H5MM_memcpy(win->sieve_buf, buf, len);
+
+            /* Adjust sieve location */
+            win->sieve_loc = addr;
         } /* end if */
-        else {
-            /* Allocate room for the data sieve buffer */
-            if (NULL == (dset_contig->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed");
-
-            /* Clear memory */
-            if (dset_contig->sieve_size > len)
-                memset(dset_contig->sieve_buf + len, 0, (dset_contig->sieve_size - len));
-
-            /* Determine the new sieve buffer size & location */
-            dset_contig->sieve_loc = addr;
-
-            /* Make certain we don't read off the end of the file */
-            if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size");
-
-            /* Set up the buffer parameters */
-            max_data = store_contig->dset_size - dst_off;
-
-            /* Compute the size of the sieve buffer */
-            min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-            H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
-            /* Check if there is any point in reading the data from the file */
-            if (dset_contig->sieve_size > len) {
-                /* Read the new sieve buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                          dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed");
-            } /* end if */
+        /* Append to existing sieve buffer */
+        else
+            /* Copy in new information */
+            H5MM_memcpy(win->sieve_buf + win->sieve_size, buf, len);
 
-            /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-            H5MM_memcpy(dset_contig->sieve_buf, buf, len);
+        /* Adjust sieve size */
+        win->sieve_size += len;
 
-            /* Set sieve buffer dirty flag */
-            dset_contig->sieve_dirty = true;
+        H5D__contig_sieve_track(dset_contig, win, addr, true);
+        HGOTO_DONE(SUCCEED);
+    } /* end if */
 
-            /* Stash local copies of these values */
-            sieve_start = dset_contig->sieve_loc;
-            sieve_size  = dset_contig->sieve_size;
-            sieve_end   = sieve_start + sieve_size;
-        } /* end else */
-    }     /* end if */
-    else {
-        /* Compute end of sequence to retrieve */
-        contig_end = addr + len - 1;
+    /* Choose a window for the write */
+    if (H5D__contig_sieve_choose(f_sh, dset_contig, addr, len, true, &win, &win_size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to choose sieve window");
 
-        /* If entire write is within the sieve buffer, write it to the buffer */
-        if (addr >= sieve_start && contig_end < sieve_end) {
-            unsigned char *base_sieve_buf = dset_contig->sieve_buf + (addr - sieve_start);
+    if (win_size > 0) {
+        /* Load the new sieve buffer */
+        if (H5D__contig_sieve_load(f_sh, dset_contig, win, store_contig, dst_off, win_size, len, true) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to load sieve window");
+        assert(win->sieve_size >= len);
 
-            /* Put the data into the sieve buffer */
-            H5MM_memcpy(base_sieve_buf, buf, len);
+        /* Put the data into the buffer (must be first piece of data in buffer ) */
+        H5MM_memcpy(win->sieve_buf, buf, len);
 
-            /* Set sieve buffer dirty flag */
-            dset_contig->sieve_dirty = true;
-        } /* end if */
-        /* Entire request is not within this data sieve buffer */
-        else {
-            /* Check if we can actually hold the I/O request in the sieve buffer */
-            if (len > dset_contig->sieve_buf_size) {
-                /* Check for any overlap with the current sieve buffer */
-                if ((sieve_start >= addr && sieve_start < (contig_end + 1)) ||
-                    ((sieve_end - 1) >= addr && (sieve_end - 1) < (contig_end + 1))) {
-                    /* Flush the sieve buffer, if it's dirty */
-                    if (dset_contig->sieve_dirty) {
-                        /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed");
-
-                        /* Reset sieve buffer dirty flag */
-                        dset_contig->sieve_dirty = false;
-                    } /* end if */
-
-                    /* Force the sieve buffer to be re-read the next time */
-                    dset_contig->sieve_loc  = HADDR_UNDEF;
-                    dset_contig->sieve_size = 0;
-                } /* end if */
-
-                /* Write directly from the user's buffer */
-                if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed");
-            } /* end if */
-            /* Element size fits within the buffer size */
-            else {
-                /* Check if it is possible to (exactly) prepend or append to existing (dirty) sieve buffer */
-                if (((addr + len) == sieve_start || addr == sieve_end) &&
-                    (len + sieve_size) <= dset_contig->sieve_buf_size && dset_contig->sieve_dirty) {
-                    /* Prepend to existing sieve buffer */
-                    if ((addr + len) == sieve_start) {
-                        /* Move existing sieve information to correct location */
-                        memmove(dset_contig->sieve_buf + len, dset_contig->sieve_buf,
-                                dset_contig->sieve_size);
-
-                        /* Copy in new information (must be first in sieve buffer) */
-                        H5MM_memcpy(dset_contig->sieve_buf, buf, len);
-
-                        /* Adjust sieve location */
-                        dset_contig->sieve_loc = addr;
-
-                    } /* end if */
-                    /* Append to existing sieve buffer */
-                    else {
-                        /* Copy in new information */
-                        H5MM_memcpy(dset_contig->sieve_buf + sieve_size, buf, len);
-                    } /* end else */
-
-                    /* Adjust sieve size */
-                    dset_contig->sieve_size += len;
-                } /* end if */
-                /* Can't add the new data onto the existing sieve buffer */
-                else {
-                    /* Flush the sieve buffer if it's dirty */
-                    if (dset_contig->sieve_dirty) {
-                        /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed");
-
-                        /* Reset sieve buffer dirty flag */
-                        dset_contig->sieve_dirty = false;
-                    } /* end if */
-
-                    /* Determine the new sieve buffer size & location */
-                    dset_contig->sieve_loc = addr;
-
-                    /* Make certain we don't read off the end of the file */
-                    if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size");
-
-                    /* Only need this when resizing sieve buffer */
-                    max_data = store_contig->dset_size - dst_off;
-
-                    /* Compute the size of the sieve buffer.
-                     * Don't read off the end of the file, don't read past
-                     * the end of the data element, and don't read more than
-                     * the buffer size.
-                     */
-                    min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-                    H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
-                    /* Check if there is any point in reading the data from the file */
-                    if (dset_contig->sieve_size > len) {
-                        /* Read the new sieve buffer */
-                        if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                                  dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed");
-                    } /* end if */
-
-                    /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-                    H5MM_memcpy(dset_contig->sieve_buf, buf, len);
-
-                    /* Set sieve buffer dirty flag */
-                    dset_contig->sieve_dirty = true;
-                } /* end else */
-            }     /* end else */
-        }         /* end else */
-    }             /* end else */
+        /* Set sieve buffer dirty flag */
+        win->sieve_dirty = true;
+    } /* end if */
+    else {
+        /* Flush and discard any sieve window overlapping the write */
+        if (H5D__contig_sieve_evict(f_sh, dset_contig, addr, (hsize_t)len, NULL, true) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to evict sieve windows");
+
+        /* Write directly from the user's buffer */
+        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed");
+    } /* end else */
+
+    if (win)
+        H5D__contig_sieve_track(dset_contig, win, addr, false);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1667,10 +1906,9 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f
     bool          fix_ref     = false; /* Flag to indicate that ref values should be fixed */
     H5D_shared_t *shared_fo =
         (H5D_shared_t *)cpy_info->shared_fo; /* Pointer to the shared struct for dataset object */
-    bool    try_sieve   = false;             /* Try to get data from the sieve buffer */
-    haddr_t sieve_start = HADDR_UNDEF;       /* Start location of sieve buffer */
-    haddr_t sieve_end   = HADDR_UNDEF;       /* End locations of sieve buffer */
-    herr_t  ret_value   = SUCCEED;           /* Return value */
+    bool             try_sieve = false;      /* Try to get data from the sieve windows */
+    H5D_sieve_win_t *win       = NULL;       /* Sieve window holding the data to copy */
+    herr_t           ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -1775,12 +2013,10 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f
     addr_dst = storage_dst->addr;
 
     /* If data sieving is enabled and the dataset is open in the file,
-       set up to copy data out of the sieve buffer if deemed possible later */
-    if (H5F_HAS_FEATURE(f_src, H5FD_FEAT_DATA_SIEVE) && shared_fo && shared_fo->cache.contig.sieve_buf) {
-        try_sieve   = true;
-        sieve_start = shared_fo->cache.contig.sieve_loc;
-        sieve_end   = sieve_start + shared_fo->cache.contig.sieve_size;
-    }
+       set up to copy data out of its sieve windows if deemed possible later */
+    if (H5F_HAS_FEATURE(f_src, H5FD_FEAT_DATA_SIEVE) && shared_fo &&
+        H5D__contig_sieve_has_data(&shared_fo->cache.contig, false))
+        try_sieve = true;
 
     while (total_src_nbytes > 0) {
         /* Check if we should reduce the number of bytes to transfer */
@@ -1807,9 +2043,10 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f
                 dst_nbytes = mem_nbytes = src_nbytes;
         } /* end if */
 
-        /* If the entire copy is within the sieve buffer, copy data from the sieve buffer */
-        if (try_sieve && (addr_src >= sieve_start) && ((addr_src + src_nbytes - 1) < sieve_end)) {
-            unsigned char *base_sieve_buf = shared_fo->cache.contig.sieve_buf + (addr_src - sieve_start);
+        /* If the entire copy is within a sieve window, copy data from the window */
+        if (try_sieve &&
+            NULL != (win = H5D__contig_sieve_lookup(&shared_fo->cache.contig, addr_src, src_nbytes))) {
+            unsigned char *base_sieve_buf = win->sieve_buf + (addr_src - win->sieve_loc);
 
             H5MM_memcpy(buf, base_sieve_buf, src_nbytes);
         }
@@ -25,6 +25,7 @@
 #include "H5Eprivate.h"  /* Error handling                           */
 #include "H5Fprivate.h"  /* Files                                    */
 #include "H5FLprivate.h" /* Free Lists                               */
+#include "H5FDprivate.h" /* File drivers                             */
 #include "H5FOprivate.h" /* File objects                             */
 #include "H5Iprivate.h"  /* IDs                                      */
 #include "H5Lprivate.h"  /* Links                                    */
@@ -117,9 +118,6 @@ H5FL_BLK_DEFINE(vlen_fl_buf);
 H5FL_DEFINE_STATIC(H5D_t);
 H5FL_DEFINE_STATIC(H5D_shared_t);
 
-/* Declare the external PQ free list for the sieve buffer information */
-H5FL_BLK_EXTERN(sieve_buf);
-
 /* Declare the external free list to manage the H5D_piece_info_t struct */
 H5FL_EXTERN(H5D_piece_info_t);
 
@@ -314,6 +312,11 @@ H5D_term_package(void)
         /* Destroy the dataset object id group */
         n += (H5I_dec_type_ref(H5I_DATASET) > 0);
 
+#ifdef H5_HAVE_THREADSAFE_API
+        /* Stop the type conversion threads */
+        (void)H5D__scatgath_term();
+#endif /* H5_HAVE_THREADSAFE_API */
+
         /* Mark closed */
         if (0 == n)
             H5_PKG_INIT_VAR = false;
@@ -1639,6 +1642,64 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D_open() */
 
+/*
+ *-------------------------------------------------------------------------
+ * Function: H5D_reopen
+ *
+ * Purpose:  Opens another handle on a dataset that is already open, which
+ *           keeps the dataset (and its file) open until it is closed with
+ *           H5D_close(), even when the original handle is closed first.
+ *
+ * Return:   Success:    New dataset handle
+ *           Failure:    NULL
+ *-------------------------------------------------------------------------
+ */
+H5D_t *
+H5D_reopen(H5D_t *dataset)
+{
+    H5D_t *new_dset  = NULL; /* New handle on the dataset */
+    H5D_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    /* check args */
+    assert(dataset && dataset->oloc.file && dataset->shared);
+    assert(dataset->shared->fo_count > 0);
+
+    /* Allocate the dataset structure */
+    if (NULL == (new_dset = H5FL_CALLOC(H5D_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed");
+
+    /* Deep copy the object location and group hier. path */
+    if (H5O_loc_copy_deep(&(new_dset->oloc), &(dataset->oloc)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, NULL, "can't copy object location");
+    if (H5G_name_copy(&(new_dset->path), &(dataset->path), H5_COPY_DEEP) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, NULL, "can't copy path");
+
+    /* Increment object count for the object in the top file.  The object is
+     * already open through the top file, by the original handle.
+     */
+    assert(H5FO_top_count(new_dset->oloc.file, new_dset->oloc.addr) > 0);
+    if (H5FO_top_incr(new_dset->oloc.file, new_dset->oloc.addr) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, NULL, "can't increment object count");
+
+    /* Share the dataset's shared information */
+    new_dset->shared = dataset->shared;
+    new_dset->shared->fo_count++;
+
+    /* Set the dataset to return */
+    ret_value = new_dset;
+
+done:
+    if (NULL == ret_value && new_dset) {
+        H5O_loc_free(&(new_dset->oloc));
+        H5G_name_free(&(new_dset->path));
+        new_dset = H5FL_FREE(H5D_t, new_dset);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D_reopen() */
+
 /*
  *-------------------------------------------------------------------------
  * Function: H5D__flush_append_setup
@@ -1972,10 +2033,8 @@ H5D_close(H5D_t *dataset)
         /* Free cached information for each kind of dataset */
         switch (dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
-                /* Free the data sieve buffer, if it's been allocated */
-                if (dataset->shared->cache.contig.sieve_buf)
-                    dataset->shared->cache.contig.sieve_buf =
-                        (unsigned char *)H5FL_BLK_FREE(sieve_buf, dataset->shared->cache.contig.sieve_buf);
+                /* Free the data sieve windows' buffers, if they've been allocated */
+                H5D__contig_free_sieve(&dataset->shared->cache.contig);
                 break;
 
             case H5D_CHUNKED:
@@ -2166,10 +2225,8 @@ H5D_mult_refresh_close(hid_t dset_id)
         /* Free cached information for each kind of dataset */
         switch (dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
-                /* Free the data sieve buffer, if it's been allocated */
-                if (dataset->shared->cache.contig.sieve_buf)
-                    dataset->shared->cache.contig.sieve_buf =
-                        (unsigned char *)H5FL_BLK_FREE(sieve_buf, dataset->shared->cache.contig.sieve_buf);
+                /* Free the data sieve windows' buffers, if they've been allocated */
+                H5D__contig_free_sieve(&dataset->shared->cache.contig);
                 break;
 
             case H5D_CHUNKED:
@@ -2645,6 +2702,74 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__get_offset() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__read_view
+ *
+ * Purpose:     Private function for H5Dread_view().  Returns a pointer to
+ *              the raw data of a contiguous dataset in the file driver's
+ *              mapping of the file, if the data can be used in place with
+ *              MEM_TYPE.
+ *
+ *              That requires an allocated contiguous dataset that isn't
+ *              stored in an external file, a no-op conversion from the
+ *              dataset's datatype to MEM_TYPE, a file opened read-only (so
+ *              no newer copy of the data can be held in the library) and a
+ *              file driver that answers the "get mapped view" ctl request.
+ *              If any of those don't hold, *BUF is set to NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__read_view(const H5D_t *dset, const H5T_t *mem_type, const void **buf)
+{
+    H5T_path_t                 *tpath;               /* Datatype conversion path */
+    H5FD_t                     *file_handle = NULL;  /* File driver */
+    H5FD_ctl_mapped_view_args_t op_args;             /* Arguments for ctl request */
+    void                       *view      = NULL;    /* Pointer into the mapping */
+    herr_t                      ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(dset);
+    assert(mem_type);
+    assert(buf);
+
+    *buf = NULL;
+
+    /* Check that the data is stored in one piece in the HDF5 file */
+    if (H5D_CONTIGUOUS != dset->shared->layout.type || dset->shared->dcpl_cache.efl.nused > 0 ||
+        !H5_addr_defined(dset->shared->layout.storage.u.contig.addr) ||
+        dset->shared->layout.storage.u.contig.size > (hsize_t)SIZE_MAX)
+        HGOTO_DONE(SUCCEED);
+
+    /* The data must be usable without datatype conversion */
+    if (NULL == (tpath = H5T_path_find(dset->shared->type, mem_type)))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to convert between src and dest datatype");
+    if (!H5T_path_noop(tpath))
+        HGOTO_DONE(SUCCEED);
+
+    /* The file must not be writable */
+    if (H5F_INTENT(dset->oloc.file) & H5F_ACC_RDWR)
+        HGOTO_DONE(SUCCEED);
+
+    /* Ask the file driver for the data in its mapping of the file */
+    if (H5F_shared_get_file_driver(H5F_SHARED(dset->oloc.file), &file_handle) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get file driver");
+
+    op_args.addr = dset->shared->layout.storage.u.contig.addr + H5FD_get_base_addr(file_handle);
+    op_args.size = (size_t)dset->shared->layout.storage.u.contig.size;
+    if (H5FD_ctl(file_handle, H5FD_CTL_GET_MAPPED_VIEW_OPCODE, H5FD_CTL_ROUTE_TO_TERMINAL_VFD_FLAG, &op_args,
+                 &view) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "VFD mapped view request failed");
+
+    *buf = view;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__read_view() */
+
 /*-------------------------------------------------------------------------
  * Function: H5D__vlen_get_buf_size_alloc
  *
@@ -3249,27 +3374,24 @@ done:
 herr_t
 H5D__flush_sieve_buf(H5D_t *dataset)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
     /* Check args */
     assert(dataset);
 
-    /* Flush the raw data buffer, if we have a dirty one */
-    if (dataset->shared->cache.contig.sieve_buf && dataset->shared->cache.contig.sieve_dirty) {
-        assert(dataset->shared->layout.type !=
-               H5D_COMPACT); /* We should never have a sieve buffer for compact storage */
+    /* Flush the raw data buffers, if we have dirty ones */
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_sieve_win_t *win = &dataset->shared->cache.contig.win[u];
 
-        /* Write dirty data sieve buffer to file */
-        if (H5F_shared_block_write(
-                H5F_SHARED(dataset->oloc.file), H5FD_MEM_DRAW, dataset->shared->cache.contig.sieve_loc,
-                dataset->shared->cache.contig.sieve_size, dataset->shared->cache.contig.sieve_buf) < 0)
-            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed");
+        /* We should never have a sieve buffer for compact storage */
+        assert(!win->sieve_buf || dataset->shared->layout.type != H5D_COMPACT);
 
-        /* Reset sieve buffer dirty flag */
-        dataset->shared->cache.contig.sieve_dirty = false;
-    } /* end if */
+        if (H5D__contig_sieve_flush_win(H5F_SHARED(dataset->oloc.file), win) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to flush sieve buffer");
+    } /* end for */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -31,6 +31,21 @@
 /* Local Macros */
 /****************/
 
+/* Size of the pages that an I/O operation's arena carves memory from.  Large
+ * enough for the chunk map, a few piece infos and the selection I/O arrays of
+ * a small selection, so most operations need a single page. */
+#define H5D_IO_ARENA_PAGE_SIZE 4096
+
+/* Alignment of the blocks handed out from an arena.  This matches the blocks
+ * returned from the block free lists the pages come from. */
+#define H5D_IO_ARENA_ALIGN sizeof(H5FL_blk_list_t)
+
+/* Round a size up to the arena alignment */
+#define H5D_IO_ARENA_ROUND(S) ((((S) + H5D_IO_ARENA_ALIGN - 1) / H5D_IO_ARENA_ALIGN) * H5D_IO_ARENA_ALIGN)
+
+/* Size of a page header, rounded up so that the blocks after it are aligned */
+#define H5D_IO_ARENA_HDR_SIZE H5D_IO_ARENA_ROUND(sizeof(H5D_io_arena_page_t))
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -51,6 +66,7 @@ static herr_t H5D__typeinfo_init_phase3(H5D_io_info_t *io_info);
 static herr_t H5D__ioinfo_adjust(H5D_io_info_t *io_info);
 #endif /* H5_HAVE_PARALLEL */
 static herr_t H5D__typeinfo_term(H5D_io_info_t *io_info);
+static void   H5D__io_arena_release(H5D_io_info_t *io_info);
 
 /*********************/
 /* Package Variables */
@@ -63,6 +79,9 @@ static herr_t H5D__typeinfo_term(H5D_io_info_t *io_info);
 /* Declare a free list to manage blocks of type conversion data */
 H5FL_BLK_DEFINE(type_conv);
 
+/* Declare a free list to manage the pages of I/O operation arenas */
+H5FL_BLK_DEFINE_STATIC(io_arena_page);
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__read
  *
@@ -122,7 +141,7 @@ H5D__read(size_t count, H5D_dset_io_info_t *dset_info)
 
     /* Allocate store buffer if necessary */
     if (count > 1)
-        if (NULL == (store = (H5D_storage_t *)H5MM_malloc(count * sizeof(H5D_storage_t))))
+        if (NULL == (store = (H5D_storage_t *)H5D__io_arena_malloc(&io_info, count * sizeof(H5D_storage_t))))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate dset storage info array buffer");
 
 #ifdef H5_HAVE_PARALLEL
@@ -203,9 +222,11 @@ H5D__read(size_t count, H5D_dset_io_info_t *dset_info)
             if (!orig_mem_space) {
                 if (count > 1) {
                     /* Allocate buffer */
-                    if (NULL == (orig_mem_space = (H5S_t **)H5MM_calloc(count * sizeof(H5S_t *))))
+                    if (NULL == (orig_mem_space = (H5S_t **)H5D__io_arena_malloc(
+                                     &io_info, count * sizeof(H5S_t *))))
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
                                     "couldn't allocate original memory space array buffer");
+                    memset(orig_mem_space, 0, count * sizeof(H5S_t *));
                 }
                 else
                     /* Use local buffer */
@@ -328,8 +349,8 @@ H5D__read(size_t count, H5D_dset_io_info_t *dset_info)
             assert(io_info.pieces_added == 0);
 
             /* Allocate sel_pieces array */
-            if (NULL ==
-                (io_info.sel_pieces = H5MM_malloc(io_info.piece_count * sizeof(io_info.sel_pieces[0]))))
+            if (NULL == (io_info.sel_pieces = H5D__io_arena_malloc(
+                             &io_info, io_info.piece_count * sizeof(io_info.sel_pieces[0]))))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate array of selected pieces");
         }
 
@@ -363,24 +384,29 @@ H5D__read(size_t count, H5D_dset_io_info_t *dset_info)
 
         /* Allocate selection I/O parameter arrays if necessary */
         if (!H5D_LAYOUT_CB_PERFORM_IO(&io_info) && io_info.piece_count > 0) {
-            if (NULL == (io_info.mem_spaces = H5MM_malloc(io_info.piece_count * sizeof(H5S_t *))))
+            if (NULL == (io_info.mem_spaces =
+                             H5D__io_arena_malloc(&io_info, io_info.piece_count * sizeof(H5S_t *))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                             "memory allocation failed for memory space list");
-            if (NULL == (io_info.file_spaces = H5MM_malloc(io_info.piece_count * sizeof(H5S_t *))))
+            if (NULL == (io_info.file_spaces =
+                             H5D__io_arena_malloc(&io_info, io_info.piece_count * sizeof(H5S_t *))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                             "memory allocation failed for file space list");
-            if (NULL == (io_info.addrs = H5MM_malloc(io_info.piece_count * sizeof(haddr_t))))
+            if (NULL == (io_info.addrs =
+                             H5D__io_arena_malloc(&io_info, io_info.piece_count * sizeof(haddr_t))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                             "memory allocation failed for piece address list");
-            if (NULL == (io_info.element_sizes = H5MM_malloc(io_info.piece_count * sizeof(size_t))))
+            if (NULL == (io_info.element_sizes =
+                             H5D__io_arena_malloc(&io_info, io_info.piece_count * sizeof(size_t))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                             "memory allocation failed for element size list");
-            if (NULL == (io_info.rbufs = H5MM_malloc(io_info.piece_count * sizeof(void *))))
+            if (NULL == (io_info.rbufs =
+                             H5D__io_arena_malloc(&io_info, io_info.piece_count * sizeof(void *))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                             "memory allocation failed for read buffer list");
             if (io_info.max_tconv_type_size > 0)
-                if (NULL ==
-                    (io_info.sel_pieces = H5MM_malloc(io_info.piece_count * sizeof(io_info.sel_pieces[0]))))
+                if (NULL == (io_info.sel_pieces = H5D__io_arena_malloc(
+                                 &io_info, io_info.piece_count * sizeof(io_info.sel_pieces[0]))))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                                 "unable to allocate array of selected pieces");
         }
@@ -467,25 +493,11 @@ done:
                                 "unable to shut down projected memory dataspace");
                 dset_info[i].mem_space = orig_mem_space[i];
             }
-
-        /* Free orig_mem_space array if it was allocated */
-        if (orig_mem_space != &orig_mem_space_local)
-            H5MM_free(orig_mem_space);
     }
 
-    /* Free global piece array */
-    H5MM_xfree(io_info.sel_pieces);
-
-    /* Free selection I/O arrays */
-    H5MM_xfree(io_info.mem_spaces);
-    H5MM_xfree(io_info.file_spaces);
-    H5MM_xfree(io_info.addrs);
-    H5MM_xfree(io_info.element_sizes);
-    H5MM_xfree(io_info.rbufs);
-
-    /* Free store array if it was allocated */
-    if (store != &store_local)
-        H5MM_free(store);
+    /* Release the piece arrays, selection I/O arrays, store array and all
+     * other memory allocated for the operation */
+    H5D__io_arena_release(&io_info);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__read() */
@@ -549,7 +561,7 @@ H5D__write(size_t count, H5D_dset_io_info_t *dset_info)
 
     /* Allocate store buffer if necessary */
     if (count > 1)
-        if (NULL == (store = (H5D_storage_t *)H5MM_malloc(count * sizeof(H5D_storage_t))))
+        if (NULL == (store = (H5D_storage_t *)H5D__io_arena_malloc(&io_info, count * sizeof(H5D_storage_t))))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate dset storage info array buffer");
 
     /* Iterate over all dsets and construct I/O information */
@@ -655,9 +667,11 @@ H5D__write(size_t count, H5D_dset_io_info_t *dset_info)
             if (!orig_mem_space) {
                 if (count > 1) {
                     /* Allocate buffer */
-                    if (NULL == (orig_mem_space = (H5S_t **)H5MM_calloc(count * sizeof(H5S_t *))))
+                    if (NULL == (orig_mem_space = (H5S_t **)H5D__io_arena_malloc(
+                                     &io_info, count * sizeof(H5S_t *))))
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
                                     "couldn't allocate original memory space array buffer");
+                    memset(orig_mem_space, 0, count * sizeof(H5S_t *));
                 }
                 else
                     /* Use local buffer */
@@ -766,8 +780,8 @@ H5D__write(size_t count, H5D_dset_io_info_t *dset_info)
             assert(io_info.pieces_added == 0);
 
             /* Allocate sel_pieces array */
-            if (NULL ==
-                (io_info.sel_pieces = H5MM_malloc(io_info.piece_count * sizeof(io_info.sel_pieces[0]))))
+            if (NULL == (io_info.sel_pieces = H5D__io_arena_malloc(
+                             &io_info, io_info.piece_count * sizeof(io_info.sel_pieces[0]))))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate array of selected pieces");
         }
 
@@ -796,24 +810,29 @@ H5D__write(size_t count, H5D_dset_io_info_t *dset_info)
 
         /* Allocate selection I/O parameter arrays if necessary */
         if (!H5D_LAYOUT_CB_PERFORM_IO(&io_info) && io_info.piece_count > 0) {
-            if (NULL == (io_info.mem_spaces = H5MM_malloc(io_info.piece_count * sizeof(H5S_t *))))
+            if (NULL == (io_info.mem_spaces =
+                             H5D__io_arena_malloc(&io_info, io_info.piece_count * sizeof(H5S_t *))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                             "memory allocation failed for memory space list");
-            if (NULL == (io_info.file_spaces = H5MM_malloc(io_info.piece_count * sizeof(H5S_t *))))
+            if (NULL == (io_info.file_spaces =
+                             H5D__io_arena_malloc(&io_info, io_info.piece_count * sizeof(H5S_t *))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                             "memory allocation failed for file space list");
-            if (NULL == (io_info.addrs = H5MM_malloc(io_info.piece_count * sizeof(haddr_t))))
+            if (NULL == (io_info.addrs =
+                             H5D__io_arena_malloc(&io_info, io_info.piece_count * sizeof(haddr_t))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                             "memory allocation failed for piece address list");
-            if (NULL == (io_info.element_sizes = H5MM_malloc(io_info.piece_count * sizeof(size_t))))
+            if (NULL == (io_info.element_sizes =
+                             H5D__io_arena_malloc(&io_info, io_info.piece_count * sizeof(size_t))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                             "memory allocation failed for element size list");
-            if (NULL == (io_info.wbufs = H5MM_malloc(io_info.piece_count * sizeof(const void *))))
+            if (NULL == (io_info.wbufs =
+                             H5D__io_arena_malloc(&io_info, io_info.piece_count * sizeof(const void *))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                             "memory allocation failed for write buffer list");
             if (io_info.max_tconv_type_size > 0)
-                if (NULL ==
-                    (io_info.sel_pieces = H5MM_malloc(io_info.piece_count * sizeof(io_info.sel_pieces[0]))))
+                if (NULL == (io_info.sel_pieces = H5D__io_arena_malloc(
+                                 &io_info, io_info.piece_count * sizeof(io_info.sel_pieces[0]))))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                                 "unable to allocate array of selected pieces");
         }
@@ -896,25 +915,11 @@ done:
                                 "unable to shut down projected memory dataspace");
                 dset_info[i].mem_space = orig_mem_space[i];
             }
-
-        /* Free orig_mem_space array if it was allocated */
-        if (orig_mem_space != &orig_mem_space_local)
-            H5MM_free(orig_mem_space);
     }
 
-    /* Free global piece array */
-    H5MM_xfree(io_info.sel_pieces);
-
-    /* Free selection I/O arrays */
-    H5MM_xfree(io_info.mem_spaces);
-    H5MM_xfree(io_info.file_spaces);
-    H5MM_xfree(io_info.addrs);
-    H5MM_xfree(io_info.element_sizes);
-    H5MM_xfree(io_info.wbufs);
-
-    /* Free store array if it was allocated */
-    if (store != &store_local)
-        H5MM_free(store);
+    /* Release the piece arrays, selection I/O arrays, store array and all
+     * other memory allocated for the operation */
+    H5D__io_arena_release(&io_info);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__write */
@@ -1512,3 +1517,114 @@ H5D__typeinfo_term(H5D_io_info_t *io_info)
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5D__typeinfo_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__io_arena_malloc
+ *
+ * Purpose:     Allocates a block of memory that lives as long as the I/O
+ *              operation described by IO_INFO.  The block is carved from
+ *              the operation's arena and can't be freed on its own; all
+ *              the blocks are released together when the operation
+ *              finishes.
+ *
+ * Return:      Success:    Pointer to the block
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5D__io_arena_malloc(H5D_io_info_t *io_info, size_t size)
+{
+    H5D_io_arena_t      *arena = &io_info->arena; /* The operation's arena */
+    H5D_io_arena_page_t *page;                    /* New page for the arena */
+    void                *ret_value = NULL;        /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(io_info);
+    assert(size > 0);
+
+    if (size > SIZE_MAX - (H5D_IO_ARENA_HDR_SIZE + H5D_IO_ARENA_ALIGN))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "arena block size is too large");
+    size = H5D_IO_ARENA_ROUND(size);
+
+    /* Carve the block from the current page if there's room left in it */
+    if (arena->pages && size <= arena->pages->size - arena->used) {
+        ret_value = (uint8_t *)arena->pages + arena->used;
+        arena->used += size;
+    } /* end if */
+    else if (size > H5D_IO_ARENA_PAGE_SIZE - H5D_IO_ARENA_HDR_SIZE) {
+        /* Give blocks too large for a page a page of their own.  These can
+         * be arbitrarily large (e.g. the piece arrays for an I/O touching
+         * many chunks), so they bypass the free lists. */
+        if (NULL == (page = (H5D_io_arena_page_t *)H5MM_malloc(H5D_IO_ARENA_HDR_SIZE + size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "unable to allocate arena page");
+        page->size = H5D_IO_ARENA_HDR_SIZE + size;
+
+        /* Link the page in behind the current one, so the space left in the
+         * current page is still used by later allocations */
+        if (arena->pages) {
+            page->next         = arena->pages->next;
+            arena->pages->next = page;
+        } /* end if */
+        else {
+            page->next   = NULL;
+            arena->pages = page;
+            arena->used  = page->size;
+        } /* end else */
+
+        ret_value = (uint8_t *)page + H5D_IO_ARENA_HDR_SIZE;
+    } /* end if */
+    else {
+        /* Start a new page */
+        if (NULL == (page = (H5D_io_arena_page_t *)(void *)H5FL_BLK_MALLOC(io_arena_page,
+                                                                           H5D_IO_ARENA_PAGE_SIZE)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "unable to allocate arena page");
+        page->size   = H5D_IO_ARENA_PAGE_SIZE;
+        page->next   = arena->pages;
+        arena->pages = page;
+        arena->used  = H5D_IO_ARENA_HDR_SIZE + size;
+
+        ret_value = (uint8_t *)page + H5D_IO_ARENA_HDR_SIZE;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_arena_malloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__io_arena_release
+ *
+ * Purpose:     Releases all the memory allocated from the arena of the I/O
+ *              operation described by IO_INFO.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__io_arena_release(H5D_io_info_t *io_info)
+{
+    H5D_io_arena_page_t *page; /* Current page */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(io_info);
+
+    page = io_info->arena.pages;
+    while (page) {
+        H5D_io_arena_page_t *next = page->next; /* Next page */
+
+        if (page->size == H5D_IO_ARENA_PAGE_SIZE)
+            (void)H5FL_BLK_FREE(io_arena_page, page);
+        else
+            H5MM_free(page);
+
+        page = next;
+    } /* end while */
+
+    io_info->arena.pages = NULL;
+    io_info->arena.used  = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__io_arena_release() */
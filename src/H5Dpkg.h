@@ -45,6 +45,9 @@
 #define H5D_MARK_SPACE  0x01
 #define H5D_MARK_LAYOUT 0x02
 
+/* # of data sieve windows for a contiguous dataset, i.e. of access streams followed */
+#define H5D_SIEVE_NWINDOWS 4
+
 /* Default creation parameters for chunk index data structures */
 /* See H5O_layout_chunk_t */
 
@@ -284,6 +287,21 @@ typedef struct H5D_dset_io_info_t {
 } H5D_dset_io_info_t;
 
 /* I/O info for entire I/O operation */
+/* Header of a page of memory in an I/O operation's arena */
+typedef struct H5D_io_arena_page_t {
+    struct H5D_io_arena_page_t *next; /* Next page in the arena */
+    size_t                      size; /* Size of the page, including this header */
+} H5D_io_arena_page_t;
+
+/* Bump-pointer arena for the memory that lives as long as a single I/O
+ * operation (piece infos, chunk maps, piece arrays, etc.).  Blocks are carved
+ * from pages in order and never freed individually; all the pages are
+ * released together when the operation finishes. */
+typedef struct H5D_io_arena_t {
+    H5D_io_arena_page_t *pages; /* Pages allocated, the current page first */
+    size_t               used;  /* Bytes used in the current page, including its header */
+} H5D_io_arena_t;
+
 typedef struct H5D_io_info_t {
     /* QAK: Delete the f_sh field when oloc has a shared file pointer? */
     H5F_shared_t *f_sh; /* Pointer to shared file struct that dataset is within */
@@ -323,7 +341,8 @@ typedef struct H5D_io_info_t {
 #ifdef H5_HAVE_PARALLEL
     H5D_mpio_actual_io_mode_t actual_io_mode; /* Actual type of collective or independent I/O */
 #endif                                        /* H5_HAVE_PARALLEL */
-    unsigned no_selection_io_cause;           /* "No selection I/O cause" flags */
+    unsigned       no_selection_io_cause;     /* "No selection I/O cause" flags */
+    H5D_io_arena_t arena;                     /* Memory for the duration of the operation */
 } H5D_io_info_t;
 
 /* Created to pass both at once for callback func */
@@ -457,6 +476,7 @@ typedef struct H5D_chunk_map_t {
     H5S_t            *single_space;      /* Dataspace for single chunk */
     H5D_piece_info_t *single_piece_info; /* Pointer to single chunk's info */
     bool              use_single;        /* Whether I/O is on a single element */
+    bool              private_sel; /* Whether the selection structures above belong to this I/O only */
 
     hsize_t           last_index;      /* Index of last chunk operated on */
     H5D_piece_info_t *last_piece_info; /* Pointer to last chunk's info */
@@ -496,6 +516,7 @@ typedef struct H5D_rdcc_t {
     size_t                 nbytes_max; /* Maximum cached raw data in bytes    */
     size_t                 nslots;     /* Number of chunk slots allocated    */
     double                 w0;         /* Chunk preemption policy          */
+    bool                   skip_fill;  /* Leave chunks of fill values unallocated */
     struct H5D_rdcc_ent_t *head;       /* Head of doubly linked list        */
     struct H5D_rdcc_ent_t *tail;       /* Tail of doubly linked list        */
     struct H5D_rdcc_ent_t
@@ -515,13 +536,28 @@ typedef struct H5D_rdcc_t {
     unsigned scaled_encode_bits[H5S_MAX_RANK]; /* The number of bits needed to encode the scaled dim sizes */
 } H5D_rdcc_t;
 
-/* The raw data contiguous data cache */
-typedef struct H5D_rdcdc_t {
+/* A data sieve window of the raw data contiguous data cache.  Each window
+ * follows one stream of accesses to the dataset, and caches the data around
+ * the stream's latest access, if sieving helps the stream.
+ */
+typedef struct H5D_sieve_win_t {
     unsigned char *sieve_buf;      /* Buffer to hold data sieve buffer */
-    haddr_t        sieve_loc;      /* File location (offset) of the data sieve buffer */
-    size_t         sieve_size;     /* Size of the data sieve buffer used (in bytes) */
     size_t         sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
+    haddr_t        sieve_loc;      /* File location (offset) of the data sieve buffer */
+    size_t         sieve_size;     /* Size of the data sieve buffer used (in bytes), 0 if none */
     bool           sieve_dirty;    /* Flag to indicate that the data sieve buffer is dirty */
+    bool           active;         /* Whether the window follows a stream */
+    haddr_t        last_addr;      /* File location of the stream's last access */
+    size_t         nhits;          /* # of accesses served by the window's data */
+    uint64_t       last_use;       /* Stamp of the window's last use, for replacement */
+} H5D_sieve_win_t;
+
+/* The raw data contiguous data cache */
+typedef struct H5D_rdcdc_t {
+    H5D_sieve_win_t win[H5D_SIEVE_NWINDOWS]; /* Data sieve windows */
+    size_t          sieve_buf_size;          /* Size of a window's data, except when reading ahead */
+    uint64_t        use_count;               /* Counter for the windows' use stamps */
+    unsigned        nfar;                    /* # of consecutive accesses far from every stream */
 } H5D_rdcdc_t;
 
 /*
@@ -659,6 +695,7 @@ H5_DLL herr_t  H5D__get_chunk_info_by_coord(const H5D_t *dset, const hsize_t *co
                                             haddr_t *addr, hsize_t *size);
 H5_DLL herr_t  H5D__chunk_iter(H5D_t *dset, H5D_chunk_iter_op_t cb, void *op_data);
 H5_DLL haddr_t H5D__get_offset(const H5D_t *dset);
+H5_DLL herr_t  H5D__read_view(const H5D_t *dset, const H5T_t *mem_type, const void **buf);
 H5_DLL herr_t  H5D__vlen_get_buf_size(H5D_t *dset, hid_t type_id, hid_t space_id, hsize_t *size);
 H5_DLL herr_t  H5D__vlen_get_buf_size_gen(H5VL_object_t *vol_obj, hid_t type_id, hid_t space_id,
                                           hsize_t *size);
@@ -675,6 +712,7 @@ H5_DLL herr_t H5D__format_convert(H5D_t *dataset);
 /* Internal I/O routines */
 H5_DLL herr_t H5D__read(size_t count, H5D_dset_io_info_t *dset_info);
 H5_DLL herr_t H5D__write(size_t count, H5D_dset_io_info_t *dset_info);
+H5_DLL void  *H5D__io_arena_malloc(H5D_io_info_t *io_info, size_t size);
 
 /* Functions that perform direct serial I/O operations */
 H5_DLL herr_t H5D__select_read(const H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset_info);
@@ -692,6 +730,9 @@ H5_DLL herr_t H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_dset_io
 H5_DLL herr_t H5D__scatgath_write(const H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset_info);
 H5_DLL herr_t H5D__scatgath_read_select(H5D_io_info_t *io_info);
 H5_DLL herr_t H5D__scatgath_write_select(H5D_io_info_t *io_info);
+#ifdef H5_HAVE_THREADSAFE_API
+H5_DLL herr_t H5D__scatgath_term(void);
+#endif /* H5_HAVE_THREADSAFE_API */
 
 /* Functions that operate on dataset's layout information */
 H5_DLL herr_t H5D__layout_set_io_ops(const H5D_t *dataset);
@@ -707,6 +748,8 @@ H5_DLL herr_t H5D__layout_oh_write(const H5D_t *dataset, H5O_t *oh, unsigned upd
 H5_DLL herr_t H5D__contig_alloc(H5F_t *f, H5O_storage_contig_t *storage);
 H5_DLL bool   H5D__contig_is_space_alloc(const H5O_storage_t *storage);
 H5_DLL bool   H5D__contig_is_data_cached(const H5D_shared_t *shared_dset);
+H5_DLL herr_t H5D__contig_sieve_flush_win(H5F_shared_t *f_sh, H5D_sieve_win_t *win);
+H5_DLL void   H5D__contig_free_sieve(H5D_rdcdc_t *dset_contig);
 H5_DLL herr_t H5D__contig_fill(H5D_t *dset);
 H5_DLL herr_t H5D__contig_read(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo);
 H5_DLL herr_t H5D__contig_write(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo);
@@ -54,6 +54,7 @@
 #define H5D_ACS_VDS_PREFIX_NAME           "vds_prefix"           /* VDS file prefix */
 #define H5D_ACS_APPEND_FLUSH_NAME         "append_flush"         /* Append flush actions */
 #define H5D_ACS_EFILE_PREFIX_NAME         "external file prefix" /* External file prefix */
+#define H5D_ACS_SKIP_FILL_CHUNKS_NAME     "skip_fill_chunks"     /* Skip writing chunks of fill values */
 
 /* ======== Data transfer properties ======== */
 #define H5D_XFER_MAX_TEMP_BUF_NAME          "max_temp_buf"        /* Maximum temp buffer size */
@@ -88,6 +89,7 @@
 #define H5D_XFER_NO_SELECTION_IO_CAUSE_NAME    "no_selection_io_cause" /* Cause for no selection I/O */
 #define H5D_XFER_ACTUAL_SELECTION_IO_MODE_NAME "actual_selection_io_mode" /* Actual selection I/O mode */
 #define H5D_XFER_MODIFY_WRITE_BUF_NAME         "modify_write_buf"         /* Modify write buffers */
+#define H5D_XFER_DSET_IO_THREADS_NAME          "dset_io_threads"          /* Threads for dataset I/O */
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
 /* Collective chunk instrumentation properties */
 #define H5D_XFER_COLL_CHUNK_LINK_HARD_NAME        "coll_chunk_link_hard"
@@ -170,6 +172,7 @@ typedef struct H5D_append_flush_t {
 
 H5_DLL herr_t      H5D_init(void);
 H5_DLL H5D_t      *H5D_open(const H5G_loc_t *loc, hid_t dapl_id);
+H5_DLL H5D_t      *H5D_reopen(H5D_t *dataset);
 H5_DLL herr_t      H5D_close(H5D_t *dataset);
 H5_DLL herr_t      H5D_mult_refresh_close(hid_t dset_id);
 H5_DLL herr_t      H5D_mult_refresh_reopen(H5D_t *dataset);
@@ -811,6 +811,41 @@ H5_DLL herr_t H5Dget_chunk_info(hid_t dset_id, hid_t fspace_id, hsize_t chk_idx,
  */
 H5_DLL haddr_t H5Dget_offset(hid_t dset_id);
 
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Returns a pointer to a dataset's raw data in the file's mapping
+ *
+ * \dset_id
+ * \param[in]  mem_type_id Identifier of the memory datatype
+ * \param[out] buf         Pointer to the dataset's raw data, or NULL
+ *
+ * \return \herr_t
+ *
+ * \details H5Dread_view() lets an application use the raw data of the
+ *          dataset \p dset_id where it lies in memory, instead of copying
+ *          it into a buffer with H5Dread(). On return, \p buf points to
+ *          all of the dataset's elements, laid out exactly as H5Dread()
+ *          would return them for \p mem_type_id with #H5S_ALL selections.
+ *
+ *          A view can only be returned when the file driver keeps the file
+ *          mapped into memory, as the memory-mapped driver (#H5FD_MMAP)
+ *          does, when the file is open read-only, when the dataset has
+ *          contiguous storage that has been allocated in the HDF5 file,
+ *          and when no datatype conversion is needed from the dataset's
+ *          datatype to \p mem_type_id. Otherwise \p buf is set to NULL and
+ *          the function still succeeds, so that the application can fall
+ *          back to H5Dread().
+ *
+ *          The data must not be modified. \p buf remains valid until the
+ *          file and all objects opened in it are closed.
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Dread_view(hid_t dset_id, hid_t mem_type_id, const void **buf /*out*/);
+
 /**
  * --------------------------------------------------------------------------
  * \ingroup H5D
@@ -25,6 +25,7 @@
 #include "H5Eprivate.h"  /* Error handling		  	*/
 #include "H5FLprivate.h" /* Free Lists                           */
 #include "H5MMprivate.h" /* Memory management			*/
+#include "H5TSprivate.h" /* Threadsafety                         */
 
 /****************/
 /* Local Macros */
@@ -45,6 +46,36 @@
 /* Local Typedefs */
 /******************/
 
+/* A piece whose type conversion and scatter/gather may run on a worker thread */
+typedef struct H5D_scatgath_par_piece_t {
+    const H5D_type_info_t *type_info; /* Datatype info for the piece's dataset */
+    size_t                 nelmts;    /* Number of elements in the piece */
+    void                  *tconv_buf; /* Piece's data in the type conversion buffer */
+    void                  *rbuf;      /* Application buffer to scatter to (reads) */
+    const void            *wbuf;      /* Application buffer to gather from (writes) */
+    H5S_sel_iter_t        *mem_iter;  /* Memory selection iterator (NULL for in-place conversion) */
+} H5D_scatgath_par_piece_t;
+
+/* Info for converting the pieces of a selection I/O operation on several threads */
+typedef struct H5D_scatgath_par_t {
+    bool                      is_read;  /* Whether the operation is a read */
+    unsigned                  nthreads; /* Number of threads to use, including the calling thread */
+    bool                     *eligible; /* Whether each piece is converted on the threads (NULL for none) */
+    unsigned                  npieces;  /* Number of pieces converted on the threads */
+    H5D_scatgath_par_piece_t *pieces;   /* Pieces converted on the threads */
+    H5S_sel_iter_t           *iters;    /* Memory selection iterators for the pieces */
+    size_t                    vec_size; /* Vector length for the scatter/gather sequence lists */
+    H5T_conv_ctx_t            conv_ctx; /* Conversion context shared by the threads */
+#ifdef H5_HAVE_THREADSAFE_API
+    H5TS_atomic_uint_t  next_piece; /* Index of the next piece to convert */
+    H5TS_atomic_int_t   nerrors;    /* Number of pieces that failed */
+    H5TS_atomic_uint_t  nrunning;   /* Number of worker threads that haven't finished */
+    H5TS_mutex_t        mutex;      /* Mutex for waiting on the worker threads */
+    H5TS_cond_t         cond;       /* Signaled when the last worker thread finishes */
+    struct H5E_stack_t *err_stack;  /* Errors of the first worker thread that failed */
+#endif
+} H5D_scatgath_par_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -55,6 +86,18 @@ static size_t H5D__gather_file(const H5D_io_info_t *io_info, const H5D_dset_io_i
 static herr_t H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter, const H5D_type_info_t *type_info,
                                      uint8_t *tconv_buf, void *user_buf /*out*/);
 static herr_t H5D__compound_opt_write(size_t nelmts, const H5D_type_info_t *type_info, void *tconv_buf);
+static herr_t H5D__scatter_mem_vec(const void *_tscat_buf, H5S_sel_iter_t *iter, size_t nelmts,
+                                   size_t vec_size, void *_buf /*out*/);
+static size_t H5D__gather_mem_vec(const void *_buf, H5S_sel_iter_t *iter, size_t nelmts, size_t vec_size,
+                                  void *_tgath_buf /*out*/);
+static herr_t H5D__scatgath_par_init(H5D_io_info_t *io_info, bool is_read, H5D_scatgath_par_t *par);
+#ifdef H5_HAVE_THREADSAFE_API
+static herr_t H5D__scatgath_par_piece(const H5D_scatgath_par_t *par, const H5D_scatgath_par_piece_t *piece);
+static void   H5D__scatgath_par_claim(H5D_scatgath_par_t *par, bool worker);
+static H5TS_THREAD_RETURN_TYPE H5D__scatgath_par_worker(void *_par);
+static herr_t                  H5D__scatgath_par_pool(unsigned nthreads);
+static herr_t H5D__scatgath_par_run(H5D_io_info_t *io_info, H5D_scatgath_par_t *par, const void *const *bufs);
+#endif
 
 /*********************/
 /* Package Variables */
@@ -73,6 +116,14 @@ H5FL_SEQ_EXTERN(size_t);
 /* Declare extern free list to manage sequences of hsize_t */
 H5FL_SEQ_EXTERN(hsize_t);
 
+#ifdef H5_HAVE_THREADSAFE_API
+/* Worker threads for type conversion, kept for the life of the library, and
+ * the number of threads in the pool.  Only used while holding the API lock.
+ */
+static H5TS_pool_t *H5D_scatgath_pool_s      = NULL;
+static unsigned     H5D_scatgath_pool_size_s = 0;
+#endif
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__scatter_file
  *
@@ -284,6 +335,40 @@ done:
  */
 herr_t
 H5D__scatter_mem(const void *_tscat_buf, H5S_sel_iter_t *iter, size_t nelmts, void *_buf /*out*/)
+{
+    size_t dxpl_vec_size;       /* Vector length from API context's DXPL */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Get info from API context */
+    if (H5CX_get_vec_size(&dxpl_vec_size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve I/O vector size");
+
+    /* Scatter the data */
+    if (H5D__scatter_mem_vec(_tscat_buf, iter, nelmts, MAX(dxpl_vec_size, H5D_IO_VECTOR_SIZE), _buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "scatter failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__scatter_mem() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatter_mem_vec
+ *
+ * Purpose:	Scatters NELMTS data points from the scatter buffer
+ *		TSCAT_BUF to the application buffer BUF, generating
+ *		sequence lists of VEC_SIZE sequences at a time.  Does not
+ *		use the API context, so it may be called from worker
+ *		threads.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__scatter_mem_vec(const void *_tscat_buf, H5S_sel_iter_t *iter, size_t nelmts, size_t vec_size,
+                     void *_buf /*out*/)
 {
     uint8_t       *buf       = (uint8_t *)_buf; /* Get local copies for address arithmetic */
     const uint8_t *tscat_buf = (const uint8_t *)_tscat_buf;
@@ -293,8 +378,6 @@ H5D__scatter_mem(const void *_tscat_buf, H5S_sel_iter_t *iter, size_t nelmts, vo
     size_t         nseq;                /* Number of sequences generated */
     size_t         curr_seq;            /* Current sequence being processed */
     size_t         nelem;               /* Number of elements used in sequences */
-    size_t         dxpl_vec_size;       /* Vector length from API context's DXPL */
-    size_t         vec_size;            /* Vector length */
     herr_t         ret_value = SUCCEED; /* Number of elements scattered */
 
     FUNC_ENTER_PACKAGE
@@ -303,17 +386,10 @@ H5D__scatter_mem(const void *_tscat_buf, H5S_sel_iter_t *iter, size_t nelmts, vo
     assert(tscat_buf);
     assert(iter);
     assert(nelmts > 0);
+    assert(vec_size > 0);
     assert(buf);
 
-    /* Get info from API context */
-    if (H5CX_get_vec_size(&dxpl_vec_size) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve I/O vector size");
-
     /* Allocate the vector I/O arrays */
-    if (dxpl_vec_size > H5D_IO_VECTOR_SIZE)
-        vec_size = dxpl_vec_size;
-    else
-        vec_size = H5D_IO_VECTOR_SIZE;
     if (NULL == (len = H5FL_SEQ_MALLOC(size_t, vec_size)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O length vector array");
     if (NULL == (off = H5FL_SEQ_MALLOC(hsize_t, vec_size)))
@@ -348,7 +424,7 @@ done:
         off = H5FL_SEQ_FREE(hsize_t, off);
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* H5D__scatter_mem() */
+} /* H5D__scatter_mem_vec() */
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__gather_mem
@@ -366,6 +442,43 @@ done:
  */
 size_t
 H5D__gather_mem(const void *_buf, H5S_sel_iter_t *iter, size_t nelmts, void *_tgath_buf /*out*/)
+{
+    size_t dxpl_vec_size; /* Vector length from API context's DXPL */
+    size_t ret_value = 0; /* Number of elements gathered */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Get info from API context */
+    if (H5CX_get_vec_size(&dxpl_vec_size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, 0, "can't retrieve I/O vector size");
+
+    /* Gather the data */
+    if (nelmts !=
+        H5D__gather_mem_vec(_buf, iter, nelmts, MAX(dxpl_vec_size, H5D_IO_VECTOR_SIZE), _tgath_buf))
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, 0, "gather failed");
+
+    ret_value = nelmts;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__gather_mem() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__gather_mem_vec
+ *
+ * Purpose:	Gathers NELMTS dataset elements from application memory
+ *		BUF into the gather buffer TGATH_BUF, generating sequence
+ *		lists of VEC_SIZE sequences at a time.  Does not use the API
+ *		context, so it may be called from worker threads.
+ *
+ * Return:	Success:	Number of elements copied.
+ *		Failure:	0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5D__gather_mem_vec(const void *_buf, H5S_sel_iter_t *iter, size_t nelmts, size_t vec_size,
+                    void *_tgath_buf /*out*/)
 {
     const uint8_t *buf       = (const uint8_t *)_buf; /* Get local copies for address arithmetic */
     uint8_t       *tgath_buf = (uint8_t *)_tgath_buf;
@@ -375,8 +488,6 @@ H5D__gather_mem(const void *_buf, H5S_sel_iter_t *iter, size_t nelmts, void *_tg
     size_t         nseq;               /* Number of sequences generated */
     size_t         curr_seq;           /* Current sequence being processed */
     size_t         nelem;              /* Number of elements used in sequences */
-    size_t         dxpl_vec_size;      /* Vector length from API context's DXPL */
-    size_t         vec_size;           /* Vector length */
     size_t         ret_value = nelmts; /* Number of elements gathered */
 
     FUNC_ENTER_PACKAGE
@@ -385,17 +496,10 @@ H5D__gather_mem(const void *_buf, H5S_sel_iter_t *iter, size_t nelmts, void *_tg
     assert(buf);
     assert(iter);
     assert(nelmts > 0);
+    assert(vec_size > 0);
     assert(tgath_buf);
 
-    /* Get info from API context */
-    if (H5CX_get_vec_size(&dxpl_vec_size) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, 0, "can't retrieve I/O vector size");
-
     /* Allocate the vector I/O arrays */
-    if (dxpl_vec_size > H5D_IO_VECTOR_SIZE)
-        vec_size = dxpl_vec_size;
-    else
-        vec_size = H5D_IO_VECTOR_SIZE;
     if (NULL == (len = H5FL_SEQ_MALLOC(size_t, vec_size)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, 0, "can't allocate I/O length vector array");
     if (NULL == (off = H5FL_SEQ_MALLOC(hsize_t, vec_size)))
@@ -430,7 +534,7 @@ done:
         off = H5FL_SEQ_FREE(hsize_t, off);
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* H5D__gather_mem() */
+} /* H5D__gather_mem_vec() */
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__scatgath_read
@@ -802,6 +906,396 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__scatgath_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_par_init
+ *
+ * Purpose:	Decides which pieces of a selection I/O operation have
+ *		their type conversion and scatter (reads) or gather
+ *		(writes) done on several threads, as requested with
+ *		H5Pset_dataset_io_threads().
+ *
+ *		Only pieces that convert between integer and floating-point
+ *		types without a background buffer or a data transform are
+ *		eligible, and only when there is no conversion exception
+ *		callback: the library's conversion functions keep no state
+ *		for these paths, so the threads can share them.  Nothing is
+ *		done on threads unless at least two pieces are eligible, and
+ *		PAR->eligible is left NULL in that case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__scatgath_par_init(H5D_io_info_t *io_info, bool is_read, H5D_scatgath_par_t *par)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(io_info);
+    assert(par);
+
+    memset(par, 0, sizeof(*par));
+    par->is_read = is_read;
+
+    /* Get the number of threads to use */
+    if (H5CX_get_dset_io_threads(&par->nthreads) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve number of dataset I/O threads");
+
+    if (par->nthreads > 1 && io_info->pieces_added > 1) {
+#ifdef H5_HAVE_THREADSAFE_API
+        H5T_conv_cb_t cb_struct; /* Conversion exception callback */
+        size_t        dxpl_vec_size;
+        size_t        i;
+
+        /* The exception callback would have to be called from the threads */
+        if (H5CX_get_dt_conv_cb(&cb_struct) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get conversion exception callback");
+        if (cb_struct.func)
+            HGOTO_DONE(SUCCEED);
+
+        if (NULL == (par->eligible = H5D__io_arena_malloc(io_info, io_info->pieces_added * sizeof(bool))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed for piece list");
+
+        /* Check which pieces are eligible */
+        for (i = 0; i < io_info->pieces_added; i++) {
+            H5D_type_info_t *type_info = &io_info->sel_pieces[i]->dset_info->type_info;
+
+            par->eligible[i] =
+                type_info->is_xform_noop && !type_info->is_conv_noop && H5T_BKG_NO == type_info->need_bkg &&
+                H5T_path_concurrent(type_info->tpath, type_info->src_type, type_info->dst_type);
+            if (par->eligible[i])
+                par->npieces++;
+        }
+
+        if (par->npieces < 2) {
+            par->eligible = NULL;
+            par->npieces  = 0;
+            HGOTO_DONE(SUCCEED);
+        }
+
+        /* Get the vector length here, the threads have no API context */
+        if (H5CX_get_vec_size(&dxpl_vec_size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve I/O vector size");
+        par->vec_size = MAX(dxpl_vec_size, H5D_IO_VECTOR_SIZE);
+
+        /* Set up the conversion context shared by the threads */
+        par->conv_ctx.u.conv.cb_struct   = cb_struct;
+        par->conv_ctx.u.conv.dxpl_id     = H5I_INVALID_HID;
+        par->conv_ctx.u.conv.src_type_id = H5I_INVALID_HID;
+        par->conv_ctx.u.conv.dst_type_id = H5I_INVALID_HID;
+
+        /* Allocate the piece descriptions and their iterators */
+        if (NULL == (par->pieces = H5D__io_arena_malloc(io_info, par->npieces * sizeof(*par->pieces))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed for piece list");
+        if (NULL == (par->iters = H5D__io_arena_malloc(io_info, par->npieces * sizeof(*par->iters))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory iterators");
+#endif /* H5_HAVE_THREADSAFE_API */
+    } /* end if */
+
+done:
+    if (ret_value < 0)
+        par->eligible = NULL;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__scatgath_par_init() */
+
+#ifdef H5_HAVE_THREADSAFE_API
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_par_piece
+ *
+ * Purpose:	Converts one piece and scatters it to (reads) or gathers
+ *		it from (writes) the application's buffer.  Called from
+ *		worker threads, so it must not use the API context or
+ *		change anything shared with the other pieces.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__scatgath_par_piece(const H5D_scatgath_par_t *par, const H5D_scatgath_par_piece_t *piece)
+{
+    const H5D_type_info_t *type_info = piece->type_info;
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Gather the data from the application's buffer */
+    if (!par->is_read && piece->mem_iter)
+        if (piece->nelmts != H5D__gather_mem_vec(piece->wbuf, piece->mem_iter, piece->nelmts, par->vec_size,
+                                                 piece->tconv_buf /*out*/))
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "mem gather failed");
+
+    /* Perform datatype conversion */
+    if (H5T_convert_with_ctx(type_info->tpath, type_info->src_type, type_info->dst_type, &par->conv_ctx,
+                             piece->nelmts, (size_t)0, (size_t)0, piece->tconv_buf, NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed");
+
+    /* Scatter the data into the application's buffer */
+    if (par->is_read && piece->mem_iter)
+        if (H5D__scatter_mem_vec(piece->tconv_buf, piece->mem_iter, piece->nelmts, par->vec_size,
+                                 piece->rbuf /*out*/) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "scatter failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__scatgath_par_piece() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_par_claim
+ *
+ * Purpose:	Claims pieces until none are left or one of them failed.
+ *
+ *		The errors of the first failure on a worker thread are
+ *		saved in PAR for the calling thread, and those of any later
+ *		failure are dropped.  Errors on the calling thread stay on
+ *		its error stack.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__scatgath_par_claim(H5D_scatgath_par_t *par, bool worker)
+{
+    unsigned u;
+
+    while (0 == H5TS_atomic_load_int(&par->nerrors) &&
+           (u = H5TS_atomic_fetch_add_uint(&par->next_piece, 1)) < par->npieces)
+        if (H5D__scatgath_par_piece(par, &par->pieces[u]) < 0) {
+            bool first = (0 == H5TS_atomic_fetch_add_int(&par->nerrors, 1));
+
+            if (worker) {
+                if (!first || NULL == (par->err_stack = H5E_save_stack()))
+                    H5E_clear_stack();
+            }
+        }
+} /* end H5D__scatgath_par_claim() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_par_worker
+ *
+ * Purpose:	Thread routine for H5D__scatgath_par_run: claims pieces,
+ *		then lets the calling thread know when the last worker
+ *		thread is done.
+ *
+ * Return:	0
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5TS_THREAD_RETURN_TYPE
+H5D__scatgath_par_worker(void *_par)
+{
+    H5D_scatgath_par_t *par = (H5D_scatgath_par_t *)_par;
+
+    H5D__scatgath_par_claim(par, true);
+
+    /* PAR belongs to the calling thread once this is done */
+    if (1 == H5TS_atomic_fetch_sub_uint(&par->nrunning, 1)) {
+        (void)H5TS_mutex_lock(&par->mutex);
+        (void)H5TS_cond_signal(&par->cond);
+        (void)H5TS_mutex_unlock(&par->mutex);
+    }
+
+    return (H5TS_thread_ret_t)0;
+} /* end H5D__scatgath_par_worker() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_par_pool
+ *
+ * Purpose:	Makes sure the pool of worker threads has at least
+ *		NTHREADS threads, creating the pool the first time it's
+ *		needed and replacing it with a larger one when more threads
+ *		are asked for.  The pool is kept until the library shuts
+ *		down.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__scatgath_par_pool(unsigned nthreads)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (nthreads > H5D_scatgath_pool_size_s) {
+        /* The pool is idle between operations, so it can be replaced */
+        if (H5D__scatgath_term() < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't destroy thread pool");
+        if (H5TS_pool_create(&H5D_scatgath_pool_s, nthreads) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create thread pool");
+        H5D_scatgath_pool_size_s = nthreads;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__scatgath_par_pool() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_par_run
+ *
+ * Purpose:	Converts and scatters (reads) or gathers and converts
+ *		(writes) the pieces chosen by H5D__scatgath_par_init on a
+ *		pool of threads, with the calling thread taking pieces too.
+ *		BUFS holds each piece's data in the type conversion buffer.
+ *
+ *		The memory selection iterators are set up and released
+ *		here, because doing so may change the (possibly shared)
+ *		memory dataspaces.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__scatgath_par_run(H5D_io_info_t *io_info, H5D_scatgath_par_t *par, const void *const *bufs)
+{
+    unsigned niters    = 0;       /* Number of iterators initialized */
+    bool     have_sync = false;   /* Whether the mutex & condition variable were created */
+    unsigned nworkers;            /* Number of worker threads */
+    unsigned u;                   /* Local index variable */
+    size_t   i;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(io_info);
+    assert(par);
+    assert(par->eligible);
+    assert(par->npieces > 1);
+    assert(par->nthreads > 1);
+
+    H5TS_atomic_init_uint(&par->next_piece, 0);
+    H5TS_atomic_init_int(&par->nerrors, 0);
+    H5TS_atomic_init_uint(&par->nrunning, 0);
+    par->err_stack = NULL;
+
+    /* Describe the pieces */
+    for (i = 0, u = 0; i < io_info->pieces_added; i++)
+        if (par->eligible[i]) {
+            H5D_scatgath_par_piece_t *piece     = &par->pieces[u++];
+            H5D_type_info_t          *type_info = &io_info->sel_pieces[i]->dset_info->type_info;
+            H5_flexible_const_ptr_t   flex_buf;
+
+            /* The buffer is either in the type conversion buffer or is the application's buffer,
+             * which the library is allowed to modify */
+            flex_buf.cvp = bufs[i];
+
+            H5_CHECK_OVERFLOW(io_info->sel_pieces[i]->piece_points, hsize_t, size_t);
+            piece->type_info = type_info;
+            piece->nelmts    = (size_t)io_info->sel_pieces[i]->piece_points;
+            piece->tconv_buf = flex_buf.vp;
+            piece->rbuf      = par->is_read ? io_info->rbufs[i] : NULL;
+            piece->wbuf      = par->is_read ? NULL : io_info->wbufs[i];
+            piece->mem_iter  = NULL;
+
+            /* In-place conversions don't scatter or gather */
+            if (!io_info->sel_pieces[i]->in_place_tconv) {
+                if (H5S_select_iter_init(&par->iters[niters], io_info->mem_spaces[i],
+                                         par->is_read ? type_info->dst_type_size : type_info->src_type_size,
+                                         0) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                                "unable to initialize memory selection information");
+                piece->mem_iter = &par->iters[niters++];
+            }
+        }
+    assert(u == par->npieces);
+
+    /* Start the worker threads */
+    if (H5TS_mutex_init(&par->mutex, H5TS_MUTEX_TYPE_PLAIN) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize mutex");
+    if (H5TS_cond_init(&par->cond) < 0) {
+        H5TS_mutex_destroy(&par->mutex);
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize condition variable");
+    }
+    have_sync = true;
+    nworkers  = MIN(par->nthreads, par->npieces) - 1;
+    if (H5D__scatgath_par_pool(nworkers) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't set up thread pool");
+    for (u = 0; u < nworkers; u++) {
+        H5TS_atomic_fetch_add_uint(&par->nrunning, 1);
+        if (H5TS_pool_add_task(H5D_scatgath_pool_s, H5D__scatgath_par_worker, par) < 0) {
+            H5TS_atomic_fetch_sub_uint(&par->nrunning, 1);
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't add task to thread pool");
+        }
+    }
+
+    /* Take pieces on this thread too */
+    H5D__scatgath_par_claim(par, false);
+
+done:
+    /* Wait for the worker threads */
+    if (have_sync) {
+        if (H5TS_mutex_lock(&par->mutex) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTLOCK, FAIL, "can't lock mutex");
+        else {
+            while (H5TS_atomic_load_uint(&par->nrunning) > 0)
+                if (H5TS_cond_wait(&par->cond, &par->mutex) < 0) {
+                    HDONE_ERROR(H5E_DATASET, H5E_CANTLOCK, FAIL, "can't wait for worker threads");
+                    break;
+                }
+            if (H5TS_mutex_unlock(&par->mutex) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTUNLOCK, FAIL, "can't unlock mutex");
+        }
+        H5TS_cond_destroy(&par->cond);
+        H5TS_mutex_destroy(&par->mutex);
+    }
+
+    /* Report a worker thread's errors on this thread */
+    if (par->err_stack && H5E_restore_stack(par->err_stack) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTAPPEND, FAIL, "can't copy errors from worker thread");
+    if (H5TS_atomic_load_int(&par->nerrors) > 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed");
+
+    /* Release the selection iterators */
+    for (u = 0; u < niters; u++)
+        if (H5S_SELECT_ITER_RELEASE(&par->iters[u]) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release selection iterator");
+
+    H5TS_atomic_destroy_uint(&par->next_piece);
+    H5TS_atomic_destroy_int(&par->nerrors);
+    H5TS_atomic_destroy_uint(&par->nrunning);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__scatgath_par_run() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_term
+ *
+ * Purpose:	Stops the worker threads used for type conversion, if
+ *		they were started.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__scatgath_term(void)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5D_scatgath_pool_s) {
+        herr_t status = H5TS_pool_destroy(H5D_scatgath_pool_s);
+
+        H5D_scatgath_pool_s      = NULL;
+        H5D_scatgath_pool_size_s = 0;
+        if (status < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't destroy thread pool");
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__scatgath_term() */
+#endif /* H5_HAVE_THREADSAFE_API */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__scatgath_read_select
  *
@@ -821,7 +1315,8 @@ H5D__scatgath_read_select(H5D_io_info_t *io_info)
     void           *tmp_bkg_buf      = NULL;  /* Temporary background buffer pointer */
     size_t          tconv_bytes_used = 0;     /* Number of bytes used so far in conversion buffer */
     size_t          bkg_bytes_used   = 0;     /* Number of bytes used so far in background buffer */
-    size_t          i;                        /* Local index variable */
+    H5D_scatgath_par_t par;                   /* Info for converting pieces on several threads */
+    size_t             i;                     /* Local index variable */
     herr_t          ret_value = SUCCEED;      /* Return value		*/
 
     FUNC_ENTER_PACKAGE
@@ -929,6 +1424,15 @@ H5D__scatgath_read_select(H5D_io_info_t *io_info)
                                io_info->file_spaces, io_info->addrs, io_info->element_sizes, tmp_bufs) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "selection read failed");
 
+    /* Perform type conversion and scatter data to memory buffers on several threads for the pieces that
+     * allow it */
+    if (H5D__scatgath_par_init(io_info, true, &par) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up threads for type conversion");
+#ifdef H5_HAVE_THREADSAFE_API
+    if (par.eligible && H5D__scatgath_par_run(io_info, &par, (const void *const *)tmp_bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed");
+#endif
+
     /* Reset bkg_bytes_used */
     bkg_bytes_used = 0;
 
@@ -938,8 +1442,8 @@ H5D__scatgath_read_select(H5D_io_info_t *io_info)
 
         assert(tmp_mem_spaces[i]);
 
-        /* Check if this piece is involved in type conversion */
-        if (tmp_mem_spaces[i] != io_info->mem_spaces[i]) {
+        /* Check if this piece is involved in type conversion and wasn't converted on the threads */
+        if (tmp_mem_spaces[i] != io_info->mem_spaces[i] && !(par.eligible && par.eligible[i])) {
             H5_CHECK_OVERFLOW(io_info->sel_pieces[i]->piece_points, hsize_t, size_t);
 
             /* Initialize memory iterator */
@@ -1057,7 +1561,8 @@ H5D__scatgath_write_select(H5D_io_info_t *io_info)
     size_t         *bkg_element_sizes = NULL;  /* Array of element sizes for read to background buffer */
     void          **bkg_bufs   = NULL; /* Array background buffers for read of existing file contents */
     size_t          bkg_pieces = 0;    /* Number of pieces that need to read the background data from disk */
-    size_t          i;                 /* Local index variable */
+    H5D_scatgath_par_t par;            /* Info for converting pieces on several threads */
+    size_t             i;              /* Local index variable */
     herr_t          ret_value = SUCCEED; /* Return value		*/
 
     FUNC_ENTER_PACKAGE
@@ -1086,6 +1591,10 @@ H5D__scatgath_write_select(H5D_io_info_t *io_info)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                     "memory allocation failed for temporary memory space list");
 
+    /* Check which pieces will be gathered and converted on several threads */
+    if (H5D__scatgath_par_init(io_info, false, &par) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up threads for type conversion");
+
     /* Build operations to read data to background buffer and to write data */
     for (i = 0; i < io_info->pieces_added; i++) {
         H5D_dset_io_info_t *dset_info = io_info->sel_pieces[i]->dset_info;
@@ -1105,14 +1614,6 @@ H5D__scatgath_write_select(H5D_io_info_t *io_info)
 
             H5_CHECK_OVERFLOW(io_info->sel_pieces[i]->piece_points, hsize_t, size_t);
 
-            /* Initialize memory iterator */
-            assert(!mem_iter_init);
-            if (H5S_select_iter_init(mem_iter, io_info->mem_spaces[i], dset_info->type_info.src_type_size,
-                                     0) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
-                            "unable to initialize memory selection information");
-            mem_iter_init = true; /* Memory selection iteration info has been initialized */
-
             /* Create block memory space */
             if (NULL ==
                 (write_mem_spaces[i] = H5S_create_simple(1, &io_info->sel_pieces[i]->piece_points, NULL)))
@@ -1136,16 +1637,29 @@ H5D__scatgath_write_select(H5D_io_info_t *io_info)
                     io_info->sel_pieces[i]->piece_points *
                     MAX(dset_info->type_info.src_type_size, dset_info->type_info.dst_type_size);
                 assert(tconv_bytes_used <= io_info->tconv_buf_size);
+            }
+
+            /* Set buffer for writing to disk (from type conversion buffer) */
+            write_bufs[i] = (const void *)tmp_write_buf;
+
+            /* The piece is gathered and converted on several threads below */
+            if (par.eligible && par.eligible[i])
+                continue;
 
-                /* Gather data from application buffer into the datatype conversion buffer */
+            /* Initialize memory iterator */
+            assert(!mem_iter_init);
+            if (H5S_select_iter_init(mem_iter, io_info->mem_spaces[i], dset_info->type_info.src_type_size,
+                                     0) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                            "unable to initialize memory selection information");
+            mem_iter_init = true; /* Memory selection iteration info has been initialized */
+
+            /* Gather data from application buffer into the datatype conversion buffer */
+            if (!io_info->sel_pieces[i]->in_place_tconv)
                 if ((size_t)io_info->sel_pieces[i]->piece_points !=
                     H5D__gather_mem(io_info->wbufs[i], mem_iter, (size_t)io_info->sel_pieces[i]->piece_points,
                                     tmp_write_buf /*out*/))
                     HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "mem gather failed");
-            }
-
-            /* Set buffer for writing to disk (from type conversion buffer) */
-            write_bufs[i] = (const void *)tmp_write_buf;
 
             /* If the source and destination are compound types and the destination is a subset of
              * the source and no conversion is needed, copy the data directly into the type
@@ -1248,6 +1762,12 @@ H5D__scatgath_write_select(H5D_io_info_t *io_info)
 
     assert(spaces_added == io_info->pieces_added);
 
+#ifdef H5_HAVE_THREADSAFE_API
+    /* Gather data and perform type conversion on several threads for the pieces that allow it */
+    if (par.eligible && H5D__scatgath_par_run(io_info, &par, write_bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed");
+#endif
+
     /* Gather data to background buffer if necessary */
     if (io_info->must_fill_bkg) {
         size_t j = 0; /* Index into array of background buffers */
@@ -756,6 +756,104 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5E__get_current_stack() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5E_get_current_stack
+ *
+ * Purpose:     Registers a copy of the current error stack, for a caller
+ *              that hands errors from one thread to another, and clears
+ *              the current stack.
+ *
+ * Return:      Success:    An error stack ID
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5E_get_current_stack(void)
+{
+    H5E_stack_t *stk       = NULL;            /* Error stack */
+    hid_t        ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    /* Get the current stack */
+    if (NULL == (stk = H5E__get_current_stack()))
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTCREATE, H5I_INVALID_HID, "can't create error stack");
+
+    /* Register the stack */
+    if ((ret_value = H5I_register(H5I_ERROR_STACK, stk, true)) < 0) {
+        H5E__close_stack(stk, NULL);
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTREGISTER, H5I_INVALID_HID, "can't create error stack");
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E_get_current_stack() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5E_save_stack
+ *
+ * Purpose:     Moves the current error stack into a new stack, for a
+ *              thread that runs part of an operation for another thread.
+ *              The other thread can then take the errors over with
+ *              H5E_restore_stack.  Unlike H5E_get_current_stack, no ID is
+ *              registered, so this may be called from threads that don't
+ *              hold the API lock.
+ *
+ * Return:      Success:    Pointer to the saved error stack
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+struct H5E_stack_t *
+H5E_save_stack(void)
+{
+    H5E_stack_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    if (NULL == (ret_value = H5E__get_current_stack()))
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTCREATE, NULL, "can't save error stack");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E_save_stack() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5E_restore_stack
+ *
+ * Purpose:     Appends the errors of a stack saved with H5E_save_stack to
+ *              the current error stack, and releases the saved stack.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5E_restore_stack(struct H5E_stack_t *estack)
+{
+    H5E_stack_t *current_stack;       /* Current error stack */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    assert(estack);
+
+    /* Get a pointer to the current error stack */
+    if (NULL == (current_stack = H5E__get_my_stack()))
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTGET, FAIL, "can't get current error stack");
+
+    /* Add the saved errors to it */
+    if (H5E__append_stack(current_stack, estack) < 0)
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTAPPEND, FAIL, "can't append error stack");
+
+done:
+    H5E__close_stack(estack, NULL);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E_restore_stack() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5E__set_current_stack
  *
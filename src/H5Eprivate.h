@@ -229,15 +229,18 @@ typedef struct H5E_user_cb_state_t {
 /******************************/
 /* Library Private Prototypes */
 /******************************/
-H5_DLL herr_t H5E_init(void);
-H5_DLL herr_t H5E_get_default_auto_func(H5E_auto2_t *func);
-H5_DLL herr_t H5E_printf_stack(const char *file, const char *func, unsigned line, hid_t maj_idx,
-                               hid_t min_idx, const char *fmt, ...) H5_ATTR_FORMAT(printf, 6, 7);
-H5_DLL herr_t H5E_clear_stack(void);
-H5_DLL herr_t H5E_dump_api_stack(void);
-H5_DLL void   H5E_pause_stack(void);
-H5_DLL void   H5E_resume_stack(void);
-H5_DLL herr_t H5E_user_cb_prepare(H5E_user_cb_state_t *state);
-H5_DLL herr_t H5E_user_cb_restore(const H5E_user_cb_state_t *state);
+H5_DLL herr_t              H5E_init(void);
+H5_DLL herr_t              H5E_get_default_auto_func(H5E_auto2_t *func);
+H5_DLL herr_t              H5E_printf_stack(const char *file, const char *func, unsigned line, hid_t maj_idx,
+                                            hid_t min_idx, const char *fmt, ...) H5_ATTR_FORMAT(printf, 6, 7);
+H5_DLL herr_t              H5E_clear_stack(void);
+H5_DLL hid_t               H5E_get_current_stack(void);
+H5_DLL struct H5E_stack_t *H5E_save_stack(void);
+H5_DLL herr_t              H5E_restore_stack(struct H5E_stack_t *estack);
+H5_DLL herr_t              H5E_dump_api_stack(void);
+H5_DLL void                H5E_pause_stack(void);
+H5_DLL void                H5E_resume_stack(void);
+H5_DLL herr_t              H5E_user_cb_prepare(H5E_user_cb_state_t *state);
+H5_DLL herr_t              H5E_user_cb_restore(const H5E_user_cb_state_t *state);
 
 #endif /* H5Eprivate_H */
@@ -1878,6 +1878,53 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_mdc_hit_rate() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_mdc_type_stats
+ *
+ * Purpose:     Retrieves the number of misses and the time spent loading
+ *              entries for each type of metadata cache entry, since the
+ *              file was opened.  If STATS is null, this routine returns
+ *              the number of entry types.
+ *
+ * Return:      Success:    The number of entry types
+ *              Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+ssize_t
+H5Fget_mdc_type_stats(hid_t file_id, size_t ntypes, H5F_mdc_type_stats_t stats[] /*out*/)
+{
+    H5VL_object_t                   *vol_obj = NULL;
+    H5VL_optional_args_t             vol_cb_args;       /* Arguments to VOL callback */
+    H5VL_native_file_optional_args_t file_opt_args;     /* Arguments for optional operation */
+    size_t                           total_ntypes = 0;  /* Number of entry types */
+    ssize_t                          ret_value    = -1; /* Return value */
+
+    FUNC_ENTER_API((-1))
+
+    /* Check args */
+    if (NULL == (vol_obj = H5VL_vol_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, (-1), "invalid file identifier");
+    if (stats && ntypes == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "ntypes must be > 0");
+
+    /* Set up VOL callback arguments */
+    file_opt_args.get_mdc_type_stats.stats        = stats;
+    file_opt_args.get_mdc_type_stats.ntypes       = ntypes;
+    file_opt_args.get_mdc_type_stats.total_ntypes = &total_ntypes;
+    vol_cb_args.op_type                           = H5VL_NATIVE_FILE_GET_MDC_TYPE_STATS;
+    vol_cb_args.args                              = &file_opt_args;
+
+    /* Get the per-type statistics */
+    if (H5VL_file_optional(vol_obj, &vol_cb_args, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, (-1), "unable to get MDC type statistics");
+
+    /* Set return value */
+    ret_value = (ssize_t)total_ntypes;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_mdc_type_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Fget_mdc_size
  *
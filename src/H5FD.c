@@ -165,9 +165,17 @@ H5FD__init_package(void)
 #ifdef H5_HAVE_IOC_VFD
     if (H5FD__ioc_register() < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTREGISTER, FAIL, "unable to register ioc VFD");
+#endif
+#ifdef H5_HAVE_IOURING_VFD
+    if (H5FD__iouring_register() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTREGISTER, FAIL, "unable to register io_uring VFD");
 #endif
     if (H5FD__log_register() < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTREGISTER, FAIL, "unable to register log VFD");
+#ifdef H5_HAVE_MMAP_VFD
+    if (H5FD__mmap_register() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTREGISTER, FAIL, "unable to register mmap VFD");
+#endif
 #ifdef H5_HAVE_MIRROR_VFD
     if (H5FD__mirror_register() < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTREGISTER, FAIL, "unable to register mirror VFD");
@@ -236,8 +244,14 @@ H5FD_term_package(void)
 #endif
 #ifdef H5_HAVE_IOC_VFD
             H5FD__ioc_unregister();
+#endif
+#ifdef H5_HAVE_IOURING_VFD
+            H5FD__iouring_unregister();
 #endif
             H5FD__log_unregister();
+#ifdef H5_HAVE_MMAP_VFD
+            H5FD__mmap_unregister();
+#endif
 #ifdef H5_HAVE_MIRROR_VFD
             H5FD__mirror_unregister();
 #endif
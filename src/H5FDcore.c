@@ -23,24 +23,25 @@
 #include "H5Fprivate.h"  /* File access                  */
 #include "H5FDcore.h"    /* Core file driver             */
 #include "H5FDpkg.h"     /* File drivers                 */
-#include "H5FLprivate.h" /* Free lists                   */
 #include "H5Iprivate.h"  /* IDs                          */
 #include "H5MMprivate.h" /* Memory management            */
 #include "H5Pprivate.h"  /* Property lists               */
-#include "H5SLprivate.h" /* Skip lists                   */
+#include "H5VMprivate.h" /* Vectors and arrays           */
+
+/* Hugepage-backed memory needs anonymous mappings that can be grown in place */
+#if defined(H5_HAVE_MADV_HUGEPAGE) && defined(H5_HAVE_MREMAP)
+#include <sys/mman.h>
+#define H5FD_CORE_HAVE_HUGEPAGES
+#endif
 
 /* The driver identification number, initialized at runtime */
 hid_t H5FD_CORE_id_g = H5I_INVALID_HID;
 
-/* The skip list node type.  Represents a region in the file. */
-typedef struct H5FD_core_region_t {
-    haddr_t start; /* Start address of the region          */
-    haddr_t end;   /* End address of the region            */
-} H5FD_core_region_t;
-
 /* The description of a file belonging to this driver. The 'eoa' and 'eof'
  * determine the amount of hdf5 address space in use and the high-water mark
- * of the file (the current size of the underlying memory).
+ * of the file (the current size of the underlying memory). 'mem_size' is the
+ * amount of memory actually allocated, which can be larger than 'eof' when
+ * the growth factor is greater than one or hugepages are in use.
  */
 typedef struct H5FD_core_t {
     H5FD_t         pub;              /* public stuff, must be first          */
@@ -48,7 +49,11 @@ typedef struct H5FD_core_t {
     unsigned char *mem;              /* the underlying memory                */
     haddr_t        eoa;              /* end of allocated region              */
     haddr_t        eof;              /* current allocated size               */
+    size_t         mem_size;         /* size of the memory allocation        */
     size_t         increment;        /* multiples for mem allocation         */
+    double         growth_factor;    /* minimum ratio for growing memory     */
+    bool           use_hugepages;    /* hugepage-backed memory requested?    */
+    bool           mem_mapped;       /* memory is an anonymous mapping       */
     bool           backing_store;    /* write to file name on flush          */
     bool           write_tracking;   /* Whether to track writes              */
     size_t         bstore_page_size; /* backing store page size              */
@@ -83,8 +88,9 @@ typedef struct H5FD_core_t {
     HANDLE hFile; /* Native windows file handle */
 #endif                                        /* H5_HAVE_WIN32_API */
     bool                        dirty;        /* changes not saved?       */
-    H5FD_file_image_callbacks_t fi_callbacks; /* file image callbacks     */
-    H5SL_t                     *dirty_list;   /* dirty parts of the file  */
+    H5FD_file_image_callbacks_t fi_callbacks;     /* file image callbacks     */
+    unsigned char              *dirty_pages;      /* bitmap of dirty pages    */
+    size_t                      dirty_pages_size; /* size of bitmap, in bytes */
 } H5FD_core_t;
 
 /* Driver-specific file access properties */
@@ -93,12 +99,19 @@ typedef struct H5FD_core_fapl_t {
     bool   backing_store;  /* write to file name on flush */
     bool   write_tracking; /* Whether to track writes */
     size_t page_size;      /* Page size for tracked writes */
+    double growth_factor;  /* Minimum ratio for growing memory */
+    bool   use_hugepages;  /* Whether to back memory with hugepages */
 } H5FD_core_fapl_t;
 
 /* Allocate memory in multiples of this size by default */
 #define H5FD_CORE_INCREMENT                8192
 #define H5FD_CORE_WRITE_TRACKING_FLAG      false
 #define H5FD_CORE_WRITE_TRACKING_PAGE_SIZE 524288
+#define H5FD_CORE_GROWTH_FACTOR            1.0
+#define H5FD_CORE_USE_HUGEPAGES_FLAG       false
+
+/* Hugepage-backed memory is allocated in multiples of this size */
+#define H5FD_CORE_HUGEPAGE_SIZE ((size_t)2 * 1024 * 1024)
 
 /* These macros check for overflow of various quantities.  These macros
  * assume that file_offset_t is signed and haddr_t and size_t are unsigned.
@@ -121,9 +134,11 @@ typedef struct H5FD_core_fapl_t {
      (size_t)((A) + (Z)) < (size_t)(A))
 
 /* Prototypes */
-static herr_t  H5FD__core_add_dirty_region(H5FD_core_t *file, haddr_t start, haddr_t end);
-static herr_t  H5FD__core_destroy_dirty_list(H5FD_core_t *file);
+static herr_t  H5FD__core_mark_dirty(H5FD_core_t *file, haddr_t addr, size_t size);
 static herr_t  H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size);
+static herr_t  H5FD__core_realloc_mem(H5FD_core_t *file, size_t mem_size);
+static herr_t  H5FD__core_free_mem(H5FD_core_t *file);
+static herr_t  H5FD__core_set_eof(H5FD_core_t *file, size_t new_eof);
 static void   *H5FD__core_fapl_get(H5FD_t *_file);
 static H5FD_t *H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
 static herr_t  H5FD__core_close(H5FD_t *_file);
@@ -189,151 +204,69 @@ static const H5FD_class_t H5FD_core_g = {
 
 /* Default configurations, if none provided */
 static const H5FD_core_fapl_t H5FD_core_default_config_g = {
-    (size_t)H5_MB, true, H5FD_CORE_WRITE_TRACKING_FLAG, H5FD_CORE_WRITE_TRACKING_PAGE_SIZE};
-static const H5FD_core_fapl_t H5FD_core_default_paged_config_g = {(size_t)H5_MB, true, true, (size_t)4096};
-
-/* Define a free list to manage the region type */
-H5FL_DEFINE(H5FD_core_region_t);
+    (size_t)H5_MB, true, H5FD_CORE_WRITE_TRACKING_FLAG, H5FD_CORE_WRITE_TRACKING_PAGE_SIZE,
+    H5FD_CORE_GROWTH_FACTOR, H5FD_CORE_USE_HUGEPAGES_FLAG};
+static const H5FD_core_fapl_t H5FD_core_default_paged_config_g = {
+    (size_t)H5_MB, true, true, (size_t)4096, H5FD_CORE_GROWTH_FACTOR, H5FD_CORE_USE_HUGEPAGES_FLAG};
 
 /*-------------------------------------------------------------------------
- * Function:    H5FD__core_add_dirty_region
+ * Function:    H5FD__core_mark_dirty
  *
- * Purpose:     Add a new dirty region to the list for later flushing
- *              to the backing store.
+ * Purpose:     Mark the backing store pages overlapping a written region
+ *              as dirty, for later flushing to the backing store.
  *
  * Return:      SUCCEED/FAIL
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD__core_add_dirty_region(H5FD_core_t *file, haddr_t start, haddr_t end)
+H5FD__core_mark_dirty(H5FD_core_t *file, haddr_t addr, size_t size)
 {
-    H5FD_core_region_t *b_item          = NULL;
-    H5FD_core_region_t *a_item          = NULL;
-    H5FD_core_region_t *item            = NULL;
-    haddr_t             b_addr          = 0;
-    haddr_t             a_addr          = 0;
-    bool                create_new_node = true;
-    herr_t              ret_value       = SUCCEED;
+    size_t first_page;          /* First page touched by the write */
+    size_t last_page;           /* Last page touched by the write  */
+    size_t nbytes;              /* Bitmap bytes needed             */
+    herr_t ret_value = SUCCEED; /* Return value                    */
 
     FUNC_ENTER_PACKAGE
 
     assert(file);
-    assert(file->dirty_list);
-    assert(start <= end);
-
-    /* Adjust the dirty region to the nearest block boundaries */
-    if (start % file->bstore_page_size != 0)
-        start = (start / file->bstore_page_size) * file->bstore_page_size;
-
-    if (end % file->bstore_page_size != (file->bstore_page_size - 1)) {
-        end = (((end / file->bstore_page_size) + 1) * file->bstore_page_size) - 1;
-        if (end > file->eof)
-            end = file->eof - 1;
-    } /* end if */
-
-    /* Get the regions before and after the intended insertion point */
-    b_addr = start + 1;
-    a_addr = end + 2;
-    b_item = (H5FD_core_region_t *)H5SL_less(file->dirty_list, &b_addr);
-    a_item = (H5FD_core_region_t *)H5SL_less(file->dirty_list, &a_addr);
-
-    /* Check to see if we need to extend the upper end of the NEW region */
-    if (a_item)
-        if (start < a_item->start && end < a_item->end) {
-            /* Extend the end of the NEW region to match the existing AFTER region */
-            end = a_item->end;
-        } /* end if */
-    /* Attempt to extend the PREV region */
-    if (b_item)
-        if (start <= b_item->end + 1) {
-
-            /* Need to set this for the delete algorithm */
-            start = b_item->start;
-
-            /* We won't need to insert a new node since we can
-             * just update an existing one instead.
-             */
-            create_new_node = false;
-        } /* end if */
-
-    /* Remove any old nodes that are no longer needed */
-    while (a_item && a_item->start > start) {
-
-        H5FD_core_region_t *less;
-        haddr_t             key = a_item->start - 1;
+    assert(file->bstore_page_size > 0);
+    assert(size > 0);
 
-        /* Save the previous node before we trash this one */
-        less = (H5FD_core_region_t *)H5SL_less(file->dirty_list, &key);
-
-        /* Delete this node */
-        a_item = (H5FD_core_region_t *)H5SL_remove(file->dirty_list, &a_item->start);
-        a_item = H5FL_FREE(H5FD_core_region_t, a_item);
-
-        /* Set up to check the next node */
-        if (less)
-            a_item = less;
-    } /* end while */
-
-    /* Insert the new node */
-    if (create_new_node) {
-        if (NULL == (item = (H5FD_core_region_t *)H5SL_search(file->dirty_list, &start))) {
-            /* Ok to insert.  No pre-existing node with that key. */
-            item        = (H5FD_core_region_t *)H5FL_CALLOC(H5FD_core_region_t);
-            item->start = start;
-            item->end   = end;
-            if (H5SL_insert(file->dirty_list, item, &item->start) < 0)
-                HGOTO_ERROR(H5E_SLIST, H5E_CANTINSERT, FAIL, "can't insert new dirty region: (%llu, %llu)\n",
-                            (unsigned long long)start, (unsigned long long)end);
-        } /* end if */
-        else {
-            /* Store the new item endpoint if it's bigger */
-            item->end = (item->end < end) ? end : item->end;
-        }
-    }
-    else {
-        /* Update the size of the before region */
-        if (b_item->end < end)
-            b_item->end = end;
-    }
-
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5FD__core_add_dirty_region() */
-
-/*-------------------------------------------------------------------------
- * Function:    H5FD__core_destroy_dirty_list
- *
- * Purpose:     Completely destroy the dirty list.
- *
- * Return:      SUCCEED/FAIL
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5FD__core_destroy_dirty_list(H5FD_core_t *file)
-{
-    herr_t ret_value = SUCCEED;
+    first_page = (size_t)(addr / file->bstore_page_size);
+    last_page  = (size_t)((addr + size - 1) / file->bstore_page_size);
 
-    FUNC_ENTER_PACKAGE
+    /* Extend the bitmap to cover the pages written, at least doubling it
+     * so that a growing file doesn't reallocate it on every write.
+     */
+    nbytes = (last_page / 8) + 1;
+    if (nbytes > file->dirty_pages_size) {
+        unsigned char *x;
+        size_t         new_size = MAX(nbytes, 2 * file->dirty_pages_size);
 
-    assert(file);
+        if (NULL == (x = (unsigned char *)H5MM_realloc(file->dirty_pages, new_size)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to extend core vfd dirty page bitmap");
+        memset(x + file->dirty_pages_size, 0, new_size - file->dirty_pages_size);
 
-    /* Destroy the list, including any remaining list elements */
-    if (file->dirty_list) {
-        H5FD_core_region_t *region = NULL;
+        file->dirty_pages      = x;
+        file->dirty_pages_size = new_size;
+    } /* end if */
 
-        while (NULL != (region = (H5FD_core_region_t *)H5SL_remove_first(file->dirty_list)))
-            region = H5FL_FREE(H5FD_core_region_t, region);
+    /* Set the bits for the pages, whole bytes at a time where possible */
+    while (first_page <= last_page && (first_page % 8) != 0)
+        H5VM_bit_set(file->dirty_pages, first_page++, true);
+    if (first_page + 8 <= last_page + 1) {
+        size_t nfull = (last_page + 1 - first_page) / 8;
 
-        if (H5SL_close(file->dirty_list) < 0)
-            HGOTO_ERROR(H5E_SLIST, H5E_CLOSEERROR, FAIL, "can't close core vfd dirty list");
-        file->dirty_list = NULL;
+        memset(file->dirty_pages + (first_page / 8), 0xFF, nfull);
+        first_page += nfull * 8;
     } /* end if */
+    while (first_page <= last_page)
+        H5VM_bit_set(file->dirty_pages, first_page++, true);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5FD__core_destroy_dirty_list() */
+} /* end H5FD__core_mark_dirty() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_write_to_bstore
@@ -413,6 +346,193 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_write_to_bstore() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_realloc_mem
+ *
+ * Purpose:     Change the size of the memory allocation holding the file,
+ *              using the file image callback, an anonymous hugepage
+ *              mapping, or the library's allocator. The contents up to
+ *              the smaller of the old and new sizes are preserved; memory
+ *              beyond that is not initialized. On failure the old
+ *              allocation is left in place.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_realloc_mem(H5FD_core_t *file, size_t mem_size)
+{
+    unsigned char *x         = NULL;    /* Pointer to new buffer for file data */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (file->fi_callbacks.image_realloc) {
+        /* Prepare & restore library for user callback */
+        H5_BEFORE_USER_CB(FAIL)
+            {
+                x = file->fi_callbacks.image_realloc(file->mem, mem_size, H5FD_FILE_IMAGE_OP_FILE_RESIZE,
+                                                     file->fi_callbacks.udata);
+            }
+        H5_AFTER_USER_CB(FAIL)
+        if (NULL == x)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL,
+                        "unable to allocate memory block of %llu bytes with callback",
+                        (unsigned long long)mem_size);
+    } /* end if */
+#ifdef H5FD_CORE_HAVE_HUGEPAGES
+    else if (file->mem_mapped) {
+        void *map;
+
+        /* Mappings are always whole hugepages, so there are never partial
+         * pages left over from shrinking the file.
+         */
+        if (mem_size % H5FD_CORE_HUGEPAGE_SIZE)
+            mem_size += H5FD_CORE_HUGEPAGE_SIZE - (mem_size % H5FD_CORE_HUGEPAGE_SIZE);
+
+        if (NULL == file->mem)
+            map = mmap(NULL, mem_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        else
+            map = mremap(file->mem, file->mem_size, mem_size, MREMAP_MAYMOVE);
+        if (MAP_FAILED == map)
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to map memory block");
+
+        /* Ask for transparent hugepages. This is only a hint, and fails on
+         * systems where they are disabled, so errors are ignored.
+         */
+        (void)madvise(map, mem_size, MADV_HUGEPAGE);
+
+        x = (unsigned char *)map;
+    } /* end else-if */
+#endif /* H5FD_CORE_HAVE_HUGEPAGES */
+    else {
+        if (NULL == (x = (unsigned char *)H5MM_realloc(file->mem, mem_size)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes",
+                        (unsigned long long)mem_size);
+    } /* end else */
+
+    file->mem      = x;
+    file->mem_size = mem_size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_realloc_mem() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_free_mem
+ *
+ * Purpose:     Release the memory holding the file, using the file image
+ *              callback if available.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_free_mem(H5FD_core_t *file)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (file->mem) {
+        /* Use image callback if available */
+        if (file->fi_callbacks.image_free) {
+            /* Prepare & restore library for user callback */
+            H5_BEFORE_USER_CB(FAIL)
+                {
+                    ret_value = file->fi_callbacks.image_free(file->mem, H5FD_FILE_IMAGE_OP_FILE_CLOSE,
+                                                              file->fi_callbacks.udata);
+                }
+            H5_AFTER_USER_CB(FAIL)
+            if (ret_value < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "image_free callback failed");
+        } /* end if */
+#ifdef H5FD_CORE_HAVE_HUGEPAGES
+        else if (file->mem_mapped) {
+            if (munmap(file->mem, file->mem_size) < 0)
+                HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap memory block");
+        } /* end else-if */
+#endif /* H5FD_CORE_HAVE_HUGEPAGES */
+        else
+            H5MM_xfree(file->mem);
+
+        file->mem      = NULL;
+        file->mem_size = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_free_mem() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_set_eof
+ *
+ * Purpose:     Change the size of the file's memory image to NEW_EOF,
+ *              zero-filling any newly exposed bytes.
+ *
+ *              When the memory allocation must grow, it grows to at least
+ *              the growth factor times its current size, so that repeatedly
+ *              extending a large image doesn't copy it each time. With the
+ *              default growth factor of one and no hugepages, the memory
+ *              allocation always matches the image size exactly, as in
+ *              earlier releases.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_set_eof(H5FD_core_t *file, size_t new_eof)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (new_eof > file->mem_size) {
+        size_t mem_size = new_eof; /* New size of memory allocation */
+
+        /* Apply the growth policy */
+        if (file->growth_factor > 1.0 && file->mem_size > 0) {
+            double grown = (double)file->mem_size * file->growth_factor;
+
+            if (grown < (double)(CORE_MAXADDR - file->increment)) {
+                size_t grown_size = (size_t)grown;
+
+                if (grown_size % file->increment)
+                    grown_size += file->increment - (grown_size % file->increment);
+                mem_size = MAX(mem_size, grown_size);
+            } /* end if */
+        }     /* end if */
+
+        if (H5FD__core_realloc_mem(file, mem_size) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to extend core vfd memory");
+    } /* end if */
+    else if (new_eof < file->mem_size && file->growth_factor <= 1.0 && !file->mem_mapped) {
+        /* Give back memory when not keeping spare capacity */
+        if (H5FD__core_realloc_mem(file, new_eof) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to shrink core vfd memory");
+    } /* end else-if */
+
+    /* Bytes past the old end of the image may hold stale data when the image
+     * was previously shrunk within its allocation.
+     */
+    if (file->eof < new_eof)
+        memset(file->mem + file->eof, 0, (size_t)(new_eof - file->eof));
+
+    file->eof = new_eof;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_set_eof() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_get_default_config
  *
@@ -521,6 +641,8 @@ H5Pset_core_write_tracking(hid_t plist_id, hbool_t is_enabled, size_t page_size)
     fa.backing_store  = old_fa->backing_store;
     fa.write_tracking = is_enabled;
     fa.page_size      = page_size;
+    fa.growth_factor  = old_fa->growth_factor;
+    fa.use_hugepages  = old_fa->use_hugepages;
 
     /* Set the property values & the driver for the FAPL */
     if (H5P_set_driver(plist, H5FD_CORE, &fa, NULL) < 0)
@@ -567,6 +689,92 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_core_write_tracking() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_core_allocation
+ *
+ * Purpose:    Sets the core VFD memory growth factor and whether the
+ *              memory is backed by hugepages.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_core_allocation(hid_t plist_id, double growth_factor, hbool_t use_hugepages)
+{
+    H5P_genplist_t         *plist;               /* Property list pointer */
+    H5FD_core_fapl_t        fa;                  /* Core VFD info */
+    const H5FD_core_fapl_t *old_fa;              /* Old core VFD info */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* The memory can't grow by less than what's needed */
+    if (!(growth_factor >= 1.0))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "growth_factor must be >= 1.0");
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, false)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADID, FAIL, "can't find object for ID");
+    if (H5FD_CORE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver");
+    if (NULL == (old_fa = (const H5FD_core_fapl_t *)H5P_peek_driver_info(plist)))
+        old_fa = H5FD__core_get_default_config();
+
+    /* Set VFD info values */
+    memset(&fa, 0, sizeof(H5FD_core_fapl_t));
+    fa.increment      = old_fa->increment;
+    fa.backing_store  = old_fa->backing_store;
+    fa.write_tracking = old_fa->write_tracking;
+    fa.page_size      = old_fa->page_size;
+    fa.growth_factor  = growth_factor;
+    fa.use_hugepages  = use_hugepages;
+
+    /* Set the property values & the driver for the FAPL */
+    if (H5P_set_driver(plist, H5FD_CORE, &fa, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set core VFD as driver");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_core_allocation() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_core_allocation
+ *
+ * Purpose:    Gets the core VFD memory growth factor and whether the
+ *              memory is backed by hugepages.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_core_allocation(hid_t plist_id, double *growth_factor /*out*/, hbool_t *use_hugepages /*out*/)
+{
+    H5P_genplist_t         *plist;               /* Property list pointer */
+    const H5FD_core_fapl_t *fa;                  /* Core VFD info */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, true)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADID, FAIL, "can't find object for ID");
+    if (H5FD_CORE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver");
+    if (NULL == (fa = (const H5FD_core_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info");
+
+    /* Get values */
+    if (growth_factor)
+        *growth_factor = fa->growth_factor;
+    if (use_hugepages)
+        *use_hugepages = fa->use_hugepages;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_core_allocation() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_fapl_core
  *
@@ -597,6 +805,8 @@ H5Pset_fapl_core(hid_t fapl_id, size_t increment, hbool_t backing_store)
     fa.backing_store  = backing_store;
     fa.write_tracking = H5FD_CORE_WRITE_TRACKING_FLAG;
     fa.page_size      = H5FD_CORE_WRITE_TRACKING_PAGE_SIZE;
+    fa.growth_factor  = H5FD_CORE_GROWTH_FACTOR;
+    fa.use_hugepages  = H5FD_CORE_USE_HUGEPAGES_FLAG;
 
     /* Set the property values & the driver for the FAPL */
     if (H5P_set_driver(plist, H5FD_CORE, &fa, NULL) < 0)
@@ -666,6 +876,8 @@ H5FD__core_fapl_get(H5FD_t *_file)
     fa->backing_store  = (bool)(file->fd >= 0);
     fa->write_tracking = file->write_tracking;
     fa->page_size      = file->bstore_page_size;
+    fa->growth_factor  = file->growth_factor;
+    fa->use_hugepages  = file->use_hugepages;
 
     /* Set return value */
     ret_value = fa;
@@ -781,6 +993,16 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
     /* Save file image callbacks */
     file->fi_callbacks = file_image_info.callbacks;
 
+    /* Set up the memory allocation policy. Hugepages are only used when the
+     * memory isn't managed by the application through file image callbacks.
+     */
+    file->growth_factor = fa->growth_factor;
+    file->use_hugepages = fa->use_hugepages;
+#ifdef H5FD_CORE_HAVE_HUGEPAGES
+    file->mem_mapped = fa->use_hugepages && NULL == file->fi_callbacks.image_malloc &&
+                       NULL == file->fi_callbacks.image_realloc && NULL == file->fi_callbacks.image_free;
+#endif /* H5FD_CORE_HAVE_HUGEPAGES */
+
     /* Check the file locking flags in the fapl */
     if (H5FD_ignore_disabled_file_locks_p != FAIL)
         /* The environment variable was set, so use that preferentially */
@@ -834,12 +1056,18 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
                 if (NULL == file->mem)
                     HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, NULL, "image malloc callback failed");
             } /* end if */
+            else if (file->mem_mapped) {
+                if (H5FD__core_realloc_mem(file, size) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, NULL, "unable to map memory block");
+            } /* end else-if */
             else {
                 if (NULL == (file->mem = H5MM_malloc(size)))
                     HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, NULL, "unable to allocate memory block");
             } /* end else */
 
             /* Set up data structures */
+            if (!file->mem_mapped)
+                file->mem_size = size;
             file->eof = size;
 
             /* If there is an initial file image, copy it, using the callback if possible */
@@ -923,7 +1151,6 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
     file->bstore_page_size = fa->page_size;
 
     /* Set up write tracking if the backing store is on */
-    file->dirty_list = NULL;
     if (fa->backing_store) {
         bool use_write_tracking = false; /* what we're actually doing */
 
@@ -936,11 +1163,13 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
                              && !(o_flags & O_RDONLY)     /* file is open for writing (i.e. not read-only) */
                              && (file->bstore_page_size != 0); /* page size is not zero */
 
-        /* initialize the dirty list */
-        if (use_write_tracking)
-            if (NULL == (file->dirty_list = H5SL_create(H5SL_TYPE_HADDR, NULL)))
-                HGOTO_ERROR(H5E_SLIST, H5E_CANTCREATE, NULL, "can't create core vfd dirty region list");
-    } /* end if */
+        /* Start with a dirty page bitmap that covers the current file */
+        if (use_write_tracking) {
+            file->dirty_pages_size = (size_t)((file->eof / file->bstore_page_size) / 8) + 1;
+            if (NULL == (file->dirty_pages = (unsigned char *)H5MM_calloc(file->dirty_pages_size)))
+                HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, NULL, "can't create core vfd dirty page bitmap");
+        } /* end if */
+    }     /* end if */
 
     /* Set return value */
     ret_value = (H5FD_t *)file;
@@ -950,7 +1179,9 @@ done:
         if (file->fd >= 0)
             HDclose(file->fd);
         H5MM_xfree(file->name);
-        H5MM_xfree(file->mem);
+        H5MM_xfree(file->dirty_pages);
+        if (H5FD__core_free_mem(file) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTFREE, NULL, "unable to free core vfd memory");
         H5MM_xfree(file);
     } /* end if */
 
@@ -978,32 +1209,15 @@ H5FD__core_close(H5FD_t *_file)
     if (H5FD__core_flush(_file, (hid_t)-1, true) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to flush core vfd backing store");
 
-    /* Destroy the dirty region list */
-    if (file->dirty_list)
-        if (H5FD__core_destroy_dirty_list(file) != SUCCEED)
-            HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to free core vfd dirty region list");
-
     /* Release resources */
     if (file->fd >= 0)
         HDclose(file->fd);
     if (file->name)
         H5MM_xfree(file->name);
-    if (file->mem) {
-        /* Use image callback if available */
-        if (file->fi_callbacks.image_free) {
-            /* Prepare & restore library for user callback */
-            H5_BEFORE_USER_CB(FAIL)
-                {
-                    ret_value = file->fi_callbacks.image_free(file->mem, H5FD_FILE_IMAGE_OP_FILE_CLOSE,
-                                                              file->fi_callbacks.udata);
-                }
-            H5_AFTER_USER_CB(FAIL)
-            if (ret_value < 0)
-                HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "image_free callback failed");
-        } /* end if */
-        else
-            H5MM_xfree(file->mem);
-    } /* end if */
+    if (file->dirty_pages)
+        H5MM_xfree(file->dirty_pages);
+    if (H5FD__core_free_mem(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to free core vfd memory");
     memset(file, 0, sizeof(H5FD_core_t));
     H5MM_xfree(file);
 
@@ -1113,6 +1327,7 @@ H5FD__core_query(const H5FD_t *_file, unsigned long *flags /* out */)
         *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;            /* OK to aggregate "small" raw data allocations                     */
         *flags |= H5FD_FEAT_ALLOW_FILE_IMAGE;               /* OK to use file image feature with this VFD                       */
         *flags |= H5FD_FEAT_CAN_USE_FILE_IMAGE_CALLBACKS;   /* OK to use file image callbacks with this VFD                     */
+        *flags |= H5FD_FEAT_CONCURRENT_READ;                /* Reads only copy from the memory image                            */
 
         /* These feature flags are only applicable if the backing store is enabled */
         if(file && file->fd >= 0 && file->backing_store) {
@@ -1345,51 +1560,25 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
      * the first argument is null.
      */
     if (addr + size > file->eof) {
-        unsigned char *x;
-        size_t         new_eof;
+        size_t new_eof;
 
         /* Determine new size of memory buffer */
         H5_CHECKED_ASSIGN(new_eof, size_t, file->increment * ((addr + size) / file->increment), hsize_t);
         if ((addr + size) % file->increment)
             new_eof += file->increment;
 
-        /* (Re)allocate memory for the file buffer, using callbacks if available */
-        if (file->fi_callbacks.image_realloc) {
-            /* Prepare & restore library for user callback */
-            H5_BEFORE_USER_CB(FAIL)
-                {
-                    x = file->fi_callbacks.image_realloc(file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE,
-                                                         file->fi_callbacks.udata);
-                }
-            H5_AFTER_USER_CB(FAIL)
-            if (NULL == x)
-                HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL,
-                            "unable to allocate memory block of %llu bytes with callback",
-                            (unsigned long long)new_eof);
-        } /* end if */
-        else {
-            if (NULL == (x = H5MM_realloc(file->mem, new_eof)))
-                HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes",
-                            (unsigned long long)new_eof);
-        } /* end else */
-
-        memset(x + file->eof, 0, (size_t)(new_eof - file->eof));
-        file->mem = x;
-
-        file->eof = new_eof;
+        /* (Re)allocate memory for the file buffer */
+        if (H5FD__core_set_eof(file, new_eof) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes",
+                        (unsigned long long)new_eof);
     } /* end if */
 
-    /* Add the buffer region to the dirty list if using that optimization */
-    if (file->dirty_list) {
-        haddr_t start = addr;
-        haddr_t end   = addr + (haddr_t)size - 1;
-
-        if (H5FD__core_add_dirty_region(file, start, end) != SUCCEED)
-            HGOTO_ERROR(
-                H5E_VFL, H5E_CANTINSERT, FAIL,
-                "unable to add core VFD dirty region during write call - addresses: start=%llu end=%llu",
-                (unsigned long long)start, (unsigned long long)end);
-    }
+    /* Mark the pages written as dirty if using that optimization */
+    if (file->dirty_pages && size > 0)
+        if (H5FD__core_mark_dirty(file, addr, size) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, FAIL,
+                        "unable to mark core VFD pages dirty during write call - addr=%llu size=%llu",
+                        (unsigned long long)addr, (unsigned long long)size);
 
     /* Write from BUF to memory */
     H5MM_memcpy(file->mem + addr, buf, size);
@@ -1422,29 +1611,42 @@ H5FD__core_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, bool H5_ATTR_UNUSE
     /* Write to backing store */
     if (file->dirty && file->fd >= 0 && file->backing_store) {
 
-        /* Use the dirty list, if available */
-        if (file->dirty_list) {
-            H5FD_core_region_t *item = NULL;
-            size_t              size;
-
-            while (NULL != (item = (H5FD_core_region_t *)H5SL_remove_first(file->dirty_list))) {
+        /* Write only the dirty pages, if tracking them */
+        if (file->dirty_pages) {
+            size_t npages; /* # of pages in the file  */
+            size_t u;      /* Local index variable    */
 
-                /* The file may have been truncated, so check for that
-                 * and skip or adjust as necessary.
-                 */
-                if (item->start < file->eof) {
-                    if (item->end >= file->eof)
-                        item->end = file->eof - 1;
+            /* The file may have been truncated, so only look at pages
+             * that are still in the file.
+             */
+            npages = (size_t)((file->eof + file->bstore_page_size - 1) / file->bstore_page_size);
+            npages = MIN(npages, file->dirty_pages_size * 8);
 
-                    size = (size_t)((item->end - item->start) + 1);
+            u = 0;
+            while (u < npages) {
+                haddr_t start, end;
 
-                    if (H5FD__core_write_to_bstore(file, item->start, size) != SUCCEED)
-                        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store");
+                /* Skip over clean pages, a byte of the bitmap at a time if possible */
+                if (0 == file->dirty_pages[u / 8]) {
+                    u = ((u / 8) + 1) * 8;
+                    continue;
                 } /* end if */
+                if (!H5VM_bit_get(file->dirty_pages, u)) {
+                    u++;
+                    continue;
+                } /* end if */
+
+                /* Coalesce the run of dirty pages into a single write */
+                start = (haddr_t)u * file->bstore_page_size;
+                while (u < npages && H5VM_bit_get(file->dirty_pages, u))
+                    u++;
+                end = MIN((haddr_t)u * file->bstore_page_size, file->eof);
 
-                item = H5FL_FREE(H5FD_core_region_t, item);
+                if (H5FD__core_write_to_bstore(file, start, (size_t)(end - start)) != SUCCEED)
+                    HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store");
             } /* end while */
 
+            memset(file->dirty_pages, 0, file->dirty_pages_size);
         } /* end if */
         /* Otherwise, write the entire file out at once */
         else {
@@ -1487,6 +1689,10 @@ done:
  *              new eof if applicable.
  *                                                                  -- JRM
  *
+ *              When the growth factor is greater than one or the memory is
+ *              backed by hugepages, memory released by shrinking the file
+ *              is kept for reuse instead of being reallocated.
+ *
  * Return:      SUCCEED/FAIL
  *
  *-------------------------------------------------------------------------
@@ -1515,29 +1721,9 @@ H5FD__core_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, bool closing)
 
         /* Extend the file to make sure it's large enough */
         if (!H5_addr_eq(file->eof, (haddr_t)new_eof)) {
-            unsigned char *x; /* Pointer to new buffer for file data */
-
-            /* (Re)allocate memory for the file buffer, using callback if available */
-            if (file->fi_callbacks.image_realloc) {
-                /* Prepare & restore library for user callback */
-                H5_BEFORE_USER_CB(FAIL)
-                    {
-                        x = file->fi_callbacks.image_realloc(
-                            file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata);
-                    }
-                H5_AFTER_USER_CB(FAIL)
-                if (NULL == x)
-                    HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL,
-                                "unable to allocate memory block with callback");
-            } /* end if */
-            else {
-                if (NULL == (x = H5MM_realloc(file->mem, new_eof)))
-                    HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate memory block");
-            } /* end else */
-
-            if (file->eof < new_eof)
-                memset(x + file->eof, 0, (size_t)(new_eof - file->eof));
-            file->mem = x;
+            /* (Re)allocate memory for the file buffer */
+            if (H5FD__core_set_eof(file, new_eof) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate memory block");
 
             /* Update backing store, if using it and if closing */
             if (closing && (file->fd >= 0) && file->backing_store) {
@@ -1573,10 +1759,7 @@ H5FD__core_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, bool closing)
 #endif /* H5_HAVE_WIN32_API */
 
             } /* end if */
-
-            /* Update the eof value */
-            file->eof = new_eof;
-        } /* end if */
+        }     /* end if */
     }     /* end if(file->eof < file->eoa) */
 
 done:
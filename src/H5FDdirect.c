@@ -66,6 +66,8 @@ typedef struct H5FD_direct_t {
     haddr_t            pos; /*current file I/O position  */
     int                op;  /*last operation    */
     H5FD_direct_fapl_t fa;  /*file access properties  */
+    void              *copy_buf;      /*aligned copy buffer, reused across I/O requests */
+    size_t             copy_buf_size; /*size of the copy buffer */
     bool               ignore_disabled_file_locks;
 #ifndef H5_HAVE_WIN32_API
     /*
@@ -93,6 +95,7 @@ typedef struct H5FD_direct_t {
 /* Prototypes */
 static herr_t  H5FD__direct_populate_config(size_t boundary, size_t block_size, size_t cbuf_size,
                                             H5FD_direct_fapl_t *fa_out);
+static void   *H5FD__direct_get_copy_buf(H5FD_direct_t *file, size_t size);
 static void   *H5FD__direct_fapl_get(H5FD_t *file);
 static void   *H5FD__direct_fapl_copy(const void *_old_fa);
 static H5FD_t *H5FD__direct_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
@@ -107,6 +110,12 @@ static herr_t  H5FD__direct_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id,
                                  void *buf);
 static herr_t  H5FD__direct_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                   const void *buf);
+#ifdef H5_HAVE_PREADWRITEV
+static herr_t H5FD__direct_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                       haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t H5FD__direct_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                        haddr_t addrs[], size_t sizes[], const void *bufs[]);
+#endif /* H5_HAVE_PREADWRITEV */
 static herr_t  H5FD__direct_truncate(H5FD_t *_file, hid_t dxpl_id, bool closing);
 static herr_t  H5FD__direct_lock(H5FD_t *_file, bool rw);
 static herr_t  H5FD__direct_unlock(H5FD_t *_file);
@@ -142,8 +151,13 @@ static const H5FD_class_t H5FD_direct_g = {
     H5FD__direct_get_handle,    /* get_handle           */
     H5FD__direct_read,          /* read                 */
     H5FD__direct_write,         /* write                */
+#ifdef H5_HAVE_PREADWRITEV
+    H5FD__direct_read_vector,   /* read_vector          */
+    H5FD__direct_write_vector,  /* write_vector         */
+#else
     NULL,                       /* read_vector          */
     NULL,                       /* write_vector         */
+#endif /* H5_HAVE_PREADWRITEV */
     NULL,                       /* read_selection       */
     NULL,                       /* write_selection      */
     NULL,                       /* flush                */
@@ -562,6 +576,10 @@ H5FD__direct_close(H5FD_t *_file)
     if (HDclose(file->fd) < 0)
         HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file");
 
+    /* Free with free since it came from posix_memalign */
+    if (file->copy_buf)
+        free(file->copy_buf);
+
     H5FL_FREE(H5FD_direct_t, file);
 
 done:
@@ -644,6 +662,9 @@ H5FD__direct_query(const H5FD_t H5_ATTR_UNUSED *_f, unsigned long *flags /* out
         *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations    */
         *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
                                                        VFD      */
+#ifdef H5_HAVE_PREADWRITEV
+        *flags |= H5FD_FEAT_SELECTION_IO_OPT_IN; /* Vector callbacks don't enable selection I/O by default */
+#endif
     }
 
     FUNC_LEAVE_NOAPI(SUCCEED)
@@ -747,6 +768,52 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_get_copy_buf
+ *
+ * Purpose:  Returns the file's aligned copy buffer, making sure it can
+ *    hold at least SIZE bytes.  The buffer is kept until the file
+ *    is closed and reused by all reads and writes which need to
+ *    go through it, instead of allocating a new one each time.
+ *    It only ever grows, and never beyond the maximal copy buffer
+ *    size from the file access properties.
+ *
+ * Return:  Success:  Pointer to the copy buffer
+ *
+ *    Failure:  NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__direct_get_copy_buf(H5FD_direct_t *file, size_t size)
+{
+    void *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+    assert(size > 0 && size <= file->fa.cbsize);
+
+    if (size > file->copy_buf_size) {
+        /* Free with free since it came from posix_memalign */
+        if (file->copy_buf)
+            free(file->copy_buf);
+        file->copy_buf      = NULL;
+        file->copy_buf_size = 0;
+
+        if (posix_memalign(&file->copy_buf, file->fa.mboundary, size) != 0) {
+            file->copy_buf = NULL;
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "posix_memalign failed");
+        }
+        file->copy_buf_size = size;
+    }
+
+    ret_value = file->copy_buf;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}
+
 /*-------------------------------------------------------------------------
  * Function:  H5FD__direct_read
  *
@@ -762,8 +829,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
-                  size_t size, void *buf /*out*/)
+H5FD__direct_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+                  void *buf /*out*/)
 {
     H5FD_direct_t *file = (H5FD_direct_t *)_file;
     ssize_t        nbytes;
@@ -801,6 +868,22 @@ H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
     _fbsize   = file->fa.fbsize;
     _cbsize   = file->fa.cbsize;
 
+    /* If the data starts on a block boundary in both the file and memory,
+     * read the whole blocks directly into the buffer, so that only the
+     * partial block at the end goes through the copy buffer.
+     */
+    if (_must_align && (addr % _fbsize == 0) && ((size_t)buf % _boundary == 0) && size > _fbsize &&
+        (size % _fbsize != 0)) {
+        size_t direct_size = size - (size % _fbsize);
+
+        if (H5FD__direct_read(_file, type, dxpl_id, addr, direct_size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed");
+        addr += direct_size;
+        buf = (unsigned char *)buf + direct_size;
+        size -= direct_size;
+        copy_size = size;
+    }
+
     /* if the data is aligned or the system doesn't require data to be aligned,
      * read it directly from the file.  If not, read a bigger
      * and aligned data first, then copy the data into memory buffer.
@@ -842,8 +925,8 @@ H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
         if (alloc_size > _cbsize)
             alloc_size = _cbsize;
         assert(!(alloc_size % _fbsize));
-        if (posix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "posix_memalign failed");
+        if (NULL == (copy_buf = H5FD__direct_get_copy_buf(file, alloc_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't get copy buffer");
 
         /* look for the aligned position for reading the data */
         assert(!(((addr / _fbsize) * _fbsize) % _fbsize));
@@ -899,12 +982,6 @@ H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
 
         /*Final step: update address*/
         addr = (haddr_t)(((addr + size - 1) / _fbsize + 1) * _fbsize);
-
-        if (copy_buf) {
-            /* Free with free since it came from posix_memalign */
-            free(copy_buf);
-            copy_buf = NULL;
-        } /* end if */
     }
 
     /* Update current position */
@@ -913,10 +990,6 @@ H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
 
 done:
     if (ret_value < 0) {
-        /* Free with free since it came from posix_memalign */
-        if (copy_buf)
-            free(copy_buf);
-
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op  = OP_UNKNOWN;
@@ -939,8 +1012,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD__direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
-                   size_t size, const void *buf)
+H5FD__direct_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+                   const void *buf)
 {
     H5FD_direct_t *file = (H5FD_direct_t *)_file;
     ssize_t        nbytes;
@@ -981,6 +1054,23 @@ H5FD__direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_
     _fbsize   = file->fa.fbsize;
     _cbsize   = file->fa.cbsize;
 
+    /* If the data starts on a block boundary in both the file and memory,
+     * write the whole blocks directly from the buffer, so that only the
+     * partial block at the end needs a read-modify-write through the copy
+     * buffer.
+     */
+    if (_must_align && (addr % _fbsize == 0) && ((size_t)buf % _boundary == 0) && size > _fbsize &&
+        (size % _fbsize != 0)) {
+        size_t direct_size = size - (size % _fbsize);
+
+        if (H5FD__direct_write(_file, type, dxpl_id, addr, direct_size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
+        addr += direct_size;
+        buf = (const unsigned char *)buf + direct_size;
+        size -= direct_size;
+        copy_size = size;
+    }
+
     /* if the data is aligned or the system doesn't require data to be aligned,
      * write it directly to the file.  If not, read a bigger and aligned data
      * first, update buffer with user data, then write the data out.
@@ -1020,8 +1110,8 @@ H5FD__direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_
             alloc_size = _cbsize;
         assert(!(alloc_size % _fbsize));
 
-        if (posix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "posix_memalign failed");
+        if (NULL == (copy_buf = H5FD__direct_get_copy_buf(file, alloc_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't get copy buffer");
 
         /* look for the right position for reading or writing the data */
         if (HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
@@ -1123,12 +1213,6 @@ H5FD__direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_
         /*Update the address and size*/
         addr = write_addr;
         buf  = (const char *)buf + size;
-
-        if (copy_buf) {
-            /* Free with free since it came from posix_memalign */
-            free(copy_buf);
-            copy_buf = NULL;
-        } /* end if */
     }
 
     /* Update current position and eof */
@@ -1139,10 +1223,6 @@ H5FD__direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_
 
 done:
     if (ret_value < 0) {
-        /* Free with free since it came from posix_memalign */
-        if (copy_buf)
-            free(copy_buf);
-
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op  = OP_UNKNOWN;
@@ -1151,6 +1231,81 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+#ifdef H5_HAVE_PREADWRITEV
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__direct_read_vector
+ *
+ * Purpose:     Reads the COUNT elements of a vector request.  Elements
+ *              that satisfy the O_DIRECT alignment requirements (or all
+ *              elements, if the system doesn't require alignment) are
+ *              read with preadv(), merging elements with adjacent file
+ *              addresses into one call.  The remaining elements are read
+ *              through the copy buffer by H5FD__direct_read().
+ *
+ *              preadv() does not move the file position, so the cached
+ *              position used by H5FD__direct_read() remains valid.
+ *
+ * Return:      Success:    SUCCEED. Results are stored in the buffers
+ *                          in BUFS.
+ *              Failure:    FAIL, contents of the buffers are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                         size_t sizes[], void *bufs[] /* out */)
+{
+    H5FD_direct_t *file      = (H5FD_direct_t *)_file;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+
+    if (H5FD__iov_vector_io(_file, file->fd, false, dxpl_id, count, types, addrs, sizes, bufs,
+                            file->fa.must_align ? file->fa.fbsize : 0, file->fa.mboundary, NULL) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__direct_write_vector
+ *
+ * Purpose:     Writes the COUNT elements of a vector request.  Aligned
+ *              elements are written with pwritev(), merging elements with
+ *              adjacent file addresses into one call; the remaining
+ *              elements are written through the copy buffer by
+ *              H5FD__direct_write().
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                          size_t sizes[], const void *bufs[] /* in */)
+{
+    H5FD_direct_t *file      = (H5FD_direct_t *)_file;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+
+    /* The buffers are only read from on the write path */
+    H5_WARN_CAST_AWAY_CONST_OFF
+    if (H5FD__iov_vector_io(_file, file->fd, true, dxpl_id, count, types, addrs, sizes, (void **)bufs,
+                            file->fa.must_align ? file->fa.fbsize : 0, file->fa.mboundary, &file->eof) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write failed");
+    H5_WARN_CAST_AWAY_CONST_ON
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_write_vector() */
+#endif /* H5_HAVE_PREADWRITEV */
+
 /*-------------------------------------------------------------------------
  * Function:  H5FD__direct_truncate
  *
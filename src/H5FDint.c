@@ -56,6 +56,20 @@
  * space is needed dynamic allocation will be used instead */
 #define H5FD_LOCAL_SEL_ARR_LEN 8
 
+#ifdef H5_HAVE_PREADWRITEV
+/* Length of stack allocated iovec arrays for preadv()/pwritev() vector I/O.
+ * Longer vectors use a dynamically allocated array of up to H5FD_IOV_MAX
+ * entries. */
+#define H5FD_LOCAL_IOV_LEN 16
+
+/* Maximum number of iovecs passed to a single preadv()/pwritev() call */
+#ifdef IOV_MAX
+#define H5FD_IOV_MAX IOV_MAX
+#else
+#define H5FD_IOV_MAX 1024
+#endif
+#endif /* H5_HAVE_PREADWRITEV */
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -2390,6 +2404,249 @@ done:
 
 } /* end H5FD_write_from_selection() */
 
+#ifdef H5_HAVE_PREADWRITEV
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iov_flush
+ *
+ * Purpose:     Issues the preadv()/pwritev() calls for one run of IOVCNT
+ *              memory buffers covering NBYTES contiguous bytes of the
+ *              file starting at ADDR.
+ *
+ *              Interrupted calls are retried and partial transfers are
+ *              resumed from the first unfinished iovec.  A read that
+ *              reaches the end of the file zero fills the rest of the
+ *              run.  With O_DIRECT (DIRECT_IO), a short read can only
+ *              occur at the end of the file and leaves the file offset
+ *              unaligned, so it is treated the same way.
+ *
+ *              The contents of IOV are modified.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iov_flush(int fd, bool do_write, bool direct_io, struct iovec *iov, int iovcnt, haddr_t addr,
+                size_t nbytes)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    while (nbytes > 0) {
+        ssize_t nio = -1; /* # of bytes transferred */
+
+        do {
+            if (do_write)
+                nio = HDpwritev(fd, iov, iovcnt, (HDoff_t)addr);
+            else
+                nio = HDpreadv(fd, iov, iovcnt, (HDoff_t)addr);
+        } while (-1 == nio && EINTR == errno);
+
+        if (-1 == nio) {
+            int myerrno = errno;
+
+            HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                        "file vector %s failed: file descriptor = %d, errno = %d, error message = '%s', "
+                        "iovec count = %d, total size = %zu, offset = %llu",
+                        do_write ? "write" : "read", fd, myerrno, strerror(myerrno), iovcnt, nbytes,
+                        (unsigned long long)addr);
+        }
+
+        if (do_write && 0 == nio)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write made no progress, offset = %llu",
+                        (unsigned long long)addr);
+
+        assert((size_t)nio <= nbytes);
+        nbytes -= (size_t)nio;
+        addr += (haddr_t)nio;
+
+        /* Skip past the iovecs that were completed */
+        while (iovcnt > 0 && (size_t)nio >= iov->iov_len) {
+            nio -= (ssize_t)iov->iov_len;
+            iov++;
+            iovcnt--;
+        }
+        if (nio > 0) {
+            iov->iov_base = (char *)iov->iov_base + nio;
+            iov->iov_len -= (size_t)nio;
+        }
+
+        /* End of file but not end of format address space */
+        if (!do_write && nbytes > 0 && (0 == nio || direct_io)) {
+            for (; iovcnt > 0; iov++, iovcnt--)
+                memset(iov->iov_base, 0, iov->iov_len);
+            break;
+        }
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iov_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iov_vector_io
+ *
+ * Purpose:     Performs a vector read or write on the POSIX file
+ *              descriptor FD with preadv()/pwritev(), for use by the
+ *              read_vector and write_vector callbacks of the sec2 and
+ *              direct VFDs.
+ *
+ *              Runs of vector elements whose file ranges are adjacent
+ *              (addrs[i] == addrs[i - 1] + sizes[i - 1]) are merged into
+ *              a single system call, with one iovec per element to
+ *              scatter or gather the data in memory.  A selection I/O
+ *              request on a contiguous or unfiltered chunked dataset is
+ *              translated into one vector element per sequence, so this
+ *              issues one system call per run of adjacent sequences rather
+ *              than one per sequence.
+ *
+ *              When FILE_ALIGN is non-zero (O_DIRECT), only elements whose
+ *              address and size are multiples of FILE_ALIGN and whose
+ *              buffer is aligned to MEM_ALIGN are batched.  Other elements
+ *              are passed to the driver's read or write callback, which
+ *              handles them through an aligned copy buffer.
+ *
+ *              On a successful write, *EOF is raised to the end of the
+ *              highest range written by this routine.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD__iov_vector_io(H5FD_t *file, int fd, bool do_write, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                    haddr_t addrs[], size_t sizes[], void *bufs[], size_t file_align, size_t mem_align,
+                    haddr_t *eof)
+{
+    struct iovec  local_iov[H5FD_LOCAL_IOV_LEN]; /* Stack iovecs for short vectors */
+    struct iovec *iov          = local_iov;      /* iovecs for the current run     */
+    int           iov_max      = H5FD_LOCAL_IOV_LEN;
+    int           iovcnt       = 0;     /* iovecs in the current run        */
+    haddr_t       run_addr     = 0;     /* File address of the current run  */
+    size_t        run_size     = 0;     /* Bytes in the current run         */
+    haddr_t       high_water   = 0;     /* End of the highest run written   */
+    bool          extend_sizes = false;
+    bool          extend_types = false;
+    size_t        size         = 0;
+    H5FD_mem_t    type         = H5FD_MEM_DEFAULT;
+    uint32_t      i;
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(file && file->cls);
+    assert(fd >= 0);
+    assert((count == 0) || (types && addrs && sizes && bufs));
+    assert((count == 0) || (sizes[0] != 0));
+    assert((count == 0) || (types[0] != H5FD_MEM_NOLIST));
+    assert(file_align == 0 || mem_align > 0);
+
+    /* Use a heap array for long vectors, up to the system limit on iovecs */
+    if (count > H5FD_LOCAL_IOV_LEN) {
+        iov_max = (int)MIN(count, H5FD_IOV_MAX);
+        if (NULL == (iov = (struct iovec *)H5MM_malloc((size_t)iov_max * sizeof(struct iovec))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate iovec array");
+    }
+
+    for (i = 0; i < count; i++) {
+        haddr_t addr = addrs[i];
+        void   *buf  = bufs[i];
+
+        /* The sizes and types arrays may be shortened by a zero or
+         * H5FD_MEM_NOLIST entry, meaning "repeat the previous value"
+         */
+        if (!extend_sizes) {
+            if (sizes[i] == 0) {
+                extend_sizes = true;
+                size         = sizes[i - 1];
+            }
+            else
+                size = sizes[i];
+        }
+        if (!extend_types) {
+            if (types[i] == H5FD_MEM_NOLIST) {
+                extend_types = true;
+                type         = types[i - 1];
+            }
+            else
+                type = types[i];
+        }
+
+        if (!H5_addr_defined(addr))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr);
+        if (H5FD_REGION_OVERFLOW(addr, size))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                        (unsigned long long)addr, (unsigned long long)size);
+
+        /* Elements that can't be batched are handed to the driver's scalar
+         * callback, after finishing the run that precedes them
+         */
+        if (size > H5_POSIX_MAX_IO_BYTES ||
+            (file_align > 0 && (addr % file_align != 0 || size % file_align != 0 ||
+                                (size_t)buf % mem_align != 0))) {
+            if (iovcnt > 0) {
+                if (H5FD__iov_flush(fd, do_write, file_align > 0, iov, iovcnt, run_addr, run_size) < 0)
+                    HGOTO_ERROR(H5E_VFL, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                                "vector I/O run failed");
+                if (do_write)
+                    high_water = MAX(high_water, run_addr + run_size);
+                iovcnt = 0;
+            }
+
+            if (do_write) {
+                if ((file->cls->write)(file, type, dxpl_id, addr, size, buf) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write request failed");
+            }
+            else {
+                if ((file->cls->read)(file, type, dxpl_id, addr, size, buf) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read request failed");
+            }
+
+            continue;
+        }
+
+        /* Finish the current run if this element doesn't extend it */
+        if (iovcnt > 0 &&
+            (addr != run_addr + run_size || iovcnt == iov_max || size > H5_POSIX_MAX_IO_BYTES - run_size)) {
+            if (H5FD__iov_flush(fd, do_write, file_align > 0, iov, iovcnt, run_addr, run_size) < 0)
+                HGOTO_ERROR(H5E_VFL, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                            "vector I/O run failed");
+            if (do_write)
+                high_water = MAX(high_water, run_addr + run_size);
+            iovcnt = 0;
+        }
+
+        if (0 == iovcnt) {
+            run_addr = addr;
+            run_size = 0;
+        }
+        iov[iovcnt].iov_base = buf;
+        iov[iovcnt].iov_len  = size;
+        iovcnt++;
+        run_size += size;
+    }
+
+    /* Finish the last run */
+    if (iovcnt > 0) {
+        if (H5FD__iov_flush(fd, do_write, file_align > 0, iov, iovcnt, run_addr, run_size) < 0)
+            HGOTO_ERROR(H5E_VFL, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "vector I/O run failed");
+        if (do_write)
+            high_water = MAX(high_water, run_addr + run_size);
+    }
+
+    if (do_write && eof && high_water > *eof)
+        *eof = high_water;
+
+done:
+    if (iov != local_iov)
+        H5MM_xfree(iov);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iov_vector_io() */
+#endif /* H5_HAVE_PREADWRITEV */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD_set_eoa
  *
@@ -0,0 +1,1632 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the LICENSE file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The Linux io_uring file driver.  File I/O is performed through
+ *          an io_uring instance owned by each open file.  Single reads and
+ *          writes are issued as one submission; vector and selection
+ *          requests are submitted as a batch, keeping up to 'queue_depth'
+ *          operations in flight at once so that the storage device can
+ *          service them concurrently.
+ *
+ *          The driver talks to the kernel through the raw io_uring system
+ *          calls, so liburing is not required.
+ */
+
+#include "H5FDmodule.h" /* This source code file is part of the H5FD module */
+
+#include "H5private.h"    /* Generic Functions        */
+#include "H5Eprivate.h"   /* Error handling           */
+#include "H5Fprivate.h"   /* File access              */
+#include "H5FDpkg.h"      /* File drivers             */
+#include "H5FDiouring.h"  /* io_uring file driver     */
+#include "H5FLprivate.h"  /* Free Lists               */
+#include "H5Iprivate.h"   /* IDs                      */
+#include "H5MMprivate.h"  /* Memory management        */
+#include "H5Pprivate.h"   /* Property lists           */
+
+#ifdef H5_HAVE_IOURING_VFD
+
+#include <linux/io_uring.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+/* The driver identification number, initialized at runtime */
+hid_t H5FD_IOURING_id_g = H5I_INVALID_HID;
+
+/* Largest transfer issued in a single submission queue entry (the 'len'
+ * field of an SQE is 32 bits wide).
+ */
+#define H5FD_IOURING_MAX_IO_BYTES ((size_t)1 << 30)
+
+/* Number of requests handled without allocating a request array */
+#define H5FD_IOURING_LOCAL_REQS 16
+
+/* Driver-specific file access properties */
+typedef struct H5FD_iouring_fapl_t {
+    unsigned queue_depth;  /* Number of submission queue entries          */
+    size_t   reg_buf_size; /* Size of each registered buffer (0 for none) */
+} H5FD_iouring_fapl_t;
+
+/* The kernel-shared submission and completion rings of an io_uring
+ * instance, along with the pointers into them computed at setup time.
+ */
+typedef struct H5FD_iouring_ring_t {
+    int      ring_fd; /* io_uring file descriptor              */
+    unsigned entries; /* Number of submission queue entries    */
+
+    /* Submission queue */
+    unsigned            *sq_head;
+    unsigned            *sq_tail;
+    unsigned            *sq_mask;
+    unsigned            *sq_array;
+    struct io_uring_sqe *sqes;
+
+    /* Completion queue */
+    unsigned            *cq_head;
+    unsigned            *cq_tail;
+    unsigned            *cq_mask;
+    struct io_uring_cqe *cqes;
+
+    /* Mappings to release on close */
+    void  *sq_ring;
+    size_t sq_ring_size;
+    void  *cq_ring;
+    size_t cq_ring_size;
+    size_t sqes_size;
+} H5FD_iouring_ring_t;
+
+/* One element of a batch of I/O requests.  'buf', 'addr' and 'size'
+ * describe the part of the request that has not completed yet; a request
+ * that is staged through a registered buffer keeps the caller's buffer in
+ * 'user_buf' and the total length in 'total'.
+ */
+typedef struct H5FD_iouring_req_t {
+    haddr_t        addr;     /* File address of the remaining transfer     */
+    size_t         size;     /* Bytes remaining                            */
+    unsigned char *buf;      /* Memory address of the remaining transfer   */
+    unsigned char *user_buf; /* Caller's buffer, when staged               */
+    size_t         total;    /* Total length of the request                */
+    int            slot;     /* Registered buffer index, or -1             */
+} H5FD_iouring_req_t;
+
+/*
+ * The description of a file belonging to this driver. The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file (the current size of the underlying filesystem file). Since
+ * all I/O is positional there is no file position to track.
+ */
+typedef struct H5FD_iouring_t {
+    H5FD_t              pub;  /* public stuff, must be first      */
+    int                 fd;   /* the filesystem file descriptor   */
+    haddr_t             eoa;  /* end of allocated region          */
+    haddr_t             eof;  /* end of file; current file size   */
+    H5FD_iouring_fapl_t fa;   /* driver-specific properties       */
+    H5FD_iouring_ring_t ring; /* the io_uring instance            */
+
+    /* Registered buffers */
+    unsigned char *reg_bufs;   /* Base of the registered buffer area */
+    int           *free_slots; /* Stack of unused buffer indices     */
+    unsigned       nfree;      /* Number of entries on the stack     */
+
+    bool ignore_disabled_file_locks;
+    char filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+
+    /* On most systems the combination of device and i-node number uniquely
+     * identify a file.
+     */
+    dev_t device; /* file device number   */
+    ino_t inode;  /* file i-node number   */
+
+    /* Information from properties set by 'h5repart' tool
+     *
+     * Whether to eliminate the family driver info and convert this file to
+     * a single file.
+     */
+    bool fam_to_single;
+} H5FD_iouring_t;
+
+/* Prototypes */
+static herr_t  H5FD__iouring_populate_config(unsigned queue_depth, size_t reg_buf_size,
+                                             H5FD_iouring_fapl_t *fa_out);
+static void   *H5FD__iouring_fapl_get(H5FD_t *file);
+static void   *H5FD__iouring_fapl_copy(const void *_old_fa);
+static herr_t  H5FD__iouring_ring_init(H5FD_iouring_t *file);
+static void    H5FD__iouring_ring_term(H5FD_iouring_t *file);
+static herr_t  H5FD__iouring_submit(H5FD_iouring_t *file, bool do_write, size_t count,
+                                    H5FD_iouring_req_t *reqs);
+static H5FD_t *H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__iouring_close(H5FD_t *_file);
+static int     H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__iouring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                  void *buf);
+static herr_t  H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                   const void *buf);
+static herr_t  H5FD__iouring_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                         haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t  H5FD__iouring_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                          haddr_t addrs[], size_t sizes[], const void *bufs[]);
+static herr_t  H5FD__iouring_read_selection(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+                                            hid_t mem_space_ids[], hid_t file_space_ids[], haddr_t offsets[],
+                                            size_t element_sizes[], void *bufs[]);
+static herr_t  H5FD__iouring_write_selection(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+                                             hid_t mem_space_ids[], hid_t file_space_ids[], haddr_t offsets[],
+                                             size_t element_sizes[], const void *bufs[]);
+static herr_t  H5FD__iouring_truncate(H5FD_t *_file, hid_t dxpl_id, bool closing);
+static herr_t  H5FD__iouring_lock(H5FD_t *_file, bool rw);
+static herr_t  H5FD__iouring_unlock(H5FD_t *_file);
+static herr_t  H5FD__iouring_delete(const char *filename, hid_t fapl_id);
+static herr_t  H5FD__iouring_ctl(H5FD_t *_file, uint64_t op_code, uint64_t flags, const void *input,
+                                 void **output);
+
+static const H5FD_class_t H5FD_iouring_g = {
+    H5FD_CLASS_VERSION,            /* struct version       */
+    H5FD_IOURING_VALUE,            /* value                */
+    "io_uring",                    /* name                 */
+    H5FD_MAXADDR,                  /* maxaddr              */
+    H5F_CLOSE_WEAK,                /* fc_degree            */
+    NULL,                          /* terminate            */
+    NULL,                          /* sb_size              */
+    NULL,                          /* sb_encode            */
+    NULL,                          /* sb_decode            */
+    sizeof(H5FD_iouring_fapl_t),   /* fapl_size            */
+    H5FD__iouring_fapl_get,        /* fapl_get             */
+    H5FD__iouring_fapl_copy,       /* fapl_copy            */
+    NULL,                          /* fapl_free            */
+    0,                             /* dxpl_size            */
+    NULL,                          /* dxpl_copy            */
+    NULL,                          /* dxpl_free            */
+    H5FD__iouring_open,            /* open                 */
+    H5FD__iouring_close,           /* close                */
+    H5FD__iouring_cmp,             /* cmp                  */
+    H5FD__iouring_query,           /* query                */
+    NULL,                          /* get_type_map         */
+    NULL,                          /* alloc                */
+    NULL,                          /* free                 */
+    H5FD__iouring_get_eoa,         /* get_eoa              */
+    H5FD__iouring_set_eoa,         /* set_eoa              */
+    H5FD__iouring_get_eof,         /* get_eof              */
+    H5FD__iouring_get_handle,      /* get_handle           */
+    H5FD__iouring_read,            /* read                 */
+    H5FD__iouring_write,           /* write                */
+    H5FD__iouring_read_vector,     /* read_vector          */
+    H5FD__iouring_write_vector,    /* write_vector         */
+    H5FD__iouring_read_selection,  /* read_selection       */
+    H5FD__iouring_write_selection, /* write_selection      */
+    NULL,                          /* flush                */
+    H5FD__iouring_truncate,        /* truncate             */
+    H5FD__iouring_lock,            /* lock                 */
+    H5FD__iouring_unlock,          /* unlock               */
+    H5FD__iouring_delete,          /* del                  */
+    H5FD__iouring_ctl,             /* ctl                  */
+    H5FD_FLMAP_DICHOTOMY           /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_iouring_t struct */
+H5FL_DEFINE_STATIC(H5FD_iouring_t);
+
+/* Declare a free list to manage arrays of requests */
+H5FL_SEQ_DEFINE_STATIC(H5FD_iouring_req_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_register
+ *
+ * Purpose:     Register the driver with the library.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD__iouring_register(void)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5I_VFL != H5I_get_type(H5FD_IOURING_id_g))
+        if ((H5FD_IOURING_id_g = H5FD_register(&H5FD_iouring_g, sizeof(H5FD_class_t), false)) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTREGISTER, FAIL, "unable to register io_uring driver");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_register() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__iouring_unregister
+ *
+ * Purpose:     Reset library driver info.
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+herr_t
+H5FD__iouring_unregister(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Reset VFL ID */
+    H5FD_IOURING_id_g = H5I_INVALID_HID;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_unregister() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_iouring
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_IOURING driver defined in this source file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth, size_t reg_buf_size)
+{
+    H5P_genplist_t     *plist; /* Property list pointer */
+    H5FD_iouring_fapl_t fa;
+    herr_t              ret_value;
+
+    FUNC_ENTER_API(FAIL)
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS, false)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    if (H5FD__iouring_populate_config(queue_depth, reg_buf_size, &fa) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "can't initialize driver configuration info");
+
+    ret_value = H5P_set_driver(plist, H5FD_IOURING, &fa, NULL);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_iouring
+ *
+ * Purpose:     Returns information about the io_uring file access
+ *              property list through the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth /*out*/, size_t *reg_buf_size /*out*/)
+{
+    H5P_genplist_t            *plist; /* Property list pointer */
+    const H5FD_iouring_fapl_t *fa;
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS, true)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list");
+    if (H5FD_IOURING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver");
+    if (NULL == (fa = H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info");
+    if (queue_depth)
+        *queue_depth = fa->queue_depth;
+    if (reg_buf_size)
+        *reg_buf_size = fa->reg_buf_size;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_populate_config
+ *
+ * Purpose:     Populates a H5FD_iouring_fapl_t structure with the provided
+ *              values, supplying defaults where values are not provided.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_populate_config(unsigned queue_depth, size_t reg_buf_size, H5FD_iouring_fapl_t *fa_out)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    assert(fa_out);
+
+    memset(fa_out, 0, sizeof(H5FD_iouring_fapl_t));
+
+    if (queue_depth > H5FD_IOURING_QUEUE_DEPTH_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "queue depth %u is larger than the maximum of %u",
+                    queue_depth, (unsigned)H5FD_IOURING_QUEUE_DEPTH_MAX);
+    if (reg_buf_size > H5FD_IOURING_MAX_IO_BYTES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "registered buffer size is too large");
+
+    fa_out->queue_depth  = queue_depth ? queue_depth : H5FD_IOURING_QUEUE_DEPTH_DEF;
+    fa_out->reg_buf_size = reg_buf_size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_populate_config() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_get(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    void           *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__iouring_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_copy
+ *
+ * Purpose:     Copies the io_uring-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_copy(const void *_old_fa)
+{
+    const H5FD_iouring_fapl_t *old_fa    = (const H5FD_iouring_fapl_t *)_old_fa;
+    H5FD_iouring_fapl_t       *new_fa    = NULL;
+    void                      *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (NULL == (new_fa = (H5FD_iouring_fapl_t *)H5MM_malloc(sizeof(H5FD_iouring_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "memory allocation failed");
+
+    /* Copy the general information */
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_iouring_fapl_t));
+
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_init
+ *
+ * Purpose:     Creates the io_uring instance for a file, maps its
+ *              submission and completion rings and, if requested,
+ *              registers the fixed I/O buffers.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_ring_init(H5FD_iouring_t *file)
+{
+    H5FD_iouring_ring_t   *ring = &file->ring;
+    struct io_uring_params params;
+    unsigned char         *sq_ring;
+    unsigned char         *cq_ring;
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    ring->ring_fd = -1;
+    ring->sq_ring = MAP_FAILED;
+    ring->cq_ring = MAP_FAILED;
+    ring->sqes    = MAP_FAILED;
+
+    memset(&params, 0, sizeof(params));
+    if ((ring->ring_fd = (int)syscall(__NR_io_uring_setup, file->fa.queue_depth, &params)) < 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to create io_uring instance");
+    ring->entries = params.sq_entries;
+
+    /* Map the rings.  Newer kernels place both rings in a single mapping. */
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->sq_ring_size = MAX(ring->sq_ring_size, ring->cq_ring_size);
+        ring->cq_ring_size = 0;
+    }
+
+    if (MAP_FAILED == (ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                                            MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_SQ_RING)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission ring");
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+        ring->cq_ring = ring->sq_ring;
+    else if (MAP_FAILED ==
+             (ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                   ring->ring_fd, IORING_OFF_CQ_RING)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring completion ring");
+
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    if (MAP_FAILED == (ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                                         MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_SQES)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission queue entries");
+
+    /* The kernel reports the offsets of each field within the mappings */
+    sq_ring        = (unsigned char *)ring->sq_ring;
+    cq_ring        = (unsigned char *)ring->cq_ring;
+    ring->sq_head  = (void *)(sq_ring + params.sq_off.head);
+    ring->sq_tail  = (void *)(sq_ring + params.sq_off.tail);
+    ring->sq_mask  = (void *)(sq_ring + params.sq_off.ring_mask);
+    ring->sq_array = (void *)(sq_ring + params.sq_off.array);
+    ring->cq_head  = (void *)(cq_ring + params.cq_off.head);
+    ring->cq_tail  = (void *)(cq_ring + params.cq_off.tail);
+    ring->cq_mask  = (void *)(cq_ring + params.cq_off.ring_mask);
+    ring->cqes     = (void *)(cq_ring + params.cq_off.cqes);
+
+    /* Set up the registered buffers, one per submission queue entry */
+    if (file->fa.reg_buf_size > 0) {
+        struct iovec *iov = NULL;
+        void         *bufs;
+        unsigned      u;
+        int           ret;
+
+        if (0 != posix_memalign(&bufs, (size_t)sysconf(_SC_PAGESIZE), ring->entries * file->fa.reg_buf_size))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate registered buffers");
+        file->reg_bufs = (unsigned char *)bufs;
+
+        if (NULL == (file->free_slots = (int *)H5MM_malloc(ring->entries * sizeof(int))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate registered buffer list");
+        if (NULL == (iov = (struct iovec *)H5MM_malloc(ring->entries * sizeof(struct iovec))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate iovec array");
+
+        for (u = 0; u < ring->entries; u++) {
+            iov[u].iov_base                         = file->reg_bufs + (size_t)u * file->fa.reg_buf_size;
+            iov[u].iov_len                          = file->fa.reg_buf_size;
+            file->free_slots[ring->entries - u - 1] = (int)u;
+        }
+        file->nfree = ring->entries;
+
+        ret = (int)syscall(__NR_io_uring_register, ring->ring_fd, IORING_REGISTER_BUFFERS, iov, ring->entries);
+        H5MM_xfree(iov);
+        if (ret < 0)
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to register io_uring buffers");
+    }
+
+done:
+    if (ret_value < 0)
+        H5FD__iouring_ring_term(file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_ring_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_term
+ *
+ * Purpose:     Releases the io_uring instance and registered buffers of
+ *              a file.  Closing the ring file descriptor unregisters the
+ *              buffers.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_ring_term(H5FD_iouring_t *file)
+{
+    H5FD_iouring_ring_t *ring = &file->ring;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (ring->sqes != MAP_FAILED)
+        munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_ring != MAP_FAILED && ring->cq_ring != ring->sq_ring)
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    if (ring->sq_ring != MAP_FAILED)
+        munmap(ring->sq_ring, ring->sq_ring_size);
+    if (ring->ring_fd >= 0)
+        HDclose(ring->ring_fd);
+    ring->ring_fd = -1;
+    ring->sqes    = MAP_FAILED;
+    ring->cq_ring = MAP_FAILED;
+    ring->sq_ring = MAP_FAILED;
+
+    /* NOTE: Use free here to match posix_memalign() */
+    free(file->reg_bufs);
+    file->reg_bufs   = NULL;
+    file->free_slots = H5MM_xfree(file->free_slots);
+    file->nfree      = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_ring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_queue
+ *
+ * Purpose:     Places the next transfer of request IDX on the submission
+ *              queue.  The caller guarantees that there is room on the
+ *              queue.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_queue(H5FD_iouring_t *file, bool do_write, H5FD_iouring_req_t *req, size_t idx)
+{
+    H5FD_iouring_ring_t *ring = &file->ring;
+    struct io_uring_sqe *sqe;
+    unsigned             tail;
+    unsigned             index;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    tail  = *ring->sq_tail;
+    index = tail & *ring->sq_mask;
+    sqe   = &ring->sqes[index];
+
+    memset(sqe, 0, sizeof(*sqe));
+    if (req->slot >= 0) {
+        sqe->opcode    = do_write ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED;
+        sqe->buf_index = (__u16)req->slot;
+    }
+    else
+        sqe->opcode = do_write ? IORING_OP_WRITE : IORING_OP_READ;
+    sqe->fd        = file->fd;
+    sqe->off       = (__u64)req->addr;
+    sqe->addr      = (__u64)(uintptr_t)req->buf;
+    sqe->len       = (__u32)MIN(req->size, H5FD_IOURING_MAX_IO_BYTES);
+    sqe->user_data = (__u64)idx;
+
+    ring->sq_array[index] = index;
+
+    /* Make the entry visible to the kernel before the new tail */
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_queue() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_unqueue
+ *
+ * Purpose:     Takes back the entries on the submission queue that the
+ *              kernel has not consumed yet, returning their registered
+ *              buffers and removing them from the IN_FLIGHT count.
+ *
+ *              The ring is not set up for kernel-side polling, so the
+ *              kernel only consumes entries inside io_uring_enter and the
+ *              queue can safely be rewound here.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_unqueue(H5FD_iouring_t *file, H5FD_iouring_req_t *reqs, size_t *in_flight)
+{
+    H5FD_iouring_ring_t *ring = &file->ring;
+    unsigned             head;
+    unsigned             tail;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+    tail = *ring->sq_tail;
+    while (tail != head) {
+        H5FD_iouring_req_t *req;
+
+        tail--;
+        req = &reqs[ring->sqes[tail & *ring->sq_mask].user_data];
+        if (req->slot >= 0) {
+            file->free_slots[file->nfree++] = req->slot;
+            req->slot                       = -1;
+        }
+        assert(*in_flight > 0);
+        (*in_flight)--;
+    }
+    __atomic_store_n(ring->sq_tail, tail, __ATOMIC_RELEASE);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_unqueue() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_submit
+ *
+ * Purpose:     Performs a batch of COUNT reads or writes.  Requests are
+ *              placed on the submission queue until it is full and
+ *              submitted together; as completions arrive, further
+ *              requests are queued so that up to 'queue_depth' operations
+ *              stay in flight.  Short transfers are resubmitted for the
+ *              remainder, and reads past the end of the file are zero
+ *              filled.
+ *
+ *              On error, nothing more is submitted, but all operations
+ *              already in flight are reaped before returning, since the
+ *              kernel may still be accessing their buffers.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_submit(H5FD_iouring_t *file, bool do_write, size_t count, H5FD_iouring_req_t *reqs)
+{
+    H5FD_iouring_ring_t *ring       = &file->ring;
+    size_t               next       = 0;     /* Next request to queue            */
+    size_t               in_flight  = 0;     /* Requests queued or submitted     */
+    unsigned             to_submit  = 0;     /* Queued but not yet submitted     */
+    int                  err        = 0;     /* First error reported by kernel   */
+    haddr_t              high_water = 0;     /* Highest address written          */
+    herr_t               ret_value  = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+    assert(reqs || count == 0);
+
+    while (in_flight > 0 || (next < count && 0 == err)) {
+        unsigned head;
+        unsigned tail;
+        int      ret;
+
+        /* Fill the submission queue */
+        while (0 == err && next < count && in_flight < ring->entries) {
+            H5FD_iouring_req_t *req = &reqs[next];
+
+            if (req->size > 0) {
+                /* Stage small requests through a registered buffer, if one is free */
+                req->slot = -1;
+                if (file->nfree > 0 && req->size <= file->fa.reg_buf_size) {
+                    req->slot     = file->free_slots[--file->nfree];
+                    req->user_buf = req->buf;
+                    req->total    = req->size;
+                    req->buf      = file->reg_bufs + (size_t)req->slot * file->fa.reg_buf_size;
+                    if (do_write)
+                        H5MM_memcpy(req->buf, req->user_buf, req->size);
+                }
+
+                H5FD__iouring_queue(file, do_write, req, next);
+                in_flight++;
+                to_submit++;
+            }
+            next++;
+        }
+
+        if (0 == in_flight)
+            break;
+
+        /* Submit the queued entries and wait for at least one completion */
+        do {
+            ret = (int)syscall(__NR_io_uring_enter, ring->ring_fd, to_submit, 1, IORING_ENTER_GETEVENTS,
+                               NULL, (size_t)0);
+        } while (ret < 0 && (EINTR == errno || EAGAIN == errno || EBUSY == errno));
+        if (ret < 0) {
+            /* Submit nothing more, but keep reaping the operations the
+             * kernel already has until they complete
+             */
+            if (0 == err)
+                err = errno;
+            H5FD__iouring_unqueue(file, reqs, &in_flight);
+            to_submit = 0;
+            if (0 == in_flight)
+                break;
+
+            /* Completions are still posted while the wait fails */
+            (void)sched_yield();
+        }
+        else
+            to_submit -= MIN((unsigned)ret, to_submit);
+
+        /* Reap completions */
+        head = *ring->cq_head;
+        tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+        while (head != tail) {
+            struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+            H5FD_iouring_req_t  *req = &reqs[cqe->user_data];
+            int                  res = cqe->res;
+            bool                 done;
+
+            head++;
+
+            if (res < 0 && (-EINTR == res || -EAGAIN == res) && 0 == err) {
+                /* Retry the interrupted transfer */
+                H5FD__iouring_queue(file, do_write, req, (size_t)cqe->user_data);
+                to_submit++;
+                continue;
+            }
+
+            if (res < 0) {
+                if (0 == err)
+                    err = -res;
+                done = true;
+            }
+            else if (0 == res) {
+                /* End of file but not end of format address space (reads),
+                 * or a device that accepted no data (writes)
+                 */
+                if (do_write) {
+                    if (0 == err)
+                        err = EIO;
+                }
+                else
+                    memset(req->buf, 0, req->size);
+                done = true;
+            }
+            else {
+                assert((size_t)res <= req->size);
+                req->addr += (haddr_t)res;
+                req->buf += res;
+                req->size -= (size_t)res;
+                if (do_write && req->addr > high_water)
+                    high_water = req->addr;
+                done = (0 == req->size || 0 != err);
+                if (!done) {
+                    H5FD__iouring_queue(file, do_write, req, (size_t)cqe->user_data);
+                    to_submit++;
+                }
+            }
+
+            if (done) {
+                if (req->slot >= 0) {
+                    unsigned char *slot_buf = file->reg_bufs + (size_t)req->slot * file->fa.reg_buf_size;
+
+                    if (!do_write && 0 == err)
+                        H5MM_memcpy(req->user_buf, slot_buf, req->total);
+                    file->free_slots[file->nfree++] = req->slot;
+                    req->slot                       = -1;
+                }
+                in_flight--;
+            }
+        }
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    }
+
+    if (do_write && high_water > file->eof)
+        file->eof = high_water;
+
+    if (err != 0)
+        HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                    "io_uring %s failed: filename = '%s', file descriptor = %d, errno = %d, "
+                    "error message = '%s', request count = %zu",
+                    do_write ? "write" : "read", file->filename, file->fd, err, strerror(err), count);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_submit() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_iouring_t            *file = NULL; /* io_uring VFD info        */
+    int                        fd   = -1;   /* File descriptor          */
+    int                        o_flags;     /* Flags for open() call    */
+    const H5FD_iouring_fapl_t *fa;
+    H5FD_iouring_fapl_t        default_fa;
+    h5_stat_t                  sb;
+    H5P_genplist_t            *plist;            /* Property list pointer */
+    H5FD_t                    *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name");
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr");
+    if (H5FD_ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr");
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if (H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if (H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if (H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+
+    /* Open the file */
+    if ((fd = HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(
+            H5E_FILE, H5E_CANTOPENFILE, NULL,
+            "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x",
+            name, myerrno, strerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+
+    memset(&sb, 0, sizeof(h5_stat_t));
+    if (HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file");
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_iouring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct");
+    file->ring.ring_fd = -1;
+    file->ring.sq_ring = MAP_FAILED;
+    file->ring.cq_ring = MAP_FAILED;
+    file->ring.sqes    = MAP_FAILED;
+
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->device = sb.st_dev;
+    file->inode  = sb.st_ino;
+
+    /* Get the driver specific information */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS, true)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list");
+    if (NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist))) {
+        if (H5FD__iouring_populate_config(0, 0, &default_fa) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTSET, NULL, "can't initialize driver configuration info");
+        fa = &default_fa;
+    }
+    H5MM_memcpy(&file->fa, fa, sizeof(H5FD_iouring_fapl_t));
+
+    /* Check the file locking flags in the fapl */
+    if (H5FD_ignore_disabled_file_locks_p != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = H5FD_ignore_disabled_file_locks_p;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property");
+    }
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    strncpy(file->filename, name, sizeof(file->filename) - 1);
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Check for non-default FAPL */
+    if (H5P_FILE_ACCESS_DEFAULT != fapl_id) {
+        /* This step is for h5repart tool only. If user wants to change file driver from
+         * family to one that uses single files (sec2, etc.) while using h5repart, this
+         * private property should be set so that in the later step, the library can ignore
+         * the family driver information saved in the superblock.
+         */
+        if (H5P_exist_plist(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME) > 0)
+            if (H5P_get(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME, &file->fam_to_single) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get property of changing family to single");
+    } /* end if */
+
+    /* Set up the io_uring instance */
+    if (H5FD__iouring_ring_init(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to set up io_uring for file");
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (NULL == ret_value) {
+        if (fd >= 0)
+            HDclose(fd);
+        if (file)
+            file = H5FL_FREE(H5FD_iouring_t, file);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_close
+ *
+ * Purpose:     Closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_close(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(file);
+
+    /* Tear down the ring (there is never any I/O in flight between calls) */
+    H5FD__iouring_ring_term(file);
+
+    /* Close the underlying file */
+    if (HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file");
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_iouring_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_iouring_t *f1        = (const H5FD_iouring_t *)_f1;
+    const H5FD_iouring_t *f2        = (const H5FD_iouring_t *)_f2;
+    int                   ret_value = 0;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1);
+    if (f1->device > f2->device)
+        HGOTO_DONE(1);
+
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1);
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ *              SWMR I/O is not advertised: the requests of a vector write
+ *              may complete in any order.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_query(const H5FD_t *_file, unsigned long *flags /* out */)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file; /* io_uring VFD info */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
+        *flags |= H5FD_FEAT_DATA_SIEVE; /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE; /* get_handle callback returns a POSIX file descriptor */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
+                                                       VFD      */
+
+        /* Check for flags that are set by h5repart */
+        if (file && file->fam_to_single)
+            *flags |= H5FD_FEAT_IGNORE_DRVRINFO; /* Ignore the driver info when file is opened (which
+                                                    eliminates it) */
+    }                                            /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__iouring_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the greater of
+ *              either the filesystem end-of-file or the HDF5 end-of-address
+ *              markers.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__iouring_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:       H5FD__iouring_get_handle
+ *
+ * Purpose:        Returns the file handle of io_uring file driver.
+ *
+ * Returns:        SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid");
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                   size_t size, void *buf /*out*/)
+{
+    H5FD_iouring_t    *file = (H5FD_iouring_t *)_file;
+    H5FD_iouring_req_t req;
+    herr_t             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr);
+    if (H5FD_REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr);
+
+    req.addr = addr;
+    req.size = size;
+    req.buf  = (unsigned char *)buf;
+    req.slot = -1;
+    if (H5FD__iouring_submit(file, false, 1, &req) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                    size_t size, const void *buf)
+{
+    H5FD_iouring_t    *file = (H5FD_iouring_t *)_file;
+    H5FD_iouring_req_t req;
+    herr_t             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr);
+    if (H5FD_REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                    (unsigned long long)addr, (unsigned long long)size);
+
+    /* The buffer is only read from on the write path */
+    req.addr = addr;
+    req.size = size;
+    H5_WARN_CAST_AWAY_CONST_OFF
+    req.buf = (unsigned char *)buf;
+    H5_WARN_CAST_AWAY_CONST_ON
+    req.slot = -1;
+    if (H5FD__iouring_submit(file, true, 1, &req) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_build_reqs
+ *
+ * Purpose:     Expands the (possibly abbreviated) sizes array of a vector
+ *              I/O request into an array of io_uring requests, checking
+ *              the addresses for overflow.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_build_reqs(uint32_t count, haddr_t addrs[], size_t sizes[], void *bufs[],
+                         H5FD_iouring_req_t *reqs)
+{
+    bool     extend_sizes = false;
+    size_t   size         = 0;
+    uint32_t i;
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    for (i = 0; i < count; i++) {
+        /* The sizes array may be shortened by a zero entry; the caller has
+         * already verified that sizes[0] != 0
+         */
+        if (!extend_sizes) {
+            if (sizes[i] == 0) {
+                extend_sizes = true;
+                size         = sizes[i - 1];
+            }
+            else
+                size = sizes[i];
+        }
+
+        if (!H5_addr_defined(addrs[i]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu",
+                        (unsigned long long)addrs[i]);
+        if (H5FD_REGION_OVERFLOW(addrs[i], size))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                        (unsigned long long)addrs[i], (unsigned long long)size);
+
+        reqs[i].addr = addrs[i];
+        reqs[i].size = size;
+        reqs[i].buf  = (unsigned char *)bufs[i];
+        reqs[i].slot = -1;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_build_reqs() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read_vector
+ *
+ * Purpose:     Reads the COUNT elements of the vector request from the
+ *              file, submitting them to the kernel as a single batch.
+ *
+ * Return:      Success:    SUCCEED. Results are stored in the buffers
+ *                          in BUFS.
+ *              Failure:    FAIL, contents of the buffers are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+                          H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[],
+                          void *bufs[] /* out */)
+{
+    H5FD_iouring_t     *file = (H5FD_iouring_t *)_file;
+    H5FD_iouring_req_t  local_reqs[H5FD_IOURING_LOCAL_REQS];
+    H5FD_iouring_req_t *reqs      = local_reqs;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert((count == 0) || (addrs && sizes && bufs));
+
+    if (0 == count)
+        HGOTO_DONE(SUCCEED);
+
+    if (count > H5FD_IOURING_LOCAL_REQS)
+        if (NULL == (reqs = H5FL_SEQ_MALLOC(H5FD_iouring_req_t, count)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate request array");
+
+    if (H5FD__iouring_build_reqs(count, addrs, sizes, bufs, reqs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid vector read request");
+
+    if (H5FD__iouring_submit(file, false, count, reqs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read failed");
+
+done:
+    if (reqs != local_reqs)
+        reqs = H5FL_SEQ_FREE(H5FD_iouring_req_t, reqs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write_vector
+ *
+ * Purpose:     Writes the COUNT elements of the vector request to the
+ *              file, submitting them to the kernel as a single batch.
+ *
+ *              The elements of the vector are not guaranteed to reach
+ *              the file in order; overlapping elements therefore have
+ *              undefined results.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+                           H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[],
+                           const void *bufs[] /* in */)
+{
+    H5FD_iouring_t     *file = (H5FD_iouring_t *)_file;
+    H5FD_iouring_req_t  local_reqs[H5FD_IOURING_LOCAL_REQS];
+    H5FD_iouring_req_t *reqs      = local_reqs;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert((count == 0) || (addrs && sizes && bufs));
+
+    if (0 == count)
+        HGOTO_DONE(SUCCEED);
+
+    if (count > H5FD_IOURING_LOCAL_REQS)
+        if (NULL == (reqs = H5FL_SEQ_MALLOC(H5FD_iouring_req_t, count)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate request array");
+
+    /* The buffers are only read from on the write path */
+    H5_WARN_CAST_AWAY_CONST_OFF
+    if (H5FD__iouring_build_reqs(count, addrs, sizes, (void **)bufs, reqs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid vector write request");
+    H5_WARN_CAST_AWAY_CONST_ON
+
+    if (H5FD__iouring_submit(file, true, count, reqs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write failed");
+
+done:
+    if (reqs != local_reqs)
+        reqs = H5FL_SEQ_FREE(H5FD_iouring_req_t, reqs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read_selection
+ *
+ * Purpose:     Reads the selections by translating them into a single
+ *              vector read, so that every sequence of every selection is
+ *              submitted in one batch.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read_selection(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, size_t count,
+                             hid_t mem_space_ids[], hid_t file_space_ids[], haddr_t offsets[],
+                             size_t element_sizes[], void *bufs[] /* out */)
+{
+    size_t i;
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(_file);
+
+    /* Undo the base address addition done by the internal routines, since
+     * the vector translation below will add it again
+     */
+    if (_file->base_addr > 0)
+        for (i = 0; i < count; i++) {
+            assert(offsets[i] >= _file->base_addr);
+            offsets[i] -= _file->base_addr;
+        }
+
+    if (H5FD_read_vector_from_selection(_file, type, (uint32_t)count, mem_space_ids, file_space_ids, offsets,
+                                        element_sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "read vector from selection failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read_selection() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write_selection
+ *
+ * Purpose:     Writes the selections by translating them into a single
+ *              vector write, so that every sequence of every selection is
+ *              submitted in one batch.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write_selection(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, size_t count,
+                              hid_t mem_space_ids[], hid_t file_space_ids[], haddr_t offsets[],
+                              size_t element_sizes[], const void *bufs[] /* in */)
+{
+    size_t i;
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(_file);
+
+    /* Undo the base address addition done by the internal routines, since
+     * the vector translation below will add it again
+     */
+    if (_file->base_addr > 0)
+        for (i = 0; i < count; i++) {
+            assert(offsets[i] >= _file->base_addr);
+            offsets[i] -= _file->base_addr;
+        }
+
+    if (H5FD_write_vector_from_selection(_file, type, (uint32_t)count, mem_space_ids, file_space_ids, offsets,
+                                         element_sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "write vector from selection failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write_selection() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same (or larger)
+ *              than the end-of-address.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, bool H5_ATTR_UNUSED closing)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    /* Extend the file to make sure it's large enough */
+    if (!H5_addr_eq(file->eoa, file->eof)) {
+        if (-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly");
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			true--opens for write: an exclusive lock
+ *			false--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_lock(H5FD_t *_file, bool rw)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    int             lock_flags;                     /* file locking flags       */
+    herr_t          ret_value = SUCCEED;            /* Return value             */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if (HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file");
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_unlock(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    herr_t          ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (HDflock(file->fd, LOCK_UN) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file");
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_unlock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_delete
+ *
+ * Purpose:     Delete a file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_delete(const char *filename, hid_t H5_ATTR_UNUSED fapl_id)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(filename);
+
+    if (HDremove(filename) < 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTDELETEFILE, FAIL, "unable to delete file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_delete() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ctl
+ *
+ * Purpose:     io_uring VFD version of the ctl callback.
+ *
+ *              At present, no op codes are supported by this VFD.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_ctl(H5FD_t H5_ATTR_UNUSED *_file, uint64_t H5_ATTR_UNUSED op_code, uint64_t flags,
+                  const void H5_ATTR_UNUSED *input, void H5_ATTR_UNUSED **output)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    /* No op codes are understood. */
+    if (flags & H5FD_CTL_FAIL_IF_UNKNOWN_FLAG)
+        HGOTO_ERROR(H5E_VFL, H5E_FCNTL, FAIL, "unknown op_code and fail if unknown flag is set");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_ctl() */
+
+#endif /* H5_HAVE_IOURING_VFD */
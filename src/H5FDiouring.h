@@ -0,0 +1,120 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the LICENSE file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the Linux io_uring virtual file driver (VFD)
+ */
+#ifndef H5FDiouring_H
+#define H5FDiouring_H
+
+/* Public header files */
+#include "H5FDpublic.h" /* File drivers             */
+
+#ifdef H5_HAVE_IOURING_VFD
+
+/** ID for the io_uring VFD */
+#define H5FD_IOURING (H5OPEN H5FD_IOURING_id_g)
+
+/** Identifier for the io_uring VFD \since 2.0.0 */
+#define H5FD_IOURING_VALUE H5_VFD_IOURING
+
+#else
+
+/** Initializer for the io_uring VFD (disabled) */
+#define H5FD_IOURING       (H5I_INVALID_HID)
+
+/** Identifier for the io_uring VFD (disabled) */
+#define H5FD_IOURING_VALUE H5_VFD_INVALID
+
+#endif /* H5_HAVE_IOURING_VFD */
+
+/** Default number of submission queue entries for the io_uring VFD */
+#define H5FD_IOURING_QUEUE_DEPTH_DEF 64
+
+/** Largest submission queue depth accepted by the io_uring VFD */
+#define H5FD_IOURING_QUEUE_DEPTH_MAX 4096
+
+#ifdef H5_HAVE_IOURING_VFD
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @private
+ *
+ * \brief ID for the io_uring VFD
+ */
+H5_DLLVAR hid_t H5FD_IOURING_id_g;
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets up use of the Linux io_uring driver
+ *
+ * \fapl_id
+ * \param[in] queue_depth Number of I/O requests that may be in flight at once
+ * \param[in] reg_buf_size Size of each registered (fixed) I/O buffer, or 0
+ * \returns \herr_t
+ *
+ * \details H5Pset_fapl_iouring() sets the file access property list, \p
+ *          fapl_id, to use the io_uring driver, #H5FD_IOURING. The driver
+ *          performs POSIX file I/O through a Linux io_uring instance owned by
+ *          each open file. Vector and selection I/O requests are submitted to
+ *          the kernel as a single batch of up to \p queue_depth concurrent
+ *          operations rather than as a sequence of individual system calls,
+ *          which allows devices with deep hardware queues (e.g. NVMe) to
+ *          service them in parallel.
+ *
+ *          \p queue_depth is the number of submission queue entries. A value
+ *          of 0 (zero) selects the default of #H5FD_IOURING_QUEUE_DEPTH_DEF.
+ *          The kernel rounds this value up to the next power of two.
+ *
+ *          When \p reg_buf_size is non-zero, the driver registers
+ *          \p queue_depth buffers of \p reg_buf_size bytes each with the
+ *          kernel. Requests no larger than \p reg_buf_size are staged through
+ *          these buffers and issued as fixed-buffer operations, avoiding the
+ *          per-request page pinning done by the kernel. Registered buffers
+ *          count against the process's locked memory limit
+ *          (RLIMIT_MEMLOCK).
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth, size_t reg_buf_size);
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves io_uring driver settings
+ *
+ * \fapl_id
+ * \param[out] queue_depth Number of I/O requests that may be in flight at once
+ * \param[out] reg_buf_size Size of each registered (fixed) I/O buffer
+ * \returns \herr_t
+ *
+ * \details H5Pget_fapl_iouring() retrieves the submission queue depth and
+ *          registered buffer size for the io_uring driver, #H5FD_IOURING,
+ *          from the file access property list \p fapl_id.
+ *
+ *          See H5Pset_fapl_iouring() for discussion of these values.
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth /*out*/, size_t *reg_buf_size /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_IOURING_VFD */
+
+#endif
@@ -0,0 +1,988 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the LICENSE file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The read-only memory-mapped file driver.  The whole file is
+ *          mapped with mmap() when it is opened and reads are satisfied by
+ *          copying from the mapping.  Since the mapping is shared, every
+ *          process that opens the same file uses the same pages of the
+ *          operating system's page cache.  The mapping is also handed out
+ *          through the "get mapped view" ctl operation, which lets the
+ *          library return pointers into the file instead of copying.
+ *
+ *          The file can't change while it is mapped (the driver can't
+ *          write), so the file is never remapped.
+ */
+
+#include "H5FDmodule.h" /* This source code file is part of the H5FD module */
+
+#include "H5private.h"   /* Generic Functions        */
+#include "H5Eprivate.h"  /* Error handling           */
+#include "H5Fprivate.h"  /* File access              */
+#include "H5FDpkg.h"     /* File drivers             */
+#include "H5FDmmap.h"    /* mmap file driver         */
+#include "H5FLprivate.h" /* Free Lists               */
+#include "H5Iprivate.h"  /* IDs                      */
+#include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+
+#ifdef H5_HAVE_MMAP_VFD
+
+#include <sys/mman.h>
+
+/* The driver identification number, initialized at runtime */
+hid_t H5FD_MMAP_id_g = H5I_INVALID_HID;
+
+/* Driver-specific file access properties */
+typedef struct H5FD_mmap_fapl_t {
+    H5FD_mmap_advice_t advice; /* Access pattern hint for the whole file */
+} H5FD_mmap_fapl_t;
+
+/*
+ * The description of a file belonging to this driver. The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the size of the
+ * underlying filesystem file.  'map' is the read-only mapping of the whole
+ * file, or NULL for an empty file (which can't be mapped).
+ */
+typedef struct H5FD_mmap_t {
+    H5FD_t           pub;       /* public stuff, must be first      */
+    int              fd;        /* the filesystem file descriptor   */
+    haddr_t          eoa;       /* end of allocated region          */
+    haddr_t          eof;       /* end of file; current file size   */
+    unsigned char   *map;       /* the mapping of the file          */
+    size_t           map_size;  /* size of the mapping              */
+    size_t           page_size; /* system page size                 */
+    H5FD_mmap_fapl_t fa;        /* driver-specific properties       */
+
+    bool ignore_disabled_file_locks;
+    char filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+
+    /* On most systems the combination of device and i-node number uniquely
+     * identify a file.
+     */
+    dev_t device; /* file device number   */
+    ino_t inode;  /* file i-node number   */
+} H5FD_mmap_t;
+
+/* Prototypes */
+static herr_t  H5FD__mmap_populate_config(H5FD_mmap_advice_t advice, H5FD_mmap_fapl_t *fa_out);
+static void   *H5FD__mmap_fapl_get(H5FD_t *file);
+static void   *H5FD__mmap_fapl_copy(const void *_old_fa);
+static int     H5FD__mmap_advice_flag(H5FD_mmap_advice_t advice);
+static H5FD_t *H5FD__mmap_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__mmap_close(H5FD_t *_file);
+static int     H5FD__mmap_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__mmap_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__mmap_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__mmap_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__mmap_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__mmap_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__mmap_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                               void *buf);
+static herr_t  H5FD__mmap_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                const void *buf);
+static herr_t  H5FD__mmap_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                      haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t  H5FD__mmap_lock(H5FD_t *_file, bool rw);
+static herr_t  H5FD__mmap_unlock(H5FD_t *_file);
+static herr_t  H5FD__mmap_delete(const char *filename, hid_t fapl_id);
+static herr_t  H5FD__mmap_ctl(H5FD_t *_file, uint64_t op_code, uint64_t flags, const void *input,
+                              void **output);
+
+static const H5FD_class_t H5FD_mmap_g = {
+    H5FD_CLASS_VERSION,       /* struct version       */
+    H5FD_MMAP_VALUE,          /* value                */
+    "mmap",                   /* name                 */
+    H5FD_MAXADDR,             /* maxaddr              */
+    H5F_CLOSE_WEAK,           /* fc_degree            */
+    NULL,                     /* terminate            */
+    NULL,                     /* sb_size              */
+    NULL,                     /* sb_encode            */
+    NULL,                     /* sb_decode            */
+    sizeof(H5FD_mmap_fapl_t), /* fapl_size            */
+    H5FD__mmap_fapl_get,      /* fapl_get             */
+    H5FD__mmap_fapl_copy,     /* fapl_copy            */
+    NULL,                     /* fapl_free            */
+    0,                        /* dxpl_size            */
+    NULL,                     /* dxpl_copy            */
+    NULL,                     /* dxpl_free            */
+    H5FD__mmap_open,          /* open                 */
+    H5FD__mmap_close,         /* close                */
+    H5FD__mmap_cmp,           /* cmp                  */
+    H5FD__mmap_query,         /* query                */
+    NULL,                     /* get_type_map         */
+    NULL,                     /* alloc                */
+    NULL,                     /* free                 */
+    H5FD__mmap_get_eoa,       /* get_eoa              */
+    H5FD__mmap_set_eoa,       /* set_eoa              */
+    H5FD__mmap_get_eof,       /* get_eof              */
+    H5FD__mmap_get_handle,    /* get_handle           */
+    H5FD__mmap_read,          /* read                 */
+    H5FD__mmap_write,         /* write                */
+    H5FD__mmap_read_vector,   /* read_vector          */
+    NULL,                     /* write_vector         */
+    NULL,                     /* read_selection       */
+    NULL,                     /* write_selection      */
+    NULL,                     /* flush                */
+    NULL,                     /* truncate             */
+    H5FD__mmap_lock,          /* lock                 */
+    H5FD__mmap_unlock,        /* unlock               */
+    H5FD__mmap_delete,        /* del                  */
+    H5FD__mmap_ctl,           /* ctl                  */
+    H5FD_FLMAP_DICHOTOMY      /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_mmap_t struct */
+H5FL_DEFINE_STATIC(H5FD_mmap_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_register
+ *
+ * Purpose:     Register the driver with the library.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD__mmap_register(void)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5I_VFL != H5I_get_type(H5FD_MMAP_id_g))
+        if ((H5FD_MMAP_id_g = H5FD_register(&H5FD_mmap_g, sizeof(H5FD_class_t), false)) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTREGISTER, FAIL, "unable to register mmap driver");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_register() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__mmap_unregister
+ *
+ * Purpose:     Reset library driver info.
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+herr_t
+H5FD__mmap_unregister(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Reset VFL ID */
+    H5FD_MMAP_id_g = H5I_INVALID_HID;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__mmap_unregister() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_mmap
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_MMAP driver defined in this source file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_mmap(hid_t fapl_id, H5FD_mmap_advice_t advice)
+{
+    H5P_genplist_t  *plist; /* Property list pointer */
+    H5FD_mmap_fapl_t fa;
+    herr_t           ret_value;
+
+    FUNC_ENTER_API(FAIL)
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS, false)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    if (H5FD__mmap_populate_config(advice, &fa) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "can't initialize driver configuration info");
+
+    ret_value = H5P_set_driver(plist, H5FD_MMAP, &fa, NULL);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_mmap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_mmap
+ *
+ * Purpose:     Returns information about the mmap file access property
+ *              list through the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_mmap(hid_t fapl_id, H5FD_mmap_advice_t *advice /*out*/)
+{
+    H5P_genplist_t         *plist; /* Property list pointer */
+    const H5FD_mmap_fapl_t *fa;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS, true)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list");
+    if (H5FD_MMAP != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver");
+    if (NULL == (fa = H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info");
+    if (advice)
+        *advice = fa->advice;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_mmap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_populate_config
+ *
+ * Purpose:     Populates a H5FD_mmap_fapl_t structure with the provided
+ *              values.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_populate_config(H5FD_mmap_advice_t advice, H5FD_mmap_fapl_t *fa_out)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    assert(fa_out);
+
+    memset(fa_out, 0, sizeof(H5FD_mmap_fapl_t));
+
+    if (advice < H5FD_MMAP_ADVICE_NORMAL || advice > H5FD_MMAP_ADVICE_WILLNEED)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid access pattern hint");
+
+    fa_out->advice = advice;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_populate_config() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__mmap_fapl_get(H5FD_t *_file)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    void        *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__mmap_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_fapl_copy
+ *
+ * Purpose:     Copies the mmap-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__mmap_fapl_copy(const void *_old_fa)
+{
+    const H5FD_mmap_fapl_t *old_fa    = (const H5FD_mmap_fapl_t *)_old_fa;
+    H5FD_mmap_fapl_t       *new_fa    = NULL;
+    void                   *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (NULL == (new_fa = (H5FD_mmap_fapl_t *)H5MM_malloc(sizeof(H5FD_mmap_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "memory allocation failed");
+
+    /* Copy the general information */
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_mmap_fapl_t));
+
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_advice_flag
+ *
+ * Purpose:     Translates an access pattern hint to the madvise() flag.
+ *
+ * Return:      The madvise() flag (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__mmap_advice_flag(H5FD_mmap_advice_t advice)
+{
+    int ret_value = MADV_NORMAL;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    switch (advice) {
+        case H5FD_MMAP_ADVICE_RANDOM:
+            ret_value = MADV_RANDOM;
+            break;
+        case H5FD_MMAP_ADVICE_SEQUENTIAL:
+            ret_value = MADV_SEQUENTIAL;
+            break;
+        case H5FD_MMAP_ADVICE_WILLNEED:
+            ret_value = MADV_WILLNEED;
+            break;
+        case H5FD_MMAP_ADVICE_NORMAL:
+        default:
+            ret_value = MADV_NORMAL;
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_advice_flag() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_open
+ *
+ * Purpose:     Opens an existing file as an HDF5 file and maps it into
+ *              memory.  Files can only be opened read-only.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__mmap_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_mmap_t            *file = NULL; /* mmap VFD info            */
+    int                     fd   = -1;   /* File descriptor          */
+    const H5FD_mmap_fapl_t *fa;
+    H5FD_mmap_fapl_t        default_fa;
+    h5_stat_t               sb;
+    long                    page_size;
+    H5P_genplist_t         *plist;            /* Property list pointer */
+    H5FD_t                 *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name");
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr");
+    if (H5FD_ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr");
+    if (flags & (H5F_ACC_RDWR | H5F_ACC_TRUNC | H5F_ACC_CREAT | H5F_ACC_EXCL))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "the mmap VFD can only open files read-only");
+
+    /* Open the file */
+    if ((fd = HDopen(name, O_RDONLY, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL,
+                    "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x", name,
+                    myerrno, strerror(myerrno), flags);
+    } /* end if */
+
+    memset(&sb, 0, sizeof(h5_stat_t));
+    if (HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file");
+    if ((uint64_t)sb.st_size > (uint64_t)SIZE_MAX)
+        HGOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "file is too large to be mapped");
+    if ((page_size = sysconf(_SC_PAGESIZE)) <= 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "unable to get the system page size");
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_mmap_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct");
+
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->map_size  = (size_t)sb.st_size;
+    file->page_size = (size_t)page_size;
+    file->device    = sb.st_dev;
+    file->inode     = sb.st_ino;
+
+    /* Get the driver specific information */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS, true)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list");
+    if (NULL == (fa = (const H5FD_mmap_fapl_t *)H5P_peek_driver_info(plist))) {
+        if (H5FD__mmap_populate_config(H5FD_MMAP_ADVICE_NORMAL, &default_fa) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTSET, NULL, "can't initialize driver configuration info");
+        fa = &default_fa;
+    }
+    H5MM_memcpy(&file->fa, fa, sizeof(H5FD_mmap_fapl_t));
+
+    /* Check the file locking flags in the fapl */
+    if (H5FD_ignore_disabled_file_locks_p != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = H5FD_ignore_disabled_file_locks_p;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property");
+    }
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    strncpy(file->filename, name, sizeof(file->filename) - 1);
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Map the file.  A zero-length file can't be mapped, but it can't hold
+     * anything to read either.
+     */
+    if (file->map_size > 0) {
+        void *map;
+
+        if (MAP_FAILED == (map = mmap(NULL, file->map_size, PROT_READ, MAP_SHARED, fd, 0)))
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to map file");
+        file->map = (unsigned char *)map;
+
+        /* The hint is only advisory, so failure isn't an error */
+        if (madvise(map, file->map_size, H5FD__mmap_advice_flag(file->fa.advice)) < 0)
+            errno = 0;
+    }
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (NULL == ret_value) {
+        if (fd >= 0)
+            HDclose(fd);
+        if (file)
+            file = H5FL_FREE(H5FD_mmap_t, file);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_close
+ *
+ * Purpose:     Unmaps and closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_close(H5FD_t *_file)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(file);
+
+    /* Release the mapping */
+    if (file->map && munmap(file->map, file->map_size) < 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap file");
+    file->map = NULL;
+
+    /* Close the underlying file */
+    if (HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file");
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_mmap_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__mmap_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_mmap_t *f1        = (const H5FD_mmap_t *)_f1;
+    const H5FD_mmap_t *f2        = (const H5FD_mmap_t *)_f2;
+    int                ret_value = 0;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1);
+    if (f1->device > f2->device)
+        HGOTO_DONE(1);
+
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1);
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ *              Data sieving is not advertised, since reads are already
+ *              served from memory and sieving would only add a copy.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE; /* get_handle callback returns a POSIX file descriptor */
+        *flags |= H5FD_FEAT_CONCURRENT_READ;     /* Reads only copy from the mapping */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
+                                                       VFD      */
+    }                                               /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__mmap_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__mmap_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_mmap_t *file = (const H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__mmap_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__mmap_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the size of the
+ *              file when it was opened.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__mmap_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_mmap_t *file = (const H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__mmap_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:       H5FD__mmap_get_handle
+ *
+ * Purpose:        Returns the file handle of mmap file driver.
+ *
+ * Returns:        SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid");
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF by copying from the mapping.  The part of
+ *              the request past the end of the file is zero filled.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                size_t size, void *buf /*out*/)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr);
+    if (H5FD_REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr);
+
+    /* Copy the part of the request inside the mapping */
+    if (addr < file->map_size) {
+        size_t nbytes = MIN(size, file->map_size - (size_t)addr);
+
+        H5MM_memcpy(buf, file->map + addr, nbytes);
+        size -= nbytes;
+        buf = (unsigned char *)buf + nbytes;
+    }
+
+    /* Zero-fill the rest */
+    if (size > 0)
+        memset(buf, 0, size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_write
+ *
+ * Purpose:     Files are mapped read-only, so writing always fails.
+ *
+ * Return:      FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_write(H5FD_t H5_ATTR_UNUSED *_file, H5FD_mem_t H5_ATTR_UNUSED type,
+                 hid_t H5_ATTR_UNUSED dxpl_id, haddr_t H5_ATTR_UNUSED addr, size_t H5_ATTR_UNUSED size,
+                 const void H5_ATTR_UNUSED *buf)
+{
+    herr_t ret_value = FAIL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "the mmap VFD is read-only");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_read_vector
+ *
+ * Purpose:     Reads the elements of a vector from the mapping.
+ *
+ *              Before anything is copied, the pages under every element are
+ *              passed to madvise(MADV_WILLNEED), so that the kernel reads
+ *              in pages missing from the page cache for all the elements
+ *              at once instead of one page fault at a time during the
+ *              copies.  This is skipped when the whole file was already
+ *              given that hint at open.
+ *
+ *              As usual, a size of 0 or a type of H5FD_MEM_NOLIST repeats
+ *              the previous size or type for the rest of the vector.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                       size_t sizes[], void *bufs[] /* out */)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file;
+    H5FD_mem_t   type = H5FD_MEM_DEFAULT;
+    size_t       size = 0;
+    uint32_t     i;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert((types && addrs && sizes && bufs) || count == 0);
+
+    /* Ask for all of the pages in one pass before copying */
+    if (count > 1 && file->map && file->fa.advice != H5FD_MMAP_ADVICE_WILLNEED)
+        for (i = 0; i < count; i++) {
+            if (sizes[i] != 0)
+                size = sizes[i];
+
+            if (H5_addr_defined(addrs[i]) && addrs[i] < file->map_size && size > 0) {
+                size_t start = (size_t)addrs[i] & ~(file->page_size - 1);
+                size_t end   = (size_t)MIN(addrs[i] + size, (haddr_t)file->map_size);
+
+                /* The hint is only advisory, so failure isn't an error */
+                if (madvise(file->map + start, end - start, MADV_WILLNEED) < 0)
+                    errno = 0;
+            }
+        }
+
+    /* Copy the data */
+    size = 0;
+    for (i = 0; i < count; i++) {
+        if (sizes[i] != 0)
+            size = sizes[i];
+        if (types[i] != H5FD_MEM_NOLIST)
+            type = types[i];
+
+        if (H5FD__mmap_read(_file, type, dxpl_id, addrs[i], size, bufs[i]) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "file vector read request failed");
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *              The lock type to apply depends on the parameter "rw":
+ *                      true--opens for write: an exclusive lock
+ *                      false--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_lock(H5FD_t *_file, bool rw)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file; /* VFD file struct          */
+    int          lock_flags;                  /* file locking flags       */
+    herr_t       ret_value = SUCCEED;         /* Return value             */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if (HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file");
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_unlock(H5FD_t *_file)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file; /* VFD file struct          */
+    herr_t       ret_value = SUCCEED;              /* Return value             */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (HDflock(file->fd, LOCK_UN) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file");
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_unlock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_delete
+ *
+ * Purpose:     Delete a file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_delete(const char *filename, hid_t H5_ATTR_UNUSED fapl_id)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(filename);
+
+    if (HDremove(filename) < 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTDELETEFILE, FAIL, "unable to delete file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_delete() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_ctl
+ *
+ * Purpose:     mmap VFD version of the ctl callback.
+ *
+ *              The desired operation is specified by the op_code
+ *              parameter.
+ *
+ *              The flags parameter controls management of op_codes that
+ *              are unknown to the callback
+ *
+ *              The input and output parameters allow op_code specific
+ *              input and output
+ *
+ *              At present, the only op code supported is
+ *              H5FD_CTL_GET_MAPPED_VIEW_OPCODE, which returns a pointer
+ *              into the mapping for a range of the file (or NULL if the
+ *              range isn't entirely inside the file).
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_ctl(H5FD_t *_file, uint64_t op_code, uint64_t flags, const void *input, void **output)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    switch (op_code) {
+        case H5FD_CTL_GET_MAPPED_VIEW_OPCODE: {
+            const H5FD_ctl_mapped_view_args_t *args = (const H5FD_ctl_mapped_view_args_t *)input;
+
+            if (!args || !output)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid mapped view arguments");
+
+            *output = NULL;
+            if (file->map && H5_addr_defined(args->addr) && args->addr <= file->map_size &&
+                args->size <= file->map_size - (size_t)args->addr)
+                *output = file->map + args->addr;
+            break;
+        }
+
+        default: /* unknown op code */
+            if (flags & H5FD_CTL_FAIL_IF_UNKNOWN_FLAG)
+                HGOTO_ERROR(H5E_VFL, H5E_FCNTL, FAIL, "unknown op_code and fail if unknown flag is set");
+            break;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_ctl() */
+
+#endif /* H5_HAVE_MMAP_VFD */
@@ -0,0 +1,115 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the LICENSE file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the read-only memory-mapped virtual file driver (VFD)
+ */
+#ifndef H5FDmmap_H
+#define H5FDmmap_H
+
+/* Public header files */
+#include "H5FDpublic.h" /* File drivers             */
+
+#ifdef H5_HAVE_MMAP_VFD
+
+/** ID for the mmap VFD */
+#define H5FD_MMAP (H5OPEN H5FD_MMAP_id_g)
+
+/** Identifier for the mmap VFD \since 2.0.0 */
+#define H5FD_MMAP_VALUE H5_VFD_MMAP
+
+#else
+
+/** Initializer for the mmap VFD (disabled) */
+#define H5FD_MMAP       (H5I_INVALID_HID)
+
+/** Identifier for the mmap VFD (disabled) */
+#define H5FD_MMAP_VALUE H5_VFD_INVALID
+
+#endif /* H5_HAVE_MMAP_VFD */
+
+/**
+ * Expected access pattern for a file opened with the mmap VFD, passed to
+ * the kernel with madvise()
+ */
+typedef enum H5FD_mmap_advice_t {
+    H5FD_MMAP_ADVICE_NORMAL = 0, /**< No particular pattern (MADV_NORMAL) */
+    H5FD_MMAP_ADVICE_RANDOM,     /**< Random access, don't read ahead (MADV_RANDOM) */
+    H5FD_MMAP_ADVICE_SEQUENTIAL, /**< Sequential access, read ahead aggressively (MADV_SEQUENTIAL) */
+    H5FD_MMAP_ADVICE_WILLNEED    /**< Whole file will be accessed, start reading it in (MADV_WILLNEED) */
+} H5FD_mmap_advice_t;
+
+#ifdef H5_HAVE_MMAP_VFD
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @private
+ *
+ * \brief ID for the mmap VFD
+ */
+H5_DLLVAR hid_t H5FD_MMAP_id_g;
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets up use of the read-only memory-mapped driver
+ *
+ * \fapl_id
+ * \param[in] advice Expected access pattern for the file
+ * \returns \herr_t
+ *
+ * \details H5Pset_fapl_mmap() sets the file access property list, \p
+ *          fapl_id, to use the memory-mapped driver, #H5FD_MMAP. The driver
+ *          maps the whole file into memory read-only and satisfies reads by
+ *          copying from the mapping, so that processes opening the same file
+ *          share a single copy of its pages in the operating system's page
+ *          cache. Files can only be opened read-only with this driver.
+ *
+ *          \p advice is passed to the kernel with madvise() for the whole
+ *          mapping when the file is opened. Independent of \p advice, the
+ *          driver asks the kernel to start reading in all of the pieces of
+ *          a vector read before copying any of them.
+ *
+ *          Since the file is mapped, the raw data of contiguous datasets can
+ *          be accessed in place with H5Dread_view().
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pset_fapl_mmap(hid_t fapl_id, H5FD_mmap_advice_t advice);
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves memory-mapped driver settings
+ *
+ * \fapl_id
+ * \param[out] advice Expected access pattern for the file
+ * \returns \herr_t
+ *
+ * \details H5Pget_fapl_mmap() retrieves the access pattern hint for the
+ *          memory-mapped driver, #H5FD_MMAP, from the file access property
+ *          list \p fapl_id.
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pget_fapl_mmap(hid_t fapl_id, H5FD_mmap_advice_t *advice /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_MMAP_VFD */
+
+#endif
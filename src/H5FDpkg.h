@@ -72,6 +72,11 @@ H5_DLLVAR htri_t H5FD_ignore_disabled_file_locks_p;
 H5_DLL haddr_t H5FD__alloc_real(H5FD_t *file, H5FD_mem_t type, hsize_t size, haddr_t *align_addr,
                                 hsize_t *align_size);
 H5_DLL herr_t  H5FD__free_real(H5FD_t *file, H5FD_mem_t type, haddr_t addr, hsize_t size);
+#ifdef H5_HAVE_PREADWRITEV
+H5_DLL herr_t H5FD__iov_vector_io(H5FD_t *file, int fd, bool do_write, hid_t dxpl_id, uint32_t count,
+                                  H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[],
+                                  size_t file_align, size_t mem_align, haddr_t *eof);
+#endif
 
 /* Internal VFD init/term routines */
 H5_DLL herr_t H5FD__core_register(void);
@@ -90,8 +95,16 @@ H5_DLL herr_t H5FD__hdfs_unregister(void);
 H5_DLL herr_t H5FD__ioc_register(void);
 H5_DLL herr_t H5FD__ioc_unregister(void);
 #endif
+#ifdef H5_HAVE_IOURING_VFD
+H5_DLL herr_t H5FD__iouring_register(void);
+H5_DLL herr_t H5FD__iouring_unregister(void);
+#endif
 H5_DLL herr_t H5FD__log_register(void);
 H5_DLL herr_t H5FD__log_unregister(void);
+#ifdef H5_HAVE_MMAP_VFD
+H5_DLL herr_t H5FD__mmap_register(void);
+H5_DLL herr_t H5FD__mmap_unregister(void);
+#endif
 #ifdef H5_HAVE_MIRROR_VFD
 H5_DLL herr_t H5FD__mirror_register(void);
 H5_DLL herr_t H5FD__mirror_unregister(void);
@@ -42,6 +42,8 @@
 #define H5_VFD_SUBFILING ((H5FD_class_value_t)(12))
 #define H5_VFD_IOC       ((H5FD_class_value_t)(13))
 #define H5_VFD_ONION     ((H5FD_class_value_t)(14))
+#define H5_VFD_IOURING   ((H5FD_class_value_t)(15))
+#define H5_VFD_MMAP      ((H5FD_class_value_t)(16))
 
 /* VFD IDs below this value are reserved for library use. */
 #define H5_VFD_RESERVED 256
@@ -175,6 +177,26 @@
  * operations when appropriate.
  */
 #define H5FD_FEAT_MEMMANAGE 0x00010000
+/**
+ * Defining H5FD_FEAT_SELECTION_IO_OPT_IN for a VFL driver means that the
+ * driver implements vector and/or selection I/O callbacks, but that the
+ * library should not enable selection I/O for dataset transfers by default
+ * when the driver is in use. Applications can still request selection I/O
+ * with H5Pset_selection_io(). This is used by drivers such as sec2, whose
+ * vector callbacks make vector I/O efficient for the library's internal
+ * users, while data sieving remains the better default for raw data.
+ * \since 2.0.0
+ */
+#define H5FD_FEAT_SELECTION_IO_OPT_IN 0x00020000
+/**
+ * Defining H5FD_FEAT_CONCURRENT_READ for a VFL driver means that the
+ * driver's read callback does not modify the driver's state, and so may be
+ * called by several threads at once on a file opened read-only. Threadsafe
+ * builds of the library use this to read and filter raw data chunks while
+ * other threads are in the library.
+ * \since 2.0.0
+ */
+#define H5FD_FEAT_CONCURRENT_READ 0x00040000
 
 /* ctl function definitions: */
 #define H5FD_CTL_OPC_RESERVED 512 /* Opcodes below this value are reserved for library use */
@@ -195,6 +217,7 @@
 #define H5FD_CTL_MEM_FREE                    6
 #define H5FD_CTL_MEM_COPY                    7
 #define H5FD_CTL_GET_MPI_FILE_SYNC_OPCODE    8
+#define H5FD_CTL_GET_MAPPED_VIEW_OPCODE      10
 
 /* ctl function flags: */
 
@@ -396,6 +419,19 @@ typedef struct H5FD_ctl_memcpy_args_t {
 } H5FD_ctl_memcpy_args_t;
 //! <!-- [H5FD_ctl_memcpy_args_t_snip] -->
 
+/**
+ * Define structure to hold "ctl get mapped view" parameters. A driver that
+ * keeps the file mapped into memory returns, through the \p output argument
+ * of the ctl callback, a read-only pointer to the \p size bytes of the file
+ * at address \p addr, or NULL if it can't.
+ */
+//! <!-- [H5FD_ctl_mapped_view_args_t_snip] -->
+typedef struct H5FD_ctl_mapped_view_args_t {
+    haddr_t addr; /**< Address of the data in the file */
+    size_t  size; /**< Size of the data in bytes */
+} H5FD_ctl_mapped_view_args_t;
+//! <!-- [H5FD_ctl_mapped_view_args_t_snip] -->
+
 /********************/
 /* Public Variables */
 /********************/
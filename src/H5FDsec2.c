@@ -107,6 +107,12 @@ static herr_t  H5FD__sec2_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, ha
                                void *buf);
 static herr_t  H5FD__sec2_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                 const void *buf);
+#ifdef H5_HAVE_PREADWRITEV
+static herr_t H5FD__sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                     haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t H5FD__sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                      haddr_t addrs[], size_t sizes[], const void *bufs[]);
+#endif /* H5_HAVE_PREADWRITEV */
 static herr_t  H5FD__sec2_truncate(H5FD_t *_file, hid_t dxpl_id, bool closing);
 static herr_t  H5FD__sec2_lock(H5FD_t *_file, bool rw);
 static herr_t  H5FD__sec2_unlock(H5FD_t *_file);
@@ -144,8 +150,13 @@ static const H5FD_class_t H5FD_sec2_g = {
     H5FD__sec2_get_handle, /* get_handle           */
     H5FD__sec2_read,       /* read                 */
     H5FD__sec2_write,      /* write                */
+#ifdef H5_HAVE_PREADWRITEV
+    H5FD__sec2_read_vector,  /* read_vector          */
+    H5FD__sec2_write_vector, /* write_vector         */
+#else
     NULL,                  /* read_vector          */
     NULL,                  /* write_vector         */
+#endif /* H5_HAVE_PREADWRITEV */
     NULL,                  /* read_selection       */
     NULL,                  /* write_selection      */
     NULL,                  /* flush                */
@@ -482,6 +493,12 @@ H5FD__sec2_query(const H5FD_t *_file, unsigned long *flags /* out */)
             H5FD_FEAT_SUPPORTS_SWMR_IO; /* VFD supports the single-writer/multiple-readers (SWMR) pattern   */
         *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
                                                        VFD      */
+#ifdef H5_HAVE_PREADWRITEV
+        *flags |= H5FD_FEAT_SELECTION_IO_OPT_IN; /* Vector callbacks don't enable selection I/O by default */
+#endif
+#ifdef H5_HAVE_PREADWRITE
+        *flags |= H5FD_FEAT_CONCURRENT_READ; /* Reads use pread() and don't update the file position */
+#endif
 
         /* Check for flags that are set by h5repart */
         if (file && file->fam_to_single)
@@ -803,6 +820,73 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__sec2_write() */
 
+#ifdef H5_HAVE_PREADWRITEV
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_read_vector
+ *
+ * Purpose:     Reads the COUNT elements of a vector request, merging
+ *              elements with adjacent file addresses into a single
+ *              preadv() call.
+ *
+ * Return:      Success:    SUCCEED. Results are stored in the buffers
+ *                          in BUFS.
+ *              Failure:    FAIL, contents of the buffers are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                       size_t sizes[], void *bufs[] /* out */)
+{
+    H5FD_sec2_t *file      = (H5FD_sec2_t *)_file;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+
+    if (H5FD__iov_vector_io(_file, file->fd, false, dxpl_id, count, types, addrs, sizes, bufs, 0, 0, NULL) <
+        0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_write_vector
+ *
+ * Purpose:     Writes the COUNT elements of a vector request, merging
+ *              elements with adjacent file addresses into a single
+ *              pwritev() call.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                        size_t sizes[], const void *bufs[] /* in */)
+{
+    H5FD_sec2_t *file      = (H5FD_sec2_t *)_file;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+
+    /* The buffers are only read from on the write path */
+    H5_WARN_CAST_AWAY_CONST_OFF
+    if (H5FD__iov_vector_io(_file, file->fd, true, dxpl_id, count, types, addrs, sizes, (void **)bufs, 0, 0,
+                            &file->eof) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write failed");
+    H5_WARN_CAST_AWAY_CONST_ON
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_write_vector() */
+#endif /* H5_HAVE_PREADWRITEV */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__sec2_truncate
  *
@@ -48,6 +48,75 @@ static size_t H5FL_fac_glb_mem_lim = 16 * 1024 * 1024; /* Default to 16MB limit
 static size_t H5FL_fac_lst_mem_lim =
     1024 * 1024; /* Default to 1024KB (1MB) limit on each factory free list */
 
+#ifdef H5_HAVE_THREADSAFE_API
+/*
+    Per-thread caches for the regular, block and factory free lists.  Each
+    thread keeps a small direct-mapped table of "magazines" in front of the
+    global free lists, each holding up to H5FL_TCACHE_MAG_SIZE free objects
+    for one list, so that most allocations and releases don't need to take
+    the global free list lock.  Objects move between a magazine and its
+    global list in batches of H5FL_TCACHE_BATCH.  Objects released by a
+    thread go into that thread's magazines, so objects allocated in one
+    thread and freed in another return to the global lists when the freeing
+    thread's magazine overflows.  Only small blocks are cached per-thread.
+ */
+#define H5FL_TCACHE_NMAGS    64                       /* Number of magazines per thread */
+#define H5FL_TCACHE_MAG_SIZE 32                       /* Max. # of objects in a magazine */
+#define H5FL_TCACHE_BATCH    (H5FL_TCACHE_MAG_SIZE / 2) /* # of objects moved to/from a list at once */
+#define H5FL_TCACHE_BLK_MAX  4096                     /* Largest block size cached per-thread */
+
+/* Choose the magazine for a free list (and block size, for block lists) */
+#define H5FL_TCACHE_MAG(c, h, s)                                                                             \
+    (&(c)->mags[((((uintptr_t)(h)) >> 4) ^ ((uintptr_t)(h) >> 12) ^ (s)) % H5FL_TCACHE_NMAGS])
+
+/* The kinds of free lists that are cached per-thread */
+typedef enum H5FL_tcache_kind_t {
+    H5FL_TCACHE_REG, /* Regular free list */
+    H5FL_TCACHE_BLK, /* Block free list */
+    H5FL_TCACHE_FAC  /* Factory free list */
+} H5FL_tcache_kind_t;
+
+/* A magazine of free objects for a single free list */
+typedef struct H5FL_tcache_mag_t {
+    H5FL_tcache_kind_t kind;                       /* Kind of free list */
+    void              *head;                       /* Head of the list the objects belong to (NULL if unused) */
+    size_t             size;                       /* Size of the blocks, for block lists */
+    unsigned           nobjs;                      /* Number of objects in the magazine */
+    void              *objs[H5FL_TCACHE_MAG_SIZE]; /* Free objects (block info headers, for block lists) */
+} H5FL_tcache_mag_t;
+
+/* Statistics for a thread's cache */
+typedef struct H5FL_tcache_stats_t {
+    uint64_t hits;   /* # of allocations taken from a magazine */
+    uint64_t misses; /* # of allocations that had to take the free list lock */
+    uint64_t spills; /* # of times a full magazine moved objects to its free list */
+} H5FL_tcache_stats_t;
+
+/* A thread's cache of free list magazines */
+struct H5FL_tcache_t {
+    H5TS_mutex_t          lock;                     /* Protects the magazines from purges by other threads */
+    struct H5FL_tcache_t *prev;                     /* Previous cache in list of all threads' caches */
+    struct H5FL_tcache_t *next;                     /* Next cache in list of all threads' caches */
+    H5FL_tcache_stats_t   stats;                    /* Statistics (protected by the cache's lock) */
+    H5FL_tcache_mag_t     mags[H5FL_TCACHE_NMAGS]; /* Magazines */
+};
+
+/* Lock protecting the global free lists, the garbage collection lists and
+ * the list of threads' caches.  It is recursive, since allocating from a
+ * free list can release objects to other free lists, and it is never
+ * destroyed, since threads may release their caches after the library has
+ * been shut down.
+ */
+static H5TS_once_t  H5FL_lock_once_s = H5TS_ONCE_INITIALIZER;
+static H5TS_mutex_t H5FL_lock_s;
+
+/* List of all threads' caches */
+static struct H5FL_tcache_t *H5FL_tcache_head_s = NULL;
+
+/* Statistics of the caches of threads that have exited */
+static H5FL_tcache_stats_t H5FL_tcache_exited_s = {0, 0, 0};
+#endif /* H5_HAVE_THREADSAFE_API */
+
 /* A garbage collection node for regular free lists */
 typedef struct H5FL_reg_gc_node_t {
     H5FL_reg_head_t           *list; /* Pointer to the head of the list to garbage collect */
@@ -119,12 +188,18 @@ static H5FL_fac_gc_list_t H5FL_fac_gc_head = {0, NULL};
 /* Forward declarations of local static functions */
 static void            *H5FL__malloc(size_t mem_size);
 static herr_t           H5FL__reg_init(H5FL_reg_head_t *head);
+static void            *H5FL__reg_unlink(H5FL_reg_head_t *head);
+static void             H5FL__reg_link(H5FL_reg_head_t *head, void *obj);
+static herr_t           H5FL__reg_release(H5FL_reg_head_t *head, void *obj);
 static herr_t           H5FL__reg_gc(void);
 static herr_t           H5FL__reg_gc_list(H5FL_reg_head_t *head);
 static int              H5FL__reg_term(void);
 static H5FL_blk_node_t *H5FL__blk_find_list(H5FL_blk_node_t **head, size_t size);
 static H5FL_blk_node_t *H5FL__blk_create_list(H5FL_blk_node_t **head, size_t size);
 static herr_t           H5FL__blk_init(H5FL_blk_head_t *head);
+static H5FL_blk_list_t *H5FL__blk_unlink(H5FL_blk_head_t *head, size_t size);
+static herr_t           H5FL__blk_link(H5FL_blk_head_t *head, H5FL_blk_list_t *block, size_t size);
+static herr_t           H5FL__blk_release(H5FL_blk_head_t *head, H5FL_blk_list_t *block, size_t size);
 static herr_t           H5FL__blk_gc_list(H5FL_blk_head_t *head);
 static herr_t           H5FL__blk_gc(void);
 static int              H5FL__blk_term(void);
@@ -132,9 +207,33 @@ static herr_t           H5FL__arr_init(H5FL_arr_head_t *head);
 static herr_t           H5FL__arr_gc_list(H5FL_arr_head_t *head);
 static herr_t           H5FL__arr_gc(void);
 static int              H5FL__arr_term(void);
+static void            *H5FL__fac_unlink(H5FL_fac_head_t *head);
+static void             H5FL__fac_link(H5FL_fac_head_t *head, void *obj);
+static herr_t           H5FL__fac_release(H5FL_fac_head_t *head, void *obj);
 static herr_t           H5FL__fac_gc_list(H5FL_fac_head_t *head);
 static herr_t           H5FL__fac_gc(void);
 static int              H5FL__fac_term_all(void);
+#ifdef H5_HAVE_THREADSAFE_API
+static herr_t                H5FL__lock(void);
+static herr_t                H5FL__unlock(void);
+static struct H5FL_tcache_t *H5FL__tcache_get(void);
+static void                 *H5FL__tcache_pop(H5FL_tcache_kind_t kind, void *head, size_t size);
+static void                 *H5FL__tcache_refill(H5FL_tcache_kind_t kind, void *head, size_t size);
+static bool   H5FL__tcache_push(H5FL_tcache_kind_t kind, void *head, size_t size, void *obj, void **spill,
+                                unsigned *nspill);
+static herr_t H5FL__tcache_purge(struct H5FL_tcache_t *cache, const void *head);
+static herr_t H5FL__tcache_purge_all(const void *head);
+static size_t H5FL__tcache_size(struct H5FL_tcache_t *cache);
+#else /* H5_HAVE_THREADSAFE_API */
+/* Without threads, the free lists need no locking and have no per-thread caches */
+#define H5FL_TCACHE_BATCH                                 0
+#define H5FL__lock()                                      SUCCEED
+#define H5FL__unlock()                                    SUCCEED
+#define H5FL__tcache_pop(kind, head, size)                NULL
+#define H5FL__tcache_refill(kind, head, size)             NULL
+#define H5FL__tcache_push(kind, head, size, obj, sp, nsp) false
+#define H5FL__tcache_purge_all(head)                      SUCCEED
+#endif /* H5_HAVE_THREADSAFE_API */
 
 /* Declare a free list to manage the H5FL_blk_node_t struct */
 H5FL_DEFINE(H5FL_blk_node_t);
@@ -172,14 +271,16 @@ H5FL_term_package(void)
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
     if (H5_PKG_INIT_VAR) {
-        /* Garbage collect any nodes on the free lists */
+        /* Garbage collect any nodes on the free lists (and in per-thread caches) */
         (void)H5FL_garbage_coll();
 
         /* Shut down the various kinds of free lists */
+        (void)H5FL__lock();
         n += H5FL__reg_term();
         n += H5FL__fac_term_all();
         n += H5FL__arr_term();
         n += H5FL__blk_term();
+        (void)H5FL__unlock();
 
         /* Mark interface closed */
         if (0 == n)
@@ -264,33 +365,55 @@ done:
 } /* end H5FL__reg_init() */
 
 /*-------------------------------------------------------------------------
- * Function:	H5FL_reg_free
+ * Function:	H5FL__reg_unlink
  *
- * Purpose:	Release an object & put on free list
+ * Purpose:	Remove an object from a free list, without allocating a new
+ *      one if the list is empty.  The free list lock must be held.
  *
- * Return:	Always returns NULL
+ * Return:	Success:	Pointer to the object
+ * 		Failure:	NULL (no objects on the free list)
  *
  *-------------------------------------------------------------------------
  */
-void *
-H5FL_reg_free(H5FL_reg_head_t *head, void *obj)
+static void *
+H5FL__reg_unlink(H5FL_reg_head_t *head)
 {
-    void *ret_value = NULL; /* Return value */
+    void *ret_value = NULL; /* Pointer to object to return */
 
-    /* NOINIT OK here because this must be called after H5FL_reg_malloc/calloc
-     * -NAF */
-    FUNC_ENTER_NOAPI_NOINIT
+    FUNC_ENTER_PACKAGE_NOERR
 
-    /* Double check parameters */
-    assert(head);
-    assert(obj);
+    /* Check for nodes available on the free list */
+    if (head->list != NULL) {
+        /* Get a pointer to the block on the free list */
+        ret_value = (void *)(head->list);
 
-#ifdef H5FL_DEBUG
-    memset(obj, 255, head->size);
-#endif /* H5FL_DEBUG */
+        /* Remove node from free list */
+        head->list = head->list->next;
 
-    /* Make certain that the free list is initialized */
-    assert(head->init);
+        /* Decrement the number of blocks & memory on free list */
+        head->onlist--;
+
+        /* Decrement the amount of global "regular" free list memory in use */
+        H5FL_reg_gc_head.mem_freed -= (head->size);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__reg_unlink() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__reg_link
+ *
+ * Purpose:	Put an object on a free list, without checking the free list
+ *      memory limits.  The free list lock must be held.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FL__reg_link(H5FL_reg_head_t *head, void *obj)
+{
+    FUNC_ENTER_PACKAGE_NOERR
 
     /* Link into the free list */
     ((H5FL_reg_node_t *)obj)->next = head->list;
@@ -304,18 +427,98 @@ H5FL_reg_free(H5FL_reg_head_t *head, void *obj)
     /* Increment the amount of "regular" freed memory globally */
     H5FL_reg_gc_head.mem_freed += head->size;
 
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FL__reg_link() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__reg_release
+ *
+ * Purpose:	Put an object on a free list and garbage collect if the free
+ *      list memory limits are exceeded.  The free list lock must be held.
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__reg_release(H5FL_reg_head_t *head, void *obj)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Put the object on the free list */
+    H5FL__reg_link(head, obj);
+
     /* Check for exceeding free list memory use limits */
     /* First check this particular list */
     if (head->onlist * head->size > H5FL_reg_lst_mem_lim)
         if (H5FL__reg_gc_list(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection failed during free");
 
     /* Then check the global amount memory on regular free lists */
     if (H5FL_reg_gc_head.mem_freed > H5FL_reg_glb_mem_lim)
         if (H5FL__reg_gc() < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection failed during free");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__reg_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_reg_free
+ *
+ * Purpose:	Release an object & put on free list
+ *
+ * Return:	Always returns NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5FL_reg_free(H5FL_reg_head_t *head, void *obj)
+{
+    void    *objs[H5FL_TCACHE_BATCH + 1]; /* Objects to put on the free list */
+    unsigned nobjs     = 0;               /* Number of objects to put on the free list */
+    bool     locked    = false;           /* Whether the free list lock is held */
+    unsigned u;                           /* Local index variable */
+    void    *ret_value = NULL;            /* Return value */
+
+    /* NOINIT OK here because this must be called after H5FL_reg_malloc/calloc
+     * -NAF */
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Double check parameters */
+    assert(head);
+    assert(obj);
+
+#ifdef H5FL_DEBUG
+    memset(obj, 255, head->size);
+#endif /* H5FL_DEBUG */
+
+    /* Make certain that the free list is initialized */
+    assert(head->init);
+
+    /* Try to keep the object in this thread's cache, which may push older
+     * objects out to the free list */
+    if (!H5FL__tcache_push(H5FL_TCACHE_REG, head, 0, obj, objs, &nobjs))
+        objs[nobjs++] = obj;
+
+    /* Put any objects not cached on the free list */
+    if (nobjs > 0) {
+        if (H5FL__lock() < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTLOCK, NULL, "unable to lock free lists");
+        locked = true;
+
+        for (u = 0; u < nobjs; u++)
+            if (H5FL__reg_release(head, objs[u]) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, NULL, "unable to release object to free list");
+    } /* end if */
 
 done:
+    if (locked && H5FL__unlock() < 0)
+        HDONE_ERROR(H5E_RESOURCE, H5E_CANTUNLOCK, NULL, "unable to unlock free lists");
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_reg_free() */
 
@@ -332,42 +535,42 @@ done:
 void *
 H5FL_reg_malloc(H5FL_reg_head_t *head)
 {
-    void *ret_value = NULL; /* Pointer to object to return */
+    bool  locked    = false; /* Whether the free list lock is held */
+    void *ret_value = NULL;  /* Pointer to object to return */
 
     FUNC_ENTER_NOAPI(NULL)
 
     /* Double check parameters */
     assert(head);
 
+    /* Check this thread's cache for the list first */
+    if (NULL != (ret_value = H5FL__tcache_pop(H5FL_TCACHE_REG, head, 0)))
+        HGOTO_DONE(ret_value);
+
+    if (H5FL__lock() < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTLOCK, NULL, "unable to lock free lists");
+    locked = true;
+
     /* Make certain the list is initialized first */
     if (!head->init)
         if (H5FL__reg_init(head) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'regular' blocks");
 
-    /* Check for nodes available on the free list first */
-    if (head->list != NULL) {
-        /* Get a pointer to the block on the free list */
-        ret_value = (void *)(head->list);
-
-        /* Remove node from free list */
-        head->list = head->list->next;
-
-        /* Decrement the number of blocks & memory on free list */
-        head->onlist--;
-
-        /* Decrement the amount of global "regular" free list memory in use */
-        H5FL_reg_gc_head.mem_freed -= (head->size);
-    } /* end if */
-    /* Otherwise allocate a node */
-    else {
-        if (NULL == (ret_value = H5FL__malloc(head->size)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed");
+    /* Refill this thread's cache from the free list, or take a node from it directly */
+    if (NULL == (ret_value = H5FL__tcache_refill(H5FL_TCACHE_REG, head, 0)))
+        if (NULL == (ret_value = H5FL__reg_unlink(head))) {
+            /* Otherwise allocate a node */
+            if (NULL == (ret_value = H5FL__malloc(head->size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed");
 
-        /* Increment the number of blocks allocated in list */
-        head->allocated++;
-    } /* end else */
+            /* Increment the number of blocks allocated in list */
+            head->allocated++;
+        } /* end if */
 
 done:
+    if (locked && H5FL__unlock() < 0)
+        HDONE_ERROR(H5E_RESOURCE, H5E_CANTUNLOCK, NULL, "unable to unlock free lists");
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_reg_malloc() */
 
@@ -683,6 +886,126 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL__blk_init() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__blk_unlink
+ *
+ * Purpose:	Remove a block of a given size from a priority queue, without
+ *      allocating a new one if there are none free.  The free list lock
+ *      must be held.
+ *
+ * Return:	Success:	Pointer to the block's info header
+ *		Failure:	NULL (no blocks of that size available)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FL_blk_list_t *
+H5FL__blk_unlink(H5FL_blk_head_t *head, size_t size)
+{
+    H5FL_blk_node_t *free_list;        /* The free list of nodes of correct size */
+    H5FL_blk_list_t *ret_value = NULL; /* Pointer to the block to return */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* check if there is a free list for blocks of this size */
+    /* and if there are any blocks available on the list */
+    if (NULL != (free_list = H5FL__blk_find_list(&(head->head), size)) && NULL != free_list->list) {
+        /* Remove the first node from the free list */
+        ret_value       = free_list->list;
+        free_list->list = free_list->list->next;
+
+        /* Decrement the number of blocks & memory used on free list */
+        free_list->onlist--;
+        head->onlist--;
+        head->list_mem -= size;
+
+        /* Decrement the amount of global "block" free list memory in use */
+        H5FL_blk_gc_head.mem_freed -= size;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__blk_unlink() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__blk_link
+ *
+ * Purpose:	Put a block on the free list for its size in a priority queue,
+ *      without checking the free list memory limits.  The free list lock
+ *      must be held.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__blk_link(H5FL_blk_head_t *head, H5FL_blk_list_t *block, size_t size)
+{
+    H5FL_blk_node_t *free_list;           /* The free list of nodes of correct size */
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check if there is a free list for native blocks of this size */
+    if (NULL == (free_list = H5FL__blk_find_list(&(head->head), size)))
+        /* No free list available, create a new list node and insert it to the queue */
+        free_list = H5FL__blk_create_list(&(head->head), size);
+    if (NULL == free_list)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't create new list node");
+
+    /* Prepend the free'd native block to the front of the free list */
+    block->next     = free_list->list; /* Note: Overwrites the size field in union */
+    free_list->list = block;
+
+    /* Increment the number of blocks on free list */
+    free_list->onlist++;
+    head->onlist++;
+    head->list_mem += size;
+
+    /* Increment the amount of "block" freed memory globally */
+    H5FL_blk_gc_head.mem_freed += size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__blk_link() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__blk_release
+ *
+ * Purpose:	Put a block on a priority queue and garbage collect if the
+ *      free list memory limits are exceeded.  The free list lock must be
+ *      held.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__blk_release(H5FL_blk_head_t *head, H5FL_blk_list_t *block, size_t size)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Put the block on the free list for its size */
+    if (H5FL__blk_link(head, block, size) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, FAIL, "unable to put block on free list");
+
+    /* Check for exceeding free list memory use limits */
+    /* First check this particular list */
+    if (head->list_mem > H5FL_blk_lst_mem_lim)
+        if (H5FL__blk_gc_list(head) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection failed during free");
+
+    /* Then check the global amount memory on block free lists */
+    if (H5FL_blk_gc_head.mem_freed > H5FL_blk_glb_mem_lim)
+        if (H5FL__blk_gc() < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection failed during free");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__blk_release() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5FL_blk_free_block_avail
  *
@@ -705,6 +1028,9 @@ H5FL_blk_free_block_avail(H5FL_blk_head_t *head, size_t size)
     /* Double check parameters */
     assert(head);
 
+    if (H5FL__lock() < 0)
+        HGOTO_DONE(FAIL);
+
     /* check if there is a free list for blocks of this size */
     /* and if there are any blocks available on the list */
     if ((free_list = H5FL__blk_find_list(&(head->head), size)) != NULL && free_list->list != NULL)
@@ -712,6 +1038,10 @@ H5FL_blk_free_block_avail(H5FL_blk_head_t *head, size_t size)
     else
         ret_value = false;
 
+    if (H5FL__unlock() < 0)
+        HGOTO_DONE(FAIL);
+
+done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_blk_free_block_avail() */
 
@@ -733,7 +1063,8 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size)
 {
     H5FL_blk_node_t *free_list;        /* The free list of nodes of correct size */
     H5FL_blk_list_t *temp;             /* Temp. ptr to the new native list allocated */
-    void            *ret_value = NULL; /* Pointer to the block to return to the user */
+    bool             locked    = false; /* Whether the free list lock is held */
+    void            *ret_value = NULL;  /* Pointer to the block to return to the user */
 
     FUNC_ENTER_NOAPI(NULL)
 
@@ -741,44 +1072,42 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size)
     assert(head);
     assert(size);
 
-    /* Make certain the list is initialized first */
-    if (!head->init)
-        if (H5FL__blk_init(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'block' list");
-
-    /* check if there is a free list for blocks of this size */
-    /* and if there are any blocks available on the list */
-    if (NULL != (free_list = H5FL__blk_find_list(&(head->head), size)) && NULL != free_list->list) {
-        /* Remove the first node from the free list */
-        temp            = free_list->list;
-        free_list->list = free_list->list->next;
-
-        /* Decrement the number of blocks & memory used on free list */
-        free_list->onlist--;
-        head->onlist--;
-        head->list_mem -= size;
-
-        /* Decrement the amount of global "block" free list memory in use */
-        H5FL_blk_gc_head.mem_freed -= size;
-    } /* end if */
-    /* No free list available, or there are no nodes on the list, allocate a new node to give to the user */
-    else {
-        /* Check if there was no free list for native blocks of this size */
-        if (NULL == free_list)
-            /* Create a new list node and insert it to the queue */
-            free_list = H5FL__blk_create_list(&(head->head), size);
-        assert(free_list);
-
-        /* Allocate new node, with room for the page info header and the actual page data */
-        if (NULL == (temp = (H5FL_blk_list_t *)H5FL__malloc(sizeof(H5FL_blk_list_t) + size)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for chunk");
-
-        /* Increment the number of blocks of this size */
-        free_list->allocated++;
-
-        /* Increment the total number of blocks allocated */
-        head->allocated++;
-    } /* end else */
+    /* Check this thread's cache for blocks of this size first */
+    if (NULL == (temp = (H5FL_blk_list_t *)H5FL__tcache_pop(H5FL_TCACHE_BLK, head, size))) {
+        if (H5FL__lock() < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTLOCK, NULL, "unable to lock free lists");
+        locked = true;
+
+        /* Make certain the list is initialized first */
+        if (!head->init)
+            if (H5FL__blk_init(head) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'block' list");
+
+        /* Refill this thread's cache from the free list, or take a block from it directly */
+        if (NULL == (temp = (H5FL_blk_list_t *)H5FL__tcache_refill(H5FL_TCACHE_BLK, head, size)))
+            temp = H5FL__blk_unlink(head, size);
+
+        /* No free list available, or there are no nodes on the list, allocate a new node to give to the
+         * user */
+        if (NULL == temp) {
+            /* Check if there was no free list for native blocks of this size */
+            if (NULL == (free_list = H5FL__blk_find_list(&(head->head), size)))
+                /* Create a new list node and insert it to the queue */
+                free_list = H5FL__blk_create_list(&(head->head), size);
+            if (NULL == free_list)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "couldn't create new list node");
+
+            /* Allocate new node, with room for the page info header and the actual page data */
+            if (NULL == (temp = (H5FL_blk_list_t *)H5FL__malloc(sizeof(H5FL_blk_list_t) + size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for chunk");
+
+            /* Increment the number of blocks of this size */
+            free_list->allocated++;
+
+            /* Increment the total number of blocks allocated */
+            head->allocated++;
+        } /* end if */
+    }     /* end if */
 
     /* Initialize the block allocated */
     temp->size = size;
@@ -787,6 +1116,9 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size)
     ret_value = ((char *)temp) + sizeof(H5FL_blk_list_t);
 
 done:
+    if (locked && H5FL__unlock() < 0)
+        HDONE_ERROR(H5E_RESOURCE, H5E_CANTUNLOCK, NULL, "unable to unlock free lists");
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_blk_malloc() */
 
@@ -842,10 +1174,13 @@ done:
 void *
 H5FL_blk_free(H5FL_blk_head_t *head, void *block)
 {
-    H5FL_blk_node_t *free_list;        /* The free list of nodes of correct size */
-    H5FL_blk_list_t *temp;             /* Temp. ptr to the new free list node allocated */
-    size_t           free_size;        /* Size of the block freed */
-    void            *ret_value = NULL; /* Return value */
+    H5FL_blk_list_t *temp;                         /* Temp. ptr to the new free list node allocated */
+    size_t           free_size;                    /* Size of the block freed */
+    void            *blocks[H5FL_TCACHE_BATCH + 1]; /* Blocks to put on the free list */
+    unsigned         nblocks   = 0;                /* Number of blocks to put on the free list */
+    bool             locked    = false;            /* Whether the free list lock is held */
+    unsigned         u;                            /* Local index variable */
+    void            *ret_value = NULL;             /* Return value */
 
     /* NOINIT OK here because this must be called after H5FL_blk_malloc/calloc
      * -NAF */
@@ -865,37 +1200,26 @@ H5FL_blk_free(H5FL_blk_head_t *head, void *block)
     memset(temp, 255, free_size + sizeof(H5FL_blk_list_t));
 #endif /* H5FL_DEBUG */
 
-    /* Check if there is a free list for native blocks of this size */
-    if (NULL == (free_list = H5FL__blk_find_list(&(head->head), free_size)))
-        /* No free list available, create a new list node and insert it to the queue */
-        free_list = H5FL__blk_create_list(&(head->head), free_size);
-    if (NULL == free_list)
-        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "couldn't create new list node");
-
-    /* Prepend the free'd native block to the front of the free list */
-    temp->next      = free_list->list; /* Note: Overwrites the size field in union */
-    free_list->list = temp;
+    /* Try to keep the block in this thread's cache, which may push older
+     * blocks of the same size out to the free list */
+    if (!H5FL__tcache_push(H5FL_TCACHE_BLK, head, free_size, temp, blocks, &nblocks))
+        blocks[nblocks++] = temp;
 
-    /* Increment the number of blocks on free list */
-    free_list->onlist++;
-    head->onlist++;
-    head->list_mem += free_size;
+    /* Put any blocks not cached on the free list */
+    if (nblocks > 0) {
+        if (H5FL__lock() < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTLOCK, NULL, "unable to lock free lists");
+        locked = true;
 
-    /* Increment the amount of "block" freed memory globally */
-    H5FL_blk_gc_head.mem_freed += free_size;
+        for (u = 0; u < nblocks; u++)
+            if (H5FL__blk_release(head, (H5FL_blk_list_t *)blocks[u], free_size) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, NULL, "unable to release block to free list");
+    } /* end if */
 
-    /* Check for exceeding free list memory use limits */
-    /* First check this particular list */
-    if (head->list_mem > H5FL_blk_lst_mem_lim)
-        if (H5FL__blk_gc_list(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
+done:
+    if (locked && H5FL__unlock() < 0)
+        HDONE_ERROR(H5E_RESOURCE, H5E_CANTUNLOCK, NULL, "unable to unlock free lists");
 
-    /* Then check the global amount memory on block free lists */
-    if (H5FL_blk_gc_head.mem_freed > H5FL_blk_glb_mem_lim)
-        if (H5FL__blk_gc() < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
-
-done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_blk_free() */
 
@@ -1195,8 +1519,9 @@ H5FL_arr_free(H5FL_arr_head_t *head, void *obj)
 {
     H5FL_arr_list_t *temp;             /* Temp. ptr to the new free list node allocated */
     size_t           mem_size;         /* Size of memory being freed */
-    size_t           free_nelem;       /* Number of elements in node being free'd */
-    void            *ret_value = NULL; /* Return value */
+    size_t           free_nelem;        /* Number of elements in node being free'd */
+    bool             locked    = false; /* Whether the free list lock is held */
+    void            *ret_value = NULL;  /* Return value */
 
     /* NOINIT OK here because this must be called after H5FL_arr_malloc/calloc
      * -NAF */
@@ -1221,6 +1546,11 @@ H5FL_arr_free(H5FL_arr_head_t *head, void *obj)
     /* Double-check that there is enough room for arrays of this size */
     assert((int)free_nelem <= head->maxelem);
 
+    /* Array free lists have no per-thread caches */
+    if (H5FL__lock() < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTLOCK, NULL, "unable to lock free lists");
+    locked = true;
+
     /* Link into the free list */
     temp->next = head->list_arr[free_nelem].list;
 
@@ -1249,6 +1579,9 @@ H5FL_arr_free(H5FL_arr_head_t *head, void *obj)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
 
 done:
+    if (locked && H5FL__unlock() < 0)
+        HDONE_ERROR(H5E_RESOURCE, H5E_CANTUNLOCK, NULL, "unable to unlock free lists");
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_arr_free() */
 
@@ -1265,9 +1598,10 @@ done:
 void *
 H5FL_arr_malloc(H5FL_arr_head_t *head, size_t elem)
 {
-    H5FL_arr_list_t *new_obj;          /* Pointer to the new free list node allocated */
-    size_t           mem_size;         /* Size of memory block being recycled */
-    void            *ret_value = NULL; /* Pointer to the block to return */
+    H5FL_arr_list_t *new_obj;           /* Pointer to the new free list node allocated */
+    size_t           mem_size;          /* Size of memory block being recycled */
+    bool             locked    = false; /* Whether the free list lock is held */
+    void            *ret_value = NULL;  /* Pointer to the block to return */
 
     FUNC_ENTER_NOAPI(NULL)
 
@@ -1275,6 +1609,11 @@ H5FL_arr_malloc(H5FL_arr_head_t *head, size_t elem)
     assert(head);
     assert(elem);
 
+    /* Array free lists have no per-thread caches */
+    if (H5FL__lock() < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTLOCK, NULL, "unable to lock free lists");
+    locked = true;
+
     /* Make certain the list is initialized first */
     if (!head->init)
         if (H5FL__arr_init(head) < 0)
@@ -1321,6 +1660,9 @@ H5FL_arr_malloc(H5FL_arr_head_t *head, size_t elem)
     ret_value = ((char *)new_obj) + sizeof(H5FL_arr_list_t);
 
 done:
+    if (locked && H5FL__unlock() < 0)
+        HDONE_ERROR(H5E_RESOURCE, H5E_CANTUNLOCK, NULL, "unable to unlock free lists");
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_arr_malloc() */
 
@@ -1717,11 +2059,15 @@ H5FL_fac_init(size_t size)
     new_node->list = factory;
 
     /* Link in to the garbage collection list */
+    if (H5FL__lock() < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTLOCK, NULL, "unable to lock free lists");
     new_node->next         = H5FL_fac_gc_head.first;
     H5FL_fac_gc_head.first = new_node;
     if (new_node->next)
         new_node->next->list->prev_gc = new_node;
     /* The new factory's prev_gc field will be set to NULL */
+    if (H5FL__unlock() < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTUNLOCK, NULL, "unable to unlock free lists");
 
     /* Make certain that the space allocated is large enough to store a free list pointer (eventually) */
     if (factory->size < sizeof(H5FL_fac_node_t))
@@ -1745,32 +2091,55 @@ done:
 } /* end H5FL_fac_init() */
 
 /*-------------------------------------------------------------------------
- * Function:	H5FL_fac_free
+ * Function:	H5FL__fac_unlink
  *
- * Purpose:	Release a block back to a factory & put on free list
+ * Purpose:	Remove a block from a factory's free list, without allocating
+ *      a new one if the list is empty.  The free list lock must be held.
  *
- * Return:	NULL
+ * Return:	Success:	Pointer to the block
+ * 		Failure:	NULL (no blocks on the free list)
  *
  *-------------------------------------------------------------------------
  */
-void *
-H5FL_fac_free(H5FL_fac_head_t *head, void *obj)
+static void *
+H5FL__fac_unlink(H5FL_fac_head_t *head)
 {
-    void *ret_value = NULL; /* Return value */
+    void *ret_value = NULL; /* Pointer to the block to return */
 
-    /* NOINIT OK here because this must be called after H5FL_fac_init -NAF */
-    FUNC_ENTER_NOAPI_NOINIT
+    FUNC_ENTER_PACKAGE_NOERR
 
-    /* Double check parameters */
-    assert(head);
-    assert(obj);
+    /* Check for nodes available on the free list */
+    if (head->list != NULL) {
+        /* Get a pointer to the block on the free list */
+        ret_value = (void *)(head->list);
 
-#ifdef H5FL_DEBUG
-    memset(obj, 255, head->size);
-#endif /* H5FL_DEBUG */
+        /* Remove node from free list */
+        head->list = head->list->next;
 
-    /* Make certain that the free list is initialized */
-    assert(head->init);
+        /* Decrement the number of blocks & memory on free list */
+        head->onlist--;
+
+        /* Decrement the amount of global "factory" free list memory in use */
+        H5FL_fac_gc_head.mem_freed -= (head->size);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__fac_unlink() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__fac_link
+ *
+ * Purpose:	Put a block on a factory's free list, without checking the
+ *      free list memory limits.  The free list lock must be held.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FL__fac_link(H5FL_fac_head_t *head, void *obj)
+{
+    FUNC_ENTER_PACKAGE_NOERR
 
     /* Link into the free list */
     ((H5FL_fac_node_t *)obj)->next = head->list;
@@ -1784,18 +2153,98 @@ H5FL_fac_free(H5FL_fac_head_t *head, void *obj)
     /* Increment the amount of "factory" freed memory globally */
     H5FL_fac_gc_head.mem_freed += head->size;
 
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FL__fac_link() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__fac_release
+ *
+ * Purpose:	Put a block on a factory's free list and garbage collect if
+ *      the free list memory limits are exceeded.  The free list lock must
+ *      be held.
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__fac_release(H5FL_fac_head_t *head, void *obj)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Put the block on the free list */
+    H5FL__fac_link(head, obj);
+
     /* Check for exceeding free list memory use limits */
     /* First check this particular list */
     if (head->onlist * head->size > H5FL_fac_lst_mem_lim)
         if (H5FL__fac_gc_list(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection failed during free");
 
     /* Then check the global amount memory on factory free lists */
     if (H5FL_fac_gc_head.mem_freed > H5FL_fac_glb_mem_lim)
         if (H5FL__fac_gc() < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection failed during free");
 
 done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__fac_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_fac_free
+ *
+ * Purpose:	Release a block back to a factory & put on free list
+ *
+ * Return:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5FL_fac_free(H5FL_fac_head_t *head, void *obj)
+{
+    void    *objs[H5FL_TCACHE_BATCH + 1]; /* Blocks to put on the free list */
+    unsigned nobjs     = 0;               /* Number of blocks to put on the free list */
+    bool     locked    = false;           /* Whether the free list lock is held */
+    unsigned u;                           /* Local index variable */
+    void    *ret_value = NULL;            /* Return value */
+
+    /* NOINIT OK here because this must be called after H5FL_fac_init -NAF */
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Double check parameters */
+    assert(head);
+    assert(obj);
+
+#ifdef H5FL_DEBUG
+    memset(obj, 255, head->size);
+#endif /* H5FL_DEBUG */
+
+    /* Make certain that the free list is initialized */
+    assert(head->init);
+
+    /* Try to keep the block in this thread's cache, which may push older
+     * blocks out to the free list */
+    if (!H5FL__tcache_push(H5FL_TCACHE_FAC, head, 0, obj, objs, &nobjs))
+        objs[nobjs++] = obj;
+
+    /* Put any blocks not cached on the free list */
+    if (nobjs > 0) {
+        if (H5FL__lock() < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTLOCK, NULL, "unable to lock free lists");
+        locked = true;
+
+        for (u = 0; u < nobjs; u++)
+            if (H5FL__fac_release(head, objs[u]) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, NULL, "unable to release block to free list");
+    } /* end if */
+
+done:
+    if (locked && H5FL__unlock() < 0)
+        HDONE_ERROR(H5E_RESOURCE, H5E_CANTUNLOCK, NULL, "unable to unlock free lists");
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_fac_free() */
 
@@ -1812,7 +2261,8 @@ done:
 void *
 H5FL_fac_malloc(H5FL_fac_head_t *head)
 {
-    void *ret_value = NULL; /* Pointer to the block to return */
+    bool  locked    = false; /* Whether the free list lock is held */
+    void *ret_value = NULL;  /* Pointer to the block to return */
 
     /* NOINIT OK here because this must be called after H5FL_fac_init -NAF */
     FUNC_ENTER_NOAPI_NOINIT
@@ -1821,30 +2271,29 @@ H5FL_fac_malloc(H5FL_fac_head_t *head)
     assert(head);
     assert(head->init);
 
-    /* Check for nodes available on the free list first */
-    if (head->list != NULL) {
-        /* Get a pointer to the block on the free list */
-        ret_value = (void *)(head->list);
+    /* Check this thread's cache for the factory first */
+    if (NULL != (ret_value = H5FL__tcache_pop(H5FL_TCACHE_FAC, head, 0)))
+        HGOTO_DONE(ret_value);
 
-        /* Remove node from free list */
-        head->list = head->list->next;
+    if (H5FL__lock() < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTLOCK, NULL, "unable to lock free lists");
+    locked = true;
 
-        /* Decrement the number of blocks & memory on free list */
-        head->onlist--;
+    /* Refill this thread's cache from the free list, or take a block from it directly */
+    if (NULL == (ret_value = H5FL__tcache_refill(H5FL_TCACHE_FAC, head, 0)))
+        if (NULL == (ret_value = H5FL__fac_unlink(head))) {
+            /* Otherwise allocate a node */
+            if (NULL == (ret_value = H5FL__malloc(head->size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed");
 
-        /* Decrement the amount of global "factory" free list memory in use */
-        H5FL_fac_gc_head.mem_freed -= (head->size);
-    } /* end if */
-    /* Otherwise allocate a node */
-    else {
-        if (NULL == (ret_value = H5FL__malloc(head->size)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed");
-
-        /* Increment the number of blocks allocated in list */
-        head->allocated++;
-    } /* end else */
+            /* Increment the number of blocks allocated in list */
+            head->allocated++;
+        } /* end if */
 
 done:
+    if (locked && H5FL__unlock() < 0)
+        HDONE_ERROR(H5E_RESOURCE, H5E_CANTUNLOCK, NULL, "unable to unlock free lists");
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_fac_malloc() */
 
@@ -1975,6 +2424,7 @@ herr_t
 H5FL_fac_term(H5FL_fac_head_t *factory)
 {
     H5FL_fac_gc_node_t *tmp;                 /* Temporary pointer to a garbage collection node */
+    bool                locked    = false;   /* Whether the free list lock is held */
     herr_t              ret_value = SUCCEED; /* Return value */
 
     /* NOINIT OK here because this must be called after H5FL_fac_init -NAF */
@@ -1983,6 +2433,14 @@ H5FL_fac_term(H5FL_fac_head_t *factory)
     /* Sanity check */
     assert(factory);
 
+    if (H5FL__lock() < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTLOCK, FAIL, "unable to lock free lists");
+    locked = true;
+
+    /* Return the factory's blocks in all threads' caches to its free list */
+    if (H5FL__tcache_purge_all(factory) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, FAIL, "unable to purge thread caches");
+
     /* Garbage collect all the blocks in the factory's free list */
     if (H5FL__fac_gc_list(factory) < 0)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection of factory failed");
@@ -2016,6 +2474,9 @@ H5FL_fac_term(H5FL_fac_head_t *factory)
     factory = H5FL_FREE(H5FL_fac_head_t, factory);
 
 done:
+    if (locked && H5FL__unlock() < 0)
+        HDONE_ERROR(H5E_RESOURCE, H5E_CANTUNLOCK, FAIL, "unable to unlock free lists");
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_fac_term() */
 
@@ -2073,10 +2534,19 @@ H5FL__fac_term_all(void)
 herr_t
 H5FL_garbage_coll(void)
 {
+    bool   locked    = false; /* Whether the free list lock is held */
     herr_t ret_value = SUCCEED;
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    if (H5FL__lock() < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTLOCK, FAIL, "unable to lock free lists");
+    locked = true;
+
+    /* Return the objects in all threads' caches to the free lists */
+    if (H5FL__tcache_purge_all(NULL) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, FAIL, "unable to purge thread caches");
+
     /* Garbage collect the free lists for array objects */
     if (H5FL__arr_gc() < 0)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "can't garbage collect array objects");
@@ -2094,6 +2564,9 @@ H5FL_garbage_coll(void)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "can't garbage collect factory objects");
 
 done:
+    if (locked && H5FL__unlock() < 0)
+        HDONE_ERROR(H5E_RESOURCE, H5E_CANTUNLOCK, FAIL, "unable to unlock free lists");
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_garbage_coll() */
 
@@ -2129,6 +2602,9 @@ H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim, int arr_global_l
 
     FUNC_ENTER_NOAPI_NOERR
 
+    if (H5FL__lock() < 0)
+        HGOTO_DONE(FAIL);
+
     /* Set the limit variables */
     /* limit on all regular free lists */
     H5FL_reg_glb_mem_lim = (reg_global_lim == -1 ? UINT_MAX : (size_t)reg_global_lim);
@@ -2147,6 +2623,10 @@ H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim, int arr_global_l
     /* limit on each factory free list */
     H5FL_fac_lst_mem_lim = (fac_list_lim == -1 ? UINT_MAX : (size_t)fac_list_lim);
 
+    if (H5FL__unlock() < 0)
+        HGOTO_DONE(FAIL);
+
+done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_set_free_list_limits() */
 
@@ -2172,8 +2652,15 @@ H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim, int arr_global_l
 herr_t
 H5FL_get_free_list_sizes(size_t *reg_size, size_t *arr_size, size_t *blk_size, size_t *fac_size)
 {
+    herr_t ret_value = SUCCEED; /* Return value */
+
     FUNC_ENTER_NOAPI_NOERR
 
+    /* Objects in threads' caches are still counted as allocated from their
+     * lists, so the sizes below include them */
+    if (H5FL__lock() < 0)
+        HGOTO_DONE(FAIL);
+
     /* Retrieve the amount of "regular" memory used */
     if (reg_size) {
         H5FL_reg_gc_node_t *gc_node; /* Pointer into the list of lists */
@@ -2266,5 +2753,572 @@ H5FL_get_free_list_sizes(size_t *reg_size, size_t *arr_size, size_t *blk_size, s
         } /* end while */
     }     /* end if */
 
-    FUNC_LEAVE_NOAPI(SUCCEED)
+    if (H5FL__unlock() < 0)
+        HGOTO_DONE(FAIL);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_get_free_list_sizes() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_get_free_list_cache_stats
+ *
+ * Purpose:	Gets statistics for the per-thread caches in front of the
+ *      free lists.  The counts are totals for all threads, including
+ *      threads that have exited, while the cached size is only for the
+ *      calling thread.  Without the threadsafe API there are no per-thread
+ *      caches and all of them are zero.
+ *
+ * Parameters:
+ *  uint64_t *hits;      OUT: # of allocations taken from a thread's cache
+ *  uint64_t *misses;    OUT: # of allocations that went to the shared free lists
+ *  uint64_t *spills;    OUT: # of times a full cache returned objects to the shared free lists
+ *  size_t *thread_size; OUT: The size of the free objects in the calling thread's cache
+ *
+ * Return:	Success:	non-negative
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FL_get_free_list_cache_stats(uint64_t *hits, uint64_t *misses, uint64_t *spills, size_t *thread_size)
+{
+#ifdef H5_HAVE_THREADSAFE_API
+    struct H5FL_tcache_t **cache_ptr;      /* Location of this thread's cache pointer */
+    struct H5FL_tcache_t  *cache;          /* Thread's cache */
+    H5FL_tcache_stats_t    stats;          /* Statistics for all threads */
+    size_t                 size   = 0;     /* Size of this thread's cache */
+    bool                   locked = false; /* Whether the free list lock is held */
+#endif /* H5_HAVE_THREADSAFE_API */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOERR
+
+#ifdef H5_HAVE_THREADSAFE_API
+    if (H5FL__lock() < 0)
+        HGOTO_DONE(FAIL);
+    locked = true;
+
+    /* Add up the statistics of all threads' caches */
+    stats = H5FL_tcache_exited_s;
+    for (cache = H5FL_tcache_head_s; cache; cache = cache->next) {
+        if (H5TS_mutex_lock(&cache->lock) < 0)
+            HGOTO_DONE(FAIL);
+        stats.hits += cache->stats.hits;
+        stats.misses += cache->stats.misses;
+        stats.spills += cache->stats.spills;
+        if (H5TS_mutex_unlock(&cache->lock) < 0)
+            HGOTO_DONE(FAIL);
+    } /* end for */
+
+    /* Don't create a cache for this thread if it doesn't have one */
+    if (thread_size && NULL != (cache_ptr = H5TS_get_fl_tcache_ptr()) && *cache_ptr)
+        size = H5FL__tcache_size(*cache_ptr);
+
+    if (hits)
+        *hits = stats.hits;
+    if (misses)
+        *misses = stats.misses;
+    if (spills)
+        *spills = stats.spills;
+    if (thread_size)
+        *thread_size = size;
+#else  /* H5_HAVE_THREADSAFE_API */
+    if (hits)
+        *hits = 0;
+    if (misses)
+        *misses = 0;
+    if (spills)
+        *spills = 0;
+    if (thread_size)
+        *thread_size = 0;
+#endif /* H5_HAVE_THREADSAFE_API */
+
+#ifdef H5_HAVE_THREADSAFE_API
+done:
+    if (locked && H5FL__unlock() < 0)
+        ret_value = FAIL;
+#endif /* H5_HAVE_THREADSAFE_API */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL_get_free_list_cache_stats() */
+
+#ifdef H5_HAVE_THREADSAFE_API
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__lock_init
+ *
+ * Purpose:	Create the free list lock.  Called once per process.
+ *
+ * Return:	void (TRUE on Windows)
+ *
+ *-------------------------------------------------------------------------
+ */
+#if defined(H5_HAVE_WIN_THREADS) && !defined(H5_HAVE_C11_THREADS)
+static BOOL CALLBACK
+H5FL__lock_init(PINIT_ONCE H5_ATTR_UNUSED once, PVOID H5_ATTR_UNUSED param, PVOID H5_ATTR_UNUSED *ctx)
+{
+    BOOL ret_value = TRUE;
+
+    FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
+
+    if (H5_UNLIKELY(H5TS_mutex_init(&H5FL_lock_s, H5TS_MUTEX_TYPE_RECURSIVE) < 0))
+        HGOTO_DONE(FALSE);
+
+done:
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
+} /* end H5FL__lock_init() */
+#else
+static void
+H5FL__lock_init(void)
+{
+    FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
+
+    (void)H5TS_mutex_init(&H5FL_lock_s, H5TS_MUTEX_TYPE_RECURSIVE);
+
+    FUNC_LEAVE_NOAPI_VOID_NAMECHECK_ONLY
+} /* end H5FL__lock_init() */
+#endif
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__lock
+ *
+ * Purpose:	Acquire the lock protecting the global free lists, creating it
+ *      if necessary.
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__lock(void)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
+
+    if (H5_UNLIKELY(H5TS_once(&H5FL_lock_once_s, H5FL__lock_init) < 0))
+        HGOTO_DONE(FAIL);
+    if (H5_UNLIKELY(H5TS_mutex_lock(&H5FL_lock_s) < 0))
+        HGOTO_DONE(FAIL);
+
+done:
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
+} /* end H5FL__lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__unlock
+ *
+ * Purpose:	Release the lock protecting the global free lists
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__unlock(void)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
+
+    if (H5_UNLIKELY(H5TS_mutex_unlock(&H5FL_lock_s) < 0))
+        HGOTO_DONE(FAIL);
+
+done:
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
+} /* end H5FL__unlock() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__tcache_get
+ *
+ * Purpose:	Retrieve this thread's free list cache, creating it if it
+ *      doesn't exist yet.
+ *
+ * Return:	Success:	Pointer to the thread's cache
+ * 		Failure:	NULL (the caller should use the global free lists)
+ *
+ *-------------------------------------------------------------------------
+ */
+static struct H5FL_tcache_t *
+H5FL__tcache_get(void)
+{
+    struct H5FL_tcache_t **cache_ptr;        /* Location of the thread's cache pointer */
+    struct H5FL_tcache_t  *cache     = NULL; /* New cache */
+    struct H5FL_tcache_t  *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
+
+    if (H5_UNLIKELY(NULL == (cache_ptr = H5TS_get_fl_tcache_ptr())))
+        HGOTO_DONE(NULL);
+
+    /* Create the cache the first time the thread uses the free lists */
+    if (H5_UNLIKELY(NULL == *cache_ptr)) {
+        if (NULL == (cache = H5MM_calloc(sizeof(*cache))))
+            HGOTO_DONE(NULL);
+        if (H5_UNLIKELY(H5TS_mutex_init(&cache->lock, H5TS_MUTEX_TYPE_PLAIN) < 0)) {
+            H5MM_free(cache);
+            HGOTO_DONE(NULL);
+        } /* end if */
+
+        /* Add it to the list of all threads' caches */
+        if (H5_UNLIKELY(H5FL__lock() < 0)) {
+            H5TS_mutex_destroy(&cache->lock);
+            H5MM_free(cache);
+            HGOTO_DONE(NULL);
+        } /* end if */
+        cache->next = H5FL_tcache_head_s;
+        if (H5FL_tcache_head_s)
+            H5FL_tcache_head_s->prev = cache;
+        H5FL_tcache_head_s = cache;
+        (void)H5FL__unlock();
+
+        *cache_ptr = cache;
+    } /* end if */
+
+    /* Set return value */
+    ret_value = *cache_ptr;
+
+done:
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
+} /* end H5FL__tcache_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__tcache_pop
+ *
+ * Purpose:	Take an object for a free list from this thread's cache.
+ *      Doesn't need the free list lock.
+ *
+ * Return:	Success:	Pointer to the object (the block's info header,
+ *                              for block lists)
+ * 		Failure:	NULL (no object cached)
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FL__tcache_pop(H5FL_tcache_kind_t kind, void *head, size_t size)
+{
+    struct H5FL_tcache_t *cache;            /* This thread's cache */
+    H5FL_tcache_mag_t    *mag;              /* Magazine for the free list */
+    void                 *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
+
+    /* Only small blocks are cached */
+    if (H5FL_TCACHE_BLK == kind && size > H5FL_TCACHE_BLK_MAX)
+        HGOTO_DONE(NULL);
+
+    if (H5_UNLIKELY(NULL == (cache = H5FL__tcache_get())))
+        HGOTO_DONE(NULL);
+
+    if (H5_UNLIKELY(H5TS_mutex_lock(&cache->lock) < 0))
+        HGOTO_DONE(NULL);
+    mag = H5FL_TCACHE_MAG(cache, head, size);
+    if (mag->head == head && mag->size == size && mag->nobjs > 0) {
+        ret_value = mag->objs[--mag->nobjs];
+        cache->stats.hits++;
+    } /* end if */
+    else
+        cache->stats.misses++;
+    (void)H5TS_mutex_unlock(&cache->lock);
+
+done:
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
+} /* end H5FL__tcache_pop() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__tcache_refill
+ *
+ * Purpose:	Move a batch of free objects from a free list into this
+ *      thread's cache and take one of them.  The free list lock must be
+ *      held.
+ *
+ * Return:	Success:	Pointer to the object (the block's info header,
+ *                              for block lists)
+ * 		Failure:	NULL (no free objects on the list, or the
+ *                              thread's magazine is in use by another list)
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FL__tcache_refill(H5FL_tcache_kind_t kind, void *head, size_t size)
+{
+    struct H5FL_tcache_t *cache;            /* This thread's cache */
+    H5FL_tcache_mag_t    *mag;              /* Magazine for the free list */
+    void                 *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
+
+    /* Only small blocks are cached */
+    if (H5FL_TCACHE_BLK == kind && size > H5FL_TCACHE_BLK_MAX)
+        HGOTO_DONE(NULL);
+
+    if (H5_UNLIKELY(NULL == (cache = H5FL__tcache_get())))
+        HGOTO_DONE(NULL);
+
+    if (H5_UNLIKELY(H5TS_mutex_lock(&cache->lock) < 0))
+        HGOTO_DONE(NULL);
+    mag = H5FL_TCACHE_MAG(cache, head, size);
+
+    /* Take over an empty magazine */
+    if (0 == mag->nobjs) {
+        mag->kind = kind;
+        mag->head = head;
+        mag->size = size;
+    } /* end if */
+
+    if (mag->head == head && mag->size == size) {
+        void *obj; /* Object from the free list */
+
+        /* Fill the magazine half-way, plus the object to return */
+        while (mag->nobjs <= H5FL_TCACHE_BATCH) {
+            if (H5FL_TCACHE_REG == kind)
+                obj = H5FL__reg_unlink((H5FL_reg_head_t *)head);
+            else if (H5FL_TCACHE_BLK == kind)
+                obj = H5FL__blk_unlink((H5FL_blk_head_t *)head, size);
+            else
+                obj = H5FL__fac_unlink((H5FL_fac_head_t *)head);
+            if (NULL == obj)
+                break;
+            mag->objs[mag->nobjs++] = obj;
+        } /* end while */
+
+        if (mag->nobjs > 0)
+            ret_value = mag->objs[--mag->nobjs];
+    } /* end if */
+    (void)H5TS_mutex_unlock(&cache->lock);
+
+done:
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
+} /* end H5FL__tcache_refill() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__tcache_push
+ *
+ * Purpose:	Put a free object into this thread's cache.  Doesn't need the
+ *      free list lock.  If the magazine for the list is full, the oldest
+ *      H5FL_TCACHE_BATCH objects in it are moved to SPILL, and the caller
+ *      must put them on the free list.
+ *
+ * Return:	Success:	true (the object was cached)
+ * 		Failure:	false (the caller must put the object on the
+ *                              free list)
+ *
+ *-------------------------------------------------------------------------
+ */
+static bool
+H5FL__tcache_push(H5FL_tcache_kind_t kind, void *head, size_t size, void *obj, void **spill,
+                  unsigned *nspill)
+{
+    struct H5FL_tcache_t *cache;             /* This thread's cache */
+    H5FL_tcache_mag_t    *mag;               /* Magazine for the free list */
+    bool                  ret_value = false; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
+
+    /* Only small blocks are cached */
+    if (H5FL_TCACHE_BLK == kind && size > H5FL_TCACHE_BLK_MAX)
+        HGOTO_DONE(false);
+
+    if (H5_UNLIKELY(NULL == (cache = H5FL__tcache_get())))
+        HGOTO_DONE(false);
+
+    if (H5_UNLIKELY(H5TS_mutex_lock(&cache->lock) < 0))
+        HGOTO_DONE(false);
+    mag = H5FL_TCACHE_MAG(cache, head, size);
+
+    /* Take over an empty magazine */
+    if (0 == mag->nobjs) {
+        mag->kind = kind;
+        mag->head = head;
+        mag->size = size;
+    } /* end if */
+
+    if (mag->head == head && mag->size == size) {
+        /* Move the oldest objects out of a full magazine */
+        if (H5FL_TCACHE_MAG_SIZE == mag->nobjs) {
+            H5MM_memcpy(spill, mag->objs, H5FL_TCACHE_BATCH * sizeof(void *));
+            memmove(mag->objs, mag->objs + H5FL_TCACHE_BATCH,
+                    (H5FL_TCACHE_MAG_SIZE - H5FL_TCACHE_BATCH) * sizeof(void *));
+            mag->nobjs -= H5FL_TCACHE_BATCH;
+            *nspill = H5FL_TCACHE_BATCH;
+            cache->stats.spills++;
+        } /* end if */
+
+        mag->objs[mag->nobjs++] = obj;
+        ret_value               = true;
+    } /* end if */
+    (void)H5TS_mutex_unlock(&cache->lock);
+
+done:
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
+} /* end H5FL__tcache_push() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__tcache_purge
+ *
+ * Purpose:	Return the objects in a thread's cache to their free lists,
+ *      either for all lists, or only for the list HEAD.  The free list
+ *      lock must be held.
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__tcache_purge(struct H5FL_tcache_t *cache, const void *head)
+{
+    void    *objs[H5FL_TCACHE_MAG_SIZE]; /* Objects taken out of a magazine */
+    unsigned u, v;                       /* Local index variables */
+    herr_t   ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    for (u = 0; u < H5FL_TCACHE_NMAGS; u++) {
+        H5FL_tcache_mag_t *mag   = &cache->mags[u]; /* Magazine to purge */
+        H5FL_tcache_kind_t kind;                    /* Kind of free list for magazine */
+        void              *mag_head;                /* Free list for magazine */
+        size_t             size;                    /* Size of blocks in magazine */
+        unsigned           nobjs = 0;               /* # of objects taken out of magazine */
+
+        /* Empty the magazine, then put its objects on the free list
+         * without holding the cache's lock, since doing so may allocate
+         * from the free lists */
+        if (H5_UNLIKELY(H5TS_mutex_lock(&cache->lock) < 0))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTLOCK, FAIL, "unable to lock thread cache");
+        kind     = mag->kind;
+        mag_head = mag->head;
+        size     = mag->size;
+        if (mag->nobjs > 0 && (NULL == head || head == mag_head)) {
+            nobjs = mag->nobjs;
+            H5MM_memcpy(objs, mag->objs, nobjs * sizeof(void *));
+            mag->nobjs = 0;
+            mag->head  = NULL;
+        } /* end if */
+        if (H5_UNLIKELY(H5TS_mutex_unlock(&cache->lock) < 0))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTUNLOCK, FAIL, "unable to unlock thread cache");
+
+        for (v = 0; v < nobjs; v++) {
+            if (H5FL_TCACHE_REG == kind)
+                H5FL__reg_link((H5FL_reg_head_t *)mag_head, objs[v]);
+            else if (H5FL_TCACHE_BLK == kind) {
+                if (H5FL__blk_link((H5FL_blk_head_t *)mag_head, (H5FL_blk_list_t *)objs[v], size) < 0)
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, FAIL, "unable to put block on free list");
+            } /* end if */
+            else
+                H5FL__fac_link((H5FL_fac_head_t *)mag_head, objs[v]);
+        } /* end for */
+    }     /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__tcache_purge() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__tcache_purge_all
+ *
+ * Purpose:	Return the objects in all threads' caches to their free
+ *      lists, either for all lists, or only for the list HEAD.  The free
+ *      list lock must be held.
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__tcache_purge_all(const void *head)
+{
+    struct H5FL_tcache_t *cache;               /* Thread's cache */
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    for (cache = H5FL_tcache_head_s; cache; cache = cache->next)
+        if (H5FL__tcache_purge(cache, head) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, FAIL, "unable to purge thread cache");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__tcache_purge_all() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__tcache_size
+ *
+ * Purpose:	Compute the number of bytes of free objects in a thread's
+ *      cache.  The free list lock must be held, so the lists the objects
+ *      belong to can't be shut down meanwhile.
+ *
+ * Return:	Number of bytes in the cache
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5FL__tcache_size(struct H5FL_tcache_t *cache)
+{
+    unsigned u;             /* Local index variable */
+    size_t   ret_value = 0; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
+
+    if (H5_LIKELY(H5TS_mutex_lock(&cache->lock) >= 0)) {
+        for (u = 0; u < H5FL_TCACHE_NMAGS; u++) {
+            const H5FL_tcache_mag_t *mag = &cache->mags[u]; /* Magazine to count */
+
+            if (mag->nobjs > 0) {
+                if (H5FL_TCACHE_REG == mag->kind)
+                    ret_value += mag->nobjs * ((const H5FL_reg_head_t *)mag->head)->size;
+                else if (H5FL_TCACHE_BLK == mag->kind)
+                    ret_value += mag->nobjs * mag->size;
+                else
+                    ret_value += mag->nobjs * ((const H5FL_fac_head_t *)mag->head)->size;
+            } /* end if */
+        }     /* end for */
+        (void)H5TS_mutex_unlock(&cache->lock);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
+} /* end H5FL__tcache_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_tcache_release
+ *
+ * Purpose:	Return the objects in a thread's free list cache to the free
+ *      lists and release the cache.  Called when the thread exits.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5FL_tcache_release(struct H5FL_tcache_t *cache)
+{
+    FUNC_ENTER_NOAPI_NAMECHECK_ONLY
+
+    if (cache && H5FL__lock() >= 0) {
+        (void)H5FL__tcache_purge(cache, NULL);
+
+        /* Keep its statistics */
+        H5FL_tcache_exited_s.hits += cache->stats.hits;
+        H5FL_tcache_exited_s.misses += cache->stats.misses;
+        H5FL_tcache_exited_s.spills += cache->stats.spills;
+
+        /* Remove it from the list of all threads' caches */
+        if (cache->prev)
+            cache->prev->next = cache->next;
+        else
+            H5FL_tcache_head_s = cache->next;
+        if (cache->next)
+            cache->next->prev = cache->prev;
+
+        (void)H5FL__unlock();
+
+        H5TS_mutex_destroy(&cache->lock);
+        H5MM_free(cache);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID_NAMECHECK_ONLY
+} /* end H5FL_tcache_release() */
+#endif /* H5_HAVE_THREADSAFE_API */
@@ -381,6 +381,14 @@ H5_DLL herr_t H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim, in
                                         int fac_global_lim, int fac_list_lim);
 H5_DLL herr_t H5FL_get_free_list_sizes(size_t *reg_size, size_t *arr_size, size_t *blk_size,
                                        size_t *fac_size);
+H5_DLL herr_t H5FL_get_free_list_cache_stats(uint64_t *hits, uint64_t *misses, uint64_t *spills,
+                                             size_t *thread_size);
 H5_DLL int    H5FL_term_interface(void);
 
+#ifdef H5_HAVE_THREADSAFE_API
+/* Per-thread free list caches */
+struct H5FL_tcache_t;
+H5_DLL void H5FL_tcache_release(struct H5FL_tcache_t *cache);
+#endif /* H5_HAVE_THREADSAFE_API */
+
 #endif
@@ -47,6 +47,9 @@
 #define H5F_ACCUM_THRESHOLD 2048
 #define H5F_ACCUM_MAX_SIZE  (1024 * 1024) /* Max. accum. buf size (max. I/Os will be 1/2 this size) */
 
+/* Max. size of a dirty region held apart from the main accumulator buffer */
+#define H5F_ACCUM_REGION_MAX_SIZE (H5F_ACCUM_MAX_SIZE / 2)
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -65,6 +68,10 @@ typedef enum {
 /* Local Prototypes */
 /********************/
 
+static herr_t H5F__accum_write_regions(H5F_shared_t *f_sh, haddr_t addr, hsize_t size, bool flush_main);
+static herr_t H5F__accum_region_add(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
+                                    const void *buf);
+
 /*********************/
 /* Package Variables */
 /*********************/
@@ -116,6 +123,13 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
         /* Set up alias for file's metadata accumulator info */
         accum = &f_sh->accum;
 
+        /* Write out any dirty regions that the read overlaps, so that the
+         * accumulator buffer never holds stale copies of them
+         */
+        if (accum->nregions > 0)
+            if (H5F__accum_write_regions(f_sh, addr, size, false) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write accumulator regions");
+
         if (size < H5F_ACCUM_MAX_SIZE) {
             /* Sanity check */
             assert(!accum->buf || (accum->alloc_size >= accum->size));
@@ -243,10 +257,26 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
         }     /* end else */
     }         /* end if */
     else {
+        H5F_meta_accum_t *accum = &f_sh->accum; /* Alias for file's metadata accumulator */
+        unsigned          u;                    /* Local index variable */
+
         /* Read the data */
         if (H5FD_read(file, map_type, addr, size, buf) < 0)
             HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed");
-    } /* end else */
+
+        /* Copy in the data from any dirty regions that overlap the read */
+        for (u = 0; u < accum->nregions; u++) {
+            H5F_accum_region_t *region = &accum->regions[u];
+
+            if (H5_addr_overlap(addr, size, region->loc, region->size)) {
+                haddr_t start = MAX(addr, region->loc);
+                haddr_t end   = MIN(addr + size, region->loc + region->size);
+
+                H5MM_memcpy((unsigned char *)buf + (start - addr), region->buf + (start - region->loc),
+                            (size_t)(end - start));
+            } /* end if */
+        }     /* end for */
+    }         /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -415,13 +445,26 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
     /* Translate to file driver pointer */
     file = f_sh->lf;
 
+    /* Check for accumulating a small raw data write in a dirty region */
+    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type == H5FD_MEM_DRAW && size > 0 &&
+        size <= f_sh->accum.raw_max_size && size <= H5F_ACCUM_REGION_MAX_SIZE && NULL == f_sh->page_buf &&
+        !(H5_addr_defined(f_sh->accum.loc) &&
+          H5_addr_overlap(addr, size, f_sh->accum.loc, f_sh->accum.size))) {
+        if (H5F__accum_region_add(f_sh, H5FD_MEM_DRAW, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTINSERT, FAIL, "can't add raw data to accumulator region");
+    } /* end if */
     /* Check for accumulating metadata */
-    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type != H5FD_MEM_DRAW) {
+    else if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type != H5FD_MEM_DRAW) {
         H5F_meta_accum_t *accum; /* Alias for file's metadata accumulator */
 
         /* Set up alias for file's metadata accumulator info */
         accum = &f_sh->accum;
 
+        /* Write out any dirty regions that the new metadata overlaps */
+        if (accum->nregions > 0)
+            if (H5F__accum_write_regions(f_sh, addr, size, false) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write accumulator regions");
+
         if (size < H5F_ACCUM_MAX_SIZE) {
             /* Sanity check */
             assert(!accum->buf || (accum->alloc_size >= accum->size));
@@ -626,10 +669,19 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                 }     /* end if */
                 /* New piece of metadata doesn't adjoin or overlap the existing accumulator */
                 else {
-                    /* Write out the existing metadata accumulator, with dispatch to driver */
+                    /* Hold on to the dirty region of the existing metadata accumulator,
+                     * to be written along with the other dirty regions, or write it out
+                     * with dispatch to driver if it's too large or there's a page buffer
+                     */
                     if (accum->dirty) {
-                        if (H5FD_write(file, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off,
-                                       accum->dirty_len, accum->buf + accum->dirty_off) < 0)
+                        if (NULL == f_sh->page_buf && accum->dirty_len <= H5F_ACCUM_REGION_MAX_SIZE) {
+                            if (H5F__accum_region_add(f_sh, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off,
+                                                      accum->dirty_len, accum->buf + accum->dirty_off) < 0)
+                                HGOTO_ERROR(H5E_IO, H5E_CANTINSERT, FAIL,
+                                            "can't add metadata to accumulator region");
+                        } /* end if */
+                        else if (H5FD_write(file, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off,
+                                            accum->dirty_len, accum->buf + accum->dirty_off) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
 
                         /* Reset accumulator dirty flag */
@@ -775,9 +827,12 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                         memmove(accum->buf, accum->buf + overlap_size, accum->size);
                     }      /* end if */
                     else { /* Access covers whole accumulator */
-                        /* Reset accumulator, but don't flush */
-                        if (H5F__accum_reset(f_sh, false, false) < 0)
-                            HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't reset accumulator");
+                        /* Reset accumulator, but don't flush (or drop the dirty regions) */
+                        accum->buf        = H5FL_BLK_FREE(meta_accum, accum->buf);
+                        accum->alloc_size = accum->size = 0;
+                        accum->loc                      = HADDR_UNDEF;
+                        accum->dirty                    = false;
+                        accum->dirty_len                = 0;
                     }                    /* end else */
                 }                        /* end if */
                 else {                   /* Write starts after beginning of accumulator */
@@ -817,6 +872,11 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
         }         /* end else */
     }             /* end if */
     else {
+        /* Write out any dirty regions that the data overlaps */
+        if (f_sh->accum.nregions > 0)
+            if (H5F__accum_write_regions(f_sh, addr, size, false) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write accumulator regions");
+
         /* Write the data */
         if (H5FD_write(file, map_type, addr, size, buf) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
@@ -837,7 +897,7 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr, hsize_t size)
+H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, hsize_t size)
 {
     H5F_meta_accum_t *accum;               /* Alias for file's metadata accumulator */
     H5FD_t           *file;                /* File driver pointer */
@@ -854,14 +914,38 @@ H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr
     /* Translate to file driver pointer */
     file = f_sh->lf;
 
+    /* Drop the dirty regions within the freed block */
+    if (accum->nregions > 0) {
+        bool     partial = false; /* Whether a region partially overlaps the freed block */
+        unsigned u       = 0;     /* Local index variable */
+
+        while (u < accum->nregions) {
+            H5F_accum_region_t *region = &accum->regions[u];
+
+            if (H5_addr_le(addr, region->loc) && H5_addr_ge(addr + size, region->loc + region->size)) {
+                region->buf       = H5FL_BLK_FREE(meta_accum, region->buf);
+                accum->regions[u] = accum->regions[--accum->nregions];
+            } /* end if */
+            else {
+                if (H5_addr_overlap(addr, size, region->loc, region->size))
+                    partial = true;
+                u++;
+            } /* end else */
+        }     /* end while */
+
+        /* Write out the regions that aren't entirely freed */
+        if (partial)
+            if (H5F__accum_write_regions(f_sh, addr, size, false) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write accumulator regions");
+    } /* end if */
+
     /* Adjust the metadata accumulator to remove the freed block, if it overlaps */
-    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && H5_addr_defined(accum->loc) &&
-        H5_addr_overlap(addr, size, accum->loc, accum->size)) {
+    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && H5FD_MEM_DRAW != type &&
+        H5_addr_defined(accum->loc) && H5_addr_overlap(addr, size, accum->loc, accum->size)) {
         size_t overlap_size; /* Size of overlap with accumulator */
 
         /* Sanity check */
         /* (The metadata accumulator should not intersect w/raw data */
-        assert(H5FD_MEM_DRAW != type);
         assert(H5FD_MEM_GHEAP != type); /* (global heap data is being treated as raw data currently) */
 
         /* Check for overlapping the beginning of the accumulator */
@@ -1010,25 +1094,46 @@ H5F__accum_flush(H5F_shared_t *f_sh)
     assert(f_sh);
 
     /* Check if we need to flush out the metadata accumulator */
-    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && f_sh->accum.dirty) {
-        H5FD_t *file; /* File driver pointer */
-
-        /* Translate to file driver pointer */
-        file = f_sh->lf;
-
-        /* Flush the metadata contents */
-        if (H5FD_write(file, H5FD_MEM_DEFAULT, f_sh->accum.loc + f_sh->accum.dirty_off, f_sh->accum.dirty_len,
-                       f_sh->accum.buf + f_sh->accum.dirty_off) < 0)
+    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) &&
+        (f_sh->accum.dirty || f_sh->accum.nregions > 0)) {
+        /* Flush the metadata contents and the dirty regions */
+        if (H5F__accum_write_regions(f_sh, HADDR_UNDEF, 0, true) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
-
-        /* Reset the dirty flag */
-        f_sh->accum.dirty = false;
     } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__accum_flush() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_flush_regions
+ *
+ * Purpose:     Write the accumulator's dirty regions to the file, leaving
+ *              the main accumulator buffer alone.  Used before I/O that
+ *              bypasses the accumulator.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__accum_flush_regions(H5F_shared_t *f_sh)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(f_sh);
+
+    if (f_sh->accum.nregions > 0)
+        if (H5F__accum_write_regions(f_sh, HADDR_UNDEF, 0, false) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write accumulator regions");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_flush_regions() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5F__accum_reset
  *
@@ -1058,10 +1163,17 @@ H5F__accum_reset(H5F_shared_t *f_sh, bool flush, bool force)
 
     /* Check if we need to reset the metadata accumulator information */
     if (f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) {
+        unsigned u; /* Local index variable */
+
         /* Free the buffer */
         if (f_sh->accum.buf)
             f_sh->accum.buf = H5FL_BLK_FREE(meta_accum, f_sh->accum.buf);
 
+        /* Drop the dirty regions */
+        for (u = 0; u < f_sh->accum.nregions; u++)
+            f_sh->accum.regions[u].buf = H5FL_BLK_FREE(meta_accum, f_sh->accum.regions[u].buf);
+        f_sh->accum.nregions = 0;
+
         /* Reset the buffer sizes & location */
         f_sh->accum.alloc_size = f_sh->accum.size = 0;
         f_sh->accum.loc                           = HADDR_UNDEF;
@@ -1072,3 +1184,237 @@ H5F__accum_reset(H5F_shared_t *f_sh, bool flush, bool force)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__accum_reset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_write_regions
+ *
+ * Purpose:     Write the dirty regions that overlap the block at ADDR of
+ *              SIZE bytes (or all of them, if ADDR is undefined) to the
+ *              file with a single vector write, and release them.  The
+ *              dirty part of the main accumulator buffer is written along
+ *              with them when FLUSH_MAIN is set.
+ *
+ *              The pieces are written in increasing address order, and
+ *              any part of a region at or beyond the EOA is dropped.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_write_regions(H5F_shared_t *f_sh, haddr_t addr, hsize_t size, bool flush_main)
+{
+    H5F_meta_accum_t *accum;                            /* Alias for file's metadata accumulator */
+    H5FD_mem_t        types[H5F_ACCUM_MAX_REGIONS + 1]; /* Memory types of the pieces to write */
+    haddr_t           addrs[H5F_ACCUM_MAX_REGIONS + 1]; /* Addresses of the pieces to write */
+    size_t            sizes[H5F_ACCUM_MAX_REGIONS + 1]; /* Sizes of the pieces to write */
+    const void       *bufs[H5F_ACCUM_MAX_REGIONS + 1];  /* Buffers of the pieces to write */
+    bool              selected[H5F_ACCUM_MAX_REGIONS];  /* Whether each region is written out */
+    uint32_t          count = 0;                        /* # of pieces to write */
+    unsigned          u, v;                             /* Local index variables */
+    herr_t            ret_value = SUCCEED;              /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(f_sh);
+
+    /* Set up alias for file's metadata accumulator info */
+    accum = &f_sh->accum;
+
+    for (u = 0; u <= accum->nregions; u++) {
+        H5FD_mem_t     type; /* Memory type of the piece */
+        haddr_t        loc;  /* Address of the piece */
+        size_t         len;  /* Size of the piece */
+        unsigned char *data; /* Buffer of the piece */
+        haddr_t        eoa;  /* Current EOA for the file */
+
+        /* The last pass picks up the main accumulator's dirty region */
+        if (u < accum->nregions) {
+            H5F_accum_region_t *region = &accum->regions[u];
+
+            selected[u] = !H5_addr_defined(addr) || H5_addr_overlap(addr, size, region->loc, region->size);
+            if (!selected[u])
+                continue;
+            type = region->type;
+            loc  = region->loc;
+            len  = region->size;
+            data = region->buf;
+        } /* end if */
+        else {
+            if (!(flush_main && accum->dirty))
+                continue;
+            type = H5FD_MEM_DEFAULT;
+            loc  = accum->loc + accum->dirty_off;
+            len  = accum->dirty_len;
+            data = accum->buf + accum->dirty_off;
+        } /* end else */
+
+        /* Retrieve the 'eoa' for the file */
+        if (HADDR_UNDEF == (eoa = H5F_shared_get_eoa(f_sh, type)))
+            HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "driver get_eoa request failed");
+
+        /* Drop the part of the piece at or beyond the EOA */
+        if (H5_addr_ge(loc, eoa))
+            continue;
+        if (H5_addr_gt(loc + len, eoa))
+            len = (size_t)(eoa - loc);
+
+        /* Insert the piece in address order */
+        for (v = count; v > 0 && H5_addr_gt(addrs[v - 1], loc); v--) {
+            types[v] = types[v - 1];
+            addrs[v] = addrs[v - 1];
+            sizes[v] = sizes[v - 1];
+            bufs[v]  = bufs[v - 1];
+        } /* end for */
+        types[v] = type;
+        addrs[v] = loc;
+        sizes[v] = len;
+        bufs[v]  = data;
+        count++;
+    } /* end for */
+
+    /* Write the pieces */
+    if (count > 0)
+        if (H5FD_write_vector(f_sh->lf, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed");
+
+    /* Reset the main accumulator's dirty flag */
+    if (flush_main)
+        accum->dirty = false;
+
+    /* Release the regions written, keeping the remaining ones packed */
+    for (u = v = 0; u < accum->nregions; u++) {
+        if (selected[u])
+            accum->regions[u].buf = H5FL_BLK_FREE(meta_accum, accum->regions[u].buf);
+        else
+            accum->regions[v++] = accum->regions[u];
+    } /* end for */
+    accum->nregions = v;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_write_regions() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_region_add
+ *
+ * Purpose:     Hold on to SIZE bytes of dirty data for ADDR in a dirty
+ *              region of the accumulator, instead of writing it out.
+ *
+ *              Data within a region of the same type replaces the data
+ *              there, and data adjoining one is added to it, as long as
+ *              the region stays under H5F_ACCUM_REGION_MAX_SIZE.  Any
+ *              other region overlapping the data is written out first.
+ *              Otherwise a new region is started, writing out all the
+ *              regions when there's no free slot for it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_region_add(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf)
+{
+    H5F_meta_accum_t   *accum;               /* Alias for file's metadata accumulator */
+    H5F_accum_region_t *region = NULL;       /* Region to add the data to */
+    bool                overlap = false;     /* Whether the data overlaps a region */
+    unsigned            u;                   /* Local index variable */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(f_sh);
+    assert(H5FD_MEM_DEFAULT == type || H5FD_MEM_DRAW == type);
+    assert(size > 0 && size <= H5F_ACCUM_REGION_MAX_SIZE);
+    assert(buf);
+
+    /* Set up alias for file's metadata accumulator info */
+    accum = &f_sh->accum;
+
+    /* Look for a region of the same type holding the data */
+    for (u = 0; u < accum->nregions; u++) {
+        region = &accum->regions[u];
+
+        if (region->type == type && H5_addr_le(region->loc, addr) &&
+            H5_addr_le(addr + size, region->loc + region->size)) {
+            H5MM_memcpy(region->buf + (addr - region->loc), buf, size);
+            HGOTO_DONE(SUCCEED);
+        } /* end if */
+        if (H5_addr_overlap(addr, size, region->loc, region->size))
+            overlap = true;
+    } /* end for */
+
+    /* Write out the regions the data overlaps */
+    if (overlap)
+        if (H5F__accum_write_regions(f_sh, addr, size, false) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write accumulator regions");
+
+    /* Look for a region of the same type that the data adjoins */
+    region = NULL;
+    for (u = 0; u < accum->nregions; u++)
+        if (accum->regions[u].type == type &&
+            (H5_addr_eq(accum->regions[u].loc + accum->regions[u].size, addr) ||
+             H5_addr_eq(addr + size, accum->regions[u].loc))) {
+            region = &accum->regions[u];
+            break;
+        } /* end if */
+
+    /* Write out the region if it would get too large */
+    if (region && (region->size + size) > H5F_ACCUM_REGION_MAX_SIZE) {
+        if (H5F__accum_write_regions(f_sh, region->loc, region->size, false) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write accumulator regions");
+        region = NULL;
+    } /* end if */
+
+    if (region) {
+        /* Check if we need more buffer space */
+        if ((region->size + size) > region->alloc_size) {
+            size_t         new_size; /* New size of region buffer */
+            unsigned char *new_buf;  /* New region buffer */
+
+            /* Adjust the buffer size to be a power of 2 that is large enough to hold data */
+            new_size = (size_t)1 << (1 + H5VM_log2_gen((uint64_t)((region->size + size) - 1)));
+
+            if (NULL == (new_buf = H5FL_BLK_REALLOC(meta_accum, region->buf, new_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate accumulator region buffer");
+            region->buf        = new_buf;
+            region->alloc_size = new_size;
+        } /* end if */
+
+        /* Add the data at the front or the end of the region */
+        if (H5_addr_eq(addr + size, region->loc)) {
+            memmove(region->buf + size, region->buf, region->size);
+            H5MM_memcpy(region->buf, buf, size);
+            region->loc = addr;
+        } /* end if */
+        else
+            H5MM_memcpy(region->buf + region->size, buf, size);
+        region->size += size;
+    } /* end if */
+    else {
+        size_t alloc_size; /* Size of new region buffer */
+
+        /* Make room for a new region */
+        if (accum->nregions == H5F_ACCUM_MAX_REGIONS)
+            if (H5F__accum_write_regions(f_sh, HADDR_UNDEF, 0, false) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write accumulator regions");
+
+        /* Adjust the buffer size to be a power of 2 that is large enough to hold data */
+        alloc_size = (size_t)1 << (1 + H5VM_log2_gen((uint64_t)(size - 1)));
+
+        region = &accum->regions[accum->nregions];
+        if (NULL == (region->buf = H5FL_BLK_MALLOC(meta_accum, alloc_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate accumulator region buffer");
+        H5MM_memcpy(region->buf, buf, size);
+        region->loc        = addr;
+        region->size       = size;
+        region->alloc_size = alloc_size;
+        region->type       = type;
+        accum->nregions++;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_region_add() */
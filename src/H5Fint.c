@@ -400,12 +400,16 @@ H5F_get_access_plist(H5F_t *f, bool app_ref)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set alignment threshold");
     if (H5P_set(new_plist, H5F_ACS_ALIGN_NAME, &(f->shared->alignment)) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set alignment");
+    if (H5P_set(new_plist, H5F_ACS_RAW_DATA_ALIGN_NAME, &(f->shared->raw_data_align)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set raw data alignment");
     if (H5P_set(new_plist, H5F_ACS_GARBG_COLCT_REF_NAME, &(f->shared->gc_ref)) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set garbage collect reference");
     if (H5P_set(new_plist, H5F_ACS_META_BLOCK_SIZE_NAME, &(f->shared->meta_aggr.alloc_size)) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set metadata cache size");
     if (H5P_set(new_plist, H5F_ACS_SIEVE_BUF_SIZE_NAME, &(f->shared->sieve_buf_size)) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't sieve buffer size");
+    if (H5P_set(new_plist, H5F_ACS_RAW_DATA_ACCUM_SIZE_NAME, &(f->shared->accum.raw_max_size)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set raw data accumulation size");
     if (H5P_set(new_plist, H5F_ACS_SDATA_BLOCK_SIZE_NAME, &(f->shared->sdata_aggr.alloc_size)) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set 'small data' cache size");
     if (H5P_set(new_plist, H5F_ACS_LIBVER_LOW_BOUND_NAME, &f->shared->low_bound) < 0)
@@ -439,6 +443,8 @@ H5F_get_access_plist(H5F_t *f, bool app_ref)
             0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID,
                         "can't set minimum raw data fraction of page buffer");
+        if (H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME, &(f->shared->page_buf->read_ahead)) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set page buffer read-ahead");
     } /* end if */
 #ifdef H5_HAVE_PARALLEL
     if (H5P_set(new_plist, H5_COLL_MD_READ_FLAG_NAME, &(f->shared->coll_md_read)) < 0)
@@ -466,6 +472,15 @@ H5F_get_access_plist(H5F_t *f, bool app_ref)
         0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID,
                     "can't set initial metadata cache resize config.");
+    if (H5P_set(new_plist, H5F_ACS_META_CACHE_IMAGE_COMPRESSION_NAME, &(f->shared->mdc_image_compression)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set metadata cache image compression");
+    if (H5P_set(new_plist, H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_NAME,
+                &(f->shared->mdc_miss_latency_target)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set metadata cache miss latency target");
+    if (H5P_set(new_plist, H5F_ACS_OHDR_VECTOR_READ_NAME, &(f->shared->ohdr_vector_read)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set object header vector read flag");
+    if (H5P_set(new_plist, H5F_ACS_NATIVE_ASYNC_IO_NAME, &(f->shared->native_async_io)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set asynchronous dataset I/O flag");
     if (H5P_set(new_plist, H5F_ACS_RFIC_FLAGS_NAME, &(f->shared->rfic_flags)) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set RFIC flags value");
 
@@ -1222,10 +1237,14 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get alignment threshold");
         if (H5P_get(plist, H5F_ACS_ALIGN_NAME, &(f->shared->alignment)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get alignment");
+        if (H5P_get(plist, H5F_ACS_RAW_DATA_ALIGN_NAME, &(f->shared->raw_data_align)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get raw data alignment");
         if (H5P_get(plist, H5F_ACS_GARBG_COLCT_REF_NAME, &(f->shared->gc_ref)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get garbage collect reference");
         if (H5P_get(plist, H5F_ACS_SIEVE_BUF_SIZE_NAME, &(f->shared->sieve_buf_size)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get sieve buffer size");
+        if (H5P_get(plist, H5F_ACS_RAW_DATA_ACCUM_SIZE_NAME, &(f->shared->accum.raw_max_size)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get raw data accumulation size");
         if (H5P_get(plist, H5F_ACS_LIBVER_LOW_BOUND_NAME, &(f->shared->low_bound)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get 'low' bound for library format versions");
         if (H5P_get(plist, H5F_ACS_LIBVER_HIGH_BOUND_NAME, &(f->shared->high_bound)) < 0)
@@ -1254,6 +1273,15 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
         if (H5P_get(plist, H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_NAME, &(f->shared->mdc_initCacheImageCfg)) <
             0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get initial metadata cache resize config");
+        if (H5P_get(plist, H5F_ACS_META_CACHE_IMAGE_COMPRESSION_NAME, &(f->shared->mdc_image_compression)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get metadata cache image compression");
+        if (H5P_get(plist, H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_NAME,
+                    &(f->shared->mdc_miss_latency_target)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get metadata cache miss latency target");
+        if (H5P_get(plist, H5F_ACS_OHDR_VECTOR_READ_NAME, &(f->shared->ohdr_vector_read)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get object header vector read flag");
+        if (H5P_get(plist, H5F_ACS_NATIVE_ASYNC_IO_NAME, &(f->shared->native_async_io)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get asynchronous dataset I/O flag");
         if (H5P_get(plist, H5F_ACS_RFIC_FLAGS_NAME, &(f->shared->rfic_flags)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get RFIC flags value");
 
@@ -1333,6 +1361,15 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
                 f->shared->mdc_log_location = NULL;
         } /* end block */
 
+        /* Get the metadata cache log format */
+        {
+            unsigned mdc_log_format; /* Format of metadata cache log */
+
+            if (H5P_get(plist, H5F_ACS_MDC_LOG_FORMAT_NAME, &mdc_log_format) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get mdc log format");
+            f->shared->mdc_log_format = (H5AC_log_format_t)mdc_log_format;
+        } /* end block */
+
         /* Get object flush callback information */
         if (H5P_get(plist, H5F_ACS_OBJECT_FLUSH_CB_NAME, &(f->shared->object_flush)) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get object flush cb info");
@@ -1834,6 +1871,7 @@ H5F_open(bool try, H5F_t **_file, const char *name, unsigned flags, hid_t fcpl_i
     size_t             page_buf_size;
     unsigned           page_buf_min_meta_perc = 0;
     unsigned           page_buf_min_raw_perc  = 0;
+    unsigned           page_buf_read_ahead    = 0;
     bool               set_flag               = false;  /*set the status_flags in the superblock */
     bool               clear                  = false;  /*clear the status_flags         */
     bool               evict_on_close;                  /* evict on close value from plist  */
@@ -2043,6 +2081,8 @@ H5F_open(bool try, H5F_t **_file, const char *name, unsigned flags, hid_t fcpl_i
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get minimum metadata fraction of page buffer");
         if (H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, &page_buf_min_raw_perc) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get minimum raw data fraction of page buffer");
+        if (H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME, &page_buf_read_ahead) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get page buffer read-ahead");
     } /* end if */
 
     /* Get the evict on close setting */
@@ -2055,20 +2095,12 @@ H5F_open(bool try, H5F_t **_file, const char *name, unsigned flags, hid_t fcpl_i
     if (H5F_SHARED_HAS_FEATURE(file->shared, H5FD_FEAT_HAS_MPI)) {
         int mpi_size = H5F_shared_mpi_get_size(file->shared);
 
-        /*
-         * While there shouldn't be any problems in general with using page buffering
-         * with only 1 MPI process, there are still some testing issues to be fixed.
-         * Until then, page buffering is disabled for any form of parallel access.
+        /* Collective metadata writes are not supported with page buffering,
+         * since they bypass the page buffer entirely
          */
-        if (page_buf_size) {
-            /* Collective metadata writes are not supported with page buffering */
-            if (file->shared->coll_md_write)
-                HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL,
-                            "collective metadata writes are not supported with page buffering");
-
-            /* Temporary: fail file create when page buffering feature is enabled for parallel */
-            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "page buffering is disabled for parallel");
-        }
+        if (page_buf_size && file->shared->coll_md_write)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL,
+                        "collective metadata writes are not supported with page buffering");
 
         if (mpi_size > 1) {
             if (evict_on_close)
@@ -2091,7 +2123,8 @@ H5F_open(bool try, H5F_t **_file, const char *name, unsigned flags, hid_t fcpl_i
 
         /* Create the page buffer before initializing the superblock */
         if (page_buf_size)
-            if (H5PB_create(shared, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc) < 0)
+            if (H5PB_create(shared, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc,
+                            page_buf_read_ahead) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "unable to create page buffer");
 
         /* Initialize information about the superblock and allocate space for it */
@@ -2127,7 +2160,8 @@ H5F_open(bool try, H5F_t **_file, const char *name, unsigned flags, hid_t fcpl_i
 
         /* Create the page buffer *after* reading the superblock */
         if (page_buf_size)
-            if (H5PB_create(shared, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc) < 0)
+            if (H5PB_create(shared, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc,
+                            page_buf_read_ahead) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "unable to create page buffer");
 
         /* Open the root group */
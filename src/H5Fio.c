@@ -254,6 +254,11 @@ H5F_shared_select_read(H5F_shared_t *f_sh, H5FD_mem_t type, uint32_t count, H5S_
     /* Treat global heap as raw data */
     map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
 
+    /* Write out the accumulator's dirty regions, which this I/O bypasses */
+    if (f_sh->accum.nregions > 0)
+        if (H5F__accum_flush_regions(f_sh) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write accumulator regions");
+
     /* Pass down to file driver layer (bypass page buffer for now) */
     if (H5FD_read_selection(f_sh->lf, map_type, count, mem_spaces, file_spaces, offsets, element_sizes,
                             bufs) < 0)
@@ -296,6 +301,11 @@ H5F_shared_select_write(H5F_shared_t *f_sh, H5FD_mem_t type, uint32_t count, H5S
     /* Treat global heap as raw data */
     map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
 
+    /* Write out the accumulator's dirty regions, which this I/O bypasses */
+    if (f_sh->accum.nregions > 0)
+        if (H5F__accum_flush_regions(f_sh) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write accumulator regions");
+
     /* Pass down to file driver layer (bypass page buffer for now) */
     if (H5FD_write_selection(f_sh->lf, map_type, count, mem_spaces, file_spaces, offsets, element_sizes,
                              bufs) < 0)
@@ -339,6 +349,11 @@ H5F_shared_vector_read(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[], h
     }
 #endif
 
+    /* Write out the accumulator's dirty regions, which this I/O bypasses */
+    if (f_sh->accum.nregions > 0)
+        if (H5F__accum_flush_regions(f_sh) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write accumulator regions");
+
     /* Pass down to file driver layer (bypass page buffer for now) */
     if (H5FD_read_vector(f_sh->lf, count, types, addrs, sizes, bufs) < 0)
         HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read through file driver failed");
@@ -392,6 +407,40 @@ H5F_shared_vector_write(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[],
     }
 #endif
 
+    /* Write out the accumulator's dirty regions, which this I/O bypasses */
+    if (f_sh->accum.nregions > 0)
+        if (H5F__accum_flush_regions(f_sh) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write accumulator regions");
+
+    /* Drop any accumulated metadata that this I/O overwrites */
+    if (f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) {
+        H5FD_mem_t type         = H5FD_MEM_DEFAULT;
+        size_t     size         = 0;
+        bool       extend_types = false;
+        bool       extend_sizes = false;
+
+        for (uint32_t i = 0; i < count; i++) {
+            /* An H5FD_MEM_NOLIST type or 0 size repeats the previous one
+             * for the rest of the vector
+             */
+            if (!extend_types) {
+                if (i > 0 && types[i] == H5FD_MEM_NOLIST)
+                    extend_types = true;
+                else
+                    type = types[i];
+            } /* end if */
+            if (!extend_sizes) {
+                if (i > 0 && sizes[i] == 0)
+                    extend_sizes = true;
+                else
+                    size = sizes[i];
+            } /* end if */
+
+            if (H5F__accum_free(f_sh, type, addrs[i], (hsize_t)size) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTFREE, FAIL, "can't adjust metadata accumulator");
+        } /* end for */
+    }     /* end if */
+
     /* Pass down to file driver layer (bypass page buffer for now) */
     if (H5FD_write_vector(f_sh->lf, count, types, addrs, sizes, bufs) < 0)
         HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write through file driver failed");
@@ -187,6 +187,20 @@ struct H5F_blk_aggr_t {
     haddr_t       addr;         /* Location of block left */
 };
 
+/* Maximum # of disjoint dirty regions held by the accumulator, in addition
+ * to the dirty region of the main accumulator buffer.
+ */
+#define H5F_ACCUM_MAX_REGIONS 8
+
+/* Structure for a dirty region held by the accumulator, awaiting a vector write */
+typedef struct H5F_accum_region_t {
+    unsigned char *buf;        /* Buffer holding the region's data */
+    haddr_t        loc;        /* File location (offset) of the region */
+    size_t         size;       /* Size of the region (in bytes) */
+    size_t         alloc_size; /* Size of the region's buffer allocated (in bytes) */
+    H5FD_mem_t     type;       /* Memory type of the region (H5FD_MEM_DEFAULT or H5FD_MEM_DRAW) */
+} H5F_accum_region_t;
+
 /* Structure for metadata accumulator fields */
 typedef struct H5F_meta_accum_t {
     unsigned char *buf;        /* Buffer to hold the accumulated metadata */
@@ -196,6 +210,11 @@ typedef struct H5F_meta_accum_t {
     size_t         dirty_off;  /* Offset of the dirty region in the accumulator buffer */
     size_t         dirty_len;  /* Length of the dirty region in the accumulator buffer */
     bool           dirty;      /* Flag to indicate that the accumulated metadata is dirty */
+
+    /* Disjoint dirty regions, written to the file together */
+    H5F_accum_region_t regions[H5F_ACCUM_MAX_REGIONS]; /* Dirty regions, unordered */
+    unsigned           nregions;                       /* # of dirty regions in use */
+    size_t             raw_max_size; /* Largest raw data write to accumulate (0 = none) */
 } H5F_meta_accum_t;
 
 /* A record of the mount table */
@@ -283,10 +302,18 @@ struct H5F_shared_t {
                                                      /* close option.  This structure is     */
                                                      /* fixed at creation time and should    */
                                                      /* not change thereafter.               */
+    unsigned mdc_image_compression;                  /* Deflate level for metadata cache     */
+                                                     /* images written on close (0 = none)   */
+    double mdc_miss_latency_target;                  /* Target time (s) per metadata cache   */
+                                                     /* access spent loading entries         */
+    H5F_ohdr_spec_read_t ohdr_spec_read;             /* Speculative object header read size  */
+    bool ohdr_vector_read;                           /* Read object header chunks together   */
+    bool native_async_io;                            /* Run async dataset I/O in background  */
     bool use_mdc_logging;                            /* Set when metadata logging is desired */
     bool start_mdc_log_on_access;                    /* set when mdc logging should  */
                                                      /* begin on file access/create          */
     char              *mdc_log_location;             /* location of mdc log               */
+    H5AC_log_format_t  mdc_log_format;               /* format of mdc log                 */
     hid_t              fcpl_id;                      /* File creation property list ID 	*/
     H5F_close_degree_t fc_degree;                    /* File close behavior degree	*/
     bool     evict_on_close; /* If the file's objects should be evicted from the metadata cache on close */
@@ -296,6 +323,7 @@ struct H5F_shared_t {
     size_t   sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
     hsize_t  threshold;      /* Threshold for alignment		*/
     hsize_t  alignment;      /* Alignment				*/
+    hsize_t  raw_data_align; /* Alignment of raw data allocations	*/
     unsigned gc_ref;         /* Garbage-collect references?		*/
     H5F_libver_t         low_bound;             /* The 'low' bound of library format versions */
     H5F_libver_t         high_bound;            /* The 'high' bound of library format versions */
@@ -444,6 +472,7 @@ H5_DLL herr_t H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr
                                const void *buf);
 H5_DLL herr_t H5F__accum_free(H5F_shared_t *f, H5FD_mem_t type, haddr_t addr, hsize_t size);
 H5_DLL herr_t H5F__accum_flush(H5F_shared_t *f_sh);
+H5_DLL herr_t H5F__accum_flush_regions(H5F_shared_t *f_sh);
 H5_DLL herr_t H5F__accum_reset(H5F_shared_t *f_sh, bool flush, bool force);
 
 /* Shared file list related routines */
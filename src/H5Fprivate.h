@@ -91,6 +91,12 @@ typedef struct H5F_t H5F_t;
 #define H5F_USE_MDC_LOGGING(F)         ((F)->shared->use_mdc_logging)
 #define H5F_START_MDC_LOG_ON_ACCESS(F) ((F)->shared->start_mdc_log_on_access)
 #define H5F_MDC_LOG_LOCATION(F)        ((F)->shared->mdc_log_location)
+#define H5F_MDC_LOG_FORMAT(F)          ((F)->shared->mdc_log_format)
+#define H5F_MDC_IMAGE_COMPRESSION(F)   ((F)->shared->mdc_image_compression)
+#define H5F_MDC_MISS_LATENCY_TARGET(F) ((F)->shared->mdc_miss_latency_target)
+#define H5F_OHDR_SPEC_READ(F)          (&(F)->shared->ohdr_spec_read)
+#define H5F_OHDR_VECTOR_READ(F)        ((F)->shared->ohdr_vector_read)
+#define H5F_NATIVE_ASYNC_IO(F)         ((F)->shared->native_async_io)
 #define H5F_ALIGNMENT(F)               ((F)->shared->alignment)
 #define H5F_THRESHOLD(F)               ((F)->shared->threshold)
 #define H5F_PGEND_META_THRES(F)        ((F)->shared->fs.pgend_meta_thres)
@@ -155,6 +161,12 @@ typedef struct H5F_t H5F_t;
 #define H5F_USE_MDC_LOGGING(F)         (H5F_use_mdc_logging(F))
 #define H5F_START_MDC_LOG_ON_ACCESS(F) (H5F_start_mdc_log_on_access(F))
 #define H5F_MDC_LOG_LOCATION(F)        (H5F_mdc_log_location(F))
+#define H5F_MDC_LOG_FORMAT(F)          (H5F_mdc_log_format(F))
+#define H5F_MDC_IMAGE_COMPRESSION(F)   (H5F_mdc_image_compression(F))
+#define H5F_MDC_MISS_LATENCY_TARGET(F) (H5F_mdc_miss_latency_target(F))
+#define H5F_OHDR_SPEC_READ(F)          (H5F_ohdr_spec_read(F))
+#define H5F_OHDR_VECTOR_READ(F)        (H5F_ohdr_vector_read(F))
+#define H5F_NATIVE_ASYNC_IO(F)         (H5F_native_async_io(F))
 #define H5F_ALIGNMENT(F)               (H5F_get_alignment(F))
 #define H5F_THRESHOLD(F)               (H5F_get_threshold(F))
 #define H5F_PGEND_META_THRES(F)        (H5F_get_pgend_meta_thres(F))
@@ -222,6 +234,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_ACS_PREEMPT_READ_CHUNKS_NAME  "rdcc_w0"     /* Preemption read chunks first */
 #define H5F_ACS_ALIGN_THRHD_NAME          "threshold"   /* Threshold for alignment */
 #define H5F_ACS_ALIGN_NAME                "align"       /* Alignment */
+#define H5F_ACS_RAW_DATA_ALIGN_NAME       "raw_data_align" /* Alignment of raw data allocations */
 #define H5F_ACS_META_BLOCK_SIZE_NAME                                                                         \
     "meta_block_size" /* Minimum metadata allocation block size (when aggregating metadata allocations) */
 #define H5F_ACS_SIEVE_BUF_SIZE_NAME                                                                          \
@@ -261,6 +274,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_ACS_MDC_LOG_LOCATION_NAME "mdc_log_location" /* Name of metadata cache log location */
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_NAME                                                                 \
     "start_mdc_log_on_access" /* Whether logging starts on file create/open */
+#define H5F_ACS_MDC_LOG_FORMAT_NAME "mdc_log_format" /* Format of the metadata cache log */
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_NAME                                                                     \
     "evict_on_close_flag" /* Whether or not the metadata cache will evict objects on close */
 #define H5F_ACS_COLL_MD_WRITE_FLAG_NAME                                                                      \
@@ -268,11 +282,23 @@ typedef struct H5F_t H5F_t;
                                  */
 #define H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_NAME                                                            \
     "mdc_initCacheImageCfg" /* Initial metadata cache image creation configuration */
+#define H5F_ACS_META_CACHE_IMAGE_COMPRESSION_NAME                                                            \
+    "mdc_image_compression" /* Deflate level used to compress metadata cache images */
+#define H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_NAME                                                          \
+    "mdc_miss_latency_target" /* Target time per metadata cache access spent on misses */
+#define H5F_ACS_OHDR_VECTOR_READ_NAME                                                                        \
+    "ohdr_vector_read" /* Whether object header chunks are read with vector reads */
+#define H5F_ACS_NATIVE_ASYNC_IO_NAME                                                                         \
+    "native_async_io" /* Whether asynchronous dataset I/O runs on a background thread */
 #define H5F_ACS_PAGE_BUFFER_SIZE_NAME "page_buffer_size" /* the maximum size for the page buffer cache */
 #define H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME                                                               \
     "page_buffer_min_meta_perc" /* the min metadata percentage for the page buffer cache */
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME                                                                \
     "page_buffer_min_raw_perc" /* the min raw data percentage for the page buffer cache */
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME                                                                  \
+    "page_buffer_read_ahead" /* the max # of metadata pages read ahead by the page buffer cache */
+#define H5F_ACS_RAW_DATA_ACCUM_SIZE_NAME                                                                     \
+    "raw_data_accum_size" /* the max size of raw data writes held in the accumulator */
 #define H5F_ACS_USE_FILE_LOCKING_NAME                                                                        \
     "use_file_locking" /* whether or not we use file locks for SWMR control and to prevent multiple writers  \
                         */
@@ -345,6 +371,8 @@ typedef struct H5F_t H5F_t;
 #define H5F_ALIGN_DEF 1
 /* Default for alignment (can be set via H5Pset_alignment()) */
 #define H5F_ALIGN_THRHD_DEF 1
+/* Default for raw data alignment (can be set via H5Pset_raw_data_alignment()) */
+#define H5F_RAW_DATA_ALIGN_DEF 1
 /* Default size for meta data aggregation block (can be set via H5Pset_meta_block_size()) */
 #define H5F_META_BLOCK_SIZE_DEF 2048
 /* Default size for small data aggregation block (can be set via H5Pset_small_data_block_size()) */
@@ -440,6 +468,12 @@ typedef struct H5F_object_flush_t {
     void          *udata; /* User data */
 } H5F_object_flush_t;
 
+/* Speculative object header read size, learned from the file's object headers */
+typedef struct H5F_ohdr_spec_read_t {
+    size_t   size;   /* Current speculative read size (0 until learned) */
+    unsigned nsmall; /* # of object headers in a row much smaller than the size */
+} H5F_ohdr_spec_read_t;
+
 /* Concise info about a block of bytes in a file */
 typedef struct H5F_block_t {
     haddr_t offset; /* Offset of the block in the file */
@@ -562,15 +596,22 @@ H5_DLL hsize_t            H5F_get_threshold(const H5F_t *f);
 H5_DLL H5P_coll_md_read_flag_t H5F_coll_md_read(const H5F_t *f);
 H5_DLL H5P_coll_md_read_flag_t H5F_shared_coll_md_read(const H5F_shared_t *f_sh);
 #endif /* H5_HAVE_PARALLEL */
-H5_DLL bool  H5F_use_mdc_logging(const H5F_t *f);
-H5_DLL bool  H5F_start_mdc_log_on_access(const H5F_t *f);
-H5_DLL char *H5F_mdc_log_location(const H5F_t *f);
+H5_DLL bool              H5F_use_mdc_logging(const H5F_t *f);
+H5_DLL bool              H5F_start_mdc_log_on_access(const H5F_t *f);
+H5_DLL char             *H5F_mdc_log_location(const H5F_t *f);
+H5_DLL H5AC_log_format_t H5F_mdc_log_format(const H5F_t *f);
+H5_DLL unsigned              H5F_mdc_image_compression(const H5F_t *f);
+H5_DLL double                H5F_mdc_miss_latency_target(const H5F_t *f);
+H5_DLL H5F_ohdr_spec_read_t *H5F_ohdr_spec_read(const H5F_t *f);
+H5_DLL bool                  H5F_ohdr_vector_read(const H5F_t *f);
+H5_DLL bool                  H5F_native_async_io(const H5F_t *f);
 
 /* Functions that retrieve values from VFD layer */
 H5_DLL hid_t   H5F_get_driver_id(const H5F_t *f);
 H5_DLL herr_t  H5F_get_fileno(const H5F_t *f, unsigned long *filenum);
 H5_DLL bool    H5F_shared_has_feature(const H5F_shared_t *f, unsigned feature);
 H5_DLL bool    H5F_has_feature(const H5F_t *f, unsigned feature);
+H5_DLL bool    H5F_concurrent_raw_read(const H5F_t *f);
 H5_DLL haddr_t H5F_shared_get_eoa(const H5F_shared_t *f_sh, H5FD_mem_t type);
 H5_DLL haddr_t H5F_get_eoa(const H5F_t *f, H5FD_mem_t type);
 H5_DLL herr_t  H5F_shared_get_file_driver(const H5F_shared_t *f_sh, H5FD_t **file_handle);
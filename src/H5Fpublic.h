@@ -165,6 +165,17 @@ typedef struct H5F_sect_info_t {
 } H5F_sect_info_t;
 //! <!-- [H5F_sect_info_t_snip] -->
 
+/**
+ * Metadata cache statistics for one type of metadata entry
+ */
+//! <!-- [H5F_mdc_type_stats_t_snip] -->
+typedef struct H5F_mdc_type_stats_t {
+    const char *name;      /**< Name of the metadata entry type */
+    uint64_t    misses;    /**< Number of cache misses for entries of this type */
+    double      load_time; /**< Time spent loading entries of this type, in seconds */
+} H5F_mdc_type_stats_t;
+//! <!-- [H5F_mdc_type_stats_t_snip] -->
+
 /**
  * Library's format versions
  */
@@ -1119,6 +1130,40 @@ H5_DLL herr_t H5Fset_mdc_config(hid_t file_id, const H5AC_cache_config_t *config
  *
  */
 H5_DLL herr_t H5Fget_mdc_hit_rate(hid_t file_id, double *hit_rate_ptr);
+/**
+ * \ingroup MDC
+ *
+ * \brief Obtains the target file's metadata cache miss statistics per entry type
+ *
+ * \file_id
+ * \param[in] ntypes The number of elements in \p stats
+ * \param[out] stats Array of instances of H5F_mdc_type_stats_t in which the
+ *                   statistics are to be returned
+ *
+ * \return Returns the number of metadata entry types known to the cache;
+ *         otherwise returns a negative value.
+ *
+ * \details H5Fget_mdc_type_stats() reports, for each type of metadata entry,
+ *          the number of metadata cache misses and the time spent loading
+ *          entries of that type from the file since the file was opened.
+ *          Unlike the hit rate statistics, these are never reset.
+ *
+ *          H5F_mdc_type_stats_t is defined as follows (in H5Fpublic.h):
+ *          \snippet this H5F_mdc_type_stats_t_snip
+ *
+ *          Statistics are returned for at most \p ntypes entry types. The
+ *          number of entry types can be found with a preliminary call in
+ *          which \p stats is NULL. The \c name field points to a string
+ *          owned by the library and must not be freed.
+ *
+ *          These statistics help choose a miss latency target for the
+ *          #H5C_incr__working_set cache size increase mode (see
+ *          H5Pset_mdc_miss_latency_target()).
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL ssize_t H5Fget_mdc_type_stats(hid_t file_id, size_t ntypes, H5F_mdc_type_stats_t stats[] /*out*/);
 /**
  * \ingroup MDC
  *
@@ -833,6 +833,32 @@ H5F_has_feature(const H5F_t *f, unsigned feature)
     FUNC_LEAVE_NOAPI((bool)(f->shared->lf->feature_flags & feature))
 } /* end H5F_has_feature() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5F_concurrent_raw_read
+ *
+ * Purpose:  Check if several threads may read raw data from the file at
+ *           the same time.  This requires a file opened read-only (and
+ *           not for SWMR reading, since the file may grow underneath the
+ *           reader), without a page buffer, and with a file driver whose
+ *           read callback can run concurrently with itself.
+ *
+ * Return:   true/false (can't fail)
+ *-------------------------------------------------------------------------
+ */
+bool
+H5F_concurrent_raw_read(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    assert(f);
+    assert(f->shared);
+
+    FUNC_LEAVE_NOAPI(!(f->shared->flags & (H5F_ACC_RDWR | H5F_ACC_SWMR_READ)) &&
+                     NULL == f->shared->page_buf &&
+                     (f->shared->lf->feature_flags & H5FD_FEAT_CONCURRENT_READ))
+} /* end H5F_concurrent_raw_read() */
+
 /*-------------------------------------------------------------------------
  * Function: H5F_get_driver_id
  *
@@ -1175,6 +1201,142 @@ H5F_mdc_log_location(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->mdc_log_location)
 } /* end H5F_mdc_log_location() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5F_mdc_log_format
+ *
+ * Purpose:  Quick and dirty routine to retrieve the MDC log format
+ *           for this file.
+ *           (Mainly added to stop non-file routines from poking about in the
+ *           H5F_t data structure)
+ *
+ * Return:   MDC log format on success/abort on failure (shouldn't fail)
+ *-------------------------------------------------------------------------
+ */
+H5AC_log_format_t
+H5F_mdc_log_format(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    assert(f);
+    assert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->mdc_log_format)
+} /* end H5F_mdc_log_format() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_mdc_image_compression
+ *
+ * Purpose:  Quick and dirty routine to retrieve the deflate level used to
+ *           compress the metadata cache image written when this file is
+ *           closed.
+ *           (Mainly added to stop non-file routines from poking about in the
+ *           H5F_t data structure)
+ *
+ * Return:   Deflate level, or zero if cache images aren't compressed
+ *           (shouldn't fail)
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5F_mdc_image_compression(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    assert(f);
+    assert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->mdc_image_compression)
+} /* end H5F_mdc_image_compression() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_mdc_miss_latency_target
+ *
+ * Purpose:  Quick and dirty routine to retrieve the target time per
+ *           metadata cache access spent loading entries, used by the
+ *           working set cache size increase mode.
+ *           (Mainly added to stop non-file routines from poking about in the
+ *           H5F_t data structure)
+ *
+ * Return:   Target time in seconds, or zero if there is no target
+ *           (shouldn't fail)
+ *-------------------------------------------------------------------------
+ */
+double
+H5F_mdc_miss_latency_target(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    assert(f);
+    assert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->mdc_miss_latency_target)
+} /* end H5F_mdc_miss_latency_target() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_ohdr_spec_read
+ *
+ * Purpose:  Retrieve a pointer to the speculative object header read size
+ *           learned for this file.
+ *
+ * Return:   Pointer to the speculative read size info (can't fail)
+ *-------------------------------------------------------------------------
+ */
+H5F_ohdr_spec_read_t *
+H5F_ohdr_spec_read(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    assert(f);
+    assert(f->shared);
+
+    FUNC_LEAVE_NOAPI(&f->shared->ohdr_spec_read)
+} /* end H5F_ohdr_spec_read() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_ohdr_vector_read
+ *
+ * Purpose:  Retrieve whether the chunks of object headers are read with
+ *           vector reads for this file.
+ *
+ * Return:   true/false (can't fail)
+ *-------------------------------------------------------------------------
+ */
+bool
+H5F_ohdr_vector_read(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    assert(f);
+    assert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->ohdr_vector_read)
+} /* end H5F_ohdr_vector_read() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_native_async_io
+ *
+ * Purpose:  Retrieve whether asynchronous dataset I/O on this file runs on
+ *           the native VOL connector's background thread.
+ *
+ * Return:   true/false (can't fail)
+ *-------------------------------------------------------------------------
+ */
+bool
+H5F_native_async_io(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    assert(f);
+    assert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->native_async_io)
+} /* end H5F_native_async_io() */
+
 /*-------------------------------------------------------------------------
  * Function: H5F_get_alignment
  *
@@ -1356,7 +1518,10 @@ H5F_get_use_file_locking(const H5F_t *f)
 /*-------------------------------------------------------------------------
  * Function: H5F_has_vector_select_io
  *
- * Purpose:  Determine if vector or selection I/O is supported by this file
+ * Purpose:  Determine if vector or selection I/O is supported by this file,
+ *           for deciding whether selection I/O is enabled by default.
+ *           Drivers that set H5FD_FEAT_SELECTION_IO_OPT_IN are reported as
+ *           unsupported.
  *
  * Return:   true/false
  *
@@ -1372,7 +1537,11 @@ H5F_has_vector_select_io(const H5F_t *f, bool is_write)
     assert(f);
     assert(f->shared);
 
-    if (is_write)
+    /* Drivers may implement the callbacks without wanting selection I/O
+     * to be turned on by default */
+    if (f->shared->lf->feature_flags & H5FD_FEAT_SELECTION_IO_OPT_IN)
+        ret_value = false;
+    else if (is_write)
         ret_value = (f->shared->lf->cls->write_vector != NULL || f->shared->lf->cls->write_selection != NULL);
     else
         ret_value = (f->shared->lf->cls->read_vector != NULL || f->shared->lf->cls->read_selection != NULL);
@@ -593,6 +593,15 @@ H5Iis_valid(hid_t id)
     H5I_id_info_t *info      = NULL; /* Pointer to the ID info */
     htri_t         ret_value = true; /* Return value */
 
+#ifdef H5_HAVE_CONCURRENCY
+    /* Check the ID's slot without acquiring the API lock.  Only future IDs,
+     * which may have to be realized, need the full lookup.
+     */
+    if ((ret_value = H5I__is_valid_nolock(id)) >= 0)
+        return ret_value;
+    ret_value = true;
+#endif /* H5_HAVE_CONCURRENCY */
+
     FUNC_ENTER_API(FAIL)
 
     /* Find the ID */
@@ -173,13 +173,12 @@ H5I_dump_ids_for_type(H5I_type_t type)
     if (type_info) {
 
         H5I_id_info_t *item = NULL;
-        H5I_id_info_t *tmp  = NULL;
 
         /* Header */
         fprintf(stderr, "     init_count = %u\n", type_info->init_count);
         fprintf(stderr, "     reserved   = %u\n", type_info->cls->reserved);
         fprintf(stderr, "     id_count   = %llu\n", (unsigned long long)type_info->id_count);
-        fprintf(stderr, "     nextid        = %llu\n", (unsigned long long)type_info->nextid);
+        fprintf(stderr, "     free_slot  = %u\n", (unsigned)type_info->free_slot);
 
         /* List */
         if (type_info->id_count > 0) {
@@ -190,11 +189,8 @@ H5I_dump_ids_for_type(H5I_type_t type)
              *
              * XXX: Update this to emit an error message on errors?
              */
-            fprintf(stderr, "     (HASH TABLE)\n");
-            HASH_ITER(hh, type_info->hash_table, item, tmp)
-            {
+            for (item = type_info->first_id; item; item = item->next)
                 H5I__id_dump_cb((void *)item, NULL, (void *)&type);
-            }
         }
     }
     else
@@ -38,6 +38,38 @@
 /* Combine a Type number and an ID index into an ID */
 #define H5I_MAKE(g, i) ((((hid_t)(g) & TYPE_MASK) << ID_BITS) | ((hid_t)(i) & ID_MASK))
 
+/* Combine a slot generation and a slot index into an ID index */
+#define H5I_MAKE_INDEX(gen, slot) ((((hid_t)(gen) & GEN_MASK) << SLOT_BITS) | (hid_t)(slot))
+
+/* Slot state word: generation and flags for the ID in the slot */
+#define H5I_STATE_APP_REF   0x1u
+#define H5I_STATE_FUTURE    0x2u
+#define H5I_STATE_GEN(st)   ((unsigned)(st) >> 2)
+#define H5I_FREE_STATE(gen) ((unsigned)(gen) << 2)
+#define H5I_MAKE_STATE(gen, info)                                                                            \
+    (H5I_FREE_STATE(gen) | ((info)->app_count > 0 ? H5I_STATE_APP_REF : 0) |                                 \
+     ((info)->is_future ? H5I_STATE_FUTURE : 0))
+
+/* Access to the parts of a type's slot table that are read without the API
+ * lock in the concurrency build
+ */
+#ifdef H5_HAVE_CONCURRENCY
+#define H5I_LOAD_STATE(s)      H5TS_atomic_load_uint(&(s)->state)
+#define H5I_STORE_STATE(s, v)  H5TS_atomic_store_uint(&(s)->state, (v))
+#define H5I_LOAD_DIR(t)        ((H5I_slot_dir_t *)H5TS_atomic_load_voidp(&(t)->slot_dir))
+#define H5I_LOAD_NSLOTS(t)     ((uint32_t)H5TS_atomic_load_uint(&(t)->nslots))
+#define H5I_STORE_NSLOTS(t, n) H5TS_atomic_store_uint(&(t)->nslots, (unsigned)(n))
+#else
+#define H5I_LOAD_STATE(s)      ((s)->state)
+#define H5I_STORE_STATE(s, v)  ((s)->state = (v))
+#define H5I_LOAD_DIR(t)        ((t)->slot_dir)
+#define H5I_LOAD_NSLOTS(t)     ((t)->nslots)
+#define H5I_STORE_NSLOTS(t, n) ((t)->nslots = (n))
+#endif
+
+/* Initial number of page pointers in a slot page directory */
+#define H5I_INIT_DIR_PAGES 4
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -72,7 +104,18 @@ typedef struct {
 /* Local Prototypes */
 /********************/
 
-static void  *H5I__unwrap(void *object, H5I_type_t type);
+static void           H5I__init_slots(H5I_type_info_t *type_info, uint32_t reserved);
+static void           H5I__release_slots(H5I_type_info_t *type_info);
+static H5I_slot_t    *H5I__get_slot(H5I_type_info_t *type_info, uint32_t slot_idx);
+static herr_t         H5I__add_page(H5I_type_info_t *type_info, uint32_t slot_idx);
+static herr_t         H5I__alloc_slot(H5I_type_info_t *type_info, uint32_t *slot_idx);
+static herr_t         H5I__claim_slot(H5I_type_info_t *type_info, uint32_t slot_idx);
+static void           H5I__free_slot(H5I_type_info_t *type_info, hid_t id);
+static void           H5I__update_slot(H5I_type_info_t *type_info, const H5I_id_info_t *info);
+static H5I_id_info_t *H5I__lookup_id(H5I_type_info_t *type_info, hid_t id);
+static void           H5I__link_id(H5I_type_info_t *type_info, H5I_id_info_t *info);
+static void           H5I__unlink_id(H5I_type_info_t *type_info, H5I_id_info_t *info);
+static void          *H5I__unwrap(void *object, H5I_type_t type);
 static herr_t H5I__mark_node(void *_id, void *key, void *udata);
 static void  *H5I__remove_common(H5I_type_info_t *type_info, hid_t id);
 static int    H5I__dec_ref(hid_t id, void **request);
@@ -132,7 +175,7 @@ H5I_term_package(void)
 
         /* Count the number of types still in use */
         for (i = 0; i < H5I_next_type_g; i++)
-            if ((type_info = H5I_type_info_array_g[i]) && type_info->hash_table)
+            if ((type_info = H5I_type_info_array_g[i]) && type_info->first_id)
                 in_use++;
 
         /* If no types are still being used then clean up */
@@ -140,7 +183,9 @@ H5I_term_package(void)
             for (i = 0; i < H5I_next_type_g; i++) {
                 type_info = H5I_type_info_array_g[i];
                 if (type_info) {
-                    assert(NULL == type_info->hash_table);
+                    assert(NULL == type_info->first_id);
+                    if (type_info->init_count > 0)
+                        H5I__release_slots(type_info);
                     type_info                = H5MM_xfree(type_info);
                     H5I_type_info_array_g[i] = NULL;
                     in_use++;
@@ -263,11 +308,9 @@ H5I_register_type(const H5I_class_t *cls)
 
     /* Initialize the ID type structure for new types */
     if (type_info->init_count == 0) {
-        type_info->cls          = cls;
-        type_info->id_count     = 0;
-        type_info->nextid       = cls->reserved;
-        type_info->last_id_info = NULL;
-        type_info->hash_table   = NULL;
+        type_info->cls      = cls;
+        type_info->id_count = 0;
+        H5I__init_slots(type_info, (uint32_t)MIN(cls->reserved, H5I_NO_SLOT));
     }
 
     /* Increment the count of the times this type has been initialized */
@@ -282,6 +325,547 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_register_type() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5I__init_slots
+ *
+ * Purpose:     Initializes an empty slot table for a type.  The first
+ *              'reserved' slots are never handed out.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__init_slots(H5I_type_info_t *type_info, uint32_t reserved)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    assert(type_info);
+
+#ifdef H5_HAVE_CONCURRENCY
+    H5TS_atomic_init_voidp(&type_info->slot_dir, NULL);
+    H5TS_atomic_init_uint(&type_info->nslots, (unsigned)reserved);
+#else
+    type_info->slot_dir = NULL;
+    type_info->nslots   = reserved;
+#endif
+    type_info->free_slot = H5I_NO_SLOT;
+    type_info->first_id  = NULL;
+    type_info->last_id   = NULL;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__init_slots() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__release_slots
+ *
+ * Purpose:     Releases a type's slot table, including any directories
+ *              retired when the table grew.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__release_slots(H5I_type_info_t *type_info)
+{
+    H5I_slot_dir_t *dir;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    assert(type_info);
+    assert(NULL == type_info->first_id);
+
+    if (NULL != (dir = H5I_LOAD_DIR(type_info))) {
+        size_t u;
+
+        /* Release the slot pages, which are shared by all the directories */
+        for (u = 0; u < dir->npages; u++)
+            if (dir->pages[u]) {
+#ifdef H5_HAVE_CONCURRENCY
+                size_t v;
+
+                for (v = 0; v < H5I_SLOTS_PER_PAGE; v++)
+                    H5TS_atomic_destroy_uint(&dir->pages[u][v].state);
+#endif
+                H5MM_xfree(dir->pages[u]);
+            }
+
+        /* Release the current and retired directories */
+        while (dir) {
+            H5I_slot_dir_t *retired = dir->retired;
+
+            H5MM_xfree(dir);
+            dir = retired;
+        }
+    }
+
+#ifdef H5_HAVE_CONCURRENCY
+    H5TS_atomic_destroy_voidp(&type_info->slot_dir);
+    H5TS_atomic_destroy_uint(&type_info->nslots);
+#else
+    type_info->slot_dir = NULL;
+    type_info->nslots   = 0;
+#endif
+    type_info->free_slot = H5I_NO_SLOT;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__release_slots() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__get_slot
+ *
+ * Purpose:     Locates a slot in a type's slot table.
+ *
+ *              This routine only reads the slot table through the
+ *              atomic accessors, so it may be called without holding the
+ *              API lock in the concurrency build.
+ *
+ * Return:      Success:    Pointer to the slot
+ *              Failure:    NULL (slot index out of range, or the slot's
+ *                          page has never been allocated)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_slot_t *
+H5I__get_slot(H5I_type_info_t *type_info, uint32_t slot_idx)
+{
+    H5I_slot_dir_t *dir;
+    size_t          page_idx  = slot_idx / H5I_SLOTS_PER_PAGE;
+    H5I_slot_t     *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* The number of slots must be loaded before the directory, which is
+     * always published before the number of slots grows to cover it.
+     */
+    if (slot_idx >= H5I_LOAD_NSLOTS(type_info))
+        HGOTO_DONE(NULL);
+    if (NULL == (dir = H5I_LOAD_DIR(type_info)) || page_idx >= dir->npages || NULL == dir->pages[page_idx])
+        HGOTO_DONE(NULL);
+
+    ret_value = &dir->pages[page_idx][slot_idx % H5I_SLOTS_PER_PAGE];
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__get_slot() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__add_page
+ *
+ * Purpose:     Makes certain that the page holding a slot is allocated,
+ *              growing the type's page directory if necessary.
+ *
+ *              Neither pages nor directories are ever moved or released
+ *              while the type exists, so lock-free readers which loaded an
+ *              older directory can still use it.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__add_page(H5I_type_info_t *type_info, uint32_t slot_idx)
+{
+    H5I_slot_dir_t *dir       = H5I_LOAD_DIR(type_info);
+    H5I_slot_dir_t *new_dir   = NULL;
+    H5I_slot_t     *page      = NULL;
+    size_t          page_idx  = slot_idx / H5I_SLOTS_PER_PAGE;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check if the page already exists */
+    if (dir && page_idx < dir->npages && dir->pages[page_idx])
+        HGOTO_DONE(SUCCEED);
+
+    /* Allocate the page */
+    if (NULL == (page = (H5I_slot_t *)H5MM_calloc(H5I_SLOTS_PER_PAGE * sizeof(H5I_slot_t))))
+        HGOTO_ERROR(H5E_ID, H5E_CANTALLOC, FAIL, "can't allocate ID slot page");
+#ifdef H5_HAVE_CONCURRENCY
+    {
+        size_t u;
+
+        for (u = 0; u < H5I_SLOTS_PER_PAGE; u++)
+            H5TS_atomic_init_uint(&page[u].state, 0);
+    }
+#endif
+
+    /* Grow the directory, if the page doesn't fit */
+    if (NULL == dir || page_idx >= dir->npages) {
+        size_t npages = dir ? dir->npages : H5I_INIT_DIR_PAGES;
+
+        while (npages <= page_idx)
+            npages *= 2;
+
+        if (NULL == (new_dir = (H5I_slot_dir_t *)H5MM_calloc(sizeof(H5I_slot_dir_t) +
+                                                             npages * sizeof(H5I_slot_t *))))
+            HGOTO_ERROR(H5E_ID, H5E_CANTALLOC, FAIL, "can't allocate ID slot directory");
+        new_dir->npages  = npages;
+        new_dir->pages   = (H5I_slot_t **)(new_dir + 1);
+        new_dir->retired = dir;
+        if (dir)
+            H5MM_memcpy(new_dir->pages, dir->pages, dir->npages * sizeof(H5I_slot_t *));
+        new_dir->pages[page_idx] = page;
+
+        /* Publish the new directory */
+#ifdef H5_HAVE_CONCURRENCY
+        H5TS_atomic_exchange_voidp(&type_info->slot_dir, new_dir);
+#else
+        type_info->slot_dir = new_dir;
+#endif
+        new_dir = NULL;
+    }
+    else
+        dir->pages[page_idx] = page;
+    page = NULL;
+
+done:
+    if (ret_value < 0) {
+        H5MM_xfree(page);
+        H5MM_xfree(new_dir);
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__add_page() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__alloc_slot
+ *
+ * Purpose:     Takes a free slot from a type's slot table, reusing a
+ *              released slot if there is one.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__alloc_slot(H5I_type_info_t *type_info, uint32_t *slot_idx)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(type_info);
+    assert(slot_idx);
+
+    if (H5I_NO_SLOT != type_info->free_slot) {
+        H5I_slot_t *slot = H5I__get_slot(type_info, type_info->free_slot);
+
+        if (NULL == slot)
+            HGOTO_ERROR(H5E_ID, H5E_BADRANGE, FAIL, "free ID slot not in slot table");
+        assert(NULL == slot->info);
+
+        /* Take the slot from the head of the free list */
+        *slot_idx            = type_info->free_slot;
+        type_info->free_slot = slot->next_free;
+        slot->next_free      = H5I_NO_SLOT;
+    }
+    else {
+        uint32_t nslots = H5I_LOAD_NSLOTS(type_info);
+
+        if (H5I_NO_SLOT == nslots)
+            HGOTO_ERROR(H5E_ID, H5E_NOSPACE, FAIL, "no IDs available in type");
+
+        /* Extend the slot table by one slot */
+        if (H5I__add_page(type_info, nslots) < 0)
+            HGOTO_ERROR(H5E_ID, H5E_CANTALLOC, FAIL, "can't extend ID slot table");
+        H5I_STORE_NSLOTS(type_info, nslots + 1);
+
+        *slot_idx = nslots;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__alloc_slot() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__claim_slot
+ *
+ * Purpose:     Takes a specific, currently unused slot from a type's slot
+ *              table, extending the table if necessary.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__claim_slot(H5I_type_info_t *type_info, uint32_t slot_idx)
+{
+    uint32_t    nslots    = H5I_LOAD_NSLOTS(type_info);
+    uint32_t   *prev_next = NULL; /* Free list link to the slot, if it was free */
+    H5I_slot_t *slot      = NULL;
+    herr_t      ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(type_info);
+
+    if (H5I_NO_SLOT == slot_idx)
+        HGOTO_ERROR(H5E_ID, H5E_BADRANGE, FAIL, "invalid ID slot");
+
+    if (slot_idx >= nslots) {
+        uint32_t u;
+
+        /* Extend the slot table to cover the slot, putting the slots in
+         * between on the free list
+         */
+        for (u = nslots / H5I_SLOTS_PER_PAGE; u <= slot_idx / H5I_SLOTS_PER_PAGE; u++)
+            if (H5I__add_page(type_info, u * H5I_SLOTS_PER_PAGE) < 0)
+                HGOTO_ERROR(H5E_ID, H5E_CANTALLOC, FAIL, "can't extend ID slot table");
+        H5I_STORE_NSLOTS(type_info, slot_idx + 1);
+        for (u = slot_idx; u > nslots; u--) {
+            H5I_slot_t *free_slot = H5I__get_slot(type_info, u - 1);
+
+            if (NULL == free_slot)
+                HGOTO_ERROR(H5E_ID, H5E_BADRANGE, FAIL, "new ID slot not in slot table");
+            free_slot->next_free = type_info->free_slot;
+            type_info->free_slot = u - 1;
+        }
+    }
+    else {
+        /* Find the slot on the free list */
+        prev_next = &type_info->free_slot;
+        while (H5I_NO_SLOT != *prev_next && slot_idx != *prev_next) {
+            H5I_slot_t *free_slot = H5I__get_slot(type_info, *prev_next);
+
+            if (NULL == free_slot)
+                HGOTO_ERROR(H5E_ID, H5E_BADRANGE, FAIL, "free ID slot not in slot table");
+            prev_next = &free_slot->next_free;
+        }
+        if (H5I_NO_SLOT == *prev_next)
+            HGOTO_ERROR(H5E_ID, H5E_BADRANGE, FAIL, "ID slot already in use");
+    }
+
+    if (NULL == (slot = H5I__get_slot(type_info, slot_idx)))
+        HGOTO_ERROR(H5E_ID, H5E_BADRANGE, FAIL, "ID slot not in slot table");
+    assert(NULL == slot->info);
+
+    /* Unlink the slot from the free list */
+    if (prev_next)
+        *prev_next = slot->next_free;
+    slot->next_free = H5I_NO_SLOT;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__claim_slot() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__free_slot
+ *
+ * Purpose:     Returns an ID's slot to the type's free list, advancing
+ *              the slot's generation so that the released ID (and any
+ *              copies the application still holds) no longer matches it.
+ *
+ *              A slot whose generation is exhausted is left off the free
+ *              list for good, so an ID is never handed out twice.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__free_slot(H5I_type_info_t *type_info, hid_t id)
+{
+    H5I_slot_t *slot;
+    unsigned    gen = H5I_GEN(id);
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* A linked ID always has a slot */
+    if (NULL != (slot = H5I__get_slot(type_info, H5I_SLOT(id)))) {
+        assert(slot->info && slot->info->id == id);
+
+        /* Invalidate the ID for lock-free readers before releasing the slot */
+        H5I_STORE_STATE(slot, H5I_FREE_STATE(((hid_t)gen + 1) & GEN_MASK));
+        slot->info = NULL;
+
+        if ((hid_t)gen < GEN_MASK) {
+            slot->next_free      = type_info->free_slot;
+            type_info->free_slot = H5I_SLOT(id);
+        }
+    }
+    else
+        assert(0 && "linked ID has no slot");
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__free_slot() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__update_slot
+ *
+ * Purpose:     Refreshes the flags that lock-free readers check in an
+ *              ID's slot, after its application reference count or
+ *              'future' status changes.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__update_slot(H5I_type_info_t *type_info, const H5I_id_info_t *info)
+{
+    H5I_slot_t *slot;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (NULL != (slot = H5I__get_slot(type_info, H5I_SLOT(info->id)))) {
+        assert(slot->info == info);
+
+        H5I_STORE_STATE(slot, H5I_MAKE_STATE(H5I_GEN(info->id), info));
+    }
+    else
+        assert(0 && "linked ID has no slot");
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__update_slot() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__lookup_id
+ *
+ * Purpose:     Resolves an ID to its info struct with an indexed load of
+ *              the ID's slot.
+ *
+ * Return:      Success:    Pointer to the ID's info
+ *              Failure:    NULL (the ID is not in use)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I__lookup_id(H5I_type_info_t *type_info, hid_t id)
+{
+    H5I_slot_t    *slot;
+    H5I_id_info_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (NULL != (slot = H5I__get_slot(type_info, H5I_SLOT(id))) && slot->info && slot->info->id == id)
+        ret_value = slot->info;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__lookup_id() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__link_id
+ *
+ * Purpose:     Appends an ID to its type's list of IDs and stores it in
+ *              its slot, making it visible to lookups.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__link_id(H5I_type_info_t *type_info, H5I_id_info_t *info)
+{
+    H5I_slot_t *slot;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    slot = H5I__get_slot(type_info, H5I_SLOT(info->id));
+    assert(slot);
+    assert(NULL == slot->info);
+
+    /* Append to the list */
+    info->prev = type_info->last_id;
+    info->next = NULL;
+    if (type_info->last_id)
+        type_info->last_id->next = info;
+    else
+        type_info->first_id = info;
+    type_info->last_id = info;
+
+    /* Fill in the slot */
+    slot->info = info;
+    H5I_STORE_STATE(slot, H5I_MAKE_STATE(H5I_GEN(info->id), info));
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__link_id() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__unlink_id
+ *
+ * Purpose:     Removes an ID from its type's list of IDs and releases its
+ *              slot.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__unlink_id(H5I_type_info_t *type_info, H5I_id_info_t *info)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    H5I__free_slot(type_info, info->id);
+
+    if (info->prev)
+        info->prev->next = info->next;
+    else
+        type_info->first_id = info->next;
+    if (info->next)
+        info->next->prev = info->prev;
+    else
+        type_info->last_id = info->prev;
+    info->prev = info->next = NULL;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__unlink_id() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__is_valid_nolock
+ *
+ * Purpose:     Checks whether an ID is in use and has application
+ *              references, reading only the ID's slot.
+ *
+ *              In the concurrency build this may be called without the
+ *              API lock: the slot's generation and flags are read
+ *              atomically and the slot table never moves while the type
+ *              exists.  Future IDs, which may have to be realized, are
+ *              left for a full lookup.
+ *
+ * Return:      true/false, or FAIL if the answer requires a full lookup
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5I__is_valid_nolock(hid_t id)
+{
+    H5I_type_t       type;
+    H5I_type_info_t *type_info;
+    H5I_slot_t      *slot;
+    unsigned         state;
+    htri_t           ret_value = false; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Only library types are checked, since application types may be
+     * destroyed at any time
+     */
+    type = H5I_TYPE(id);
+    if (id < 0 || type <= H5I_BADID || type >= H5I_NTYPES)
+        HGOTO_DONE(false);
+    if (NULL == (type_info = H5I_type_info_array_g[type]))
+        HGOTO_DONE(false);
+    if (NULL == (slot = H5I__get_slot(type_info, H5I_SLOT(id))))
+        HGOTO_DONE(false);
+
+    state = H5I_LOAD_STATE(slot);
+    if (H5I_STATE_GEN(state) != H5I_GEN(id))
+        HGOTO_DONE(false);
+    if (state & H5I_STATE_FUTURE)
+        HGOTO_DONE(FAIL);
+
+    ret_value = (state & H5I_STATE_APP_REF) ? true : false;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__is_valid_nolock() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5I_nmembers
  *
@@ -370,7 +954,7 @@ H5I_clear_type(H5I_type_t type, bool force, bool app_ref)
 {
     H5I_clear_type_ud_t udata; /* udata struct for callback */
     H5I_id_info_t      *item      = NULL;
-    H5I_id_info_t      *tmp       = NULL;
+    H5I_id_info_t      *next      = NULL;
     herr_t              ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -396,21 +980,19 @@ H5I_clear_type(H5I_type_t type, bool force, bool app_ref)
     H5I_marking_s = true;
 
     /* Mark nodes for deletion */
-    HASH_ITER(hh, udata.type_info->hash_table, item, tmp)
-    {
+    for (item = udata.type_info->first_id; item; item = item->next)
         if (!item->marked)
             if (H5I__mark_node((void *)item, NULL, (void *)&udata) < 0)
                 HGOTO_ERROR(H5E_ID, H5E_BADITER, FAIL, "iteration failed while clearing the ID type");
-    }
 
     /* Unset marking flag */
     H5I_marking_s = false;
 
     /* Perform sweep */
-    HASH_ITER(hh, udata.type_info->hash_table, item, tmp)
-    {
+    for (item = udata.type_info->first_id; item; item = next) {
+        next = item->next;
         if (item->marked) {
-            HASH_DELETE(hh, udata.type_info->hash_table, item);
+            H5I__unlink_id(udata.type_info, item);
             item = H5FL_FREE(H5I_id_info_t, item);
         }
     }
@@ -545,8 +1127,7 @@ H5I__destroy_type(H5I_type_t type)
     if (type_info->cls->flags & H5I_CLASS_IS_APPLICATION)
         type_info->cls = H5MM_xfree_const(type_info->cls);
 
-    HASH_CLEAR(hh, type_info->hash_table);
-    type_info->hash_table = NULL;
+    H5I__release_slots(type_info);
 
     type_info = H5MM_xfree(type_info);
 
@@ -581,6 +1162,8 @@ H5I__register(H5I_type_t type, const void *object, bool app_ref, H5I_future_real
 {
     H5I_type_info_t *type_info = NULL;            /* Pointer to the type */
     H5I_id_info_t   *info      = NULL;            /* Pointer to the new ID information */
+    uint32_t         slot_idx  = H5I_NO_SLOT;     /* Slot for the new ID */
+    H5I_slot_t      *slot      = NULL;            /* The slot itself */
     hid_t            new_id    = H5I_INVALID_HID; /* New ID */
     hid_t            ret_value = H5I_INVALID_HID; /* Return value */
 
@@ -594,9 +1177,13 @@ H5I__register(H5I_type_t type, const void *object, bool app_ref, H5I_future_real
         HGOTO_ERROR(H5E_ID, H5E_BADGROUP, H5I_INVALID_HID, "invalid type");
     if (NULL == (info = H5FL_CALLOC(H5I_id_info_t)))
         HGOTO_ERROR(H5E_ID, H5E_NOSPACE, H5I_INVALID_HID, "memory allocation failed");
+    if (H5I__alloc_slot(type_info, &slot_idx) < 0)
+        HGOTO_ERROR(H5E_ID, H5E_NOSPACE, H5I_INVALID_HID, "can't allocate slot for ID");
 
-    /* Create the struct & its ID */
-    new_id           = H5I_MAKE(type, type_info->nextid);
+    /* Create the struct & its ID, from the slot and its current generation */
+    if (NULL == (slot = H5I__get_slot(type_info, slot_idx)))
+        HGOTO_ERROR(H5E_ID, H5E_BADRANGE, H5I_INVALID_HID, "ID slot not in slot table");
+    new_id = H5I_MAKE(type, H5I_MAKE_INDEX(H5I_STATE_GEN(H5I_LOAD_STATE(slot)), slot_idx));
     info->id         = new_id;
     info->count      = 1; /* initial reference count */
     info->app_count  = !!app_ref;
@@ -607,20 +1194,17 @@ H5I__register(H5I_type_t type, const void *object, bool app_ref, H5I_future_real
     info->marked     = false;
 
     /* Insert into the type */
-    HASH_ADD(hh, type_info->hash_table, id, sizeof(hid_t), info);
+    H5I__link_id(type_info, info);
     type_info->id_count++;
-    type_info->nextid++;
-
-    /* Sanity check for the 'nextid' getting too large and wrapping around */
-    assert(type_info->nextid <= ID_MASK);
-
-    /* Set the most recent ID to this object */
-    type_info->last_id_info = info;
 
     /* Set return value */
     ret_value = new_id;
 
 done:
+    if (H5I_INVALID_HID == ret_value)
+        if (info)
+            info = H5FL_FREE(H5I_id_info_t, info);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I__register() */
 
@@ -705,6 +1289,12 @@ H5I_register_using_existing_id(H5I_type_t type, void *object, bool app_ref, hid_
     if (NULL == (info = H5FL_CALLOC(H5I_id_info_t)))
         HGOTO_ERROR(H5E_ID, H5E_NOSPACE, FAIL, "memory allocation failed");
 
+    /* Take the requested ID's slot */
+    if (H5I__claim_slot(type_info, H5I_SLOT(existing_id)) < 0) {
+        info = H5FL_FREE(H5I_id_info_t, info);
+        HGOTO_ERROR(H5E_ID, H5E_BADRANGE, FAIL, "ID slot already in use");
+    }
+
     /* Create the struct & insert requested ID */
     info->id        = existing_id;
     info->count     = 1; /* initial reference count*/
@@ -719,12 +1309,9 @@ H5I_register_using_existing_id(H5I_type_t type, void *object, bool app_ref, hid_
     info->marked     = false;
 
     /* Insert into the type */
-    HASH_ADD(hh, type_info->hash_table, id, sizeof(hid_t), info);
+    H5I__link_id(type_info, info);
     type_info->id_count++;
 
-    /* Set the most recent ID to this object */
-    type_info->last_id_info = info;
-
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_register_using_existing_id() */
@@ -951,20 +1538,15 @@ H5I__remove_common(H5I_type_info_t *type_info, hid_t id)
     assert(type_info);
 
     /* Delete or mark the node */
-    HASH_FIND(hh, type_info->hash_table, &id, sizeof(hid_t), info);
-    if (info) {
+    if (NULL != (info = H5I__lookup_id(type_info, id))) {
         assert(!info->marked);
         if (!H5I_marking_s)
-            HASH_DELETE(hh, type_info->hash_table, info);
+            H5I__unlink_id(type_info, info);
         else
             info->marked = true;
     }
     else
-        HGOTO_ERROR(H5E_ID, H5E_CANTDELETE, NULL, "can't remove ID node from hash table");
-
-    /* Check if this ID was the last one accessed */
-    if (type_info->last_id_info == info)
-        type_info->last_id_info = NULL;
+        HGOTO_ERROR(H5E_ID, H5E_CANTDELETE, NULL, "can't remove ID node from slot table");
 
     ret_value = info->u.object;
 
@@ -1167,6 +1749,8 @@ H5I__dec_app_ref(hid_t id, void **request)
         /* Adjust app_ref */
         --(info->app_count);
         assert(info->count >= info->app_count);
+        if (0 == info->app_count)
+            H5I__update_slot(H5I_type_info_array_g[H5I_TYPE(id)], info);
 
         /* Set return value */
         ret_value = (int)info->app_count;
@@ -1370,7 +1954,8 @@ H5I_inc_ref(hid_t id, bool app_ref)
     /* Adjust reference counts */
     ++(info->count);
     if (app_ref)
-        ++(info->app_count);
+        if (1 == ++(info->app_count))
+            H5I__update_slot(H5I_type_info_array_g[H5I_TYPE(id)], info);
 
     /* Set return value */
     ret_value = (int)(app_ref ? info->app_count : info->count);
@@ -1624,7 +2209,7 @@ H5I_iterate(H5I_type_t type, H5I_search_func_t func, void *udata, bool app_ref)
     if (type_info && type_info->init_count > 0 && type_info->id_count > 0) {
         H5I_iterate_ud_t iter_udata; /* User data for iteration callback */
         H5I_id_info_t   *item = NULL;
-        H5I_id_info_t   *tmp  = NULL;
+        H5I_id_info_t   *next = NULL;
 
         /* Set up iterator user data */
         iter_udata.user_func  = func;
@@ -1633,8 +2218,8 @@ H5I_iterate(H5I_type_t type, H5I_search_func_t func, void *udata, bool app_ref)
         iter_udata.obj_type   = type;
 
         /* Iterate over IDs */
-        HASH_ITER(hh, type_info->hash_table, item, tmp)
-        {
+        for (item = type_info->first_id; item; item = next) {
+            next = item->next;
             if (!item->marked) {
                 int ret = H5I__iterate_cb((void *)item, NULL, (void *)&iter_udata);
                 if (H5_ITER_ERROR == ret)
@@ -1679,15 +2264,8 @@ H5I__find_id(hid_t id)
     if (!type_info || type_info->init_count <= 0)
         HGOTO_DONE(NULL);
 
-    /* Check for same ID as we have looked up last time */
-    if (type_info->last_id_info && type_info->last_id_info->id == id)
-        id_info = type_info->last_id_info;
-    else {
-        HASH_FIND(hh, type_info->hash_table, &id, sizeof(hid_t), id_info);
-
-        /* Remember this ID */
-        type_info->last_id_info = id_info;
-    }
+    /* Look up the ID's slot */
+    id_info = H5I__lookup_id(type_info, id);
 
     /* Check if this is a future ID */
     if (id_info && id_info->is_future) {
@@ -1733,6 +2311,7 @@ H5I__find_id(hid_t id)
         id_info->is_future  = false;
         id_info->realize_cb = NULL;
         id_info->discard_cb = NULL;
+        H5I__update_slot(type_info, id_info);
     }
 
     /* Set return value */
@@ -1810,7 +2389,6 @@ H5I_find_id(const void *object, H5I_type_t type, hid_t *id)
     if (type_info->init_count > 0 && type_info->id_count > 0) {
         H5I_get_id_ud_t udata; /* User data */
         H5I_id_info_t  *item = NULL;
-        H5I_id_info_t  *tmp  = NULL;
 
         /* Set up iterator user data */
         udata.object   = object;
@@ -1818,8 +2396,7 @@ H5I_find_id(const void *object, H5I_type_t type, hid_t *id)
         udata.ret_id   = H5I_INVALID_HID;
 
         /* Iterate over IDs for the ID type */
-        HASH_ITER(hh, type_info->hash_table, item, tmp)
-        {
+        for (item = type_info->first_id; item; item = item->next) {
             int ret = H5I__find_id_cb((void *)item, NULL, (void *)&udata);
             if (H5_ITER_ERROR == ret)
                 HGOTO_ERROR(H5E_ID, H5E_BADITER, FAIL, "iteration failed");
@@ -50,6 +50,27 @@
 /* Map an ID to an ID type number */
 #define H5I_TYPE(a) ((H5I_type_t)(((hid_t)(a) >> ID_BITS) & TYPE_MASK))
 
+/*
+ * The ID index is split into the index of the slot holding the ID's info
+ * (the low SLOT_BITS bits) and the slot's generation counter (the remaining
+ * high bits).  A slot's generation is incremented each time its ID is
+ * released, so stale IDs never match a reused slot.
+ */
+#define SLOT_BITS 32
+#define SLOT_MASK (((hid_t)1 << SLOT_BITS) - 1)
+#define GEN_BITS  (ID_BITS - SLOT_BITS)
+#define GEN_MASK  (((hid_t)1 << GEN_BITS) - 1)
+
+/* Map an ID to its slot index and generation */
+#define H5I_SLOT(a) ((uint32_t)((hid_t)(a) & SLOT_MASK))
+#define H5I_GEN(a)  ((unsigned)(((hid_t)(a) >> SLOT_BITS) & GEN_MASK))
+
+/* Number of slots in each page of a type's slot table */
+#define H5I_SLOTS_PER_PAGE 256
+
+/* Free list terminator (also the limit on the number of slots) */
+#define H5I_NO_SLOT UINT32_MAX
+
 /****************************/
 /* Package Private Typedefs */
 /****************************/
@@ -69,19 +90,57 @@ typedef struct H5I_id_info_t {
     H5I_future_realize_func_t realize_cb; /* 'realize' callback for future object */
     H5I_future_discard_func_t discard_cb; /* 'discard' callback for future object */
 
-    /* Hash table ID fields */
-    bool           marked; /* Marked for deletion */
-    UT_hash_handle hh;     /* Hash table handle (must be LAST) */
+    /* ID list fields */
+    bool                  marked; /* Marked for deletion */
+    struct H5I_id_info_t *prev;   /* Previous ID in the type, in order of registration */
+    struct H5I_id_info_t *next;   /* Next ID in the type, in order of registration */
 } H5I_id_info_t;
 
+/* A slot in a type's slot table.  The 'state' word holds the slot's
+ * generation (shifted left by 2), whether the ID is a future ID (bit 1) and
+ * whether it has application references (bit 0), so that validity checks can
+ * be made from the slot alone.
+ */
+typedef struct H5I_slot_t {
+    H5I_id_info_t *info;      /* ID info in this slot, or NULL when the slot is free */
+    uint32_t       next_free; /* Next slot in the free list */
+#ifdef H5_HAVE_CONCURRENCY
+    H5TS_atomic_uint_t state; /* Generation and flags, read without the API lock */
+#else
+    unsigned state; /* Generation and flags */
+#endif
+} H5I_slot_t;
+
+/* Directory of the pages of a type's slot table.  Pages never move once
+ * allocated; when the directory grows, the old one is kept on the 'retired'
+ * list until the type is released, so that lock-free readers holding it
+ * stay safe.
+ */
+typedef struct H5I_slot_dir_t {
+    size_t                 npages;  /* Number of page pointers in the directory */
+    struct H5I_slot_dir_t *retired; /* Previous, smaller directory */
+    H5I_slot_t           **pages;   /* Slot pages */
+} H5I_slot_dir_t;
+
 /* Type information structure used */
 typedef struct H5I_type_info_t {
-    const H5I_class_t *cls;          /* Pointer to ID class */
-    unsigned           init_count;   /* # of times this type has been initialized */
-    uint64_t           id_count;     /* Current number of IDs held */
-    uint64_t           nextid;       /* ID to use for the next object */
-    H5I_id_info_t     *last_id_info; /* Info for most recent ID looked up */
-    H5I_id_info_t     *hash_table;   /* Hash table pointer for this ID type */
+    const H5I_class_t *cls;        /* Pointer to ID class */
+    unsigned           init_count; /* # of times this type has been initialized */
+    uint64_t           id_count;   /* Current number of IDs held */
+
+    /* Slot table */
+#ifdef H5_HAVE_CONCURRENCY
+    H5TS_atomic_voidp_t slot_dir; /* Slot page directory (H5I_slot_dir_t *) */
+    H5TS_atomic_uint_t  nslots;   /* Number of slots in use or on the free list */
+#else
+    H5I_slot_dir_t *slot_dir; /* Slot page directory */
+    uint32_t        nslots;   /* Number of slots in use or on the free list */
+#endif
+    uint32_t free_slot; /* First free slot, or H5I_NO_SLOT */
+
+    /* IDs, in order of registration */
+    H5I_id_info_t *first_id; /* First ID in the type */
+    H5I_id_info_t *last_id;  /* Last ID in the type */
 } H5I_type_info_t;
 
 /*****************************/
@@ -112,6 +171,7 @@ H5_DLL void          *H5I__remove_verify(hid_t id, H5I_type_t type);
 H5_DLL int            H5I__inc_type_ref(H5I_type_t type);
 H5_DLL int            H5I__get_type_ref(H5I_type_t type);
 H5_DLL H5I_id_info_t *H5I__find_id(hid_t id);
+H5_DLL htri_t         H5I__is_valid_nolock(hid_t id);
 
 /* Testing functions */
 #ifdef H5I_TESTING
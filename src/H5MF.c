@@ -743,6 +743,8 @@ H5MF_alloc(H5F_t *f, H5FD_mem_t alloc_type, hsize_t size)
     H5AC_ring_t    fsm_ring  = H5AC_RING_INV; /* free space manager ring */
     H5AC_ring_t    orig_ring = H5AC_RING_INV; /* Original ring value */
     H5F_mem_page_t fs_type;                   /* Free space type (mapped from allocation type) */
+    hsize_t        raw_align = 0;             /* Alignment of raw data allocation */
+    hsize_t        raw_extra = 0;             /* Extra space allocated to align raw data */
     haddr_t        ret_value = HADDR_UNDEF;   /* Return value */
 
     FUNC_ENTER_NOAPI_TAG(H5AC__FREESPACE_TAG, HADDR_UNDEF)
@@ -756,6 +758,19 @@ H5MF_alloc(H5F_t *f, H5FD_mem_t alloc_type, hsize_t size)
     assert(f->shared->lf);
     assert(size > 0);
 
+    /* Raw data alignment: over-allocate so that an aligned block of the
+     * requested size fits, then give back the space on either side of it.
+     * Not needed when the regular alignment already covers the request.
+     */
+    if (H5FD_MEM_DRAW == alloc_type && f->shared->raw_data_align > 1 &&
+        f->shared->fs_strategy != H5F_FSPACE_STRATEGY_PAGE &&
+        !(f->shared->alignment > 1 && size >= f->shared->threshold &&
+          (f->shared->alignment % f->shared->raw_data_align) == 0)) {
+        raw_align = f->shared->raw_data_align;
+        raw_extra = raw_align - 1;
+        size += raw_extra;
+    } /* end if */
+
     H5MF__alloc_to_fs_type(f->shared, alloc_type, size, &fs_type);
 
 #ifdef H5MF_ALLOC_DEBUG_MORE
@@ -814,6 +829,23 @@ H5MF_alloc(H5F_t *f, H5FD_mem_t alloc_type, hsize_t size)
     fprintf(stderr, "%s: Check 3.0\n", __func__);
 #endif /* H5MF_ALLOC_DEBUG_MORE */
 
+    /* Trim the over-allocated raw data block to the aligned part */
+    if (raw_extra > 0) {
+        hsize_t head = 0; /* Unused space in front of the aligned block */
+        hsize_t mis_align;
+
+        if ((mis_align = (ret_value + H5F_BASE_ADDR(f)) % raw_align) > 0)
+            head = raw_align - mis_align;
+        size -= raw_extra;
+
+        if (head > 0 && H5MF_xfree(f, alloc_type, ret_value, head) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, HADDR_UNDEF, "can't free raw data alignment fragment");
+        if (raw_extra > head &&
+            H5MF_xfree(f, alloc_type, ret_value + head + size, raw_extra - head) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, HADDR_UNDEF, "can't free raw data alignment fragment");
+        ret_value += head;
+    } /* end if */
+
 done:
     /* Reset the ring in the API context */
     if (orig_ring != H5AC_RING_INV)
@@ -1082,15 +1114,12 @@ H5MF_xfree(H5F_t *f, H5FD_mem_t alloc_type, haddr_t addr, hsize_t size)
     if (H5_addr_le(f->shared->tmp_addr, addr))
         HGOTO_ERROR(H5E_RESOURCE, H5E_BADRANGE, FAIL, "attempting to free temporary file space");
 
-    /* If it's metadata, check if the space to free intersects with the file's
-     * metadata accumulator
+    /* Check if the space to free intersects with the file's metadata accumulator,
+     * or (for raw data too) with its dirty regions
      */
-    if (H5FD_MEM_DRAW != alloc_type) {
-        /* Check if the space to free intersects with the file's metadata accumulator */
-        if (H5F__accum_free(f->shared, alloc_type, addr, size) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL,
-                        "can't check free space intersection w/metadata accumulator");
-    } /* end if */
+    if (H5F__accum_free(f->shared, alloc_type, addr, size) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL,
+                    "can't check free space intersection w/metadata accumulator");
 
     /* Check if the free space manager for the file has been initialized */
     if (!f->shared->fs_man[fs_type]) {
@@ -51,6 +51,7 @@
 /********************/
 
 /* Metadata cache callbacks */
+static void   H5O__cache_learn_spec_read_size(H5F_t *f, size_t chunk0_len);
 static herr_t H5O__cache_get_initial_load_size(void *udata, size_t *image_len);
 static herr_t H5O__cache_get_final_load_size(const void *image_ptr, size_t image_len, void *udata,
                                              size_t *actual_len);
@@ -107,7 +108,7 @@ const H5AC_class_t H5AC_OHDR_CHK[1] = {{
     H5AC_OHDR_CHK_ID,                     /* Metadata client ID */
     "object header continuation chunk",   /* Metadata client name (for debugging) */
     H5FD_MEM_OHDR,                        /* File space memory type for client */
-    H5AC__CLASS_NO_FLAGS_SET,             /* Client class behavior flags */
+    H5AC__CLASS_TRAILING_CHKSUM_FLAG,     /* Client class behavior flags */
     H5O__cache_chk_get_initial_load_size, /* 'get_initial_load_size' callback */
     NULL,                                 /* 'get_final_load_size' callback */
     H5O__cache_chk_verify_chksum,         /* 'verify_chksum' callback */
@@ -147,18 +148,68 @@ H5FL_SEQ_DEFINE(H5O_cont_t);
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5O__cache_get_initial_load_size(void H5_ATTR_UNUSED *_udata, size_t *image_len)
+H5O__cache_get_initial_load_size(void *_udata, size_t *image_len)
 {
+    H5O_cache_ud_t *udata = (H5O_cache_ud_t *)_udata; /* User data for callback */
+
     FUNC_ENTER_PACKAGE_NOERR
 
+    assert(udata);
+    assert(udata->common.f);
     assert(image_len);
 
-    /* Set the image length size */
-    *image_len = H5O_SPEC_READ_SIZE;
+    /* Set the image length size, as learned from the file's object headers */
+    *image_len = MAX(H5O_SPEC_READ_SIZE, H5F_OHDR_SPEC_READ(udata->common.f)->size);
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5O__cache_get_initial_load_size() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5O__cache_learn_spec_read_size()
+ *
+ * Purpose:     Adjust the file's speculative object header read size for
+ *              an object header whose first chunk, with its prefix, is
+ *              CHUNK0_LEN bytes.
+ *
+ *              The size isn't learned with an MPI file driver, where all
+ *              processes must read the same number of bytes when metadata
+ *              reads are collective.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+H5O__cache_learn_spec_read_size(H5F_t *f, size_t chunk0_len)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(f);
+
+    if (!H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI)) {
+        H5F_ohdr_spec_read_t *spec_read = H5F_OHDR_SPEC_READ(f); /* File's speculative read info */
+        size_t                size = MAX(H5O_SPEC_READ_SIZE, spec_read->size); /* Current read size */
+
+        if (chunk0_len > size) {
+            /* Grow to cover this object header */
+            while (size < chunk0_len && size < H5O_SPEC_READ_SIZE_MAX)
+                size *= 2;
+            spec_read->size   = size;
+            spec_read->nsmall = 0;
+        } /* end if */
+        else if (size > H5O_SPEC_READ_SIZE && chunk0_len <= size / 4) {
+            /* Shrink after a run of much smaller object headers */
+            if (++spec_read->nsmall >= H5O_SPEC_READ_SHRINK_COUNT) {
+                spec_read->size   = size / 2;
+                spec_read->nsmall = 0;
+            } /* end if */
+        }     /* end if */
+        else
+            spec_read->nsmall = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5O__cache_learn_spec_read_size() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5O__cache_get_final_load_size()
  *
@@ -190,6 +241,9 @@ H5O__cache_get_final_load_size(const void *image, size_t image_len, void *_udata
     /* Set the final size for the cache image */
     *actual_len = udata->chunk0_size + (size_t)H5O_SIZEOF_HDR(udata->oh);
 
+    /* Learn the speculative read size for the file's object headers */
+    H5O__cache_learn_spec_read_size(udata->common.f, *actual_len);
+
     /* Save the oh version to be used later in verify_chksum callback
        because oh will be freed before leaving this routine */
     udata->oh_version = udata->oh->version;
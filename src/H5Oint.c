@@ -77,6 +77,8 @@ static herr_t H5O__free_visit_visited(void *item, void *key, void *operator_data
 static herr_t H5O__visit_cb(hid_t group, const char *name, const H5L_info2_t *linfo, void *_udata);
 static herr_t H5O__obj_class_real(const H5O_t *oh, const H5O_obj_class_t **cls);
 static herr_t H5O__reset_info2(H5O_info2_t *oinfo);
+static herr_t H5O__read_ahead_chunks(H5F_t *f, const H5O_cont_msgs_t *cont_msg_info, size_t start,
+                                     size_t *end);
 
 /*********************/
 /* Package Variables */
@@ -957,6 +959,56 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5O_link() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5O__read_ahead_chunks
+ *
+ * Purpose:     Read the object header chunks of the continuation messages
+ *              from START on with a single vector read, ahead of their
+ *              loads.  *END is set to the number of continuation messages
+ *              whose chunks have been read ahead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__read_ahead_chunks(H5F_t *f, const H5O_cont_msgs_t *cont_msg_info, size_t start, size_t *end)
+{
+    haddr_t *addrs     = NULL;    /* Addresses of the chunks */
+    size_t  *sizes     = NULL;    /* Sizes of the chunks */
+    size_t   count;               /* # of chunks to read */
+    size_t   u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(f);
+    assert(cont_msg_info);
+    assert(start < cont_msg_info->nmsgs);
+    assert(end);
+
+    count = cont_msg_info->nmsgs - start;
+    if (NULL == (addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))) ||
+        NULL == (sizes = (size_t *)H5MM_malloc(count * sizeof(size_t))))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTALLOC, FAIL, "memory allocation failed for chunk read");
+    for (u = 0; u < count; u++) {
+        addrs[u] = cont_msg_info->msgs[start + u].addr;
+        sizes[u] = cont_msg_info->msgs[start + u].size;
+    } /* end for */
+
+    if (H5AC_read_ahead(f, H5AC_OHDR_CHK, count, addrs, sizes) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_READERROR, FAIL, "unable to read object header chunks");
+
+    *end = cont_msg_info->nmsgs;
+
+done:
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__read_ahead_chunks() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5O_protect
  *
@@ -973,11 +1025,12 @@ done:
 H5O_t *
 H5O_protect(const H5O_loc_t *loc, unsigned prot_flags, bool pin_all_chunks)
 {
-    H5O_t          *oh = NULL;        /* Object header protected */
-    H5O_cache_ud_t  udata;            /* User data for protecting object header */
-    H5O_cont_msgs_t cont_msg_info;    /* Continuation message info */
-    unsigned        file_intent;      /* R/W intent on file */
-    H5O_t          *ret_value = NULL; /* Return value */
+    H5O_t          *oh = NULL;          /* Object header protected */
+    H5O_cache_ud_t  udata;              /* User data for protecting object header */
+    H5O_cont_msgs_t cont_msg_info;      /* Continuation message info */
+    size_t          read_ahead_end = 0; /* # of continuation messages whose chunks were read ahead */
+    unsigned        file_intent;        /* R/W intent on file */
+    H5O_t          *ret_value = NULL;   /* Return value */
 
     FUNC_ENTER_NOAPI_TAG(loc->addr, NULL)
 
@@ -1045,6 +1098,14 @@ H5O_protect(const H5O_loc_t *loc, unsigned prot_flags, bool pin_all_chunks)
             size_t chkcnt = oh->nchunks; /* Count of chunks (for sanity checking) */
 #endif                                   /* NDEBUG */
 
+            /* Read all the chunks known so far with one vector read, when
+             *  requested, instead of a read for each chunk
+             */
+            if (H5F_OHDR_VECTOR_READ(loc->file) && curr_msg == read_ahead_end &&
+                cont_msg_info.nmsgs - curr_msg > 1)
+                if (H5O__read_ahead_chunks(loc->file, &cont_msg_info, curr_msg, &read_ahead_end) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_READERROR, NULL, "unable to read object header chunks");
+
             /* Bring the chunk into the cache */
             /* (which adds to the object header) */
             chk_udata.common.addr = cont_msg_info.msgs[curr_msg].addr;
@@ -1071,6 +1132,10 @@ H5O_protect(const H5O_loc_t *loc, unsigned prot_flags, bool pin_all_chunks)
         /* Release any continuation messages built up */
         cont_msg_info.msgs = (H5O_cont_t *)H5FL_SEQ_FREE(H5O_cont_t, cont_msg_info.msgs);
 
+        /* Discard any chunk images read ahead and not used */
+        if (read_ahead_end > 0 && H5AC_discard_read_ahead(loc->file) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTFREE, NULL, "unable to discard object header chunk images");
+
         /* Pass back out some of the chunk's user data */
         udata.common.merged_null_msgs = chk_udata.common.merged_null_msgs;
     } /* end if */
@@ -1139,6 +1204,10 @@ done:
         if (cont_msg_info.msgs)
             cont_msg_info.msgs = (H5O_cont_t *)H5FL_SEQ_FREE(H5O_cont_t, cont_msg_info.msgs);
 
+        /* Discard any chunk images read ahead */
+        if (read_ahead_end > 0 && H5AC_discard_read_ahead(loc->file) < 0)
+            HDONE_ERROR(H5E_OHDR, H5E_CANTFREE, NULL, "unable to discard object header chunk images");
+
         /* Unprotect the ohdr and delete it from cache since if we failed to load it it's in an inconsistent
          * state */
         if (H5O_unprotect(loc, oh, H5AC__DELETED_FLAG) < 0)
@@ -206,6 +206,14 @@
  *      size to save the extra I/O operations) */
 #define H5O_SPEC_READ_SIZE 512
 
+/* The speculative read size is learned from the object headers read from
+ *      the file: it grows to the power of two covering the largest first
+ *      chunk seen, up to H5O_SPEC_READ_SIZE_MAX, and halves (down to
+ *      H5O_SPEC_READ_SIZE) after H5O_SPEC_READ_SHRINK_COUNT object headers
+ *      in a row whose first chunk fits in a quarter of it. */
+#define H5O_SPEC_READ_SIZE_MAX     (64 * 1024)
+#define H5O_SPEC_READ_SHRINK_COUNT 32
+
 /* The "message class" type */
 struct H5O_msg_class_t {
     unsigned    id;          /*message type ID on disk   */
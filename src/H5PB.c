@@ -30,6 +30,7 @@
 /* Headers */
 /***********/
 #include "H5private.h"   /* Generic Functions                */
+#include "H5CXprivate.h" /* API Contexts                     */
 #include "H5Eprivate.h"  /* Error handling                   */
 #include "H5Fpkg.h"      /* Files                            */
 #include "H5FDprivate.h" /* File drivers                     */
@@ -41,6 +42,10 @@
 /****************/
 /* Local Macros */
 /****************/
+
+/* Maximum # of dirty pages written back together when a dirty page is evicted */
+#define H5PB__WRITE_BATCH_SIZE 16
+
 #define H5PB__PREPEND(page_ptr, head_ptr, tail_ptr, len)                                                     \
     {                                                                                                        \
         if ((head_ptr) == NULL) {                                                                            \
@@ -109,12 +114,6 @@
 /* Local Typedefs */
 /******************/
 
-/* Iteration context for destroying page buffer */
-typedef struct {
-    H5PB_t *page_buf;
-    bool    actual_slist;
-} H5PB_ud1_t;
-
 /********************/
 /* Package Typedefs */
 /********************/
@@ -124,7 +123,12 @@ typedef struct {
 /********************/
 static herr_t H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry);
 static htri_t H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type);
-static herr_t H5PB__write_entry(H5F_shared_t *f_sh, H5PB_entry_t *page_entry);
+static herr_t H5PB__read_ahead(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t type, haddr_t miss_addr);
+static int    H5PB__entry_addr_cmp(const void *_entry1, const void *_entry2);
+static herr_t H5PB__write_entries(H5F_shared_t *f_sh, H5PB_entry_t **entries, size_t nentries);
+#ifdef H5_HAVE_PARALLEL
+static htri_t H5PB__mpi_raw_cacheable(const H5F_shared_t *f_sh);
+#endif /* H5_HAVE_PARALLEL */
 
 /*********************/
 /* Package Variables */
@@ -274,9 +278,11 @@ H5PB_print_stats(const H5PB_t *page_buf)
  *-------------------------------------------------------------------------
  */
 herr_t
-H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc)
+H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc,
+            unsigned page_buf_read_ahead)
 {
-    H5PB_t *page_buf  = NULL;
+    H5PB_t *page_buf = NULL;
+    size_t  max_pages;           /* Maximum # of pages in the page buffer */
     herr_t  ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -313,8 +319,20 @@ H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, un
     page_buf->min_meta_count = (unsigned)((size * page_buf_min_meta_perc) / (f_sh->fs_page_size * 100));
     page_buf->min_raw_count  = (unsigned)((size * page_buf_min_raw_perc) / (f_sh->fs_page_size * 100));
 
-    if (NULL == (page_buf->slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
-        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCREATE, FAIL, "can't create skip list");
+    page_buf->read_ahead   = page_buf_read_ahead;
+    page_buf->ra_next_addr = HADDR_UNDEF;
+
+    /* Size the page index so that, on average, there is at most one page per
+     * bucket when the page buffer is full.  Since the page buffer size is
+     * fixed, the index never needs to be resized.
+     */
+    max_pages            = size / page_buf->page_size;
+    page_buf->index_size = 1;
+    while (page_buf->index_size < max_pages)
+        page_buf->index_size *= 2;
+    if (NULL ==
+        (page_buf->index = (H5PB_entry_t **)H5MM_calloc(page_buf->index_size * sizeof(H5PB_entry_t *))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate page index");
     if (NULL == (page_buf->mf_slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
         HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCREATE, FAIL, "can't create skip list");
 
@@ -326,8 +344,8 @@ H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, un
 done:
     if (ret_value < 0) {
         if (page_buf != NULL) {
-            if (page_buf->slist_ptr != NULL)
-                H5SL_close(page_buf->slist_ptr);
+            if (page_buf->index != NULL)
+                H5MM_xfree(page_buf->index);
             if (page_buf->mf_slist_ptr != NULL)
                 H5SL_close(page_buf->mf_slist_ptr);
             if (page_buf->page_fac != NULL)
@@ -339,42 +357,14 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5PB_create */
 
-/*-------------------------------------------------------------------------
- * Function:    H5PB__flush_cb
- *
- * Purpose:     Callback to flush PB skiplist entries.
- *
- * Return:      Non-negative on success/Negative on failure
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5PB__flush_cb(void *item, void H5_ATTR_UNUSED *key, void *_op_data)
-{
-    H5PB_entry_t *page_entry = (H5PB_entry_t *)item; /* Pointer to page entry node */
-    H5F_shared_t *f_sh       = (H5F_shared_t *)_op_data;
-    herr_t        ret_value  = SUCCEED; /* Return value */
-
-    FUNC_ENTER_PACKAGE
-
-    /* Sanity checks */
-    assert(page_entry);
-    assert(f_sh);
-
-    /* Flush the page if it's dirty */
-    if (page_entry->is_dirty)
-        if (H5PB__write_entry(f_sh, page_entry) < 0)
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed");
-
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* H5PB__flush_cb() */
-
 /*-------------------------------------------------------------------------
  * Function:    H5PB_flush
  *
  * Purpose:     Flush/Free all the PB entries to the file.
  *
+ *              All the dirty pages are written with a single vector
+ *              write, in increasing address order.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
@@ -382,53 +372,60 @@ done:
 herr_t
 H5PB_flush(H5F_shared_t *f_sh)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
+    H5PB_entry_t **entries   = NULL;    /* Dirty pages to write */
+    herr_t         ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
     /* Sanity check */
     assert(f_sh);
 
-    /* Flush all the entries in the PB skiplist, if we have write access on the file */
+    /* Flush all the entries in the PB, if we have write access on the file */
     if (f_sh->page_buf && (H5F_ACC_RDWR & H5F_SHARED_INTENT(f_sh))) {
-        H5PB_t *page_buf = f_sh->page_buf;
+        H5PB_t       *page_buf = f_sh->page_buf;
+        H5PB_entry_t *page_entry;
+        size_t        nentries = 0;
+
+        /* Collect the dirty pages */
+        if (page_buf->LRU_list_len > 0) {
+            if (NULL ==
+                (entries = (H5PB_entry_t **)H5MM_malloc(page_buf->LRU_list_len * sizeof(H5PB_entry_t *))))
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate dirty page list");
+            for (page_entry = page_buf->LRU_head_ptr; page_entry; page_entry = page_entry->next)
+                if (page_entry->is_dirty)
+                    entries[nentries++] = page_entry;
+        } /* end if */
 
-        /* Iterate over all entries in page buffer skip list */
-        if (H5SL_iterate(page_buf->slist_ptr, H5PB__flush_cb, f_sh))
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_BADITER, FAIL, "can't flush page buffer skip list");
+        /* Write them */
+        if (nentries > 0)
+            if (H5PB__write_entries(f_sh, entries, nentries) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "can't flush page buffer");
     } /* end if */
 
 done:
+    H5MM_xfree(entries);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5PB_flush */
 
 /*-------------------------------------------------------------------------
  * Function:    H5PB__dest_cb
  *
- * Purpose:     Callback to free PB skiplist entries.
+ * Purpose:     Callback to free entries of the new page skip list.
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5PB__dest_cb(void *item, void H5_ATTR_UNUSED *key, void *_op_data)
+H5PB__dest_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *_op_data)
 {
     H5PB_entry_t *page_entry = (H5PB_entry_t *)item; /* Pointer to page entry node */
-    H5PB_ud1_t   *op_data    = (H5PB_ud1_t *)_op_data;
 
     FUNC_ENTER_PACKAGE_NOERR
 
     /* Sanity checking */
     assert(page_entry);
-    assert(op_data);
-    assert(op_data->page_buf);
-
-    /* Remove entry from LRU list */
-    if (op_data->actual_slist) {
-        H5PB__REMOVE_LRU(op_data->page_buf, page_entry)
-        page_entry->page_buf_ptr = H5FL_FAC_FREE(op_data->page_buf->page_fac, page_entry->page_buf_ptr);
-    } /* end if */
 
     /* Free page entry */
     page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
@@ -457,23 +454,24 @@ H5PB_dest(H5F_shared_t *f_sh)
 
     /* flush and destroy the page buffer, if it exists */
     if (f_sh->page_buf) {
-        H5PB_t    *page_buf = f_sh->page_buf;
-        H5PB_ud1_t op_data; /* Iteration context */
+        H5PB_t       *page_buf = f_sh->page_buf;
+        H5PB_entry_t *page_entry;
 
         if (H5PB_flush(f_sh) < 0)
             HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTFLUSH, FAIL, "can't flush page buffer");
 
-        /* Set up context info */
-        op_data.page_buf = page_buf;
-
-        /* Destroy the skip list containing all the entries in the PB */
-        op_data.actual_slist = true;
-        if (H5SL_destroy(page_buf->slist_ptr, H5PB__dest_cb, &op_data))
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCLOSEOBJ, FAIL, "can't destroy page buffer skip list");
+        /* Free all the entries in the PB */
+        while (NULL != (page_entry = page_buf->LRU_head_ptr)) {
+            H5PB__DELETE_FROM_INDEX(page_buf, page_entry);
+            H5PB__REMOVE_LRU(page_buf, page_entry)
+            page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
+            page_entry               = H5FL_FREE(H5PB_entry_t, page_entry);
+        } /* end while */
+        assert(0 == page_buf->index_len);
+        page_buf->index = (H5PB_entry_t **)H5MM_xfree(page_buf->index);
 
         /* Destroy the skip list containing the new entries */
-        op_data.actual_slist = false;
-        if (H5SL_destroy(page_buf->mf_slist_ptr, H5PB__dest_cb, &op_data))
+        if (H5SL_destroy(page_buf->mf_slist_ptr, H5PB__dest_cb, NULL))
             HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCLOSEOBJ, FAIL, "can't destroy page buffer skip list");
 
         /* Destroy the page factory */
@@ -573,7 +571,7 @@ H5PB_update_entry(H5PB_t *page_buf, haddr_t addr, size_t size, const void *buf)
     page_addr = (addr / page_buf->page_size) * page_buf->page_size;
 
     /* search for the page and update if found */
-    page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&page_addr));
+    H5PB__SEARCH_INDEX(page_buf, page_addr, page_entry);
     if (page_entry) {
         haddr_t offset;
 
@@ -604,29 +602,27 @@ H5PB_update_entry(H5PB_t *page_buf, haddr_t addr, size_t size, const void *buf)
 herr_t
 H5PB_remove_entry(const H5F_shared_t *f_sh, haddr_t addr)
 {
-    H5PB_t       *page_buf;             /* Page buffer to operate on */
-    H5PB_entry_t *page_entry = NULL;    /* Pointer to the page entry being searched */
-    herr_t        ret_value  = SUCCEED; /* Return value */
+    H5PB_t       *page_buf;          /* Page buffer to operate on */
+    H5PB_entry_t *page_entry = NULL; /* Pointer to the page entry being searched */
 
-    FUNC_ENTER_NOAPI(FAIL)
+    FUNC_ENTER_NOAPI_NOERR
 
     /* Sanity checks */
     assert(f_sh);
     page_buf = f_sh->page_buf;
     assert(page_buf);
 
-    /* Search for address in the skip list */
-    page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&addr));
+    /* Search for address in the page index */
+    H5PB__SEARCH_INDEX(page_buf, addr, page_entry);
 
     /* If found, remove the entry from the PB cache */
     if (page_entry) {
         assert(page_entry->type != H5F_MEM_PAGE_DRAW);
-        if (NULL == H5SL_remove(page_buf->slist_ptr, &(page_entry->addr)))
-            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Page Entry is not in skip list");
+        H5PB__DELETE_FROM_INDEX(page_buf, page_entry);
 
         /* Remove from LRU list */
         H5PB__REMOVE_LRU(page_buf, page_entry)
-        assert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
+        assert(page_buf->index_len == page_buf->LRU_list_len);
 
         page_buf->meta_count--;
 
@@ -634,8 +630,7 @@ H5PB_remove_entry(const H5F_shared_t *f_sh, haddr_t addr)
         page_entry               = H5FL_FREE(H5PB_entry_t, page_entry);
     } /* end if */
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
+    FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5PB_remove_entry */
 
 /*-------------------------------------------------------------------------
@@ -673,18 +668,15 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
     page_buf = f_sh->page_buf;
 
 #ifdef H5_HAVE_PARALLEL
-    if (H5F_SHARED_HAS_FEATURE(f_sh, H5FD_FEAT_HAS_MPI)) {
-#if 1
-        bypass_pb = true;
-#else
-        /* MSC - why this stopped working ? */
-        int mpi_size;
+    /* Raw data can only be buffered in parallel when no other process can
+     * change it behind this one's back
+     */
+    if (page_buf && H5FD_MEM_DRAW == type && H5F_SHARED_HAS_FEATURE(f_sh, H5FD_FEAT_HAS_MPI)) {
+        htri_t cacheable; /* Whether raw data may be buffered */
 
-        if ((mpi_size = H5F_shared_mpi_get_size(f_sh)) < 0)
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "can't retrieve MPI communicator size");
-        if (1 != mpi_size)
-            bypass_pb = true;
-#endif
+        if ((cacheable = H5PB__mpi_raw_cacheable(f_sh)) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "can't check if raw data may be buffered");
+        bypass_pb = !cacheable;
     } /* end if */
 #endif
 
@@ -749,32 +741,19 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
     /* Copy raw data from dirty pages into the read buffer if the read
        request spans pages in the page buffer*/
     if (H5FD_MEM_DRAW == type && size >= page_buf->page_size) {
-        H5SL_node_t *node;
-
         /* For each touched page in the page buffer, check if it
          * exists in the page Buffer and is dirty. If it does, we
          * update the buffer with what's in the page so we get the up
          * to date data into the buffer after the big read from the file.
          */
-        node = H5SL_find(page_buf->slist_ptr, (void *)(&first_page_addr));
         for (i = 0; i < num_touched_pages; i++) {
             search_addr = i * page_buf->page_size + first_page_addr;
 
-            /* if we still haven't located a starting page, search again */
-            if (!node && i != 0)
-                node = H5SL_find(page_buf->slist_ptr, (void *)(&search_addr));
+            /* Lookup the page in the page index */
+            H5PB__SEARCH_INDEX(page_buf, search_addr, page_entry);
 
             /* if the current page is in the Page Buffer, do the updates */
-            if (node) {
-                page_entry = (H5PB_entry_t *)H5SL_item(node);
-
-                assert(page_entry);
-
-                /* If the current page address falls out of the access
-                   block, then there are no more pages to go over */
-                if (page_entry->addr >= addr + size)
-                    break;
-
+            if (page_entry) {
                 assert(page_entry->addr == search_addr);
 
                 if (page_entry->is_dirty) {
@@ -809,10 +788,9 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                                     page_buf->page_size);
                     } /* end else */
                 }     /* end if */
-                node = H5SL_next(node);
-            } /* end if */
-        }     /* end for */
-    }         /* end if */
+            }         /* end if */
+        }             /* end for */
+    }                 /* end if */
     else {
         /* A raw data access could span 1 or 2 PB entries at this point so
            we need to handle that */
@@ -820,7 +798,7 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
         for (i = 0; i < num_touched_pages; i++) {
             haddr_t buf_offset;
 
-            /* Calculate the aligned address of the page to search for it in the skip list */
+            /* Calculate the aligned address of the page to search for it in the page index */
             search_addr = (0 == i ? first_page_addr : last_page_addr);
 
             /* Calculate the access size if the access spans more than 1 page */
@@ -830,8 +808,8 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                 access_size = (0 == i ? (size_t)((first_page_addr + page_buf->page_size) - addr)
                                       : (size - access_size));
 
-            /* Lookup the page in the skip list */
-            page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&search_addr));
+            /* Lookup the page in the page index */
+            H5PB__SEARCH_INDEX(page_buf, search_addr, page_entry);
 
             /* if found */
             if (page_entry) {
@@ -862,7 +840,7 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                 haddr_t eoa;
 
                 /* make space for new entry */
-                if ((H5SL_count(page_buf->slist_ptr) * page_buf->page_size) >= page_buf->max_size) {
+                if ((page_buf->index_len * page_buf->page_size) >= page_buf->max_size) {
                     htri_t can_make_space;
 
                     /* check if we can make space in page buffer */
@@ -937,6 +915,20 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                     page_buf->misses[1]++;
                 else
                     page_buf->misses[0]++;
+
+                /* Read ahead if this metadata page miss continues a scan
+                 * over consecutive pages, otherwise start tracking a new one
+                 */
+                if (H5FD_MEM_DRAW != type) {
+                    if (page_buf->read_ahead > 0 && !H5F_SHARED_HAS_FEATURE(f_sh, H5FD_FEAT_HAS_MPI) &&
+                        !H5F_SHARED_HAS_FEATURE(f_sh, H5FD_FEAT_PAGED_AGGR) &&
+                        H5_addr_eq(search_addr, page_buf->ra_next_addr)) {
+                        if (H5PB__read_ahead(f_sh, page_buf, type, search_addr) < 0)
+                            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "page buffer read-ahead failed");
+                    } /* end if */
+                    else
+                        page_buf->ra_next_addr = search_addr + page_buf->page_size;
+                } /* end if */
             } /* end else */
         }     /* end for */
     }         /* end else */
@@ -1071,8 +1063,8 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
 
             /* Special handling for the first page if it is not a full page update */
             if (i == 0 && first_page_addr != addr) {
-                /* Lookup the page in the skip list */
-                page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&search_addr));
+                /* Lookup the page in the page index */
+                H5PB__SEARCH_INDEX(page_buf, search_addr, page_entry);
                 if (page_entry) {
                     offset = addr - first_page_addr;
                     assert(page_buf->page_size > offset);
@@ -1091,8 +1083,8 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                      (search_addr + page_buf->page_size) != (addr + size)) {
                 assert(search_addr + page_buf->page_size > addr + size);
 
-                /* Lookup the page in the skip list */
-                page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&search_addr));
+                /* Lookup the page in the page index */
+                H5PB__SEARCH_INDEX(page_buf, search_addr, page_entry);
                 if (page_entry) {
                     offset = (num_touched_pages - 2) * page_buf->page_size +
                              (page_buf->page_size - (addr - first_page_addr));
@@ -1108,9 +1100,10 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
             }     /* end else-if */
             /* Discard all fully written pages from the page buffer */
             else {
-                page_entry = (H5PB_entry_t *)H5SL_remove(page_buf->slist_ptr, (void *)(&search_addr));
+                H5PB__SEARCH_INDEX(page_buf, search_addr, page_entry);
                 if (page_entry) {
-                    /* Remove from LRU list */
+                    /* Remove from page index and LRU list */
+                    H5PB__DELETE_FROM_INDEX(page_buf, page_entry);
                     H5PB__REMOVE_LRU(page_buf, page_entry)
 
                     /* Decrement page count of appropriate type */
@@ -1132,7 +1125,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
         for (i = 0; i < num_touched_pages; i++) {
             haddr_t buf_offset;
 
-            /* Calculate the aligned address of the page to search for it in the skip list */
+            /* Calculate the aligned address of the page to search for it in the page index */
             search_addr = (0 == i ? first_page_addr : last_page_addr);
 
             /* Calculate the access size if the access spans more than 1 page */
@@ -1142,8 +1135,8 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                 access_size =
                     (0 == i ? (size_t)(first_page_addr + page_buf->page_size - addr) : (size - access_size));
 
-            /* Lookup the page in the skip list */
-            page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&search_addr));
+            /* Lookup the page in the page index */
+            H5PB__SEARCH_INDEX(page_buf, search_addr, page_entry);
 
             /* If found */
             if (page_entry) {
@@ -1170,7 +1163,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                 size_t page_size = page_buf->page_size;
 
                 /* Make space for new entry */
-                if ((H5SL_count(page_buf->slist_ptr) * page_buf->page_size) >= page_buf->max_size) {
+                if ((page_buf->index_len * page_buf->page_size) >= page_buf->max_size) {
                     htri_t can_make_space;
 
                     /* Check if we can make space in page buffer */
@@ -1305,7 +1298,11 @@ H5PB_enabled(H5F_shared_t *f_sh, H5FD_mem_t type, bool *enabled)
     bool    bypass_pb = false;   /* Whether to bypass page buffering */
     herr_t  ret_value = SUCCEED; /* Return value */
 
+#ifdef H5_HAVE_PARALLEL
+    FUNC_ENTER_NOAPI(FAIL)
+#else
     FUNC_ENTER_NOAPI_NOERR
+#endif
 
     /* Sanity checks */
     assert(f_sh);
@@ -1314,23 +1311,21 @@ H5PB_enabled(H5F_shared_t *f_sh, H5FD_mem_t type, bool *enabled)
     page_buf = f_sh->page_buf;
 
 #ifdef H5_HAVE_PARALLEL
-    if (H5F_SHARED_HAS_FEATURE(f_sh, H5FD_FEAT_HAS_MPI)) {
-#if 1
-        bypass_pb = true;
-#else
-        /* MSC - why this stopped working ? */
-        int mpi_size;
+    /* Raw data can only be buffered in parallel when no other process can
+     * change it behind this one's back
+     */
+    if (page_buf && H5FD_MEM_DRAW == type && H5F_SHARED_HAS_FEATURE(f_sh, H5FD_FEAT_HAS_MPI)) {
+        htri_t cacheable; /* Whether raw data may be buffered */
 
-        if ((mpi_size = H5F_shared_mpi_get_size(f_sh)) < 0)
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "can't retrieve MPI communicator size");
-        if (1 != mpi_size)
-            bypass_pb = true;
-#endif
+        if ((cacheable = H5PB__mpi_raw_cacheable(f_sh)) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "can't check if raw data may be buffered");
+        bypass_pb = !cacheable;
     } /* end if */
 #endif
 
-    /* If page buffering is disabled, or if this is a parallel raw data access,
-     * bypass page buffering. Note that page buffering may still be disabled for
+    /* If page buffering is disabled, or if this is a parallel raw data access
+     * that can't be buffered, bypass page buffering. Note that page buffering
+     * may still be disabled for
      * large metadata access or large non-parallel raw data access, but this
      * function doesn't take I/O size into account so if it returns true the
      * page buffer may still be disabled for some I/O. If it returns false it is
@@ -1352,9 +1347,196 @@ H5PB_enabled(H5F_shared_t *f_sh, H5FD_mem_t type, bool *enabled)
         /* Page buffer may be enabled */
         *enabled = true;
 
+#ifdef H5_HAVE_PARALLEL
+done:
+#endif
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PB_enabled() */
 
+#ifdef H5_HAVE_PARALLEL
+/*-------------------------------------------------------------------------
+ * Function:    H5PB_coll_read_enabled
+ *
+ * Purpose:     Check if a collective metadata read of SIZE bytes at ADDR
+ *              can be satisfied with H5PB_coll_read().
+ *
+ *              This is the case when the file has a page buffer and the
+ *              read is a metadata access that fits in a single page.  The
+ *              answer only depends on state that is identical on all
+ *              processes, so they all take the same path.
+ *
+ * Return:      true/false
+ *
+ *-------------------------------------------------------------------------
+ */
+bool
+H5PB_coll_read_enabled(const H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size)
+{
+    const H5PB_t *page_buf;          /* Page buffering info for this file */
+    bool          ret_value = false; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOERR
+
+    /* Sanity checks */
+    assert(f_sh);
+
+    page_buf = f_sh->page_buf;
+    if (page_buf && H5FD_MEM_DRAW != type && H5FD_MEM_GHEAP != type && size > 0 &&
+        size < page_buf->page_size && H5_addr_defined(addr))
+        ret_value = (addr / page_buf->page_size) == ((addr + size - 1) / page_buf->page_size);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_coll_read_enabled() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB_coll_read
+ *
+ * Purpose:     Collectively read SIZE bytes of metadata at ADDR through
+ *              the page buffers of all processes in the file's
+ *              communicator.
+ *
+ *              Process 0 is the only one to read the page containing the
+ *              data from the file, and only if it isn't in its own page
+ *              buffer.  It then broadcasts the whole page, which every
+ *              process stores in its page buffer before copying out the
+ *              requested bytes.  Later metadata loads from the same page,
+ *              collective or not, are then satisfied locally on every
+ *              process instead of each one going to the file system.
+ *
+ *              Must be called by all processes in the communicator, and
+ *              only when H5PB_coll_read_enabled() is true for the read.
+ *              As with the collective metadata reads of the metadata
+ *              cache, a read failure on process 0 still takes part in
+ *              the broadcast, with a zeroed page.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_coll_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *buf /*out*/)
+{
+    H5PB_t       *page_buf;                  /* Page buffering info for this file */
+    H5PB_entry_t *page_entry   = NULL;       /* Pointer to the corresponding page entry */
+    void         *new_page_buf = NULL;       /* Buffer for a page that missed */
+    uint8_t      *page_image;                /* Page image broadcast from process 0 */
+    haddr_t       page_addr;                 /* Address of the page */
+    bool          insert_page = false;       /* Whether to insert the page that missed */
+    MPI_Comm      comm;                      /* File communicator */
+    int           mpi_rank;                  /* This process's rank */
+    int           buf_size;                  /* Page size, as an MPI count */
+    int           mpi_code;                  /* MPI return code */
+    herr_t        ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    assert(f_sh);
+    assert(buf);
+    assert(H5PB_coll_read_enabled(f_sh, type, addr, size));
+
+    /* Check for attempting I/O on 'temporary' file address */
+    if (H5_addr_le(f_sh->tmp_addr, (addr + size)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space");
+
+    page_buf = f_sh->page_buf;
+    if ((mpi_rank = H5FD_mpi_get_rank(f_sh->lf)) < 0)
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "can't get MPI rank");
+    if (MPI_COMM_NULL == (comm = H5FD_mpi_get_comm(f_sh->lf)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "can't get MPI communicator");
+    H5_CHECKED_ASSIGN(buf_size, int, page_buf->page_size, size_t);
+
+    /* Update statistics */
+    page_buf->accesses[0]++;
+
+    /* Calculate the aligned address of the page */
+    page_addr = (addr / page_buf->page_size) * page_buf->page_size;
+
+    /* Lookup the page in the page index */
+    H5PB__SEARCH_INDEX(page_buf, page_addr, page_entry);
+    if (page_entry) {
+        page_image = (uint8_t *)page_entry->page_buf_ptr;
+
+        /* Update statistics */
+        page_buf->hits[0]++;
+    } /* end if */
+    else {
+        /* Make space for the new page, if needed.  If that fails, the page
+         * is still received, but not kept.
+         */
+        insert_page = true;
+        if ((page_buf->index_len * page_buf->page_size) >= page_buf->max_size) {
+            htri_t can_make_space;
+
+            if ((can_make_space = H5PB__make_space(f_sh, page_buf, type)) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "make space in Page buffer Failed");
+            insert_page = (bool)can_make_space;
+        } /* end if */
+
+        if (NULL == (new_page_buf = H5FL_FAC_MALLOC(page_buf->page_fac)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for page buffer entry");
+        page_image = (uint8_t *)new_page_buf;
+
+        /* Process 0 reads the page from the file */
+        if (0 == mpi_rank) {
+            size_t  page_size = page_buf->page_size;
+            haddr_t eoa;
+
+            /* Don't read beyond the EOA, and zero the rest of the page */
+            if (HADDR_UNDEF == (eoa = H5F_shared_get_eoa(f_sh, type)))
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed");
+            if (page_addr + page_size > eoa)
+                page_size = (size_t)(eoa - page_addr);
+            if (page_size < page_buf->page_size)
+                memset(page_image + page_size, 0, page_buf->page_size - page_size);
+
+            if (H5FD_read(f_sh->lf, type, page_addr, page_size, page_image) < 0) {
+                /* Push an error, but still participate in following MPI_Bcast */
+                memset(page_image, 0, page_buf->page_size);
+                insert_page = false;
+                HDONE_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed");
+            } /* end if */
+        }     /* end if */
+
+        /* Update statistics */
+        page_buf->misses[0]++;
+    } /* end else */
+
+    /* Distribute process 0's copy of the page */
+    if (MPI_SUCCESS != (mpi_code = MPI_Bcast(page_image, buf_size, MPI_BYTE, 0, comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+
+    /* Copy the requested data from the page into the output buffer */
+    H5MM_memcpy(buf, page_image + (addr - page_addr), size);
+
+    if (page_entry)
+        /* Update LRU */
+        H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+    else if (insert_page) {
+        /* Create the new PB entry */
+        if (NULL == (page_entry = H5FL_CALLOC(H5PB_entry_t)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "memory allocation failed");
+
+        page_entry->page_buf_ptr = new_page_buf;
+        page_entry->addr         = page_addr;
+        page_entry->type         = (H5F_mem_page_t)type;
+        page_entry->is_dirty     = false;
+        new_page_buf             = NULL;
+
+        /* Insert page into PB */
+        if (H5PB__insert_entry(page_buf, page_entry) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTSET, FAIL, "error inserting new page in page buffer");
+    } /* end else-if */
+
+done:
+    /* Release a page that wasn't kept */
+    if (new_page_buf)
+        new_page_buf = H5FL_FAC_FREE(page_buf->page_fac, new_page_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_coll_read() */
+#endif /* H5_HAVE_PARALLEL */
+
 /*-------------------------------------------------------------------------
  * Function:    H5PB__insert_entry()
  *
@@ -1362,7 +1544,7 @@ H5PB_enabled(H5F_shared_t *f_sh, H5FD_mem_t type, bool *enabled)
  *              What follows is my best understanding of Mohamad's intent.
  *
  *              Insert the supplied page into the page buffer, both the
- *              skip list and the LRU.
+ *              page index and the LRU.
  *
  *              As best I can tell, this function imposes no limit on the
  *              number of entries in the page buffer beyond an assertion
@@ -1378,14 +1560,11 @@ H5PB_enabled(H5F_shared_t *f_sh, H5FD_mem_t type, bool *enabled)
 static herr_t
 H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
-
-    FUNC_ENTER_PACKAGE
+    FUNC_ENTER_PACKAGE_NOERR
 
-    /* Insert entry in skip list */
-    if (H5SL_insert(page_buf->slist_ptr, page_entry, &(page_entry->addr)) < 0)
-        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINSERT, FAIL, "can't insert entry in skip list");
-    assert(H5SL_count(page_buf->slist_ptr) * page_buf->page_size <= page_buf->max_size);
+    /* Insert entry in page index */
+    H5PB__INSERT_IN_INDEX(page_buf, page_entry);
+    assert(page_buf->index_len * page_buf->page_size <= page_buf->max_size);
 
     /* Increment appropriate page count */
     if (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
@@ -1396,8 +1575,7 @@ H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry)
     /* Insert entry in LRU */
     H5PB__INSERT_LRU(page_buf, page_entry)
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
+    FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5PB__insert_entry() */
 
 /*-------------------------------------------------------------------------
@@ -1468,13 +1646,31 @@ H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
         } /* end while */
     }     /* end else */
 
+    /* Flush page if dirty.  Other dirty pages close to eviction are
+     * written back along with it, so that a run of dirty evictions costs
+     * a single vector write instead of one write per page.
+     */
+    if (page_entry->is_dirty) {
+        H5PB_entry_t *batch[H5PB__WRITE_BATCH_SIZE]; /* Dirty pages to write */
+        H5PB_entry_t *dirty_entry;
+        size_t        nbatch = 0;
+
+        batch[nbatch++] = page_entry;
+        for (dirty_entry = page_buf->LRU_tail_ptr; dirty_entry && nbatch < H5PB__WRITE_BATCH_SIZE;
+             dirty_entry = dirty_entry->prev)
+            if (dirty_entry->is_dirty && dirty_entry != page_entry)
+                batch[nbatch++] = dirty_entry;
+
+        if (H5PB__write_entries(f_sh, batch, nbatch) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed");
+    } /* end if */
+
     /* Remove from page index */
-    if (NULL == H5SL_remove(page_buf->slist_ptr, &(page_entry->addr)))
-        HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "Tail Page Entry is not in skip list");
+    H5PB__DELETE_FROM_INDEX(page_buf, page_entry);
 
     /* Remove entry from LRU list */
     H5PB__REMOVE_LRU(page_buf, page_entry)
-    assert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
+    assert(page_buf->index_len == page_buf->LRU_list_len);
 
     /* Decrement appropriate page type counter */
     if (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
@@ -1482,11 +1678,6 @@ H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
     else
         page_buf->meta_count--;
 
-    /* Flush page if dirty */
-    if (page_entry->is_dirty)
-        if (H5PB__write_entry(f_sh, page_entry) < 0)
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed");
-
     /* Update statistics */
     if (page_entry->type == H5F_MEM_PAGE_DRAW || H5F_MEM_PAGE_GHEAP == page_entry->type)
         page_buf->evictions[1]++;
@@ -1502,54 +1693,296 @@ done:
 } /* end H5PB__make_space() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5PB__write_entry()
+ * Function:    H5PB__read_ahead()
  *
- * Purpose:     ???
+ * Purpose:     Read the pages following the metadata page at MISS_ADDR,
+ *              which was just read in after a sequential page miss, into
+ *              the page buffer.
  *
- *              This function was created without documentation.
- *              What follows is my best understanding of Mohamad's intent.
+ *              Up to read_ahead pages that aren't already in the page
+ *              buffer are read with a single vector read and inserted as
+ *              clean pages.  Pages beyond the EOA and new pages from the
+ *              MF layer, which have no data in the file yet, are skipped.
+ *              Read-ahead stops early if space can't be made for a page,
+ *              and never takes more room than would evict the page that
+ *              missed.
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5PB__write_entry(H5F_shared_t *f_sh, H5PB_entry_t *page_entry)
+H5PB__read_ahead(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t type, haddr_t miss_addr)
 {
-    haddr_t eoa;                 /* Current EOA for the file */
-    herr_t  ret_value = SUCCEED; /* Return value */
+    H5PB_entry_t *page_entry = NULL;   /* Pointer to the page entry being created */
+    H5FD_mem_t   *types      = NULL;   /* Memory types of the pages to read */
+    haddr_t      *addrs      = NULL;   /* Addresses of the pages to read */
+    size_t       *sizes      = NULL;   /* Sizes of the pages to read */
+    void        **bufs       = NULL;   /* Buffers for the pages to read */
+    uint32_t      count      = 0;      /* # of pages to read */
+    uint32_t      ninserted  = 0;      /* # of pages inserted in the page buffer */
+    size_t        max_pages;           /* Maximum # of pages to read ahead */
+    haddr_t       page_addr;           /* Address of the current page */
+    haddr_t       eoa;                 /* Current EOA for the file */
+    size_t        u;                   /* Local index variable */
+    herr_t        ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
-    /* Sanity check */
+    /* Sanity checks */
     assert(f_sh);
-    assert(page_entry);
+    assert(page_buf);
+    assert(page_buf->read_ahead > 0);
+    assert(H5FD_MEM_DRAW != type);
+
+    /* Leave room for the page that missed */
+    max_pages = page_buf->max_size / page_buf->page_size - 1;
+    if (max_pages > page_buf->read_ahead)
+        max_pages = page_buf->read_ahead;
 
     /* Retrieve the 'eoa' for the file */
-    if (HADDR_UNDEF == (eoa = H5F_shared_get_eoa(f_sh, (H5FD_mem_t)page_entry->type)))
+    if (HADDR_UNDEF == (eoa = H5F_shared_get_eoa(f_sh, type)))
         HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed");
 
-    /* If the starting address of the page is larger than
-     * the EOA, then the entire page is discarded without writing.
-     */
-    if (page_entry->addr <= eoa) {
-        H5FD_t *file; /* File driver I/O info */
-        size_t  page_size = f_sh->page_buf->page_size;
+    if (max_pages > 0) {
+        if (NULL == (types = (H5FD_mem_t *)H5MM_malloc(max_pages * sizeof(H5FD_mem_t))))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate read-ahead types");
+        if (NULL == (addrs = (haddr_t *)H5MM_malloc(max_pages * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate read-ahead addresses");
+        if (NULL == (sizes = (size_t *)H5MM_malloc(max_pages * sizeof(size_t))))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate read-ahead sizes");
+        if (NULL == (bufs = (void **)H5MM_malloc(max_pages * sizeof(void *))))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate read-ahead buffers");
+    } /* end if */
 
-        /* Adjust the page length if it exceeds the EOA */
-        if ((page_entry->addr + page_size) > eoa)
-            page_size = (size_t)(eoa - page_entry->addr);
+    /* Select the pages to read */
+    page_addr = miss_addr + page_buf->page_size;
+    for (u = 0; u < max_pages && H5_addr_lt(page_addr, eoa); u++, page_addr += page_buf->page_size) {
+        /* Skip pages already in the page buffer, or that are new pages */
+        H5PB__SEARCH_INDEX(page_buf, page_addr, page_entry);
+        if (page_entry || H5SL_search(page_buf->mf_slist_ptr, &page_addr))
+            continue;
 
-        /* Translate to file driver I/O info object */
-        file = f_sh->lf;
+        /* Make space for the page, if needed */
+        if ((page_buf->index_len + count) * page_buf->page_size >= page_buf->max_size) {
+            htri_t can_make_space;
 
-        if (H5FD_write(file, (H5FD_mem_t)page_entry->type, page_entry->addr, page_size,
-                       page_entry->page_buf_ptr) < 0)
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed");
-    } /* end if */
+            /* Raw data pages at their minimum can't be evicted for metadata */
+            if (0 == page_buf->meta_count && page_buf->min_raw_count == page_buf->raw_count)
+                break;
+
+            if ((can_make_space = H5PB__make_space(f_sh, page_buf, type)) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "make space in Page buffer Failed");
+            if (0 == can_make_space)
+                break;
+        } /* end if */
+
+        if (NULL == (bufs[count] = H5FL_FAC_MALLOC(page_buf->page_fac)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for page buffer entry");
+        types[count] = type;
+        addrs[count] = page_addr;
+        sizes[count] = (page_addr + page_buf->page_size > eoa) ? (size_t)(eoa - page_addr)
+                                                               : page_buf->page_size;
+        count++;
+    } /* end for */
+
+    /* A miss at the page following the read-ahead window continues the scan */
+    page_buf->ra_next_addr = page_addr;
+
+    if (count > 0) {
+        /* Read the pages */
+        if (H5FD_read_vector(f_sh->lf, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver vector read request failed");
+
+        /* Insert them into the page buffer */
+        for (ninserted = 0; ninserted < count; ninserted++) {
+            if (NULL == (page_entry = H5FL_CALLOC(H5PB_entry_t)))
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "memory allocation failed");
+
+            page_entry->page_buf_ptr = bufs[ninserted];
+            page_entry->addr         = addrs[ninserted];
+            page_entry->type         = (H5F_mem_page_t)type;
+            page_entry->is_dirty     = false;
+
+            if (H5PB__insert_entry(page_buf, page_entry) < 0) {
+                page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTSET, FAIL, "error inserting new page in page buffer");
+            } /* end if */
+        }     /* end for */
+    }         /* end if */
+
+done:
+    /* Release the buffers of pages that didn't make it into the page buffer */
+    if (ret_value < 0)
+        for (u = ninserted; u < count; u++)
+            bufs[u] = H5FL_FAC_FREE(page_buf->page_fac, bufs[u]);
+
+    H5MM_xfree(types);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__read_ahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__entry_addr_cmp
+ *
+ * Purpose:     Comparison callback for qsort(3) on page entry pointers.
+ *              Entries are sorted by increasing address.
+ *
+ * Return:      An integer less than, equal to, or greater than zero if the
+ *              first entry is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5PB__entry_addr_cmp(const void *_entry1, const void *_entry2)
+{
+    const H5PB_entry_t *entry1    = *(const H5PB_entry_t *const *)_entry1; /* First page entry */
+    const H5PB_entry_t *entry2    = *(const H5PB_entry_t *const *)_entry2; /* Second page entry */
+    int                 ret_value = 0;                                      /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    assert(entry1);
+    assert(entry2);
+
+    if (H5_addr_lt(entry1->addr, entry2->addr))
+        ret_value = -1;
+    else if (H5_addr_gt(entry1->addr, entry2->addr))
+        ret_value = 1;
 
-    page_entry->is_dirty = false;
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__entry_addr_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__write_entries()
+ *
+ * Purpose:     Write the supplied dirty pages to the file with a single
+ *              vector write, and mark them clean.
+ *
+ *              The ENTRIES array is sorted by page address, so the VFD
+ *              sees the pages in file order.  Pages that start at or
+ *              beyond the EOA are discarded without writing, and the
+ *              page that spans the EOA is truncated at it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__write_entries(H5F_shared_t *f_sh, H5PB_entry_t **entries, size_t nentries)
+{
+    H5FD_mem_t  *types = NULL;        /* Memory types of the pages to write */
+    haddr_t     *addrs = NULL;        /* Addresses of the pages to write */
+    size_t      *sizes = NULL;        /* Sizes of the pages to write */
+    const void **bufs  = NULL;        /* Buffers of the pages to write */
+    uint32_t     count = 0;           /* # of pages to write */
+    size_t       u;                   /* Local index variable */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(f_sh);
+    assert(f_sh->page_buf);
+    assert(entries);
+    assert(nentries > 0);
+
+    /* Write the pages in increasing address order */
+    qsort(entries, nentries, sizeof(H5PB_entry_t *), H5PB__entry_addr_cmp);
+
+    if (NULL == (types = (H5FD_mem_t *)H5MM_malloc(nentries * sizeof(H5FD_mem_t))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate write-back types");
+    if (NULL == (addrs = (haddr_t *)H5MM_malloc(nentries * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate write-back addresses");
+    if (NULL == (sizes = (size_t *)H5MM_malloc(nentries * sizeof(size_t))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate write-back sizes");
+    if (NULL == (bufs = (const void **)H5MM_malloc(nentries * sizeof(void *))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate write-back buffers");
+
+    for (u = 0; u < nentries; u++) {
+        H5PB_entry_t *page_entry = entries[u];
+        haddr_t       eoa; /* Current EOA for the file */
+
+        assert(page_entry->is_dirty);
+
+        /* Retrieve the 'eoa' for the file */
+        if (HADDR_UNDEF == (eoa = H5F_shared_get_eoa(f_sh, (H5FD_mem_t)page_entry->type)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed");
+
+        /* If the starting address of the page is at or beyond the EOA,
+         * then the entire page is discarded without writing.
+         */
+        if (H5_addr_lt(page_entry->addr, eoa)) {
+            size_t page_size = f_sh->page_buf->page_size;
+
+            /* Adjust the page length if it exceeds the EOA */
+            if ((page_entry->addr + page_size) > eoa)
+                page_size = (size_t)(eoa - page_entry->addr);
+
+            types[count] = (H5FD_mem_t)page_entry->type;
+            addrs[count] = page_entry->addr;
+            sizes[count] = page_size;
+            bufs[count]  = page_entry->page_buf_ptr;
+            count++;
+        } /* end if */
+    }     /* end for */
+
+    if (count > 0)
+        if (H5FD_write_vector(f_sh->lf, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file vector write failed");
+
+    for (u = 0; u < nentries; u++)
+        entries[u]->is_dirty = false;
+
+done:
+    H5MM_xfree(types);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__write_entries() */
+
+#ifdef H5_HAVE_PARALLEL
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__mpi_raw_cacheable
+ *
+ * Purpose:     Check if raw data of a file opened with an MPI-based VFD
+ *              may be kept in the page buffer.
+ *
+ *              Raw data pages can't be kept coherent across processes
+ *              that write to the file, and collective raw data I/O goes
+ *              through MPI derived datatypes that the page buffer can't
+ *              service.  Raw data is only buffered when the file is
+ *              opened read-only and the transfer mode is independent.
+ *
+ * Return:      true/false/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5PB__mpi_raw_cacheable(const H5F_shared_t *f_sh)
+{
+    H5FD_mpio_xfer_t xfer_mode;         /* Parallel transfer mode */
+    htri_t           ret_value = false; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(f_sh);
+
+    if (0 == (H5F_SHARED_INTENT(f_sh) & H5F_ACC_RDWR)) {
+        if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode");
+        ret_value = (H5FD_MPIO_INDEPENDENT == xfer_mode);
+    } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5PB__write_entry() */
+} /* end H5PB__mpi_raw_cacheable() */
+#endif /* H5_HAVE_PARALLEL */
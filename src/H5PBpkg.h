@@ -26,6 +26,50 @@
 /* Package Private Macros */
 /**************************/
 
+/* Hash function for the page index.  Page addresses are multiples of the
+ * page size, so consecutive pages fall into consecutive buckets.
+ */
+#define H5PB__HASH_FCN(page_buf, page_addr)                                                                  \
+    ((size_t)((page_addr) / (page_buf)->page_size) & ((page_buf)->index_size - 1))
+
+#define H5PB__SEARCH_INDEX(page_buf, page_addr, entry_ptr)                                                   \
+    do {                                                                                                     \
+        (entry_ptr) = (page_buf)->index[H5PB__HASH_FCN(page_buf, page_addr)];                                \
+        while ((entry_ptr) && !H5_addr_eq((entry_ptr)->addr, (page_addr)))                                   \
+            (entry_ptr) = (entry_ptr)->ht_next;                                                              \
+    } while (0)
+
+#define H5PB__INSERT_IN_INDEX(page_buf, entry_ptr)                                                           \
+    do {                                                                                                     \
+        size_t k = H5PB__HASH_FCN(page_buf, (entry_ptr)->addr);                                              \
+                                                                                                             \
+        assert((entry_ptr)->ht_next == NULL);                                                                \
+        assert((entry_ptr)->ht_prev == NULL);                                                                \
+        if ((page_buf)->index[k] != NULL)                                                                    \
+            (page_buf)->index[k]->ht_prev = (entry_ptr);                                                     \
+        (entry_ptr)->ht_next = (page_buf)->index[k];                                                         \
+        (page_buf)->index[k] = (entry_ptr);                                                                  \
+        (page_buf)->index_len++;                                                                             \
+    } while (0)
+
+#define H5PB__DELETE_FROM_INDEX(page_buf, entry_ptr)                                                         \
+    do {                                                                                                     \
+        size_t k = H5PB__HASH_FCN(page_buf, (entry_ptr)->addr);                                              \
+                                                                                                             \
+        assert((page_buf)->index_len > 0);                                                                   \
+        if ((entry_ptr)->ht_next)                                                                            \
+            (entry_ptr)->ht_next->ht_prev = (entry_ptr)->ht_prev;                                            \
+        if ((entry_ptr)->ht_prev)                                                                            \
+            (entry_ptr)->ht_prev->ht_next = (entry_ptr)->ht_next;                                            \
+        else {                                                                                               \
+            assert((page_buf)->index[k] == (entry_ptr));                                                     \
+            (page_buf)->index[k] = (entry_ptr)->ht_next;                                                     \
+        }                                                                                                    \
+        (entry_ptr)->ht_next = NULL;                                                                         \
+        (entry_ptr)->ht_prev = NULL;                                                                         \
+        (page_buf)->index_len--;                                                                             \
+    } while (0)
+
 /****************************/
 /* Package Private Typedefs */
 /****************************/
@@ -36,6 +80,10 @@ typedef struct H5PB_entry_t {
     H5F_mem_page_t type;         /* Type of the page entry (H5F_MEM_PAGE_RAW/META) */
     bool           is_dirty;     /* Flag indicating whether the page has dirty data or not */
 
+    /* Fields supporting the hash table index */
+    struct H5PB_entry_t *ht_next; /* next pointer in the hash bucket */
+    struct H5PB_entry_t *ht_prev; /* previous pointer in the hash bucket */
+
     /* Fields supporting replacement policies */
     struct H5PB_entry_t *next; /* next pointer in the LRU list */
     struct H5PB_entry_t *prev; /* previous pointer in the LRU list */
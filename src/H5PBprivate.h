@@ -48,10 +48,15 @@ typedef struct H5PB_t {
     unsigned min_meta_count; /* Minimum # of entries for metadata */
     unsigned min_raw_count;  /* Minimum # of entries for raw data */
 
-    H5SL_t *slist_ptr;    /* Skip list with all the active page entries */
+    unsigned read_ahead;     /* Maximum # of pages read ahead on a sequential metadata page miss */
+    haddr_t  ra_next_addr;   /* Address of the page following the last metadata pages read from the file */
+
+    struct H5PB_entry_t **index;      /* Hash table with all the active page entries */
+    size_t                index_size; /* Number of buckets in the hash table (a power of two) */
+    size_t                index_len;  /* Number of entries in the hash table */
     H5SL_t *mf_slist_ptr; /* Skip list containing newly allocated page entries inserted from the MF layer */
 
-    size_t               LRU_list_len; /* Number of entries in the LRU (identical to slist_ptr count) */
+    size_t               LRU_list_len; /* Number of entries in the LRU (identical to index_len) */
     struct H5PB_entry_t *LRU_head_ptr; /* Head pointer of the LRU */
     struct H5PB_entry_t *LRU_tail_ptr; /* Tail pointer of the LRU */
 
@@ -75,7 +80,7 @@ typedef struct H5PB_t {
 
 /* General routines */
 H5_DLL herr_t H5PB_create(H5F_shared_t *f_sh, size_t page_buffer_size, unsigned page_buf_min_meta_perc,
-                          unsigned page_buf_min_raw_perc);
+                          unsigned page_buf_min_raw_perc, unsigned page_buf_read_ahead);
 H5_DLL herr_t H5PB_flush(H5F_shared_t *f_sh);
 H5_DLL herr_t H5PB_dest(H5F_shared_t *f_sh);
 H5_DLL herr_t H5PB_add_new_page(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t page_addr);
@@ -85,6 +90,13 @@ H5_DLL herr_t H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_
 H5_DLL herr_t H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
 H5_DLL herr_t H5PB_enabled(H5F_shared_t *f_sh, H5FD_mem_t type, bool *enabled);
 
+#ifdef H5_HAVE_PARALLEL
+/* Parallel routines */
+H5_DLL bool   H5PB_coll_read_enabled(const H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size);
+H5_DLL herr_t H5PB_coll_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
+                             void *buf /*out*/);
+#endif /* H5_HAVE_PARALLEL */
+
 /* Statistics routines */
 H5_DLL herr_t H5PB_reset_stats(H5PB_t *page_buf);
 H5_DLL herr_t H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2], unsigned hits[2],
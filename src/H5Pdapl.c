@@ -96,6 +96,11 @@
 #define H5D_ACS_EFILE_PREFIX_COPY  H5P__dapl_efile_pref_copy
 #define H5D_ACS_EFILE_PREFIX_CMP   H5P__dapl_efile_pref_cmp
 #define H5D_ACS_EFILE_PREFIX_CLOSE H5P__dapl_efile_pref_close
+/* Definitions for skipping chunks of fill values */
+#define H5D_ACS_SKIP_FILL_CHUNKS_SIZE sizeof(bool)
+#define H5D_ACS_SKIP_FILL_CHUNKS_DEF  false
+#define H5D_ACS_SKIP_FILL_CHUNKS_ENC  H5P__encode_bool
+#define H5D_ACS_SKIP_FILL_CHUNKS_DEC  H5P__decode_bool
 
 /******************/
 /* Local Typedefs */
@@ -175,6 +180,8 @@ static const H5D_append_flush_t H5D_def_append_flush_g =
 static const char *H5D_def_efile_prefix_g =
     H5D_ACS_EFILE_PREFIX_DEF;                                     /* Default external file prefix string */
 static const char *H5D_def_vds_prefix_g = H5D_ACS_VDS_PREFIX_DEF; /* Default vds prefix string */
+static const bool H5D_def_skip_fill_chunks_g =
+    H5D_ACS_SKIP_FILL_CHUNKS_DEF; /* Default setting for skipping chunks of fill values */
 
 /*-------------------------------------------------------------------------
  * Function:    H5P__dacc_reg_prop
@@ -247,6 +254,12 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
                            H5D_ACS_EFILE_PREFIX_CLOSE) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
 
+    /* Register property for skipping chunks of fill values */
+    if (H5P__register_real(pclass, H5D_ACS_SKIP_FILL_CHUNKS_NAME, H5D_ACS_SKIP_FILL_CHUNKS_SIZE,
+                           &H5D_def_skip_fill_chunks_g, NULL, NULL, NULL, H5D_ACS_SKIP_FILL_CHUNKS_ENC,
+                           H5D_ACS_SKIP_FILL_CHUNKS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dacc_reg_prop() */
@@ -1543,3 +1556,66 @@ H5Pget_virtual_prefix(hid_t plist_id, char *prefix /*out*/, size_t size)
 done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_virtual_prefix() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_skip_fill_chunks
+ *
+ * Purpose:     Sets whether chunks holding nothing but the fill value are
+ *              left unallocated (or removed from the file) instead of
+ *              being written.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_skip_fill_chunks(hid_t plist_id, hbool_t skip_fill)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Check arguments */
+    if (plist_id == H5P_DEFAULT)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_ACCESS, false)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Set the value */
+    if (H5P_set(plist, H5D_ACS_SKIP_FILL_CHUNKS_NAME, &skip_fill) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_skip_fill_chunks() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_skip_fill_chunks
+ *
+ * Purpose:     Retrieves the setting made with H5Pset_skip_fill_chunks().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_skip_fill_chunks(hid_t plist_id, hbool_t *skip_fill /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_ACCESS, true)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get the value */
+    if (skip_fill)
+        if (H5P_get(plist, H5D_ACS_SKIP_FILL_CHUNKS_NAME, skip_fill) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_skip_fill_chunks() */
@@ -181,6 +181,11 @@
 #define H5D_XFER_MODIFY_WRITE_BUF_DEF  false
 #define H5D_XFER_MODIFY_WRITE_BUF_ENC  H5P__dxfr_modify_write_buf_enc
 #define H5D_XFER_MODIFY_WRITE_BUF_DEC  H5P__dxfr_modify_write_buf_dec
+/* Definitions for dataset I/O threads property */
+#define H5D_XFER_DSET_IO_THREADS_SIZE sizeof(unsigned)
+#define H5D_XFER_DSET_IO_THREADS_DEF  1
+#define H5D_XFER_DSET_IO_THREADS_ENC  H5P__encode_unsigned
+#define H5D_XFER_DSET_IO_THREADS_DEC  H5P__decode_unsigned
 
 /******************/
 /* Local Typedefs */
@@ -298,6 +303,7 @@ static const H5D_selection_io_mode_t H5D_def_selection_io_mode_g     = H5D_XFER_
 static const uint32_t                H5D_def_no_selection_io_cause_g = H5D_XFER_NO_SELECTION_IO_CAUSE_DEF;
 static const uint32_t H5D_def_actual_selection_io_mode_g             = H5D_XFER_ACTUAL_SELECTION_IO_MODE_DEF;
 static const bool     H5D_def_modify_write_buf_g                     = H5D_XFER_MODIFY_WRITE_BUF_DEF;
+static const unsigned H5D_def_dset_io_threads_g                      = H5D_XFER_DSET_IO_THREADS_DEF;
 
 /*-------------------------------------------------------------------------
  * Function:    H5P__dxfr_reg_prop
@@ -485,6 +491,12 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
                            H5D_XFER_MODIFY_WRITE_BUF_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
 
+    /* Register the dataset I/O threads property */
+    if (H5P__register_real(pclass, H5D_XFER_DSET_IO_THREADS_NAME, H5D_XFER_DSET_IO_THREADS_SIZE,
+                           &H5D_def_dset_io_threads_g, NULL, NULL, NULL, H5D_XFER_DSET_IO_THREADS_ENC,
+                           H5D_XFER_DSET_IO_THREADS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dxfr_reg_prop() */
@@ -2602,3 +2614,71 @@ H5Pget_modify_write_buf(hid_t plist_id, hbool_t *modify_write_buf /*out*/)
 done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_modify_write_buf() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_dataset_io_threads
+ *
+ * Purpose:     Sets the number of threads that may be used to convert
+ *              and scatter/gather the data of a multi-dataset transfer
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_dataset_io_threads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Check arguments */
+    if (plist_id == H5P_DEFAULT)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+    if (nthreads == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be positive");
+
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER, false)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "not a dxpl");
+
+    /* Set the number of threads */
+    if (H5P_set(plist, H5D_XFER_DSET_IO_THREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_dataset_io_threads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_dataset_io_threads
+ *
+ * Purpose:     Retrieves the number of threads set with
+ *              H5Pset_dataset_io_threads()
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_dataset_io_threads(hid_t plist_id, unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Check arguments */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER, true)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "not a dxpl");
+
+    /* Get the number of threads */
+    if (nthreads)
+        if (H5P_get(plist, H5D_XFER_DSET_IO_THREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_dataset_io_threads() */
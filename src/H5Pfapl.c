@@ -53,9 +53,15 @@
 #ifdef H5_HAVE_DIRECT
 #include "H5FDdirect.h"
 #endif
+#ifdef H5_HAVE_IOURING_VFD
+#include "H5FDiouring.h"
+#endif
 #ifdef H5_HAVE_MIRROR_VFD
 #include "H5FDmirror.h"
 #endif
+#ifdef H5_HAVE_MMAP_VFD
+#include "H5FDmmap.h"
+#endif
 #ifdef H5_HAVE_LIBHDFS
 #include "H5FDhdfs.h"
 #endif
@@ -108,6 +114,11 @@
 #define H5F_ACS_ALIGN_DEF  H5F_ALIGN_DEF
 #define H5F_ACS_ALIGN_ENC  H5P__encode_hsize_t
 #define H5F_ACS_ALIGN_DEC  H5P__decode_hsize_t
+/* Definition for raw data alignment */
+#define H5F_ACS_RAW_DATA_ALIGN_SIZE sizeof(hsize_t)
+#define H5F_ACS_RAW_DATA_ALIGN_DEF  H5F_RAW_DATA_ALIGN_DEF
+#define H5F_ACS_RAW_DATA_ALIGN_ENC  H5P__encode_hsize_t
+#define H5F_ACS_RAW_DATA_ALIGN_DEC  H5P__decode_hsize_t
 /* Definition for minimum metadata allocation block size (when
    aggregating metadata allocations. */
 #define H5F_ACS_META_BLOCK_SIZE_SIZE sizeof(hsize_t)
@@ -241,6 +252,11 @@
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_DEF  false
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_ENC  H5P__encode_bool
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_DEC  H5P__decode_bool
+/* Definition for 'mdc log format' property */
+#define H5F_ACS_MDC_LOG_FORMAT_SIZE sizeof(unsigned)
+#define H5F_ACS_MDC_LOG_FORMAT_DEF  H5AC_LOG_FORMAT_JSON
+#define H5F_ACS_MDC_LOG_FORMAT_ENC  H5P__encode_unsigned
+#define H5F_ACS_MDC_LOG_FORMAT_DEC  H5P__decode_unsigned
 /* Definition for evict on close property */
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_SIZE sizeof(bool)
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_DEF  false
@@ -282,6 +298,26 @@
 #define H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_ENC  H5P__facc_cache_image_config_enc
 #define H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_DEC  H5P__facc_cache_image_config_dec
 #define H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_CMP  H5P__facc_cache_image_config_cmp
+/* Definition for metadata cache image compression */
+#define H5F_ACS_META_CACHE_IMAGE_COMPRESSION_SIZE sizeof(unsigned)
+#define H5F_ACS_META_CACHE_IMAGE_COMPRESSION_DEF  0
+#define H5F_ACS_META_CACHE_IMAGE_COMPRESSION_ENC  H5P__encode_unsigned
+#define H5F_ACS_META_CACHE_IMAGE_COMPRESSION_DEC  H5P__decode_unsigned
+/* Definition for metadata cache miss latency target */
+#define H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_SIZE sizeof(double)
+#define H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_DEF  0.0
+#define H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_ENC  H5P__encode_double
+#define H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_DEC  H5P__decode_double
+/* Definition for object header vector reads */
+#define H5F_ACS_OHDR_VECTOR_READ_SIZE sizeof(bool)
+#define H5F_ACS_OHDR_VECTOR_READ_DEF  false
+#define H5F_ACS_OHDR_VECTOR_READ_ENC  H5P__encode_bool
+#define H5F_ACS_OHDR_VECTOR_READ_DEC  H5P__decode_bool
+/* Definition for asynchronous dataset I/O in the native VOL connector */
+#define H5F_ACS_NATIVE_ASYNC_IO_SIZE sizeof(bool)
+#define H5F_ACS_NATIVE_ASYNC_IO_DEF  false
+#define H5F_ACS_NATIVE_ASYNC_IO_ENC  H5P__encode_bool
+#define H5F_ACS_NATIVE_ASYNC_IO_DEC  H5P__decode_bool
 /* Definition for total size of page buffer(bytes) */
 #define H5F_ACS_PAGE_BUFFER_SIZE_SIZE sizeof(size_t)
 #define H5F_ACS_PAGE_BUFFER_SIZE_DEF  0
@@ -297,6 +333,16 @@
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF  0
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_ENC  H5P__encode_unsigned
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC  H5P__decode_unsigned
+/* Definition for # of metadata pages read ahead by page buffering */
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_SIZE sizeof(unsigned)
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_DEF  0
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_ENC  H5P__encode_unsigned
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_DEC  H5P__decode_unsigned
+/* Definition for max. size of raw data writes held in the accumulator */
+#define H5F_ACS_RAW_DATA_ACCUM_SIZE_SIZE sizeof(size_t)
+#define H5F_ACS_RAW_DATA_ACCUM_SIZE_DEF  0
+#define H5F_ACS_RAW_DATA_ACCUM_SIZE_ENC  H5P__encode_size_t
+#define H5F_ACS_RAW_DATA_ACCUM_SIZE_DEC  H5P__decode_size_t
 /* Definition for file VOL connector properties (ID, etc.) */
 #define H5F_ACS_VOL_CONN_SIZE sizeof(H5VL_connector_prop_t)
 #define H5F_ACS_VOL_CONN_DEF                                                                                 \
@@ -471,6 +517,8 @@ static const double H5F_def_rdcc_w0_g =
 static const hsize_t H5F_def_threshold_g =
     H5F_ACS_ALIGN_THRHD_DEF;                                  /* Default allocation alignment threshold */
 static const hsize_t H5F_def_alignment_g = H5F_ACS_ALIGN_DEF; /* Default allocation alignment value */
+static const hsize_t H5F_def_raw_data_align_g =
+    H5F_ACS_RAW_DATA_ALIGN_DEF; /* Default raw data allocation alignment value */
 static const hsize_t H5F_def_meta_block_size_g =
     H5F_ACS_META_BLOCK_SIZE_DEF; /* Default metadata allocation block size */
 static const size_t H5F_def_sieve_buf_size_g =
@@ -513,6 +561,7 @@ static const bool H5F_def_use_mdc_logging_g =
 static const char *H5F_def_mdc_log_location_g = H5F_ACS_MDC_LOG_LOCATION_DEF; /* Default mdc log location */
 static const bool  H5F_def_start_mdc_log_on_access_g =
     H5F_ACS_START_MDC_LOG_ON_ACCESS_DEF; /* Default mdc log start on access flag */
+static const unsigned H5F_def_mdc_log_format_g = H5F_ACS_MDC_LOG_FORMAT_DEF; /* Default mdc log format */
 static const bool H5F_def_evict_on_close_flag_g =
     H5F_ACS_EVICT_ON_CLOSE_FLAG_DEF; /* Default setting for evict on close property */
 #ifdef H5_HAVE_PARALLEL
@@ -525,11 +574,23 @@ static const MPI_Info H5F_def_mpi_params_info_g = H5F_ACS_MPI_PARAMS_INFO_DEF; /
 #endif                                                                         /* H5_HAVE_PARALLEL */
 static const H5AC_cache_image_config_t H5F_def_mdc_initCacheImageCfg_g =
     H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_DEF; /* Default metadata cache image settings */
+static const unsigned H5F_def_mdc_image_compression_g =
+    H5F_ACS_META_CACHE_IMAGE_COMPRESSION_DEF; /* Default metadata cache image compression level */
+static const double H5F_def_mdc_miss_latency_target_g =
+    H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_DEF; /* Default metadata cache miss latency target */
+static const bool H5F_def_ohdr_vector_read_g =
+    H5F_ACS_OHDR_VECTOR_READ_DEF; /* Default setting for object header vector reads */
+static const bool H5F_def_native_async_io_g =
+    H5F_ACS_NATIVE_ASYNC_IO_DEF; /* Default setting for asynchronous dataset I/O */
 static const size_t   H5F_def_page_buf_size_g = H5F_ACS_PAGE_BUFFER_SIZE_DEF; /* Default page buffer size */
 static const unsigned H5F_def_page_buf_min_meta_perc_g =
     H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEF; /* Default page buffer minimum metadata size */
 static const unsigned H5F_def_page_buf_min_raw_perc_g =
     H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF; /* Default page buffer minimum raw data size */
+static const unsigned H5F_def_page_buf_read_ahead_g =
+    H5F_ACS_PAGE_BUFFER_READ_AHEAD_DEF; /* Default page buffer read-ahead page count */
+static const size_t H5F_def_raw_data_accum_size_g =
+    H5F_ACS_RAW_DATA_ACCUM_SIZE_DEF; /* Default max. size of accumulated raw data writes */
 static const bool H5F_def_use_file_locking_g =
     H5F_ACS_USE_FILE_LOCKING_DEF; /* Default use file locking flag */
 static const bool H5F_def_ignore_disabled_file_locks_g =
@@ -592,6 +653,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            NULL, H5F_ACS_ALIGN_ENC, H5F_ACS_ALIGN_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
 
+    /* Register the raw data alignment */
+    if (H5P__register_real(pclass, H5F_ACS_RAW_DATA_ALIGN_NAME, H5F_ACS_RAW_DATA_ALIGN_SIZE,
+                           &H5F_def_raw_data_align_g, NULL, NULL, NULL, H5F_ACS_RAW_DATA_ALIGN_ENC,
+                           H5F_ACS_RAW_DATA_ALIGN_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
     /* Register the minimum metadata allocation block size */
     if (H5P__register_real(pclass, H5F_ACS_META_BLOCK_SIZE_NAME, H5F_ACS_META_BLOCK_SIZE_SIZE,
                            &H5F_def_meta_block_size_g, NULL, NULL, NULL, H5F_ACS_META_BLOCK_SIZE_ENC,
@@ -746,6 +813,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
 
+    /* Register the metadata cache log format */
+    if (H5P__register_real(pclass, H5F_ACS_MDC_LOG_FORMAT_NAME, H5F_ACS_MDC_LOG_FORMAT_SIZE,
+                           &H5F_def_mdc_log_format_g, NULL, NULL, NULL, H5F_ACS_MDC_LOG_FORMAT_ENC,
+                           H5F_ACS_MDC_LOG_FORMAT_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
     /* Register the evict on close flag */
     if (H5P__register_real(pclass, H5F_ACS_EVICT_ON_CLOSE_FLAG_NAME, H5F_ACS_EVICT_ON_CLOSE_FLAG_SIZE,
                            &H5F_def_evict_on_close_flag_g, NULL, NULL, NULL, H5F_ACS_EVICT_ON_CLOSE_FLAG_ENC,
@@ -791,6 +864,32 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_CMP, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
 
+    /* Register the metadata cache image compression level */
+    if (H5P__register_real(pclass, H5F_ACS_META_CACHE_IMAGE_COMPRESSION_NAME,
+                           H5F_ACS_META_CACHE_IMAGE_COMPRESSION_SIZE, &H5F_def_mdc_image_compression_g, NULL,
+                           NULL, NULL, H5F_ACS_META_CACHE_IMAGE_COMPRESSION_ENC,
+                           H5F_ACS_META_CACHE_IMAGE_COMPRESSION_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
+    /* Register the metadata cache miss latency target */
+    if (H5P__register_real(pclass, H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_NAME,
+                           H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_SIZE, &H5F_def_mdc_miss_latency_target_g,
+                           NULL, NULL, NULL, H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_ENC,
+                           H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
+    /* Register the object header vector read flag */
+    if (H5P__register_real(pclass, H5F_ACS_OHDR_VECTOR_READ_NAME, H5F_ACS_OHDR_VECTOR_READ_SIZE,
+                           &H5F_def_ohdr_vector_read_g, NULL, NULL, NULL, H5F_ACS_OHDR_VECTOR_READ_ENC,
+                           H5F_ACS_OHDR_VECTOR_READ_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
+    /* Register the asynchronous dataset I/O flag */
+    if (H5P__register_real(pclass, H5F_ACS_NATIVE_ASYNC_IO_NAME, H5F_ACS_NATIVE_ASYNC_IO_SIZE,
+                           &H5F_def_native_async_io_g, NULL, NULL, NULL, H5F_ACS_NATIVE_ASYNC_IO_ENC,
+                           H5F_ACS_NATIVE_ASYNC_IO_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
     /* Register the size of the page buffer size */
     if (H5P__register_real(pclass, H5F_ACS_PAGE_BUFFER_SIZE_NAME, H5F_ACS_PAGE_BUFFER_SIZE_SIZE,
                            &H5F_def_page_buf_size_g, NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_SIZE_ENC,
@@ -811,6 +910,19 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
 
+    /* Register the # of metadata pages read ahead by the page buffer */
+    if (H5P__register_real(pclass, H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME, H5F_ACS_PAGE_BUFFER_READ_AHEAD_SIZE,
+                           &H5F_def_page_buf_read_ahead_g, NULL, NULL, NULL,
+                           H5F_ACS_PAGE_BUFFER_READ_AHEAD_ENC, H5F_ACS_PAGE_BUFFER_READ_AHEAD_DEC, NULL, NULL,
+                           NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
+    /* Register the max. size of raw data writes held in the accumulator */
+    if (H5P__register_real(pclass, H5F_ACS_RAW_DATA_ACCUM_SIZE_NAME, H5F_ACS_RAW_DATA_ACCUM_SIZE_SIZE,
+                           &H5F_def_raw_data_accum_size_g, NULL, NULL, NULL, H5F_ACS_RAW_DATA_ACCUM_SIZE_ENC,
+                           H5F_ACS_RAW_DATA_ACCUM_SIZE_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
     /* Register the file VOL connector ID & info */
     /* (Note: this property should not have an encode/decode callback -QAK) */
     if (H5P__register_real(pclass, H5F_ACS_VOL_CONN_NAME, H5F_ACS_VOL_CONN_SIZE, &def_vol_prop,
@@ -1002,6 +1114,22 @@ H5P__facc_set_def_driver_check_predefined(const char *driver_name, hid_t *driver
             HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL, "couldn't initialize Direct I/O VFD");
 #else
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "Direct I/O VFD is not enabled");
+#endif
+    }
+    else if (!strcmp(driver_name, "io_uring")) {
+#ifdef H5_HAVE_IOURING_VFD
+        if ((*driver_id = H5FD_IOURING) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL, "couldn't initialize io_uring VFD");
+#else
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "io_uring VFD is not enabled");
+#endif
+    }
+    else if (!strcmp(driver_name, "mmap")) {
+#ifdef H5_HAVE_MMAP_VFD
+        if ((*driver_id = H5FD_MMAP) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL, "couldn't initialize mmap VFD");
+#else
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "mmap VFD is not enabled");
 #endif
     }
     else if (!strcmp(driver_name, "mirror")) {
@@ -1134,6 +1262,79 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_alignment() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_raw_data_alignment
+ *
+ * Purpose:    Sets the alignment of raw data allocations for a file access
+ *        property list, so that the storage of every contiguous
+ *        dataset and every chunk starts at a file offset which is a
+ *        multiple of ALIGNMENT.  Unlike H5Pset_alignment(), this does
+ *        not apply to metadata and has no size threshold.
+ *
+ *        The default value of one means no alignment.  Drivers which
+ *        bypass the operating system's page cache, like the direct
+ *        driver, can then transfer whole blocks of raw data without
+ *        staging them through an aligned copy buffer.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_raw_data_alignment(hid_t fapl_id, hsize_t alignment)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Check args */
+    if (alignment < 1)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "alignment must be positive");
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS, false)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_RAW_DATA_ALIGN_NAME, &alignment) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set raw data alignment");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_raw_data_alignment() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_raw_data_alignment
+ *
+ * Purpose:    Returns the alignment of raw data allocations from a file
+ *        access property list.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_raw_data_alignment(hid_t fapl_id, hsize_t *alignment /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS, true)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get value */
+    if (alignment)
+        if (H5P_get(plist, H5F_ACS_RAW_DATA_ALIGN_NAME, alignment) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get raw data alignment");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_raw_data_alignment() */
+
 /*-------------------------------------------------------------------------
  * Function:   H5P_set_driver
  *
@@ -2296,6 +2497,263 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Pget_mdc_image_config() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_mdc_image_compression
+ *
+ * Purpose:    Set the deflate level used to compress the metadata cache
+ *        image written when the file is closed.  Zero disables
+ *        compression.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_mdc_image_compression(hid_t plist_id, unsigned level)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, false)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Check argument */
+    if (level > 9)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid deflate level");
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_META_CACHE_IMAGE_COMPRESSION_NAME, &level) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache image compression");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pset_mdc_image_compression() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_mdc_image_compression
+ *
+ * Purpose:    Retrieve the deflate level used to compress metadata cache
+ *        images from the target FAPL.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mdc_image_compression(hid_t plist_id, unsigned *level /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, true)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get value */
+    if (level)
+        if (H5P_get(plist, H5F_ACS_META_CACHE_IMAGE_COMPRESSION_NAME, level) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get metadata cache image compression");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pget_mdc_image_compression() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_mdc_miss_latency_target
+ *
+ * Purpose:    Set the target average time, in seconds, that an access of
+ *        the metadata cache may spend loading entries from the file,
+ *        used when the cache is sized with the working set size
+ *        increase mode.  Zero means there is no target.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_mdc_miss_latency_target(hid_t plist_id, double target)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, false)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Check argument */
+    if (!(target >= 0.0))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "miss latency target must be non-negative");
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_NAME, &target) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache miss latency target");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pset_mdc_miss_latency_target() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_mdc_miss_latency_target
+ *
+ * Purpose:    Retrieve the metadata cache miss latency target from the
+ *        target FAPL.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mdc_miss_latency_target(hid_t plist_id, double *target /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, true)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get value */
+    if (target)
+        if (H5P_get(plist, H5F_ACS_META_CACHE_MISS_LATENCY_TARGET_NAME, target) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get metadata cache miss latency target");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pget_mdc_miss_latency_target() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_ohdr_vector_read
+ *
+ * Purpose:    Set whether the continuation chunks of an object header
+ *        are read from a file opened read-only with a single vector
+ *        read, instead of one read per chunk.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_ohdr_vector_read(hid_t plist_id, hbool_t enable)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, false)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_OHDR_VECTOR_READ_NAME, &enable) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set object header vector read flag");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pset_ohdr_vector_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_ohdr_vector_read
+ *
+ * Purpose:    Retrieve whether object header chunks are read with vector
+ *        reads from the target FAPL.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_ohdr_vector_read(hid_t plist_id, hbool_t *enable /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, true)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get value */
+    if (enable)
+        if (H5P_get(plist, H5F_ACS_OHDR_VECTOR_READ_NAME, enable) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get object header vector read flag");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pget_ohdr_vector_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_native_async_io
+ *
+ * Purpose:    Set whether the asynchronous dataset read and write calls
+ *        made on a file with the native VOL connector run on a
+ *        background thread, instead of completing before they return.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_native_async_io(hid_t plist_id, hbool_t enable)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, false)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_NATIVE_ASYNC_IO_NAME, &enable) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set asynchronous dataset I/O flag");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pset_native_async_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_native_async_io
+ *
+ * Purpose:    Retrieve whether asynchronous dataset I/O runs on a
+ *        background thread from the target FAPL.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_native_async_io(hid_t plist_id, hbool_t *enable /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, true)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get value */
+    if (enable)
+        if (H5P_get(plist, H5F_ACS_NATIVE_ASYNC_IO_NAME, enable) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get asynchronous dataset I/O flag");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pget_native_async_io() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_mdc_config
  *
@@ -4693,6 +5151,76 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_mdc_log_options() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_mdc_log_format
+ *
+ * Purpose:    Set the metadata cache log format.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_mdc_log_format(hid_t plist_id, H5AC_log_format_t format)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    unsigned        log_format;          /* Format, as stored in the property list */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Check arguments */
+    if (H5P_DEFAULT == plist_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "can't modify default property list");
+    if (format != H5AC_LOG_FORMAT_JSON && format != H5AC_LOG_FORMAT_BINARY)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown log format");
+
+    /* Get the property list structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, false)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "plist_id is not a file access property list");
+
+    /* Set value */
+    log_format = (unsigned)format;
+    if (H5P_set(plist, H5F_ACS_MDC_LOG_FORMAT_NAME, &log_format) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set log format");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_mdc_log_format() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_mdc_log_format
+ *
+ * Purpose:    Get the metadata cache log format.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mdc_log_format(hid_t plist_id, H5AC_log_format_t *format /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    unsigned        log_format;          /* Format, as stored in the property list */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the property list structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, true)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "plist_id is not a file access property list");
+
+    /* Get value */
+    if (format) {
+        if (H5P_get(plist, H5F_ACS_MDC_LOG_FORMAT_NAME, &log_format) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get log format");
+        *format = (H5AC_log_format_t)log_format;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_mdc_log_format() */
+
 /*-------------------------------------------------------------------------
  * Function:       H5P__facc_mdc_log_location_enc
  *
@@ -5820,6 +6348,130 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_page_buffer_size() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_page_buffer_read_ahead
+ *
+ * Purpose:     Set the maximum number of pages the page buffer reads
+ *              ahead when it detects sequential metadata page misses.
+ *              Zero disables read-ahead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_page_buffer_read_ahead(hid_t plist_id, unsigned npages)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, false)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME, &npages) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer read-ahead");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_page_buffer_read_ahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_page_buffer_read_ahead
+ *
+ * Purpose:     Retrieves the maximum number of pages the page buffer
+ *              reads ahead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_page_buffer_read_ahead(hid_t plist_id, unsigned *npages /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, true)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get value */
+    if (npages)
+        if (H5P_get(plist, H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME, npages) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get page buffer read-ahead");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_page_buffer_read_ahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_raw_data_accum_size
+ *
+ * Purpose:     Set the size of the largest raw data write that the
+ *              metadata accumulator holds on to, to be combined with
+ *              other small writes.  Zero disables accumulating raw data.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_raw_data_accum_size(hid_t plist_id, size_t size)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, false)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_RAW_DATA_ACCUM_SIZE_NAME, &size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set raw data accumulation size");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_raw_data_accum_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_raw_data_accum_size
+ *
+ * Purpose:     Retrieves the size of the largest raw data write that the
+ *              metadata accumulator holds on to.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_raw_data_accum_size(hid_t plist_id, size_t *size /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS, true)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get value */
+    if (size)
+        if (H5P_get(plist, H5F_ACS_RAW_DATA_ACCUM_SIZE_NAME, size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get raw data accumulation size");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_raw_data_accum_size() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5P_set_vol
  *
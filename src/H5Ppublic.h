@@ -3433,6 +3433,28 @@ H5_DLL herr_t H5Pget_alignment(hid_t fapl_id, hsize_t *threshold /*out*/, hsize_
  */
 H5_DLL herr_t H5Pget_cache(hid_t plist_id, int *mdc_nelmts, /* out */
                            size_t *rdcc_nslots /*out*/, size_t *rdcc_nbytes /*out*/, double *rdcc_w0);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Gets the memory allocation policy used by the core VFD
+ *
+ * \fapl_id
+ * \param[out] growth_factor Minimum ratio by which the memory grows
+ * \param[out] use_hugepages Whether the memory is backed by hugepages
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_core_allocation() retrieves the memory allocation policy
+ *          set with H5Pset_core_allocation() for the core VFD, #H5FD_CORE.
+ *
+ * \note This function is only for use with the core VFD and must be used
+ *       after the call to H5Pset_fapl_core(). It is an error to use this
+ *       function with any other VFD.
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pget_core_allocation(hid_t fapl_id, double *growth_factor, hbool_t *use_hugepages);
 /**
  * \ingroup FAPL
  *
@@ -3874,6 +3896,52 @@ H5_DLL herr_t H5Pget_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr)
  * \since 1.10.1
  */
 H5_DLL herr_t H5Pget_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr /*out*/);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves the compression level of metadata cache images
+ *
+ * \fapl_id{plist_id}
+ * \param[out] level Deflate level used to compress metadata cache images
+ * \return \herr_t
+ *
+ * \details H5Pget_mdc_image_compression() retrieves the deflate level set
+ *          with H5Pset_mdc_image_compression().
+ *
+ * \since 2.0.0
+ */
+H5_DLL herr_t H5Pget_mdc_image_compression(hid_t plist_id, unsigned *level /*out*/);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves the metadata cache miss latency target
+ *
+ * \fapl_id{plist_id}
+ * \param[out] target Target average time, in seconds, spent loading
+ *             metadata per cache access
+ * \return \herr_t
+ *
+ * \details H5Pget_mdc_miss_latency_target() retrieves the target set with
+ *          H5Pset_mdc_miss_latency_target().
+ *
+ * \since 2.0.0
+ */
+H5_DLL herr_t H5Pget_mdc_miss_latency_target(hid_t plist_id, double *target /*out*/);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Gets the metadata cache log format
+ *
+ * \fapl_id{plist_id}
+ * \param[out] format Format of the metadata cache log
+ * \return \herr_t
+ *
+ * \details H5Pget_mdc_log_format() retrieves the metadata cache log format
+ *          set with H5Pset_mdc_log_format().
+ *
+ * \since 2.0.0
+ */
+H5_DLL herr_t H5Pget_mdc_log_format(hid_t plist_id, H5AC_log_format_t *format /*out*/);
 /**
  * \ingroup FAPL
  *
@@ -4054,6 +4122,21 @@ H5_DLL herr_t H5Pget_metadata_read_attempts(hid_t plist_id, unsigned *attempts);
  *
  */
 H5_DLL herr_t H5Pget_multi_type(hid_t fapl_id, H5FD_mem_t *type);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves whether asynchronous dataset I/O runs in the background
+ *
+ * \fapl_id{plist_id}
+ * \param[out] enable Whether asynchronous dataset I/O runs in the background
+ * \return \herr_t
+ *
+ * \details H5Pget_native_async_io() retrieves the setting made with
+ *          H5Pset_native_async_io().
+ *
+ * \since 2.0.0
+ */
+H5_DLL herr_t H5Pget_native_async_io(hid_t plist_id, hbool_t *enable /*out*/);
 /**
  * \ingroup FAPL
  *
@@ -4084,6 +4167,21 @@ H5_DLL herr_t H5Pget_multi_type(hid_t fapl_id, H5FD_mem_t *type);
  * \since 1.10.0
  */
 H5_DLL herr_t H5Pget_object_flush_cb(hid_t plist_id, H5F_flush_cb_t *func, void **udata);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves whether object header chunks are read with vector reads
+ *
+ * \fapl_id{plist_id}
+ * \param[out] enable Whether object header chunks are read together
+ * \return \herr_t
+ *
+ * \details H5Pget_ohdr_vector_read() retrieves the setting made with
+ *          H5Pset_ohdr_vector_read().
+ *
+ * \since 2.0.0
+ */
+H5_DLL herr_t H5Pget_ohdr_vector_read(hid_t plist_id, hbool_t *enable /*out*/);
 /**
  * \ingroup FAPL
  *
@@ -4111,6 +4209,60 @@ H5_DLL herr_t H5Pget_object_flush_cb(hid_t plist_id, H5F_flush_cb_t *func, void
  */
 H5_DLL herr_t H5Pget_page_buffer_size(hid_t plist_id, size_t *buf_size, unsigned *min_meta_perc,
                                       unsigned *min_raw_perc);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves the number of metadata pages the page buffer reads ahead
+ *
+ * \fapl_id{plist_id}
+ * \param[out] npages Maximum number of pages read ahead on a sequential
+ *             metadata page miss
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_page_buffer_read_ahead() retrieves the number of pages
+ *          set with H5Pset_page_buffer_read_ahead().
+ *
+ * \since 2.0.0
+ */
+H5_DLL herr_t H5Pget_page_buffer_read_ahead(hid_t plist_id, unsigned *npages);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves the size of the largest raw data write held in the
+ *        metadata accumulator
+ *
+ * \fapl_id
+ * \param[out] size Size of the largest raw data write accumulated, in bytes
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_raw_data_accum_size() retrieves the size set with
+ *          H5Pset_raw_data_accum_size() from the file access property list
+ *          \p fapl_id.
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pget_raw_data_accum_size(hid_t fapl_id, size_t *size /*out*/);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves the alignment of raw data allocations
+ *
+ * \fapl_id
+ * \param[out] alignment Pointer to location of return alignment value
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_raw_data_alignment() retrieves the alignment of raw
+ *          data allocations set with H5Pset_raw_data_alignment() from
+ *          the file access property list \p fapl_id.
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pget_raw_data_alignment(hid_t fapl_id, hsize_t *alignment /*out*/);
 /**
  * \ingroup FAPL
  *
@@ -4317,6 +4469,47 @@ H5_DLL herr_t H5Pset_alignment(hid_t fapl_id, hsize_t threshold, hsize_t alignme
  */
 H5_DLL herr_t H5Pset_cache(hid_t plist_id, int mdc_nelmts, size_t rdcc_nslots, size_t rdcc_nbytes,
                            double rdcc_w0);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets the memory allocation policy for core driver, #H5FD_CORE
+ *
+ * \fapl_id{fapl_id}
+ * \param[in] growth_factor Minimum ratio by which the memory grows when
+ *                          the file needs more space; must be at least 1.0
+ * \param[in] use_hugepages Boolean value specifying whether to back the
+ *                          memory with hugepages
+ *
+ * \return \herr_t
+ *
+ * \details The core virtual file driver (VFD) holds the file in memory
+ *          that is extended in multiples of the \p increment passed to
+ *          H5Pset_fapl_core() whenever the file grows past its end. For
+ *          large files that grow gradually, each extension can copy the
+ *          whole file to a new memory block.
+ *
+ *          When \p growth_factor is greater than 1.0, the memory grows to
+ *          at least \p growth_factor times its current size each time it
+ *          must be extended, so that the number of copies is logarithmic in
+ *          the final size of the file. Memory is also kept, rather than
+ *          given back, when the file shrinks. The size of the file itself
+ *          is unaffected. The default of 1.0 allocates only what is needed.
+ *
+ *          When \p use_hugepages is true, the memory is allocated as an
+ *          anonymous memory mapping in multiples of 2 MiB, the kernel is
+ *          asked to back it with transparent hugepages, and it is grown in
+ *          place where possible. This reduces TLB pressure and copying for
+ *          multi-gigabyte files. The setting is ignored when file image
+ *          callbacks are in use and on systems without support for it.
+ *
+ * \attention This function is only for use with the core VFD and must
+ *            be used after the call to H5Pset_fapl_core(). It is an error
+ *            to use this function with any other VFD.
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pset_core_allocation(hid_t fapl_id, double growth_factor, hbool_t use_hugepages);
 /**
  * \ingroup FAPL
  *
@@ -5160,6 +5353,31 @@ H5_DLL herr_t H5Pset_libver_bounds(hid_t plist_id, H5F_libver_t low, H5F_libver_
  *
  */
 H5_DLL herr_t H5Pset_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets the metadata cache log format
+ *
+ * \fapl_id{plist_id}
+ * \param[in] format Format of the metadata cache log
+ * \return \herr_t
+ *
+ * \details H5Pset_mdc_log_format() sets the format of the metadata cache log
+ *          enabled with H5Pset_mdc_log_options().
+ *
+ *          #H5AC_LOG_FORMAT_JSON, the default, writes one JSON message per
+ *          cache operation as the operation takes place.
+ *
+ *          #H5AC_LOG_FORMAT_BINARY writes fixed-size binary records that are
+ *          buffered in memory and written to the log in batches, which costs
+ *          much less than formatting a message per operation. Binary logs are
+ *          converted to the JSON log format, or to a metadata cache trace
+ *          file, with the \ref H5TOOL_MDC_UG "h5mdclog" tool. Records still in
+ *          memory are written when logging is stopped or the file is closed.
+ *
+ * \since 2.0.0
+ */
+H5_DLL herr_t H5Pset_mdc_log_format(hid_t plist_id, H5AC_log_format_t format);
 /**
  * \ingroup FAPL
  *
@@ -5347,6 +5565,36 @@ H5_DLL herr_t H5Pset_metadata_read_attempts(hid_t plist_id, unsigned attempts);
  * \since 1.6.0
  */
 H5_DLL herr_t H5Pset_multi_type(hid_t fapl_id, H5FD_mem_t type);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets whether asynchronous dataset I/O runs in the background
+ *
+ * \fapl_id{plist_id}
+ * \param[in] enable Whether asynchronous dataset I/O runs in the background
+ *            (Default is false)
+ * \return \herr_t
+ *
+ * \details H5Pset_native_async_io() sets whether the H5Dread_async(),
+ *          H5Dwrite_async(), H5Dread_multi_async() and H5Dwrite_multi_async()
+ *          calls made on a file accessed through the native VOL connector
+ *          are queued and run on a background thread, instead of completing
+ *          before they return. The operations run one at a time, in the
+ *          order they were made, and complete through the event set they
+ *          were inserted into, e.g. with H5ESwait().
+ *
+ *          The buffers passed to a queued operation must not be modified
+ *          (or, for a read, used) until the operation completes. Closing
+ *          a dataset, and any other synchronous access to a dataset's raw
+ *          data, waits for the queued operations on the dataset's file.
+ *
+ *          The setting only has an effect when the library is built with
+ *          thread-safety, and is ignored otherwise. Other asynchronous API
+ *          calls still complete before they return.
+ *
+ * \since 2.0.0
+ */
+H5_DLL herr_t H5Pset_native_async_io(hid_t plist_id, hbool_t enable);
 /**
  * \ingroup FAPL
  *
@@ -5380,6 +5628,98 @@ H5_DLL herr_t H5Pset_multi_type(hid_t fapl_id, H5FD_mem_t type);
  * \since 1.10.0
  */
 H5_DLL herr_t H5Pset_object_flush_cb(hid_t plist_id, H5F_flush_cb_t func, void *udata);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets whether object header chunks are read with vector reads
+ *
+ * \fapl_id{plist_id}
+ * \param[in] enable Whether object header chunks are read together
+ *            (Default is false)
+ * \return \herr_t
+ *
+ * \details H5Pset_ohdr_vector_read() sets whether the continuation chunks
+ *          of an object header are read with a single vector read when the
+ *          header is loaded, instead of with one read per chunk. This
+ *          reduces the number of I/O requests needed to open objects whose
+ *          headers have been extended many times, such as objects with
+ *          many attributes, which matters most on high latency storage.
+ *
+ *          The setting only applies to files opened read-only, and is
+ *          ignored by parallel HDF5. Continuation chunks that are only
+ *          referenced from other continuation chunks are read together
+ *          with the other chunks found at the same level.
+ *
+ * \since 2.0.0
+ */
+H5_DLL herr_t H5Pset_ohdr_vector_read(hid_t plist_id, hbool_t enable);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets the size of the largest raw data write held in the metadata
+ *        accumulator
+ *
+ * \fapl_id
+ * \param[in] size Size of the largest raw data write accumulated, in bytes
+ *                 (Default is 0)
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_raw_data_accum_size() sets the file access property list
+ *          \p fapl_id so that raw data writes of up to \p size bytes are
+ *          held in the metadata accumulator instead of being written to the
+ *          file immediately.
+ *
+ *          The accumulator keeps a small number of disjoint dirty regions
+ *          apart from the metadata it is gathering. Small writes that adjoin
+ *          a region are added to it, so appending small records to several
+ *          datasets in a file builds up one region per dataset. The regions
+ *          are written to the file together, with a single vector write,
+ *          when no slot is free for a new region, when the file is flushed,
+ *          or before any I/O that overlaps them.
+ *
+ *          The default value of zero disables the accumulation of raw data.
+ *          The setting has no effect with file drivers that don't support
+ *          the metadata accumulator, when page buffering is enabled, or for
+ *          files opened for SWMR writing.
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pset_raw_data_accum_size(hid_t fapl_id, size_t size);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets the alignment of raw data allocations
+ *
+ * \fapl_id
+ * \param[in] alignment Alignment value
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_raw_data_alignment() sets the file access property list
+ *          \p fapl_id so that the storage allocated for the raw data of
+ *          contiguous datasets and for dataset chunks starts at a file
+ *          offset that is a multiple of \p alignment. Unlike
+ *          H5Pset_alignment(), the setting does not apply to metadata and
+ *          applies to allocations of any size.
+ *
+ *          The default value of one implies no alignment. Setting the
+ *          alignment to the file system block size used with the direct
+ *          driver, see H5Pset_fapl_direct(), allows raw data that is
+ *          written and read in whole blocks to be transferred without
+ *          going through the driver's aligned copy buffer. Up to
+ *          \p alignment - 1 bytes of file space may be left unused in
+ *          front of each allocation.
+ *
+ *          If the file space handling strategy is set to
+ *          #H5F_FSPACE_STRATEGY_PAGE, then the alignment set via this
+ *          routine is ignored.
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pset_raw_data_alignment(hid_t fapl_id, hsize_t alignment);
 /**
  * \ingroup FAPL
  *
@@ -5410,6 +5750,15 @@ H5_DLL herr_t H5Pset_object_flush_cb(hid_t plist_id, H5F_flush_cb_t func, void *
  *          access property and the size of the dataset to allocate the sieve
  *          buffer for the dataset in order to save memory usage.
  *
+ *          Each open contiguous dataset keeps up to four sieve buffers, one
+ *          for each stream of accesses to it, and a buffer reading ahead of
+ *          a sequential stream of reads grows up to four times \p size.
+ *          A buffer is only allocated when a stream first uses it, and
+ *          keeps its size until the dataset is closed, so the sieve buffer
+ *          memory of a dataset is at most 16 times \p size.
+ *
+ * \version 2.0.0 Each contiguous dataset keeps up to four sieve buffers,
+ *                which may be larger than \p size when reading ahead.
  * \version 1.6.0 The \p size parameter has changed from type \TText{hsize_t} to \TText{size_t}.
  *
  * \since 1.4.0
@@ -5723,6 +6072,57 @@ H5_DLL herr_t H5Pset_mpi_params(hid_t fapl_id, MPI_Comm comm, MPI_Info info);
  * \since 1.10.1
  */
 H5_DLL herr_t H5Pset_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets the compression level of metadata cache images
+ *
+ * \fapl_id{plist_id}
+ * \param[in] level Deflate level, from 1 to 9, used to compress metadata
+ *            cache images, or 0 to write them uncompressed (Default is 0)
+ * \return \herr_t
+ *
+ * \details H5Pset_mdc_image_compression() sets the deflate level used to
+ *          compress the metadata cache image requested with
+ *          H5Pset_mdc_image_config() when the file is closed. A compressed
+ *          image takes less space in the file and less time to read when the
+ *          file is opened again.
+ *
+ *          The image is written uncompressed if the deflate filter isn't
+ *          available, if compression doesn't make it smaller, or if the
+ *          file is opened for parallel access.
+ *
+ * \par Limitations: A file closed with a compressed metadata cache image
+ *      can only be opened by HDF5 2.0.0 or later until the image has been
+ *      loaded by a read/write open of the file.
+ *
+ * \since 2.0.0
+ */
+H5_DLL herr_t H5Pset_mdc_image_compression(hid_t plist_id, unsigned level);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets the metadata cache miss latency target
+ *
+ * \fapl_id{plist_id}
+ * \param[in] target Target average time, in seconds, spent loading metadata
+ *            per cache access, or 0.0 for no target (Default is 0.0)
+ * \return \herr_t
+ *
+ * \details H5Pset_mdc_miss_latency_target() sets the latency target used by
+ *          the #H5C_incr__working_set cache size increase mode. At the end
+ *          of each epoch, the cache only grows if the average time spent
+ *          loading entries per cache access exceeds the target, and then
+ *          only by as much as its record of recently evicted entries
+ *          suggests is needed to meet it. With no target, the cache grows
+ *          whenever recently evicted entries are loaded again.
+ *
+ *          H5Fget_mdc_type_stats() reports the time spent loading each type
+ *          of metadata entry, which may help choose a target.
+ *
+ * \since 2.0.0
+ */
+H5_DLL herr_t H5Pset_mdc_miss_latency_target(hid_t plist_id, double target);
 /**
  * \ingroup FAPL
  *
@@ -5775,6 +6175,36 @@ H5_DLL herr_t H5Pset_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t
  */
 H5_DLL herr_t H5Pset_page_buffer_size(hid_t plist_id, size_t buf_size, unsigned min_meta_per,
                                       unsigned min_raw_per);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets the number of metadata pages the page buffer reads ahead
+ *
+ * \fapl_id{plist_id}
+ * \param[in] npages Maximum number of pages read ahead on a sequential
+ *            metadata page miss (Default is 0)
+ * \return \herr_t
+ *
+ * \details H5Pset_page_buffer_read_ahead() sets \p npages, the maximum
+ *          number of pages the page buffer reads ahead when it detects that
+ *          metadata pages are being missed in ascending file order. When a
+ *          metadata page miss immediately follows the last page read from the
+ *          file, up to \p npages following pages that are not already in the
+ *          page buffer are read with a single vector read, so that a scan over
+ *          the metadata of a file issues a few large reads instead of one
+ *          small read per page.
+ *
+ *          Pages read ahead are subject to the same eviction policy as any
+ *          other page. Read-ahead never evicts the page that triggered it and
+ *          stops early if space can't be made in the page buffer. The default
+ *          value of zero disables read-ahead. Read-ahead has no effect unless
+ *          page buffering is enabled with H5Pset_page_buffer_size(), and is
+ *          not performed with multi-file drivers or in parallel.
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pset_page_buffer_read_ahead(hid_t plist_id, unsigned npages);
 
 /**
  * \ingroup FAPL
@@ -7296,6 +7726,24 @@ H5_DLL herr_t H5Pget_chunk_cache(hid_t dapl_id, size_t *rdcc_nslots /*out*/, siz
  *
  */
 H5_DLL ssize_t H5Pget_efile_prefix(hid_t dapl_id, char *prefix /*out*/, size_t size);
+/**
+ * \ingroup DAPL
+ *
+ * \brief Retrieves whether chunks of fill values are left unallocated
+ *
+ * \dapl_id
+ * \param[out] skip_fill Whether chunks of fill values are left unallocated
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_skip_fill_chunks() retrieves the setting made with
+ *          H5Pset_skip_fill_chunks() in the dataset access property list
+ *          \p dapl_id.
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pget_skip_fill_chunks(hid_t dapl_id, hbool_t *skip_fill /*out*/);
 /**
  * \ingroup DAPL
  *
@@ -7641,6 +8089,49 @@ H5_DLL herr_t H5Pset_chunk_cache(hid_t dapl_id, size_t rdcc_nslots, size_t rdcc_
  *
  */
 H5_DLL herr_t H5Pset_efile_prefix(hid_t dapl_id, const char *prefix);
+/**
+ * \ingroup DAPL
+ *
+ * \brief Sets whether chunks of fill values are left unallocated
+ *
+ * \dapl_id
+ * \param[in] skip_fill Whether to leave chunks of fill values unallocated
+ *                      (<em>Default value</em>: false)
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_skip_fill_chunks() sets whether a chunked dataset opened
+ *          or created with the dataset access property list \p dapl_id
+ *          writes chunks that hold nothing but the fill value.
+ *
+ *          When \p skip_fill is true, a chunk written to the file from the
+ *          chunk cache, or written whole directly from the application's
+ *          buffer, is first compared with the fill value.  If every element
+ *          is the fill value, the chunk is not written: a chunk not yet in
+ *          the file is left unallocated, and a chunk already in the file is
+ *          removed from it, so its space is freed.  Reading such a chunk
+ *          returns the fill value, so the dataset's data is the same either
+ *          way.  This saves time and file space for sparse data.
+ *
+ *          Chunks are only skipped for datasets whose space is allocated
+ *          incrementally (#H5D_ALLOC_TIME_INCR), whose fill value is read
+ *          back from unallocated chunks, i.e. whose fill value time is not
+ *          #H5D_FILL_TIME_NEVER and, for #H5D_FILL_TIME_IFSET, whose fill
+ *          value is defined, and whose datatype isn't variable-length.  The
+ *          setting is ignored for files opened with a parallel file driver.
+ *
+ *          Writing a chunk directly from the application's buffer only
+ *          compares it with the fill value when the whole chunk is written
+ *          from one contiguous block of the buffer, without datatype
+ *          conversion or a data transform.
+ *
+ *          As with the chunk cache settings, the setting from the first
+ *          open of a dataset applies to all its concurrent opens.
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pset_skip_fill_chunks(hid_t dapl_id, hbool_t skip_fill);
 /**
  * \ingroup DAPL
  *
@@ -8693,6 +9184,58 @@ H5_DLL herr_t H5Pset_modify_write_buf(hid_t plist_id, hbool_t modify_write_buf);
  */
 H5_DLL herr_t H5Pget_modify_write_buf(hid_t plist_id, hbool_t *modify_write_buf);
 
+/**
+ *
+ * \ingroup DXPL
+ *
+ * \brief Sets the number of threads used for multi-dataset transfers
+ *
+ * \dxpl_id{plist_id}
+ * \param[in] nthreads   Number of threads, including the calling thread
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_dataset_io_threads() sets the number of threads that
+ *          H5Dread_multi() and H5Dwrite_multi() may use when they are
+ *          passed the dataset transfer property list \p plist_id.  The
+ *          default is 1, which transfers the datasets on the calling thread
+ *          only.
+ *
+ *          With more than one thread, the datatype conversion and the
+ *          scatter to (or gather from) the application's buffers is spread
+ *          over the threads for the datasets of a selection I/O transfer
+ *          that convert between integer and floating-point types without a
+ *          background buffer, a data transform or a conversion exception
+ *          callback.  Reading and writing the file, filters and chunk
+ *          lookups still happen on the calling thread.
+ *
+ * \note    The property has no effect unless the library was built with
+ *          thread-safety or concurrency support.
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pset_dataset_io_threads(hid_t plist_id, unsigned nthreads);
+
+/**
+ *
+ * \ingroup DXPL
+ *
+ * \brief Retrieves the number of threads used for multi-dataset transfers
+ *
+ * \dxpl_id{plist_id}
+ * \param[out] nthreads   Number of threads, including the calling thread
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_dataset_io_threads() retrieves the setting made with
+ *          H5Pset_dataset_io_threads().
+ *
+ * \since 2.0.0
+ *
+ */
+H5_DLL herr_t H5Pget_dataset_io_threads(hid_t plist_id, unsigned *nthreads /*out*/);
+
 /**
  * \ingroup LCPL
  *
@@ -6304,6 +6304,42 @@ H5T_path_bkg(const H5T_path_t *p)
     FUNC_LEAVE_NOAPI(p->cdata.need_bkg)
 } /* end H5T_path_bkg() */
 
+/*-------------------------------------------------------------------------
+ * Function:  H5T_path_concurrent
+ *
+ * Purpose:   Checks whether the conversion path can be used from several
+ *            threads at once, i.e. whether it is one of the library's
+ *            conversion functions between integer and floating-point
+ *            types, which keep no private state.  The path is switched to
+ *            the "convert" command here, so the threads don't store to it.
+ *
+ *            Must be called by the thread that holds the API lock.
+ *
+ * Return:    true/false (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+bool
+H5T_path_concurrent(H5T_path_t *p, const H5T_t *src, const H5T_t *dst)
+{
+    bool ret_value = false; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    assert(p);
+    assert(src);
+    assert(dst);
+
+    if (!p->conv.is_app && !H5T_path_noop(p) &&
+        (H5T_INTEGER == src->shared->type || H5T_FLOAT == src->shared->type) &&
+        (H5T_INTEGER == dst->shared->type || H5T_FLOAT == dst->shared->type)) {
+        p->cdata.command = H5T_CONV_CONV;
+        ret_value        = true;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_path_concurrent() */
+
 /*-------------------------------------------------------------------------
  * Function:  H5T__compiler_conv
  *
@@ -6449,8 +6485,10 @@ H5T_convert_with_ctx(H5T_path_t *tpath, const H5T_t *src_type, const H5T_t *dst_
 
     FUNC_ENTER_NOAPI(FAIL)
 
-    /* Call the appropriate conversion callback */
-    tpath->cdata.command = H5T_CONV_CONV;
+    /* Call the appropriate conversion callback.  (Paths converted from
+     * several threads at once are already set up, see H5T_path_concurrent) */
+    if (tpath->cdata.command != H5T_CONV_CONV)
+        tpath->cdata.command = H5T_CONV_CONV;
     if (tpath->conv.is_app) {
         /* Prepare & restore library for user callback */
         H5_BEFORE_USER_CB(FAIL)
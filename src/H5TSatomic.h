@@ -277,6 +277,32 @@ H5TS_atomic_fetch_sub_uint(H5TS_atomic_uint_t *obj, unsigned arg)
     return ret_value;
 } /* end H5TS_atomic_fetch_sub_uint() */
 
+/*--------------------------------------------------------------------------
+ * Function:    H5TS_atomic_load_voidp
+ *
+ * Purpose:     Retrieves the value of atomic 'void *' variable object.
+ *
+ * Return:      Value of the atomic 'void *'
+ *
+ *--------------------------------------------------------------------------
+ */
+static inline void *
+H5TS_atomic_load_voidp(H5TS_atomic_voidp_t *obj)
+{
+    void *ret_value;
+
+    /* Lock mutex that protects the "atomic" value */
+    H5TS_mutex_lock(&obj->mutex);
+
+    /* Get the value */
+    ret_value = obj->value;
+
+    /* Release the object's mutex */
+    H5TS_mutex_unlock(&obj->mutex);
+
+    return ret_value;
+} /* end H5TS_atomic_load_voidp() */
+
 /*--------------------------------------------------------------------------
  * Function:    H5TS_atomic_exchange_voidp
  *
@@ -35,6 +35,7 @@
 #include "H5private.h"   /* Generic Functions                   */
 #include "H5CXprivate.h" /* API Contexts                        */
 #include "H5Epkg.h"      /* Error handling                      */
+#include "H5FLprivate.h" /* Free Lists                          */
 #include "H5TSpkg.h"     /* Threadsafety                        */
 
 #ifdef H5_HAVE_THREADSAFE_API
@@ -59,9 +60,10 @@
 
 /* Per-thread info */
 typedef struct H5TS_thread_info_t {
-    uint64_t            id;               /* Unique ID for each thread */
-    struct H5CX_node_t *api_ctx_node_ptr; /* Pointer to an API context node */
-    H5E_stack_t         err_stack;        /* Error stack */
+    uint64_t              id;            /* Unique ID for each thread */
+    H5CX_stack_t          api_ctx_stack; /* API context stack and its pool of nodes */
+    H5E_stack_t           err_stack;     /* Error stack */
+    struct H5FL_tcache_t *fl_tcache;     /* Free list cache */
 #ifdef H5_HAVE_CONCURRENCY
     unsigned dlftt; /* Whether locking is disabled for this thread */
 #endif              /* H5_HAVE_CONCURRENCY */
@@ -446,6 +448,76 @@ done:
     FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
 } /* H5TS_api_unlock */
 
+/*--------------------------------------------------------------------------
+ * Function:    H5TS_api_lock_suspend
+ *
+ * Purpose:     Releases the global "API" lock held by this thread, so that
+ *              other threads may enter the library while this thread works
+ *              only on state that it owns.  Passes back the lock count, for
+ *              H5TS_api_lock_resume().
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_api_lock_suspend(unsigned *lock_count)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NAMECHECK_ONLY
+
+    /* Release the "API" lock */
+    *lock_count = 0;
+    if (H5_UNLIKELY(H5TS__api_mutex_release(lock_count) < 0))
+        HGOTO_DONE(FAIL);
+
+done:
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
+} /* H5TS_api_lock_suspend */
+
+/*--------------------------------------------------------------------------
+ * Function:    H5TS_api_lock_resume
+ *
+ * Purpose:     Re-acquires the global "API" lock released with
+ *              H5TS_api_lock_suspend(), blocking until it is available.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_api_lock_resume(unsigned lock_count)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NAMECHECK_ONLY
+
+    /* Increment the attempt lock count */
+    H5TS_atomic_fetch_add_uint(&H5TS_api_info_p.attempt_lock_count, 1);
+
+#ifdef H5_HAVE_THREADSAFE
+    /* Acquire the library's API lock 'lock_count' times */
+    for (unsigned u = 0; u < lock_count; u++)
+        if (H5_UNLIKELY(H5TS_mutex_lock(&H5TS_api_info_p.api_mutex) < 0))
+            HGOTO_DONE(FAIL);
+
+    /* Restore the lock count for this thread */
+    H5TS_api_info_p.lock_count += lock_count;
+#else /* H5_HAVE_CONCURRENCY */
+    /* Acquire the library's API lock */
+    if (H5_UNLIKELY(H5TS_rwlock_wrlock(&H5TS_api_info_p.api_lock) < 0))
+        HGOTO_DONE(FAIL);
+
+    /* Restore the DLFTT value */
+    if (H5_UNLIKELY(H5TS__set_dlftt(lock_count) < 0))
+        HGOTO_DONE(FAIL);
+#endif
+
+done:
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
+} /* H5TS_api_lock_resume */
+
 /*--------------------------------------------------------------------------
  * Function:    H5TS__tinfo_init
  *
@@ -590,19 +662,19 @@ done:
 /*--------------------------------------------------------------------------
  * Function:    H5TS_get_api_ctx_ptr
  *
- * Purpose:     Retrieve the address of the pointer to the head of API context
- *		stack for this thread.  (i.e. an H5CX_node_t **)
+ * Purpose:     Retrieve the address of the API context stack for this thread.
+ *		(i.e. an H5CX_stack_t *)
  *
- * Return:	Success: Non-NULL pointer to head pointer of API context stack for thread
+ * Return:	Success: Non-NULL pointer to API context stack for thread
  *		Failure: NULL
  *
  *--------------------------------------------------------------------------
  */
-struct H5CX_node_t **
+struct H5CX_stack_t *
 H5TS_get_api_ctx_ptr(void)
 {
     H5TS_tinfo_node_t   *tinfo_node;
-    struct H5CX_node_t **ret_value;
+    struct H5CX_stack_t *ret_value;
 
     FUNC_ENTER_NOAPI_NAMECHECK_ONLY
 
@@ -615,7 +687,7 @@ H5TS_get_api_ctx_ptr(void)
             HGOTO_DONE(NULL);
 
     /* Set return value */
-    ret_value = &tinfo_node->info.api_ctx_node_ptr;
+    ret_value = &tinfo_node->info.api_ctx_stack;
 
 done:
     FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
@@ -655,6 +727,40 @@ done:
     FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
 } /* H5TS_get_err_stack() */
 
+/*--------------------------------------------------------------------------
+ * Function:    H5TS_get_fl_tcache_ptr
+ *
+ * Purpose:     Retrieve the address of the free list cache pointer for this
+ *		thread.  (i.e. an H5FL_tcache_t **)
+ *
+ * Return:	Success: Non-NULL pointer to free list cache pointer for thread
+ *		Failure: NULL
+ *
+ *--------------------------------------------------------------------------
+ */
+struct H5FL_tcache_t **
+H5TS_get_fl_tcache_ptr(void)
+{
+    H5TS_tinfo_node_t     *tinfo_node;
+    struct H5FL_tcache_t **ret_value;
+
+    FUNC_ENTER_NOAPI_NAMECHECK_ONLY
+
+    /* Check if info for thread has been created */
+    if (H5_UNLIKELY(H5TS_key_get_value(H5TS_thrd_info_key_g, (void **)&tinfo_node) < 0))
+        HGOTO_DONE(NULL);
+    if (NULL == tinfo_node)
+        /* Create thread info for this thread */
+        if (H5_UNLIKELY(NULL == (tinfo_node = H5TS__tinfo_create())))
+            HGOTO_DONE(NULL);
+
+    /* Set return value */
+    ret_value = &tinfo_node->info.fl_tcache;
+
+done:
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
+} /* H5TS_get_fl_tcache_ptr() */
+
 #ifdef H5_HAVE_CONCURRENCY
 /*--------------------------------------------------------------------------
  * Function:    H5TS__get_dlftt
@@ -806,6 +912,10 @@ H5TS__tinfo_destroy(void *_tinfo_node)
     FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
 
     if (tinfo_node) {
+        /* Return the objects in the thread's free list cache to the free lists */
+        H5FL_tcache_release(tinfo_node->info.fl_tcache);
+        tinfo_node->info.fl_tcache = NULL;
+
         H5TS_mutex_lock(&H5TS_tinfo_mtx_s);
 
         /* Add thread info node to the free list */
@@ -102,6 +102,7 @@
 
 /* atomic_voidp */
 #define H5TS_atomic_init_voidp(obj, desired)     atomic_init((obj), (desired))
+#define H5TS_atomic_load_voidp(obj)              atomic_load(obj)
 #define H5TS_atomic_exchange_voidp(obj, desired) atomic_exchange((obj), (desired))
 #define H5TS_atomic_compare_exchange_strong_voidp(obj, expected, desired)                                    \
     atomic_compare_exchange_strong((obj), (expected), (desired))
@@ -315,11 +316,14 @@ H5_DLL herr_t H5TS_api_lock(void);
 H5_DLL herr_t H5TS_api_lock(unsigned *dlftt);
 #endif
 H5_DLL herr_t H5TS_api_unlock(void);
+H5_DLL herr_t H5TS_api_lock_suspend(unsigned *lock_count);
+H5_DLL herr_t H5TS_api_lock_resume(unsigned lock_count);
 
 /* Retrieve per-thread info */
-H5_DLL herr_t               H5TS_thread_id(uint64_t *id);
-H5_DLL struct H5CX_node_t **H5TS_get_api_ctx_ptr(void);
-H5_DLL struct H5E_stack_t  *H5TS_get_err_stack(void);
+H5_DLL herr_t                 H5TS_thread_id(uint64_t *id);
+H5_DLL struct H5CX_stack_t   *H5TS_get_api_ctx_ptr(void);
+H5_DLL struct H5E_stack_t    *H5TS_get_err_stack(void);
+H5_DLL struct H5FL_tcache_t **H5TS_get_fl_tcache_ptr(void);
 #endif /* H5_HAVE_THREADSAFE_API */
 
 /* 'Once' operationss */
@@ -391,6 +395,7 @@ H5_DLL void            H5TS_atomic_destroy_uint(H5TS_atomic_uint_t *obj);
 /* void * _Atomic (atomic void pointer) */
 H5_DLL void H5TS_atomic_init_voidp(H5TS_atomic_voidp_t *obj, void *desired);
 /* Atomic 'void *' load, store, etc. calls are defined in H5TSatomic.h */
+static inline void *H5TS_atomic_load_voidp(H5TS_atomic_voidp_t *obj);
 static inline void *H5TS_atomic_exchange_voidp(H5TS_atomic_voidp_t *obj, void *desired);
 static inline bool  H5TS_atomic_compare_exchange_strong_voidp(H5TS_atomic_voidp_t *obj, void **expected,
                                                               void *desired);
@@ -156,12 +156,21 @@ static const H5VL_class_t H5VL_native_cls_g = {
     },
     {
         /* request_cls */
+#ifdef H5_HAVE_THREADSAFE_API
+        H5VL__native_request_wait,     /* wait         */
+        NULL,                          /* notify       */
+        H5VL__native_request_cancel,   /* cancel       */
+        H5VL__native_request_specific, /* specific     */
+        NULL,                          /* optional     */
+        H5VL__native_request_free      /* free         */
+#else
         NULL, /* wait         */
         NULL, /* notify       */
         NULL, /* cancel       */
         NULL, /* specific     */
         NULL, /* optional     */
         NULL  /* free         */
+#endif
     },
     {
         /* blob_cls */
@@ -228,6 +237,11 @@ H5VL__native_unregister(void)
 {
     FUNC_ENTER_PACKAGE_NOERR
 
+#ifdef H5_HAVE_THREADSAFE_API
+    /* Stop the asynchronous I/O thread */
+    (void)H5VL__native_async_term();
+#endif
+
     /* Reset VOL connector info */
     H5VL_NATIVE_g      = H5I_INVALID_HID;
     H5VL_NATIVE_conn_g = NULL;
@@ -75,6 +75,7 @@ typedef union H5VL_native_attr_optional_args_t {
 #define H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE       8  /* H5Dvlen_get_buf_size         */
 #define H5VL_NATIVE_DATASET_GET_OFFSET              9  /* H5Dget_offset                */
 #define H5VL_NATIVE_DATASET_CHUNK_ITER              10 /* H5Dchunk_iter                */
+#define H5VL_NATIVE_DATASET_READ_VIEW               11 /* H5Dread_view                 */
 /* NOTE: If values over 1023 are added, the H5VL_RESERVED_NATIVE_OPTIONAL macro
  *      must be updated.
  */
@@ -174,6 +175,12 @@ typedef union H5VL_native_dataset_optional_args_t {
         void               *op_data; /* Context to pass to iteration callback */
     } chunk_iter;
 
+    /* H5VL_NATIVE_DATASET_READ_VIEW */
+    struct {
+        hid_t        type_id; /* Memory datatype */
+        const void **buf;     /* Pointer to the data in the file mapping, or NULL (OUT) */
+    } read_view;
+
 } H5VL_native_dataset_optional_args_t;
 
 /* Values for native VOL connector file optional VOL operations */
@@ -210,7 +217,8 @@ typedef union H5VL_native_dataset_optional_args_t {
 #define H5VL_NATIVE_FILE_GET_MPI_ATOMICITY 26 /* H5Fget_mpi_atomicity                 */
 #define H5VL_NATIVE_FILE_SET_MPI_ATOMICITY 27 /* H5Fset_mpi_atomicity                 */
 #endif
-#define H5VL_NATIVE_FILE_POST_OPEN 28 /* Adjust file after open, with wrapping context */
+#define H5VL_NATIVE_FILE_POST_OPEN          28 /* Adjust file after open, with wrapping context */
+#define H5VL_NATIVE_FILE_GET_MDC_TYPE_STATS 29 /* H5Fget_mdc_type_stats                */
 /* NOTE: If values over 1023 are added, the H5VL_RESERVED_NATIVE_OPTIONAL macro
  *      must be updated.
  */
@@ -276,6 +284,13 @@ typedef struct H5VL_native_file_get_mdc_image_info_t {
     hsize_t *len;  /* Length of image (OUT) */
 } H5VL_native_file_get_mdc_image_info_t;
 
+/* Parameters for native connector's file 'get MDC type stats' operation */
+typedef struct H5VL_native_file_get_mdc_type_stats_t {
+    H5F_mdc_type_stats_t *stats;        /* Array of per-type statistics (OUT) */
+    size_t                ntypes;       /* Size of statistics array */
+    size_t               *total_ntypes; /* Actual # of entry types (OUT) */
+} H5VL_native_file_get_mdc_type_stats_t;
+
 /* Parameters for native connector's file 'set libver bounds' operation */
 typedef struct H5VL_native_file_set_libver_bounds_t {
     H5F_libver_t low;  /* Lowest version possible */
@@ -394,6 +409,12 @@ typedef union H5VL_native_file_optional_args_t {
 
     /* H5VL_NATIVE_FILE_POST_OPEN */
     /* No args */
+
+    /* H5VL_NATIVE_FILE_GET_MDC_TYPE_STATS */
+    H5VL_native_file_get_mdc_type_stats_t get_mdc_type_stats;
+
+    /* H5VL_NATIVE_FILE_POST_OPEN */
+    /* No args */
 } H5VL_native_file_optional_args_t;
 
 /* Values for native VOL connector group optional VOL operations */
@@ -0,0 +1,1011 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the LICENSE file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Asynchronous dataset I/O for the native VOL connector
+ *
+ *              When a file is opened with H5Pset_native_async_io(), the
+ *              H5Dread_async() / H5Dwrite_async() family of calls copy
+ *              their arguments into a request and queue it for a single
+ *              background thread, instead of running the I/O before they
+ *              return.  The background thread runs the requests in the
+ *              order they were made, taking the library's API lock for
+ *              each one, so an application thread can compute while its
+ *              data is written.  The requests complete through the event
+ *              set they were inserted into.
+ *
+ *              The arguments are checked and the dataspaces set up when a
+ *              request is queued, so argument errors are reported by the
+ *              call itself.  A request holds its own handles on the
+ *              datasets and copies of the dataspaces and DXPL, so the
+ *              application can close them as soon as the call returns.
+ *
+ *              Only dataset reads and writes are queued, and only one
+ *              thread runs them, one at a time.  The background operations
+ *              need the API lock anyway, and running them in order is what
+ *              keeps them consistent with each other, so there is no
+ *              dependency tracking between requests.  Every other callback
+ *              that depends on the raw data or the datasets of a file
+ *              waits for the requests queued on it first (see
+ *              H5VL__native_async_wait_file()).
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#define H5D_FRIEND /* Suppress error about including H5Dpkg    */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5CXprivate.h" /* API Contexts                             */
+#include "H5Dpkg.h"      /* Datasets                                 */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5ESprivate.h" /* Event Sets                               */
+#include "H5Fprivate.h"  /* Files                                    */
+#include "H5FLprivate.h" /* Free Lists                               */
+#include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
+#include "H5Pprivate.h"  /* Property lists                           */
+#include "H5Sprivate.h"  /* Dataspaces                               */
+#include "H5TSprivate.h" /* Threadsafety                             */
+#include "H5VLprivate.h" /* Virtual Object Layer                     */
+
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
+#ifdef H5_HAVE_THREADSAFE_API
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* How long a timed wait sleeps between checks of a request (in ns) */
+#define H5VL_NATIVE_ASYNC_POLL_NS 100000
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* States of a request */
+typedef enum H5VL_native_async_state_t {
+    H5VL_NATIVE_ASYNC_QUEUED,  /* Waiting for the background thread */
+    H5VL_NATIVE_ASYNC_RUNNING, /* Being run by the background thread */
+    H5VL_NATIVE_ASYNC_SUCCEED, /* Finished successfully */
+    H5VL_NATIVE_ASYNC_FAIL,    /* Finished with an error */
+    H5VL_NATIVE_ASYNC_CANCELED /* Canceled before it ran */
+} H5VL_native_async_state_t;
+
+/* A queued dataset read or write */
+typedef struct H5VL_native_async_req_t {
+    H5VL_native_async_state_t state;    /* State of the request (protected by the engine mutex) */
+    bool                      is_write; /* Whether the request is a write */
+    H5F_shared_t             *f_sh;     /* Shared file the datasets are in */
+
+    /* Copies of the operation's arguments */
+    size_t              count;         /* # of datasets */
+    H5D_t             **dset;          /* Handles on the datasets, held until the request finishes */
+    hid_t              *mem_type_id;   /* Memory datatypes (with an extra reference) */
+    hid_t              *mem_space_id;  /* Copies of the memory dataspaces */
+    hid_t              *file_space_id; /* Copies of the file dataspaces */
+    hid_t               dxpl_id;       /* Copy of the DXPL */
+    H5D_dset_io_info_t *dinfo;         /* Dataset I/O info, set up when the request is queued */
+
+    /* Results of the operation */
+    uint64_t exec_ts;      /* Time the operation started (in us) */
+    uint64_t exec_time;    /* How long the operation ran (in ns) */
+    hid_t    err_stack_id; /* Error stack of a failed operation */
+
+    /* Whether the background thread still has to run or skip the request, and
+     * whether the application freed it meanwhile (protected by the engine mutex)
+     */
+    bool queued;
+    bool freed;
+
+    /* List of requests that haven't finished (protected by the engine mutex) */
+    struct H5VL_native_async_req_t *prev;
+    struct H5VL_native_async_req_t *next;
+} H5VL_native_async_req_t;
+
+/********************/
+/* Local Prototypes */
+/********************/
+static herr_t H5VL__native_async_init(void);
+static herr_t H5VL__native_async_copy_space(hid_t space_id, hid_t *copy_id);
+static herr_t H5VL__native_async_copy_file_space(H5D_t *dset, hid_t space_id, hid_t dxpl_id, hid_t *copy_id);
+static herr_t H5VL__native_async_release(H5VL_native_async_req_t *req);
+static herr_t H5VL__native_async_exec(H5VL_native_async_req_t *req);
+static H5TS_THREAD_RETURN_TYPE H5VL__native_async_do(void *_req);
+static bool                    H5VL__native_async_done(const H5VL_native_async_req_t *req);
+static bool   H5VL__native_async_pending(const H5VL_native_async_req_t *req, const H5F_shared_t *f_sh);
+static herr_t H5VL__native_async_wait(H5VL_native_async_req_t *req, const H5F_shared_t *f_sh,
+                                      uint64_t timeout);
+static H5VL_request_status_t H5VL__native_async_status(const H5VL_native_async_req_t *req);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage H5VL_native_async_req_t structs */
+H5FL_DEFINE_STATIC(H5VL_native_async_req_t);
+
+/* The background thread, and the mutex & condition variable for the requests */
+static H5TS_pool_t *H5VL_native_async_pool_s = NULL;
+static H5TS_mutex_t H5VL_native_async_mutex_s;
+static H5TS_cond_t  H5VL_native_async_cond_s;
+
+/* Requests that haven't finished yet, in the order they were made */
+static H5VL_native_async_req_t *H5VL_native_async_head_s = NULL;
+static H5VL_native_async_req_t *H5VL_native_async_tail_s = NULL;
+
+/* Request the background thread is running, if any, and the thread's ID
+ * (both protected by the engine mutex)
+ */
+static H5VL_native_async_req_t *H5VL_native_async_running_s   = NULL;
+static uint64_t                  H5VL_native_async_thread_id_s = 0;
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_init
+ *
+ * Purpose:     Starts the background thread, the first time a request is
+ *              made.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_async_init(void)
+{
+    bool   have_mutex = false;   /* Whether the mutex was created */
+    bool   have_cond  = false;   /* Whether the condition variable was created */
+    herr_t ret_value  = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(NULL == H5VL_native_async_pool_s);
+
+    if (H5TS_mutex_init(&H5VL_native_async_mutex_s, H5TS_MUTEX_TYPE_PLAIN) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't initialize async request mutex");
+    have_mutex = true;
+    if (H5TS_cond_init(&H5VL_native_async_cond_s) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't initialize async request condition variable");
+    have_cond = true;
+    if (H5TS_pool_create(&H5VL_native_async_pool_s, 1) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create async I/O thread");
+
+done:
+    if (ret_value < 0) {
+        if (have_cond)
+            H5TS_cond_destroy(&H5VL_native_async_cond_s);
+        if (have_mutex)
+            H5TS_mutex_destroy(&H5VL_native_async_mutex_s);
+        H5VL_native_async_pool_s = NULL;
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_term
+ *
+ * Purpose:     Stops the background thread, after it has run the requests
+ *              still queued.
+ *
+ * Note:        Called with the API lock held, which is released while
+ *              waiting for the thread.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_async_term(void)
+{
+    unsigned lock_count = 0;       /* API lock count to restore */
+    herr_t   ret_value  = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5VL_native_async_pool_s) {
+        herr_t status;
+
+        /* Let the background thread take the API lock for its last requests */
+        if (H5TS_api_lock_suspend(&lock_count) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTUNLOCK, FAIL, "can't release API lock");
+        status = H5TS_pool_destroy(H5VL_native_async_pool_s);
+        if (H5TS_api_lock_resume(lock_count) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTLOCK, FAIL, "can't re-acquire API lock");
+        H5VL_native_async_pool_s = NULL;
+        if (status < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't stop async I/O thread");
+
+        assert(NULL == H5VL_native_async_head_s);
+        if (H5TS_cond_destroy(&H5VL_native_async_cond_s) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't destroy async request condition variable");
+        if (H5TS_mutex_destroy(&H5VL_native_async_mutex_s) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't destroy async request mutex");
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_copy_space
+ *
+ * Purpose:     Copies a dataspace argument of a request, so the application
+ *              can change or close the dataspace as soon as the call
+ *              returns.  H5S_ALL, H5S_BLOCK and H5S_PLIST are kept as is.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_async_copy_space(hid_t space_id, hid_t *copy_id)
+{
+    H5S_t *space;               /* Dataspace to copy */
+    H5S_t *copy      = NULL;    /* Copy of the dataspace */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5S_ALL == space_id || H5S_BLOCK == space_id || H5S_PLIST == space_id)
+        *copy_id = space_id;
+    else {
+        if (NULL == (space = (H5S_t *)H5I_object_verify(space_id, H5I_DATASPACE)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace");
+        if (NULL == (copy = H5S_copy(space, false, true)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy dataspace");
+        if ((*copy_id = H5I_register(H5I_DATASPACE, copy, false)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTREGISTER, FAIL, "unable to register dataspace");
+        copy = NULL;
+    }
+
+done:
+    if (copy && H5S_close(copy) < 0)
+        HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release dataspace");
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_copy_space() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_copy_file_space
+ *
+ * Purpose:     Copies the file dataspace argument of a request.  For
+ *              H5S_PLIST, the copy is a copy of the dataset's dataspace
+ *              with the DXPL's selection, so that the dataset's own
+ *              dataspace isn't changed while the request is queued.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_async_copy_file_space(H5D_t *dset, hid_t space_id, hid_t dxpl_id, hid_t *copy_id)
+{
+    H5P_genplist_t *plist;              /* DXPL with the selection */
+    H5S_t          *sel_space = NULL;   /* Dataspace holding the selection */
+    H5S_t          *copy      = NULL;   /* Copy of the dataspace */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5S_PLIST != space_id)
+        HGOTO_DONE(H5VL__native_async_copy_space(space_id, copy_id));
+
+    /* Get the selection from the DXPL */
+    if (NULL == (plist = H5P_object_verify(dxpl_id, H5P_DATASET_XFER, true)))
+        HGOTO_ERROR(H5E_DATASET, H5E_BADID, FAIL, "bad dataset transfer property list");
+    if (H5P_peek(plist, H5D_XFER_DSET_IO_SEL_NAME, &sel_space) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error getting dataset I/O selection");
+    if (NULL == sel_space)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "no dataset I/O selection in DXPL");
+
+    /* Copy the dataset's dataspace, with the selection */
+    if (NULL == (copy = H5S_copy(dset->shared->space, false, true)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy dataspace");
+    if (H5S_SELECT_COPY(copy, sel_space, false) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy dataset I/O selection");
+    if ((*copy_id = H5I_register(H5I_DATASPACE, copy, false)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTREGISTER, FAIL, "unable to register dataspace");
+    copy = NULL;
+
+done:
+    if (copy && H5S_close(copy) < 0)
+        HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release dataspace");
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_copy_file_space() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_release
+ *
+ * Purpose:     Releases a request's dataset I/O info, the handles on its
+ *              datasets and the copies of its arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_async_release(H5VL_native_async_req_t *req)
+{
+    size_t u;
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (req->dinfo &&
+        H5VL__native_dataset_io_cleanup(req->count, req->mem_space_id, req->file_space_id, req->dinfo) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release dataset I/O info");
+    for (u = 0; u < req->count; u++) {
+        if (req->mem_type_id[u] > 0 && H5I_dec_ref(req->mem_type_id[u]) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTDEC, FAIL, "can't release memory datatype");
+        if (req->mem_space_id[u] > H5S_PLIST && H5I_dec_ref(req->mem_space_id[u]) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTDEC, FAIL, "can't release memory dataspace");
+        if (req->file_space_id[u] > H5S_PLIST && H5I_dec_ref(req->file_space_id[u]) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTDEC, FAIL, "can't release file dataspace");
+        if (req->dset[u] && H5D_close(req->dset[u]) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't close dataset");
+    }
+    if (req->dxpl_id > 0 && req->dxpl_id != H5P_DATASET_XFER_DEFAULT && H5I_dec_ref(req->dxpl_id) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTDEC, FAIL, "can't release DXPL");
+
+    req->dset          = H5MM_xfree(req->dset);
+    req->mem_type_id   = H5MM_xfree(req->mem_type_id);
+    req->mem_space_id  = H5MM_xfree(req->mem_space_id);
+    req->file_space_id = H5MM_xfree(req->file_space_id);
+    req->dinfo         = H5MM_xfree(req->dinfo);
+    req->count         = 0;
+    req->dxpl_id       = H5I_INVALID_HID;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_dataset_io
+ *
+ * Purpose:     Checks the arguments of a dataset read or write and sets up
+ *              its dataspaces, then queues it for the background thread.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_async_dataset_io(bool is_write, size_t count, void *obj[], hid_t mem_type_id[],
+                              hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id,
+                              H5_flexible_const_ptr_t buf[], void **req)
+{
+    H5VL_native_async_req_t *new_req   = NULL;    /* New request */
+    size_t                   u;                   /* Local index variable */
+    herr_t                   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(count > 0);
+    assert(req);
+
+    /* Start the background thread, the first time it's needed */
+    if (NULL == H5VL_native_async_pool_s)
+        if (H5VL__native_async_init() < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't start async I/O thread");
+
+    /* Allocate the request */
+    if (NULL == (new_req = H5FL_CALLOC(H5VL_native_async_req_t)))
+        HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate async request");
+    new_req->state        = H5VL_NATIVE_ASYNC_QUEUED;
+    new_req->is_write     = is_write;
+    new_req->f_sh         = H5F_SHARED(((H5D_t *)obj[0])->oloc.file);
+    new_req->dxpl_id      = H5I_INVALID_HID;
+    new_req->err_stack_id = H5I_INVALID_HID;
+    if (NULL == (new_req->dset = (H5D_t **)H5MM_calloc(count * sizeof(H5D_t *))) ||
+        NULL == (new_req->mem_type_id = (hid_t *)H5MM_calloc(count * sizeof(hid_t))) ||
+        NULL == (new_req->mem_space_id = (hid_t *)H5MM_calloc(count * sizeof(hid_t))) ||
+        NULL == (new_req->file_space_id = (hid_t *)H5MM_calloc(count * sizeof(hid_t))))
+        HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate async request arguments");
+    new_req->count = count;
+
+    /* Copy the DXPL */
+    if (H5P_DATASET_XFER_DEFAULT == dxpl_id)
+        new_req->dxpl_id = dxpl_id;
+    else {
+        H5P_genplist_t *plist; /* DXPL to copy */
+
+        if (NULL == (plist = (H5P_genplist_t *)H5I_object_verify(dxpl_id, H5I_GENPROP_LST)))
+            HGOTO_ERROR(H5E_VOL, H5E_BADID, FAIL, "can't get DXPL");
+        if ((new_req->dxpl_id = H5P_copy_plist(plist, false)) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTCOPY, FAIL, "can't copy DXPL");
+    }
+
+    /* Hold the datasets and copy the other arguments */
+    for (u = 0; u < count; u++) {
+        if (NULL == ((H5D_t *)obj[u])->oloc.file)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file");
+        if (NULL == (new_req->dset[u] = H5D_reopen((H5D_t *)obj[u])))
+            HGOTO_ERROR(H5E_VOL, H5E_CANTOPENOBJ, FAIL, "can't hold dataset");
+        if (H5I_inc_ref(mem_type_id[u], false) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTINC, FAIL, "can't hold memory datatype");
+        new_req->mem_type_id[u] = mem_type_id[u];
+        if (H5VL__native_async_copy_space(mem_space_id[u], &new_req->mem_space_id[u]) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTCOPY, FAIL, "can't copy memory dataspace");
+        if (H5VL__native_async_copy_file_space(new_req->dset[u], file_space_id[u], dxpl_id,
+                                               &new_req->file_space_id[u]) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTCOPY, FAIL, "can't copy file dataspace");
+    }
+
+    /* Check the arguments and set up the dataspaces, as the synchronous call would */
+    if (NULL == (new_req->dinfo = (H5D_dset_io_info_t *)H5MM_calloc(count * sizeof(H5D_dset_io_info_t))))
+        HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "couldn't allocate dset info array buffer");
+    if (H5VL__native_dataset_io_setup(count, (void **)new_req->dset, new_req->mem_type_id,
+                                      new_req->mem_space_id, new_req->file_space_id, new_req->dxpl_id, buf,
+                                      new_req->dinfo) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up file and memory dataspaces");
+
+    /* Add the request to the end of the list of unfinished requests */
+    if (H5TS_mutex_lock(&H5VL_native_async_mutex_s) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTLOCK, FAIL, "can't lock async request mutex");
+    new_req->queued = true;
+    new_req->prev   = H5VL_native_async_tail_s;
+    if (H5VL_native_async_tail_s)
+        H5VL_native_async_tail_s->next = new_req;
+    else
+        H5VL_native_async_head_s = new_req;
+    H5VL_native_async_tail_s = new_req;
+    if (H5TS_mutex_unlock(&H5VL_native_async_mutex_s) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTUNLOCK, FAIL, "can't unlock async request mutex");
+
+    /* Hand the request to the background thread */
+    if (H5TS_pool_add_task(H5VL_native_async_pool_s, H5VL__native_async_do, new_req) < 0) {
+        if (H5TS_mutex_lock(&H5VL_native_async_mutex_s) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTLOCK, FAIL, "can't lock async request mutex");
+        if (new_req->prev)
+            new_req->prev->next = new_req->next;
+        else
+            H5VL_native_async_head_s = new_req->next;
+        if (new_req->next)
+            new_req->next->prev = new_req->prev;
+        else
+            H5VL_native_async_tail_s = new_req->prev;
+        if (H5TS_mutex_unlock(&H5VL_native_async_mutex_s) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTUNLOCK, FAIL, "can't unlock async request mutex");
+        HGOTO_ERROR(H5E_VOL, H5E_CANTINSERT, FAIL, "can't queue async request");
+    }
+
+    *req    = new_req;
+    new_req = NULL;
+
+done:
+    if (new_req) {
+        if (new_req->count > 0 && H5VL__native_async_release(new_req) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release async request arguments");
+        H5MM_xfree(new_req->dset);
+        H5MM_xfree(new_req->mem_type_id);
+        H5MM_xfree(new_req->mem_space_id);
+        H5MM_xfree(new_req->file_space_id);
+        new_req = H5FL_FREE(H5VL_native_async_req_t, new_req);
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_dataset_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_exec
+ *
+ * Purpose:     Runs a request on the background thread, which holds the
+ *              API lock.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_async_exec(H5VL_native_async_req_t *req)
+{
+    H5CX_node_t               api_ctx   = {{0}, NULL};            /* API context node to push */
+    H5VL_native_async_state_t state     = H5VL_NATIVE_ASYNC_FAIL; /* Final state of the request */
+    uint64_t                  thread_id = 0;                      /* ID of the background thread */
+    bool                      free_req  = false;                  /* Whether the request was freed */
+    herr_t                    ret_value = SUCCEED;                /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5TS_thread_id(&thread_id) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get thread ID");
+
+    /* Skip requests that were canceled while they were queued */
+    if (H5TS_mutex_lock(&H5VL_native_async_mutex_s) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTLOCK, FAIL, "can't lock async request mutex");
+    if (H5VL_NATIVE_ASYNC_CANCELED == req->state)
+        state = H5VL_NATIVE_ASYNC_CANCELED;
+    else {
+        req->state                    = H5VL_NATIVE_ASYNC_RUNNING;
+        state                         = H5VL_NATIVE_ASYNC_SUCCEED;
+        H5VL_native_async_running_s   = req;
+        H5VL_native_async_thread_id_s = thread_id;
+    }
+    if (H5TS_mutex_unlock(&H5VL_native_async_mutex_s) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTUNLOCK, FAIL, "can't unlock async request mutex");
+
+    if (H5VL_NATIVE_ASYNC_SUCCEED == state) {
+        herr_t status;
+
+        /* Run the operation, as an API call would */
+        H5E_clear_stack();
+        if (H5CX_push(&api_ctx) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set API context");
+        H5CX_set_dxpl(req->dxpl_id);
+        req->exec_ts = H5_now_usec();
+        if (req->is_write)
+            status = H5D__write(req->count, req->dinfo);
+        else
+            status = H5D__read(req->count, req->dinfo);
+        req->exec_time = (H5_now_usec() - req->exec_ts) * 1000;
+        (void)H5CX_pop(false);
+
+        /* Keep the errors for the application */
+        if (status < 0) {
+            state             = H5VL_NATIVE_ASYNC_FAIL;
+            req->err_stack_id = H5E_get_current_stack();
+        }
+    }
+
+done:
+    /* Release the arguments and the dataset handles, then publish the
+     * request's final state.  The request may be freed as soon as the state
+     * is set, except for a canceled request, which the application may have
+     * freed already, leaving it to be freed here.
+     */
+    if (H5VL__native_async_release(req) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release async request arguments");
+    if (ret_value < 0)
+        state = H5VL_NATIVE_ASYNC_FAIL;
+    if (H5TS_mutex_lock(&H5VL_native_async_mutex_s) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTLOCK, FAIL, "can't lock async request mutex");
+    if (req->prev)
+        req->prev->next = req->next;
+    else
+        H5VL_native_async_head_s = req->next;
+    if (req->next)
+        req->next->prev = req->prev;
+    else
+        H5VL_native_async_tail_s = req->prev;
+    req->prev = req->next       = NULL;
+    req->state                  = state;
+    req->queued                 = false;
+    free_req                    = req->freed;
+    H5VL_native_async_running_s = NULL;
+    if (H5TS_cond_broadcast(&H5VL_native_async_cond_s) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTNOTIFY, FAIL, "can't signal async request completion");
+    if (H5TS_mutex_unlock(&H5VL_native_async_mutex_s) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTUNLOCK, FAIL, "can't unlock async request mutex");
+    if (free_req)
+        req = H5FL_FREE(H5VL_native_async_req_t, req);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_exec() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_do
+ *
+ * Purpose:     Task routine for the background thread, which enters the
+ *              library like an application thread calling the API.
+ *
+ * Return:      0
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5TS_THREAD_RETURN_TYPE
+H5VL__native_async_do(void *_req)
+{
+    H5_API_SETUP_PUBLIC_API_VARS
+
+    /* Acquire the API lock */
+    H5_API_LOCK
+
+    (void)H5VL__native_async_exec((H5VL_native_async_req_t *)_req);
+
+    /* Release the API lock */
+    H5_API_UNLOCK
+
+    return (H5TS_thread_ret_t)0;
+} /* end H5VL__native_async_do() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_done
+ *
+ * Purpose:     Checks whether a request has finished.  The engine mutex
+ *              must be held.
+ *
+ * Return:      true/false
+ *
+ *-------------------------------------------------------------------------
+ */
+static bool
+H5VL__native_async_done(const H5VL_native_async_req_t *req)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(H5VL_NATIVE_ASYNC_QUEUED != req->state && H5VL_NATIVE_ASYNC_RUNNING != req->state)
+} /* end H5VL__native_async_done() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_status
+ *
+ * Purpose:     Translates the state of a request into a VOL request
+ *              status.  The engine mutex must be held.
+ *
+ * Return:      The request's status
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5VL_request_status_t
+H5VL__native_async_status(const H5VL_native_async_req_t *req)
+{
+    H5VL_request_status_t ret_value = H5VL_REQUEST_STATUS_IN_PROGRESS; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (H5VL_NATIVE_ASYNC_SUCCEED == req->state)
+        ret_value = H5VL_REQUEST_STATUS_SUCCEED;
+    else if (H5VL_NATIVE_ASYNC_FAIL == req->state)
+        ret_value = H5VL_REQUEST_STATUS_FAIL;
+    else if (H5VL_NATIVE_ASYNC_CANCELED == req->state)
+        ret_value = H5VL_REQUEST_STATUS_CANCELED;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_status() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_pending
+ *
+ * Purpose:     Checks whether a request hasn't finished, or, when REQ is
+ *              NULL, whether any request on a file hasn't finished.  The
+ *              engine mutex must be held.
+ *
+ * Return:      true/false
+ *
+ *-------------------------------------------------------------------------
+ */
+static bool
+H5VL__native_async_pending(const H5VL_native_async_req_t *req, const H5F_shared_t *f_sh)
+{
+    const H5VL_native_async_req_t *curr;
+    bool                           ret_value = false; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (req)
+        ret_value = !H5VL__native_async_done(req);
+    else
+        for (curr = H5VL_native_async_head_s; curr && !ret_value; curr = curr->next)
+            ret_value = (curr->f_sh == f_sh);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_pending() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_wait
+ *
+ * Purpose:     Waits for a request to finish, or for a timeout (in ns) to
+ *              expire.  When REQ is NULL, waits for all the requests on a
+ *              file instead.  Unfinished requests are never freed, so the
+ *              list of them can be checked after each wakeup.
+ *
+ * Note:        The API lock is released while waiting, so that the
+ *              background thread can run the requests.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_async_wait(H5VL_native_async_req_t *req, const H5F_shared_t *f_sh, uint64_t timeout)
+{
+    unsigned lock_count = 0;       /* API lock count to restore */
+    bool     suspended  = false;   /* Whether the API lock is released */
+    bool     locked     = false;   /* Whether the engine mutex is held */
+    uint64_t start      = 0;       /* Time waiting started (in us) */
+    herr_t   ret_value  = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5TS_api_lock_suspend(&lock_count) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTUNLOCK, FAIL, "can't release API lock");
+    suspended = true;
+
+    if (H5TS_mutex_lock(&H5VL_native_async_mutex_s) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTLOCK, FAIL, "can't lock async request mutex");
+    locked = true;
+    if (H5ES_WAIT_FOREVER != timeout)
+        start = H5_now_usec();
+    while (H5VL__native_async_pending(req, f_sh)) {
+        if (H5ES_WAIT_FOREVER == timeout) {
+            if (H5TS_cond_wait(&H5VL_native_async_cond_s, &H5VL_native_async_mutex_s) < 0)
+                HGOTO_ERROR(H5E_VOL, H5E_CANTWAIT, FAIL, "can't wait for async request");
+        }
+        else {
+            /* There's no timed wait on a condition variable, so poll */
+            if ((H5_now_usec() - start) * 1000 >= timeout)
+                break;
+            locked = false;
+            if (H5TS_mutex_unlock(&H5VL_native_async_mutex_s) < 0)
+                HGOTO_ERROR(H5E_VOL, H5E_CANTUNLOCK, FAIL, "can't unlock async request mutex");
+            H5_nanosleep(MIN(timeout, H5VL_NATIVE_ASYNC_POLL_NS));
+            if (H5TS_mutex_lock(&H5VL_native_async_mutex_s) < 0)
+                HGOTO_ERROR(H5E_VOL, H5E_CANTLOCK, FAIL, "can't lock async request mutex");
+            locked = true;
+        }
+    }
+
+done:
+    if (locked && H5TS_mutex_unlock(&H5VL_native_async_mutex_s) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTUNLOCK, FAIL, "can't unlock async request mutex");
+    if (suspended && H5TS_api_lock_resume(lock_count) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTLOCK, FAIL, "can't re-acquire API lock");
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_wait() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_wait_file
+ *
+ * Purpose:     Waits for the requests on a file that haven't finished, so
+ *              a synchronous operation on the file sees their effects.
+ *
+ *              The dataset callbacks, H5Fflush, H5Fclose, and the object
+ *              and link callbacks that can copy, change or remove
+ *              datasets call this first.  Callbacks that only touch
+ *              other objects' metadata don't need to, since the requests
+ *              only read and write raw data, under the API lock.
+ *
+ * Note:        Does nothing on the background thread itself while it is
+ *              running a request, since that request would never finish.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_async_wait_file(const H5F_t *f)
+{
+    bool   pending   = false;   /* Whether there are unfinished requests on the file */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5VL_native_async_pool_s) {
+        uint64_t thread_id; /* ID of the calling thread */
+
+        if (H5TS_thread_id(&thread_id) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get thread ID");
+
+        if (H5TS_mutex_lock(&H5VL_native_async_mutex_s) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTLOCK, FAIL, "can't lock async request mutex");
+        if (NULL == H5VL_native_async_running_s || thread_id != H5VL_native_async_thread_id_s)
+            pending = H5VL__native_async_pending(NULL, H5F_SHARED(f));
+        if (H5TS_mutex_unlock(&H5VL_native_async_mutex_s) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTUNLOCK, FAIL, "can't unlock async request mutex");
+
+        if (pending && H5VL__native_async_wait(NULL, H5F_SHARED(f), H5ES_WAIT_FOREVER) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTWAIT, FAIL, "can't wait for async requests on file");
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_wait_file() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_wait_obj
+ *
+ * Purpose:     Waits for the requests on the file of an object that
+ *              haven't finished.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_async_wait_obj(void *obj, H5I_type_t obj_type)
+{
+    H5F_t *f         = NULL;    /* File of the object */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5VL_native_async_pool_s) {
+        if (H5VL_native_get_file_struct(obj, obj_type, &f) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object");
+        if (f && H5VL__native_async_wait_file(f) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTWAIT, FAIL, "can't wait for async requests on file");
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_wait_obj() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_wait
+ *
+ * Purpose:     Handles the request wait callback
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_wait(void *_req, uint64_t timeout, H5VL_request_status_t *status)
+{
+    H5VL_native_async_req_t *req       = (H5VL_native_async_req_t *)_req;
+    herr_t                   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(req);
+    assert(status);
+
+    /* Wait, unless the caller is only testing the request */
+    if (H5ES_WAIT_NONE != timeout)
+        if (H5VL__native_async_wait(req, NULL, timeout) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTWAIT, FAIL, "can't wait for async request");
+
+    if (H5TS_mutex_lock(&H5VL_native_async_mutex_s) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTLOCK, FAIL, "can't lock async request mutex");
+    *status = H5VL__native_async_status(req);
+    if (H5TS_mutex_unlock(&H5VL_native_async_mutex_s) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTUNLOCK, FAIL, "can't unlock async request mutex");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_wait() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_cancel
+ *
+ * Purpose:     Handles the request cancel callback.  Only requests that the
+ *              background thread hasn't started can be canceled.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_cancel(void *_req, H5VL_request_status_t *status)
+{
+    H5VL_native_async_req_t *req       = (H5VL_native_async_req_t *)_req;
+    herr_t                   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(req);
+    assert(status);
+
+    if (H5TS_mutex_lock(&H5VL_native_async_mutex_s) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTLOCK, FAIL, "can't lock async request mutex");
+    if (H5VL_NATIVE_ASYNC_QUEUED == req->state) {
+        req->state = H5VL_NATIVE_ASYNC_CANCELED;
+        *status    = H5VL_REQUEST_STATUS_CANCELED;
+    }
+    else if (H5VL_NATIVE_ASYNC_RUNNING == req->state)
+        *status = H5VL_REQUEST_STATUS_CANT_CANCEL;
+    else
+        *status = H5VL__native_async_status(req);
+    if (H5TS_mutex_unlock(&H5VL_native_async_mutex_s) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTUNLOCK, FAIL, "can't unlock async request mutex");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_cancel() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_specific
+ *
+ * Purpose:     Handles the request specific callback
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_specific(void *_req, H5VL_request_specific_args_t *args)
+{
+    H5VL_native_async_req_t *req       = (H5VL_native_async_req_t *)_req;
+    herr_t                   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(req);
+    assert(args);
+
+    switch (args->op_type) {
+        case H5VL_REQUEST_GET_ERR_STACK:
+            /* Hand out a reference to the request's error stack */
+            if (H5I_INVALID_HID != req->err_stack_id && H5I_inc_ref(req->err_stack_id, true) < 0)
+                HGOTO_ERROR(H5E_VOL, H5E_CANTINC, FAIL, "can't hold error stack");
+            args->args.get_err_stack.err_stack_id = req->err_stack_id;
+            break;
+
+        case H5VL_REQUEST_GET_EXEC_TIME:
+            *args->args.get_exec_time.exec_ts   = req->exec_ts;
+            *args->args.get_exec_time.exec_time = req->exec_time;
+            break;
+
+        default:
+            HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid specific operation");
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_specific() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_free
+ *
+ * Purpose:     Handles the request free callback.  A request that hasn't
+ *              finished is waited for first.
+ *
+ *              A request canceled while it was queued is still on the
+ *              background thread's queue, so it is left for the background
+ *              thread to free when it skips the request.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_free(void *_req)
+{
+    H5VL_native_async_req_t *req       = (H5VL_native_async_req_t *)_req;
+    bool                     done      = false;   /* Whether the request has finished */
+    bool                     handed    = false;   /* Whether the background thread frees the request */
+    herr_t                   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(req);
+
+    if (H5TS_mutex_lock(&H5VL_native_async_mutex_s) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTLOCK, FAIL, "can't lock async request mutex");
+    done = H5VL__native_async_done(req);
+    if (done && req->queued) {
+        assert(H5VL_NATIVE_ASYNC_CANCELED == req->state);
+        assert(H5I_INVALID_HID == req->err_stack_id);
+        req->freed = true;
+        handed     = true;
+    }
+    if (H5TS_mutex_unlock(&H5VL_native_async_mutex_s) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTUNLOCK, FAIL, "can't unlock async request mutex");
+    if (handed)
+        HGOTO_DONE(SUCCEED);
+    if (!done && H5VL__native_async_wait(req, NULL, H5ES_WAIT_FOREVER) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTWAIT, FAIL, "can't wait for async request");
+
+    if (H5I_INVALID_HID != req->err_stack_id && H5I_dec_app_ref(req->err_stack_id) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTDEC, FAIL, "can't release error stack");
+    req = H5FL_FREE(H5VL_native_async_req_t, req);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_free() */
+
+#endif /* H5_HAVE_THREADSAFE_API */
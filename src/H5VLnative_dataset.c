@@ -50,13 +50,6 @@
 /* Local Prototypes */
 /********************/
 
-/* Helper routines for read/write API calls */
-static herr_t H5VL__native_dataset_io_setup(size_t count, void *obj[], hid_t mem_type_id[],
-                                            hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id,
-                                            H5_flexible_const_ptr_t buf[], H5D_dset_io_info_t *dinfo);
-static herr_t H5VL__native_dataset_io_cleanup(size_t count, hid_t mem_space_id[], hid_t file_space_id[],
-                                              H5D_dset_io_info_t *dinfo);
-
 /*********************/
 /* Package Variables */
 /*********************/
@@ -78,7 +71,7 @@ static herr_t H5VL__native_dataset_io_cleanup(size_t count, hid_t mem_space_id[]
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
+herr_t
 H5VL__native_dataset_io_setup(size_t count, void *obj[], hid_t mem_type_id[], hid_t mem_space_id[],
                               hid_t file_space_id[], hid_t dxpl_id, H5_flexible_const_ptr_t buf[],
                               H5D_dset_io_info_t *dinfo)
@@ -208,7 +201,7 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
+herr_t
 H5VL__native_dataset_io_cleanup(size_t count, hid_t mem_space_id[], hid_t file_space_id[],
                                 H5D_dset_io_info_t *dinfo)
 {
@@ -351,15 +344,34 @@ H5VL__native_dataset_read(size_t count, void *obj[], hid_t mem_type_id[], hid_t
                           hid_t file_space_id[], hid_t dxpl_id, void *buf[], void H5_ATTR_UNUSED **req)
 {
     H5D_dset_io_info_t  dinfo_local;
-    H5D_dset_io_info_t *dinfo     = &dinfo_local;
+    H5D_dset_io_info_t *dinfo     = NULL;
     herr_t              ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
+#ifdef H5_HAVE_THREADSAFE_API
+    if (((H5D_t *)obj[0])->oloc.file) {
+        /* Queue the read for the asynchronous I/O thread, if the file uses it */
+        if (req && H5F_NATIVE_ASYNC_IO(((H5D_t *)obj[0])->oloc.file)) {
+            if (H5VL__native_async_dataset_io(false, count, obj, mem_type_id, mem_space_id, file_space_id,
+                                              dxpl_id, (H5_flexible_const_ptr_t *)buf, req) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't queue asynchronous read");
+            HGOTO_DONE(SUCCEED);
+        }
+
+        /* Wait for the asynchronous I/O queued on the file to finish first */
+        if (H5VL__native_async_wait_file(((H5D_t *)obj[0])->oloc.file) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+    }
+#endif /* H5_HAVE_THREADSAFE_API */
+
     /* Allocate dataset info array if necessary */
-    if (count > 1)
+    if (count > 1) {
         if (NULL == (dinfo = (H5D_dset_io_info_t *)H5MM_malloc(count * sizeof(H5D_dset_io_info_t))))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate dset info array buffer");
+    }
+    else
+        dinfo = &dinfo_local;
 
     /* Get file & memory dataspaces */
     if (H5VL__native_dataset_io_setup(count, obj, mem_type_id, mem_space_id, file_space_id, dxpl_id,
@@ -375,10 +387,10 @@ H5VL__native_dataset_read(size_t count, void *obj[], hid_t mem_type_id[], hid_t
 
 done:
     /* Clean up */
-    if (H5VL__native_dataset_io_cleanup(count, mem_space_id, file_space_id, dinfo) < 0)
+    if (dinfo && H5VL__native_dataset_io_cleanup(count, mem_space_id, file_space_id, dinfo) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release dataset info");
 
-    if (dinfo != &dinfo_local)
+    if (dinfo && dinfo != &dinfo_local)
         H5MM_xfree(dinfo);
 
     FUNC_LEAVE_NOAPI(ret_value)
@@ -398,15 +410,34 @@ H5VL__native_dataset_write(size_t count, void *obj[], hid_t mem_type_id[], hid_t
                            hid_t file_space_id[], hid_t dxpl_id, const void *buf[], void H5_ATTR_UNUSED **req)
 {
     H5D_dset_io_info_t  dinfo_local;
-    H5D_dset_io_info_t *dinfo     = &dinfo_local;
+    H5D_dset_io_info_t *dinfo     = NULL;
     herr_t              ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
+#ifdef H5_HAVE_THREADSAFE_API
+    if (((H5D_t *)obj[0])->oloc.file) {
+        /* Queue the write for the asynchronous I/O thread, if the file uses it */
+        if (req && H5F_NATIVE_ASYNC_IO(((H5D_t *)obj[0])->oloc.file)) {
+            if (H5VL__native_async_dataset_io(true, count, obj, mem_type_id, mem_space_id, file_space_id,
+                                              dxpl_id, (H5_flexible_const_ptr_t *)buf, req) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't queue asynchronous write");
+            HGOTO_DONE(SUCCEED);
+        }
+
+        /* Wait for the asynchronous I/O queued on the file to finish first */
+        if (H5VL__native_async_wait_file(((H5D_t *)obj[0])->oloc.file) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+    }
+#endif /* H5_HAVE_THREADSAFE_API */
+
     /* Allocate dataset info array if necessary */
-    if (count > 1)
+    if (count > 1) {
         if (NULL == (dinfo = (H5D_dset_io_info_t *)H5MM_malloc(count * sizeof(H5D_dset_io_info_t))))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate dset info array buffer");
+    }
+    else
+        dinfo = &dinfo_local;
 
     /* Get file & memory dataspaces */
     if (H5VL__native_dataset_io_setup(count, obj, mem_type_id, mem_space_id, file_space_id, dxpl_id,
@@ -422,10 +453,10 @@ H5VL__native_dataset_write(size_t count, void *obj[], hid_t mem_type_id[], hid_t
 
 done:
     /* Clean up */
-    if (H5VL__native_dataset_io_cleanup(count, mem_space_id, file_space_id, dinfo) < 0)
+    if (dinfo && H5VL__native_dataset_io_cleanup(count, mem_space_id, file_space_id, dinfo) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release dataset info");
 
-    if (dinfo != &dinfo_local)
+    if (dinfo && dinfo != &dinfo_local)
         H5MM_xfree(dinfo);
 
     FUNC_LEAVE_NOAPI(ret_value)
@@ -449,6 +480,12 @@ H5VL__native_dataset_get(void *obj, H5VL_dataset_get_args_t *args, hid_t H5_ATTR
 
     FUNC_ENTER_PACKAGE
 
+#ifdef H5_HAVE_THREADSAFE_API
+    /* Wait for the asynchronous I/O queued on the file to finish first */
+    if (H5VL__native_async_wait_file(dset->oloc.file) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+#endif /* H5_HAVE_THREADSAFE_API */
+
     switch (args->op_type) {
         /* H5Dget_space */
         case H5VL_DATASET_GET_SPACE: {
@@ -523,6 +560,12 @@ H5VL__native_dataset_specific(void *obj, H5VL_dataset_specific_args_t *args, hid
 
     FUNC_ENTER_PACKAGE
 
+#ifdef H5_HAVE_THREADSAFE_API
+    /* Wait for the asynchronous I/O queued on the file to finish first */
+    if (H5VL__native_async_wait_file(dset->oloc.file) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+#endif /* H5_HAVE_THREADSAFE_API */
+
     switch (args->op_type) {
         /* H5Dset_extent (H5Dextend - deprecated) */
         case H5VL_DATASET_SET_EXTENT: {
@@ -576,6 +619,12 @@ H5VL__native_dataset_optional(void *obj, H5VL_optional_args_t *args, hid_t dxpl_
     /* Sanity checks */
     assert(dset);
 
+#ifdef H5_HAVE_THREADSAFE_API
+    /* Wait for the asynchronous I/O queued on the file to finish first */
+    if (H5VL__native_async_wait_file(dset->oloc.file) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+#endif /* H5_HAVE_THREADSAFE_API */
+
     /* Set DXPL for operation */
     H5CX_set_dxpl(dxpl_id);
 
@@ -781,6 +830,20 @@ H5VL__native_dataset_optional(void *obj, H5VL_optional_args_t *args, hid_t dxpl_
             break;
         }
 
+        /* H5Dread_view */
+        case H5VL_NATIVE_DATASET_READ_VIEW: {
+            const H5T_t *mem_type;
+
+            if (NULL ==
+                (mem_type = (const H5T_t *)H5I_object_verify(opt_args->read_view.type_id, H5I_DATATYPE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype");
+
+            if (H5D__read_view(dset, mem_type, opt_args->read_view.buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get view of dataset's data");
+
+            break;
+        }
+
         /* H5Dchunk_iter */
         case H5VL_NATIVE_DATASET_CHUNK_ITER: {
             /* Sanity check */
@@ -823,6 +886,12 @@ H5VL__native_dataset_close(void *dset, hid_t H5_ATTR_UNUSED dxpl_id, void H5_ATT
 
     FUNC_ENTER_PACKAGE
 
+#ifdef H5_HAVE_THREADSAFE_API
+    /* Wait for the asynchronous I/O queued on the file, which may use the dataset */
+    if (H5VL__native_async_wait_file(((H5D_t *)dset)->oloc.file) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+#endif /* H5_HAVE_THREADSAFE_API */
+
     if (H5D_close((H5D_t *)dset) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't close dataset");
 
@@ -298,6 +298,12 @@ H5VL__native_file_specific(void *obj, H5VL_file_specific_args_t *args, hid_t H5_
             if (H5VL_native_get_file_struct(obj, args->args.flush.obj_type, &f) < 0)
                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object");
 
+#ifdef H5_HAVE_THREADSAFE_API
+            /* Wait for the asynchronous I/O queued on the file, so it's flushed too */
+            if (H5VL__native_async_wait_file(f) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+#endif /* H5_HAVE_THREADSAFE_API */
+
             /* Nothing to do if the file is read only. This determination is
              * made at the shared open(2) flags level, implying that opening a
              * file twice, once for read-only and once for read-write, and then
@@ -392,6 +398,12 @@ H5VL__native_file_optional(void *obj, H5VL_optional_args_t *args, hid_t H5_ATTR_
 
     FUNC_ENTER_PACKAGE
 
+#ifdef H5_HAVE_THREADSAFE_API
+    /* Wait for the asynchronous I/O queued on the file to finish first */
+    if (H5VL__native_async_wait_file(f) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+#endif /* H5_HAVE_THREADSAFE_API */
+
     switch (args->op_type) {
         /* H5Fget_filesize */
         case H5VL_NATIVE_FILE_GET_SIZE: {
@@ -719,6 +731,18 @@ H5VL__native_file_optional(void *obj, H5VL_optional_args_t *args, hid_t H5_ATTR_
             break;
         }
 
+        /* H5Fget_mdc_type_stats */
+        case H5VL_NATIVE_FILE_GET_MDC_TYPE_STATS: {
+            H5VL_native_file_get_mdc_type_stats_t *gmts_args = &opt_args->get_mdc_type_stats;
+
+            /* Get the per-type statistics */
+            if (H5AC_get_cache_type_stats(f->shared->cache, gmts_args->ntypes, gmts_args->stats,
+                                          gmts_args->total_ntypes) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get metadata cache type statistics");
+
+            break;
+        }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation");
     } /* end switch */
@@ -754,6 +778,11 @@ H5VL__native_file_close(void *file, hid_t H5_ATTR_UNUSED dxpl_id, void H5_ATTR_U
         f = H5FL_FREE(H5F_t, f);
 
     else {
+#ifdef H5_HAVE_THREADSAFE_API
+        /* Wait for the asynchronous I/O queued on the file to finish first */
+        if (H5VL__native_async_wait_file(f) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+#endif /* H5_HAVE_THREADSAFE_API */
 
         /* Flush file if this is the last reference to this id and we have write
          * intent, unless it will be flushed by the "shared" file being closed.
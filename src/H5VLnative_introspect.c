@@ -123,6 +123,7 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                     break;
 
                 case H5VL_NATIVE_DATASET_CHUNK_READ:
+                case H5VL_NATIVE_DATASET_READ_VIEW:
                     *flags |= H5VL_OPT_QUERY_READ_DATA;
                     break;
 
@@ -187,6 +188,7 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                 case H5VL_NATIVE_FILE_SET_MPI_ATOMICITY:
 #endif /* H5_HAVE_PARALLEL */
                 case H5VL_NATIVE_FILE_POST_OPEN:
+                case H5VL_NATIVE_FILE_GET_MDC_TYPE_STATS:
                     break;
 
                 default:
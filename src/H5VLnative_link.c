@@ -180,6 +180,14 @@ H5VL__native_link_copy(void *src_obj, const H5VL_loc_params_t *loc_params1, void
     else if (NULL == dst_obj)
         dst_loc_p = src_loc_p;
 
+#ifdef H5_HAVE_THREADSAFE_API
+    /* Wait for the asynchronous I/O queued on the files to finish first */
+    if (H5VL__native_async_wait_file(src_loc_p->oloc->file) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+    if (H5VL__native_async_wait_file(dst_loc_p->oloc->file) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+#endif /* H5_HAVE_THREADSAFE_API */
+
     /* Copy the link */
     if (H5L__move(src_loc_p, loc_params1->loc_data.loc_by_name.name, dst_loc_p,
                   loc_params2->loc_data.loc_by_name.name, true, lcpl_id) < 0)
@@ -222,6 +230,14 @@ H5VL__native_link_move(void *src_obj, const H5VL_loc_params_t *loc_params1, void
     else if (NULL == dst_obj)
         dst_loc_p = src_loc_p;
 
+#ifdef H5_HAVE_THREADSAFE_API
+    /* Wait for the asynchronous I/O queued on the files to finish first */
+    if (H5VL__native_async_wait_file(src_loc_p->oloc->file) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+    if (H5VL__native_async_wait_file(dst_loc_p->oloc->file) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+#endif /* H5_HAVE_THREADSAFE_API */
+
     /* Move the link */
     if (H5L__move(src_loc_p, loc_params1->loc_data.loc_by_name.name, dst_loc_p,
                   loc_params2->loc_data.loc_by_name.name, false, lcpl_id) < 0)
@@ -331,6 +347,12 @@ H5VL__native_link_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_
 
     FUNC_ENTER_PACKAGE
 
+#ifdef H5_HAVE_THREADSAFE_API
+    /* Wait for the asynchronous I/O queued on the file to finish first */
+    if (H5VL__native_async_wait_obj(obj, loc_params->obj_type) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+#endif /* H5_HAVE_THREADSAFE_API */
+
     switch (args->op_type) {
         case H5VL_LINK_EXISTS: {
             H5G_loc_t loc;
@@ -150,6 +150,14 @@ H5VL__native_object_copy(void *src_obj, const H5VL_loc_params_t *loc_params1, co
     if (H5G_loc_real(dst_obj, loc_params2->obj_type, &dst_loc) < 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object");
 
+#ifdef H5_HAVE_THREADSAFE_API
+    /* Wait for the asynchronous I/O queued on the files to finish first */
+    if (H5VL__native_async_wait_file(src_loc.oloc->file) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+    if (H5VL__native_async_wait_file(dst_loc.oloc->file) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+#endif /* H5_HAVE_THREADSAFE_API */
+
     /* Copy the object */
     if ((ret_value = H5O__copy(&src_loc, src_name, &dst_loc, dst_name, ocpypl_id, lcpl_id)) < 0)
         HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, FAIL, "unable to copy object");
@@ -331,6 +339,12 @@ H5VL__native_object_specific(void *obj, const H5VL_loc_params_t *loc_params,
     if (H5G_loc_real(obj, loc_params->obj_type, &loc) < 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object");
 
+#ifdef H5_HAVE_THREADSAFE_API
+    /* Wait for the asynchronous I/O queued on the file to finish first */
+    if (H5VL__native_async_wait_file(loc.oloc->file) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTWAIT, FAIL, "can't wait for asynchronous I/O on file");
+#endif /* H5_HAVE_THREADSAFE_API */
+
     switch (args->op_type) {
         /* H5Oincr_refcount / H5Odecr_refcount */
         case H5VL_OBJECT_CHANGE_REF_COUNT: {
@@ -32,6 +32,9 @@
 /* Library Private Typedefs */
 /****************************/
 
+/* Forward declarations (for prototype arguments) */
+struct H5D_dset_io_info_t;
+
 /*****************************/
 /* Library Private Variables */
 /*****************************/
@@ -149,6 +152,29 @@ H5_DLL herr_t H5VL__native_blob_put(void *obj, const void *buf, size_t size, voi
 H5_DLL herr_t H5VL__native_blob_get(void *obj, const void *blob_id, void *buf, size_t size, void *ctx);
 H5_DLL herr_t H5VL__native_blob_specific(void *obj, void *blob_id, H5VL_blob_specific_args_t *args);
 
+#ifdef H5_HAVE_THREADSAFE_API
+/* Request callbacks */
+H5_DLL herr_t H5VL__native_request_wait(void *req, uint64_t timeout, H5VL_request_status_t *status);
+H5_DLL herr_t H5VL__native_request_cancel(void *req, H5VL_request_status_t *status);
+H5_DLL herr_t H5VL__native_request_specific(void *req, H5VL_request_specific_args_t *args);
+H5_DLL herr_t H5VL__native_request_free(void *req);
+
+/* Asynchronous dataset I/O */
+H5_DLL herr_t H5VL__native_async_dataset_io(bool is_write, size_t count, void *obj[], hid_t mem_type_id[],
+                                            hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id,
+                                            H5_flexible_const_ptr_t buf[], void **req);
+H5_DLL herr_t H5VL__native_async_wait_file(const H5F_t *f);
+H5_DLL herr_t H5VL__native_async_wait_obj(void *obj, H5I_type_t obj_type);
+H5_DLL herr_t H5VL__native_async_term(void);
+#endif /* H5_HAVE_THREADSAFE_API */
+
+/* Helper routines for dataset read/write callbacks */
+H5_DLL herr_t H5VL__native_dataset_io_setup(size_t count, void *obj[], hid_t mem_type_id[],
+                                            hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id,
+                                            H5_flexible_const_ptr_t buf[], struct H5D_dset_io_info_t *dinfo);
+H5_DLL herr_t H5VL__native_dataset_io_cleanup(size_t count, hid_t mem_space_id[], hid_t file_space_id[],
+                                              struct H5D_dset_io_info_t *dinfo);
+
 /* Token callbacks */
 H5_DLL herr_t H5VL__native_token_cmp(void *obj, const H5O_token_t *token1, const H5O_token_t *token2,
                                      int *cmp_value);
@@ -76,6 +76,10 @@ static int H5Z__find_idx(H5Z_filter_t id);
 static int H5Z__check_unregister_dset_cb(void *obj_ptr, hid_t obj_id, void *key);
 static int H5Z__check_unregister_group_cb(void *obj_ptr, hid_t obj_id, void *key);
 static int H5Z__flush_file_cb(void *obj_ptr, hid_t obj_id, void *key);
+static int    H5Z__load_idx(const H5Z_filter_info_t *filter);
+static herr_t H5Z__pipeline(const H5O_pline_t *pline, const H5Z_func_t funcs[], unsigned flags,
+                            unsigned *filter_mask, H5Z_EDC_t edc_read, H5Z_cb_t cb_struct, size_t *nbytes,
+                            size_t *buf_size, void **buf);
 
 /*-------------------------------------------------------------------------
  * Function: H5Z__init_package
@@ -1366,10 +1370,156 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
              H5Z_cb_t cb_struct, size_t *nbytes /*in,out*/, size_t *buf_size /*in,out*/,
              void **buf /*in,out*/)
 {
-    size_t        idx;
-    size_t        new_nbytes;
-    int           fclass_idx;    /* Index of filter class in global table */
-    H5Z_class2_t *fclass = NULL; /* Filter class pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    ret_value = H5Z__pipeline(pline, NULL, flags, filter_mask, edc_read, cb_struct, nbytes, buf_size, buf);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_pipeline() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z__load_idx
+ *
+ * Purpose:  Finds a filter in the table of registered filters.  If it
+ *           isn't registered and the application doesn't indicate no
+ *           plugin through HDF5_PRELOAD_PLUG (using the symbol "::"),
+ *           tries to load it dynamically and register it.
+ *
+ * Return:   Success:    Index of the filter in the table
+ *           Failure:    Negative
+ *-------------------------------------------------------------------------
+ */
+static int
+H5Z__load_idx(const H5Z_filter_info_t *filter)
+{
+    H5PL_key_t          key;
+    const H5Z_class2_t *filter_info;
+    int                 ret_value = -1; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if ((ret_value = H5Z__find_idx(filter->id)) < 0) {
+        /* Try loading the filter */
+        key.id = (int)(filter->id);
+        if (NULL != (filter_info = (const H5Z_class2_t *)H5PL_load(H5PL_TYPE_FILTER, &key))) {
+            /* Register the filter we loaded */
+            if (H5Z_register(filter_info) < 0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register filter");
+
+            /* Search in the table of registered filters again to find the dynamic filter just loaded
+             * and registered */
+            ret_value = H5Z__find_idx(filter->id);
+        }
+
+        /* Check for error */
+        if (ret_value < 0) {
+            /* Print out the filter name to give more info.  But the name is optional for
+             * the filter */
+            if (filter->name)
+                HGOTO_ERROR(H5E_PLINE, H5E_READERROR, FAIL, "required filter '%s' is not registered",
+                            filter->name);
+            else
+                HGOTO_ERROR(H5E_PLINE, H5E_READERROR, FAIL,
+                            "required filter (name unavailable) is not registered");
+        }
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__load_idx() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z_pipeline_resolve
+ *
+ * Purpose:  Looks up the filter function of each filter in a pipeline
+ *           for reading, loading any that aren't registered from plugins
+ *           like H5Z_pipeline does, and stores them in FUNCS (with
+ *           H5Z_MAX_NFILTERS elements).  The functions can then be run
+ *           with H5Z_pipeline_resolved, which doesn't access the table of
+ *           registered filters.
+ *
+ * Return:   Non-negative on success
+ *           Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Z_pipeline_resolve(const H5O_pline_t *pline, H5Z_func_t funcs[])
+{
+    size_t idx;                 /* Index of filter in pipeline */
+    int    fclass_idx;          /* Index of filter class in global table */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    assert(pline);
+    assert(pline->nused < H5Z_MAX_NFILTERS);
+    assert(funcs);
+
+    for (idx = 0; idx < pline->nused; idx++) {
+        if ((fclass_idx = H5Z__load_idx(&pline->filter[idx])) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_READERROR, FAIL, "unable to find filter");
+        funcs[idx] = H5Z_table_g[fclass_idx].filter;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_pipeline_resolve() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z_pipeline_resolved
+ *
+ * Purpose:  Processes data through the filter pipeline like H5Z_pipeline,
+ *           with the filter functions found earlier by
+ *           H5Z_pipeline_resolve.  Filters aren't loaded from plugins and
+ *           no filter statistics are kept, so the table of registered
+ *           filters is never accessed and other threads may change it
+ *           meanwhile.
+ *
+ * Return:   Non-negative on success
+ *           Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Z_pipeline_resolved(const H5O_pline_t *pline, const H5Z_func_t funcs[], unsigned flags,
+                      unsigned *filter_mask /*in,out*/, H5Z_EDC_t edc_read, H5Z_cb_t cb_struct,
+                      size_t *nbytes /*in,out*/, size_t *buf_size /*in,out*/, void **buf /*in,out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    assert(funcs);
+
+    ret_value = H5Z__pipeline(pline, funcs, flags, filter_mask, edc_read, cb_struct, nbytes, buf_size, buf);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_pipeline_resolved() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z__pipeline
+ *
+ * Purpose:  Common code for H5Z_pipeline and H5Z_pipeline_resolved.  When
+ *           FUNCS is NULL, the filters are looked up in the table of
+ *           registered filters, loading any that are missing from
+ *           plugins when reading.
+ *
+ * Return:   Non-negative on success
+ *           Negative on failure
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__pipeline(const H5O_pline_t *pline, const H5Z_func_t funcs[], unsigned flags,
+              unsigned *filter_mask /*in,out*/, H5Z_EDC_t edc_read, H5Z_cb_t cb_struct,
+              size_t *nbytes /*in,out*/, size_t *buf_size /*in,out*/, void **buf /*in,out*/)
+{
+    size_t     idx;
+    size_t     new_nbytes;
+    int        fclass_idx = -1;   /* Index of filter class in global table */
+    H5Z_func_t filter     = NULL; /* Filter function */
 #ifdef H5Z_DEBUG
     H5Z_stats_t  *fstats = NULL; /* Filter stats pointer */
     H5_timer_t    timer;         /* Timer for filter operations */
@@ -1380,7 +1530,7 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
     size_t   i;
     herr_t   ret_value = SUCCEED; /* Return value */
 
-    FUNC_ENTER_NOAPI(FAIL)
+    FUNC_ENTER_PACKAGE
 
     assert(0 == (flags & ~((unsigned)H5Z_FLAG_INVMASK)));
     assert(filter_mask);
@@ -1402,47 +1552,21 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
                 continue; /* filter excluded */
             }
 
-            /* If the filter isn't registered and the application doesn't
-             * indicate no plugin through HDF5_PRELOAD_PLUG (using the symbol "::"),
-             * try to load it dynamically and register it.  Otherwise, return failure
-             */
-            if ((fclass_idx = H5Z__find_idx(pline->filter[idx].id)) < 0) {
-                H5PL_key_t          key;
-                const H5Z_class2_t *filter_info;
-                bool                issue_error = false;
-
-                /* Try loading the filter */
-                key.id = (int)(pline->filter[idx].id);
-                if (NULL != (filter_info = (const H5Z_class2_t *)H5PL_load(H5PL_TYPE_FILTER, &key))) {
-                    /* Register the filter we loaded */
-                    if (H5Z_register(filter_info) < 0)
-                        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register filter");
-
-                    /* Search in the table of registered filters again to find the dynamic filter just loaded
-                     * and registered */
-                    if ((fclass_idx = H5Z__find_idx(pline->filter[idx].id)) < 0)
-                        issue_error = true;
-                }
-                else
-                    issue_error = true;
-
-                /* Check for error */
-                if (issue_error) {
-                    /* Print out the filter name to give more info.  But the name is optional for
-                     * the filter */
-                    if (pline->filter[idx].name)
-                        HGOTO_ERROR(H5E_PLINE, H5E_READERROR, FAIL, "required filter '%s' is not registered",
-                                    pline->filter[idx].name);
-                    else
-                        HGOTO_ERROR(H5E_PLINE, H5E_READERROR, FAIL,
-                                    "required filter (name unavailable) is not registered");
-                }
-            } /* end if */
-
-            fclass = &H5Z_table_g[fclass_idx];
+            /* Find the filter, loading it from a plugin if it isn't registered */
+            if (funcs) {
+                if (NULL == (filter = funcs[idx]))
+                    HGOTO_ERROR(H5E_PLINE, H5E_READERROR, FAIL, "required filter is not registered");
+            }
+            else {
+                if ((fclass_idx = H5Z__load_idx(&pline->filter[idx])) < 0)
+                    HGOTO_DONE(FAIL);
+                filter = H5Z_table_g[fclass_idx].filter;
+#ifdef H5Z_DEBUG
+                fstats = &H5Z_stat_table_g[fclass_idx];
+#endif
+            }
 
 #ifdef H5Z_DEBUG
-            fstats = &H5Z_stat_table_g[fclass_idx];
             H5_timer_start(&timer);
 #endif
 
@@ -1453,8 +1577,8 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
                 {/* Prepare & restore library for user callback */
                     H5_BEFORE_USER_CB(FAIL)
                         {
-                            new_nbytes = (fclass->filter)(tmp_flags, pline->filter[idx].cd_nelmts,
-                                                          pline->filter[idx].cd_values, *nbytes, buf_size, buf);
+                            new_nbytes = (filter)(tmp_flags, pline->filter[idx].cd_nelmts,
+                                                  pline->filter[idx].cd_values, *nbytes, buf_size, buf);
                         }
                     H5_AFTER_USER_CB(FAIL)
                 }
@@ -1463,13 +1587,15 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
 #ifdef H5Z_DEBUG
             H5_timer_stop(&timer);
             H5_timer_get_times(timer, &times);
-            fstats->stats[1].times.elapsed += times.elapsed;
-            fstats->stats[1].times.system += times.system;
-            fstats->stats[1].times.user += times.user;
-
-            fstats->stats[1].total += MAX(*nbytes, new_nbytes);
-            if (0 == new_nbytes)
-                fstats->stats[1].errors += *nbytes;
+            if (fstats) {
+                fstats->stats[1].times.elapsed += times.elapsed;
+                fstats->stats[1].times.system += times.system;
+                fstats->stats[1].times.user += times.user;
+
+                fstats->stats[1].total += MAX(*nbytes, new_nbytes);
+                if (0 == new_nbytes)
+                    fstats->stats[1].errors += *nbytes;
+            }
 #endif
 
             if (0 == new_nbytes) {
@@ -1502,7 +1628,17 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
                 failed |= (unsigned)1 << idx;
                 continue; /* filter excluded */
             }
-            if ((fclass_idx = H5Z__find_idx(pline->filter[idx].id)) < 0) {
+            if (funcs)
+                filter = funcs[idx];
+            else if ((fclass_idx = H5Z__find_idx(pline->filter[idx].id)) >= 0) {
+                filter = H5Z_table_g[fclass_idx].filter;
+#ifdef H5Z_DEBUG
+                fstats = &H5Z_stat_table_g[fclass_idx];
+#endif
+            }
+            else
+                filter = NULL;
+            if (NULL == filter) {
                 /* Check if filter is optional -- If it isn't, then error */
                 if ((pline->filter[idx].flags & H5Z_FLAG_OPTIONAL) == 0)
                     HGOTO_ERROR(H5E_PLINE, H5E_WRITEERROR, FAIL, "required filter is not registered");
@@ -1510,10 +1646,7 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
                 continue; /* filter excluded */
             }             /* end if */
 
-            fclass = &H5Z_table_g[fclass_idx];
-
 #ifdef H5Z_DEBUG
-            fstats = &H5Z_stat_table_g[fclass_idx];
             H5_timer_start(&timer);
 #endif
 
@@ -1521,8 +1654,8 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
                 {/* Prepare & restore library for user callback */
                     H5_BEFORE_USER_CB(FAIL)
                         {
-                            new_nbytes = (fclass->filter)(flags | (pline->filter[idx].flags), pline->filter[idx].cd_nelmts,
-                                                          pline->filter[idx].cd_values, *nbytes, buf_size, buf);
+                            new_nbytes = (filter)(flags | (pline->filter[idx].flags), pline->filter[idx].cd_nelmts,
+                                                  pline->filter[idx].cd_values, *nbytes, buf_size, buf);
                         }
                     H5_AFTER_USER_CB(FAIL)
                 }
@@ -1531,13 +1664,15 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
 #ifdef H5Z_DEBUG
             H5_timer_stop(&timer);
             H5_timer_get_times(timer, &times);
-            fstats->stats[0].times.elapsed += times.elapsed;
-            fstats->stats[0].times.system += times.system;
-            fstats->stats[0].times.user += times.user;
-
-            fstats->stats[0].total += MAX(*nbytes, new_nbytes);
-            if (0 == new_nbytes)
-                fstats->stats[0].errors += *nbytes;
+            if (fstats) {
+                fstats->stats[0].times.elapsed += times.elapsed;
+                fstats->stats[0].times.system += times.system;
+                fstats->stats[0].times.user += times.user;
+
+                fstats->stats[0].total += MAX(*nbytes, new_nbytes);
+                if (0 == new_nbytes)
+                    fstats->stats[0].errors += *nbytes;
+            }
 #endif
 
             if (0 == new_nbytes) {
@@ -78,6 +78,11 @@ H5_DLL herr_t H5Z_modify(const struct H5O_pline_t *pline, H5Z_filter_t filter, u
 H5_DLL herr_t H5Z_pipeline(const struct H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*in,out*/,
                            H5Z_EDC_t edc_read, H5Z_cb_t cb_struct, size_t *nbytes /*in,out*/,
                            size_t *buf_size /*in,out*/, void **buf /*in,out*/);
+H5_DLL herr_t H5Z_pipeline_resolve(const struct H5O_pline_t *pline, H5Z_func_t funcs[]);
+H5_DLL herr_t H5Z_pipeline_resolved(const struct H5O_pline_t *pline, const H5Z_func_t funcs[], unsigned flags,
+                                    unsigned *filter_mask /*in,out*/, H5Z_EDC_t edc_read, H5Z_cb_t cb_struct,
+                                    size_t *nbytes /*in,out*/, size_t *buf_size /*in,out*/,
+                                    void **buf /*in,out*/);
 H5_DLL herr_t H5Z_find(bool attempt, H5Z_filter_t id, H5Z_class2_t **cls);
 H5_DLL herr_t H5Z_can_apply(hid_t dcpl_id, hid_t type_id);
 H5_DLL herr_t H5Z_set_local(hid_t dcpl_id, hid_t type_id);
@@ -37,10 +37,18 @@
 /* (same as the IEEE 802.3 (Ethernet) quotient) */
 #define H5_CRC_QUOTIENT 0x04C11DB7
 
+/* # of buffers hashed together by H5_checksum_metadata_multi() */
+#define H5_CHECKSUM_MULTI_LANES 4
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Internal state of the lookup3 hash */
+typedef struct H5_lookup3_state_t {
+    uint32_t a, b, c;
+} H5_lookup3_state_t;
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -49,6 +57,10 @@
 /* Local Prototypes */
 /********************/
 
+static inline void H5__checksum_lookup3_init(H5_lookup3_state_t *st, size_t length, uint32_t initval);
+static inline void H5__checksum_lookup3_block(H5_lookup3_state_t *st, const uint8_t *k);
+static uint32_t    H5__checksum_lookup3_finish(const uint8_t *k, size_t length, H5_lookup3_state_t *st);
+
 /*********************/
 /* Package Variables */
 /*********************/
@@ -109,13 +121,27 @@ H5_checksum_fletcher32(const void *_data, size_t _len)
      *  performed without numeric overflow)
      */
     while (len) {
-        size_t tlen = len > 360 ? 360 : len;
+        size_t   tlen = len > 360 ? 360 : len;
+        uint32_t s = 0, t = 0; /* Sum of the block's words, and of the words times their index */
+        size_t   u;
+
+        /* The sums are independent from word to word, so this loop can be
+         * vectorized, unlike adding each word to sum1 and sum1 to sum2 in turn
+         */
+        for (u = 0; u < tlen; u++) {
+            uint32_t w = (((uint32_t)data[2 * u]) << 8) | ((uint32_t)data[2 * u + 1]);
+
+            s += w;
+            t += (uint32_t)u * w;
+        }
+
+        /* Fold the block into the sums, with the same result as the word by
+         * word updates: sum2 gains sum1 and each partial sum of the block
+         */
+        sum2 += ((uint32_t)tlen * sum1) + ((uint32_t)tlen * s) - t;
+        sum1 += s;
+        data += 2 * tlen;
         len -= tlen;
-        do {
-            sum1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
-            data += 2;
-            sum2 += sum1;
-        } while (--tlen);
         sum1 = (sum1 & 0xffff) + (sum1 >> 16);
         sum2 = (sum2 & 0xffff) + (sum2 >> 16);
     }
@@ -334,6 +360,38 @@ and these came close:
         c -= H5_lookup3_rot(b, 24);                                                                          \
     } while (0)
 
+/* Add the next 12-byte block of the key K to the internal state.  On
+ * little-endian machines the key's bytes are already in the order lookup3
+ * adds them, so each 32-bit value is loaded with one (unaligned) read.
+ */
+#ifndef WORDS_BIGENDIAN
+#define H5_lookup3_load(k, a, b, c)                                                                          \
+    do {                                                                                                     \
+        uint32_t w_[3];                                                                                      \
+                                                                                                             \
+        memcpy(w_, k, sizeof(w_));                                                                           \
+        a += w_[0];                                                                                          \
+        b += w_[1];                                                                                          \
+        c += w_[2];                                                                                          \
+    } while (0)
+#else
+#define H5_lookup3_load(k, a, b, c)                                                                          \
+    do {                                                                                                     \
+        a += (k)[0];                                                                                         \
+        a += ((uint32_t)(k)[1]) << 8;                                                                        \
+        a += ((uint32_t)(k)[2]) << 16;                                                                       \
+        a += ((uint32_t)(k)[3]) << 24;                                                                       \
+        b += (k)[4];                                                                                         \
+        b += ((uint32_t)(k)[5]) << 8;                                                                        \
+        b += ((uint32_t)(k)[6]) << 16;                                                                       \
+        b += ((uint32_t)(k)[7]) << 24;                                                                       \
+        c += (k)[8];                                                                                         \
+        c += ((uint32_t)(k)[9]) << 8;                                                                        \
+        c += ((uint32_t)(k)[10]) << 16;                                                                      \
+        c += ((uint32_t)(k)[11]) << 24;                                                                      \
+    } while (0)
+#endif
+
 /*
 -------------------------------------------------------------------------------
 H5_checksum_lookup3() -- hash a variable-length key into a 32-bit value
@@ -364,8 +422,7 @@ acceptable.  Do NOT use for cryptographic purposes.
 uint32_t
 H5_checksum_lookup3(const void *key, size_t length, uint32_t initval)
 {
-    const uint8_t *k = (const uint8_t *)key;
-    uint32_t       a, b, c = 0; /* internal state */
+    H5_lookup3_state_t st; /* internal state */
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
@@ -374,88 +431,145 @@ H5_checksum_lookup3(const void *key, size_t length, uint32_t initval)
     assert(length > 0);
 
     /* Set up the internal state */
-    a = b = c = 0xdeadbeef + ((uint32_t)length) + initval;
+    H5__checksum_lookup3_init(&st, length, initval);
+
+    FUNC_LEAVE_NOAPI(H5__checksum_lookup3_finish((const uint8_t *)key, length, &st))
+} /* end H5_checksum_lookup3() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5__checksum_lookup3_init
+ *
+ * Purpose:	Set up the lookup3 internal state ST for hashing a key of
+ *              LENGTH bytes.
+ *
+ * Return:	void (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static inline void
+H5__checksum_lookup3_init(H5_lookup3_state_t *st, size_t length, uint32_t initval)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    st->a = st->b = st->c = 0xdeadbeef + ((uint32_t)length) + initval;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5__checksum_lookup3_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5__checksum_lookup3_block
+ *
+ * Purpose:	Mix the 12-byte block of a key at K, which is not the key's
+ *              last block, into the lookup3 internal state ST.
+ *
+ * Return:	void (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static inline void
+H5__checksum_lookup3_block(H5_lookup3_state_t *st, const uint8_t *k)
+{
+    uint32_t a = st->a, b = st->b, c = st->c; /* internal state */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    H5_lookup3_load(k, a, b, c);
+    H5_lookup3_mix(a, b, c);
+
+    st->a = a;
+    st->b = b;
+    st->c = c;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5__checksum_lookup3_block() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5__checksum_lookup3_finish
+ *
+ * Purpose:	Hash the remaining LENGTH bytes of a key at K into the
+ *              lookup3 internal state ST, and return the hash.
+ *
+ * Return:	32-bit hash of the key (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5__checksum_lookup3_finish(const uint8_t *k, size_t length, H5_lookup3_state_t *st)
+{
+    uint32_t ret_value = st->c; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
 
     /*--------------- all but the last block: affect some 32 bits of (a,b,c) */
     while (length > 12) {
-        a += k[0];
-        a += ((uint32_t)k[1]) << 8;
-        a += ((uint32_t)k[2]) << 16;
-        a += ((uint32_t)k[3]) << 24;
-        b += k[4];
-        b += ((uint32_t)k[5]) << 8;
-        b += ((uint32_t)k[6]) << 16;
-        b += ((uint32_t)k[7]) << 24;
-        c += k[8];
-        c += ((uint32_t)k[9]) << 8;
-        c += ((uint32_t)k[10]) << 16;
-        c += ((uint32_t)k[11]) << 24;
-        H5_lookup3_mix(a, b, c);
+        H5__checksum_lookup3_block(st, k);
         length -= 12;
         k += 12;
     }
 
     /*-------------------------------- last block: affect all 32 bits of (c) */
-    switch (length) /* all the case statements fall through */
-    {
-        case 12:
-            c += ((uint32_t)k[11]) << 24;
-            /* FALLTHROUGH */
-            H5_ATTR_FALLTHROUGH
-        case 11:
-            c += ((uint32_t)k[10]) << 16;
-            /* FALLTHROUGH */
-            H5_ATTR_FALLTHROUGH
-        case 10:
-            c += ((uint32_t)k[9]) << 8;
-            /* FALLTHROUGH */
-            H5_ATTR_FALLTHROUGH
-        case 9:
-            c += k[8];
-            /* FALLTHROUGH */
-            H5_ATTR_FALLTHROUGH
-        case 8:
-            b += ((uint32_t)k[7]) << 24;
-            /* FALLTHROUGH */
-            H5_ATTR_FALLTHROUGH
-        case 7:
-            b += ((uint32_t)k[6]) << 16;
-            /* FALLTHROUGH */
-            H5_ATTR_FALLTHROUGH
-        case 6:
-            b += ((uint32_t)k[5]) << 8;
-            /* FALLTHROUGH */
-            H5_ATTR_FALLTHROUGH
-        case 5:
-            b += k[4];
-            /* FALLTHROUGH */
-            H5_ATTR_FALLTHROUGH
-        case 4:
-            a += ((uint32_t)k[3]) << 24;
-            /* FALLTHROUGH */
-            H5_ATTR_FALLTHROUGH
-        case 3:
-            a += ((uint32_t)k[2]) << 16;
-            /* FALLTHROUGH */
-            H5_ATTR_FALLTHROUGH
-        case 2:
-            a += ((uint32_t)k[1]) << 8;
-            /* FALLTHROUGH */
-            H5_ATTR_FALLTHROUGH
-        case 1:
-            a += k[0];
-            break;
-        case 0:
-            goto done;
-        default:
-            assert(0 && "This Should never be executed!");
-    }
-
-    H5_lookup3_final(a, b, c);
+    if (length > 0) {
+        uint32_t a = st->a, b = st->b, c = st->c; /* internal state */
+
+        switch (length) /* all the case statements fall through */
+        {
+            case 12:
+                c += ((uint32_t)k[11]) << 24;
+                /* FALLTHROUGH */
+                H5_ATTR_FALLTHROUGH
+            case 11:
+                c += ((uint32_t)k[10]) << 16;
+                /* FALLTHROUGH */
+                H5_ATTR_FALLTHROUGH
+            case 10:
+                c += ((uint32_t)k[9]) << 8;
+                /* FALLTHROUGH */
+                H5_ATTR_FALLTHROUGH
+            case 9:
+                c += k[8];
+                /* FALLTHROUGH */
+                H5_ATTR_FALLTHROUGH
+            case 8:
+                b += ((uint32_t)k[7]) << 24;
+                /* FALLTHROUGH */
+                H5_ATTR_FALLTHROUGH
+            case 7:
+                b += ((uint32_t)k[6]) << 16;
+                /* FALLTHROUGH */
+                H5_ATTR_FALLTHROUGH
+            case 6:
+                b += ((uint32_t)k[5]) << 8;
+                /* FALLTHROUGH */
+                H5_ATTR_FALLTHROUGH
+            case 5:
+                b += k[4];
+                /* FALLTHROUGH */
+                H5_ATTR_FALLTHROUGH
+            case 4:
+                a += ((uint32_t)k[3]) << 24;
+                /* FALLTHROUGH */
+                H5_ATTR_FALLTHROUGH
+            case 3:
+                a += ((uint32_t)k[2]) << 16;
+                /* FALLTHROUGH */
+                H5_ATTR_FALLTHROUGH
+            case 2:
+                a += ((uint32_t)k[1]) << 8;
+                /* FALLTHROUGH */
+                H5_ATTR_FALLTHROUGH
+            case 1:
+                a += k[0];
+                break;
+            default:
+                assert(0 && "This Should never be executed!");
+        }
+
+        H5_lookup3_final(a, b, c);
+        ret_value = c;
+    } /* end if */
 
-done:
-    FUNC_LEAVE_NOAPI(c)
-} /* end H5_checksum_lookup3() */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5__checksum_lookup3_finish() */
 
 /*-------------------------------------------------------------------------
  * Function:	H5_checksum_metadata
@@ -482,6 +596,66 @@ H5_checksum_metadata(const void *data, size_t len, uint32_t initval)
     FUNC_LEAVE_NOAPI(H5_checksum_lookup3(data, len, initval))
 } /* end H5_checksum_metadata() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5_checksum_metadata_multi
+ *
+ * Purpose:	Compute the metadata checksums of COUNT buffers, with the
+ *              same results as calling H5_checksum_metadata() on each one.
+ *
+ *              The buffers are hashed a few at a time, with the blocks
+ *              they all have interleaved, so the independent hash
+ *              computations overlap instead of waiting on each other.
+ *
+ * Return:	void (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_checksum_metadata_multi(size_t count, const void *const bufs[], const size_t lens[], uint32_t initval,
+                           uint32_t chksums[])
+{
+    size_t u, v; /* Local index variables */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity checks */
+    assert(bufs || count == 0);
+    assert(lens || count == 0);
+    assert(chksums || count == 0);
+
+    for (u = 0; u < count; u += H5_CHECKSUM_MULTI_LANES) {
+        const uint8_t     *k[H5_CHECKSUM_MULTI_LANES];  /* Keys */
+        H5_lookup3_state_t st[H5_CHECKSUM_MULTI_LANES]; /* Internal states */
+        size_t             nlanes  = MIN(count - u, H5_CHECKSUM_MULTI_LANES); /* # of keys hashed together */
+        size_t             nblocks = SIZE_MAX; /* # of blocks hashed together */
+        size_t             n;                  /* Local index variable */
+
+        for (v = 0; v < nlanes; v++) {
+            assert(bufs[u + v]);
+            assert(lens[u + v] > 0);
+
+            k[v] = (const uint8_t *)bufs[u + v];
+            H5__checksum_lookup3_init(&st[v], lens[u + v], initval);
+
+            /* All but the last block of each key goes through the mix */
+            nblocks = MIN(nblocks, (lens[u + v] - 1) / 12);
+        } /* end for */
+
+        /* Hash the blocks all the keys have before their last one */
+        for (n = 0; n < nblocks; n++)
+            for (v = 0; v < nlanes; v++) {
+                H5__checksum_lookup3_block(&st[v], k[v]);
+                k[v] += 12;
+            } /* end for */
+
+        /* Finish each key on its own */
+        for (v = 0; v < nlanes; v++)
+            chksums[u + v] = H5__checksum_lookup3_finish(k[v], lens[u + v] - (nblocks * 12), &st[v]);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5_checksum_metadata_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5_hash_string
  *
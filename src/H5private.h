@@ -110,6 +110,14 @@
 #include <sys/ioctl.h>
 #endif
 
+/*
+ * Scatter/gather I/O (preadv() and pwritev()) for the vector I/O callbacks
+ * of the POSIX VFDs.
+ */
+#ifdef H5_HAVE_PREADWRITEV
+#include <sys/uio.h>
+#endif
+
 /*
  * Dynamic library handling.  These are needed for dynamically loading I/O
  * filters and VFDs.
@@ -706,6 +714,12 @@ H5_DLL H5_ATTR_CONST int Nflock(int fd, int operation);
 #ifndef HDpwrite
 #define HDpwrite(F, B, C, O) pwrite(F, B, C, O)
 #endif
+#ifndef HDpreadv
+#define HDpreadv(F, V, C, O) preadv(F, V, C, O)
+#endif
+#ifndef HDpwritev
+#define HDpwritev(F, V, C, O) pwritev(F, V, C, O)
+#endif
 #ifndef HDread
 #define HDread(F, M, Z) read(F, M, Z)
 #endif
@@ -1339,11 +1353,11 @@ extern char H5_lib_vers_info_g[];
 
 /* Macro to push the API context */
 #define H5_API_SETUP_PUSH_CONTEXT(err)                                                                       \
-    /* The library context variable can't go in this macro since then it might                               \
+    /* The flag for the pushed context can't go in this macro since then it might                            \
      * be uninitialized if the library init fails.                                                           \
      */                                                                                                      \
     do {                                                                                                     \
-        if (H5_UNLIKELY(H5CX_push(&api_ctx) < 0))                                                            \
+        if (H5_UNLIKELY(H5CX_push_api() < 0))                                                                \
             HGOTO_ERROR(H5E_FUNC, H5E_CANTSET, err, "can't set API context");                                \
         else                                                                                                 \
             api_ctx_pushed = true;                                                                           \
@@ -1361,8 +1375,7 @@ extern char H5_lib_vers_info_g[];
 #define FUNC_ENTER_API(err)                                                                                  \
     {                                                                                                        \
         {                                                                                                    \
-            H5CX_node_t api_ctx        = {{0}, NULL};                                                        \
-            bool        api_ctx_pushed = false;                                                              \
+            bool api_ctx_pushed = false;                                                                     \
                                                                                                              \
             H5_CHECK_FUNCTION_NAME(H5_IS_PUBLIC(__func__));                                                  \
                                                                                                              \
@@ -1383,8 +1396,7 @@ extern char H5_lib_vers_info_g[];
 #define FUNC_ENTER_API_NOCLEAR(err)                                                                          \
     {                                                                                                        \
         {                                                                                                    \
-            H5CX_node_t api_ctx        = {{0}, NULL};                                                        \
-            bool        api_ctx_pushed = false;                                                              \
+            bool api_ctx_pushed = false;                                                                     \
                                                                                                              \
             H5_CHECK_FUNCTION_NAME(H5_IS_PUBLIC(__func__));                                                  \
                                                                                                              \
@@ -1784,6 +1796,8 @@ H5_DLL uint32_t H5_checksum_fletcher32(const void *data, size_t len);
 H5_DLL uint32_t H5_checksum_crc(const void *data, size_t len);
 H5_DLL uint32_t H5_checksum_lookup3(const void *data, size_t len, uint32_t initval);
 H5_DLL uint32_t H5_checksum_metadata(const void *data, size_t len, uint32_t initval);
+H5_DLL void     H5_checksum_metadata_multi(size_t count, const void *const bufs[], const size_t lens[],
+                                           uint32_t initval, uint32_t chksums[]);
 H5_DLL uint32_t H5_hash_string(const char *str);
 
 /* Time related routines */
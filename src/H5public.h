@@ -676,6 +676,35 @@ H5_DLL herr_t H5set_free_list_limits(int reg_global_lim, int reg_list_lim, int a
  * \since 1.10.7
  */
 H5_DLL herr_t H5get_free_list_sizes(size_t *reg_size, size_t *arr_size, size_t *blk_size, size_t *fac_size);
+/**
+ * \ingroup H5
+ * \brief Gets statistics for the per-thread free list caches
+ *
+ * \param[out] hits The number of allocations taken from a thread's cache
+ * \param[out] misses The number of allocations that went to the shared free
+ *             lists
+ * \param[out] spills The number of times a full cache returned objects to
+ *             the shared free lists
+ * \param[out] thread_size The size of the free objects in the calling
+ *             thread's cache
+ * \return \herr_t
+ *
+ * \details H5get_free_list_cache_stats() obtains statistics for the small
+ *          caches of free objects that each thread keeps in front of the
+ *          regular, block and factory free lists in threadsafe builds.
+ *          \p hits, \p misses and \p spills are totals for all threads,
+ *          including threads that have exited, since the library was
+ *          loaded. \p thread_size is only for the calling thread. Objects
+ *          in the caches are included in the sizes returned by
+ *          H5get_free_list_sizes(). Without the threadsafe API, there are no
+ *          per-thread caches and all of the values are zero.
+ *
+ *          Any of the parameters may be NULL.
+ *
+ * \since 2.0.0
+ */
+H5_DLL herr_t H5get_free_list_cache_stats(uint64_t *hits, uint64_t *misses, uint64_t *spills,
+                                          size_t *thread_size);
 /**
  * \ingroup H5
  * \brief Returns the HDF library release number
@@ -512,6 +512,10 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5C_incr__threshold");
                                     break;
 
+                                case H5C_incr__working_set:
+                                    H5RS_acat(rs, "H5C_incr__working_set");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)cc.incr_mode);
                                     break;
@@ -581,6 +585,26 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                         } /* end block */
                         break;
 
+                        case 'l': /* H5AC_log_format_t */
+                        {
+                            H5AC_log_format_t log_format = (H5AC_log_format_t)va_arg(ap, int);
+
+                            switch (log_format) {
+                                case H5AC_LOG_FORMAT_JSON:
+                                    H5RS_acat(rs, "H5AC_LOG_FORMAT_JSON");
+                                    break;
+
+                                case H5AC_LOG_FORMAT_BINARY:
+                                    H5RS_acat(rs, "H5AC_LOG_FORMAT_BINARY");
+                                    break;
+
+                                default:
+                                    H5RS_asprintf_cat(rs, "%ld", (long)log_format);
+                                    break;
+                            } /* end switch */
+                        }     /* end block */
+                        break;
+
                         default:
                             H5RS_asprintf_cat(rs, "BADTYPE(C%c)", type[1]);
                             goto error;
@@ -1090,6 +1114,16 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5_VFD_DIRECT");
                                     break;
 #endif
+#ifdef H5_HAVE_IOURING_VFD
+                                case H5_VFD_IOURING:
+                                    H5RS_acat(rs, "H5_VFD_IOURING");
+                                    break;
+#endif
+#ifdef H5_HAVE_MMAP_VFD
+                                case H5_VFD_MMAP:
+                                    H5RS_acat(rs, "H5_VFD_MMAP");
+                                    break;
+#endif
 #ifdef H5_HAVE_MIRROR_VFD
                                 case H5_VFD_MIRROR:
                                     H5RS_acat(rs, "H5_VFD_MIRROR");
@@ -3628,6 +3662,10 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5VL_NATIVE_DATASET_GET_OFFSET");
                                     break;
 
+                                case H5VL_NATIVE_DATASET_READ_VIEW:
+                                    H5RS_acat(rs, "H5VL_NATIVE_DATASET_READ_VIEW");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)optional);
                                     break;
@@ -3766,6 +3804,10 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5VL_NATIVE_FILE_POST_OPEN");
                                     break;
 
+                                case H5VL_NATIVE_FILE_GET_MDC_TYPE_STATS:
+                                    H5RS_acat(rs, "H5VL_NATIVE_FILE_GET_MDC_TYPE_STATS");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)optional);
                                     break;
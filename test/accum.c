@@ -32,6 +32,13 @@ static const char *FILENAME[] = {"accum", "accum_swmr_big", NULL};
 /* "big" I/O test values */
 #define BIG_BUF_SIZE (6 * 1024 * 1024)
 
+/* Dirty region test values */
+#define REGION_NSTREAMS   4
+#define REGION_NRECORDS   64
+#define REGION_RECORD_LEN 8
+#define REGION_BASE_OFF   (1024 * 1024)
+#define REGION_STRIDE     (1024 * 1024)
+
 /* Random I/O test values */
 #define RANDOM_BUF_SIZE     (1 * 1024 * 1024)
 #define MAX_RANDOM_SEGMENTS (5 * 1024)
@@ -51,6 +58,7 @@ unsigned test_read_after(H5F_t *f);
 unsigned test_free(H5F_t *f);
 unsigned test_big(H5F_t *f);
 unsigned test_random_write(H5F_t *f);
+unsigned test_write_regions(H5F_t *f);
 unsigned test_swmr_write_big(bool newest_format);
 
 /* Helper Function Prototypes */
@@ -132,6 +140,7 @@ main(void)
     nerrors += test_free(f);
     nerrors += test_big(f);
     nerrors += test_random_write(f);
+    nerrors += test_write_regions(f);
 
     /* Pop API context */
     if (api_ctx_pushed && H5CX_pop(false) < 0)
@@ -2030,6 +2039,165 @@ error:
     return 1;
 } /* end test_random_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_write_regions
+ *
+ * Purpose:     Appends small raw data records to several "streams" in the
+ *              file, interleaved with metadata written to two places,
+ *              and checks that the accumulator holds them in one dirty
+ *              region per stream until it's flushed.
+ *
+ * Return:      Success: SUCCEED
+ *              Failure: FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned
+test_write_regions(H5F_t *f)
+{
+    hid_t    fapl = H5I_INVALID_HID;
+    size_t   raw_size;
+    uint8_t  rec[REGION_RECORD_LEN];
+    uint8_t *rbuf = NULL;
+    unsigned s, u, v;
+    haddr_t  addr;
+
+    TESTING("dirty regions in the accumulator");
+
+    if (!(f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA)) {
+        SKIPPED();
+        puts("    Accumulator not supported by file driver");
+        return 0;
+    } /* end if */
+
+    /* Check the property */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pget_raw_data_accum_size(fapl, &raw_size) < 0)
+        FAIL_STACK_ERROR;
+    if (raw_size != 0)
+        TEST_ERROR;
+    if (H5Pset_raw_data_accum_size(fapl, (size_t)REGION_RECORD_LEN) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pget_raw_data_accum_size(fapl, &raw_size) < 0)
+        FAIL_STACK_ERROR;
+    if (raw_size != REGION_RECORD_LEN)
+        TEST_ERROR;
+    if (H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+    fapl = H5I_INVALID_HID;
+
+    if (NULL == (rbuf = (uint8_t *)malloc(REGION_NRECORDS * REGION_RECORD_LEN)))
+        TEST_ERROR;
+
+    /* Accumulate small raw data writes */
+    f->shared->accum.raw_max_size = REGION_RECORD_LEN;
+
+    /* Append records to each stream, writing metadata to two other places in between */
+    for (u = 0; u < REGION_NRECORDS; u++) {
+        for (s = 0; s < REGION_NSTREAMS; s++) {
+            memset(rec, (int)(s * REGION_NRECORDS + u), sizeof(rec));
+            addr = REGION_BASE_OFF + s * REGION_STRIDE + u * REGION_RECORD_LEN;
+            if (H5F_block_write(f, H5FD_MEM_DRAW, addr, sizeof(rec), rec) < 0)
+                FAIL_STACK_ERROR;
+        } /* end for */
+
+        for (s = REGION_NSTREAMS; s < REGION_NSTREAMS + 2; s++) {
+            memset(rec, (int)(s * REGION_NRECORDS + u), sizeof(rec));
+            addr = REGION_BASE_OFF + s * REGION_STRIDE + u * REGION_RECORD_LEN;
+            if (accum_write(addr, sizeof(rec), rec) < 0)
+                FAIL_STACK_ERROR;
+        } /* end for */
+    }     /* end for */
+
+    /* One region per raw data stream and one per place metadata is written */
+    if (f->shared->accum.nregions != REGION_NSTREAMS + 2)
+        TEST_ERROR;
+
+    /* Read the raw data back through the accumulator */
+    for (s = 0; s < REGION_NSTREAMS; s++) {
+        if (H5F_block_read(f, H5FD_MEM_DRAW, REGION_BASE_OFF + s * REGION_STRIDE,
+                           REGION_NRECORDS * REGION_RECORD_LEN, rbuf) < 0)
+            FAIL_STACK_ERROR;
+        for (u = 0; u < REGION_NRECORDS; u++)
+            for (v = 0; v < REGION_RECORD_LEN; v++)
+                if (rbuf[u * REGION_RECORD_LEN + v] != (uint8_t)(s * REGION_NRECORDS + u))
+                    TEST_ERROR;
+    } /* end for */
+    if (f->shared->accum.nregions != REGION_NSTREAMS + 2)
+        TEST_ERROR;
+
+    /* Flush the regions and check the file directly */
+    if (accum_flush(f) < 0)
+        FAIL_STACK_ERROR;
+    if (f->shared->accum.nregions != 0)
+        TEST_ERROR;
+    for (s = 0; s < REGION_NSTREAMS + 2; s++) {
+        if (H5FD_read(f->shared->lf, H5FD_MEM_DEFAULT, REGION_BASE_OFF + s * REGION_STRIDE,
+                      REGION_NRECORDS * REGION_RECORD_LEN, rbuf) < 0)
+            FAIL_STACK_ERROR;
+        for (u = 0; u < REGION_NRECORDS; u++)
+            for (v = 0; v < REGION_RECORD_LEN; v++)
+                if (rbuf[u * REGION_RECORD_LEN + v] != (uint8_t)(s * REGION_NRECORDS + u))
+                    TEST_ERROR;
+    } /* end for */
+
+    /* Scattered writes can't take more than the maximum # of regions */
+    for (u = 0; u < 2 * H5F_ACCUM_MAX_REGIONS; u++) {
+        memset(rec, (int)u, sizeof(rec));
+        if (H5F_block_write(f, H5FD_MEM_DRAW, REGION_BASE_OFF + u * 4096, sizeof(rec), rec) < 0)
+            FAIL_STACK_ERROR;
+        if (f->shared->accum.nregions > H5F_ACCUM_MAX_REGIONS)
+            TEST_ERROR;
+    } /* end for */
+    for (u = 0; u < 2 * H5F_ACCUM_MAX_REGIONS; u++) {
+        if (H5F_block_read(f, H5FD_MEM_DRAW, REGION_BASE_OFF + u * 4096, sizeof(rec), rec) < 0)
+            FAIL_STACK_ERROR;
+        for (v = 0; v < REGION_RECORD_LEN; v++)
+            if (rec[v] != (uint8_t)u)
+                TEST_ERROR;
+    } /* end for */
+
+    /* Freeing the space of a region drops it without writing it */
+    if (accum_flush(f) < 0)
+        FAIL_STACK_ERROR;
+    memset(rec, 0xff, sizeof(rec));
+    if (H5F_block_write(f, H5FD_MEM_DRAW, REGION_BASE_OFF, sizeof(rec), rec) < 0)
+        FAIL_STACK_ERROR;
+    if (f->shared->accum.nregions != 1)
+        TEST_ERROR;
+    if (H5F__accum_free(f->shared, H5FD_MEM_DRAW, REGION_BASE_OFF, sizeof(rec)) < 0)
+        FAIL_STACK_ERROR;
+    if (f->shared->accum.nregions != 0)
+        TEST_ERROR;
+    if (H5FD_read(f->shared->lf, H5FD_MEM_DEFAULT, REGION_BASE_OFF, sizeof(rec), rec) < 0)
+        FAIL_STACK_ERROR;
+    for (v = 0; v < REGION_RECORD_LEN; v++)
+        if (rec[v] != 0)
+            TEST_ERROR;
+
+    f->shared->accum.raw_max_size = 0;
+    if (accum_reset(f) < 0)
+        FAIL_STACK_ERROR;
+
+    PASSED();
+
+    free(rbuf);
+
+    return 0;
+
+error:
+    f->shared->accum.raw_max_size = 0;
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY
+    free(rbuf);
+
+    return 1;
+} /* end test_write_regions() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_swmr_write_big
  *
@@ -218,6 +218,8 @@ static void     cedds__H5C_make_space_in_cache(H5F_t *file_ptr);
 static void     cedds__H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t *file_ptr);
 static void     cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t *file_ptr);
 static unsigned check_stats(unsigned paged);
+static unsigned check_write_batch(unsigned paged);
+static void     check_write_batch__verify_images(H5F_t *file_ptr, int32_t type, int32_t num_entries);
 #if H5C_COLLECT_CACHE_STATS
 static void check_stats__smoke_check_1(H5F_t *file_ptr);
 #endif /* H5C_COLLECT_CACHE_STATS */
@@ -21941,7 +21943,7 @@ check_auto_cache_resize_input_errs(unsigned paged)
 
         invalid_auto_size_ctl.epoch_length = 5000;
 
-        invalid_auto_size_ctl.incr_mode = (enum H5C_cache_incr_mode)2; /* INVALID */
+        invalid_auto_size_ctl.incr_mode = (enum H5C_cache_incr_mode)3; /* INVALID */
 
         invalid_auto_size_ctl.lower_hr_threshold = 0.75;
 
@@ -31215,14 +31217,14 @@ cedds__H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t *file_ptr)
  *              !!!!!!!!!!WARNING !!!!!!!!!!
  *
  *              This test may fail to function correctly if the hash
- *              table size or hash function is altered.
+ *              table is resized while it runs.
  *
  *              To setup the test, this function depends on the fact that
  *              H5C_flush_invalidate_cache() does alternating scans of the
  *              slist and the index.  If this changes, the test will likely
  *              also cease to function correctly.
  *
- *              The test relies on a known hash function and hash table
+ *              The test uses the hash function and the initial hash table
  *              size to select a set of test entries that will all hash
  *              to the same hash bucket -- call it the test hash bucket.
  *              It also relies on known behavior of the cache to place
@@ -31276,7 +31278,10 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t *file_ptr)
 {
     H5C_t                    *cache_ptr = file_ptr->shared->cache;
     int                       i;
-    int                       expected_hash_bucket = 0;
+    size_t                    expected_hash_bucket = 0;
+    int32_t                   bucket_idx[4];
+    int32_t                   dirty_idx = -1;
+    int32_t                   num_found = 0;
     haddr_t                   entry_addr;
     test_entry_t             *entry_ptr;
     test_entry_t             *base_addr = NULL;
@@ -31330,6 +31335,38 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t *file_ptr)
         }
     }
 
+    if (pass) {
+
+        /* select entries that hash to the same bucket as (MET, 0), and an
+         * additional entry that doesn't.
+         */
+        base_addr            = entries[MONSTER_ENTRY_TYPE];
+        expected_hash_bucket = H5C__HASH_FCN(cache_ptr, base_addr[0].addr);
+        bucket_idx[0]        = 0;
+        num_found            = 1;
+
+        for (i = 1; i < NUM_MONSTER_ENTRIES && (num_found < 4 || dirty_idx < 0); i++) {
+            if (H5C__HASH_FCN(cache_ptr, base_addr[i].addr) == expected_hash_bucket) {
+                if (num_found < 4)
+                    bucket_idx[num_found++] = i;
+            }
+            else if (dirty_idx < 0)
+                dirty_idx = i;
+        }
+
+        if (num_found < 4 || dirty_idx < 0) {
+
+            pass         = false;
+            failure_mssg = "Can't find test entries that map to the same bucket.";
+        }
+        else {
+
+            for (i = 1; i < 4; i++)
+                expected[i].entry_index = bucket_idx[i];
+            expected[4].entry_index = dirty_idx;
+        }
+    }
+
     if (pass) {
 
         /* reset the stats before we start.  If stats are enabled, we will
@@ -31345,29 +31382,32 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t *file_ptr)
         protect_entry(file_ptr, MONSTER_ENTRY_TYPE, 0);
         unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, 0, H5C__DIRTIED_FLAG);
 
-        for (i = 8; i <= 24; i += 8) {
-            protect_entry(file_ptr, MONSTER_ENTRY_TYPE, i);
-            unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+        for (i = 1; i < 4; i++) {
+            protect_entry(file_ptr, MONSTER_ENTRY_TYPE, bucket_idx[i]);
+            unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, bucket_idx[i], H5C__NO_FLAGS_SET);
         }
     }
 
     if (pass) {
 
-        /* verify that the above entries hash to the same bucket */
-        base_addr  = entries[MONSTER_ENTRY_TYPE];
+        /* verify that the above entries still hash to the same bucket */
         entry_ptr  = &(base_addr[0]);
         entry_addr = entry_ptr->header.addr;
 
         assert(entry_addr == entry_ptr->addr);
 
-        expected_hash_bucket = H5C__HASH_FCN(entry_addr);
+        if (expected_hash_bucket != H5C__HASH_FCN(cache_ptr, entry_addr)) {
+
+            pass         = false;
+            failure_mssg = "Test entry maps to another bucket -- hash table resized?";
+        }
 
-        for (i = 8; i <= 24; i += 8) {
+        for (i = 1; i < 4; i++) {
 
-            entry_ptr  = &(base_addr[i]);
+            entry_ptr  = &(base_addr[bucket_idx[i]]);
             entry_addr = entry_ptr->header.addr;
 
-            if (expected_hash_bucket != H5C__HASH_FCN(entry_addr)) {
+            if (expected_hash_bucket != H5C__HASH_FCN(cache_ptr, entry_addr)) {
 
                 pass         = false;
                 failure_mssg = "Test entries don't map to same bucket -- hash table size or hash fcn change?";
@@ -31379,10 +31419,11 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t *file_ptr)
 
         /* setup the expunge flush operation:
          *
-         *     (MET, 0) expunges (MET, 8)
+         *     (MET, 0) expunges the second entry in the test bucket
          *
          */
-        add_flush_op(MONSTER_ENTRY_TYPE, 0, FLUSH_OP__EXPUNGE, MONSTER_ENTRY_TYPE, 8, false, (size_t)0, NULL);
+        add_flush_op(MONSTER_ENTRY_TYPE, 0, FLUSH_OP__EXPUNGE, MONSTER_ENTRY_TYPE, bucket_idx[1], false,
+                     (size_t)0, NULL);
     }
 
     if (pass) {
@@ -31392,8 +31433,8 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t *file_ptr)
          * the skip list.
          */
 
-        protect_entry(file_ptr, MONSTER_ENTRY_TYPE, 31);
-        unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, 31, H5C__DIRTIED_FLAG);
+        protect_entry(file_ptr, MONSTER_ENTRY_TYPE, dirty_idx);
+        unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, dirty_idx, H5C__DIRTIED_FLAG);
     }
 
     if (pass) {
@@ -31402,10 +31443,10 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t *file_ptr)
          * hash bucket as the clean entries.
          */
 
-        entry_ptr  = &(base_addr[31]);
+        entry_ptr  = &(base_addr[dirty_idx]);
         entry_addr = entry_ptr->header.addr;
 
-        if (expected_hash_bucket == H5C__HASH_FCN(entry_addr)) {
+        if (expected_hash_bucket == H5C__HASH_FCN(cache_ptr, entry_addr)) {
 
             pass         = false;
             failure_mssg = "Dirty entry maps to same hash bucket as clean entries?!?!";
@@ -31414,24 +31455,25 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t *file_ptr)
 
     if (pass) {
 
-        /* Next, create the flush dependency requiring (MET, 31) to
-         * be flushed prior to (MET, 0).
+        /* Next, create the flush dependency requiring the additional
+         * dirty entry to be flushed prior to (MET, 0).
          */
 
         protect_entry(file_ptr, MONSTER_ENTRY_TYPE, 0);
-        create_flush_dependency(MONSTER_ENTRY_TYPE, 0, MONSTER_ENTRY_TYPE, 31);
+        create_flush_dependency(MONSTER_ENTRY_TYPE, 0, MONSTER_ENTRY_TYPE, dirty_idx);
         unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, 0, H5C__DIRTIED_FLAG);
     }
 
     if (pass) {
 
         /* Then, setup the flush operation to take down the flush
-         * dependency when (MET, 31) is flushed.
+         * dependency when the additional dirty entry is flushed.
          *
-         *     (MET, 31) destroys flush dependency with (MET, 8)
+         *     the additional dirty entry destroys its flush dependency
+         *     with (MET, 0)
          *
          */
-        add_flush_op(MONSTER_ENTRY_TYPE, 31, FLUSH_OP__DEST_FLUSH_DEP, MONSTER_ENTRY_TYPE, 0, false,
+        add_flush_op(MONSTER_ENTRY_TYPE, dirty_idx, FLUSH_OP__DEST_FLUSH_DEP, MONSTER_ENTRY_TYPE, 0, false,
                      (size_t)0, NULL);
     }
 
@@ -31449,9 +31491,9 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t *file_ptr)
          * hash bucket list on lookup.
          */
 
-        for (i = 24; i >= 0; i -= 8) {
-            protect_entry(file_ptr, MONSTER_ENTRY_TYPE, i);
-            unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+        for (i = 3; i >= 0; i--) {
+            protect_entry(file_ptr, MONSTER_ENTRY_TYPE, bucket_idx[i]);
+            unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, bucket_idx[i], H5C__NO_FLAGS_SET);
         }
     }
 
@@ -31464,8 +31506,8 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t *file_ptr)
 
         i = 0;
 
-        while (pass && (i <= 24)) {
-            entry_ptr = &(base_addr[i]);
+        while (pass && (i < 4)) {
+            entry_ptr = &(base_addr[bucket_idx[i]]);
 
             if (scan_ptr == NULL) {
 
@@ -31481,7 +31523,7 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t *file_ptr)
             if (pass) {
 
                 scan_ptr = scan_ptr->ht_next;
-                i += 8;
+                i++;
             }
         }
     }
@@ -31711,7 +31753,7 @@ check_stats__smoke_check_1(H5F_t *file_ptr)
 
         if ((cache_ptr->total_ht_insertions != 32) || (cache_ptr->total_ht_deletions != 0) ||
             (cache_ptr->successful_ht_searches != 0) || (cache_ptr->total_successful_ht_search_depth != 0) ||
-            (cache_ptr->failed_ht_searches != 32) || (cache_ptr->total_failed_ht_search_depth != 48) ||
+            (cache_ptr->failed_ht_searches != 32) || (cache_ptr->total_failed_ht_search_depth != 0) ||
             (cache_ptr->max_index_len != 32) || (cache_ptr->max_index_size != 2 * 1024 * 1024) ||
             (cache_ptr->max_clean_index_size != 0) || (cache_ptr->max_dirty_index_size != 2 * 1024 * 1024) ||
             ((cache_ptr->slist_enabled) &&
@@ -31784,8 +31826,8 @@ check_stats__smoke_check_1(H5F_t *file_ptr)
 
         if ((cache_ptr->total_ht_insertions != 32) || (cache_ptr->total_ht_deletions != 0) ||
             (cache_ptr->successful_ht_searches != 32) ||
-            (cache_ptr->total_successful_ht_search_depth != 96) || (cache_ptr->failed_ht_searches != 32) ||
-            (cache_ptr->total_failed_ht_search_depth != 48) || (cache_ptr->max_index_len != 32) ||
+            (cache_ptr->total_successful_ht_search_depth != 0) || (cache_ptr->failed_ht_searches != 32) ||
+            (cache_ptr->total_failed_ht_search_depth != 0) || (cache_ptr->max_index_len != 32) ||
             (cache_ptr->max_index_size != 2 * 1024 * 1024) || (cache_ptr->max_clean_index_size != 0) ||
             (cache_ptr->max_dirty_index_size != 2 * 1024 * 1024) ||
             ((cache_ptr->slist_enabled) &&
@@ -31858,8 +31900,8 @@ check_stats__smoke_check_1(H5F_t *file_ptr)
 
         if ((cache_ptr->total_ht_insertions != 33) || (cache_ptr->total_ht_deletions != 1) ||
             (cache_ptr->successful_ht_searches != 32) ||
-            (cache_ptr->total_successful_ht_search_depth != 96) || (cache_ptr->failed_ht_searches != 33) ||
-            (cache_ptr->total_failed_ht_search_depth != 52) || (cache_ptr->max_index_len != 32) ||
+            (cache_ptr->total_successful_ht_search_depth != 0) || (cache_ptr->failed_ht_searches != 33) ||
+            (cache_ptr->total_failed_ht_search_depth != 0) || (cache_ptr->max_index_len != 32) ||
             (cache_ptr->max_index_size != 2 * 1024 * 1024) ||
             (cache_ptr->max_clean_index_size != 2 * 1024 * 1024) ||
             (cache_ptr->max_dirty_index_size != 2 * 1024 * 1024) ||
@@ -31947,8 +31989,8 @@ check_stats__smoke_check_1(H5F_t *file_ptr)
 
         if ((cache_ptr->total_ht_insertions != 33) || (cache_ptr->total_ht_deletions != 33) ||
             (cache_ptr->successful_ht_searches != 33) ||
-            (cache_ptr->total_successful_ht_search_depth != 99) || (cache_ptr->failed_ht_searches != 33) ||
-            (cache_ptr->total_failed_ht_search_depth != 52) || (cache_ptr->max_index_len != 32) ||
+            (cache_ptr->total_successful_ht_search_depth != 0) || (cache_ptr->failed_ht_searches != 33) ||
+            (cache_ptr->total_failed_ht_search_depth != 0) || (cache_ptr->max_index_len != 32) ||
             (cache_ptr->max_index_size != 2 * 1024 * 1024) ||
             (cache_ptr->max_clean_index_size != 2 * 1024 * 1024) ||
             (cache_ptr->max_dirty_index_size != 2 * 1024 * 1024) ||
@@ -32023,6 +32065,155 @@ check_write_permitted(const H5F_t H5_ATTR_UNUSED *f, bool *write_permitted_ptr)
     return (SUCCEED);
 } /* check_write_permitted() */
 
+/*-------------------------------------------------------------------------
+ * Function:    check_write_batch()
+ *
+ * Purpose:     Verify that entries whose writes are collected into write
+ *              batches, both when the cache is flushed and when space is
+ *              made in the cache, reach the file intact.
+ *
+ *              Insert medium entries in reverse address order and flush
+ *              the cache.  Then insert enough large entries to force
+ *              dirty entries out of the cache, flush it again, and check
+ *              the images of all entries in the file.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+check_write_batch(unsigned paged)
+{
+    H5F_t      *file_ptr  = NULL;
+    H5C_t      *cache_ptr = NULL;
+    H5CX_node_t api_ctx   = {{0}, NULL}; /* API context node to push */
+    int32_t     num_medium_entries = 512;
+    int32_t     num_large_entries  = 1024;
+    int32_t     i;
+
+    if (paged)
+        TESTING("batched entry writes (paged aggregation)");
+    else
+        TESTING("batched entry writes");
+
+    pass = true;
+
+    reset_entries();
+
+    file_ptr = setup_cache((size_t)(2 * 1024 * 1024), (size_t)(1 * 1024 * 1024), paged, &api_ctx);
+
+    if (file_ptr == NULL) {
+
+        pass         = false;
+        failure_mssg = "file_ptr NULL from setup_cache.";
+    }
+    else
+        cache_ptr = file_ptr->shared->cache;
+
+    /* Insert entries in reverse address order, and flush them */
+    for (i = num_medium_entries - 1; pass && i >= 0; i--)
+        insert_entry(file_ptr, MEDIUM_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+
+    if (pass)
+        flush_cache(file_ptr, false, false, false);
+
+    if (pass && (cache_ptr->write_batch_depth != 0 || cache_ptr->num_batch_writes != 0 ||
+                 cache_ptr->batch_writes != NULL || cache_ptr->batch_buf != NULL)) {
+
+        pass         = false;
+        failure_mssg = "write batch not released after flush.";
+    }
+
+    if (pass)
+        check_write_batch__verify_images(file_ptr, MEDIUM_ENTRY_TYPE, num_medium_entries);
+
+    /* Insert more entries than fit in the cache, so that dirty entries
+     * are written out to make space for them
+     */
+    for (i = 0; pass && i < num_large_entries; i++)
+        insert_entry(file_ptr, LARGE_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+
+    if (pass && cache_ptr->index_size > cache_ptr->max_cache_size) {
+
+        pass         = false;
+        failure_mssg = "cache oversized after insertions.";
+    }
+
+    if (pass)
+        flush_cache(file_ptr, false, false, false);
+
+    if (pass)
+        check_write_batch__verify_images(file_ptr, LARGE_ENTRY_TYPE, num_large_entries);
+
+    if (pass)
+        check_write_batch__verify_images(file_ptr, MEDIUM_ENTRY_TYPE, num_medium_entries);
+
+    if (pass) {
+
+        takedown_cache(file_ptr, false, false);
+    }
+
+    if (pass) {
+        PASSED();
+    }
+    else {
+        H5_FAILED();
+    }
+
+    if (!pass) {
+
+        fprintf(stdout, "%s(): failure_mssg = \"%s\".\n", __func__, failure_mssg);
+    }
+
+    return (unsigned)!pass;
+} /* check_write_batch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    check_write_batch__verify_images()
+ *
+ * Purpose:     Read the images of the first num_entries entries of the
+ *              given type from the file, and verify that they are the
+ *              images written by serialize().
+ *
+ *              Do nothing if pass is false on entry.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+check_write_batch__verify_images(H5F_t *file_ptr, int32_t type, int32_t num_entries)
+{
+    static char   msg[128];
+    test_entry_t *entry_ptr;
+    uint8_t       image[3];
+    int32_t       i;
+
+    for (i = 0; pass && i < num_entries; i++) {
+        entry_ptr = &(entries[type][i]);
+
+        if (!entry_ptr->written_to_main_addr) {
+
+            pass = false;
+            snprintf(msg, (size_t)128, "entry (%d, %d) not written.", (int)type, (int)i);
+            failure_mssg = msg;
+        }
+        else if (H5F_block_read(file_ptr, H5FD_MEM_DEFAULT, entry_ptr->main_addr, sizeof(image), image) <
+                 0) {
+
+            pass         = false;
+            failure_mssg = "H5F_block_read() failed.";
+        }
+        else if (image[0] != (uint8_t)(type & 0xFF) || image[1] != (uint8_t)((i & 0xFF00) >> 8) ||
+                 image[2] != (uint8_t)(i & 0xFF)) {
+
+            pass = false;
+            snprintf(msg, (size_t)128, "unexpected image for entry (%d, %d).", (int)type, (int)i);
+            failure_mssg = msg;
+        }
+    }
+} /* check_write_batch__verify_images() */
+
 /*****************************************************************************
  *
  * Function:    setup_cache()
@@ -32486,6 +32677,7 @@ main(void)
         nerrs += check_metadata_cork(false, paged);
         nerrs += check_entry_deletions_during_scans(paged);
         nerrs += check_stats(paged);
+        nerrs += check_write_batch(paged);
     } /* end for */
 
     /* can't fail, returns void */
@@ -30,6 +30,7 @@ static const char *FILENAME[] = {"cache_api_test", NULL};
 static bool                 check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id);
 static bool                 check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id);
 static bool                 mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id);
+static bool                 check_file_mdc_working_set(void);
 static H5AC_cache_config_t *init_invalid_configs(void);
 static bool                 check_fapl_mdc_api_errs(void);
 static bool                 check_file_mdc_api_errs(unsigned paged, hid_t fcpl_id);
@@ -1414,6 +1415,297 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
 
 } /* mdc_api_call_smoke_check() */
 
+/*-------------------------------------------------------------------------
+ * Function:    check_file_mdc_working_set()
+ *
+ * Purpose:     Verify that the working set cache size increase mode grows
+ *              the cache when recently evicted entries are loaded again,
+ *              and shrinks it again when the set of entries in use gets
+ *              smaller.  Also verify the miss latency target FAPL property
+ *              and the per-type miss statistics reported by
+ *              H5Fget_mdc_type_stats().
+ *
+ * Return:      Test pass status (true/false)
+ *
+ *-------------------------------------------------------------------------
+ */
+#define WS_NUM_GROUPS 300
+#define WS_NUM_PASSES 4
+
+static bool
+check_file_mdc_working_set(void)
+{
+    char                  filename[512];
+    char                  group_name[32];
+    hid_t                 fapl_id = H5I_INVALID_HID;
+    hid_t                 file_id = H5I_INVALID_HID;
+    hid_t                 group_id;
+    H5AC_cache_config_t   config = H5AC__DEFAULT_CACHE_CONFIG;
+    H5F_mdc_type_stats_t *stats  = NULL;
+    ssize_t               ntypes = 0;
+    uint64_t              total_misses;
+    double                target;
+    herr_t                result;
+    size_t                grown_max_size = 0;
+    size_t                max_size;
+    size_t                min_clean_size;
+    size_t                cur_size;
+    int                   cur_num_entries;
+    int                   i;
+    int                   j;
+
+    TESTING("MDC working set size increase mode");
+
+    pass = true;
+
+    /* Check the miss latency target property */
+    if (pass) {
+
+        if (((fapl_id = h5_fileaccess()) < 0) || (H5Pget_mdc_miss_latency_target(fapl_id, &target) < 0) ||
+            !H5_DBL_ABS_EQUAL(target, 0.0)) {
+
+            pass         = false;
+            failure_mssg = "unexpected default miss latency target.\n";
+        }
+    }
+
+    if (pass) {
+
+        H5E_BEGIN_TRY
+        {
+            result = H5Pset_mdc_miss_latency_target(fapl_id, -1.0);
+        }
+        H5E_END_TRY
+
+        if (result >= 0) {
+
+            pass         = false;
+            failure_mssg = "H5Pset_mdc_miss_latency_target() accepted a negative target.\n";
+        }
+    }
+
+    if (pass) {
+
+        if ((H5Pset_mdc_miss_latency_target(fapl_id, 0.5) < 0) ||
+            (H5Pget_mdc_miss_latency_target(fapl_id, &target) < 0) || !H5_DBL_ABS_EQUAL(target, 0.5) ||
+            (H5Pset_mdc_miss_latency_target(fapl_id, 0.0) < 0)) {
+
+            pass         = false;
+            failure_mssg = "can't set miss latency target.\n";
+        }
+    }
+
+    /* Set up a small cache sized by its working set */
+    if (pass) {
+
+        config.set_initial_size    = true;
+        config.initial_size        = 16 * 1024;
+        config.min_size            = 4 * 1024;
+        config.max_size            = 1024 * 1024;
+        config.epoch_length        = H5C__MIN_AR_EPOCH_LENGTH;
+        config.incr_mode           = H5C_incr__working_set;
+        config.apply_max_increment = false;
+        config.flash_incr_mode     = H5C_flash_incr__off;
+        config.decr_mode           = H5C_decr__off;
+
+        if (H5Pset_mdc_config(fapl_id, &config) < 0) {
+
+            pass         = false;
+            failure_mssg = "H5Pset_mdc_config() failed.\n";
+        }
+    }
+
+    /* Create a file with many groups */
+    if (pass) {
+
+        if (h5_fixname(FILENAME[0], fapl_id, filename, sizeof(filename)) == NULL) {
+
+            pass         = false;
+            failure_mssg = "h5_fixname() failed.\n";
+        }
+    }
+
+    if (pass) {
+
+        if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+
+            pass         = false;
+            failure_mssg = "H5Fcreate() failed.\n";
+        }
+    }
+
+    for (i = 0; pass && i < WS_NUM_GROUPS; i++) {
+
+        snprintf(group_name, sizeof(group_name), "group_%d", i);
+        if (((group_id = H5Gcreate2(file_id, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) ||
+            (H5Gclose(group_id) < 0)) {
+
+            pass         = false;
+            failure_mssg = "can't create group.\n";
+        }
+    }
+
+    if (pass) {
+
+        if (H5Fclose(file_id) < 0) {
+
+            pass         = false;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    /* Cycle through the groups, so that entries evicted by the small cache
+     * are loaded again.  The cache should grow.
+     */
+    if (pass) {
+
+        if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0) {
+
+            pass         = false;
+            failure_mssg = "H5Fopen() failed.\n";
+        }
+    }
+
+    for (j = 0; pass && j < WS_NUM_PASSES; j++)
+        for (i = 0; pass && i < WS_NUM_GROUPS; i++) {
+
+            snprintf(group_name, sizeof(group_name), "group_%d", i);
+            if (((group_id = H5Gopen2(file_id, group_name, H5P_DEFAULT)) < 0) || (H5Gclose(group_id) < 0)) {
+
+                pass         = false;
+                failure_mssg = "can't open group.\n";
+            }
+        }
+
+    if (pass) {
+
+        if (H5Fget_mdc_size(file_id, &grown_max_size, &min_clean_size, &cur_size, &cur_num_entries) < 0) {
+
+            pass         = false;
+            failure_mssg = "H5Fget_mdc_size() failed.\n";
+        }
+        else if (grown_max_size <= config.initial_size) {
+
+            pass         = false;
+            failure_mssg = "cache didn't grow with the working set.\n";
+        }
+    }
+
+    /* Use only one group for a while.  The cache should shrink. */
+    for (i = 0; pass && i < 20 * H5C__MIN_AR_EPOCH_LENGTH; i++) {
+
+        if (((group_id = H5Gopen2(file_id, "group_0", H5P_DEFAULT)) < 0) || (H5Gclose(group_id) < 0)) {
+
+            pass         = false;
+            failure_mssg = "can't open group.\n";
+        }
+    }
+
+    if (pass) {
+
+        if (H5Fget_mdc_size(file_id, &max_size, &min_clean_size, &cur_size, &cur_num_entries) < 0) {
+
+            pass         = false;
+            failure_mssg = "H5Fget_mdc_size() failed.\n";
+        }
+        else if (max_size >= grown_max_size) {
+
+            pass         = false;
+            failure_mssg = "cache didn't shrink with the working set.\n";
+        }
+    }
+
+    /* Check the per-type statistics */
+    if (pass) {
+
+        ntypes = H5Fget_mdc_type_stats(file_id, 0, NULL);
+
+        if ((ntypes <= 0) || (NULL == (stats = (H5F_mdc_type_stats_t *)calloc((size_t)ntypes,
+                                                                                sizeof(H5F_mdc_type_stats_t))))) {
+
+            pass         = false;
+            failure_mssg = "H5Fget_mdc_type_stats() failed to count types.\n";
+        }
+    }
+
+    if (pass) {
+
+        H5E_BEGIN_TRY
+        {
+            result = (H5Fget_mdc_type_stats(file_id, 0, stats) < 0) ? FAIL : SUCCEED;
+        }
+        H5E_END_TRY
+
+        if (result >= 0) {
+
+            pass         = false;
+            failure_mssg = "H5Fget_mdc_type_stats() accepted an empty array.\n";
+        }
+    }
+
+    if (pass) {
+
+        if (H5Fget_mdc_type_stats(file_id, (size_t)ntypes, stats) != ntypes) {
+
+            pass         = false;
+            failure_mssg = "H5Fget_mdc_type_stats() failed.\n";
+        }
+    }
+
+    if (pass) {
+
+        total_misses = 0;
+        for (i = 0; i < (int)ntypes; i++) {
+
+            if ((NULL == stats[i].name) || (stats[i].load_time < 0.0))
+                pass = false;
+            total_misses += stats[i].misses;
+        }
+
+        if (!pass || total_misses < (uint64_t)WS_NUM_GROUPS) {
+
+            pass         = false;
+            failure_mssg = "unexpected metadata cache type statistics.\n";
+        }
+    }
+
+    /* close the file and delete it */
+    if (pass) {
+
+        if (H5Fclose(file_id) < 0) {
+
+            pass         = false;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+        else if (H5Fdelete(filename, fapl_id) < 0) {
+
+            pass         = false;
+            failure_mssg = "H5Fdelete() failed.\n";
+        }
+    }
+
+    if (fapl_id >= 0)
+        H5Pclose(fapl_id);
+    free(stats);
+
+    if (pass) {
+
+        PASSED();
+    }
+    else {
+
+        H5_FAILED();
+    }
+
+    if (!pass) {
+
+        fprintf(stdout, "%s: failure_mssg = \"%s\".\n", __func__, failure_mssg);
+    }
+
+    return pass;
+
+} /* check_file_mdc_working_set() */
+
 /*-------------------------------------------------------------------------
  * Function:    init_invalid_configs()
  *
@@ -1430,7 +1722,7 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
  *-------------------------------------------------------------------------
  */
 
-#define NUM_INVALID_CONFIGS 36
+#define NUM_INVALID_CONFIGS 37
 static H5AC_cache_config_t *invalid_configs = NULL;
 
 static H5AC_cache_config_t *
@@ -1602,6 +1894,10 @@ init_invalid_configs(void)
     /* 35 -- unknown metadata write strategy */
     configs[35].metadata_write_strategy = -1;
 
+    /* 36 -- working set increase mode with automatic decrease enabled */
+    configs[36].incr_mode = H5C_incr__working_set;
+    configs[36].decr_mode = H5C_decr__age_out;
+
     return configs;
 
 } /* initialize_invalid_configs() */
@@ -2287,6 +2583,9 @@ main(void)
     if (!check_fapl_mdc_api_errs())
         nerrs += 1;
 
+    if (!check_file_mdc_working_set())
+        nerrs += 1;
+
     if (invalid_configs)
         free(invalid_configs);
 
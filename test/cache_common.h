@@ -407,9 +407,9 @@ typedef struct test_entry_t {
 
 #define H5C_TEST__SEARCH_INDEX(cache_ptr, Addr, entry_ptr)                                                   \
     {                                                                                                        \
-        int k;                                                                                               \
+        size_t k;                                                                                            \
         H5C_TEST__PRE_HT_SEARCH_SC(cache_ptr, Addr)                                                          \
-        k           = H5C__HASH_FCN(Addr);                                                                   \
+        k           = H5C__HASH_FCN(cache_ptr, Addr);                                                        \
         (entry_ptr) = (cache_ptr)->index[k];                                                                 \
         while (entry_ptr) {                                                                                  \
             if (H5_addr_eq(Addr, (entry_ptr)->addr)) {                                                       \
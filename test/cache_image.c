@@ -53,6 +53,7 @@ static unsigned cache_image_api_error_check_4(bool single_file_vfd);
 
 static unsigned get_free_sections_test(bool single_file_vfd);
 static unsigned evict_on_close_test(bool single_file_vfd);
+static unsigned cache_image_compression_check(bool single_file_vfd);
 
 /****************************************************************************/
 /***************************** Utility Functions ****************************/
@@ -7738,6 +7739,202 @@ evict_on_close_test(bool H5_ATTR_PARALLEL_UNUSED single_file_vfd)
 
 } /* evict_on_close_test() */
 
+/*-------------------------------------------------------------------------
+ * Function:    cache_image_compression_check()
+ *
+ * Purpose:     Verify that cache images written uncompressed and with the
+ *		deflate filter can be loaded, and that opening a file with
+ *		a cache image R/O leaves most of the image's entries to be
+ *		reconstructed when they are first protected.
+ *
+ *		For each compression level:
+ *
+ *		1) Create a HDF5 file with a cache image requested, and
+ *		   the compression level set.
+ *
+ *		2) Create some datasets, and close the file.
+ *
+ *		3) Open the file R/O, verify that the image was loaded
+ *		   with entries still to be reconstructed, verify the
+ *		   datasets, and close the file.
+ *
+ *		4) Open the file R/W, verify the datasets, and close the
+ *		   file.
+ *
+ *		5) Open the file R/O, verify that the image is gone, and
+ *		   close and discard the file.
+ *
+ *		When the deflate filter is available, the compressed image
+ *		must be smaller than the uncompressed one.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+cache_image_compression_check(bool single_file_vfd)
+{
+    char                      filename[512];
+    hid_t                     fapl_id = H5I_INVALID_HID;
+    hid_t                     file_id = H5I_INVALID_HID;
+    H5F_t                    *file_ptr;
+    H5C_t                    *cache_ptr;
+    H5AC_cache_image_config_t cache_image_config = {H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION, true, false,
+                                                    H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE};
+    unsigned                  levels[2]          = {0, 6};
+    hsize_t                   image_len[2]       = {0, 0};
+    unsigned                  level;
+    unsigned                  u;
+
+    TESTING("metadata cache image compression and lazy loading");
+
+    /* Check for VFD that is a single file */
+    if (!single_file_vfd) {
+        SKIPPED();
+        puts("    Cache image not supported with the current VFD.");
+        return 0;
+    }
+
+    pass = true;
+
+    if (h5_fixname(FILENAMES[0], H5P_DEFAULT, filename, sizeof(filename)) == NULL) {
+        pass         = false;
+        failure_mssg = "h5_fixname() failed.\n";
+    }
+
+    for (u = 0; u < 2 && pass; u++) {
+        /* 1) Create the file with a cache image requested */
+        if ((fapl_id = h5_fileaccess()) < 0) {
+            pass         = false;
+            failure_mssg = "h5_fileaccess() failed.\n";
+        }
+        else if (H5Pset_libver_bounds(fapl_id, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0 ||
+                 H5Pset_mdc_image_config(fapl_id, &cache_image_config) < 0) {
+            pass         = false;
+            failure_mssg = "can't set up fapl.\n";
+        }
+        else if (H5Pset_mdc_image_compression(fapl_id, levels[u]) < 0 ||
+                 H5Pget_mdc_image_compression(fapl_id, &level) < 0 || level != levels[u]) {
+            pass         = false;
+            failure_mssg = "can't set cache image compression level.\n";
+        }
+        else if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+            pass         = false;
+            failure_mssg = "H5Fcreate() failed.\n";
+        }
+        H5Pclose(fapl_id);
+
+        /* 2) Create some datasets, and close the file */
+        if (pass)
+            create_datasets(file_id, 0, 5);
+
+        if (pass && H5Fclose(file_id) < 0) {
+            pass         = false;
+            failure_mssg = "H5Fclose() failed (1).\n";
+        }
+
+        /* 3) Open the file R/O, look up a dataset to load the image, and
+         *    check that the image was loaded lazily
+         */
+        if (pass && (file_id = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0) {
+            pass         = false;
+            failure_mssg = "H5Fopen() failed (1).\n";
+        }
+
+        if (pass && H5Lexists(file_id, "/dset000", H5P_DEFAULT) <= 0) {
+            pass         = false;
+            failure_mssg = "H5Lexists() failed.\n";
+        }
+
+        if (pass) {
+            file_ptr  = (H5F_t *)H5VL_object_verify(file_id, H5I_FILE);
+            cache_ptr = file_ptr ? file_ptr->shared->cache : NULL;
+
+            if (cache_ptr == NULL) {
+                pass         = false;
+                failure_mssg = "can't get cache pointer(1).\n";
+            }
+            else if (!cache_ptr->image_loaded || cache_ptr->image_len == 0 ||
+                     cache_ptr->num_lazy_image_entries == 0 || cache_ptr->lazy_image_entries_left == 0) {
+                pass         = false;
+                failure_mssg = "cache image not loaded lazily.\n";
+            }
+            else
+                image_len[u] = cache_ptr->image_len;
+        }
+
+        if (pass)
+            verify_datasets(file_id, 0, 5);
+
+        if (pass && H5Fclose(file_id) < 0) {
+            pass         = false;
+            failure_mssg = "H5Fclose() failed (2).\n";
+        }
+
+        /* 4) Open the file R/W, which deletes the image */
+        if (pass && (file_id = H5Fopen(filename, H5F_ACC_RDWR, H5P_DEFAULT)) < 0) {
+            pass         = false;
+            failure_mssg = "H5Fopen() failed (2).\n";
+        }
+
+        if (pass)
+            verify_datasets(file_id, 0, 5);
+
+        if (pass && H5Fclose(file_id) < 0) {
+            pass         = false;
+            failure_mssg = "H5Fclose() failed (3).\n";
+        }
+
+        /* 5) Check that the image is gone, and discard the file */
+        if (pass && (file_id = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0) {
+            pass         = false;
+            failure_mssg = "H5Fopen() failed (3).\n";
+        }
+
+        if (pass) {
+            file_ptr  = (H5F_t *)H5VL_object_verify(file_id, H5I_FILE);
+            cache_ptr = file_ptr ? file_ptr->shared->cache : NULL;
+
+            if (cache_ptr == NULL) {
+                pass         = false;
+                failure_mssg = "can't get cache pointer(2).\n";
+            }
+            else if (cache_ptr->load_image || cache_ptr->image_loaded) {
+                pass         = false;
+                failure_mssg = "unexpected cache image.\n";
+            }
+        }
+
+        if (pass && H5Fclose(file_id) < 0) {
+            pass         = false;
+            failure_mssg = "H5Fclose() failed (4).\n";
+        }
+
+        if (pass && HDremove(filename) < 0) {
+            pass         = false;
+            failure_mssg = "HDremove() failed.\n";
+        }
+    }
+
+    /* The deflated image should be smaller */
+    if (pass && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0 && image_len[1] >= image_len[0]) {
+        pass         = false;
+        failure_mssg = "compressed cache image not smaller.\n";
+    }
+
+    if (pass) {
+        PASSED();
+    }
+    else {
+        H5_FAILED();
+    }
+
+    if (!pass)
+        fprintf(stdout, "%s: failure_mssg = \"%s\".\n", __func__, failure_mssg);
+
+    return !pass;
+} /* cache_image_compression_check() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -7793,6 +7990,7 @@ main(void)
 
     nerrs += get_free_sections_test(single_file_vfd);
     nerrs += evict_on_close_test(single_file_vfd);
+    nerrs += cache_image_compression_check(single_file_vfd);
 
     return (nerrs > 0);
 
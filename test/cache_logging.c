@@ -13,10 +13,12 @@
 /* Purpose: Tests the metadata cache logging framework */
 
 #include "h5test.h"
+#include "H5Cprivate.h"
 
-#define LOG_LOCATION "cache_logging.out"
+#define LOG_LOCATION        "cache_logging.out"
+#define BINARY_LOG_LOCATION "cache_logging.bin"
 
-static const char *FILENAME[] = {"cache_logging", NULL};
+static const char *FILENAME[] = {"cache_logging", "cache_logging_binary", NULL};
 
 #define N_GROUPS 100
 
@@ -148,6 +150,132 @@ error:
     return 1;
 } /* test_logging_api() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_binary_logging
+ *
+ * Purpose:     Tests the binary mdc log format
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_binary_logging(void)
+{
+    hid_t             fapl   = H5I_INVALID_HID;
+    hid_t             fid    = H5I_INVALID_HID;
+    hid_t             gid    = H5I_INVALID_HID;
+    FILE             *log_fp = NULL;
+    uint8_t          *buf    = NULL;
+    const uint8_t    *p;
+    long              log_size;
+    size_t            nrecords;
+    uint32_t          version;
+    uint32_t          record_size;
+    H5AC_log_format_t format;
+    char              group_name[12];
+    char              filename[1024];
+    int               i;
+
+    TESTING("binary metadata cache log");
+
+    fapl = h5_fileaccess();
+    h5_fixname(FILENAME[1], fapl, filename, sizeof filename);
+
+    /* Check the log format property */
+    if (H5Pget_mdc_log_format(fapl, &format) < 0)
+        TEST_ERROR;
+    if (format != H5AC_LOG_FORMAT_JSON)
+        TEST_ERROR;
+    if (H5Pset_mdc_log_format(fapl, H5AC_LOG_FORMAT_BINARY) < 0)
+        TEST_ERROR;
+    if (H5Pget_mdc_log_format(fapl, &format) < 0)
+        TEST_ERROR;
+    if (format != H5AC_LOG_FORMAT_BINARY)
+        TEST_ERROR;
+    H5E_BEGIN_TRY
+    {
+        if (H5Pset_mdc_log_format(fapl, (H5AC_log_format_t)99) >= 0)
+            TEST_ERROR;
+    }
+    H5E_END_TRY
+
+    /* Log a file from its creation to its close */
+    if (H5Pset_mdc_log_options(fapl, true, BINARY_LOG_LOCATION, true) < 0)
+        TEST_ERROR;
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < N_GROUPS; i++) {
+        snprintf(group_name, sizeof(group_name), "%d", i);
+        if ((gid = H5Gcreate2(fid, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Gclose(gid) < 0)
+            TEST_ERROR;
+    }
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    fid = H5I_INVALID_HID;
+
+    /* Read the log back */
+    if (NULL == (log_fp = fopen(BINARY_LOG_LOCATION, "rb")))
+        TEST_ERROR;
+    if (fseek(log_fp, 0, SEEK_END) < 0 || (log_size = ftell(log_fp)) < 0 || fseek(log_fp, 0, SEEK_SET) < 0)
+        TEST_ERROR;
+    if ((size_t)log_size < H5C_LOG_BINARY_HEADER_SIZE)
+        TEST_ERROR;
+    if (NULL == (buf = (uint8_t *)malloc((size_t)log_size)))
+        TEST_ERROR;
+    if (1 != fread(buf, (size_t)log_size, 1, log_fp))
+        TEST_ERROR;
+    fclose(log_fp);
+    log_fp = NULL;
+
+    /* Check the header */
+    if (memcmp(buf, H5C_LOG_BINARY_SIGNATURE, H5C_LOG_BINARY_SIGNATURE_LEN) != 0)
+        TEST_ERROR;
+    p = buf + H5C_LOG_BINARY_SIGNATURE_LEN;
+    UINT32DECODE(p, version);
+    UINT32DECODE(p, record_size);
+    if (version != H5C_LOG_BINARY_VERSION || record_size != H5C_LOG_BINARY_RECORD_SIZE)
+        TEST_ERROR;
+
+    /* The log must hold whole records, starting and ending with the
+     * logging start and stop records.  The action is the next-to-last
+     * byte of each record.
+     */
+    if (((size_t)log_size - H5C_LOG_BINARY_HEADER_SIZE) % H5C_LOG_BINARY_RECORD_SIZE != 0)
+        TEST_ERROR;
+    nrecords = ((size_t)log_size - H5C_LOG_BINARY_HEADER_SIZE) / H5C_LOG_BINARY_RECORD_SIZE;
+    if (nrecords < 2 + N_GROUPS)
+        TEST_ERROR;
+    if (buf[H5C_LOG_BINARY_HEADER_SIZE + H5C_LOG_BINARY_RECORD_SIZE - 2] != H5C_LOG_ACTION_START)
+        TEST_ERROR;
+    if (buf[log_size - 2] != H5C_LOG_ACTION_STOP)
+        TEST_ERROR;
+
+    /* Clean up */
+    free(buf);
+    HDremove(BINARY_LOG_LOCATION);
+    h5_delete_all_test_files(FILENAME, fapl);
+    H5Pclose(fapl);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY
+    if (log_fp)
+        fclose(log_fp);
+    free(buf);
+
+    return 1;
+} /* test_binary_logging() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -169,6 +297,7 @@ main(void)
     printf("Testing basic metadata cache logging functionality.\n");
 
     nerrors += test_logging_api();
+    nerrors += test_binary_logging();
 
     if (nerrors) {
         printf("***** %d Metadata cache logging TEST%s FAILED! *****\n", nerrors, nerrors > 1 ? "S" : "");
@@ -155,7 +155,7 @@ verify_no_unknown_tags(hid_t fid)
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for (i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for (i = 0; i < (int)cache_ptr->index_buckets; i++) {
         H5C_cache_entry_t *entry_ptr; /* entry pointer */
 
         entry_ptr = cache_ptr->index[i];
@@ -199,7 +199,7 @@ mark_all_entries_investigated(hid_t fid)
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for (i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for (i = 0; i < (int)cache_ptr->index_buckets; i++) {
         H5C_cache_entry_t *entry_ptr; /* entry pointer */
 
         entry_ptr = cache_ptr->index[i];
@@ -241,7 +241,7 @@ reset_all_entries_investigated(hid_t fid)
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for (i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for (i = 0; i < (int)cache_ptr->index_buckets; i++) {
         H5C_cache_entry_t *entry_ptr; /* entry pointer */
 
         entry_ptr = cache_ptr->index[i];
@@ -282,15 +282,12 @@ verify_tag(hid_t fid, int id, haddr_t tag)
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for (i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for (i = 0; i < (int)cache_ptr->index_buckets; i++) {
         H5C_cache_entry_t *entry_ptr; /* entry pointer */
 
         entry_ptr = cache_ptr->index[i];
         while (entry_ptr != NULL) {
-            if (entry_ptr->type->id == id && !entry_ptr->dirtied) {
-                if (entry_ptr->tag_info->tag != tag)
-                    TEST_ERROR;
-
+            if (entry_ptr->type->id == id && !entry_ptr->dirtied && entry_ptr->tag_info->tag == tag) {
                 /* Mark the entry/tag pair as found */
                 entry_ptr->dirtied = true;
 
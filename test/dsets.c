@@ -79,6 +79,8 @@ static const char *FILENAME[] = {"dataset",             /* 0 */
                                  "h5s_block",           /* 27 */
                                  "h5s_plist",           /* 28 */
                                  "vds_strings",         /* 29 */
+                                 "sieve_windows",       /* 30 */
+                                 "skip_fill_chunks",    /* 31 */
                                  NULL};
 
 #define OHMIN_FILENAME_A "ohdr_min_a"
@@ -95,6 +97,7 @@ static const char *FILENAME[] = {"dataset",             /* 0 */
 #define DSET_SIMPLE_IO_NAME    "simple_io"
 #define DSET_USERBLOCK_IO_NAME "userblock_io"
 #define DSET_COMPACT_IO_NAME   "compact_io"
+#define DSET_SIEVE_WIN_NAME    "sieve_windows"
 #define DSET_COMPACT_MAX_NAME  "max_compact"
 #define DSET_COMPACT_MAX2_NAME "max_compact_2"
 #define DSET_CONV_BUF_NAME     "conv_buf"
@@ -274,9 +277,20 @@ static const char *FILENAME[] = {"dataset",             /* 0 */
 #define STORAGE_SIZE_CHUNK_DIM1 5
 #define STORAGE_SIZE_CHUNK_DIM2 5
 
+/* Parameters for skip fill chunks test */
+#define SKIP_FILL_DIM       40
+#define SKIP_FILL_CHUNK_DIM 10
+#define SKIP_FILL_NCHUNKS   ((SKIP_FILL_DIM / SKIP_FILL_CHUNK_DIM) * (SKIP_FILL_DIM / SKIP_FILL_CHUNK_DIM))
+#define SKIP_FILL_VALUE     (-1)
+
 /* Shared global arrays */
 #define DSET_DIM1 100
 #define DSET_DIM2 200
+
+/* Dimension of the square dataset for testing data sieve windows */
+#define SIEVE_WIN_DIM 64
+/* # of rows each stream of accesses runs over, when counting the I/O */
+#define SIEVE_WIN_STREAM_ROWS 16
 int    **points               = NULL;
 int     *points_data          = NULL;
 double **points_dbl           = NULL;
@@ -825,6 +839,458 @@ error:
     return FAIL;
 } /* end test_userblock_offset() */
 
+/*-------------------------------------------------------------------------
+ * VFD for test_sieve_windows, which counts the raw data reads and writes
+ * of a sec2 file
+ *-------------------------------------------------------------------------
+ */
+typedef struct sieve_count_file_t {
+    H5FD_t  pub;   /* Public VFD info, must be first */
+    H5FD_t *inner; /* The sec2 file */
+} sieve_count_file_t;
+
+static hid_t         sieve_count_inner_fapl_g = H5I_INVALID_HID; /* FAPL for the sec2 file */
+static unsigned long sieve_count_nreads_g     = 0;               /* # of raw data reads */
+static unsigned long sieve_count_nwrites_g    = 0;               /* # of raw data writes */
+
+static H5FD_t *
+sieve_count_open(const char *name, unsigned flags, hid_t H5_ATTR_UNUSED fapl_id, haddr_t maxaddr)
+{
+    sieve_count_file_t *file;
+
+    if (NULL == (file = (sieve_count_file_t *)calloc(1, sizeof(sieve_count_file_t))))
+        return NULL;
+    if (NULL == (file->inner = H5FDopen(name, flags, sieve_count_inner_fapl_g, maxaddr))) {
+        free(file);
+        return NULL;
+    }
+
+    return &file->pub;
+}
+static herr_t
+sieve_count_close(H5FD_t *_file)
+{
+    sieve_count_file_t *file      = (sieve_count_file_t *)_file;
+    herr_t              ret_value = H5FDclose(file->inner);
+
+    free(file);
+    return ret_value;
+}
+static herr_t
+sieve_count_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags)
+{
+    *flags = H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
+             H5FD_FEAT_AGGREGATE_SMALLDATA;
+    return SUCCEED;
+}
+static haddr_t
+sieve_count_get_eoa(const H5FD_t *_file, H5FD_mem_t type)
+{
+    return H5FDget_eoa(((const sieve_count_file_t *)_file)->inner, type);
+}
+static herr_t
+sieve_count_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
+{
+    return H5FDset_eoa(((sieve_count_file_t *)_file)->inner, type, addr);
+}
+static haddr_t
+sieve_count_get_eof(const H5FD_t *_file, H5FD_mem_t type)
+{
+    return H5FDget_eof(((const sieve_count_file_t *)_file)->inner, type);
+}
+static herr_t
+sieve_count_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size, void *buf)
+{
+    if (type == H5FD_MEM_DRAW)
+        sieve_count_nreads_g++;
+    return H5FDread(((sieve_count_file_t *)_file)->inner, type, dxpl_id, addr, size, buf);
+}
+static herr_t
+sieve_count_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size, const void *buf)
+{
+    if (type == H5FD_MEM_DRAW)
+        sieve_count_nwrites_g++;
+    return H5FDwrite(((sieve_count_file_t *)_file)->inner, type, dxpl_id, addr, size, buf);
+}
+static herr_t
+sieve_count_truncate(H5FD_t *_file, hid_t dxpl_id, bool closing)
+{
+    return H5FDtruncate(((sieve_count_file_t *)_file)->inner, dxpl_id, closing);
+}
+
+static const H5FD_class_t H5FD_sieve_count_g = {
+    H5FD_CLASS_VERSION,      /* struct version  */
+    (H5FD_class_value_t)257, /* value           */
+    "sieve_count",           /* name            */
+    H5FD_MAXADDR,            /* maxaddr         */
+    H5F_CLOSE_WEAK,          /* fc_degree       */
+    NULL,                    /* terminate       */
+    NULL,                    /* sb_size         */
+    NULL,                    /* sb_encode       */
+    NULL,                    /* sb_decode       */
+    0,                       /* fapl_size       */
+    NULL,                    /* fapl_get        */
+    NULL,                    /* fapl_copy       */
+    NULL,                    /* fapl_free       */
+    0,                       /* dxpl_size       */
+    NULL,                    /* dxpl_copy       */
+    NULL,                    /* dxpl_free       */
+    sieve_count_open,        /* open            */
+    sieve_count_close,       /* close           */
+    NULL,                    /* cmp             */
+    sieve_count_query,       /* query           */
+    NULL,                    /* get_type_map    */
+    NULL,                    /* alloc           */
+    NULL,                    /* free            */
+    sieve_count_get_eoa,     /* get_eoa         */
+    sieve_count_set_eoa,     /* set_eoa         */
+    sieve_count_get_eof,     /* get_eof         */
+    NULL,                    /* get_handle      */
+    sieve_count_read,        /* read            */
+    sieve_count_write,       /* write           */
+    NULL,                    /* read_vector     */
+    NULL,                    /* write_vector    */
+    NULL,                    /* read_selection  */
+    NULL,                    /* write_selection */
+    NULL,                    /* flush           */
+    sieve_count_truncate,    /* truncate        */
+    NULL,                    /* lock            */
+    NULL,                    /* unlock          */
+    NULL,                    /* del             */
+    NULL,                    /* ctl             */
+    H5FD_FLMAP_DICHOTOMY     /* fl_map          */
+};
+
+/*-------------------------------------------------------------------------
+ * Function:    sieve_windows_count_io
+ *
+ * Purpose:     Helper for test_sieve_windows: reads or writes half rows
+ *              of the dataset in one or two streams, running over
+ *              SIEVE_WIN_STREAM_ROWS rows from the start and from the
+ *              middle of the dataset, and counts the raw data reads and
+ *              writes until the dataset is closed.  With both streams,
+ *              their accesses alternate.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+sieve_windows_count_io(hid_t file, int *model, unsigned streams, bool do_write, unsigned long *nreads,
+                       unsigned long *nwrites)
+{
+    hid_t   dataset = H5I_INVALID_HID, space = H5I_INVALID_HID, mspace = H5I_INVALID_HID;
+    hsize_t start[2] = {0, 0};
+    hsize_t count[2] = {1, SIEVE_WIN_DIM / 2};
+    int     buf[SIEVE_WIN_DIM / 2];
+    int     row, half, s, j;
+
+    if ((dataset = H5Dopen2(file, DSET_SIEVE_WIN_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((space = H5Dget_space(dataset)) < 0)
+        TEST_ERROR;
+    if ((mspace = H5Screate_simple(1, &count[1], NULL)) < 0)
+        TEST_ERROR;
+
+    sieve_count_nreads_g  = 0;
+    sieve_count_nwrites_g = 0;
+
+    for (row = 0; row < SIEVE_WIN_STREAM_ROWS; row++)
+        for (half = 0; half < 2; half++)
+            for (s = 0; s < 2; s++) {
+                int *elmts;
+
+                if (!(streams & (1U << s)))
+                    continue;
+
+                start[0] = (hsize_t)(row + (s * SIEVE_WIN_DIM / 2));
+                start[1] = (hsize_t)(half * SIEVE_WIN_DIM / 2);
+                elmts    = model + (start[0] * SIEVE_WIN_DIM) + start[1];
+                if (H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                    TEST_ERROR;
+
+                if (do_write) {
+                    for (j = 0; j < SIEVE_WIN_DIM / 2; j++)
+                        buf[j] = ++elmts[j];
+                    if (H5Dwrite(dataset, H5T_NATIVE_INT, mspace, space, H5P_DEFAULT, buf) < 0)
+                        TEST_ERROR;
+                }
+                else {
+                    if (H5Dread(dataset, H5T_NATIVE_INT, mspace, space, H5P_DEFAULT, buf) < 0)
+                        TEST_ERROR;
+                    for (j = 0; j < SIEVE_WIN_DIM / 2; j++)
+                        if (buf[j] != elmts[j]) {
+                            H5_FAILED();
+                            printf("    Read different values than written.\n");
+                            printf("    At index %d,%d\n", (int)start[0], (int)start[1] + j);
+                            goto error;
+                        }
+                }
+            }
+
+    /* Closing the dataset writes the dirty windows */
+    if (H5Sclose(mspace) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dataset) < 0)
+        TEST_ERROR;
+
+    *nreads  = sieve_count_nreads_g;
+    *nwrites = sieve_count_nwrites_g;
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(mspace);
+        H5Sclose(space);
+        H5Dclose(dataset);
+    }
+    H5E_END_TRY
+
+    return FAIL;
+} /* end sieve_windows_count_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_sieve_windows
+ *
+ * Purpose:     Tests I/O on a contiguous dataset through the data sieve
+ *              windows, with a small sieve buffer and several interleaved
+ *              streams of partial reads and writes: rows, which sieve,
+ *              columns, whose elements are too far apart to sieve, and
+ *              scattered elements.  The data read must always match what
+ *              was written.
+ *
+ *              With the default file driver, also counts the raw data
+ *              I/O of two streams of half rows run one after the other,
+ *              then interleaved.  A single sieve window has to reload on
+ *              every switch between the streams, so each access would
+ *              read the file; the windows keep the I/O of the interleaved
+ *              streams to that of the streams run on their own.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_sieve_windows(hid_t fapl)
+{
+    char          filename[FILENAME_BUF_SIZE];
+    hid_t         file = H5I_INVALID_HID, dataset = H5I_INVALID_HID, space = H5I_INVALID_HID;
+    hid_t         mspace = H5I_INVALID_HID, my_fapl = H5I_INVALID_HID;
+    hid_t         driver_id = H5I_INVALID_HID;
+    bool          count_io  = h5_using_default_driver(NULL);
+    unsigned long nreads[3], nwrites[3];
+    hsize_t  dims[2]   = {SIEVE_WIN_DIM, SIEVE_WIN_DIM};
+    hsize_t  start[2]  = {0, 0};
+    hsize_t  count[2]  = {0, 0};
+    hsize_t  mdims[1]  = {SIEVE_WIN_DIM};
+    int     *model     = NULL;
+    int     *check_buf = NULL;
+    int      buf[SIEVE_WIN_DIM];
+    unsigned seed = 1;
+    int      i, j, n, step;
+
+    TESTING("data sieve windows");
+
+    h5_fixname(FILENAME[30], fapl, filename, sizeof filename);
+
+    if (NULL == (model = (int *)calloc(SIEVE_WIN_DIM * SIEVE_WIN_DIM, sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (check_buf = (int *)calloc(SIEVE_WIN_DIM * SIEVE_WIN_DIM, sizeof(int))))
+        TEST_ERROR;
+
+    /* Use a sieve buffer holding a few rows */
+    if ((my_fapl = H5Pcopy(fapl)) < 0)
+        TEST_ERROR;
+    if (H5Pset_sieve_buf_size(my_fapl, (size_t)(4 * SIEVE_WIN_DIM) * sizeof(int)) < 0)
+        TEST_ERROR;
+
+    /* Count the I/O to a sec2 file */
+    if (count_io) {
+        if ((sieve_count_inner_fapl_g = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+            TEST_ERROR;
+        if (H5Pset_fapl_sec2(sieve_count_inner_fapl_g) < 0)
+            TEST_ERROR;
+        if ((driver_id = H5FDregister(&H5FD_sieve_count_g)) < 0)
+            TEST_ERROR;
+        if (H5Pset_driver(my_fapl, driver_id, NULL) < 0)
+            TEST_ERROR;
+    }
+
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+        TEST_ERROR;
+    if ((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((mspace = H5Screate_simple(1, mdims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dataset = H5Dcreate2(file, DSET_SIEVE_WIN_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* Initialize the dataset */
+    for (n = 0; n < SIEVE_WIN_DIM * SIEVE_WIN_DIM; n++)
+        model[n] = n;
+    if (H5Dwrite(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, model) < 0)
+        TEST_ERROR;
+
+    /* Interleave partial rows and columns, read and written, in two halves
+     * of the dataset, with scattered elements in between */
+    for (step = 0; step < 4 * SIEVE_WIN_DIM; step++) {
+        int  op       = step % 4;
+        int  row      = (step / 4) + ((step % 2) ? SIEVE_WIN_DIM / 2 : 0);
+        int  col      = ((step / 4) * 7) % SIEVE_WIN_DIM;
+        bool do_write = ((step / 8) % 2) == 0;
+
+        row %= SIEVE_WIN_DIM;
+        if (op < 2) {
+            /* Half a row */
+            start[0] = (hsize_t)row;
+            start[1] = (hsize_t)((step / 4) % 2) * (SIEVE_WIN_DIM / 2);
+            count[0] = 1;
+            count[1] = SIEVE_WIN_DIM / 2;
+        }
+        else if (op == 2) {
+            /* A whole column */
+            start[0] = 0;
+            start[1] = (hsize_t)col;
+            count[0] = SIEVE_WIN_DIM;
+            count[1] = 1;
+        }
+        else {
+            /* A single element somewhere */
+            seed     = (seed * 1103515245 + 12345) & 0x7fffffff;
+            start[0] = (hsize_t)((seed >> 8) % SIEVE_WIN_DIM);
+            start[1] = (hsize_t)((seed >> 16) % SIEVE_WIN_DIM);
+            count[0] = 1;
+            count[1] = 1;
+        }
+
+        if (H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        mdims[0] = count[0] * count[1];
+        if (H5Sset_extent_simple(mspace, 1, mdims, NULL) < 0)
+            TEST_ERROR;
+
+        if (do_write) {
+            for (i = 0; i < (int)count[0]; i++)
+                for (j = 0; j < (int)count[1]; j++) {
+                    buf[(i * (int)count[1]) + j] = -(step * SIEVE_WIN_DIM + i + j + 1);
+                    model[(((int)start[0] + i) * SIEVE_WIN_DIM) + (int)start[1] + j] =
+                        buf[(i * (int)count[1]) + j];
+                }
+            if (H5Dwrite(dataset, H5T_NATIVE_INT, mspace, space, H5P_DEFAULT, buf) < 0)
+                TEST_ERROR;
+        }
+        else {
+            if (H5Dread(dataset, H5T_NATIVE_INT, mspace, space, H5P_DEFAULT, buf) < 0)
+                TEST_ERROR;
+            for (i = 0; i < (int)count[0]; i++)
+                for (j = 0; j < (int)count[1]; j++)
+                    if (buf[(i * (int)count[1]) + j] !=
+                        model[(((int)start[0] + i) * SIEVE_WIN_DIM) + (int)start[1] + j]) {
+                        H5_FAILED();
+                        printf("    Read different values than written at step %d.\n", step);
+                        printf("    At index %d,%d\n", (int)start[0] + i, (int)start[1] + j);
+                        goto error;
+                    }
+        }
+    }
+
+    /* Compare the I/O of two streams run on their own with the I/O of the
+     * same streams interleaved, reading and writing */
+    if (count_io) {
+        if (H5Dclose(dataset) < 0)
+            TEST_ERROR;
+
+        for (n = 0; n < 2; n++) {
+            for (i = 0; i < 3; i++)
+                if (sieve_windows_count_io(file, model, (unsigned)i + 1, n == 1, &nreads[i], &nwrites[i]) < 0)
+                    goto error;
+
+            /* Besides the first access of the second stream, which goes
+             * directly to the file, interleaving the streams must not add
+             * any I/O, and must need far fewer reads than accesses */
+            if (nreads[2] > nreads[0] + nreads[1] + 1 || nwrites[2] > nwrites[0] + nwrites[1] + 1 ||
+                nreads[2] >= SIEVE_WIN_STREAM_ROWS) {
+                H5_FAILED();
+                printf("    %s: %lu reads, %lu writes for interleaved streams,"
+                       " %lu and %lu reads, %lu and %lu writes on their own\n",
+                       n ? "write" : "read", nreads[2], nwrites[2], nreads[0], nreads[1], nwrites[0],
+                       nwrites[1]);
+                goto error;
+            }
+        }
+
+        if ((dataset = H5Dopen2(file, DSET_SIEVE_WIN_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+    }
+
+    /* Check the whole dataset, before and after the sieve windows are flushed */
+    for (n = 0; n < 2; n++) {
+        if (n == 1) {
+            if (H5Dclose(dataset) < 0)
+                TEST_ERROR;
+            if ((dataset = H5Dopen2(file, DSET_SIEVE_WIN_NAME, H5P_DEFAULT)) < 0)
+                TEST_ERROR;
+        }
+        if (H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check_buf) < 0)
+            TEST_ERROR;
+        for (i = 0; i < SIEVE_WIN_DIM * SIEVE_WIN_DIM; i++)
+            if (check_buf[i] != model[i]) {
+                H5_FAILED();
+                printf("    Read different values than written.\n");
+                printf("    At index %d,%d\n", i / SIEVE_WIN_DIM, i % SIEVE_WIN_DIM);
+                goto error;
+            }
+    }
+
+    if (H5Dclose(dataset) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+    if (H5Pclose(my_fapl) < 0)
+        TEST_ERROR;
+    if (count_io) {
+        if (H5FDunregister(driver_id) < 0)
+            TEST_ERROR;
+        if (H5Pclose(sieve_count_inner_fapl_g) < 0)
+            TEST_ERROR;
+        sieve_count_inner_fapl_g = H5I_INVALID_HID;
+    }
+
+    free(model);
+    free(check_buf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dataset);
+        H5Sclose(mspace);
+        H5Sclose(space);
+        H5Fclose(file);
+        H5Pclose(my_fapl);
+        H5FDunregister(driver_id);
+        H5Pclose(sieve_count_inner_fapl_g);
+    }
+    H5E_END_TRY
+    sieve_count_inner_fapl_g = H5I_INVALID_HID;
+
+    free(model);
+    free(check_buf);
+
+    return FAIL;
+} /* end test_sieve_windows() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_compact_io
  *
@@ -13325,6 +13791,285 @@ error:
     return FAIL;
 } /* end test_storage_size() */
 
+/*-------------------------------------------------------------------------
+ * Function: check_skip_fill_chunks
+ *
+ * Purpose:     Helper for test_skip_fill_chunks: checks the number of
+ *              chunks allocated for a dataset, and that it reads back the
+ *              expected data.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+check_skip_fill_chunks(hid_t dsid, const int *model, hsize_t nchunks)
+{
+    int    *rbuf = NULL;
+    hsize_t num_chunks;
+    hsize_t ssize;
+    int     i;
+
+    if (H5Dflush(dsid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Dget_num_chunks(dsid, H5S_ALL, &num_chunks) < 0)
+        FAIL_STACK_ERROR;
+    if (num_chunks != nchunks) {
+        H5_FAILED();
+        printf("    %" PRIuHSIZE " chunks allocated, expected %" PRIuHSIZE "\n", num_chunks, nchunks);
+        goto error;
+    }
+    if (0 == (ssize = H5Dget_storage_size(dsid)) && nchunks > 0)
+        FAIL_STACK_ERROR;
+    if (ssize != nchunks * SKIP_FILL_CHUNK_DIM * SKIP_FILL_CHUNK_DIM * sizeof(int))
+        TEST_ERROR;
+
+    if (NULL == (rbuf = (int *)malloc(SKIP_FILL_DIM * SKIP_FILL_DIM * sizeof(int))))
+        TEST_ERROR;
+    if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    for (i = 0; i < SKIP_FILL_DIM * SKIP_FILL_DIM; i++)
+        if (rbuf[i] != model[i]) {
+            H5_FAILED();
+            printf("    Read different values than written.\n");
+            printf("    At index %d,%d\n", i / SKIP_FILL_DIM, i % SKIP_FILL_DIM);
+            goto error;
+        }
+
+    free(rbuf);
+
+    return SUCCEED;
+
+error:
+    free(rbuf);
+
+    return FAIL;
+} /* end check_skip_fill_chunks() */
+
+/*-------------------------------------------------------------------------
+ * Function: test_skip_fill_chunks
+ *
+ * Purpose:     Tests that chunks holding nothing but the fill value are
+ *              not allocated, or are removed, when the dataset is opened
+ *              with H5Pset_skip_fill_chunks(), both through the chunk
+ *              cache and when whole chunks are written directly.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_skip_fill_chunks(hid_t fapl)
+{
+    char    filename[FILENAME_BUF_SIZE];
+    hid_t   fid   = H5I_INVALID_HID; /* File ID */
+    hid_t   dcpl  = H5I_INVALID_HID; /* Dataset creation property list ID */
+    hid_t   dcpl2 = H5I_INVALID_HID; /* Dataset creation property list ID, with the default fill value */
+    hid_t   dapl  = H5I_INVALID_HID; /* Dataset access property list ID */
+    hid_t   dapl2 = H5I_INVALID_HID; /* Dataset access property list ID, without a chunk cache */
+    hid_t   sid   = H5I_INVALID_HID; /* Dataspace ID */
+    hid_t   msid  = H5I_INVALID_HID; /* Memory dataspace ID */
+    hid_t   dsid  = H5I_INVALID_HID; /* Dataset ID */
+    hsize_t dims[2]       = {SKIP_FILL_DIM, SKIP_FILL_DIM};
+    hsize_t chunk_dims[2] = {SKIP_FILL_CHUNK_DIM, SKIP_FILL_CHUNK_DIM};
+    hsize_t start[2];
+    int     fill_value = SKIP_FILL_VALUE;
+    int    *model      = NULL;
+    int     chunk_buf[SKIP_FILL_CHUNK_DIM * SKIP_FILL_CHUNK_DIM];
+    bool    skip_fill;
+    int     i, j;
+
+    TESTING("skipping chunks of fill values");
+
+    h5_fixname(FILENAME[31], fapl, filename, sizeof filename);
+
+    if (NULL == (model = (int *)malloc(SKIP_FILL_DIM * SKIP_FILL_DIM * sizeof(int))))
+        TEST_ERROR;
+
+    /* Check the property */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pget_skip_fill_chunks(dapl, &skip_fill) < 0)
+        FAIL_STACK_ERROR;
+    if (skip_fill)
+        TEST_ERROR;
+    if (H5Pset_skip_fill_chunks(dapl, true) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pget_skip_fill_chunks(dapl, &skip_fill) < 0)
+        FAIL_STACK_ERROR;
+    if (!skip_fill)
+        TEST_ERROR;
+
+    /* Copy the DAPL, and bypass the chunk cache so whole chunks are written
+     * directly */
+    if ((dapl2 = H5Pcopy(dapl)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_chunk_cache(dapl2, 0, 0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR;
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR;
+    if ((msid = H5Screate_simple(2, chunk_dims, NULL)) < 0)
+        FAIL_STACK_ERROR;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill_value) < 0)
+        FAIL_STACK_ERROR;
+    if ((dcpl2 = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_chunk(dcpl2, 2, chunk_dims) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Write the fill value everywhere but in two chunks, through the chunk
+     * cache */
+    if ((dsid = H5Dcreate2(fid, "cached", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR;
+    for (i = 0; i < SKIP_FILL_DIM; i++)
+        for (j = 0; j < SKIP_FILL_DIM; j++)
+            model[(i * SKIP_FILL_DIM) + j] = ((i < SKIP_FILL_CHUNK_DIM && j < SKIP_FILL_CHUNK_DIM) ||
+                                              (i >= 2 * SKIP_FILL_CHUNK_DIM && i < 3 * SKIP_FILL_CHUNK_DIM &&
+                                               j >= 3 * SKIP_FILL_CHUNK_DIM))
+                                                 ? (i * SKIP_FILL_DIM) + j
+                                                 : SKIP_FILL_VALUE;
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, model) < 0)
+        FAIL_STACK_ERROR;
+    if (check_skip_fill_chunks(dsid, model, 2) < 0)
+        goto error;
+
+    /* Overwrite the first chunk with the fill value, the chunk must go */
+    start[0] = start[1] = 0;
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, chunk_dims, NULL) < 0)
+        FAIL_STACK_ERROR;
+    for (i = 0; i < SKIP_FILL_CHUNK_DIM * SKIP_FILL_CHUNK_DIM; i++)
+        chunk_buf[i] = SKIP_FILL_VALUE;
+    for (i = 0; i < SKIP_FILL_CHUNK_DIM; i++)
+        for (j = 0; j < SKIP_FILL_CHUNK_DIM; j++)
+            model[(i * SKIP_FILL_DIM) + j] = SKIP_FILL_VALUE;
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, chunk_buf) < 0)
+        FAIL_STACK_ERROR;
+    if (check_skip_fill_chunks(dsid, model, 1) < 0)
+        goto error;
+
+    /* Reopen without the property, nothing changes */
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR;
+    if ((dsid = H5Dopen2(fid, "cached", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+    if (check_skip_fill_chunks(dsid, model, 1) < 0)
+        goto error;
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Write all the chunks, then overwrite one directly with the fill value */
+    if ((dsid = H5Dcreate2(fid, "direct", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl2)) < 0)
+        FAIL_STACK_ERROR;
+    for (i = 0; i < SKIP_FILL_DIM * SKIP_FILL_DIM; i++)
+        model[i] = i;
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, model) < 0)
+        FAIL_STACK_ERROR;
+    if (check_skip_fill_chunks(dsid, model, SKIP_FILL_NCHUNKS) < 0)
+        goto error;
+    start[0] = SKIP_FILL_CHUNK_DIM;
+    start[1] = 2 * SKIP_FILL_CHUNK_DIM;
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, chunk_dims, NULL) < 0)
+        FAIL_STACK_ERROR;
+    for (i = 0; i < SKIP_FILL_CHUNK_DIM; i++)
+        for (j = 0; j < SKIP_FILL_CHUNK_DIM; j++)
+            model[((i + (int)start[0]) * SKIP_FILL_DIM) + j + (int)start[1]] = SKIP_FILL_VALUE;
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, chunk_buf) < 0)
+        FAIL_STACK_ERROR;
+    if (check_skip_fill_chunks(dsid, model, SKIP_FILL_NCHUNKS - 1) < 0)
+        goto error;
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR;
+
+    /* With the default fill value, chunks of zeros written directly are
+     * never allocated, and removed once overwritten with zeros */
+    if (H5Sselect_all(sid) < 0)
+        FAIL_STACK_ERROR;
+    if ((dsid = H5Dcreate2(fid, "direct_default_fill", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl2, dapl2)) < 0)
+        FAIL_STACK_ERROR;
+    for (i = 0; i < SKIP_FILL_DIM; i++)
+        for (j = 0; j < SKIP_FILL_DIM; j++)
+            model[(i * SKIP_FILL_DIM) + j] = (i < SKIP_FILL_CHUNK_DIM && j < SKIP_FILL_CHUNK_DIM) ? 1 : 0;
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, model) < 0)
+        FAIL_STACK_ERROR;
+    if (check_skip_fill_chunks(dsid, model, 1) < 0)
+        goto error;
+    start[0] = start[1] = 0;
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, chunk_dims, NULL) < 0)
+        FAIL_STACK_ERROR;
+    for (i = 0; i < SKIP_FILL_CHUNK_DIM * SKIP_FILL_CHUNK_DIM; i++)
+        chunk_buf[i] = 0;
+    for (i = 0; i < SKIP_FILL_CHUNK_DIM; i++)
+        for (j = 0; j < SKIP_FILL_CHUNK_DIM; j++)
+            model[(i * SKIP_FILL_DIM) + j] = 0;
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, chunk_buf) < 0)
+        FAIL_STACK_ERROR;
+    if (check_skip_fill_chunks(dsid, model, 0) < 0)
+        goto error;
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Without the property, chunks of fill values are still allocated */
+    if (H5Sselect_all(sid) < 0)
+        FAIL_STACK_ERROR;
+    if ((dsid = H5Dcreate2(fid, "default", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+    for (i = 0; i < SKIP_FILL_DIM * SKIP_FILL_DIM; i++)
+        model[i] = SKIP_FILL_VALUE;
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, model) < 0)
+        FAIL_STACK_ERROR;
+    if (check_skip_fill_chunks(dsid, model, SKIP_FILL_NCHUNKS) < 0)
+        goto error;
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR;
+
+    if (H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(dcpl2) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(dapl2) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR;
+
+    free(model);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Pclose(dcpl2);
+        H5Pclose(dcpl);
+        H5Pclose(dapl2);
+        H5Pclose(dapl);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY
+
+    free(model);
+
+    return FAIL;
+} /* end test_skip_fill_chunks() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_power2up
  *
@@ -17287,6 +18032,7 @@ main(void)
 
                 nerrors += (test_create(file) < 0 ? 1 : 0);
                 nerrors += (test_simple_io(driver_name, my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_sieve_windows(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_compact_io(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_max_compact(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_compact_open_close_dirty(my_fapl) < 0 ? 1 : 0);
@@ -17358,6 +18104,7 @@ main(void)
                 nerrors += (test_large_chunk_shrink(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_zero_dim_dset(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_storage_size(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_skip_fill_chunks(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_power2up(my_fapl) < 0 ? 1 : 0);
 
                 nerrors += (test_swmr_non_latest(driver_name, my_fapl) < 0 ? 1 : 0);
@@ -18,6 +18,9 @@
 
 #define EVENT_SET_NUM_CONNECTOR_IDS 2
 
+#define EVENT_SET_NROWS 8
+#define EVENT_SET_NCOLS 256
+
 static const char *FILENAME[] = {"event_set_1", NULL};
 
 static hid_t connector_ids_g[EVENT_SET_NUM_CONNECTOR_IDS];
@@ -708,6 +711,322 @@ error:
     return 1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_es_native_async_io
+ *
+ * Purpose:     Tests asynchronous dataset I/O run in the background by the
+ *              native VOL connector.  Without thread-safety, the same
+ *              calls complete before they return.
+ *
+ * Return:      Success:    0
+ *              Failure:    number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_es_native_async_io(hid_t fapl_id)
+{
+    char            filename[1024];
+    hid_t           fapl          = H5I_INVALID_HID; /* File access property list */
+    hid_t           es_id         = H5I_INVALID_HID; /* Event set ID */
+    hid_t           file_id       = H5I_INVALID_HID; /* File ID */
+    hid_t           dset_id       = H5I_INVALID_HID; /* Dataset ID */
+    hid_t           fspace_id     = H5I_INVALID_HID; /* File dataspace ID */
+    hid_t           mspace_id     = H5I_INVALID_HID; /* Memory dataspace ID */
+    hid_t           bad_mspace_id = H5I_INVALID_HID; /* Memory dataspace with the wrong size */
+    hsize_t         dims[2]       = {EVENT_SET_NROWS, EVENT_SET_NCOLS};
+    hsize_t         row_dims[1]   = {EVENT_SET_NCOLS};
+    hsize_t         start[2]      = {0, 0};
+    hsize_t         count[2]      = {1, EVENT_SET_NCOLS};
+    hssize_t        offset[2]     = {0, 0};
+    int            *wbuf          = NULL; /* Data written, one row per write */
+    int            *rbuf          = NULL; /* Data read */
+    bool            is_ts         = false;
+    bool            enable        = false;
+    size_t          num_in_progress; /* # of operations that haven't finished */
+    size_t          num_events;      /* # of events in set */
+    size_t          num_errs;        /* # of failed events in set */
+    size_t          num_cleared;     /* # of failed events retrieved */
+    bool            op_failed;       /* Whether an operation failed */
+    H5ES_err_info_t err_info;        /* Info for the failed operation */
+    herr_t          ret;
+    unsigned        u, v; /* Local index variables */
+
+    TESTING("native asynchronous dataset I/O");
+
+    if (H5is_library_threadsafe(&is_ts) < 0)
+        TEST_ERROR;
+
+    h5_fixname(FILENAME[0], fapl_id, filename, sizeof(filename));
+
+    if (NULL == (wbuf = (int *)malloc(EVENT_SET_NROWS * EVENT_SET_NCOLS * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf = (int *)malloc(EVENT_SET_NROWS * EVENT_SET_NCOLS * sizeof(int))))
+        TEST_ERROR;
+    for (u = 0; u < EVENT_SET_NROWS * EVENT_SET_NCOLS; u++)
+        wbuf[u] = (int)u;
+
+    /* Turn on asynchronous dataset I/O for the file */
+    if ((fapl = H5Pcopy(fapl_id)) < 0)
+        TEST_ERROR;
+    if (H5Pset_native_async_io(fapl, true) < 0)
+        TEST_ERROR;
+    if (H5Pget_native_async_io(fapl, &enable) < 0)
+        TEST_ERROR;
+    if (!enable)
+        FAIL_PUTS_ERROR("asynchronous dataset I/O should be enabled");
+
+    if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    if ((fspace_id = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((mspace_id = H5Screate_simple(1, row_dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, "dset", H5T_NATIVE_INT, fspace_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((es_id = H5EScreate()) < 0)
+        TEST_ERROR;
+
+    /* Queue a write for each row, re-using the file dataspace for each one */
+    for (u = 0; u < EVENT_SET_NROWS; u++) {
+        start[0] = u;
+        if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT,
+                           wbuf + u * EVENT_SET_NCOLS, es_id) < 0)
+            TEST_ERROR;
+    }
+
+    /* The writes are in the event set when they run in the background */
+    num_events = 0;
+    if (H5ESget_count(es_id, &num_events) < 0)
+        TEST_ERROR;
+    if (num_events != (is_ts ? EVENT_SET_NROWS : 0))
+        FAIL_PUTS_ERROR("wrong number of events in event set");
+
+    num_in_progress = 1;
+    op_failed       = true;
+    if (H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+        TEST_ERROR;
+    if (num_in_progress || op_failed)
+        FAIL_PUTS_ERROR("writes should have finished successfully");
+
+    /* Read the data back, asynchronously */
+    memset(rbuf, 0, EVENT_SET_NROWS * EVENT_SET_NCOLS * sizeof(int));
+    if (H5Dread_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf, es_id) < 0)
+        TEST_ERROR;
+    if (H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+        TEST_ERROR;
+    if (num_in_progress || op_failed)
+        FAIL_PUTS_ERROR("read should have finished successfully");
+    for (u = 0; u < EVENT_SET_NROWS * EVENT_SET_NCOLS; u++)
+        if (rbuf[u] != wbuf[u])
+            FAIL_PUTS_ERROR("wrong data read");
+
+    /* A synchronous read sees the data of the writes queued before it */
+    for (u = 0; u < EVENT_SET_NROWS * EVENT_SET_NCOLS; u++)
+        wbuf[u] = -(int)u;
+    if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf, es_id) < 0)
+        TEST_ERROR;
+    memset(rbuf, 0, EVENT_SET_NROWS * EVENT_SET_NCOLS * sizeof(int));
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    for (u = 0; u < EVENT_SET_NROWS * EVENT_SET_NCOLS; u++)
+        if (rbuf[u] != wbuf[u])
+            FAIL_PUTS_ERROR("synchronous read didn't see queued write");
+    if (H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+        TEST_ERROR;
+    if (num_in_progress || op_failed)
+        FAIL_PUTS_ERROR("write should have finished successfully");
+
+    /* An operation that fails in the background is reported by the event set */
+    row_dims[0] = EVENT_SET_NCOLS / 2;
+    if ((bad_mspace_id = H5Screate_simple(1, row_dims, NULL)) < 0)
+        TEST_ERROR;
+    start[0] = 0;
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dwrite_async(dset_id, H5T_NATIVE_INT, bad_mspace_id, fspace_id, H5P_DEFAULT, wbuf, es_id);
+    }
+    H5E_END_TRY
+    if (is_ts) {
+        if (ret < 0)
+            FAIL_PUTS_ERROR("write should have been queued");
+        H5E_BEGIN_TRY
+        {
+            ret = H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed);
+        }
+        H5E_END_TRY
+        if (ret < 0 || !op_failed)
+            FAIL_PUTS_ERROR("write should have failed");
+        num_errs = 0;
+        if (H5ESget_err_count(es_id, &num_errs) < 0)
+            TEST_ERROR;
+        if (num_errs != 1)
+            FAIL_PUTS_ERROR("wrong number of failed operations");
+        num_cleared = 0;
+        if (H5ESget_err_info(es_id, 1, &err_info, &num_cleared) < 0)
+            TEST_ERROR;
+        if (num_cleared != 1)
+            FAIL_PUTS_ERROR("failed operation not retrieved");
+        if (strcmp(err_info.api_name, "H5Dwrite_async") != 0)
+            FAIL_PUTS_ERROR("wrong API name for failed operation");
+        if (H5Eget_num(err_info.err_stack_id) <= 0)
+            FAIL_PUTS_ERROR("failed operation has no errors");
+        if (H5ESfree_err_info(1, &err_info) < 0)
+            TEST_ERROR;
+    }
+    else if (ret >= 0)
+        FAIL_PUTS_ERROR("write should have failed");
+
+    /* An event set with failed operations doesn't accept new ones */
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+    if ((es_id = H5EScreate()) < 0)
+        TEST_ERROR;
+
+    /* Invalid arguments are reported by the call itself */
+    offset[0] = EVENT_SET_NROWS;
+    if (H5Soffset_simple(fspace_id, offset) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dwrite_async(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, wbuf, es_id);
+    }
+    H5E_END_TRY
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("write with an invalid selection should have failed");
+    offset[0] = 0;
+    if (H5Soffset_simple(fspace_id, offset) < 0)
+        TEST_ERROR;
+    num_events = 1;
+    if (H5ESget_count(es_id, &num_events) < 0)
+        TEST_ERROR;
+    if (num_events != 0)
+        FAIL_PUTS_ERROR("write with an invalid selection shouldn't be in event set");
+
+#ifdef H5_HAVE_THREADSAFE_API
+    /* Operations canceled while they're queued are never run.  Holding the
+     * API lock keeps the background thread from starting any of them.
+     */
+    if (is_ts) {
+        size_t   num_not_canceled = 1;
+        unsigned lock_count       = 0;
+        bool     acquired         = false;
+
+        if (H5TSmutex_acquire(1, &acquired) < 0)
+            TEST_ERROR;
+        if (!acquired)
+            FAIL_PUTS_ERROR("couldn't acquire API lock");
+        for (u = 0; u < EVENT_SET_NROWS * EVENT_SET_NCOLS; u++)
+            wbuf[u] = (int)u * 5;
+        for (u = 0; u < EVENT_SET_NROWS; u++) {
+            start[0] = u;
+            if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                TEST_ERROR;
+            if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT,
+                               wbuf + u * EVENT_SET_NCOLS, es_id) < 0)
+                TEST_ERROR;
+        }
+        op_failed = true;
+        if (H5EScancel(es_id, &num_not_canceled, &op_failed) < 0)
+            TEST_ERROR;
+        if (H5TSmutex_release(&lock_count) < 0)
+            TEST_ERROR;
+        if (num_not_canceled || op_failed)
+            FAIL_PUTS_ERROR("queued writes should have been canceled");
+        num_events = 1;
+        if (H5ESget_count(es_id, &num_events) < 0)
+            TEST_ERROR;
+        if (num_events != 0)
+            FAIL_PUTS_ERROR("canceled writes shouldn't be in event set");
+
+        /* The synchronous read waits for the background thread to skip them */
+        memset(rbuf, 0, EVENT_SET_NROWS * EVENT_SET_NCOLS * sizeof(int));
+        if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR;
+        for (u = 0; u < EVENT_SET_NROWS * EVENT_SET_NCOLS; u++)
+            if (rbuf[u] != -(int)u)
+                FAIL_PUTS_ERROR("canceled write changed the data");
+    }
+#endif
+
+    /* Closing the dataset waits for its queued writes */
+    for (u = 0; u < EVENT_SET_NROWS * EVENT_SET_NCOLS; u++)
+        wbuf[u] = (int)u * 3;
+    for (u = 0; u < EVENT_SET_NROWS; u++) {
+        start[0] = u;
+        if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT,
+                           wbuf + u * EVENT_SET_NCOLS, es_id) < 0)
+            TEST_ERROR;
+    }
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = H5I_INVALID_HID;
+    if (H5ESwait(es_id, 0, &num_in_progress, &op_failed) < 0)
+        TEST_ERROR;
+    if (num_in_progress || op_failed)
+        FAIL_PUTS_ERROR("writes should have finished when the dataset was closed");
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+    es_id = H5I_INVALID_HID;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    /* Check the data with a synchronous read */
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dopen2(file_id, "dset", H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    memset(rbuf, 0, EVENT_SET_NROWS * EVENT_SET_NCOLS * sizeof(int));
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    for (u = 0; u < EVENT_SET_NROWS; u++)
+        for (v = 0; v < EVENT_SET_NCOLS; v++)
+            if (rbuf[u * EVENT_SET_NCOLS + v] != (int)(u * EVENT_SET_NCOLS + v) * 3)
+                FAIL_PUTS_ERROR("wrong data read after reopening file");
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(bad_mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+    free(wbuf);
+    free(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed);
+        H5ESclose(es_id);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5Sclose(bad_mspace_id);
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY
+    free(wbuf);
+    free(rbuf);
+    return 1;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -738,6 +1057,7 @@ main(void)
     nerrors += test_es_create();
     nerrors += test_es_none();
     nerrors += test_es_get_requests();
+    nerrors += test_es_native_async_io(fapl_id);
 
     /* Unregister dummy connectors */
     for (i = 0; i < EVENT_SET_NUM_CONNECTOR_IDS; i++)
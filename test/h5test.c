@@ -721,6 +721,13 @@ h5_get_vfd_fapl(hid_t fapl)
         if (H5Pset_fapl_direct(fapl, 1024, 4096, 8 * 4096) < 0)
             goto error;
     }
+#endif
+#ifdef H5_HAVE_IOURING_VFD
+    else if (!strcmp(tok, "io_uring")) {
+        /* Linux io_uring, with the default queue depth */
+        if (H5Pset_fapl_iouring(fapl, 0, 0) < 0)
+            goto error;
+    }
 #endif
     else if (!strcmp(tok, "splitter")) {
         H5FD_splitter_vfd_config_t *splitter_config;
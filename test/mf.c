@@ -9123,6 +9123,189 @@ error:
 
 } /* test_page_alignment() */
 
+/*
+ *-------------------------------------------------------------------------
+ * To verify that raw data allocations are aligned when
+ * H5Pset_raw_data_alignment() is used:
+ *
+ *  Raw data blocks allocated with H5MF_alloc() start on an aligned
+ *  address, whether they come from the small data aggregator or from
+ *  the end of the file, while metadata blocks are not padded.
+ *
+ *  The storage of contiguous datasets and of chunks is aligned.
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_mf_raw_align(const char *driver_name, hid_t fapl)
+{
+    hid_t       file      = H5I_INVALID_HID; /* File ID */
+    hid_t       fapl_new  = H5I_INVALID_HID; /* copy of fapl */
+    hid_t       fapl_out  = H5I_INVALID_HID; /* fapl from H5Fget_access_plist */
+    hid_t       dcpl      = H5I_INVALID_HID; /* dataset creation property list */
+    hid_t       sid       = H5I_INVALID_HID; /* dataspace ID */
+    hid_t       did       = H5I_INVALID_HID; /* dataset ID */
+    char        filename[FILENAME_LEN];      /* Filename to use */
+    H5F_t      *f = NULL;                    /* Internal file object pointer */
+    haddr_t     addr1, addr2, addr3, chunk_addr;
+    hsize_t     alignment = 0;
+    hsize_t     dims[1]   = {TBLOCK_SIZE5000};
+    hsize_t     cdims[1]  = {TBLOCK_SIZE1034};
+    hsize_t     nchunks   = 0, chunk_size = 0, i;
+    hsize_t     offset[1];
+    unsigned    filter_mask;
+    int        *wbuf = NULL;
+    bool        suitable_vfd;
+
+    TESTING("H5MF_alloc() of raw data with raw data alignment");
+
+    /* Skip test when using VFDs that have different address spaces for each
+     *  type of allocation.
+     */
+    suitable_vfd = (bool)(strcmp(driver_name, "split") != 0 && strcmp(driver_name, "multi") != 0);
+    if (suitable_vfd) {
+        /* Set the filename to use for this test */
+        h5_fixname(FILENAME[0], fapl, filename, sizeof(filename));
+
+        if ((fapl_new = H5Pcopy(fapl)) < 0)
+            TEST_ERROR;
+
+        /* An alignment of zero is rejected */
+        H5E_BEGIN_TRY
+        {
+            if (H5Pset_raw_data_alignment(fapl_new, (hsize_t)0) >= 0)
+                TEST_ERROR;
+        }
+        H5E_END_TRY
+
+        if (H5Pset_raw_data_alignment(fapl_new, (hsize_t)TEST_ALIGN4096) < 0)
+            TEST_ERROR;
+        if (H5Pget_raw_data_alignment(fapl_new, &alignment) < 0)
+            TEST_ERROR;
+        if (alignment != TEST_ALIGN4096)
+            TEST_ERROR;
+
+        /* Create the file to work on */
+        if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_new)) < 0)
+            FAIL_STACK_ERROR;
+
+        /* The setting is returned with the file's access property list */
+        alignment = 0;
+        if ((fapl_out = H5Fget_access_plist(file)) < 0)
+            FAIL_STACK_ERROR;
+        if (H5Pget_raw_data_alignment(fapl_out, &alignment) < 0)
+            TEST_ERROR;
+        if (alignment != TEST_ALIGN4096)
+            TEST_ERROR;
+        if (H5Pclose(fapl_out) < 0)
+            FAIL_STACK_ERROR;
+
+        /* Get a pointer to the internal file object */
+        if (NULL == (f = (H5F_t *)H5VL_object(file)))
+            FAIL_STACK_ERROR;
+
+        /* A small raw data block, from the small data aggregator */
+        if (HADDR_UNDEF == (addr1 = H5MF_alloc(f, H5FD_MEM_DRAW, (hsize_t)TBLOCK_SIZE30)))
+            FAIL_STACK_ERROR;
+        if ((addr1 + H5F_BASE_ADDR(f)) % TEST_ALIGN4096)
+            TEST_ERROR;
+
+        /* A metadata block in between */
+        if (HADDR_UNDEF == (addr2 = H5MF_alloc(f, H5FD_MEM_SUPER, (hsize_t)TBLOCK_SIZE50)))
+            FAIL_STACK_ERROR;
+
+        /* A raw data block larger than the small data aggregator's block */
+        if (HADDR_UNDEF == (addr3 = H5MF_alloc(f, H5FD_MEM_DRAW, (hsize_t)TBLOCK_SIZE5000)))
+            FAIL_STACK_ERROR;
+        if ((addr3 + H5F_BASE_ADDR(f)) % TEST_ALIGN4096)
+            TEST_ERROR;
+
+        /* The blocks don't overlap */
+        if (H5_addr_overlap(addr1, TBLOCK_SIZE30, addr2, TBLOCK_SIZE50) ||
+            H5_addr_overlap(addr1, TBLOCK_SIZE30, addr3, TBLOCK_SIZE5000) ||
+            H5_addr_overlap(addr2, TBLOCK_SIZE50, addr3, TBLOCK_SIZE5000))
+            TEST_ERROR;
+
+        if (H5MF_xfree(f, H5FD_MEM_DRAW, addr1, (hsize_t)TBLOCK_SIZE30) < 0)
+            FAIL_STACK_ERROR;
+        if (H5MF_xfree(f, H5FD_MEM_SUPER, addr2, (hsize_t)TBLOCK_SIZE50) < 0)
+            FAIL_STACK_ERROR;
+        if (H5MF_xfree(f, H5FD_MEM_DRAW, addr3, (hsize_t)TBLOCK_SIZE5000) < 0)
+            FAIL_STACK_ERROR;
+
+        /* Contiguous and chunked datasets */
+        if (NULL == (wbuf = (int *)calloc(TBLOCK_SIZE5000, sizeof(int))))
+            TEST_ERROR;
+        if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+            FAIL_STACK_ERROR;
+        if ((did = H5Dcreate2(file, "contig", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+            0)
+            FAIL_STACK_ERROR;
+        if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR;
+        if (HADDR_UNDEF == (addr1 = H5Dget_offset(did)))
+            FAIL_STACK_ERROR;
+        if ((addr1 + H5F_BASE_ADDR(f)) % TEST_ALIGN4096)
+            TEST_ERROR;
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR;
+
+        if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            FAIL_STACK_ERROR;
+        if (H5Pset_chunk(dcpl, 1, cdims) < 0)
+            FAIL_STACK_ERROR;
+        if ((did = H5Dcreate2(file, "chunked", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR;
+        if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR;
+        if (H5Dget_num_chunks(did, H5S_ALL, &nchunks) < 0)
+            FAIL_STACK_ERROR;
+        if (nchunks != (TBLOCK_SIZE5000 + TBLOCK_SIZE1034 - 1) / TBLOCK_SIZE1034)
+            TEST_ERROR;
+        for (i = 0; i < nchunks; i++) {
+            if (H5Dget_chunk_info(did, H5S_ALL, i, offset, &filter_mask, &chunk_addr, &chunk_size) < 0)
+                FAIL_STACK_ERROR;
+            if ((chunk_addr + H5F_BASE_ADDR(f)) % TEST_ALIGN4096)
+                TEST_ERROR;
+        }
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR;
+
+        if (H5Pclose(dcpl) < 0)
+            FAIL_STACK_ERROR;
+        if (H5Sclose(sid) < 0)
+            FAIL_STACK_ERROR;
+        if (H5Fclose(file) < 0)
+            FAIL_STACK_ERROR;
+        if (H5Pclose(fapl_new) < 0)
+            FAIL_STACK_ERROR;
+
+        free(wbuf);
+        wbuf = NULL;
+
+        PASSED();
+    }
+    else {
+        SKIPPED();
+        puts("    Current VFD doesn't support raw data alignment");
+    }
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Pclose(fapl_out);
+        H5Pclose(fapl_new);
+        H5Fclose(file);
+    }
+    H5E_END_TRY
+    free(wbuf);
+    return 1;
+} /* test_mf_raw_align() */
+
 int
 main(void)
 {
@@ -9253,6 +9436,9 @@ main(void)
     nerrors += test_page_alloc_xfree(driver_name, fapl); /* can handle multi/split */
     nerrors += test_page_alignment(driver_name, fapl);   /* can handle multi/split */
 
+    /* Alignment of raw data only */
+    nerrors += test_mf_raw_align(driver_name, fapl);
+
     /* tests for specific bugs */
     nerrors += test_mf_bug1(driver_name, fapl);
 
@@ -308,6 +308,182 @@ error:
     return FAIL;
 } /* test_ohdr_cache() */
 
+/*
+ *  Verify that object headers are read correctly when their size is learned
+ *  and their chunks are read together:
+ *    Create a group whose first object header chunk is larger than the
+ *        default speculative read size
+ *    Create groups whose object headers have many continuation chunks, by
+ *        adding attributes to them in turn
+ *    Re-open the file read-only with object header vector reads enabled,
+ *        verify the speculative read size grows to cover the large group's
+ *        header, and verify the attributes read back
+ */
+#define OHDR_VECTOR_READ_NGROUPS 2
+#define OHDR_VECTOR_READ_NATTRS  32
+static herr_t
+test_ohdr_vector_read(char *filename, hid_t fapl)
+{
+    hid_t             file  = H5I_INVALID_HID;
+    hid_t             fapl2 = H5I_INVALID_HID;
+    hid_t             gcpl  = H5I_INVALID_HID;
+    hid_t             sid   = H5I_INVALID_HID;
+    hid_t             gid   = H5I_INVALID_HID;
+    hid_t             aid   = H5I_INVALID_HID;
+    hid_t             gids[OHDR_VECTOR_READ_NGROUPS];
+    H5F_t            *f = NULL;
+    H5O_info2_t       oinfo;
+    H5O_native_info_t ninfo;
+    char              name[32];
+    hbool_t           enable;
+    int               val;
+    int               g, u;
+
+    TESTING("object header speculative reads and chunk vector reads");
+
+    for (g = 0; g < OHDR_VECTOR_READ_NGROUPS; g++)
+        gids[g] = H5I_INVALID_HID;
+
+    /* Check the property's default and setting */
+    if ((fapl2 = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pget_ohdr_vector_read(fapl2, &enable) < 0)
+        FAIL_STACK_ERROR;
+    if (enable)
+        TEST_ERROR;
+    if (H5Pset_ohdr_vector_read(fapl2, true) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pget_ohdr_vector_read(fapl2, &enable) < 0)
+        FAIL_STACK_ERROR;
+    if (!enable)
+        TEST_ERROR;
+
+    /* Create the file to operate on */
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if ((sid = H5Screate(H5S_SCALAR)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Create a group with room for many compact links in its first chunk */
+    if ((gcpl = H5Pcreate(H5P_GROUP_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_link_creation_order(gcpl, H5P_CRT_ORDER_TRACKED) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_link_phase_change(gcpl, 256, 200) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_est_link_info(gcpl, 256, 16) < 0)
+        FAIL_STACK_ERROR;
+    if ((gid = H5Gcreate2(file, "big", H5P_DEFAULT, gcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Gclose(gid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(gcpl) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Create groups with compact attributes added in turn, so that their
+     *  object headers are extended with continuation chunks
+     */
+    if ((gcpl = H5Pcreate(H5P_GROUP_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_attr_phase_change(gcpl, OHDR_VECTOR_READ_NATTRS * 2, OHDR_VECTOR_READ_NATTRS) < 0)
+        FAIL_STACK_ERROR;
+    for (g = 0; g < OHDR_VECTOR_READ_NGROUPS; g++) {
+        snprintf(name, sizeof(name), "group %d", g);
+        if ((gids[g] = H5Gcreate2(file, name, H5P_DEFAULT, gcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR;
+    } /* end for */
+    for (u = 0; u < OHDR_VECTOR_READ_NATTRS; u++) {
+        snprintf(name, sizeof(name), "attribute %d", u);
+        for (g = 0; g < OHDR_VECTOR_READ_NGROUPS; g++) {
+            val = (g * OHDR_VECTOR_READ_NATTRS) + u;
+            if ((aid = H5Acreate2(gids[g], name, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR;
+            if (H5Awrite(aid, H5T_NATIVE_INT, &val) < 0)
+                FAIL_STACK_ERROR;
+            if (H5Aclose(aid) < 0)
+                FAIL_STACK_ERROR;
+        } /* end for */
+    }     /* end for */
+    for (g = 0; g < OHDR_VECTOR_READ_NGROUPS; g++) {
+        if (H5Gclose(gids[g]) < 0)
+            FAIL_STACK_ERROR;
+        gids[g] = H5I_INVALID_HID;
+    } /* end for */
+    if (H5Pclose(gcpl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Fclose(file) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Re-open the file read-only, reading object header chunks together */
+    if ((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl2)) < 0)
+        FAIL_STACK_ERROR;
+    if (NULL == (f = (H5F_t *)H5VL_object(file)))
+        FAIL_STACK_ERROR;
+
+    /* Verify the speculative read size grows to cover the large header */
+    if (H5Oget_native_info_by_name(file, "big", &ninfo, H5O_NATIVE_INFO_HDR, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR;
+    if (ninfo.hdr.space.total <= H5O_SPEC_READ_SIZE)
+        TEST_ERROR;
+    if (!H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI) && H5F_OHDR_SPEC_READ(f)->size < ninfo.hdr.space.total)
+        TEST_ERROR;
+
+    /* Verify the attributes of the groups */
+    for (g = 0; g < OHDR_VECTOR_READ_NGROUPS; g++) {
+        snprintf(name, sizeof(name), "group %d", g);
+        if ((gid = H5Gopen2(file, name, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR;
+        if (H5Oget_native_info(gid, &ninfo, H5O_NATIVE_INFO_HDR) < 0)
+            FAIL_STACK_ERROR;
+        if (ninfo.hdr.nchunks < 3)
+            TEST_ERROR;
+        if (H5Oget_info3(gid, &oinfo, H5O_INFO_NUM_ATTRS) < 0)
+            FAIL_STACK_ERROR;
+        if (oinfo.num_attrs != OHDR_VECTOR_READ_NATTRS)
+            TEST_ERROR;
+        for (u = 0; u < OHDR_VECTOR_READ_NATTRS; u++) {
+            snprintf(name, sizeof(name), "attribute %d", u);
+            if ((aid = H5Aopen(gid, name, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR;
+            if (H5Aread(aid, H5T_NATIVE_INT, &val) < 0)
+                FAIL_STACK_ERROR;
+            if (val != (g * OHDR_VECTOR_READ_NATTRS) + u)
+                TEST_ERROR;
+            if (H5Aclose(aid) < 0)
+                FAIL_STACK_ERROR;
+        } /* end for */
+        if (H5Gclose(gid) < 0)
+            FAIL_STACK_ERROR;
+    } /* end for */
+
+    if (H5Fclose(file) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(fapl2) < 0)
+        FAIL_STACK_ERROR;
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (g = 0; g < OHDR_VECTOR_READ_NGROUPS; g++)
+            H5Gclose(gids[g]);
+        H5Aclose(aid);
+        H5Gclose(gid);
+        H5Pclose(gcpl);
+        H5Sclose(sid);
+        H5Pclose(fapl2);
+        H5Fclose(file);
+    }
+    H5E_END_TRY
+
+    return FAIL;
+} /* test_ohdr_vector_read() */
+
 /*
  *  To exercise the coding for the re-read of the object header for SWMR access.
  *  When the object header is read in H5O_load() of H5Ocache.c, the library initially reads
@@ -2106,6 +2282,10 @@ main(void)
             if (test_ohdr_cache(filename, fapl) < 0)
                 TEST_ERROR;
 
+            /* Test object header speculative and chunk vector reads */
+            if (test_ohdr_vector_read(filename, fapl) < 0)
+                TEST_ERROR;
+
             if (test_minimized_dset_ohdr_attribute_addition(fapl) < 0)
                 TEST_ERROR;
 
@@ -35,6 +35,9 @@
 #define H5F_TESTING
 #include "H5Fpkg.h"
 
+#define H5PB_FRIEND /*suppress error about including H5PBpkg	  */
+#include "H5PBpkg.h"
+
 #define FILENAME_LEN 1024
 
 /* test routines */
@@ -47,10 +50,12 @@ static unsigned test_raw_data_handling(hid_t orig_fapl, const char *driver_name)
 static unsigned test_lru_processing(hid_t orig_fapl, const char *driver_name);
 static unsigned test_min_threshold(hid_t orig_fapl, const char *driver_name);
 static unsigned test_stats_collection(hid_t orig_fapl, const char *driver_name);
+static unsigned test_read_ahead_write_back(hid_t orig_fapl, const char *driver_name);
 
 /* helper routines */
-static unsigned create_file(char *filename, hid_t fcpl, hid_t fapl);
-static unsigned open_file(char *filename, hid_t fapl, hsize_t page_size, size_t page_buffer_size);
+static unsigned      create_file(char *filename, hid_t fcpl, hid_t fapl);
+static unsigned      open_file(char *filename, hid_t fapl, hsize_t page_size, size_t page_buffer_size);
+static H5PB_entry_t *search_page_buf(const H5F_t *f, haddr_t addr);
 
 static const char *FILENAME[] = {"filepaged", NULL};
 
@@ -284,6 +289,26 @@ error:
     return 1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    search_page_buf()
+ *
+ * Purpose:     Look up the page at ADDR in the page buffer of F.
+ *
+ * Return:      Pointer to the page entry if the page is in the page
+ *              buffer, NULL otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5PB_entry_t *
+search_page_buf(const H5F_t *f, haddr_t addr)
+{
+    H5PB_entry_t *page_entry = NULL;
+
+    H5PB__SEARCH_INDEX(f->shared->page_buf, addr, page_entry);
+
+    return page_entry;
+}
+
 /*
  *
  *  set_multi_split():
@@ -582,7 +607,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *driver_name)
      * Get the number of pages inserted, and verify that it is the
      * the expected value.
      */
-    base_page_cnt = H5SL_count(f->shared->page_buf->slist_ptr);
+    base_page_cnt = f->shared->page_buf->index_len;
     if (base_page_cnt != 1)
         TEST_ERROR;
 
@@ -608,7 +633,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *driver_name)
 
     page_count++;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* update elements 300 - 450, with values 300 -  - this will
@@ -618,7 +643,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *driver_name)
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 300), sizeof(int) * 150, data) < 0)
         FAIL_STACK_ERROR;
     page_count += 2;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* update elements 100 - 300, this will go to disk but also update
@@ -627,7 +652,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *driver_name)
         data[i] = i + 100;
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 100), sizeof(int) * 200, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* Update elements 225-300 - this will update an existing page in the PB */
@@ -636,7 +661,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *driver_name)
         data[i] = i + 450;
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 450), sizeof(int) * 150, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* Do a full page write to block 600-800 - should bypass the PB */
@@ -644,7 +669,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *driver_name)
         data[i] = i + 600;
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 600), sizeof(int) * 200, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* read elements 800 - 1200, this should not affect the PB, and should read -1s */
@@ -656,7 +681,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *driver_name)
             FAIL_STACK_ERROR;
         }
     }
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* read elements 1200 - 1201, this should read -1 and bring in an
@@ -671,7 +696,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *driver_name)
         }
     }
     page_count++;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     /* read elements 175 - 225, this should use the PB existing pages */
@@ -685,7 +710,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *driver_name)
             TEST_ERROR;
         }
     }
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     /* read elements 0 - 800 using the VFD.. this should result in -1s
@@ -714,7 +739,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *driver_name)
      */
     if (H5F_block_read(f, H5FD_MEM_DRAW, addr, sizeof(int) * 800, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         TEST_ERROR;
     for (i = 0; i < 800; i++) {
         if (data[i] != i) {
@@ -732,7 +757,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *driver_name)
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 400), sizeof(int) * 1000, data) < 0)
         FAIL_STACK_ERROR;
     page_count -= 2;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     /* read elements 0 - 1000.. this should go to disk then update the
@@ -756,7 +781,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *driver_name)
         }
         i++;
     }
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     if (H5Fclose(file_id) < 0)
@@ -851,7 +876,7 @@ test_lru_processing(hid_t orig_fapl, const char *driver_name)
      * Get the number of pages inserted, and verify that it is the
      * the expected value.
      */
-    base_page_cnt = H5SL_count(f->shared->page_buf->slist_ptr);
+    base_page_cnt = f->shared->page_buf->index_len;
     if (base_page_cnt != 1)
         TEST_ERROR;
 
@@ -878,7 +903,7 @@ test_lru_processing(hid_t orig_fapl, const char *driver_name)
 
     page_count++;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     /* update elements 300 - 450, with values 300 - 449 - this will
@@ -895,20 +920,20 @@ test_lru_processing(hid_t orig_fapl, const char *driver_name)
     /* at this point, the page buffer entry created at file open should
      * have been evicted -- thus no further need to consider base_page_cnt.
      */
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     /* The two pages should be the ones with address 100 and 200; 0
        should have been evicted */
     /* Changes: 200, 400 */
     search_addr = addr;
-    if (NULL != H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (NULL != search_page_buf(f, search_addr))
         FAIL_STACK_ERROR;
     search_addr = addr + sizeof(int) * 200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (NULL == search_page_buf(f, search_addr))
         FAIL_STACK_ERROR;
     search_addr = addr + sizeof(int) * 400;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (NULL == search_page_buf(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* update elements 150-151, this will update existing pages in the
@@ -918,7 +943,7 @@ test_lru_processing(hid_t orig_fapl, const char *driver_name)
         data[i] = i + 300;
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 300), sizeof(int) * 1, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     /* read elements 600 - 601, this should read -1 and bring in an
@@ -932,22 +957,22 @@ test_lru_processing(hid_t orig_fapl, const char *driver_name)
             TEST_ERROR;
         } /* end if */
     }     /* end for */
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     /* Changes: 400 */
     search_addr = addr + sizeof(int) * 400;
-    if (NULL != H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (NULL != search_page_buf(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* Changes: 200 */
     search_addr = addr + sizeof(int) * 200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (NULL == search_page_buf(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* Changes: 1200 */
     search_addr = addr + sizeof(int) * 1200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (NULL == search_page_buf(f, search_addr))
         FAIL_STACK_ERROR;
     /* read elements 175 - 225, this should move 100 to the top, evict 600 and bring in 200 */
     /* Changes: 350 - 450; 200, 1200, 400 */
@@ -959,22 +984,22 @@ test_lru_processing(hid_t orig_fapl, const char *driver_name)
             TEST_ERROR;
         } /* end if */
     }     /* end for */
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     /* Changes: 1200 */
     search_addr = addr + sizeof(int) * 1200;
-    if (NULL != H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (NULL != search_page_buf(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* Changes: 200 */
     search_addr = addr + sizeof(int) * 200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (NULL == search_page_buf(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* Changes: 400 */
     search_addr = addr + sizeof(int) * 400;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (NULL == search_page_buf(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* update elements 200 - 700 to value 0, this will go to disk but
@@ -985,17 +1010,17 @@ test_lru_processing(hid_t orig_fapl, const char *driver_name)
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 400), sizeof(int) * 1000, data) < 0)
         FAIL_STACK_ERROR;
     page_count -= 1;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     /* Changes: 200 */
     search_addr = addr + sizeof(int) * 200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (NULL == search_page_buf(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* Changes: 400 */
     search_addr = addr + sizeof(int) * 400;
-    if (NULL != H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (NULL != search_page_buf(f, search_addr))
         FAIL_STACK_ERROR;
 
     if (H5Fclose(file_id) < 0)
@@ -1146,7 +1171,7 @@ test_min_threshold(hid_t orig_fapl, const char *driver_name)
 
     page_count += 5;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->raw_count != 5 - base_meta_cnt)
@@ -1168,7 +1193,7 @@ test_min_threshold(hid_t orig_fapl, const char *driver_name)
     if (H5F_block_read(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 800), sizeof(int) * 50, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->meta_count != 5)
@@ -1196,7 +1221,7 @@ test_min_threshold(hid_t orig_fapl, const char *driver_name)
     if (H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 900), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->meta_count != 5)
@@ -1277,7 +1302,7 @@ test_min_threshold(hid_t orig_fapl, const char *driver_name)
 
     page_count += 5;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
     if (page_buf->meta_count != 5 - base_raw_cnt)
         TEST_ERROR;
@@ -1298,7 +1323,7 @@ test_min_threshold(hid_t orig_fapl, const char *driver_name)
     if (H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 800), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->raw_count != 5)
@@ -1326,7 +1351,7 @@ test_min_threshold(hid_t orig_fapl, const char *driver_name)
     if (H5F_block_read(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 900), sizeof(int) * 50, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->raw_count != 5)
@@ -1411,7 +1436,7 @@ test_min_threshold(hid_t orig_fapl, const char *driver_name)
 
     page_count += 5;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         TEST_ERROR;
 
     if (f->shared->page_buf->raw_count != 5 - base_meta_cnt)
@@ -1427,7 +1452,7 @@ test_min_threshold(hid_t orig_fapl, const char *driver_name)
     if (H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 400), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 3)
@@ -1538,7 +1563,7 @@ test_min_threshold(hid_t orig_fapl, const char *driver_name)
 
     page_count += 5;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     /* add 2 meta entries evicting 2 raw entries */
@@ -1548,7 +1573,7 @@ test_min_threshold(hid_t orig_fapl, const char *driver_name)
     if (H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 200), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 2)
@@ -1571,7 +1596,7 @@ test_min_threshold(hid_t orig_fapl, const char *driver_name)
     if (H5F_block_write(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 100), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 1)
@@ -1586,7 +1611,7 @@ test_min_threshold(hid_t orig_fapl, const char *driver_name)
     if (H5F_block_write(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 300), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 1)
@@ -1601,7 +1626,7 @@ test_min_threshold(hid_t orig_fapl, const char *driver_name)
     if (H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 500), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 1)
@@ -2035,6 +2060,201 @@ error:
     return 1;
 } /* test_stats_collection */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_read_ahead_write_back()
+ *
+ * Purpose:     Check that dirty pages evicted from, or flushed out of,
+ *              the page buffer in batches reach the file intact, and
+ *              that sequential metadata page misses read the following
+ *              pages ahead.
+ *
+ *              A file is created with eight pages of metadata and eight
+ *              pages of raw data written half a page at a time through a
+ *              ten page buffer, so that dirty pages are written back both
+ *              on eviction and when the file is closed.  The file is then
+ *              reopened with read-ahead enabled and the metadata is read
+ *              back half a page at a time, in order.
+ *
+ * Return:      0 if test is successful
+ *              1 if test fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_read_ahead_write_back(hid_t orig_fapl, const char *driver_name)
+{
+    char     filename[FILENAME_LEN];    /* Filename to use */
+    hid_t    file_id = H5I_INVALID_HID; /* File ID */
+    hid_t    fcpl    = H5I_INVALID_HID;
+    hid_t    fapl    = H5I_INVALID_HID;
+    hid_t    fapl2   = H5I_INVALID_HID;
+    unsigned read_ahead;
+    int      i, j;
+    int      num_pages = 8;
+    haddr_t  meta_addr = HADDR_UNDEF;
+    haddr_t  raw_addr  = HADDR_UNDEF;
+    int     *data      = NULL;
+    H5F_t   *f         = NULL;
+
+    TESTING("Page buffer read-ahead and write-back");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+
+    if ((fapl = H5Pcopy(orig_fapl)) < 0)
+        TEST_ERROR;
+
+    if (set_multi_split(driver_name, fapl, sizeof(int) * 200) != 0)
+        TEST_ERROR;
+
+    if ((data = (int *)calloc(200, sizeof(int))) == NULL)
+        TEST_ERROR;
+
+    if ((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        TEST_ERROR;
+
+    if (H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 0, (hsize_t)1) < 0)
+        TEST_ERROR;
+
+    if (H5Pset_file_space_page_size(fcpl, sizeof(int) * 200) < 0)
+        TEST_ERROR;
+
+    /* keep 10 pages at max in the page buffer */
+    if (H5Pset_page_buffer_size(fapl, sizeof(int) * 2000, 0, 0) < 0)
+        TEST_ERROR;
+
+    /* Check the read-ahead property */
+    if (H5Pget_page_buffer_read_ahead(fapl, &read_ahead) < 0)
+        FAIL_STACK_ERROR;
+    if (read_ahead != 0)
+        TEST_ERROR;
+    if (H5Pset_page_buffer_read_ahead(fapl, 4) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pget_page_buffer_read_ahead(fapl, &read_ahead) < 0)
+        FAIL_STACK_ERROR;
+    if (read_ahead != 4)
+        TEST_ERROR;
+
+    if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* The setting should be reported by the file's access property list */
+    if ((fapl2 = H5Fget_access_plist(file_id)) < 0)
+        FAIL_STACK_ERROR;
+    read_ahead = 0;
+    if (H5Pget_page_buffer_read_ahead(fapl2, &read_ahead) < 0)
+        FAIL_STACK_ERROR;
+    if (read_ahead != 4)
+        TEST_ERROR;
+    if (H5Pclose(fapl2) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Get a pointer to the internal file object */
+    if (NULL == (f = (H5F_t *)H5VL_object(file_id)))
+        FAIL_STACK_ERROR;
+
+    if (HADDR_UNDEF == (meta_addr = H5MF_alloc(f, H5FD_MEM_SUPER, sizeof(int) * 200 * (size_t)num_pages)))
+        FAIL_STACK_ERROR;
+    if (HADDR_UNDEF == (raw_addr = H5MF_alloc(f, H5FD_MEM_DRAW, sizeof(int) * 200 * (size_t)num_pages)))
+        FAIL_STACK_ERROR;
+
+    if (H5Freset_page_buffering_stats(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Fill the metadata and raw data pages half a page at a time, which
+     * forces dirty pages out of the page buffer.
+     */
+    for (i = 0; i < num_pages * 2; i++) {
+        for (j = 0; j < 100; j++)
+            data[j] = i * 100 + j;
+        if (H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + sizeof(int) * 100 * (size_t)i, sizeof(int) * 100,
+                            data) < 0)
+            FAIL_STACK_ERROR;
+
+        for (j = 0; j < 100; j++)
+            data[j] = -(i * 100 + j);
+        if (H5F_block_write(f, H5FD_MEM_DRAW, raw_addr + sizeof(int) * 100 * (size_t)i, sizeof(int) * 100,
+                            data) < 0)
+            FAIL_STACK_ERROR;
+    } /* end for */
+
+    if (f->shared->page_buf->index_len != f->shared->page_buf->LRU_list_len)
+        TEST_ERROR;
+    if (f->shared->page_buf->index_len * f->shared->page_buf->page_size != f->shared->page_buf->max_size)
+        TEST_ERROR;
+    if (f->shared->page_buf->evictions[0] + f->shared->page_buf->evictions[1] == 0)
+        TEST_ERROR;
+
+    /* Remaining dirty pages are written back when the file is closed */
+    if (H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR;
+
+    if (NULL == (f = (H5F_t *)H5VL_object(file_id)))
+        FAIL_STACK_ERROR;
+
+    if (H5Freset_page_buffering_stats(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Scan the metadata in order */
+    for (i = 0; i < num_pages * 2; i++) {
+        if (H5F_block_read(f, H5FD_MEM_SUPER, meta_addr + sizeof(int) * 100 * (size_t)i, sizeof(int) * 100,
+                           data) < 0)
+            FAIL_STACK_ERROR;
+        for (j = 0; j < 100; j++)
+            if (data[j] != i * 100 + j) {
+                fprintf(stderr, "Read different values than written\n");
+                TEST_ERROR;
+            } /* end if */
+    }         /* end for */
+
+    /* Each page is missed at most once, and the pages read ahead are hits */
+    if (f->shared->page_buf->accesses[0] != (unsigned)num_pages * 2)
+        TEST_ERROR;
+    if (f->shared->page_buf->hits[0] + f->shared->page_buf->misses[0] != (unsigned)num_pages * 2)
+        TEST_ERROR;
+    if (f->shared->page_buf->misses[0] > 3)
+        TEST_ERROR;
+
+    /* Check the raw data too */
+    for (i = 0; i < num_pages * 2; i++) {
+        if (H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + sizeof(int) * 100 * (size_t)i, sizeof(int) * 100,
+                           data) < 0)
+            FAIL_STACK_ERROR;
+        for (j = 0; j < 100; j++)
+            if (data[j] != -(i * 100 + j)) {
+                fprintf(stderr, "Read different values than written\n");
+                TEST_ERROR;
+            } /* end if */
+    }         /* end for */
+
+    if (H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(fcpl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+    free(data);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl2);
+        H5Pclose(fapl);
+        H5Pclose(fcpl);
+        H5Fclose(file_id);
+        if (data)
+            free(data);
+    }
+    H5E_END_TRY
+
+    return 1;
+} /* test_read_ahead_write_back */
+
 /*-------------------------------------------------------------------------
  * Function:    main()
  *
@@ -2085,6 +2305,7 @@ main(void)
     nerrors += test_lru_processing(fapl, driver_name);
     nerrors += test_min_threshold(fapl, driver_name);
     nerrors += test_stats_collection(fapl, driver_name);
+    nerrors += test_read_ahead_write_back(fapl, driver_name);
     nerrors += test_pb_fapl_tolerance_at_open();
 
     h5_delete_all_test_files(FILENAME, fapl);
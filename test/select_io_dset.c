@@ -104,6 +104,17 @@ typedef enum {
 #define TEST_TCONV_BUF_TOO_SMALL               0x100
 #define TEST_IN_PLACE_TCONV                    0x200
 
+/* Actual selection I/O mode reported when contiguous dataset I/O reaches the
+ * file driver: vector I/O if the driver under test has vector I/O callbacks,
+ * scalar I/O otherwise.  Set in main(). */
+static uint32_t vfd_sel_io_mode_g = H5D_SCALAR_IO;
+
+/* Expected actual selection I/O mode for the test cases: no I/O when the
+ * chunks stay in the chunk cache, scalar I/O for chunks written through the
+ * chunk cache code path, otherwise whatever the file driver supports */
+#define EXPECTED_SEL_IO_MODE(chunked, set_cache)                                                             \
+    ((chunked) ? ((set_cache) ? H5D_SCALAR_IO : 0) : vfd_sel_io_mode_g)
+
 static herr_t
 check_actual_selection_io_mode(hid_t dxpl, uint32_t sel_io_mode_expected)
 {
@@ -198,7 +209,7 @@ test_no_type_conv(hid_t fid, unsigned set_cache, unsigned chunked, unsigned dtra
         TEST_ERROR;
 
     /* Verify selection I/O mode */
-    if (check_actual_selection_io_mode(dxpl, chunked && !set_cache ? 0 : H5D_SCALAR_IO) < 0)
+    if (check_actual_selection_io_mode(dxpl, EXPECTED_SEL_IO_MODE(chunked, set_cache)) < 0)
         TEST_ERROR;
 
     /* Restore wbuf from backup if the library modified it */
@@ -210,7 +221,7 @@ test_no_type_conv(hid_t fid, unsigned set_cache, unsigned chunked, unsigned dtra
         TEST_ERROR;
 
     /* Verify selection I/O mode */
-    if (check_actual_selection_io_mode(dxpl, chunked && !set_cache ? 0 : H5D_SCALAR_IO) < 0)
+    if (check_actual_selection_io_mode(dxpl, EXPECTED_SEL_IO_MODE(chunked, set_cache)) < 0)
         TEST_ERROR;
 
     /* Verify data or transformed data read */
@@ -351,7 +362,7 @@ test_no_size_change_no_bkg(hid_t fid, unsigned set_cache, unsigned chunked, unsi
         TEST_ERROR;
 
     /* Verify selection I/O mode */
-    if (check_actual_selection_io_mode(dxpl, chunked && !set_cache ? 0 : H5D_SCALAR_IO) < 0)
+    if (check_actual_selection_io_mode(dxpl, EXPECTED_SEL_IO_MODE(chunked, set_cache)) < 0)
         TEST_ERROR;
 
     /* Restore wbuf from backup if the library modified it */
@@ -363,7 +374,7 @@ test_no_size_change_no_bkg(hid_t fid, unsigned set_cache, unsigned chunked, unsi
         TEST_ERROR;
 
     /* Verify selection I/O mode */
-    if (check_actual_selection_io_mode(dxpl, chunked && !set_cache ? 0 : H5D_SCALAR_IO) < 0)
+    if (check_actual_selection_io_mode(dxpl, EXPECTED_SEL_IO_MODE(chunked, set_cache)) < 0)
         TEST_ERROR;
 
     /* Verify data read little endian */
@@ -509,7 +520,7 @@ test_larger_mem_type_no_bkg(hid_t fid, unsigned set_cache, unsigned chunked, uns
         TEST_ERROR;
 
     /* Verify selection I/O mode */
-    if (check_actual_selection_io_mode(dxpl, chunked && !set_cache ? 0 : H5D_SCALAR_IO) < 0)
+    if (check_actual_selection_io_mode(dxpl, EXPECTED_SEL_IO_MODE(chunked, set_cache)) < 0)
         TEST_ERROR;
 
     /* Restore wbuf from backup if the library modified it */
@@ -521,7 +532,7 @@ test_larger_mem_type_no_bkg(hid_t fid, unsigned set_cache, unsigned chunked, uns
         TEST_ERROR;
 
     /* Verify selection I/O mode */
-    if (check_actual_selection_io_mode(dxpl, chunked && !set_cache ? 0 : H5D_SCALAR_IO) < 0)
+    if (check_actual_selection_io_mode(dxpl, EXPECTED_SEL_IO_MODE(chunked, set_cache)) < 0)
         TEST_ERROR;
 
     /* Verify data or transformed data read */
@@ -660,7 +671,7 @@ test_smaller_mem_type_no_bkg(hid_t fid, unsigned set_cache, unsigned chunked, un
         TEST_ERROR;
 
     /* Verify selection I/O mode */
-    if (check_actual_selection_io_mode(dxpl, chunked && !set_cache ? 0 : H5D_SCALAR_IO) < 0)
+    if (check_actual_selection_io_mode(dxpl, EXPECTED_SEL_IO_MODE(chunked, set_cache)) < 0)
         TEST_ERROR;
 
     /* Restore wbuf from backup if the library modified it */
@@ -672,7 +683,7 @@ test_smaller_mem_type_no_bkg(hid_t fid, unsigned set_cache, unsigned chunked, un
         TEST_ERROR;
 
     /* Verify selection I/O mode */
-    if (check_actual_selection_io_mode(dxpl, chunked && !set_cache ? 0 : H5D_SCALAR_IO) < 0)
+    if (check_actual_selection_io_mode(dxpl, EXPECTED_SEL_IO_MODE(chunked, set_cache)) < 0)
         TEST_ERROR;
 
     /* Verify data or transformed data read */
@@ -1225,7 +1236,7 @@ test_multi_dsets_no_bkg(hid_t fid, unsigned set_cache, unsigned chunked, unsigne
         TEST_ERROR;
 
     /* Verify selection I/O mode */
-    if (check_actual_selection_io_mode(dxpl, chunked && !set_cache ? 0 : H5D_SCALAR_IO) < 0)
+    if (check_actual_selection_io_mode(dxpl, EXPECTED_SEL_IO_MODE(chunked, set_cache)) < 0)
         TEST_ERROR;
 
     /* Restore wbuf from backup if the library modified it */
@@ -1237,7 +1248,7 @@ test_multi_dsets_no_bkg(hid_t fid, unsigned set_cache, unsigned chunked, unsigne
         TEST_ERROR;
 
     /* Verify selection I/O mode */
-    if (check_actual_selection_io_mode(dxpl, chunked && !set_cache ? 0 : H5D_SCALAR_IO) < 0)
+    if (check_actual_selection_io_mode(dxpl, EXPECTED_SEL_IO_MODE(chunked, set_cache)) < 0)
         TEST_ERROR;
 
     /* Verify */
@@ -1257,7 +1268,7 @@ test_multi_dsets_no_bkg(hid_t fid, unsigned set_cache, unsigned chunked, unsigne
             TEST_ERROR;
 
         /* Verify selection I/O mode */
-        if (check_actual_selection_io_mode(dxpl, chunked && !set_cache ? 0 : H5D_SCALAR_IO) < 0)
+        if (check_actual_selection_io_mode(dxpl, EXPECTED_SEL_IO_MODE(chunked, set_cache)) < 0)
             TEST_ERROR;
 
         /* Verify */
@@ -3021,15 +3032,17 @@ test_no_selection_io_cause_mode(const char *filename, hid_t fapl, uint32_t test_
             if (test_mode & TEST_IN_PLACE_TCONV) {
                 if (H5Pset_modify_write_buf(dxpl, true) < 0)
                     TEST_ERROR;
-                no_selection_io_cause_write_expected |= H5D_SEL_IO_NO_VECTOR_OR_SELECTION_IO_CB;
+                if (vfd_sel_io_mode_g == H5D_SCALAR_IO)
+                    no_selection_io_cause_write_expected |= H5D_SEL_IO_NO_VECTOR_OR_SELECTION_IO_CB;
             }
             else
                 no_selection_io_cause_write_expected |= H5D_SEL_IO_TCONV_BUF_TOO_SMALL;
 
             /* In-place type conversion for read doesn't require modify_write_buf */
-            no_selection_io_cause_read_expected |= H5D_SEL_IO_NO_VECTOR_OR_SELECTION_IO_CB;
+            if (vfd_sel_io_mode_g == H5D_SCALAR_IO)
+                no_selection_io_cause_read_expected |= H5D_SEL_IO_NO_VECTOR_OR_SELECTION_IO_CB;
         }
-        else {
+        else if (vfd_sel_io_mode_g == H5D_SCALAR_IO) {
             /* sel io will succeed and only switch to scalar at the VFL */
             no_selection_io_cause_write_expected |= H5D_SEL_IO_NO_VECTOR_OR_SELECTION_IO_CB;
             no_selection_io_cause_read_expected |= H5D_SEL_IO_NO_VECTOR_OR_SELECTION_IO_CB;
@@ -3211,6 +3224,16 @@ main(void)
     fapl = h5_fileaccess();
     h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
 
+#ifdef H5_HAVE_PREADWRITEV
+    /* The sec2 and direct drivers implement vector I/O with preadv/pwritev */
+    {
+        const char *driver_name = h5_get_test_driver_name();
+
+        if (!strcmp(driver_name, "sec2") || !strcmp(driver_name, "direct"))
+            vfd_sel_io_mode_g = H5D_VECTOR_IO;
+    }
+#endif
+
     if ((fapl2 = H5Pcopy(fapl)) < 0)
         TEST_ERROR;
 
@@ -29,6 +29,9 @@
 /**********/
 #define BUF_LEN 3093 /* No particular value */
 
+/* # of buffers for the multi-buffer checksum test */
+#define MULTI_NBUFS 11
+
 /*******************/
 /* Local variables */
 /*******************/
@@ -210,6 +213,126 @@ test_chksum_large(void)
     free(large_buf);
 } /* test_chksum_large() */
 
+/****************************************************************
+**
+**  ref_fletcher32(): Reference fletcher32 checksum, adding each
+**      16-bit word to the sums in turn.
+**
+****************************************************************/
+static uint32_t
+ref_fletcher32(const uint8_t *data, size_t _len)
+{
+    size_t   len  = _len / 2;
+    uint32_t sum1 = 0, sum2 = 0;
+
+    while (len) {
+        size_t tlen = len > 360 ? 360 : len;
+        len -= tlen;
+        do {
+            sum1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
+            data += 2;
+            sum2 += sum1;
+        } while (--tlen);
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+    if (_len % 2) {
+        sum1 += (uint32_t)(((uint16_t)*data) << 8);
+        sum2 += sum1;
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+
+    return (sum2 << 16) | sum1;
+} /* ref_fletcher32() */
+
+/****************************************************************
+**
+**  test_chksum_fletcher32_blocks(): Checksum buffers of every
+**      length up to a few blocks of the fletcher32 algorithm, and
+**      compare with adding each word in turn
+**
+****************************************************************/
+static void
+test_chksum_fletcher32_blocks(void)
+{
+    uint8_t *large_buf; /* Buffer for checksum calculations */
+    size_t   len;       /* Length checksummed */
+    size_t   u;         /* Local index variable */
+
+    /* Allocate the buffer */
+    large_buf = (uint8_t *)malloc((size_t)BUF_LEN);
+    CHECK_PTR(large_buf, "malloc");
+
+    /* Buffer w/real data */
+    for (u = 0; u < BUF_LEN; u++)
+        large_buf[u] = (uint8_t)((u * 7) + (u >> 5));
+    for (len = 1; len <= BUF_LEN; len++)
+        if (H5_checksum_fletcher32(large_buf, len) != ref_fletcher32(large_buf, len)) {
+            TestErrPrintf("fletcher32 checksum of %zu bytes differs\n", len);
+            break;
+        }
+
+    /* Buffer w/largest values, for the largest sums */
+    memset(large_buf, 0xff, (size_t)BUF_LEN);
+    for (len = 1; len <= BUF_LEN; len++)
+        if (H5_checksum_fletcher32(large_buf, len) != ref_fletcher32(large_buf, len)) {
+            TestErrPrintf("fletcher32 checksum of %zu 0xff bytes differs\n", len);
+            break;
+        }
+
+    /* Release memory for buffer */
+    free(large_buf);
+} /* test_chksum_fletcher32_blocks() */
+
+/****************************************************************
+**
+**  test_chksum_multi(): Checksum several buffers of different
+**      lengths at once
+**
+****************************************************************/
+static void
+test_chksum_multi(void)
+{
+    /* Lengths around the 12-byte blocks of the lookup3 algorithm */
+    size_t      lens[MULTI_NBUFS] = {1, 12, 13, 24, 25, 100, 7, 36, 37, 500, BUF_LEN - 40};
+    const void *bufs[MULTI_NBUFS];    /* Buffers to checksum */
+    uint32_t    chksums[MULTI_NBUFS]; /* Checksum values */
+    uint8_t    *large_buf;            /* Buffer for checksum calculations */
+    size_t      count;                /* # of buffers checksummed */
+    size_t      u;                    /* Local index variable */
+
+    /* Allocate the buffer */
+    large_buf = (uint8_t *)malloc((size_t)BUF_LEN);
+    CHECK_PTR(large_buf, "malloc");
+
+    /* Initialize buffer w/known data */
+    for (u = 0; u < BUF_LEN; u++)
+        large_buf[u] = (uint8_t)(u * 3);
+
+    /* Start the buffers at unaligned offsets */
+    for (u = 0; u < MULTI_NBUFS; u++)
+        bufs[u] = large_buf + (u * 3);
+
+    /* Checksum every # of buffers, including partial groups */
+    for (count = 0; count <= MULTI_NBUFS; count++) {
+        memset(chksums, 0, sizeof(chksums));
+        H5_checksum_metadata_multi(count, bufs, lens, 0, chksums);
+        for (u = 0; u < count; u++)
+            VERIFY(chksums[u], H5_checksum_metadata(bufs[u], lens[u], 0), "H5_checksum_metadata_multi");
+    }
+
+    /* Checksum w/an initial value */
+    H5_checksum_metadata_multi(MULTI_NBUFS, bufs, lens, 0xabcd, chksums);
+    for (u = 0; u < MULTI_NBUFS; u++)
+        VERIFY(chksums[u], H5_checksum_lookup3(bufs[u], lens[u], 0xabcd), "H5_checksum_metadata_multi");
+
+    /* Release memory for buffer */
+    free(large_buf);
+} /* test_chksum_multi() */
+
 /****************************************************************
 **
 **  test_checksum(): Main checksum testing routine.
@@ -222,11 +345,13 @@ test_checksum(void H5_ATTR_UNUSED *params)
     MESSAGE(5, ("Testing checksum algorithms\n"));
 
     /* Various checks for fletcher32 checksum algorithm */
-    test_chksum_size_one();   /* Test buffer w/only 1 byte */
-    test_chksum_size_two();   /* Test buffer w/only 2 bytes */
-    test_chksum_size_three(); /* Test buffer w/only 3 bytes */
-    test_chksum_size_four();  /* Test buffer w/only 4 bytes */
-    test_chksum_large();      /* Test buffer w/larger # of bytes */
+    test_chksum_size_one();          /* Test buffer w/only 1 byte */
+    test_chksum_size_two();          /* Test buffer w/only 2 bytes */
+    test_chksum_size_three();        /* Test buffer w/only 3 bytes */
+    test_chksum_size_four();         /* Test buffer w/only 4 bytes */
+    test_chksum_large();             /* Test buffer w/larger # of bytes */
+    test_chksum_fletcher32_blocks(); /* Test fletcher32 of every buffer size */
+    test_chksum_multi();             /* Test checksumming several buffers at once */
 
 } /* test_checksum() */
 
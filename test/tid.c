@@ -662,6 +662,110 @@ out:
     return -1;
 }
 
+/* Test that released IDs stay invalid after their slots are reused */
+#define SLOT_REUSE_NIDS 1000
+static int
+test_id_reuse(void)
+{
+    H5I_type_t myType = H5I_BADID;
+    int       *objs    = NULL;
+    hid_t     *old_ids = NULL;
+    hid_t     *new_ids = NULL;
+    void      *testPtr;
+    htri_t     tri_ret;
+    int        i, j;
+
+    objs    = (int *)malloc(SLOT_REUSE_NIDS * sizeof(int));
+    old_ids = (hid_t *)malloc(SLOT_REUSE_NIDS * sizeof(hid_t));
+    new_ids = (hid_t *)malloc(SLOT_REUSE_NIDS * sizeof(hid_t));
+    CHECK_PTR(objs, "malloc");
+    CHECK_PTR(old_ids, "malloc");
+    CHECK_PTR(new_ids, "malloc");
+    if (!objs || !old_ids || !new_ids)
+        goto out;
+
+    /* Register a type without a free function, since the objects are freed here */
+    myType = H5Iregister_type2(0, NULL);
+    CHECK(myType, H5I_BADID, "H5Iregister_type2");
+    if (myType == H5I_BADID)
+        goto out;
+
+    /* Register enough IDs to fill several pages of the type's slot table */
+    for (i = 0; i < SLOT_REUSE_NIDS; i++) {
+        objs[i]    = i;
+        old_ids[i] = H5Iregister(myType, &objs[i]);
+        CHECK(old_ids[i], H5I_INVALID_HID, "H5Iregister");
+        if (old_ids[i] == H5I_INVALID_HID)
+            goto out;
+    }
+
+    /* Release every other ID, then register new IDs which reuse their slots */
+    for (i = 0; i < SLOT_REUSE_NIDS; i += 2) {
+        testPtr = H5Iremove_verify(old_ids[i], myType);
+        CHECK_PTR_EQ(testPtr, &objs[i], "H5Iremove_verify");
+        if (testPtr != &objs[i])
+            goto out;
+    }
+    for (i = 0; i < SLOT_REUSE_NIDS; i += 2) {
+        new_ids[i] = H5Iregister(myType, &objs[i]);
+        CHECK(new_ids[i], H5I_INVALID_HID, "H5Iregister");
+        if (new_ids[i] == H5I_INVALID_HID)
+            goto out;
+    }
+
+    /* Released IDs must not match any new ID or resolve to an object */
+    for (i = 0; i < SLOT_REUSE_NIDS; i += 2) {
+        for (j = 0; j < SLOT_REUSE_NIDS; j++)
+            if (new_ids[i] == old_ids[j]) {
+                TestErrPrintf("new ID %" PRId64 " duplicates a previous ID\n", (int64_t)new_ids[i]);
+                goto out;
+            }
+
+        tri_ret = H5Iis_valid(old_ids[i]);
+        VERIFY(tri_ret, false, "H5Iis_valid");
+        if (tri_ret != false)
+            goto out;
+
+        H5E_BEGIN_TRY
+        testPtr = H5Iobject_verify(old_ids[i], myType);
+        H5E_END_TRY
+        CHECK_PTR_NULL(testPtr, "H5Iobject_verify");
+        if (testPtr != NULL)
+            goto out;
+
+        testPtr = H5Iobject_verify(new_ids[i], myType);
+        CHECK_PTR_EQ(testPtr, &objs[i], "H5Iobject_verify");
+        if (testPtr != &objs[i])
+            goto out;
+    }
+
+    /* The IDs that were never released are unaffected */
+    for (i = 1; i < SLOT_REUSE_NIDS; i += 2) {
+        testPtr = H5Iobject_verify(old_ids[i], myType);
+        CHECK_PTR_EQ(testPtr, &objs[i], "H5Iobject_verify");
+        if (testPtr != &objs[i])
+            goto out;
+    }
+
+    if (H5Idestroy_type(myType) < 0)
+        goto out;
+
+    free(objs);
+    free(old_ids);
+    free(new_ids);
+
+    return 0;
+
+out:
+    if (myType != H5I_BADID)
+        H5Idestroy_type(myType);
+    free(objs);
+    free(old_ids);
+    free(new_ids);
+
+    return -1;
+}
+
 /* Test the H5Iget_type function */
 static int
 test_get_type(void)
@@ -1729,6 +1833,8 @@ test_ids(void H5_ATTR_UNUSED *params)
         TestErrPrintf("Predefined ID type test failed\n");
     if (test_is_valid() < 0)
         TestErrPrintf("H5Iis_valid test failed\n");
+    if (test_id_reuse() < 0)
+        TestErrPrintf("ID slot reuse test failed\n");
     if (test_get_type() < 0)
         TestErrPrintf("H5Iget_type test failed\n");
     if (test_id_type_list() < 0)
@@ -155,6 +155,10 @@ main(int argc, char *argv[])
 #endif /* H5_HAVE_PTHREAD_H */
     AddTest("acreate", tts_acreate, NULL, cleanup_acreate, NULL, 0, "multi-attribute creation");
     AddTest("attr_vlen", tts_attr_vlen, NULL, cleanup_attr_vlen, NULL, 0, "multi-file-attribute-vlen read");
+    AddTest("chunk_read", tts_chunk_read, NULL, cleanup_chunk_read, NULL, 0, "concurrent filtered chunk reads");
+    AddTest("free_list", tts_free_list, NULL, NULL, NULL, 0, "concurrent free list use");
+    AddTest("dset_io_threads", tts_dset_io_threads, NULL, cleanup_dset_io_threads, NULL, 0,
+            "multi-dataset I/O on several threads");
 
     /* Error stack test must be done after thread_id test to not mess up expected IDs */
     AddTest("error_stacks", tts_error_stacks, NULL, NULL, NULL, 0, "error stack tests");
@@ -55,6 +55,9 @@ void tts_error(void *);
 void tts_cancel(void *);
 void tts_acreate(void *);
 void tts_attr_vlen(void *);
+void tts_chunk_read(void *);
+void tts_free_list(void *);
+void tts_dset_io_threads(void *);
 void tts_thread_id(void *);
 void tts_develop_api(void *);
 void tts_error_stacks(void *);
@@ -65,6 +68,8 @@ void cleanup_error(void *);
 void cleanup_cancel(void *);
 void cleanup_acreate(void *);
 void cleanup_attr_vlen(void *);
+void cleanup_chunk_read(void *);
+void cleanup_dset_io_threads(void *);
 
 #endif /* H5_HAVE_THREADSAFE_API */
 #endif /* H5_HAVE_THREADS */
@@ -0,0 +1,229 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the LICENSE file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing thread safety of concurrent chunk reads in the HDF5 library
+ * -------------------------------------------------------------------
+ *
+ * Set of tests to run multiple threads that read (and unfilter) the
+ * chunks of the same filtered dataset from a file opened read-only.
+ * The library reads and decodes chunks without holding its API lock
+ * in that case, so the threads really do run at the same time.  Half
+ * of the threads go through a dataset handle without a chunk cache, so
+ * every read misses, while the other half share a handle whose cache
+ * is too small to hold all the chunks.
+ *
+ * Temporary files generated:
+ *   ttsafe_chunk_read.h5
+ *
+ ********************************************************************/
+#include "ttsafe.h"
+
+#ifdef H5_HAVE_THREADSAFE_API
+
+#define FILENAME   "ttsafe_chunk_read.h5"
+#define DSETNAME   "filtered"
+#define NUM_THREAD 16
+#define NUM_CHUNKS 64
+#define CHUNK_SIZE 1024
+#define NUM_ITER   8
+
+H5TS_THREAD_RETURN_TYPE tts_chunk_read_reader(void *);
+
+typedef struct chunk_read_info_t {
+    int   id;
+    hid_t dset;
+    int   nerrors;
+} chunk_read_info_t;
+
+/*
+ **********************************************************************
+ * Thread safe test - concurrent reads of a filtered, chunked dataset
+ **********************************************************************
+ */
+void
+tts_chunk_read(void H5_ATTR_UNUSED *params)
+{
+    H5TS_thread_t     threads[NUM_THREAD];
+    chunk_read_info_t thread_info[NUM_THREAD];
+    hid_t             file          = H5I_INVALID_HID;
+    hid_t             space         = H5I_INVALID_HID;
+    hid_t             dcpl          = H5I_INVALID_HID;
+    hid_t             dapl          = H5I_INVALID_HID;
+    hid_t             dset          = H5I_INVALID_HID;
+    hid_t             dset_nocache  = H5I_INVALID_HID;
+    hsize_t           dims[1]       = {NUM_CHUNKS * CHUNK_SIZE};
+    hsize_t           chunk_dims[1] = {CHUNK_SIZE};
+    int              *data          = NULL;
+    int               i;
+    herr_t            status;
+
+    /* Create the file with a filtered, chunked dataset */
+    data = (int *)malloc(NUM_CHUNKS * CHUNK_SIZE * sizeof(int));
+    CHECK_PTR(data, "malloc");
+    for (i = 0; i < NUM_CHUNKS * CHUNK_SIZE; i++)
+        data[i] = i;
+
+    file = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(file, H5I_INVALID_HID, "H5Fcreate");
+    space = H5Screate_simple(1, dims, NULL);
+    CHECK(space, H5I_INVALID_HID, "H5Screate_simple");
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, H5I_INVALID_HID, "H5Pcreate");
+    status = H5Pset_chunk(dcpl, 1, chunk_dims);
+    CHECK(status, FAIL, "H5Pset_chunk");
+    status = H5Pset_shuffle(dcpl);
+    CHECK(status, FAIL, "H5Pset_shuffle");
+    status = H5Pset_fletcher32(dcpl);
+    CHECK(status, FAIL, "H5Pset_fletcher32");
+    dset = H5Dcreate2(file, DSETNAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(dset, H5I_INVALID_HID, "H5Dcreate2");
+    status = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+    CHECK(status, FAIL, "H5Dwrite");
+    status = H5Dclose(dset);
+    CHECK(status, FAIL, "H5Dclose");
+    status = H5Pclose(dcpl);
+    CHECK(status, FAIL, "H5Pclose");
+    status = H5Sclose(space);
+    CHECK(status, FAIL, "H5Sclose");
+    status = H5Fclose(file);
+    CHECK(status, FAIL, "H5Fclose");
+
+    /* Re-open the file read-only, through a handle with a small chunk cache
+     * and another without one */
+    file = H5Fopen(FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(file, H5I_INVALID_HID, "H5Fopen");
+    dapl = H5Pcreate(H5P_DATASET_ACCESS);
+    CHECK(dapl, H5I_INVALID_HID, "H5Pcreate");
+    status = H5Pset_chunk_cache(dapl, 7, 8 * CHUNK_SIZE * sizeof(int), 0.75);
+    CHECK(status, FAIL, "H5Pset_chunk_cache");
+    dset = H5Dopen2(file, DSETNAME, dapl);
+    CHECK(dset, H5I_INVALID_HID, "H5Dopen2");
+    status = H5Pset_chunk_cache(dapl, 0, 0, 0.75);
+    CHECK(status, FAIL, "H5Pset_chunk_cache");
+    dset_nocache = H5Dopen2(file, DSETNAME, dapl);
+    CHECK(dset_nocache, H5I_INVALID_HID, "H5Dopen2");
+
+    /* Simultaneously read the chunks in a large number of threads */
+    for (i = 0; i < NUM_THREAD; i++) {
+        thread_info[i].id      = i;
+        thread_info[i].dset    = (i % 2) ? dset : dset_nocache;
+        thread_info[i].nerrors = 0;
+        if (H5TS_thread_create(&threads[i], tts_chunk_read_reader, &thread_info[i]) < 0)
+            TestErrPrintf("thread # %d did not start", i);
+    }
+
+    for (i = 0; i < NUM_THREAD; i++)
+        if (H5TS_thread_join(threads[i], NULL) < 0)
+            TestErrPrintf("thread %d failed to join", i);
+
+    for (i = 0; i < NUM_THREAD; i++)
+        if (thread_info[i].nerrors)
+            TestErrPrintf("thread %d read wrong data %d times\n", i, thread_info[i].nerrors);
+
+    /* Read the whole dataset once more, after all the threads are done */
+    memset(data, 0, NUM_CHUNKS * CHUNK_SIZE * sizeof(int));
+    status = H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+    CHECK(status, FAIL, "H5Dread");
+    for (i = 0; i < NUM_CHUNKS * CHUNK_SIZE; i++)
+        if (data[i] != i) {
+            TestErrPrintf("Wrong value %d read at %d - test failed\n", data[i], i);
+            break;
+        }
+
+    /* Close remaining resources */
+    status = H5Dclose(dset_nocache);
+    CHECK(status, FAIL, "H5Dclose");
+    status = H5Dclose(dset);
+    CHECK(status, FAIL, "H5Dclose");
+    status = H5Pclose(dapl);
+    CHECK(status, FAIL, "H5Pclose");
+    status = H5Fclose(file);
+    CHECK(status, FAIL, "H5Fclose");
+
+    free(data);
+} /* end tts_chunk_read() */
+
+H5TS_THREAD_RETURN_TYPE
+tts_chunk_read_reader(void *_thread_info)
+{
+    chunk_read_info_t *info     = (chunk_read_info_t *)_thread_info;
+    hid_t              fspace   = H5I_INVALID_HID;
+    hid_t              mspace   = H5I_INVALID_HID;
+    hid_t              mspace1  = H5I_INVALID_HID;
+    hsize_t            start[1];
+    hsize_t            count[1] = {2 * CHUNK_SIZE};
+    hsize_t            one[1]   = {1};
+    int               *buf      = NULL;
+    int                value;
+    int                iter, c, u;
+    herr_t             status;
+
+    buf = (int *)malloc(2 * CHUNK_SIZE * sizeof(int));
+    CHECK_PTR(buf, "malloc");
+
+    fspace = H5Dget_space(info->dset);
+    CHECK(fspace, H5I_INVALID_HID, "H5Dget_space");
+    mspace = H5Screate_simple(1, count, NULL);
+    CHECK(mspace, H5I_INVALID_HID, "H5Screate_simple");
+    mspace1 = H5Screate_simple(1, one, NULL);
+    CHECK(mspace1, H5I_INVALID_HID, "H5Screate_simple");
+
+    for (iter = 0; iter < NUM_ITER; iter++)
+        for (c = 0; c < NUM_CHUNKS; c++) {
+            int chunk = (c + info->id * 3) % NUM_CHUNKS;
+
+            /* Read two chunks, straddling a chunk boundary half-way through */
+            start[0] = (hsize_t)chunk * CHUNK_SIZE + CHUNK_SIZE / 2;
+            if (start[0] + count[0] > NUM_CHUNKS * CHUNK_SIZE)
+                start[0] = (NUM_CHUNKS - 2) * CHUNK_SIZE;
+            status = H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, NULL, count, NULL);
+            CHECK(status, FAIL, "H5Sselect_hyperslab");
+            status = H5Dread(info->dset, H5T_NATIVE_INT, mspace, fspace, H5P_DEFAULT, buf);
+            CHECK(status, FAIL, "H5Dread");
+            for (u = 0; u < 2 * CHUNK_SIZE; u++)
+                if (buf[u] != (int)start[0] + u) {
+                    info->nerrors++;
+                    break;
+                }
+
+            /* Read a single element from the chunk */
+            start[0] = (hsize_t)chunk * CHUNK_SIZE + (hsize_t)(info->id + iter);
+            status   = H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, NULL, one, NULL);
+            CHECK(status, FAIL, "H5Sselect_hyperslab");
+            status = H5Dread(info->dset, H5T_NATIVE_INT, mspace1, fspace, H5P_DEFAULT, &value);
+            CHECK(status, FAIL, "H5Dread");
+            if (value != (int)start[0])
+                info->nerrors++;
+        }
+
+    status = H5Sclose(mspace1);
+    CHECK(status, FAIL, "H5Sclose");
+    status = H5Sclose(mspace);
+    CHECK(status, FAIL, "H5Sclose");
+    status = H5Sclose(fspace);
+    CHECK(status, FAIL, "H5Sclose");
+
+    free(buf);
+
+    return (H5TS_thread_ret_t)0;
+} /* end tts_chunk_read_reader() */
+
+void
+cleanup_chunk_read(void H5_ATTR_UNUSED *params)
+{
+    if (GetTestCleanup()) {
+        HDunlink(FILENAME);
+    }
+}
+#endif /* H5_HAVE_THREADSAFE_API */
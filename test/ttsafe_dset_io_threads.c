@@ -0,0 +1,217 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the LICENSE file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Test multi-dataset I/O with type conversion on several threads
+ *
+ * Writes several contiguous and chunked integer datasets from float
+ * buffers with H5Dwrite_multi(), then reads them back into double
+ * buffers with H5Dread_multi(), with H5Pset_dataset_io_threads() set
+ * on the transfer property list.  Every other dataset uses a strided
+ * memory selection, so the pieces are gathered and scattered as well
+ * as converted on the threads.  The data is read back a second time
+ * with more threads, after the worker threads were kept from the
+ * first operations.
+ *
+ * Temporary files generated:
+ *   ttsafe_dset_io_threads.h5
+ *
+ ********************************************************************/
+#include "ttsafe.h"
+
+#ifdef H5_HAVE_THREADSAFE_API
+
+#define FILENAME    "ttsafe_dset_io_threads.h5"
+#define NUM_DSETS   8
+#define NUM_THREADS 4
+#define DSET_SIZE   4096
+#define CHUNK_SIZE  512
+
+/*
+ **********************************************************************
+ * tts_dset_io_threads
+ *
+ **********************************************************************
+ */
+void
+tts_dset_io_threads(void H5_ATTR_UNUSED *params)
+{
+    hid_t       file              = H5I_INVALID_HID;
+    hid_t       file_space        = H5I_INVALID_HID;
+    hid_t       mem_space_contig  = H5I_INVALID_HID;
+    hid_t       mem_space_strided = H5I_INVALID_HID;
+    hid_t       dcpl              = H5I_INVALID_HID;
+    hid_t       dapl              = H5I_INVALID_HID;
+    hid_t       dxpl              = H5I_INVALID_HID;
+    hid_t       dsets[NUM_DSETS];
+    hid_t       mem_types[NUM_DSETS];
+    hid_t       mem_spaces[NUM_DSETS];
+    hid_t       file_spaces[NUM_DSETS];
+    const void *wbufs[NUM_DSETS];
+    void       *rbufs[NUM_DSETS];
+    float      *wdata           = NULL;
+    double     *rdata           = NULL;
+    hsize_t     dims[1]         = {DSET_SIZE};
+    hsize_t     mem_dims[1]     = {2 * DSET_SIZE};
+    hsize_t     chunk_dims[1]   = {CHUNK_SIZE};
+    hsize_t     start[1]        = {1};
+    hsize_t     stride[1]       = {2};
+    hsize_t     count[1]        = {DSET_SIZE};
+    unsigned    nthreads        = 0;
+    uint32_t    no_sel_io_cause = 0;
+    char        name[32];
+    int         i, j, k;
+    herr_t      ret;
+
+    /* Check the property */
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    CHECK(dxpl, H5I_INVALID_HID, "H5Pcreate");
+    ret = H5Pget_dataset_io_threads(dxpl, &nthreads);
+    CHECK(ret, FAIL, "H5Pget_dataset_io_threads");
+    VERIFY(nthreads, 1, "H5Pget_dataset_io_threads");
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_dataset_io_threads(dxpl, 0);
+    }
+    H5E_END_TRY
+    VERIFY(ret, FAIL, "H5Pset_dataset_io_threads");
+    ret = H5Pset_dataset_io_threads(dxpl, NUM_THREADS);
+    CHECK(ret, FAIL, "H5Pset_dataset_io_threads");
+    ret = H5Pget_dataset_io_threads(dxpl, &nthreads);
+    CHECK(ret, FAIL, "H5Pget_dataset_io_threads");
+    VERIFY(nthreads, NUM_THREADS, "H5Pget_dataset_io_threads");
+    ret = H5Pset_selection_io(dxpl, H5D_SELECTION_IO_MODE_ON);
+    CHECK(ret, FAIL, "H5Pset_selection_io");
+
+    /* Memory buffers hold twice as many elements as the datasets, so the
+     * strided selection fits */
+    wdata = (float *)calloc(NUM_DSETS * 2 * DSET_SIZE, sizeof(float));
+    CHECK_PTR(wdata, "calloc");
+    rdata = (double *)calloc(NUM_DSETS * 2 * DSET_SIZE, sizeof(double));
+    CHECK_PTR(rdata, "calloc");
+
+    file = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(file, H5I_INVALID_HID, "H5Fcreate");
+    file_space = H5Screate_simple(1, dims, NULL);
+    CHECK(file_space, H5I_INVALID_HID, "H5Screate_simple");
+    mem_space_contig = H5Screate_simple(1, dims, NULL);
+    CHECK(mem_space_contig, H5I_INVALID_HID, "H5Screate_simple");
+    mem_space_strided = H5Screate_simple(1, mem_dims, NULL);
+    CHECK(mem_space_strided, H5I_INVALID_HID, "H5Screate_simple");
+    ret = H5Sselect_hyperslab(mem_space_strided, H5S_SELECT_SET, start, stride, count, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, H5I_INVALID_HID, "H5Pcreate");
+    ret = H5Pset_chunk(dcpl, 1, chunk_dims);
+    CHECK(ret, FAIL, "H5Pset_chunk");
+
+    /* Bypass the chunk cache, or the chunked datasets don't use selection I/O */
+    dapl = H5Pcreate(H5P_DATASET_ACCESS);
+    CHECK(dapl, H5I_INVALID_HID, "H5Pcreate");
+    ret = H5Pset_chunk_cache(dapl, 0, 0, H5D_CHUNK_CACHE_W0_DEFAULT);
+    CHECK(ret, FAIL, "H5Pset_chunk_cache");
+
+    /* Create the datasets and fill the write buffers */
+    for (i = 0; i < NUM_DSETS; i++) {
+        float *buf = wdata + (i * 2 * DSET_SIZE);
+
+        snprintf(name, sizeof(name), "dset%d", i);
+        dsets[i] = H5Dcreate2(file, name, H5T_NATIVE_INT, file_space, H5P_DEFAULT,
+                              (i % 4) < 2 ? H5P_DEFAULT : dcpl, dapl);
+        CHECK(dsets[i], H5I_INVALID_HID, "H5Dcreate2");
+
+        mem_spaces[i]  = (i % 2) ? mem_space_strided : mem_space_contig;
+        file_spaces[i] = H5S_ALL;
+        wbufs[i]       = buf;
+        rbufs[i]       = rdata + (i * 2 * DSET_SIZE);
+
+        for (j = 0; j < DSET_SIZE; j++)
+            buf[(i % 2) ? (2 * j) + 1 : j] = (float)((i * DSET_SIZE) + j);
+    }
+
+    /* Write all the datasets, converting float to int */
+    for (i = 0; i < NUM_DSETS; i++)
+        mem_types[i] = H5T_NATIVE_FLOAT;
+    ret = H5Dwrite_multi(NUM_DSETS, dsets, mem_types, mem_spaces, file_spaces, dxpl, wbufs);
+    CHECK(ret, FAIL, "H5Dwrite_multi");
+    ret = H5Pget_no_selection_io_cause(dxpl, &no_sel_io_cause);
+    CHECK(ret, FAIL, "H5Pget_no_selection_io_cause");
+    VERIFY(no_sel_io_cause, 0, "H5Pget_no_selection_io_cause");
+
+    /* Read them back, converting int to double, then again with more threads */
+    for (k = 0; k < 2; k++) {
+        ret = H5Pset_dataset_io_threads(dxpl, NUM_THREADS << k);
+        CHECK(ret, FAIL, "H5Pset_dataset_io_threads");
+        memset(rdata, 0, NUM_DSETS * 2 * DSET_SIZE * sizeof(double));
+        for (i = 0; i < NUM_DSETS; i++)
+            mem_types[i] = H5T_NATIVE_DOUBLE;
+        ret = H5Dread_multi(NUM_DSETS, dsets, mem_types, mem_spaces, file_spaces, dxpl, rbufs);
+        CHECK(ret, FAIL, "H5Dread_multi");
+        ret = H5Pget_no_selection_io_cause(dxpl, &no_sel_io_cause);
+        CHECK(ret, FAIL, "H5Pget_no_selection_io_cause");
+        VERIFY(no_sel_io_cause, 0, "H5Pget_no_selection_io_cause");
+
+        /* Verify the data, and that the elements outside the strided
+         * selections were left alone */
+        for (i = 0; i < NUM_DSETS; i++) {
+            const double *buf = (const double *)rbufs[i];
+
+            for (j = 0; j < DSET_SIZE; j++) {
+                double expected = (double)((i * DSET_SIZE) + j);
+
+                if (!H5_DBL_ABS_EQUAL(buf[(i % 2) ? (2 * j) + 1 : j], expected)) {
+                    TestErrPrintf("dataset %d: element %d was %f, expected %f\n", i, j,
+                                  buf[(i % 2) ? (2 * j) + 1 : j], expected);
+                    break;
+                }
+                if ((i % 2) && !H5_DBL_ABS_EQUAL(buf[2 * j], 0.0)) {
+                    TestErrPrintf("dataset %d: element %d outside the selection was modified\n", i,
+                                  2 * j);
+                    break;
+                }
+            }
+        }
+    }
+
+    /* Close everything */
+    for (i = 0; i < NUM_DSETS; i++) {
+        ret = H5Dclose(dsets[i]);
+        CHECK(ret, FAIL, "H5Dclose");
+    }
+    ret = H5Pclose(dapl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Pclose(dxpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Sclose(mem_space_strided);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(mem_space_contig);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(file_space);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(file);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    free(wdata);
+    free(rdata);
+} /* end tts_dset_io_threads() */
+
+void
+cleanup_dset_io_threads(void H5_ATTR_UNUSED *params)
+{
+    if (GetTestCleanup()) {
+        HDunlink(FILENAME);
+    }
+}
+#endif /* H5_HAVE_THREADSAFE_API */
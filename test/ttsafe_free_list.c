@@ -0,0 +1,191 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the LICENSE file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Test concurrent use of the free lists from several threads
+ *
+ * Each thread allocates objects from a regular free list, a block free
+ * list and a factory, frees half of them and hands the other half to the
+ * next thread to free, so objects are released by a different thread from
+ * the one that allocated them.  After all the threads exit, every object
+ * must be accounted for: nothing may be left allocated from any of the
+ * lists, and the factory must be able to shut down.
+ *
+ ********************************************************************/
+
+#include "ttsafe.h"
+#include "H5FLprivate.h"
+
+#ifdef H5_HAVE_THREADSAFE_API
+
+#define NTHREADS 8
+#define NROUNDS  20
+#define NOBJS    100
+
+/* Object allocated from the regular free list */
+typedef struct tts_fl_obj_t {
+    int    owner;
+    int    idx;
+    double pad[3];
+} tts_fl_obj_t;
+
+/* Free lists used by the test */
+H5FL_DEFINE_STATIC(tts_fl_obj_t);
+H5FL_BLK_DEFINE_STATIC(tts_fl_blk);
+static H5FL_fac_head_t *fac_g;
+
+/* Objects handed from each thread to the next one */
+typedef struct tts_fl_handoff_t {
+    tts_fl_obj_t *objs[NOBJS / 2];
+    uint8_t      *blks[NOBJS / 2];
+    int          *facs[NOBJS / 2];
+} tts_fl_handoff_t;
+
+static tts_fl_handoff_t *handoff_g;
+static H5TS_barrier_t    barrier_g;
+
+static H5TS_THREAD_RETURN_TYPE
+tts_free_list_thread(void *_id)
+{
+    int           id = *(int *)_id;
+    tts_fl_obj_t *objs[NOBJS];
+    uint8_t      *blks[NOBJS];
+    int          *facs[NOBJS];
+    int           round, u;
+
+    for (round = 0; round < NROUNDS; round++) {
+        tts_fl_handoff_t *prev = &handoff_g[(id + NTHREADS - 1) % NTHREADS];
+
+        /* Allocate objects and fill them with values that identify them */
+        for (u = 0; u < NOBJS; u++) {
+            /* Mix small blocks, which are cached per-thread, with large ones */
+            size_t blk_size = (size_t)(16 + ((u % 4) * 24) + ((u % 10) == 0 ? 8192 : 0));
+
+            objs[u] = H5FL_MALLOC(tts_fl_obj_t);
+            blks[u] = H5FL_BLK_MALLOC(tts_fl_blk, blk_size);
+            facs[u] = H5FL_FAC_MALLOC(fac_g);
+            if (NULL == objs[u] || NULL == blks[u] || NULL == facs[u]) {
+                TestErrPrintf("thread %d: allocation failed\n", id);
+                return (H5TS_thread_ret_t)0;
+            }
+            objs[u]->owner = id;
+            objs[u]->idx   = u;
+            memset(blks[u], id, blk_size);
+            facs[u][0] = id;
+            facs[u][1] = u;
+        }
+
+        /* Verify nothing else was handed the same objects */
+        for (u = 0; u < NOBJS; u++)
+            if (objs[u]->owner != id || objs[u]->idx != u || blks[u][0] != (uint8_t)id ||
+                facs[u][0] != id || facs[u][1] != u)
+                TestErrPrintf("thread %d: object %d was modified by another thread\n", id, u);
+
+        /* Free the first half, hand the second half to the next thread */
+        for (u = 0; u < NOBJS / 2; u++) {
+            objs[u] = H5FL_FREE(tts_fl_obj_t, objs[u]);
+            blks[u] = H5FL_BLK_FREE(tts_fl_blk, blks[u]);
+            facs[u] = H5FL_FAC_FREE(fac_g, facs[u]);
+        }
+        for (u = 0; u < NOBJS / 2; u++) {
+            handoff_g[id].objs[u] = objs[(NOBJS / 2) + u];
+            handoff_g[id].blks[u] = blks[(NOBJS / 2) + u];
+            handoff_g[id].facs[u] = facs[(NOBJS / 2) + u];
+        }
+
+        H5TS_barrier_wait(&barrier_g);
+
+        /* Free the objects the previous thread allocated */
+        for (u = 0; u < NOBJS / 2; u++) {
+            prev->objs[u] = H5FL_FREE(tts_fl_obj_t, prev->objs[u]);
+            prev->blks[u] = H5FL_BLK_FREE(tts_fl_blk, prev->blks[u]);
+            prev->facs[u] = H5FL_FAC_FREE(fac_g, prev->facs[u]);
+        }
+
+        H5TS_barrier_wait(&barrier_g);
+    }
+
+    return (H5TS_thread_ret_t)0;
+}
+
+/*
+ **********************************************************************
+ * tts_free_list
+ *
+ **********************************************************************
+ */
+void
+tts_free_list(void H5_ATTR_UNUSED *params)
+{
+    H5TS_thread_t threads[NTHREADS];
+    int           ids[NTHREADS];
+    size_t        reg_size, arr_size, blk_size, fac_size;
+    uint64_t      hits, misses, spills;
+    size_t        thread_size;
+    int           i;
+    herr_t        ret;
+
+    handoff_g = calloc(NTHREADS, sizeof(tts_fl_handoff_t));
+    CHECK_PTR(handoff_g, "calloc");
+    fac_g = H5FL_fac_init(2 * sizeof(int));
+    CHECK_PTR(fac_g, "H5FL_fac_init");
+    ret = H5TS_barrier_init(&barrier_g, NTHREADS);
+    CHECK_I(ret, "H5TS_barrier_init");
+
+    for (i = 0; i < NTHREADS; i++) {
+        ids[i] = i;
+        if (H5TS_thread_create(&threads[i], tts_free_list_thread, &ids[i]) < 0)
+            TestErrPrintf("thread %d did not start", i);
+    }
+    for (i = 0; i < NTHREADS; i++)
+        if (H5TS_thread_join(threads[i], NULL) < 0)
+            TestErrPrintf("thread %d failed to join", i);
+
+    /* The free list sizes include objects cached by threads */
+    ret = H5get_free_list_sizes(&reg_size, &arr_size, &blk_size, &fac_size);
+    CHECK(ret, FAIL, "H5get_free_list_sizes");
+
+    ret = H5get_free_list_cache_stats(&hits, &misses, &spills, &thread_size);
+    CHECK(ret, FAIL, "H5get_free_list_cache_stats");
+#if !defined H5_NO_FREE_LISTS && !defined H5_USING_MEMCHECKER
+    /* The threads reused objects from their caches, and freeing the
+     * objects handed to them filled their caches past capacity */
+    if (0 == hits || 0 == misses || 0 == spills)
+        TestErrPrintf("free list cache statistics weren't counted: %" PRIu64 " hits, %" PRIu64
+                      " misses, %" PRIu64 " spills\n",
+                      hits, misses, spills);
+#endif
+
+    ret = H5garbage_collect();
+    CHECK(ret, FAIL, "H5garbage_collect");
+
+#if !defined H5_NO_FREE_LISTS && !defined H5_USING_MEMCHECKER
+    /* Every object must be back on its free list, and freed by the
+     * garbage collection */
+    VERIFY(H5FL_REG_NAME(tts_fl_obj_t).allocated, 0, "regular free list");
+    VERIFY(H5FL_REG_NAME(tts_fl_obj_t).onlist, 0, "regular free list");
+    VERIFY(H5FL_BLK_NAME(tts_fl_blk).allocated, 0, "block free list");
+    VERIFY(H5FL_BLK_NAME(tts_fl_blk).onlist, 0, "block free list");
+    VERIFY(fac_g->allocated, 0, "factory free list");
+#endif
+
+    /* The factory can only shut down when nothing is left allocated from it */
+    ret = H5FL_fac_term(fac_g);
+    CHECK(ret, FAIL, "H5FL_fac_term");
+
+    ret = H5TS_barrier_destroy(&barrier_g);
+    CHECK_I(ret, "H5TS_barrier_destroy");
+    free(handoff_g);
+} /* end tts_free_list() */
+
+#endif /* H5_HAVE_THREADSAFE_API */
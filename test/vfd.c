@@ -32,6 +32,7 @@
 #define DSET1_NAME "dset1"
 #define DSET1_DIM1 1024
 #define DSET1_DIM2 32
+#define DSET2_NAME "dset2"
 #define DSET3_NAME "dset3"
 
 /* Macros for Direct VFD */
@@ -40,8 +41,9 @@
 #define FBSIZE     (4 * KB)
 #define CBSIZE     (8 * KB)
 #define THRESHOLD  1
-#define DSET2_NAME "dset2"
 #define DSET2_DIM  4
+/* Two whole file blocks plus a partial one */
+#define DSET3_DIM ((int)(2 * FBSIZE / sizeof(int)) + 3)
 #endif /* H5_HAVE_DIRECT */
 
 static const char *FILENAME[] = {"sec2_file",            /*0*/
@@ -60,6 +62,8 @@ static const char *FILENAME[] = {"sec2_file",            /*0*/
                                  "splitter.log",         /*13*/
                                  "ctl_file",             /*14*/
                                  "ctl_splitter_wo_file", /*15*/
+                                 "iouring_file",         /*16*/
+                                 "mmap_file",            /*17*/
                                  NULL};
 
 #define LOG_FILENAME "log_vfd_out.log"
@@ -228,6 +232,18 @@ test_sec2(void)
         TEST_ERROR;
     if (!(driver_flags & H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
         TEST_ERROR;
+#ifdef H5_HAVE_PREADWRITEV
+    /* The preadv()/pwritev() vector callbacks don't enable selection I/O by default */
+    if (!(driver_flags & H5FD_FEAT_SELECTION_IO_OPT_IN))
+        TEST_ERROR;
+    driver_flags &= ~(unsigned long)H5FD_FEAT_SELECTION_IO_OPT_IN;
+#endif
+#ifdef H5_HAVE_PREADWRITE
+    /* Reads with pread() may be made by several threads at once */
+    if (!(driver_flags & H5FD_FEAT_CONCURRENT_READ))
+        TEST_ERROR;
+    driver_flags &= ~(unsigned long)H5FD_FEAT_CONCURRENT_READ;
+#endif
     /* Check for extra flags not accounted for above */
     if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
                          H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_POSIX_COMPAT_HANDLE |
@@ -317,6 +333,16 @@ test_core(void)
     bool          backing_store;                  /* use backing store?           */
     bool          use_write_tracking;             /* write tracking flag          */
     size_t        write_tracking_page_size;       /* write tracking page size     */
+    double        growth_factor;                  /* core VFD growth factor       */
+    bool          use_hugepages;                  /* hugepage-backed memory?      */
+    haddr_t       dset_offset;                    /* dataset address in the file  */
+    hid_t         mem_sid  = H5I_INVALID_HID;     /* memory dataspace ID          */
+    hsize_t       start[2];                       /* hyperslab start              */
+    hsize_t       count[2];                       /* hyperslab count              */
+    int           fd       = -1;                  /* POSIX file descriptor        */
+    int           sentinel = -1;                  /* value written behind the VFD */
+    int           file_val;                       /* value read from the file     */
+    herr_t        ret;                            /* generic return value         */
     int          *data_w = NULL;                  /* data written to the dataset  */
     int          *data_r = NULL;                  /* data read from the dataset   */
     int           val;                            /* data value                   */
@@ -367,10 +393,12 @@ test_core(void)
         TEST_ERROR;
     if (!(driver_flags & H5FD_FEAT_CAN_USE_FILE_IMAGE_CALLBACKS))
         TEST_ERROR;
+    if (!(driver_flags & H5FD_FEAT_CONCURRENT_READ))
+        TEST_ERROR;
     /* Check for extra flags not accounted for above */
-    if (driver_flags !=
-        (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
-         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_ALLOW_FILE_IMAGE | H5FD_FEAT_CAN_USE_FILE_IMAGE_CALLBACKS))
+    if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
+                         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_ALLOW_FILE_IMAGE |
+                         H5FD_FEAT_CAN_USE_FILE_IMAGE_CALLBACKS | H5FD_FEAT_CONCURRENT_READ))
         TEST_ERROR;
 
     if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
@@ -607,6 +635,135 @@ test_core(void)
     if (file_size < 64 * KB || file_size > 256 * KB)
         FAIL_PUTS_ERROR("suspicious file size obtained from H5Fget_filesize");
 
+    /* Close the dataset and file */
+    if (H5Dclose(did) < 0)
+        TEST_ERROR;
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /************************************************************************
+     * Check that the allocation policy can be set and that only the dirty
+     * pages are written to the backing store when the file is flushed.
+     ************************************************************************/
+
+    /* Check the default allocation policy */
+    if (H5Pset_fapl_core(fapl_id, (size_t)CORE_INCREMENT, true) < 0)
+        TEST_ERROR;
+    if (H5Pget_core_allocation(fapl_id, &growth_factor, &use_hugepages) < 0)
+        TEST_ERROR;
+    if (!H5_DBL_ABS_EQUAL(growth_factor, 1.0) || use_hugepages)
+        FAIL_PUTS_ERROR("incorrect default core VFD allocation policy");
+
+    /* The memory can't shrink when it grows */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_core_allocation(fapl_id, 0.5, false);
+    }
+    H5E_END_TRY
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("growth factor less than 1.0 was accepted");
+
+    /* Set the write tracking and allocation properties, and check that
+     * neither overwrites the other.
+     */
+    if (H5Pset_core_write_tracking(fapl_id, true, (size_t)CORE_INCREMENT) < 0)
+        TEST_ERROR;
+    if (H5Pset_core_allocation(fapl_id, 2.0, true) < 0)
+        TEST_ERROR;
+    if (H5Pget_core_allocation(fapl_id, &growth_factor, &use_hugepages) < 0)
+        TEST_ERROR;
+    if (!H5_DBL_ABS_EQUAL(growth_factor, 2.0) || !use_hugepages)
+        FAIL_PUTS_ERROR("incorrect core VFD allocation policy");
+    if (H5Pget_core_write_tracking(fapl_id, &use_write_tracking, &write_tracking_page_size) < 0)
+        TEST_ERROR;
+    if (!use_write_tracking || (size_t)CORE_INCREMENT != write_tracking_page_size)
+        FAIL_PUTS_ERROR("write tracking properties lost when setting the allocation policy");
+
+    /* Create a file with the dataset and flush it to the backing store */
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR;
+    if ((did = H5Dcreate2(fid, CORE_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_w) < 0)
+        TEST_ERROR;
+    if (H5Fflush(fid, H5F_SCOPE_GLOBAL) < 0)
+        TEST_ERROR;
+    if (HADDR_UNDEF == (dset_offset = H5Dget_offset(did)))
+        TEST_ERROR;
+
+    /* Change the last element of the dataset in the backing store only */
+    if ((fd = HDopen(filename, O_RDWR)) < 0)
+        TEST_ERROR;
+    if (HDlseek(fd, (HDoff_t)(dset_offset + (CORE_DSET_DIM1 * CORE_DSET_DIM2 - 1) * sizeof(int)), SEEK_SET) <
+        0)
+        TEST_ERROR;
+    if (HDwrite(fd, &sentinel, sizeof(int)) != sizeof(int))
+        TEST_ERROR;
+
+    /* Change the first element through the library and flush again */
+    start[0] = start[1] = 0;
+    count[0] = count[1] = 1;
+    val                 = -2;
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if ((mem_sid = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(did, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, &val) < 0)
+        TEST_ERROR;
+    if (H5Fflush(fid, H5F_SCOPE_GLOBAL) < 0)
+        TEST_ERROR;
+    if (H5Sselect_all(sid) < 0)
+        TEST_ERROR;
+
+    /* The first element's page was written out, but the page holding the
+     * last element wasn't dirty so the change made behind the library's
+     * back must still be there.
+     */
+    if (HDlseek(fd, (HDoff_t)dset_offset, SEEK_SET) < 0)
+        TEST_ERROR;
+    if (HDread(fd, &file_val, sizeof(int)) != sizeof(int))
+        TEST_ERROR;
+    if (-2 != file_val)
+        FAIL_PUTS_ERROR("dirty page not written to the backing store on flush");
+    if (HDlseek(fd, (HDoff_t)(dset_offset + (CORE_DSET_DIM1 * CORE_DSET_DIM2 - 1) * sizeof(int)), SEEK_SET) <
+        0)
+        TEST_ERROR;
+    if (HDread(fd, &file_val, sizeof(int)) != sizeof(int))
+        TEST_ERROR;
+    if (sentinel != file_val)
+        FAIL_PUTS_ERROR("clean page written to the backing store on flush");
+    if (HDclose(fd) < 0)
+        TEST_ERROR;
+    fd = -1;
+
+    /* Close and reopen the file, then check all of the data */
+    if (H5Sclose(mem_sid) < 0)
+        TEST_ERROR;
+    if (H5Dclose(did) < 0)
+        TEST_ERROR;
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR;
+    if ((did = H5Dopen2(fid, CORE_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    memset(data_r, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_r) < 0)
+        TEST_ERROR;
+    data_w[0]                                   = -2;
+    data_w[CORE_DSET_DIM1 * CORE_DSET_DIM2 - 1] = sentinel;
+    pw                                          = data_w;
+    pr                                          = data_r;
+    for (i = 0; i < CORE_DSET_DIM1; i++)
+        for (j = 0; j < CORE_DSET_DIM2; j++)
+            if (*pw++ != *pr++) {
+                H5_FAILED();
+                printf("    Read different values than written in data set.\n");
+                printf("    At index %d,%d\n", i, j);
+                TEST_ERROR;
+            } /* end if */
+
     /* Close everything */
     if (H5Sclose(sid) < 0)
         TEST_ERROR;
@@ -663,6 +820,7 @@ test_core(void)
 error:
     H5E_BEGIN_TRY
     {
+        H5Sclose(mem_sid);
         H5Sclose(sid);
         H5Dclose(did);
         H5Pclose(fapl_id_out);
@@ -671,6 +829,8 @@ error:
     }
     H5E_END_TRY
 
+    if (fd >= 0)
+        HDclose(fd);
     if (data_w)
         free(data_w);
     if (data_r)
@@ -694,12 +854,12 @@ test_direct(void)
 {
 #ifdef H5_HAVE_DIRECT
     hid_t file = H5I_INVALID_HID, fapl = H5I_INVALID_HID, access_fapl = H5I_INVALID_HID;
-    hid_t dset1 = H5I_INVALID_HID, dset2 = H5I_INVALID_HID, space1 = H5I_INVALID_HID,
-          space2 = H5I_INVALID_HID;
+    hid_t dset1 = H5I_INVALID_HID, dset2 = H5I_INVALID_HID, dset3 = H5I_INVALID_HID,
+          space1 = H5I_INVALID_HID, space2 = H5I_INVALID_HID, space3 = H5I_INVALID_HID;
     char    filename[1024];
     int    *fhandle = NULL;
     hsize_t file_size;
-    hsize_t dims1[2], dims2[1];
+    hsize_t dims1[2], dims2[1], dims3[1];
     size_t  mbound;
     size_t  fbsize;
     size_t  cbsize;
@@ -860,6 +1020,39 @@ test_direct(void)
             TEST_ERROR;
         } /* end if */
 
+    /* For data set 3, the file address and memory buffer are aligned but the
+     * data size is not a multiple of the block size, so the whole blocks are
+     * transferred directly and only the last partial block is copied.
+     */
+    dims3[0] = DSET3_DIM;
+    if ((space3 = H5Screate_simple(1, dims3, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset3 =
+             H5Dcreate2(file, DSET3_NAME, H5T_NATIVE_INT, space3, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset3, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset3) < 0)
+        TEST_ERROR;
+
+    if ((dset3 = H5Dopen2(file, DSET3_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    memset(check, 0, DSET3_DIM * sizeof(int));
+    if (H5Dread(dset3, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    for (i = 0; i < DSET3_DIM; i++)
+        if (points[i] != check[i]) {
+            H5_FAILED();
+            printf("    Read different values than written in data set 3.\n");
+            printf("    At index %d\n", i);
+            TEST_ERROR;
+        } /* end if */
+
+    if (H5Sclose(space3) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset3) < 0)
+        TEST_ERROR;
+
     if (H5Sclose(space1) < 0)
         TEST_ERROR;
     if (H5Dclose(dset1) < 0)
@@ -892,6 +1085,8 @@ error:
         H5Dclose(dset1);
         H5Sclose(space2);
         H5Dclose(dset2);
+        H5Sclose(space3);
+        H5Dclose(dset3);
         H5Fclose(file);
     }
     H5E_END_TRY
@@ -905,6 +1100,471 @@ error:
 #endif /*H5_HAVE_DIRECT*/
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring
+ *
+ * Purpose:     Tests the file handle interface for the io_uring driver,
+ *              with registered buffers enabled so that small transfers
+ *              exercise the fixed-buffer path.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring(void)
+{
+#ifdef H5_HAVE_IOURING_VFD
+    hid_t         fid          = H5I_INVALID_HID; /* file ID                      */
+    hid_t         fapl_id      = H5I_INVALID_HID; /* file access property list ID */
+    hid_t         fapl_id_out  = H5I_INVALID_HID; /* from H5Fget_access_plist     */
+    hid_t         driver_id    = H5I_INVALID_HID; /* ID for this VFD              */
+    hid_t         dset         = H5I_INVALID_HID; /* dataset ID                   */
+    hid_t         space        = H5I_INVALID_HID; /* dataspace ID                 */
+    unsigned long driver_flags = 0;               /* VFD feature flags            */
+    unsigned      queue_depth  = 0;               /* queue depth from fapl        */
+    size_t        reg_buf_size = 0;               /* buffer size from fapl        */
+    char          filename[1024];                 /* filename                     */
+    void         *os_file_handle = NULL;          /* OS file handle               */
+    hsize_t       dims[2]        = {DSET1_DIM1, DSET1_DIM2};
+    int          *points = NULL, *check = NULL;
+    int           i;
+#endif /*H5_HAVE_IOURING_VFD*/
+
+    TESTING("io_uring file driver");
+
+#ifndef H5_HAVE_IOURING_VFD
+    SKIPPED();
+    return 0;
+#else  /*H5_HAVE_IOURING_VFD*/
+
+    /* Set property list and file name for io_uring driver */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+
+    /* Out-of-range queue depths are rejected */
+    H5E_BEGIN_TRY
+    {
+        if (H5Pset_fapl_iouring(fapl_id, H5FD_IOURING_QUEUE_DEPTH_MAX + 1, 0) >= 0)
+            TEST_ERROR;
+    }
+    H5E_END_TRY
+
+    if (H5Pset_fapl_iouring(fapl_id, 8, 4096) < 0)
+        TEST_ERROR;
+    if (H5Pget_fapl_iouring(fapl_id, &queue_depth, &reg_buf_size) < 0)
+        TEST_ERROR;
+    if (queue_depth != 8 || reg_buf_size != 4096)
+        TEST_ERROR;
+    h5_fixname(FILENAME[16], fapl_id, filename, sizeof(filename));
+
+    /* Check that the VFD feature flags are correct */
+    if ((driver_id = H5Pget_driver(fapl_id)) < 0)
+        TEST_ERROR;
+    if (H5FDdriver_query(driver_id, &driver_flags) < 0)
+        TEST_ERROR;
+    if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
+                         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_POSIX_COMPAT_HANDLE |
+                         H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+        TEST_ERROR;
+
+    /* The kernel may not permit io_uring (e.g. seccomp or sysctl policy) */
+    H5E_BEGIN_TRY
+    {
+        fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    }
+    H5E_END_TRY
+    if (fid < 0) {
+        H5Pclose(fapl_id);
+        SKIPPED();
+        puts("    io_uring is not available");
+        return 0;
+    }
+
+    /* Retrieve the access property list and check the driver */
+    if ((fapl_id_out = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR;
+    if (H5FD_IOURING != H5Pget_driver(fapl_id_out))
+        TEST_ERROR;
+    if (H5Pclose(fapl_id_out) < 0)
+        TEST_ERROR;
+
+    /* Check that we can get an operating-system-specific handle from
+     * the library.
+     */
+    if (H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle) < 0)
+        TEST_ERROR;
+    if (os_file_handle == NULL)
+        FAIL_PUTS_ERROR("NULL os-specific vfd/file handle was returned from H5Fget_vfd_handle");
+
+    /* Write and read back a dataset larger than the registered buffers */
+    if (NULL == (points = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (check = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    if ((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /* Reopen the file, reading through the registered buffers */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        if (points[i] != check[i]) {
+            H5_FAILED();
+            printf("    Read different values than written at index %d\n", i);
+            goto error;
+        }
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+
+    free(points);
+    free(check);
+
+    /* Close and delete the file */
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[16], fapl_id);
+
+    /* Close the fapl */
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_id);
+        H5Pclose(fapl_id_out);
+        H5Sclose(space);
+        H5Dclose(dset);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY
+
+    free(points);
+    free(check);
+
+    return -1;
+#endif /*H5_HAVE_IOURING_VFD*/
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    test_mmap
+ *
+ * Purpose:     Tests the read-only memory-mapped file driver: reading
+ *              datasets written with the sec2 driver, vector reads through
+ *              the VFD interface and views of contiguous data returned by
+ *              H5Dread_view().
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_mmap(void)
+{
+#ifdef H5_HAVE_MMAP_VFD
+    hid_t              fid            = H5I_INVALID_HID; /* file ID                      */
+    hid_t              fapl_id        = H5I_INVALID_HID; /* file access property list ID */
+    hid_t              sec2_fapl_id   = H5I_INVALID_HID; /* sec2 fapl for writing        */
+    hid_t              fapl_id_out    = H5I_INVALID_HID; /* from H5Fget_access_plist     */
+    hid_t              driver_id      = H5I_INVALID_HID; /* ID for this VFD              */
+    hid_t              dcpl           = H5I_INVALID_HID; /* dataset creation plist ID    */
+    hid_t              dset           = H5I_INVALID_HID; /* dataset ID                   */
+    hid_t              dset2          = H5I_INVALID_HID; /* chunked dataset ID           */
+    hid_t              space          = H5I_INVALID_HID; /* dataspace ID                 */
+    H5FD_t            *lf             = NULL;            /* VFD struct ptr               */
+    unsigned long      driver_flags   = 0;               /* VFD feature flags            */
+    H5FD_mmap_advice_t advice         = H5FD_MMAP_ADVICE_NORMAL;
+    char               filename[1024];        /* filename                     */
+    void              *os_file_handle = NULL; /* OS file handle               */
+    const void        *view           = NULL; /* H5Dread_view() result        */
+    haddr_t            dset_addr;
+    hsize_t            dims[2]  = {DSET1_DIM1, DSET1_DIM2};
+    hsize_t            cdims[2] = {DSET1_DIM1 / 8, DSET1_DIM2};
+    H5FD_mem_t         types[3] = {H5FD_MEM_DRAW, H5FD_MEM_NOLIST, H5FD_MEM_NOLIST};
+    haddr_t            addrs[3];
+    size_t             sizes[3] = {4 * sizeof(int), 0, 0};
+    int                vbufs[3][4];
+    void              *bufs[3] = {vbufs[0], vbufs[1], vbufs[2]};
+    int               *points = NULL, *check = NULL;
+    int                i;
+#endif /*H5_HAVE_MMAP_VFD*/
+
+    TESTING("mmap file driver");
+
+#ifndef H5_HAVE_MMAP_VFD
+    SKIPPED();
+    return 0;
+#else  /*H5_HAVE_MMAP_VFD*/
+
+    /* Set property list and file name for the mmap driver */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+
+    /* Invalid access pattern hints are rejected */
+    H5E_BEGIN_TRY
+    {
+        if (H5Pset_fapl_mmap(fapl_id, (H5FD_mmap_advice_t)42) >= 0)
+            TEST_ERROR;
+    }
+    H5E_END_TRY
+
+    if (H5Pset_fapl_mmap(fapl_id, H5FD_MMAP_ADVICE_SEQUENTIAL) < 0)
+        TEST_ERROR;
+    if (H5Pget_fapl_mmap(fapl_id, &advice) < 0)
+        TEST_ERROR;
+    if (advice != H5FD_MMAP_ADVICE_SEQUENTIAL)
+        TEST_ERROR;
+    h5_fixname(FILENAME[17], fapl_id, filename, sizeof(filename));
+
+    /* Check that the VFD feature flags are correct */
+    if ((driver_id = H5Pget_driver(fapl_id)) < 0)
+        TEST_ERROR;
+    if (H5FDdriver_query(driver_id, &driver_flags) < 0)
+        TEST_ERROR;
+    if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA |
+                         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_POSIX_COMPAT_HANDLE |
+                         H5FD_FEAT_CONCURRENT_READ | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+        TEST_ERROR;
+
+    /* Files can't be created with the mmap driver */
+    H5E_BEGIN_TRY
+    {
+        fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    }
+    H5E_END_TRY
+    if (fid >= 0)
+        TEST_ERROR;
+
+    /* Write the file with the sec2 driver: one contiguous and one chunked
+     * dataset holding the same values
+     */
+    if ((sec2_fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_sec2(sec2_fapl_id) < 0)
+        TEST_ERROR;
+
+    if (NULL == (points = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (check = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, sec2_fapl_id)) < 0)
+        TEST_ERROR;
+    if ((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl, 2, cdims) < 0)
+        TEST_ERROR;
+    if ((dset2 = H5Dcreate2(fid, DSET2_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+
+    /* No view while the file is open for writing */
+    if (H5Dread_view(dset, H5T_NATIVE_INT, &view) < 0)
+        TEST_ERROR;
+    if (view != NULL)
+        TEST_ERROR;
+
+    if (H5Dclose(dset2) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /* The sec2 driver doesn't provide views of read-only files either */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, sec2_fapl_id)) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dread_view(dset, H5T_NATIVE_INT, &view) < 0)
+        TEST_ERROR;
+    if (view != NULL)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /* Files can only be opened read-only */
+    H5E_BEGIN_TRY
+    {
+        fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id);
+    }
+    H5E_END_TRY
+    if (fid >= 0)
+        TEST_ERROR;
+
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR;
+
+    /* Retrieve the access property list and check the driver */
+    if ((fapl_id_out = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR;
+    if (H5FD_MMAP != H5Pget_driver(fapl_id_out))
+        TEST_ERROR;
+    if (H5Pclose(fapl_id_out) < 0)
+        TEST_ERROR;
+
+    /* Check that we can get an operating-system-specific handle from
+     * the library.
+     */
+    if (H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle) < 0)
+        TEST_ERROR;
+    if (os_file_handle == NULL)
+        FAIL_PUTS_ERROR("NULL os-specific vfd/file handle was returned from H5Fget_vfd_handle");
+
+    /* Read both datasets back */
+    if ((dset = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((dset2 = H5Dopen2(fid, DSET2_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        if (points[i] != check[i]) {
+            H5_FAILED();
+            printf("    Read different values than written at index %d\n", i);
+            goto error;
+        }
+    memset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        if (points[i] != check[i]) {
+            H5_FAILED();
+            printf("    Read different values than written at index %d of chunked dataset\n", i);
+            goto error;
+        }
+
+    /* The contiguous dataset can be viewed in place */
+    if (H5Dread_view(dset, H5T_NATIVE_INT, &view) < 0)
+        TEST_ERROR;
+    if (view == NULL)
+        FAIL_PUTS_ERROR("no view returned for contiguous dataset");
+    if (memcmp(view, points, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("view of contiguous dataset has wrong values");
+
+    /* ...but not when the data needs conversion */
+    if (H5Dread_view(dset, H5T_NATIVE_FLOAT, &view) < 0)
+        TEST_ERROR;
+    if (view != NULL)
+        TEST_ERROR;
+
+    /* ...and not for chunked datasets */
+    if (H5Dread_view(dset2, H5T_NATIVE_INT, &view) < 0)
+        TEST_ERROR;
+    if (view != NULL)
+        TEST_ERROR;
+
+    /* Remember where the contiguous data is for the vector read below */
+    if (HADDR_UNDEF == (dset_addr = H5Dget_offset(dset)))
+        TEST_ERROR;
+
+    if (H5Dclose(dset2) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /* Vector read through the VFD interface, with the last element reaching
+     * past the end of the file, where it must be zero filled
+     */
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDONLY, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR;
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, H5FDget_eof(lf, H5FD_MEM_DEFAULT) + 4 * sizeof(int)) < 0)
+        TEST_ERROR;
+    addrs[0] = dset_addr + 100 * sizeof(int);
+    addrs[1] = dset_addr;
+    addrs[2] = H5FDget_eof(lf, H5FD_MEM_DEFAULT) - 2 * sizeof(int);
+    memset(vbufs, 0xff, sizeof(vbufs));
+    if (H5FDread_vector(lf, H5P_DEFAULT, 3, types, addrs, sizes, bufs) < 0)
+        TEST_ERROR;
+    for (i = 0; i < 4; i++)
+        if (vbufs[0][i] != 100 + i || vbufs[1][i] != i)
+            FAIL_PUTS_ERROR("wrong values from vector read");
+    if (vbufs[2][2] != 0 || vbufs[2][3] != 0)
+        FAIL_PUTS_ERROR("data past the end of the file was not zero filled");
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR;
+    lf = NULL;
+
+    free(points);
+    free(check);
+
+    /* Delete the file */
+    h5_delete_test_file(FILENAME[17], sec2_fapl_id);
+
+    /* Close the fapls */
+    if (H5Pclose(sec2_fapl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (lf)
+            H5FDclose(lf);
+        H5Pclose(fapl_id);
+        H5Pclose(sec2_fapl_id);
+        H5Pclose(fapl_id_out);
+        H5Pclose(dcpl);
+        H5Sclose(space);
+        H5Dclose(dset);
+        H5Dclose(dset2);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY
+
+    free(points);
+    free(check);
+
+    return -1;
+#endif /*H5_HAVE_MMAP_VFD*/
+}
+
 /*-------------------------------------------------------------------------
  * Function:    test_family_opens
  *
@@ -4524,6 +5184,24 @@ test_vector_io(const char *vfd_name)
 
         h5_fixname(FILENAME[7], fapl_id, filename, sizeof filename);
     }
+#ifdef H5_HAVE_DIRECT
+    else if (strcmp(vfd_name, "direct") == 0) {
+
+        if (H5Pset_fapl_direct(fapl_id, 1024, 4096, 8 * 4096) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[5], fapl_id, filename, sizeof filename);
+    }
+#endif
+#ifdef H5_HAVE_IOURING_VFD
+    else if (strcmp(vfd_name, "io_uring") == 0) {
+
+        if (H5Pset_fapl_iouring(fapl_id, 0, 0) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[16], fapl_id, filename, sizeof filename);
+    }
+#endif
     else {
 
         fprintf(stdout, "un-supported VFD\n");
@@ -5057,6 +5735,24 @@ test_selection_io(const char *vfd_name)
 
         h5_fixname(FILENAME[7], fapl_id, filename, sizeof filename);
     }
+#ifdef H5_HAVE_DIRECT
+    else if (strcmp(vfd_name, "direct") == 0) {
+
+        if (H5Pset_fapl_direct(fapl_id, 1024, 4096, 8 * 4096) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[5], fapl_id, filename, sizeof filename);
+    }
+#endif
+#ifdef H5_HAVE_IOURING_VFD
+    else if (strcmp(vfd_name, "io_uring") == 0) {
+
+        if (H5Pset_fapl_iouring(fapl_id, 0, 0) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[16], fapl_id, filename, sizeof filename);
+    }
+#endif
     else {
 
         fprintf(stdout, "un-supported VFD\n");
@@ -5879,6 +6575,8 @@ main(void)
     nerrors += test_sec2() < 0 ? 1 : 0;
     nerrors += test_core() < 0 ? 1 : 0;
     nerrors += test_direct() < 0 ? 1 : 0;
+    nerrors += test_iouring() < 0 ? 1 : 0;
+    nerrors += test_mmap() < 0 ? 1 : 0;
     nerrors += test_family() < 0 ? 1 : 0;
     nerrors += test_family_compat() < 0 ? 1 : 0;
     nerrors += test_family_member_fapl() < 0 ? 1 : 0;
@@ -5893,6 +6591,14 @@ main(void)
     nerrors += test_vector_io("stdio") < 0 ? 1 : 0;
     nerrors += test_selection_io("sec2") < 0 ? 1 : 0;
     nerrors += test_selection_io("stdio") < 0 ? 1 : 0;
+#ifdef H5_HAVE_DIRECT
+    nerrors += test_vector_io("direct") < 0 ? 1 : 0;
+    nerrors += test_selection_io("direct") < 0 ? 1 : 0;
+#endif
+#ifdef H5_HAVE_IOURING_VFD
+    nerrors += test_vector_io("io_uring") < 0 ? 1 : 0;
+    nerrors += test_selection_io("io_uring") < 0 ? 1 : 0;
+#endif
     nerrors += test_ctl() < 0 ? 1 : 0;
 
     if (nerrors) {
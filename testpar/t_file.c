@@ -138,7 +138,14 @@ test_page_buffer_access(void *params)
 {
     const char *filename;
     hid_t       file_id = H5I_INVALID_HID; /* File ID */
+    hid_t       dset_id = H5I_INVALID_HID; /* Dataset ID */
     hid_t       fcpl, fapl;
+    hid_t       sid, mem_space;
+    hsize_t     dims[1], start[1], count[1];
+    int        *buf = NULL;
+    int         n, num_rows = 200;
+    unsigned    accesses[2], hits[2], misses[2], evictions[2], bypasses[2];
+    H5F_t      *file_ptr = NULL;
     herr_t      ret; /* generic return value */
 #ifdef PB_OUT
     size_t      page_count = 0;
@@ -155,10 +162,10 @@ test_page_buffer_access(void *params)
 
     filename = ((const H5Ptest_param_t *)params)->name;
 
-    /* Until page buffering is supported in parallel in some form (even if
-     * just for a single MPI process), this test just will just check to
-     * make sure that an error is thrown when page buffering is enabled
-     * with parallel access.
+    /* Page buffering in parallel requires collective metadata writes to be
+     * disabled.  Collective metadata reads go through the page buffers of
+     * all processes, with process 0 loading each page and broadcasting it,
+     * and raw data is buffered when the file is opened read-only.
      */
     if (VERBOSE_MED)
         printf("Page Buffer Usage in Parallel %s\n", filename);
@@ -170,7 +177,7 @@ test_page_buffer_access(void *params)
 
     ret = H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 1, (hsize_t)0);
     VRFY((ret == 0), "");
-    ret = H5Pset_file_space_page_size(fcpl, sizeof(int) * 128);
+    ret = H5Pset_file_space_page_size(fcpl, sizeof(int) * 1024);
     VRFY((ret == 0), "");
     ret = H5Pset_page_buffer_size(fapl, sizeof(int) * 100000, 0, 0);
     VRFY((ret == 0), "");
@@ -187,13 +194,77 @@ test_page_buffer_access(void *params)
     ret = H5Pset_coll_metadata_write(fapl, false);
     VRFY((ret >= 0), "");
 
-    /* This should fail due to page buffering not being supported in parallel */
-    H5E_BEGIN_TRY
-    {
-        file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl);
-    }
-    H5E_END_TRY
-    VRFY((file_id < 0), "H5Fcreate failed");
+    /* Each process writes its own slab of a shared dataset */
+    file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl);
+    VRFY((file_id >= 0), "H5Fcreate succeeded");
+
+    dims[0]  = (hsize_t)(num_rows * mpi_size);
+    start[0] = (hsize_t)(num_rows * mpi_rank);
+    count[0] = (hsize_t)num_rows;
+    sid      = H5Screate_simple(1, dims, NULL);
+    VRFY((sid >= 0), "H5Screate_simple succeeded");
+    mem_space = H5Screate_simple(1, count, NULL);
+    VRFY((mem_space >= 0), "H5Screate_simple succeeded");
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+
+    buf = (int *)malloc(sizeof(int) * (size_t)num_rows);
+    VRFY((buf != NULL), "malloc succeeded");
+    for (n = 0; n < num_rows; n++)
+        buf[n] = mpi_rank * num_rows + n;
+
+    dset_id = H5Dcreate2(file_id, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((dset_id >= 0), "H5Dcreate2 succeeded");
+    ret = H5Dwrite(dset_id, H5T_NATIVE_INT, mem_space, sid, H5P_DEFAULT, buf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+    ret = H5Dclose(dset_id);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+    ret = H5Fclose(file_id);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    /* Reopen the file read-only, with collective metadata reads */
+    ret = H5Pset_all_coll_metadata_ops(fapl, true);
+    VRFY((ret >= 0), "H5Pset_all_coll_metadata_ops succeeded");
+    file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl);
+    VRFY((file_id >= 0), "H5Fopen succeeded");
+    file_ptr = (H5F_t *)H5VL_object_verify(file_id, H5I_FILE);
+    VRFY((file_ptr != NULL), "H5VL_object_verify succeeded");
+    VRFY((file_ptr->shared->page_buf != NULL), "page buffer created");
+
+    ret = H5Freset_page_buffering_stats(file_id);
+    VRFY((ret >= 0), "H5Freset_page_buffering_stats succeeded");
+
+    dset_id = H5Dopen2(file_id, "dset", H5P_DEFAULT);
+    VRFY((dset_id >= 0), "H5Dopen2 succeeded");
+
+    /* Every process, not just the one that read them from the file, now
+     * holds the metadata pages that were loaded
+     */
+    ret = H5Fget_page_buffering_stats(file_id, accesses, hits, misses, evictions, bypasses);
+    VRFY((ret >= 0), "H5Fget_page_buffering_stats succeeded");
+    VRFY((misses[0] > 0), "metadata pages loaded");
+    VRFY((file_ptr->shared->page_buf->meta_count > 0), "metadata pages in page buffer");
+
+    /* Read back the data with independent I/O, through the page buffer */
+    memset(buf, 0, sizeof(int) * (size_t)num_rows);
+    ret = H5Dread(dset_id, H5T_NATIVE_INT, mem_space, sid, H5P_DEFAULT, buf);
+    VRFY((ret >= 0), "H5Dread succeeded");
+    for (n = 0; n < num_rows; n++)
+        VRFY((buf[n] == mpi_rank * num_rows + n), "Read different values than written");
+
+    ret = H5Fget_page_buffering_stats(file_id, accesses, hits, misses, evictions, bypasses);
+    VRFY((ret >= 0), "H5Fget_page_buffering_stats succeeded");
+    VRFY((accesses[1] > 0), "raw data accessed through page buffer");
+
+    ret = H5Dclose(dset_id);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+    ret = H5Fclose(file_id);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+    ret = H5Sclose(sid);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Sclose(mem_space);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    free(buf);
 
 #ifdef PB_OUT
     ret = create_file(filename, fcpl, fapl, H5AC_METADATA_WRITE_STRATEGY__DISTRIBUTED);
@@ -255,7 +326,7 @@ test_page_buffer_access(void *params)
         ret = H5F_block_write(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * (size_t)num_elements, data);
         VRFY((ret == 0), "");
 
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* update the first 50 elements */
         for (i = 0; i < 50; i++)
@@ -266,7 +337,7 @@ test_page_buffer_access(void *params)
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
         page_count += 2;
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* update the second 50 elements */
         for (i = 0; i < 50; i++)
@@ -275,7 +346,7 @@ test_page_buffer_access(void *params)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 50), sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* update 100 - 200 */
         for (i = 0; i < 100; i++)
@@ -284,7 +355,7 @@ test_page_buffer_access(void *params)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 100), sizeof(int) * 100, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         ret = H5PB_flush(f->shared);
         VRFY((ret == 0), "");
@@ -292,24 +363,24 @@ test_page_buffer_access(void *params)
         /* read elements 0 - 200 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 200, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 200; i++)
             VRFY((data[i] == i), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 200, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 200; i++)
             VRFY((data[i] == i), "Read different values than written");
 
         /* read elements 0 - 50 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == i), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == i), "Read different values than written");
 
@@ -363,7 +434,7 @@ test_page_buffer_access(void *params)
         ret = H5F_block_write(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * (size_t)num_elements, data);
         VRFY((ret == 0), "");
 
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* update the first 50 elements */
         for (i = 0; i < 50; i++)
@@ -372,7 +443,7 @@ test_page_buffer_access(void *params)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* update the second 50 elements */
         for (i = 0; i < 50; i++)
@@ -381,7 +452,7 @@ test_page_buffer_access(void *params)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 50), sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* update 100 - 200 */
         for (i = 0; i < 100; i++)
@@ -390,7 +461,7 @@ test_page_buffer_access(void *params)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 100), sizeof(int) * 100, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         ret = H5Fflush(file_id, H5F_SCOPE_GLOBAL);
         VRFY((ret == 0), "");
@@ -398,25 +469,25 @@ test_page_buffer_access(void *params)
         /* read elements 0 - 200 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 200, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 200; i++)
             VRFY((data[i] == i), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 200, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 200; i++)
             VRFY((data[i] == i), "Read different values than written");
 
         /* read elements 0 - 50 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == i), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
         page_count += 1;
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == i), "Read different values than written");
 
@@ -426,20 +497,20 @@ test_page_buffer_access(void *params)
             data[i] = -1;
         ret = H5F_block_write(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* read elements 0 - 50 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == -1), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == -1), "Read different values than written");
 
@@ -742,7 +813,7 @@ open_file(const char *filename, hid_t fapl, int metadata_write_strategy, hsize_t
     /* flush invalidate each ring, starting from the outermost ring and
      * working inward.
      */
-    for (i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for (i = 0; i < (int)cache_ptr->index_buckets; i++) {
         H5C_cache_entry_t *entry_ptr = NULL;
 
         entry_ptr = cache_ptr->index[i];
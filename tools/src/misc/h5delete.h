@@ -28,7 +28,7 @@
  * \subsection subsec_cltools_h5delete_options Options
  * \li <strong>-f</strong> Suppress output
  *
- * Previous Chapter \ref sec_cltools_h5debug - Next Chapter \ref sec_cltools_h5mkgrp
+ * Previous Chapter \ref sec_cltools_h5debug - Next Chapter \ref sec_cltools_h5mdclog
  *
  * <hr>
  * Navigate back: \ref index "Main" / \ref UG / \ref CommandTools
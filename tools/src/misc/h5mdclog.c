@@ -0,0 +1,343 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the LICENSE file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* h5mdclog tool
+ *
+ * Converts a binary metadata cache log, written when the log format is set
+ * to H5AC_LOG_FORMAT_BINARY with H5Pset_mdc_log_format(), to the JSON log
+ * format or to the metadata cache trace file format.
+ */
+
+#include "H5private.h"
+#include "H5Cprivate.h"
+
+/* Names of the record actions in JSON logs, indexed by H5C_log_action_t */
+static const char *json_action_names_g[H5C_LOG_ACTION_NTYPES] = {
+    "logging start", "logging stop", "create",       "destroy",
+    "evict",         "expunge",      "flush",        "insert",
+    "dirty",         "clean",        "unserialized", "serialized",
+    "move",          "pin",          "create_fd",    "protect",
+    "resize",        "unpin",        "destroy_fd",   "unprotect",
+    "set_config",    "remove"};
+
+/* A decoded log record */
+typedef struct log_record_t {
+    uint64_t         timestamp; /* Microseconds since the epoch */
+    uint64_t         address;
+    uint64_t         address2;
+    uint64_t         size;
+    uint32_t         flags;
+    int              type_id;
+    H5C_log_action_t action;
+    int              returned;
+} log_record_t;
+
+static void usage(void);
+static void write_json_record(FILE *out, const log_record_t *rec);
+static void write_trace_record(FILE *out, const log_record_t *rec);
+
+static void
+usage(void)
+{
+    fprintf(stderr, "usage: h5mdclog [-t] <binary_log> [<output>]\n");
+    fprintf(stderr, "  Converts a binary metadata cache log to a JSON log or, with -t, to a\n");
+    fprintf(stderr, "  metadata cache trace file.  Output goes to stdout if no output file is given.\n");
+}
+
+/* Write a record in the format of the JSON log */
+static void
+write_json_record(FILE *out, const log_record_t *rec)
+{
+    long long seconds = (long long)(rec->timestamp / 1000000);
+
+    if (H5C_LOG_ACTION_START == rec->action)
+        fprintf(out, "{\n\"HDF5 metadata cache log messages\" : [\n");
+
+    fprintf(out, "{\"timestamp\":%lld,\"action\":\"%s\"", seconds, json_action_names_g[rec->action]);
+
+    switch (rec->action) {
+        case H5C_LOG_ACTION_START:
+        case H5C_LOG_ACTION_STOP:
+        case H5C_LOG_ACTION_DESTROY:
+            break;
+
+        case H5C_LOG_ACTION_EXPUNGE:
+            fprintf(out, ",\"address\":0x%lx,\"type_id\":%d", (unsigned long)rec->address, rec->type_id);
+            break;
+
+        case H5C_LOG_ACTION_INSERT:
+            fprintf(out, ",\"address\":0x%lx,\"type_id\":%d,\"flags\":0x%x,\"size\":%d",
+                    (unsigned long)rec->address, rec->type_id, (unsigned)rec->flags, (int)rec->size);
+            break;
+
+        case H5C_LOG_ACTION_MOVE:
+            fprintf(out, ",\"old_address\":0x%lx,\"new_address\":0x%lx,\"type_id\":%d",
+                    (unsigned long)rec->address, (unsigned long)rec->address2, rec->type_id);
+            break;
+
+        case H5C_LOG_ACTION_CREATE_FD:
+        case H5C_LOG_ACTION_DESTROY_FD:
+            fprintf(out, ",\"parent_addr\":0x%lx,\"child_addr\":0x%lx", (unsigned long)rec->address,
+                    (unsigned long)rec->address2);
+            break;
+
+        case H5C_LOG_ACTION_PROTECT:
+            fprintf(out, ",\"address\":0x%lx,\"type_id\":%d,\"readwrite\":\"%s\",\"size\":%d",
+                    (unsigned long)rec->address, rec->type_id,
+                    (H5C__READ_ONLY_FLAG == rec->flags) ? "READ" : "WRITE", (int)rec->size);
+            break;
+
+        case H5C_LOG_ACTION_RESIZE:
+            fprintf(out, ",\"address\":0x%lx,\"new_size\":%d", (unsigned long)rec->address, (int)rec->size);
+            break;
+
+        case H5C_LOG_ACTION_UNPROTECT:
+            fprintf(out, ",\"address\":0x%lx,\"id\":%d,\"flags\":%x", (unsigned long)rec->address,
+                    rec->type_id, (unsigned)rec->flags);
+            break;
+
+        case H5C_LOG_ACTION_DIRTY:
+        case H5C_LOG_ACTION_CLEAN:
+        case H5C_LOG_ACTION_UNSERIALIZED:
+        case H5C_LOG_ACTION_SERIALIZED:
+        case H5C_LOG_ACTION_PIN:
+        case H5C_LOG_ACTION_UNPIN:
+        case H5C_LOG_ACTION_REMOVE:
+            fprintf(out, ",\"address\":0x%lx", (unsigned long)rec->address);
+            break;
+
+        case H5C_LOG_ACTION_CREATE:
+        case H5C_LOG_ACTION_EVICT:
+        case H5C_LOG_ACTION_FLUSH:
+        case H5C_LOG_ACTION_SET_CONFIG:
+        case H5C_LOG_ACTION_NTYPES:
+        default:
+            break;
+    } /* end switch */
+
+    /* Only the start, stop and destroy messages don't report a return value */
+    if (H5C_LOG_ACTION_START != rec->action && H5C_LOG_ACTION_STOP != rec->action &&
+        H5C_LOG_ACTION_DESTROY != rec->action)
+        fprintf(out, ",\"returned\":%d", rec->returned);
+
+    if (H5C_LOG_ACTION_STOP == rec->action)
+        fprintf(out, "}\n]}\n");
+    else
+        fprintf(out, "},\n");
+}
+
+/* Write a record in the format of the trace file.  Records of operations
+ * that aren't traced are skipped, as are configuration changes, since the
+ * binary log doesn't record the configuration.
+ */
+static void
+write_trace_record(FILE *out, const log_record_t *rec)
+{
+    unsigned long addr  = (unsigned long)rec->address;
+    unsigned long addr2 = (unsigned long)rec->address2;
+
+    switch (rec->action) {
+        case H5C_LOG_ACTION_EXPUNGE:
+            fprintf(out, "H5AC_expunge_entry 0x%lx %d %d\n", addr, rec->type_id, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_FLUSH:
+            fprintf(out, "H5AC_flush %d\n", rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_INSERT:
+            fprintf(out, "H5AC_insert_entry 0x%lx %d 0x%x %d %d\n", addr, rec->type_id, (unsigned)rec->flags,
+                    (int)rec->size, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_DIRTY:
+            fprintf(out, "H5AC_mark_entry_dirty 0x%lx %d\n", addr, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_CLEAN:
+            fprintf(out, "H5AC_mark_entry_clean 0x%lx %d\n", addr, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_UNSERIALIZED:
+            fprintf(out, "H5AC_mark_entry_unserialized 0x%lx %d\n", addr, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_SERIALIZED:
+            fprintf(out, "H5AC_mark_entry_serialized 0x%lx %d\n", addr, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_MOVE:
+            fprintf(out, "H5AC_move_entry 0x%lx 0x%lx %d %d\n", addr, addr2, rec->type_id, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_PIN:
+            fprintf(out, "H5AC_pin_protected_entry 0x%lx %d\n", addr, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_CREATE_FD:
+            fprintf(out, "H5AC_create_flush_dependency 0x%lx 0x%lx %d\n", addr, addr2, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_PROTECT:
+            fprintf(out, "H5AC_protect 0x%lx %d 0x%x %d %d\n", addr, rec->type_id, (unsigned)rec->flags,
+                    (int)rec->size, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_RESIZE:
+            fprintf(out, "H5AC_resize_entry 0x%lx %d %d\n", addr, (int)rec->size, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_UNPIN:
+            fprintf(out, "H5AC_unpin_entry 0x%lx %d\n", addr, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_DESTROY_FD:
+            fprintf(out, "H5AC_destroy_flush_dependency 0x%lx 0x%lx %d\n", addr, addr2, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_UNPROTECT:
+            fprintf(out, "H5AC_unprotect 0x%lx %d 0x%x %d\n", addr, rec->type_id, (unsigned)rec->flags,
+                    rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_REMOVE:
+            fprintf(out, "H5AC_remove_entry 0x%lx %d\n", addr, rec->returned);
+            break;
+
+        case H5C_LOG_ACTION_START:
+        case H5C_LOG_ACTION_STOP:
+        case H5C_LOG_ACTION_CREATE:
+        case H5C_LOG_ACTION_DESTROY:
+        case H5C_LOG_ACTION_EVICT:
+        case H5C_LOG_ACTION_SET_CONFIG:
+        case H5C_LOG_ACTION_NTYPES:
+        default:
+            break;
+    } /* end switch */
+}
+
+int
+main(int argc, char *argv[])
+{
+    bool           trace    = false;
+    const char    *in_name  = NULL;
+    const char    *out_name = NULL;
+    FILE          *in       = NULL;
+    FILE          *out      = stdout;
+    uint8_t        header[H5C_LOG_BINARY_HEADER_SIZE];
+    uint8_t       *buf = NULL;
+    const uint8_t *p;
+    uint32_t       version;
+    uint32_t       record_size;
+    uint64_t       start_time;
+    int            argno = 1;
+    int            ret   = EXIT_FAILURE;
+
+    if (argno < argc && !strcmp(argv[argno], "-t")) {
+        trace = true;
+        argno++;
+    }
+    if (argno < argc && (!strcmp(argv[argno], "-h") || !strcmp(argv[argno], "--help"))) {
+        usage();
+        return EXIT_SUCCESS;
+    }
+    if (argc - argno < 1 || argc - argno > 2) {
+        usage();
+        return EXIT_FAILURE;
+    }
+    in_name = argv[argno++];
+    if (argno < argc)
+        out_name = argv[argno];
+
+    if (NULL == (in = fopen(in_name, "rb"))) {
+        fprintf(stderr, "h5mdclog: unable to open %s\n", in_name);
+        goto done;
+    }
+
+    /* Check the header */
+    if (1 != fread(header, sizeof(header), 1, in) ||
+        memcmp(header, H5C_LOG_BINARY_SIGNATURE, (size_t)H5C_LOG_BINARY_SIGNATURE_LEN) != 0) {
+        fprintf(stderr, "h5mdclog: %s is not a binary metadata cache log\n", in_name);
+        goto done;
+    }
+    p = header + H5C_LOG_BINARY_SIGNATURE_LEN;
+    UINT32DECODE(p, version);
+    UINT32DECODE(p, record_size);
+    p += 8; /* Skip the MPI rank and reserved fields */
+    UINT64DECODE(p, start_time);
+    if (version != H5C_LOG_BINARY_VERSION || record_size < H5C_LOG_BINARY_RECORD_SIZE) {
+        fprintf(stderr, "h5mdclog: unsupported binary metadata cache log version %u\n", (unsigned)version);
+        goto done;
+    }
+
+    if (NULL == (buf = (uint8_t *)malloc(record_size))) {
+        fprintf(stderr, "h5mdclog: memory allocation failed\n");
+        goto done;
+    }
+
+    if (out_name && NULL == (out = fopen(out_name, "w"))) {
+        out = stdout;
+        fprintf(stderr, "h5mdclog: unable to create %s\n", out_name);
+        goto done;
+    }
+
+    if (trace)
+        fprintf(out, "### HDF5 metadata cache trace file version 1 ###\n");
+
+    /* Convert the records */
+    while (1 == fread(buf, (size_t)record_size, 1, in)) {
+        log_record_t rec;
+        int16_t      type_id;
+        unsigned     action;
+
+        p = buf;
+        UINT64DECODE(p, rec.timestamp);
+        rec.timestamp += start_time;
+        UINT64DECODE(p, rec.address);
+        UINT64DECODE(p, rec.address2);
+        UINT64DECODE(p, rec.size);
+        UINT32DECODE(p, rec.flags);
+        INT16DECODE(p, type_id);
+        action       = *p++;
+        rec.returned = (int)(int8_t)*p++;
+        rec.type_id  = (int)type_id;
+
+        if (action >= H5C_LOG_ACTION_NTYPES) {
+            fprintf(stderr, "h5mdclog: unknown record type %u in %s\n", action, in_name);
+            goto done;
+        }
+        rec.action = (H5C_log_action_t)action;
+
+        if (trace)
+            write_trace_record(out, &rec);
+        else
+            write_json_record(out, &rec);
+    }
+
+    if (ferror(in)) {
+        fprintf(stderr, "h5mdclog: error reading %s\n", in_name);
+        goto done;
+    }
+
+    ret = EXIT_SUCCESS;
+
+done:
+    free(buf);
+    if (in)
+        fclose(in);
+    if (out != stdout && EOF == fclose(out)) {
+        fprintf(stderr, "h5mdclog: error writing %s\n", out_name);
+        ret = EXIT_FAILURE;
+    }
+
+    return ret;
+}
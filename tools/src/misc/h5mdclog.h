@@ -0,0 +1,42 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the LICENSE file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef H5MDCLOG_H
+#define H5MDCLOG_H
+
+/** \page H5TOOL_MDC_UG The HDF5 h5mdclog Tool
+ *
+ * Navigate back: \ref index "Main" / \ref UG / \ref CommandTools
+ * <hr>
+ *
+ * \section sec_cltools_h5mdclog h5mdclog
+ *
+ * \subsection subsec_cltools_h5mdclog_intro Introduction
+ *  With h5mdclog, you can convert a binary metadata cache log, written when
+ *  the log format is set to #H5AC_LOG_FORMAT_BINARY with H5Pset_mdc_log_format(),
+ *  to the JSON log format or to the metadata cache trace file format.
+ *
+ * \subsection subsec_cltools_h5mdclog_usage Usage
+ *  <h4>h5mdclog [-t] \<binary_log\> [\<output\>]</h4>
+ *
+ * \subsection subsec_cltools_h5mdclog_options Options
+ * \li <strong>-t</strong> Write a trace file instead of a JSON log
+ *
+ * The converted log is written to stdout if no output file is given.
+ *
+ * Previous Chapter \ref sec_cltools_h5delete - Next Chapter \ref sec_cltools_h5mkgrp
+ *
+ * <hr>
+ * Navigate back: \ref index "Main" / \ref UG / \ref CommandTools
+ *
+ */
+
+#endif /* H5MDCLOG_H */
@@ -51,7 +51,7 @@
  * \li <strong>--vfd-info</strong>  VFD-specific info to pass to the VFL driver used for
  *                   opening the HDF5 file specified
  *
- * Previous Chapter \ref sec_cltools_h5delete - Next Chapter \ref sec_cltools_h5repart
+ * Previous Chapter \ref sec_cltools_h5mdclog - Next Chapter \ref sec_cltools_h5repart
  *
  * <hr>
  * Navigate back: \ref index "Main" / \ref UG / \ref CommandTools
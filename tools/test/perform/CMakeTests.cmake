@@ -24,6 +24,7 @@ add_custom_target(zip_perf_files ALL COMMENT "Copying files needed by zip_perf t
 #-----------------------------------------------------------------------------
 if (HDF5_TEST_SERIAL)
   set (PERFORM_CLEANFILES
+          api_overhead.h5
           chunk.h5
           direct_write.h5
           unix.raw
@@ -117,6 +118,28 @@ if (HDF5_TEST_SERIAL)
     set_tests_properties (PERFORM_iopipe PROPERTIES DISABLED true)
   endif ()
 
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_api_overhead COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:api_overhead> 10000)
+  else ()
+    add_test (NAME PERFORM_api_overhead COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:api_overhead>"
+        -D "TEST_ARGS:STRING=10000"
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=api_overhead.txt"
+        #-D "TEST_REFERENCE=api_overhead.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_api_overhead PROPERTIES
+      FIXTURES_REQUIRED clear_perform
+  )
+  if ("PERFORM_api_overhead" MATCHES "${HDF5_DISABLE_TESTS_REGEX}")
+    set_tests_properties (PERFORM_api_overhead PROPERTIES DISABLED true)
+  endif ()
+
   if (HDF5_ENABLE_USING_MEMCHECKER)
     add_test (NAME PERFORM_overhead COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:overhead>)
   else ()
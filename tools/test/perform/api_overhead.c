@@ -0,0 +1,171 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the LICENSE file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:  Measures the time spent in tiny API calls, where most of the work
+ *           is entering and leaving the library (pushing and popping the API
+ *           context, checking IDs and property lists).
+ */
+
+/* See H5private.h for how to include headers */
+#undef NDEBUG
+#include "hdf5.h"
+#include "H5private.h"
+
+#define FILENAME "api_overhead.h5"
+
+/* Default # of calls timed for each operation */
+#define DEFAULT_NCALLS 200000
+
+/* The operations timed */
+typedef enum op_t {
+    OP_IS_VALID,   /* H5Iis_valid() on a file ID */
+    OP_GET_TYPE,   /* H5Iget_type() on a dataset ID */
+    OP_ATTR_READ,  /* H5Aread() of a scalar attribute */
+    OP_LINK_EXIST, /* H5Lexists() with the default link access property list */
+    OP_DSET_SPACE, /* H5Dget_space() + H5Sclose() */
+    OP_NTYPES
+} op_t;
+
+static const char *op_names[OP_NTYPES] = {"H5Iis_valid", "H5Iget_type", "H5Aread (scalar)",
+                                          "H5Lexists (H5P_LINK_ACCESS_DEFAULT)", "H5Dget_space + H5Sclose"};
+
+/*-------------------------------------------------------------------------
+ * Function:  run_op
+ *
+ * Purpose:   Calls an operation NCALLS times.
+ *
+ * Return:    0 on success, -1 on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+run_op(op_t op, unsigned long ncalls, hid_t file, hid_t dset, hid_t attr)
+{
+    unsigned long u;
+    int           value;
+    hid_t         space;
+
+    for (u = 0; u < ncalls; u++) {
+        switch (op) {
+            case OP_IS_VALID:
+                if (H5Iis_valid(file) <= 0)
+                    return -1;
+                break;
+
+            case OP_GET_TYPE:
+                if (H5I_DATASET != H5Iget_type(dset))
+                    return -1;
+                break;
+
+            case OP_ATTR_READ:
+                if (H5Aread(attr, H5T_NATIVE_INT, &value) < 0)
+                    return -1;
+                break;
+
+            case OP_LINK_EXIST:
+                if (H5Lexists(file, "dset", H5P_LINK_ACCESS_DEFAULT) <= 0)
+                    return -1;
+                break;
+
+            case OP_DSET_SPACE:
+                if ((space = H5Dget_space(dset)) < 0)
+                    return -1;
+                if (H5Sclose(space) < 0)
+                    return -1;
+                break;
+
+            case OP_NTYPES:
+            default:
+                return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:  main
+ *
+ * Purpose:   Times each operation and prints the average time per call.
+ *            The optional argument is the number of calls for each one.
+ *
+ * Return:    EXIT_SUCCESS/EXIT_FAILURE
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    unsigned long ncalls = DEFAULT_NCALLS;
+    hid_t         file = H5I_INVALID_HID, space = H5I_INVALID_HID;
+    hid_t         dset = H5I_INVALID_HID, attr = H5I_INVALID_HID;
+    int           value = 42;
+    double        start_t, end_t;
+    op_t          op;
+
+    if (argc > 2 || (argc == 2 && 0 == (ncalls = strtoul(argv[1], NULL, 0)))) {
+        fprintf(stderr, "usage: %s [NCALLS]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /* Create a file with a dataset and a scalar attribute */
+    if ((file = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    if ((space = H5Screate(H5S_SCALAR)) < 0)
+        goto error;
+    if ((dset = H5Dcreate2(file, "dset", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    if ((attr = H5Acreate2(dset, "attr", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    if (H5Awrite(attr, H5T_NATIVE_INT, &value) < 0)
+        goto error;
+
+    printf("%lu calls of each operation\n", ncalls);
+    for (op = OP_IS_VALID; op < OP_NTYPES; op++) {
+        start_t = H5_get_time();
+        if (run_op(op, ncalls, file, dset, attr) < 0) {
+            fprintf(stderr, "%s failed\n", op_names[op]);
+            goto error;
+        }
+        end_t = H5_get_time();
+
+        if ((end_t - start_t) > 0.0)
+            printf("%-40s %8.1f ns/call\n", op_names[op], ((end_t - start_t) * 1.0e9) / (double)ncalls);
+        else
+            printf("%-40s no time because timer is not available\n", op_names[op]);
+    }
+
+    if (H5Aclose(attr) < 0)
+        goto error;
+    if (H5Dclose(dset) < 0)
+        goto error;
+    if (H5Sclose(space) < 0)
+        goto error;
+    if (H5Fclose(file) < 0)
+        goto error;
+    if (!getenv(HDF5_NOCLEANUP))
+        remove(FILENAME);
+
+    return EXIT_SUCCESS;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Aclose(attr);
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(file);
+    }
+    H5E_END_TRY
+    return EXIT_FAILURE;
+}